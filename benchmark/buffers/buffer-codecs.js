@@ -0,0 +1,39 @@
+'use strict';
+const assert = require('assert');
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  codec: ['base64', 'hex'],
+  op: ['encode', 'decode'],
+  // Decode URL-safe base64; the same as 'standard' for hex.
+  alphabet: ['standard', 'url'],
+  len: [64, 1024, 64 * 1024, 1024 * 1024],
+  n: [64]
+});
+
+function main({ codec, op, alphabet, len, n }) {
+  const buf = Buffer.allocUnsafe(len);
+  for (var i = 0; i < len; i++)
+    buf[i] = (i * 7) & 0xff;
+
+  var str = buf.toString(codec);
+  if (alphabet === 'url')
+    str = str.replace(/\+/g, '-').replace(/\//g, '_');
+  assert(Buffer.from(str, codec).equals(buf));
+
+  // Scale the iterations so that every length processes the same number
+  // of bytes.
+  const iterations = Math.ceil(n * 1024 * 1024 / len);
+
+  if (op === 'encode') {
+    bench.start();
+    for (i = 0; i < iterations; i++)
+      buf.toString(codec);
+    bench.end(iterations);
+  } else {
+    bench.start();
+    for (i = 0; i < iterations; i++)
+      buf.write(str, codec);
+    bench.end(iterations);
+  }
+}
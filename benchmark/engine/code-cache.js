@@ -0,0 +1,60 @@
+'use strict';
+
+// Producing and consuming the serialized byte code of a script with
+// cachedData, compared to compiling it from source.
+
+const common = require('../common.js');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const vm = require('vm');
+
+const bench = common.createBenchmark(main, {
+  n: [100],
+  mode: ['source', 'produce', 'consume']
+});
+
+function main({ n, mode }) {
+  const dir = path.resolve(__dirname, '../../lib');
+  const source = ['url.js', 'util.js', 'fs.js', 'events.js']
+    .map((file) => fs.readFileSync(path.join(dir, file), 'utf8'))
+    .map((text) => `(function(exports, require, module) {\n${text}\n});`)
+    .join('\n');
+
+  const { cachedData } = new vm.Script(source, {
+    filename: 'code-cache.js',
+    produceCachedData: true
+  });
+  assert(cachedData);
+
+  var script;
+  bench.start();
+  switch (mode) {
+    case '':
+      // Empty string falls through to next line as default, mostly for tests.
+    case 'source':
+      for (var i = 0; i < n; i++)
+        script = new vm.Script(source, { filename: 'code-cache.js' });
+      break;
+    case 'produce':
+      for (var j = 0; j < n; j++) {
+        script = new vm.Script(source, {
+          filename: 'code-cache.js',
+          produceCachedData: true
+        });
+      }
+      break;
+    case 'consume':
+      for (var k = 0; k < n; k++) {
+        script = new vm.Script(source, {
+          filename: 'code-cache.js',
+          cachedData
+        });
+      }
+      break;
+    default:
+      throw new Error(`Unexpected mode "${mode}"`);
+  }
+  bench.end(n);
+  assert(script);
+}
@@ -0,0 +1,132 @@
+'use strict';
+
+// Replays the allocation patterns of a server over `n` requests:
+//
+// - request: every request builds a small tree of objects and strings that
+//   dies once the request is done.
+// - cache: every request also goes through a long lived LRU cache of
+//   `live` entries, so that old objects keep being replaced.
+// - buffer: every request also allocates a large buffer outside of the
+//   JavaScript heap.
+// - mixed: all of the above.
+//
+// With stat=throughput the rate is in requests per second. With stat=p50,
+// stat=p99 and stat=max it is the inverse of that percentile of the garbage
+// collection pauses reported by perf_hooks, in pauses per second. With
+// stat=rss it is the inverse of the growth of the resident set size, in
+// MiB. Higher is better for all of them, like for every other benchmark.
+
+const common = require('../common.js');
+const { PerformanceObserver } = require('perf_hooks');
+
+const bench = common.createBenchmark(main, {
+  n: [1e5],
+  live: [1e4],
+  workload: ['request', 'cache', 'buffer', 'mixed'],
+  stat: ['throughput', 'p50', 'p99', 'max', 'rss']
+});
+
+const kBufferSize = 64 * 1024;
+
+function percentile(sorted, p) {
+  const index = Math.min(sorted.length - 1,
+                         Math.floor(sorted.length * p / 100));
+  return sorted[index];
+}
+
+function buildRequest(id) {
+  const headers = {};
+  for (var i = 0; i < 8; i++)
+    headers[`x-header-${i}`] = `value-${id}-${i}`;
+  const body = [];
+  for (var j = 0; j < 16; j++)
+    body.push({ id: j, name: `item-${j}`, tags: [id, j] });
+  return { id, url: `/items/${id % 1000}`, headers, body };
+}
+
+class LRUCache {
+  constructor(capacity) {
+    this.capacity = capacity;
+    this.map = new Map();
+  }
+
+  get(key) {
+    const value = this.map.get(key);
+    if (value !== undefined) {
+      this.map.delete(key);
+      this.map.set(key, value);
+    }
+    return value;
+  }
+
+  set(key, value) {
+    if (this.map.size >= this.capacity)
+      this.map.delete(this.map.keys().next().value);
+    this.map.set(key, value);
+  }
+}
+
+function main({ n, live, workload, stat }) {
+  const useCache = workload === 'cache' || workload === 'mixed';
+  const useBuffer = workload === 'buffer' || workload === 'mixed';
+  const cache = new LRUCache(live);
+  // Fill the cache first so that it is part of the old heap from the start
+  for (var i = 0; i < live; i++)
+    cache.set(`key-${i}`, buildRequest(i));
+
+  const pauses = [];
+  const obs = new PerformanceObserver((list) => {
+    for (const entry of list.getEntries())
+      pauses.push(entry.duration);
+  });
+  obs.observe({ entryTypes: ['gc'] });
+
+  const rssBefore = process.memoryUsage().rss;
+  var rssPeak = rssBefore;
+  var checksum = 0;
+  const start = process.hrtime();
+  if (stat === 'throughput')
+    bench.start();
+  for (var j = 0; j < n; j++) {
+    const request = buildRequest(j);
+    checksum += request.body.length;
+    if (useCache) {
+      // Most lookups hit, the remaining ones replace the oldest entry
+      const key = `key-${j % 10 === 0 ? j + live : j % live}`;
+      if (cache.get(key) === undefined)
+        cache.set(key, request);
+    }
+    if (useBuffer) {
+      const buffer = Buffer.allocUnsafe(kBufferSize);
+      buffer[j % kBufferSize] = j;
+      checksum += buffer.length;
+    }
+    if (stat === 'rss' && j % 1000 === 0)
+      rssPeak = Math.max(rssPeak, process.memoryUsage().rss);
+  }
+
+  if (stat === 'throughput') {
+    bench.end(n);
+    obs.disconnect();
+    return;
+  }
+
+  const elapsed = process.hrtime(start);
+  if (checksum === 0)
+    throw new Error('the workload was optimized away');
+  // The gc entries are delivered asynchronously
+  setTimeout(() => {
+    obs.disconnect();
+    if (stat === 'rss') {
+      const growth = (rssPeak - rssBefore) / (1024 * 1024);
+      // Growing less than a KiB, or shrinking, counts as a KiB
+      bench.report(1 / Math.max(growth, 1 / 1024), elapsed);
+      return;
+    }
+    pauses.sort((a, b) => a - b);
+    const p = stat === 'max' ? 100 : stat === 'p99' ? 99 : 50;
+    // Pauses shorter than a microsecond, or none at all, count as one
+    const pauseMs = pauses.length ? percentile(pauses, p) : 0;
+    bench.report(1e3 / Math.max(pauseMs, 1e-3), elapsed);
+  }, 10);
+}
@@ -0,0 +1,63 @@
+'use strict';
+
+// Allocation under a live heap of `live` objects, short lived objects are
+// allocated and a part of them is kept to promote them.
+//
+// With stat=throughput the rate is in allocations per second. With stat=p50
+// and stat=p99 it is the inverse of that percentile of the garbage
+// collection pauses reported by perf_hooks, in pauses per second, so that
+// higher is better like for every other benchmark.
+
+const common = require('../common.js');
+const { PerformanceObserver } = require('perf_hooks');
+
+const bench = common.createBenchmark(main, {
+  n: [2e6],
+  live: [1e4, 1e6],
+  stat: ['throughput', 'p50', 'p99']
+});
+
+function percentile(sorted, p) {
+  const index = Math.min(sorted.length - 1,
+                         Math.floor(sorted.length * p / 100));
+  return sorted[index];
+}
+
+function main({ n, live, stat }) {
+  const heap = new Array(live);
+  for (var i = 0; i < live; i++)
+    heap[i] = { index: i, next: null };
+
+  const pauses = [];
+  const obs = new PerformanceObserver((list) => {
+    for (const entry of list.getEntries())
+      pauses.push(entry.duration);
+  });
+  obs.observe({ entryTypes: ['gc'] });
+
+  const start = process.hrtime();
+  if (stat === 'throughput')
+    bench.start();
+  for (var j = 0; j < n; j++) {
+    const obj = { index: j, next: null, payload: [j, `${j}`] };
+    if (j % 8 === 0)
+      heap[j % live] = obj;
+  }
+
+  if (stat === 'throughput') {
+    bench.end(n);
+    obs.disconnect();
+    return;
+  }
+
+  const elapsed = process.hrtime(start);
+  // The gc entries are delivered asynchronously
+  setTimeout(() => {
+    obs.disconnect();
+    pauses.sort((a, b) => a - b);
+    const p = stat === 'p99' ? 99 : 50;
+    // Pauses shorter than a microsecond, or none at all, count as one
+    const pauseMs = pauses.length ? percentile(pauses, p) : 0;
+    bench.report(1e3 / Math.max(pauseMs, 1e-3), elapsed);
+  }, 10);
+}
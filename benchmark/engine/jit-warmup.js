@@ -0,0 +1,49 @@
+'use strict';
+
+// Calls per second over the first n calls of a function that was just
+// created, so that it starts out in the interpreter. Small values of n show
+// how soon the function gets to the jitted tiers, large values approach its
+// steady state.
+
+const common = require('../common.js');
+const assert = require('assert');
+
+const bench = common.createBenchmark(main, {
+  n: [1e2, 1e3, 1e4, 1e5],
+  kind: ['arithmetic', 'property', 'call']
+});
+
+const bodies = {
+  arithmetic: `
+    var sum = 0;
+    for (var i = 0; i < 100; i++)
+      sum += (i * x) % 7;
+    return sum;`,
+  property: `
+    var sum = 0;
+    for (var i = 0; i < 100; i++)
+      sum += o.a + o.b * i;
+    return sum;`,
+  call: `
+    var sum = 0;
+    for (var i = 0; i < 100; i++)
+      sum += f(i, x);
+    return sum;`
+};
+
+function main({ n, kind }) {
+  // A new function for every run, with its own name and source, so that no
+  // profile or jitted code from an earlier one can be reused
+  const fn = new Function('x', 'o', 'f',
+                          `// ${kind} ${n} ${process.hrtime().join('.')}` +
+                          bodies[kind]);
+  const o = { a: 1, b: 2 };
+  const f = (a, b) => a + b;
+
+  var result = 0;
+  bench.start();
+  for (var i = 0; i < n; i++)
+    result += fn(i, o, f);
+  bench.end(n);
+  assert(result !== 0 || n === 0);
+}
@@ -0,0 +1,67 @@
+'use strict';
+
+// JSON.parse() and JSON.stringify() throughput in MB/s of JSON text.
+
+const common = require('../common.js');
+const assert = require('assert');
+
+const bench = common.createBenchmark(main, {
+  n: [100],
+  method: ['parse', 'stringify'],
+  shape: ['records', 'numbers', 'strings'],
+  size: [1e4]
+});
+
+function makeValue(shape, size) {
+  const value = [];
+  for (var i = 0; i < size; i++) {
+    switch (shape) {
+      case 'records':
+        value.push({
+          id: i,
+          name: `record ${i}`,
+          active: i % 2 === 0,
+          tags: ['a', 'b', `t${i % 10}`],
+          position: { x: i / 3, y: -i / 7 }
+        });
+        break;
+      case 'numbers':
+        value.push(i, i / 3, -i * 1e6);
+        break;
+      case 'strings':
+        value.push(`string\t${i} with "quotes" and éscapes`);
+        break;
+      default:
+        throw new Error(`Unexpected shape "${shape}"`);
+    }
+  }
+  return value;
+}
+
+function main({ n, method, shape, size }) {
+  const value = makeValue(shape, size);
+  const text = JSON.stringify(value);
+  const megabytes = Buffer.byteLength(text) / (1024 * 1024);
+
+  var result;
+  switch (method) {
+    case '':
+      // Empty string falls through to next line as default, mostly for tests.
+    case 'parse':
+      bench.start();
+      for (var i = 0; i < n; i++)
+        result = JSON.parse(text);
+      bench.end(n * megabytes);
+      assert.strictEqual(result.length, value.length);
+      break;
+    case 'stringify':
+      bench.start();
+      for (var j = 0; j < n; j++)
+        result = JSON.stringify(value);
+      bench.end(n * megabytes);
+      assert.strictEqual(result.length, text.length);
+      break;
+    default:
+      throw new Error(`Unexpected method "${method}"`);
+  }
+}
@@ -0,0 +1,92 @@
+'use strict';
+
+// Operations per second on Map and Set with different kinds of keys.
+
+const common = require('../common.js');
+const assert = require('assert');
+
+const bench = common.createBenchmark(main, {
+  n: [1e6],
+  type: ['Map', 'Set'],
+  keys: ['int', 'string', 'object'],
+  op: ['add', 'has', 'delete', 'iterate']
+});
+
+function makeKeys(kind, count) {
+  const keys = new Array(count);
+  for (var i = 0; i < count; i++) {
+    switch (kind) {
+      case 'int':
+        keys[i] = i;
+        break;
+      case 'string':
+        keys[i] = `key${i}`;
+        break;
+      case 'object':
+        keys[i] = { i };
+        break;
+      default:
+        throw new Error(`Unexpected keys "${kind}"`);
+    }
+  }
+  return keys;
+}
+
+function add(collection, key) {
+  if (collection instanceof Map)
+    collection.set(key, key);
+  else
+    collection.add(key);
+}
+
+function main({ n, type, keys: kind, op }) {
+  const count = Math.min(n, 1e5);
+  const keys = makeKeys(kind, count);
+  const Collection = type === 'Map' ? Map : Set;
+  var collection = new Collection();
+  if (op !== 'add') {
+    for (var i = 0; i < count; i++)
+      add(collection, keys[i]);
+  }
+
+  var found = 0;
+  bench.start();
+  switch (op) {
+    case 'add':
+      for (var j = 0; j < n; j++) {
+        if (j % count === 0)
+          collection = new Collection();
+        add(collection, keys[j % count]);
+      }
+      found = collection.size;
+      break;
+    case 'has':
+      for (var k = 0; k < n; k++) {
+        if (collection.has(keys[k % count]))
+          found++;
+      }
+      break;
+    case 'delete':
+      for (var l = 0; l < n; l++) {
+        const key = keys[l % count];
+        if (collection.delete(key))
+          found++;
+        add(collection, key);
+      }
+      break;
+    case 'iterate':
+      for (var m = 0; m < n;) {
+        for (const entry of collection) {
+          if (entry !== undefined)
+            found++;
+          if (++m === n)
+            break;
+        }
+      }
+      break;
+    default:
+      throw new Error(`Unexpected op "${op}"`);
+  }
+  bench.end(n);
+  assert(found > 0);
+}
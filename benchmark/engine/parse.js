@@ -0,0 +1,40 @@
+'use strict';
+
+// Parse throughput in MB/s over a bundle made of the modules in lib/.
+// Every iteration gets a source that differs in its first line, so that no
+// cached parse can be reused.
+
+const common = require('../common.js');
+const fs = require('fs');
+const path = require('path');
+const vm = require('vm');
+
+const bench = common.createBenchmark(main, {
+  n: [10],
+  copies: [1, 4],
+  mode: ['compile', 'run']
+});
+
+function makeBundle(copies) {
+  const dir = path.resolve(__dirname, '../../lib');
+  const modules = fs.readdirSync(dir)
+    .filter((file) => file.endsWith('.js'))
+    .map((file) => fs.readFileSync(path.join(dir, file), 'utf8'))
+    .map((source) => `(function(exports, require, module) {\n${source}\n});`);
+  const bundle = modules.join('\n');
+  return new Array(copies).fill(bundle).join('\n');
+}
+
+function main({ n, copies, mode }) {
+  const bundle = makeBundle(copies);
+  const megabytes = Buffer.byteLength(bundle) / (1024 * 1024);
+
+  bench.start();
+  for (var i = 0; i < n; i++) {
+    const source = `// ${i}\n${bundle}`;
+    const script = new vm.Script(source, { filename: `bundle-${i}.js` });
+    if (mode === 'run')
+      script.runInThisContext();
+  }
+  bench.end(n * megabytes);
+}
@@ -0,0 +1,62 @@
+'use strict';
+
+// Regular expression throughput in MB/s of searched text.
+
+const common = require('../common.js');
+const assert = require('assert');
+
+const patterns = {
+  literal: /needle/g,
+  alternation: /(?:GET|POST|PUT|DELETE) \/[a-z]+/g,
+  captures: /(\d{4})-(\d{2})-(\d{2})T(\d{2}):(\d{2})/g,
+  classes: /[A-Z][a-z]+\s[a-z]+/g,
+  backtracking: /"(?:[^"\\]|\\.)*"/g
+};
+
+const bench = common.createBenchmark(main, {
+  n: [20],
+  pattern: Object.keys(patterns),
+  method: ['exec', 'test', 'replace']
+});
+
+function makeText() {
+  const lines = [];
+  for (var i = 0; i < 2e4; i++) {
+    lines.push(`2018-10-${10 + i % 20}T12:${10 + i % 50} GET /index ` +
+               `Found a needle in "the \\"quoted\\" haystack" line ${i}`);
+  }
+  return lines.join('\n');
+}
+
+function main({ n, pattern, method }) {
+  const text = makeText();
+  const megabytes = Buffer.byteLength(text) / (1024 * 1024);
+  const re = patterns[pattern];
+
+  var matches = 0;
+  bench.start();
+  for (var i = 0; i < n; i++) {
+    switch (method) {
+      case '':
+        // Empty string falls through to next line as default, mostly for
+        // tests.
+      case 'exec':
+        re.lastIndex = 0;
+        while (re.exec(text) !== null)
+          matches++;
+        break;
+      case 'test':
+        re.lastIndex = 0;
+        while (re.test(text))
+          matches++;
+        break;
+      case 'replace':
+        matches += text.replace(re, '_').length > 0 ? 1 : 0;
+        break;
+      default:
+        throw new Error(`Unexpected method "${method}"`);
+    }
+  }
+  bench.end(n * megabytes);
+  assert(matches > 0);
+}
@@ -0,0 +1,146 @@
+#include <v8.h>
+#include <node.h>
+#include <assert.h>
+#include <string>
+
+using v8::ArrayBuffer;
+using v8::Context;
+using v8::FunctionCallbackInfo;
+using v8::FunctionTemplate;
+using v8::HandleScope;
+using v8::Integer;
+using v8::Isolate;
+using v8::Local;
+using v8::NewStringType;
+using v8::Object;
+using v8::Persistent;
+using v8::String;
+using v8::Value;
+using v8::WeakCallbackInfo;
+using v8::WeakCallbackType;
+
+// Every function but Noop() takes the number of iterations as the first
+// argument and runs the operation that many times, so that the cost of the
+// call into the binding is paid only once.
+
+static int Iterations(const FunctionCallbackInfo<Value>& args) {
+  assert(args.Length() >= 1 && args[0]->IsInt32());
+  return args[0].As<Integer>()->Value();
+}
+
+void Noop(const FunctionCallbackInfo<Value>& args) {
+}
+
+void NewFromUtf8(const FunctionCallbackInfo<Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  const int n = Iterations(args);
+  String::Utf8Value value(isolate, args[1]);
+  for (int i = 0; i < n; i++) {
+    HandleScope scope(isolate);
+    String::NewFromUtf8(isolate, *value, NewStringType::kNormal,
+                        value.length()).ToLocalChecked();
+  }
+}
+
+void WriteUtf8(const FunctionCallbackInfo<Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  const int n = Iterations(args);
+  Local<String> str = args[1].As<String>();
+  std::string buffer(str->Utf8Length(isolate) + 1, '\0');
+  for (int i = 0; i < n; i++)
+    str->WriteUtf8(isolate, &buffer[0], static_cast<int>(buffer.size()));
+}
+
+void ObjectGet(const FunctionCallbackInfo<Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  Local<Context> context = isolate->GetCurrentContext();
+  const int n = Iterations(args);
+  Local<Object> obj = args[1].As<Object>();
+  Local<String> key = args[2].As<String>();
+  for (int i = 0; i < n; i++) {
+    HandleScope scope(isolate);
+    obj->Get(context, key).ToLocalChecked();
+  }
+}
+
+void ObjectSet(const FunctionCallbackInfo<Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  Local<Context> context = isolate->GetCurrentContext();
+  const int n = Iterations(args);
+  Local<Object> obj = args[1].As<Object>();
+  Local<String> key = args[2].As<String>();
+  for (int i = 0; i < n; i++) {
+    HandleScope scope(isolate);
+    obj->Set(context, key, Integer::New(isolate, i)).FromJust();
+  }
+}
+
+void HandleScopes(const FunctionCallbackInfo<Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  const int n = Iterations(args);
+  for (int i = 0; i < n; i++) {
+    HandleScope scope(isolate);
+    Integer::New(isolate, i);
+  }
+}
+
+void Persistents(const FunctionCallbackInfo<Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  const int n = Iterations(args);
+  Local<Object> obj = args[1].As<Object>();
+  for (int i = 0; i < n; i++) {
+    Persistent<Object> handle(isolate, obj);
+    handle.Reset();
+  }
+}
+
+static void OnWeak(const WeakCallbackInfo<Persistent<Object>>& info) {
+  Persistent<Object>* handle = info.GetParameter();
+  handle->Reset();
+  delete handle;
+}
+
+// The objects die right away, their callbacks run during the next
+// collections.
+void WeakPersistents(const FunctionCallbackInfo<Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  const int n = Iterations(args);
+  for (int i = 0; i < n; i++) {
+    HandleScope scope(isolate);
+    Persistent<Object>* handle =
+        new Persistent<Object>(isolate, Object::New(isolate));
+    handle->SetWeak(handle, OnWeak, WeakCallbackType::kParameter);
+  }
+}
+
+void ArrayBufferContents(const FunctionCallbackInfo<Value>& args) {
+  const int n = Iterations(args);
+  Local<ArrayBuffer> buffer = args[1].As<ArrayBuffer>();
+  uintptr_t checksum = 0;
+  for (int i = 0; i < n; i++) {
+    ArrayBuffer::Contents contents = buffer->GetContents();
+    checksum += reinterpret_cast<uintptr_t>(contents.Data()) +
+                contents.ByteLength();
+  }
+  args.GetReturnValue().Set(checksum != 0);
+}
+
+void Initialize(Local<Object> target) {
+  Isolate* isolate = target->GetIsolate();
+  Local<Context> context = isolate->GetCurrentContext();
+  Local<FunctionTemplate> noop = FunctionTemplate::New(isolate, Noop);
+  target->Set(context,
+              String::NewFromUtf8(isolate, "noop", NewStringType::kNormal)
+                  .ToLocalChecked(),
+              noop->GetFunction(context).ToLocalChecked()).FromJust();
+  NODE_SET_METHOD(target, "NewFromUtf8", NewFromUtf8);
+  NODE_SET_METHOD(target, "WriteUtf8", WriteUtf8);
+  NODE_SET_METHOD(target, "ObjectGet", ObjectGet);
+  NODE_SET_METHOD(target, "ObjectSet", ObjectSet);
+  NODE_SET_METHOD(target, "HandleScope", HandleScopes);
+  NODE_SET_METHOD(target, "Persistent", Persistents);
+  NODE_SET_METHOD(target, "WeakPersistent", WeakPersistents);
+  NODE_SET_METHOD(target, "ArrayBufferContents", ArrayBufferContents);
+}
+
+NODE_MODULE(NODE_GYP_MODULE_NAME, Initialize)
@@ -0,0 +1,65 @@
+// Measures the parts of the V8 API that node uses the most, to track the
+// cost of the engine shim behind them.
+// Reports n of operations per second. With api=FunctionCallback the
+// operation is a call from JavaScript into an empty C++ function, the other
+// operations are repeated n times in C++ by a single call.
+'use strict';
+
+const assert = require('assert');
+const common = require('../../common.js');
+
+let binding;
+try {
+  binding = require(`./build/${common.buildType}/binding`);
+} catch (e) {
+  console.error(`${__filename}: Binding failed to load`);
+  process.exit(0);
+}
+
+const bench = common.createBenchmark(main, {
+  api: ['FunctionCallback', 'NewFromUtf8', 'WriteUtf8', 'ObjectGet',
+        'ObjectSet', 'HandleScope', 'Persistent', 'WeakPersistent',
+        'ArrayBufferContents'],
+  len: [16, 1024],
+  n: [1e6]
+});
+
+function main({ api, len, n }) {
+  const str = 'x'.repeat(len - 1) + 'é';
+  const obj = { [str]: 42 };
+
+  if (api === 'FunctionCallback') {
+    const fn = binding.noop;
+    bench.start();
+    for (var i = 0; i < n; i++)
+      fn();
+    bench.end(n);
+    return;
+  }
+
+  const fn = binding[api];
+  assert.strictEqual(typeof fn, 'function');
+  let args;
+  switch (api) {
+    case 'NewFromUtf8':
+    case 'WriteUtf8':
+      args = [str];
+      break;
+    case 'ObjectGet':
+    case 'ObjectSet':
+      args = [obj, str];
+      break;
+    case 'Persistent':
+      args = [obj];
+      break;
+    case 'ArrayBufferContents':
+      args = [new ArrayBuffer(len)];
+      break;
+    default:
+      args = [];
+  }
+
+  bench.start();
+  fn(n, ...args);
+  bench.end(n);
+}
@@ -0,0 +1,20 @@
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  n: [100],
+  run: [0, 1]
+});
+
+const vm = require('vm');
+
+function main({ n, run }) {
+  bench.start();
+  for (var i = 0; i < n; i++) {
+    const context = vm.createContext({ i });
+    if (run)
+      vm.runInContext('[i].map((x) => x + 1)', context);
+  }
+  bench.end(n);
+}
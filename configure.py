@@ -187,7 +187,12 @@ parser.add_option('--openssl-system-ca-path',
 parser.add_option('--experimental-http-parser',
     action='store_true',
     dest='experimental_http_parser',
-    help='use llhttp instead of http_parser')
+    help='(no-op) llhttp is the default HTTP parser now')
+
+parser.add_option('--legacy-http-parser',
+    action='store_true',
+    dest='legacy_http_parser',
+    help='use the legacy http_parser instead of llhttp')
 
 shared_optgroup.add_option('--shared-http-parser',
     action='store_true',
@@ -294,6 +299,27 @@ shared_optgroup.add_option('--shared-zlib-libpath',
     dest='shared_zlib_libpath',
     help='a directory to search for the shared zlib DLL')
 
+shared_optgroup.add_option('--shared-brotli',
+    action='store_true',
+    dest='shared_brotli',
+    help='link to a shared brotli DLL, enabling the zlib Brotli streams')
+
+shared_optgroup.add_option('--shared-brotli-includes',
+    action='store',
+    dest='shared_brotli_includes',
+    help='directory containing brotli header files')
+
+shared_optgroup.add_option('--shared-brotli-libname',
+    action='store',
+    dest='shared_brotli_libname',
+    default='brotlidec,brotlienc',
+    help='alternative lib name to link to [default: %default]')
+
+shared_optgroup.add_option('--shared-brotli-libpath',
+    action='store',
+    dest='shared_brotli_libpath',
+    help='a directory to search for the shared brotli DLL')
+
 shared_optgroup.add_option('--shared-cares',
     action='store_true',
     dest='shared_libcares',
@@ -1147,8 +1173,10 @@ def configure_node(o):
   else:
     o['variables']['node_target_type'] = 'executable'
 
+  # There is no shared llhttp, so linking to a shared http_parser means
+  # using the legacy parser.
   o['variables']['node_experimental_http_parser'] = \
-      b(options.experimental_http_parser)
+      b(not options.legacy_http_parser and not options.shared_http_parser)
 
 def configure_library(lib, output):
   shared_lib = 'shared_' + lib
@@ -1645,6 +1673,7 @@ flavor = GetFlavor(flavor_params)
 
 configure_node(output)
 configure_library('zlib', output)
+configure_library('brotli', output)
 configure_library('http_parser', output)
 configure_library('libuv', output)
 configure_library('libcares', output)
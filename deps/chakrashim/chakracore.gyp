@@ -9,6 +9,7 @@
     'linker_start_group%': '',
     'linker_end_group%': '',
     'chakra_libs_absolute%': '',
+    'node_use_dtrace%': 'false',
 
     # xplat (non-win32) only
     'chakra_config': '<(chakracore_build_config)',     # Debug, Release, Test
@@ -31,6 +32,24 @@
       }, {
         'chakra_build_flags': [],
       }],
+
+      # Write perf map / jitdump files when node asks for them, without
+      # taking over SIGUSR2 for the on-demand map
+      ['OS=="linux"', {
+        'chakra_define_flags': [
+          '--extra-defines=PERFMAP_TRACE_ENABLED=1,PERFMAP_SIGNAL=0',
+        ],
+      }, {
+        'chakra_define_flags': [],
+      }],
+
+      # Build the engine's GC, JIT and parser USDT probes whenever node's
+      # own DTrace/SystemTap probes are enabled
+      ['OS=="linux" and node_use_dtrace=="true"', {
+        'chakra_usdt_flags': [ '--usdt' ],
+      }, {
+        'chakra_usdt_flags': [],
+      }],
     ],
   },
 
@@ -128,6 +147,8 @@
                 '<@(chakracore_parallel_build_flags)',
                 '<@(chakracore_lto_build_flags)',
                 '<@(chakra_build_flags)',
+                '<@(chakra_define_flags)',
+                '<@(chakra_usdt_flags)',
                 '<@(icu_args)',
                 '--libs-only'
               ],
@@ -98,19 +98,34 @@
         'src/base/platform/platform.cc',
         'src/base/platform/platform.h',
         'src/pal/pal.cc',
+        'src/jsrtbackgroundwork.cc',
+        'src/jsrtbackgroundwork.h',
+        'src/jsrtbytecodecache.cc',
+        'src/jsrtbytecodecache.h',
         'src/jsrtcachedpropertyidref.inc',
         'src/jsrtcontextcachedobj.inc',
         'src/jsrtcontextshim.cc',
         'src/jsrtcontextshim.h',
+        'src/jsrtcpuprofiler.cc',
+        'src/jsrtcpuprofiler.h',
+        'src/jsrthandlestack.cc',
+        'src/jsrthandlestack.h',
+        'src/jsrtheapprofiler.cc',
+        'src/jsrtheapprofiler.h',
         'src/jsrtinspector.cc',
         'src/jsrtinspector.h',
         'src/jsrtinspectorhelpers.cc',
         'src/jsrtinspectorhelpers.h',
         'src/jsrtisolateshim.cc',
         'src/jsrtisolateshim.h',
+        'src/jsrtprofilecache.cc',
+        'src/jsrtprofilecache.h',
         'src/jsrtpromise.cc',
         'src/jsrtproxyutils.cc',
         'src/jsrtproxyutils.h',
+        'src/jsrtscriptstreaming.cc',
+        'src/jsrtscriptstreaming.h',
+        'src/jsrtserializationtag.h',
         'src/jsrtutils.cc',
         'src/jsrtutils.h',
         'src/v8array.cc',
@@ -120,6 +135,7 @@
         'src/v8chakra.cc',
         'src/v8chakra.h',
         'src/v8context.cc',
+        'src/v8cpuprofiler.cc',
         'src/v8date.cc',
         'src/v8debug.cc',
         'src/v8exception.cc',
@@ -128,6 +144,7 @@
         'src/v8functiontemplate.cc',
         'src/v8global.cc',
         'src/v8handlescope.cc',
+        'src/v8heapprofiler.cc',
         'src/v8int32.cc',
         'src/v8integer.cc',
         'src/v8isolate.cc',
@@ -160,6 +177,7 @@
         'src/v8symbol.cc',
         'src/v8symbolobject.cc',
         'src/v8template.cc',
+        'src/v8tracing.cc',
         'src/v8trycatch.cc',
         'src/v8typedarray.cc',
         'src/v8uint32.cc',
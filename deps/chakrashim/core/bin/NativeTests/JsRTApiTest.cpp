@@ -1921,6 +1921,934 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::ArrayBufferTest);
     }
 
+    void DetachArrayBufferTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef arrayBuffer = JS_INVALID_REFERENCE;
+        JsValueRef typedArray = JS_INVALID_REFERENCE;
+        BYTE *buffer = nullptr;
+        unsigned int bufferLength;
+
+        REQUIRE(JsCreateArrayBuffer(16, &arrayBuffer) == JsNoError);
+        REQUIRE(JsCreateTypedArray(JsArrayTypeUint8, arrayBuffer, /*byteOffset*/4, /*length*/8, &typedArray) == JsNoError);
+
+        REQUIRE(JsDetachArrayBuffer(arrayBuffer) == JsNoError);
+
+        REQUIRE(JsGetArrayBufferStorage(arrayBuffer, &buffer, &bufferLength) == JsNoError);
+        CHECK(buffer == nullptr);
+        CHECK(bufferLength == 0);
+
+        JsValueRef length = JS_INVALID_REFERENCE;
+        JsPropertyIdRef lengthId = JS_INVALID_REFERENCE;
+        int lengthValue = -1;
+        REQUIRE(JsGetPropertyIdFromName(_u("length"), &lengthId) == JsNoError);
+        REQUIRE(JsGetProperty(typedArray, lengthId, &length) == JsNoError);
+        REQUIRE(JsNumberToInt(length, &lengthValue) == JsNoError);
+        CHECK(lengthValue == 0);
+
+        // Already detached, or not an ArrayBuffer at all
+        JsValueRef bad = JS_INVALID_REFERENCE;
+        REQUIRE(JsIntToNumber(5, &bad) == JsNoError);
+        REQUIRE(JsDetachArrayBuffer(arrayBuffer) == JsErrorInvalidArgument);
+        REQUIRE(JsDetachArrayBuffer(typedArray) == JsErrorInvalidArgument);
+        REQUIRE(JsDetachArrayBuffer(bad) == JsErrorInvalidArgument);
+    }
+
+    TEST_CASE("ApiTest_DetachArrayBufferTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::DetachArrayBufferTest);
+    }
+
+    struct CollectEventCounts
+    {
+        int begin;
+        int end;
+        JsCollectKind lastBeginKind;
+        JsCollectKind lastEndKind;
+    };
+
+    void CHAKRA_CALLBACK CollectEventCallback(JsCollectEventType eventType, JsCollectKind collectKind, void *callbackState)
+    {
+        CollectEventCounts *counts = static_cast<CollectEventCounts *>(callbackState);
+        if (eventType == JsCollectEventBegin)
+        {
+            counts->begin++;
+            counts->lastBeginKind = collectKind;
+        }
+        else
+        {
+            counts->end++;
+            counts->lastEndKind = collectKind;
+        }
+    }
+
+    void CollectEventCallbackTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        CollectEventCounts counts = { 0, 0, JsCollectKindFull, JsCollectKindFull };
+
+        REQUIRE(JsSetRuntimeCollectEventCallback(runtime, &counts, CollectEventCallback) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        CHECK(counts.begin >= 1);
+        CHECK(counts.begin == counts.end);
+        CHECK(counts.lastBeginKind == counts.lastEndKind);
+
+        // Removing the callback stops further notifications
+        int seen = counts.begin;
+        REQUIRE(JsSetRuntimeCollectEventCallback(runtime, nullptr, nullptr) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        CHECK(counts.begin == seen);
+        CHECK(counts.end == seen);
+    }
+
+    TEST_CASE("ApiTest_CollectEventCallbackTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::CollectEventCallbackTest);
+    }
+
+    void HeapSpaceStatisticsTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef array = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateArray(1000, &array) == JsNoError);
+
+        JsHeapSpaceStatistics statistics[JsHeapSpaceCount];
+        REQUIRE(JsGetRuntimeHeapSpaceStatistics(runtime, statistics) == JsNoError);
+
+        size_t used = 0;
+        size_t committed = 0;
+        for (int i = 0; i < JsHeapSpaceCount; i++)
+        {
+            CHECK(statistics[i].usedSize <= statistics[i].committedSize);
+            used += statistics[i].usedSize;
+            committed += statistics[i].committedSize;
+        }
+        CHECK(used > 0);
+
+        size_t memoryUsage = 0;
+        REQUIRE(JsGetRuntimeMemoryUsage(runtime, &memoryUsage) == JsNoError);
+        CHECK(committed <= memoryUsage);
+
+        CHECK(JsGetRuntimeHeapSpaceStatistics(runtime, nullptr) == JsErrorNullArgument);
+    }
+
+    TEST_CASE("ApiTest_HeapSpaceStatisticsTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::HeapSpaceStatisticsTest);
+    }
+
+    void ExternalMemoryPressureTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        CollectEventCounts counts = { 0, 0, JsCollectKindFull, JsCollectKindFull };
+        REQUIRE(JsSetRuntimeCollectEventCallback(runtime, &counts, CollectEventCallback) == JsNoError);
+
+        // Host allocations alone are enough to trigger a collection
+        for (int i = 0; i < 64; i++)
+        {
+            REQUIRE(JsAddRuntimeExternalMemoryPressure(runtime, 16 * 1024 * 1024) == JsNoError);
+        }
+        CHECK(counts.begin >= 1);
+
+        REQUIRE(JsAddRuntimeExternalMemoryPressure(runtime, 0) == JsNoError);
+        REQUIRE(JsSetRuntimeCollectEventCallback(runtime, nullptr, nullptr) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_ExternalMemoryPressureTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ExternalMemoryPressureTest);
+    }
+
+    void RedeferInactiveFunctionsTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("function startup() { return 1; } startup();"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        unsigned int functionCount = 1;
+        size_t freedBytes = 1;
+        REQUIRE(JsRedeferRuntimeInactiveFunctions(runtime, &functionCount, &freedBytes) == JsNoError);
+        // Nothing has been inactive long enough yet
+        REQUIRE(JsRedeferRuntimeInactiveFunctions(runtime, &functionCount, &freedBytes) == JsNoError);
+        CHECK((functionCount == 0) == (freedBytes == 0));
+
+        REQUIRE(JsRedeferRuntimeInactiveFunctions(runtime, nullptr, nullptr) == JsNoError);
+
+        // Redeferred functions are parsed again when they are called
+        REQUIRE(JsRunScript(_u("startup();"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        int value = 0;
+        REQUIRE(JsNumberToInt(result, &value) == JsNoError);
+        CHECK(value == 1);
+    }
+
+    TEST_CASE("ApiTest_RedeferInactiveFunctionsTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::RedeferInactiveFunctionsTest);
+    }
+
+    struct JitStatisticsTestState
+    {
+        unsigned int functionCount;
+        unsigned int osrEntryCount;
+    };
+
+    void CHAKRA_CALLBACK JitStatisticsCallback(const JsJitFunctionStatistics *statistics, void *callbackState)
+    {
+        JitStatisticsTestState *state = static_cast<JitStatisticsTestState *>(callbackState);
+        state->functionCount++;
+        if (statistics->name != nullptr && strcmp(statistics->name, "loop") == 0)
+        {
+            CHECK(statistics->loopBodyJitCount <= statistics->osrEntryCount);
+            CHECK(statistics->osrBailOutCount <= statistics->bailOutCount);
+            state->osrEntryCount += statistics->osrEntryCount;
+        }
+    }
+
+    void JitStatisticsTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JitStatisticsTestState state = { 0, 0 };
+        CHECK(JsEnumerateRuntimeJitStatistics(runtime, JitStatisticsCallback, &state, false) == JsErrorInvalidArgument);
+        REQUIRE(JsSetRuntimeJitStatisticsEnabled(runtime, true, nullptr, nullptr) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("function loop() { var sum = 0; for (var i = 0; i < 100000; i++) { sum += i; } return sum; } loop();"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        CHECK(JsEnumerateRuntimeJitStatistics(runtime, nullptr, nullptr, false) == JsErrorNullArgument);
+        REQUIRE(JsEnumerateRuntimeJitStatistics(runtime, JitStatisticsCallback, &state, true) == JsNoError);
+
+        // Without background work, the loop body is compiled while the loop runs and entered right after
+        if ((attributes & JsRuntimeAttributeDisableBackgroundWork) &&
+            !(attributes & JsRuntimeAttributeDisableNativeCodeGeneration))
+        {
+            CHECK(state.osrEntryCount > 0);
+        }
+
+        state.functionCount = 0;
+        REQUIRE(JsEnumerateRuntimeJitStatistics(runtime, JitStatisticsCallback, &state, false) == JsNoError);
+        CHECK(state.functionCount == 0);
+
+        REQUIRE(JsSetRuntimeJitStatisticsEnabled(runtime, false, nullptr, nullptr) == JsNoError);
+        CHECK(JsEnumerateRuntimeJitStatistics(runtime, JitStatisticsCallback, &state, false) == JsErrorInvalidArgument);
+    }
+
+    TEST_CASE("ApiTest_JitStatisticsTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JitStatisticsTest);
+    }
+
+    struct DeoptLogTestState
+    {
+        unsigned int entryCount;
+        unsigned int bailOutCount;
+        double lastTime;
+    };
+
+    void CHAKRA_CALLBACK DeoptLogCallback(const JsJitDeoptLogEntry *entry, void *callbackState)
+    {
+        DeoptLogTestState *state = static_cast<DeoptLogTestState *>(callbackState);
+        state->entryCount++;
+        CHECK(entry->bailOutKind != nullptr);
+        CHECK(entry->time >= state->lastTime);
+        CHECK(entry->function->bailOutCount > 0);
+        state->lastTime = entry->time;
+    }
+
+    void CHAKRA_CALLBACK DeoptLogStatisticsCallback(const JsJitFunctionStatistics *statistics, void *callbackState)
+    {
+        DeoptLogTestState *state = static_cast<DeoptLogTestState *>(callbackState);
+        state->bailOutCount += statistics->bailOutCount;
+
+        unsigned int rejitCount = 0;
+        for (unsigned int i = 0; i < statistics->rejitReasonCount; i++)
+        {
+            CHECK(statistics->rejitReasons[i].reason != nullptr);
+            rejitCount += statistics->rejitReasons[i].count;
+        }
+        CHECK(rejitCount == statistics->rejitCount);
+    }
+
+    void DeoptLogTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        DeoptLogTestState state = { 0, 0, 0 };
+        unsigned int deoptCount = 1;
+        CHECK(JsEnumerateRuntimeDeoptLog(runtime, DeoptLogCallback, &state, false, &deoptCount) == JsErrorInvalidArgument);
+        CHECK(deoptCount == 0);
+        REQUIRE(JsSetRuntimeJitStatisticsEnabled(runtime, true, nullptr, nullptr) == JsNoError);
+
+        // Compiled for numbers, then called with strings
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("function add(a, b) { return a + b; } for (var i = 0; i < 10000; i++) { add(i, 1); } add('a', 'b'); add({}, []);"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        CHECK(JsEnumerateRuntimeDeoptLog(runtime, nullptr, nullptr, false, nullptr) == JsErrorNullArgument);
+        REQUIRE(JsEnumerateRuntimeDeoptLog(runtime, DeoptLogCallback, &state, false, &deoptCount) == JsNoError);
+        REQUIRE(JsEnumerateRuntimeJitStatistics(runtime, DeoptLogStatisticsCallback, &state, false) == JsNoError);
+        CHECK(state.entryCount <= deoptCount);
+        CHECK(state.bailOutCount == deoptCount);
+
+        // Resetting the statistics clears the log too
+        REQUIRE(JsEnumerateRuntimeJitStatistics(runtime, DeoptLogStatisticsCallback, &state, true) == JsNoError);
+        state.entryCount = 0;
+        REQUIRE(JsEnumerateRuntimeDeoptLog(runtime, DeoptLogCallback, &state, true, &deoptCount) == JsNoError);
+        CHECK(state.entryCount == 0);
+        CHECK(deoptCount == 0);
+
+        REQUIRE(JsSetRuntimeJitStatisticsEnabled(runtime, false, nullptr, nullptr) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_DeoptLogTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::DeoptLogTest);
+    }
+
+    struct HeapSnapshotTestState
+    {
+        std::string json;
+        unsigned int chunkCount;
+        unsigned int chunkLimit;
+    };
+
+    bool CHAKRA_CALLBACK HeapSnapshotWriteCallback(const char *chunk, size_t length, void *callbackState)
+    {
+        HeapSnapshotTestState *state = static_cast<HeapSnapshotTestState *>(callbackState);
+        CHECK(length > 0);
+        CHECK(length <= 64 * 1024);
+        state->json.append(chunk, length);
+        return ++state->chunkCount < state->chunkLimit;
+    }
+
+    void HeapSnapshotTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var retained = []; for (var i = 0; i < 100; i++) { retained.push({ value: 'heapSnapshotMarker', index: i }); }"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        HeapSnapshotTestState state = { std::string(), 0, UINT_MAX };
+        REQUIRE(JsTakeRuntimeHeapSnapshot(runtime, HeapSnapshotWriteCallback, &state) == JsNoError);
+        CHECK(state.json.compare(0, 20, "{\"snapshot\":{\"meta\":") == 0);
+        CHECK(state.json.find("\"nodes\":[9,") != std::string::npos);
+        CHECK(state.json.find("\"(GC roots)\"") != std::string::npos);
+        CHECK(state.json.find("\"heapSnapshotMarker\"") != std::string::npos);
+        CHECK(state.json.compare(state.json.size() - 3, 3, "]}\n") == 0);
+
+        // The snapshot can be taken again, and stopped by the callback
+        HeapSnapshotTestState stopped = { std::string(), 0, 1 };
+        REQUIRE(JsTakeRuntimeHeapSnapshot(runtime, HeapSnapshotWriteCallback, &stopped) == JsNoError);
+        CHECK(stopped.chunkCount == 1);
+
+        CHECK(JsTakeRuntimeHeapSnapshot(runtime, nullptr, nullptr) == JsErrorNullArgument);
+    }
+
+    TEST_CASE("ApiTest_HeapSnapshotTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::HeapSnapshotTest);
+    }
+
+    struct AllocationSampleResult
+    {
+        unsigned int sampleCount;
+        unsigned int freeCount;
+        size_t sampledBytes;
+        bool sawAllocate;
+    };
+
+    void CHAKRA_CALLBACK AllocationSampleCallback(unsigned int sampleId, size_t size, const JsSampleFrame *frames, unsigned int frameCount, void *callbackState)
+    {
+        AllocationSampleResult *result = static_cast<AllocationSampleResult *>(callbackState);
+        const char16 allocate[] = _u("allocate");
+
+        result->sampleCount++;
+        result->sampledBytes += size;
+        for (unsigned int i = 0; i < frameCount; i++)
+        {
+            size_t j = 0;
+            while (allocate[j] != 0 && frames[i].functionName[j] == (uint16_t)allocate[j])
+            {
+                j++;
+            }
+            if (allocate[j] == 0 && frames[i].functionName[j] == 0)
+            {
+                result->sawAllocate = true;
+            }
+        }
+    }
+
+    void CHAKRA_CALLBACK AllocationSampleFreeCallback(unsigned int sampleId, void *callbackState)
+    {
+        static_cast<AllocationSampleResult *>(callbackState)->freeCount++;
+    }
+
+    void AllocationSamplingTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        AllocationSampleResult result = { 0, 0, 0, false };
+        JsValueRef value = JS_INVALID_REFERENCE;
+
+        REQUIRE(JsSetRuntimeAllocationSampling(runtime, 1024, &result, AllocationSampleCallback, AllocationSampleFreeCallback) == JsNoError);
+        REQUIRE(JsRunScript(_u("var kept = []; function allocate() { for (var i = 0; i < 10000; i++) { kept.push({ index: i }); } } allocate();"), JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+        CHECK(result.sampleCount > 0);
+        CHECK(result.sampledBytes > 0);
+        CHECK(result.sawAllocate);
+
+        // The sampled objects are reported once they are collected
+        REQUIRE(JsRunScript(_u("kept = null;"), JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        CHECK(result.freeCount > 0);
+        CHECK(result.freeCount <= result.sampleCount);
+
+        // Stopping drops the remaining samples without reporting them
+        unsigned int sampleCount = result.sampleCount;
+        REQUIRE(JsSetRuntimeAllocationSampling(runtime, 0, nullptr, nullptr, nullptr) == JsNoError);
+        REQUIRE(JsRunScript(_u("kept = []; allocate();"), JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+        CHECK(result.sampleCount == sampleCount);
+    }
+
+    TEST_CASE("ApiTest_AllocationSamplingTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::AllocationSamplingTest);
+    }
+
+    struct SampleResult
+    {
+        int sampleCount;
+        bool sawOuter;
+    };
+
+    void CHAKRA_CALLBACK SampleCallback(const JsSampleFrame *frames, unsigned int frameCount, void *callbackState)
+    {
+        SampleResult *result = static_cast<SampleResult *>(callbackState);
+        const char16 outer[] = _u("outer");
+
+        result->sampleCount++;
+        for (unsigned int i = 0; i < frameCount; i++)
+        {
+            size_t j = 0;
+            while (outer[j] != 0 && frames[i].functionName[j] == (uint16_t)outer[j])
+            {
+                j++;
+            }
+            if (outer[j] == 0 && frames[i].functionName[j] == 0)
+            {
+                result->sawOuter = true;
+            }
+        }
+    }
+
+    JsValueRef CALLBACK RequestSampleCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState)
+    {
+        JsRequestRuntimeSample(static_cast<JsRuntimeHandle>(callbackState));
+        return JS_INVALID_REFERENCE;
+    }
+
+    void SampleCallbackTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        SampleResult result = { 0, false };
+        JsValueRef global = JS_INVALID_REFERENCE, function = JS_INVALID_REFERENCE, value = JS_INVALID_REFERENCE;
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+
+        REQUIRE(JsSetRuntimeSampleCallback(runtime, &result, SampleCallback) == JsNoError);
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsCreateFunction(RequestSampleCallback, runtime, &function) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("requestSample"), &propertyId) == JsNoError);
+        REQUIRE(JsSetProperty(global, propertyId, function, true) == JsNoError);
+
+        // The sample is taken at the call to inner, while outer is on the stack
+        REQUIRE(JsRunScript(_u("function inner() { return 1; } function outer() { requestSample(); return inner(); } outer();"), JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+        CHECK(result.sampleCount == 1);
+        CHECK(result.sawOuter);
+
+        // Removing the callback drops further requests
+        REQUIRE(JsSetRuntimeSampleCallback(runtime, nullptr, nullptr) == JsNoError);
+        REQUIRE(JsRunScript(_u("outer();"), JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+        CHECK(result.sampleCount == 1);
+    }
+
+    TEST_CASE("ApiTest_SampleCallbackTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::SampleCallbackTest);
+    }
+
+    void IdleCollectGarbageTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("for (var i = 0; i < 100000; i++) { ({ a: i, b: [i] }); }"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        unsigned int nextIdleTimeInMs = 0;
+        for (int i = 0; i < 100 && nextIdleTimeInMs != UINT_MAX; i++)
+        {
+            REQUIRE(JsIdleCollectGarbage(runtime, 1000, &nextIdleTimeInMs) == JsNoError);
+        }
+        CHECK(nextIdleTimeInMs == UINT_MAX);
+
+        // Once done, further calls only decommit pages
+        CHECK(JsIdleCollectGarbage(runtime, 0, nullptr) == JsNoError);
+        CHECK(JsIdleCollectGarbage(runtime, 1000, &nextIdleTimeInMs) == JsNoError);
+        CHECK(nextIdleTimeInMs == UINT_MAX);
+    }
+
+    TEST_CASE("ApiTest_IdleCollectGarbageTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::IdleCollectGarbageTest);
+    }
+
+    void CHAKRA_CALLBACK CountingFinalizeCallback(void *data)
+    {
+        (*(int *)data)++;
+    }
+
+    void ExternalObjectFinalizeTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        const int objectCount = 10000;
+        int finalizeCount = 0;
+        JsValueRef object = JS_INVALID_REFERENCE;
+        for (int i = 0; i < objectCount; i++)
+        {
+            REQUIRE(JsCreateExternalObject(&finalizeCount, CountingFinalizeCallback, &object) == JsNoError);
+        }
+        object = JS_INVALID_REFERENCE;
+
+        // The callbacks are made when the dead objects are disposed, before the collection returns
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        CHECK(finalizeCount > 0);
+        CHECK(finalizeCount <= objectCount);
+
+        // Idle work disposes in steps bounded by the idle time, and gets through all of it eventually
+        int collectedCount = finalizeCount;
+        for (int i = 0; i < objectCount; i++)
+        {
+            REQUIRE(JsCreateExternalObject(&finalizeCount, CountingFinalizeCallback, &object) == JsNoError);
+        }
+        object = JS_INVALID_REFERENCE;
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("for (var i = 0; i < 100000; i++) { ({ a: i, b: [i] }); }"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        unsigned int nextIdleTimeInMs = 0;
+        for (int i = 0; i < 1000 && nextIdleTimeInMs != UINT_MAX; i++)
+        {
+            REQUIRE(JsIdleCollectGarbage(runtime, 1, &nextIdleTimeInMs) == JsNoError);
+        }
+        CHECK(nextIdleTimeInMs == UINT_MAX);
+        CHECK(finalizeCount > collectedCount);
+        CHECK(finalizeCount <= 2 * objectCount);
+    }
+
+    TEST_CASE("ApiTest_ExternalObjectFinalizeTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ExternalObjectFinalizeTest);
+    }
+
+    void MaxJitThreadCountTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsContextRef current = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&current) == JsNoError);
+
+        // The count can be changed until the first context starts the workers
+        JsRuntimeHandle rt = JS_INVALID_RUNTIME_HANDLE;
+        REQUIRE(JsCreateRuntime(attributes, nullptr, &rt) == JsNoError);
+        CHECK(JsSetRuntimeMaxJitThreadCount(rt, 4) == JsNoError);
+        CHECK(JsSetRuntimeMaxJitThreadCount(rt, 0) == JsNoError);
+        CHECK(JsSetRuntimeMaxJitThreadCount(rt, 4) == JsNoError);
+
+        JsContextRef context = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateContext(rt, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("function f(a) { return a + 1; } var s = 0; for (var i = 0; i < 100000; i++) { s = f(s); } s"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        int value = 0;
+        REQUIRE(JsNumberToInt(result, &value) == JsNoError);
+        CHECK(value == 100000);
+
+        if (!(attributes & JsRuntimeAttributeDisableNativeCodeGeneration))
+        {
+            CHECK(JsSetRuntimeMaxJitThreadCount(rt, 2) == JsErrorRuntimeInUse);
+            CHECK(JsSetRuntimeMaxJitThreadCount(runtime, 2) == JsErrorRuntimeInUse);
+        }
+
+        REQUIRE(JsSetCurrentContext(JS_INVALID_REFERENCE) == JsNoError);
+        REQUIRE(JsDisposeRuntime(rt) == JsNoError);
+        REQUIRE(JsSetCurrentContext(current) == JsNoError);
+        CHECK(JsSetRuntimeMaxJitThreadCount(JS_INVALID_RUNTIME_HANDLE, 2) == JsErrorInvalidArgument);
+    }
+
+    TEST_CASE("ApiTest_MaxJitThreadCountTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::MaxJitThreadCountTest);
+    }
+
+    void DynamicProfileTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        const JsSourceContext sourceContext = 17;
+        LPCWSTR script = _u("function add(a, b) { return a + b; } var s = 0; for (var i = 0; i < 1000; i++) { s = add(s, i); } s");
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(script, sourceContext, _u("profile.js"), &result) == JsNoError);
+
+        JsValueRef profile = JS_INVALID_REFERENCE;
+        REQUIRE(JsSerializeDynamicProfile(sourceContext, &profile) == JsNoError);
+        CHECK(JsSerializeDynamicProfile(sourceContext + 1, &profile) == JsErrorInvalidArgument);
+        REQUIRE(JsSerializeDynamicProfile(sourceContext, &profile) == JsNoError);
+
+        BYTE *buffer = nullptr;
+        unsigned int bufferLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(profile, &buffer, &bufferLength) == JsNoError);
+        CHECK(bufferLength > 0);
+
+        JsValueRef url = JS_INVALID_REFERENCE;
+        REQUIRE(JsPointerToString(_u("profile.js"), wcslen(_u("profile.js")), &url) == JsNoError);
+
+        // The profile must be loaded before the source is seen
+        CHECK(JsLoadDynamicProfile(sourceContext, url, buffer, bufferLength) == JsErrorInvalidArgument);
+
+        JsContextRef current = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&current) == JsNoError);
+        JsContextRef context = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateContext(runtime, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+
+        BYTE corrupted[16] = {};
+        CHECK(JsLoadDynamicProfile(sourceContext, url, corrupted, sizeof(corrupted)) == JsErrorBadSerializedScript);
+        CHECK(JsLoadDynamicProfile(sourceContext, url, buffer, bufferLength - 1) == JsErrorBadSerializedScript);
+        REQUIRE(JsLoadDynamicProfile(sourceContext, url, buffer, bufferLength) == JsNoError);
+
+        REQUIRE(JsRunScript(script, sourceContext, _u("profile.js"), &result) == JsNoError);
+        int value = 0;
+        REQUIRE(JsNumberToInt(result, &value) == JsNoError);
+        CHECK(value == 499500);
+
+        REQUIRE(JsSerializeDynamicProfile(sourceContext, &profile) == JsNoError);
+
+        REQUIRE(JsSetCurrentContext(current) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_DynamicProfileTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::DynamicProfileTest);
+    }
+
+    void CHAKRA_CALLBACK ExternalStringFinalizeCallback(void *callbackState)
+    {
+        (*(int *)callbackState)++;
+    }
+
+    void ExternalStringTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        static const char latin1Content[] = { 'a', (char)0xE9, 'z' };
+        static const uint16_t utf16Content[] = { 0x3B1, 0x3B2, 0x3B3, 0x3B4 };
+        int finalizeCount = 0;
+
+        JsValueRef latin1String = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateExternalStringLatin1(latin1Content, _countof(latin1Content), ExternalStringFinalizeCallback, &finalizeCount, &latin1String) == JsNoError);
+        JsValueRef utf16String = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateExternalStringUtf16(utf16Content, _countof(utf16Content), ExternalStringFinalizeCallback, &finalizeCount, &utf16String) == JsNoError);
+
+        JsValueType type;
+        REQUIRE(JsGetValueType(latin1String, &type) == JsNoError);
+        CHECK(type == JsString);
+
+        int length = 0;
+        REQUIRE(JsGetStringLength(latin1String, &length) == JsNoError);
+        CHECK(length == _countof(latin1Content));
+        REQUIRE(JsGetStringLength(utf16String, &length) == JsNoError);
+        CHECK(length == _countof(utf16Content));
+
+        // Compare against strings that own a copy of the same characters
+        bool result = false;
+        JsValueRef expected = JS_INVALID_REFERENCE;
+        REQUIRE(JsPointerToString(_u("a\u00e9z"), 3, &expected) == JsNoError);
+        REQUIRE(JsStrictEquals(latin1String, expected, &result) == JsNoError);
+        CHECK(result);
+        REQUIRE(JsPointerToString(_u("\u03b1\u03b2\u03b3\u03b4"), 4, &expected) == JsNoError);
+        REQUIRE(JsStrictEquals(utf16String, expected, &result) == JsNoError);
+        CHECK(result);
+
+        // Concatenation copies straight from the external content
+        JsValueRef global = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetPropertyIdFromName(_u("externalLatin1"), &propertyId) == JsNoError);
+        REQUIRE(JsSetProperty(global, propertyId, latin1String, true) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("externalUtf16"), &propertyId) == JsNoError);
+        REQUIRE(JsSetProperty(global, propertyId, utf16String, true) == JsNoError);
+
+        JsValueRef scriptResult = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("(externalLatin1 + externalUtf16) === 'a\\u00e9z\\u03b1\\u03b2\\u03b3\\u03b4' && externalLatin1.charCodeAt(1) === 0xe9"), JS_SOURCE_CONTEXT_NONE, _u(""), &scriptResult) == JsNoError);
+        REQUIRE(JsBooleanToBool(scriptResult, &result) == JsNoError);
+        CHECK(result);
+
+        // The host can read the content back in place
+        const void *content = nullptr;
+        size_t contentLength = 0;
+        bool isOneByte = false;
+        void *callbackState = nullptr;
+        REQUIRE(JsGetExternalStringContent(latin1String, &content, &contentLength, &isOneByte, &callbackState) == JsNoError);
+        CHECK(content == latin1Content);
+        CHECK(contentLength == _countof(latin1Content));
+        CHECK(isOneByte);
+        CHECK(callbackState == &finalizeCount);
+        REQUIRE(JsGetExternalStringContent(utf16String, &content, &contentLength, &isOneByte, &callbackState) == JsNoError);
+        CHECK(content == utf16Content);
+        CHECK(!isOneByte);
+        REQUIRE(JsGetExternalStringContent(expected, &content, &contentLength, &isOneByte, &callbackState) == JsNoError);
+        CHECK(content == nullptr);
+        CHECK(callbackState == nullptr);
+        REQUIRE(JsGetExternalStringContent(global, &content, &contentLength, &isOneByte, &callbackState) == JsErrorInvalidArgument);
+
+        // The host's memory is only used until the strings are collected
+        CHECK(finalizeCount == 0);
+
+        REQUIRE(JsCreateExternalStringLatin1(nullptr, 1, nullptr, nullptr, &latin1String) == JsErrorInvalidArgument);
+        REQUIRE(JsCreateExternalStringLatin1(nullptr, 0, nullptr, nullptr, &latin1String) == JsNoError);
+        REQUIRE(JsGetStringLength(latin1String, &length) == JsNoError);
+        CHECK(length == 0);
+    }
+
+    TEST_CASE("ApiTest_ExternalStringTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ExternalStringTest);
+    }
+
+    void GetSetPropertiesTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef object = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("({ a: 1, get b() { return this.a + 1; }, set c(v) { this.d = v * 2; } })"), JS_SOURCE_CONTEXT_NONE, _u(""), &object) == JsNoError);
+
+        JsPropertyIdRef propertyIds[4] = {};
+        REQUIRE(JsGetPropertyIdFromName(_u("a"), &propertyIds[0]) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("b"), &propertyIds[1]) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("c"), &propertyIds[2]) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("d"), &propertyIds[3]) == JsNoError);
+
+        // Setters run in order, so a later property sees the earlier ones
+        JsValueRef values[4] = {};
+        REQUIRE(JsIntToNumber(10, &values[0]) == JsNoError);
+        REQUIRE(JsIntToNumber(20, &values[1]) == JsNoError);
+        REQUIRE(JsIntToNumber(30, &values[2]) == JsNoError);
+        REQUIRE(JsSetProperties(object, propertyIds, values, 3, false) == JsNoError);
+
+        REQUIRE(JsGetProperties(object, propertyIds, 4, values) == JsNoError);
+        int expected[4] = { 10, 11, 0, 60 };
+        for (int i = 0; i < 4; i++)
+        {
+            if (i == 2)
+            {
+                JsValueRef undefined = JS_INVALID_REFERENCE;
+                REQUIRE(JsGetUndefinedValue(&undefined) == JsNoError);
+                CHECK(values[i] == undefined);
+                continue;
+            }
+            int value = 0;
+            REQUIRE(JsNumberToInt(values[i], &value) == JsNoError);
+            CHECK(value == expected[i]);
+        }
+
+        // Strict mode sets fail on a read-only property
+        REQUIRE(JsSetProperties(object, &propertyIds[1], values, 1, false) == JsNoError);
+        REQUIRE(JsSetProperties(object, &propertyIds[1], values, 1, true) == JsErrorScriptException);
+        JsValueRef exception = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+
+        REQUIRE(JsGetProperties(object, nullptr, 0, nullptr) == JsNoError);
+        REQUIRE(JsGetProperties(object, propertyIds, 1, nullptr) == JsErrorNullArgument);
+        REQUIRE(JsGetProperties(values[0], propertyIds, 1, values) == JsErrorArgumentNotObject);
+        propertyIds[1] = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetProperties(object, propertyIds, 2, values) == JsErrorInvalidArgument);
+        REQUIRE(JsSetProperties(object, propertyIds, values, 2, false) == JsErrorInvalidArgument);
+    }
+
+    TEST_CASE("ApiTest_GetSetPropertiesTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::GetSetPropertiesTest);
+    }
+
+    void PropertyCacheTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef objects = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("function P() {} P.prototype.x = -1; [{ x: 1 }, { x: 2 }, new P(), { y: 0, x: 4 }, {}]"), JS_SOURCE_CONTEXT_NONE, _u(""), &objects) == JsNoError);
+
+        auto getObject = [=](int index)
+        {
+            JsValueRef indexValue = JS_INVALID_REFERENCE;
+            REQUIRE(JsIntToNumber(index, &indexValue) == JsNoError);
+            JsValueRef object = JS_INVALID_REFERENCE;
+            REQUIRE(JsGetIndexedProperty(objects, indexValue, &object) == JsNoError);
+            return object;
+        };
+
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetPropertyIdFromName(_u("x"), &propertyId) == JsNoError);
+        JsPropertyCacheRef cache = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreatePropertyCache(propertyId, &cache) == JsNoError);
+        REQUIRE(JsAddRef(cache, nullptr) == JsNoError);
+
+        // Objects of the same shape, a prototype property, another shape and a missing property,
+        // read twice so that the second pass hits the cache
+        JsValueRef undefined = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetUndefinedValue(&undefined) == JsNoError);
+        int expected[4] = { 1, 2, -1, 4 };
+        JsValueRef value = JS_INVALID_REFERENCE;
+        int intValue = 0;
+        for (int pass = 0; pass < 2; pass++)
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                REQUIRE(JsGetPropertyCached(getObject(i), cache, &value) == JsNoError);
+                REQUIRE(JsNumberToInt(value, &intValue) == JsNoError);
+                CHECK(intValue == expected[i]);
+            }
+            REQUIRE(JsGetPropertyCached(getObject(4), cache, &value) == JsNoError);
+            CHECK(value == undefined);
+            REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        }
+
+        // Objects whose type is already cached see a change to their prototype
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("P.prototype.x = -2"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsGetPropertyCached(getObject(2), cache, &value) == JsNoError);
+        REQUIRE(JsNumberToInt(value, &intValue) == JsNoError);
+        CHECK(intValue == -2);
+
+        // Sets update existing properties and add missing ones to the object itself
+        for (int i = 0; i < 5; i++)
+        {
+            JsValueRef newValue = JS_INVALID_REFERENCE;
+            REQUIRE(JsIntToNumber(10 + i, &newValue) == JsNoError);
+            REQUIRE(JsSetPropertyCached(getObject(i), cache, newValue, true) == JsNoError);
+            REQUIRE(JsGetProperty(getObject(i), propertyId, &value) == JsNoError);
+            REQUIRE(JsNumberToInt(value, &intValue) == JsNoError);
+            CHECK(intValue == 10 + i);
+        }
+        REQUIRE(JsRunScript(_u("P.prototype.x"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == -2);
+
+        // Strict mode sets fail on a frozen object
+        JsValueRef frozen = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("Object.freeze({ x: 1 })"), JS_SOURCE_CONTEXT_NONE, _u(""), &frozen) == JsNoError);
+        REQUIRE(JsSetPropertyCached(frozen, cache, undefined, false) == JsNoError);
+        REQUIRE(JsSetPropertyCached(frozen, cache, undefined, true) == JsErrorScriptException);
+        JsValueRef exception = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+
+        // Another context gets its own inline caches, and those of the first one are found again after
+        JsContextRef firstContext = JS_INVALID_REFERENCE, secondContext = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&firstContext) == JsNoError);
+        REQUIRE(JsCreateContext(runtime, &secondContext) == JsNoError);
+        REQUIRE(JsSetCurrentContext(secondContext) == JsNoError);
+        JsValueRef secondObject = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("({ x: 5 })"), JS_SOURCE_CONTEXT_NONE, _u(""), &secondObject) == JsNoError);
+        for (int pass = 0; pass < 2; pass++)
+        {
+            REQUIRE(JsGetPropertyCached(secondObject, cache, &value) == JsNoError);
+            REQUIRE(JsNumberToInt(value, &intValue) == JsNoError);
+            CHECK(intValue == 5);
+        }
+        REQUIRE(JsSetCurrentContext(firstContext) == JsNoError);
+        REQUIRE(JsGetPropertyCached(getObject(0), cache, &value) == JsNoError);
+        REQUIRE(JsNumberToInt(value, &intValue) == JsNoError);
+        CHECK(intValue == 10);
+
+        JsPropertyCacheRef invalidCache = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreatePropertyCache(JS_INVALID_REFERENCE, &invalidCache) == JsErrorInvalidArgument);
+        REQUIRE(JsGetPropertyCached(frozen, JS_INVALID_REFERENCE, &value) == JsErrorInvalidArgument);
+        REQUIRE(JsGetPropertyCached(undefined, cache, &value) == JsErrorArgumentNotObject);
+        REQUIRE(JsGetPropertyCached(frozen, cache, nullptr) == JsErrorNullArgument);
+        REQUIRE(JsRelease(cache, nullptr) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_PropertyCacheTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::PropertyCacheTest);
+    }
+
+    void OneByteStringTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Long enough to be kept one byte per character
+        static const char content[] = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ-0123456789";
+        const size_t contentLength = _countof(content) - 1;
+
+        JsValueRef string = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString(content, contentLength, &string) == JsNoError);
+
+        char buffer[_countof(content)] = {};
+        size_t written = 0;
+        REQUIRE(JsCopyString(string, nullptr, 0, &written) == JsNoError);
+        CHECK(written == contentLength);
+        REQUIRE(JsCopyString(string, buffer, 10, &written) == JsNoError);
+        CHECK(written == 10);
+        CHECK(memcmp(buffer, content, 10) == 0);
+
+        REQUIRE(JsCopyStringOneByte(string, 10, 26, buffer, &written) == JsNoError);
+        CHECK(written == 26);
+        CHECK(memcmp(buffer, content + 10, 26) == 0);
+        REQUIRE(JsCopyStringOneByte(string, (int)contentLength + 1, 1, buffer, &written) == JsErrorInvalidArgument);
+
+        // Script sees the same characters, before and after the string is widened
+        JsValueRef global = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetPropertyIdFromName(_u("oneByte"), &propertyId) == JsNoError);
+        REQUIRE(JsSetProperty(global, propertyId, string, true) == JsNoError);
+
+        bool result = false;
+        JsValueRef scriptResult = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("oneByte.length === 73 && ('[' + oneByte + ']').indexOf('xyzABC') === 34 && oneByte.charAt(72) === '9'"), JS_SOURCE_CONTEXT_NONE, _u(""), &scriptResult) == JsNoError);
+        REQUIRE(JsBooleanToBool(scriptResult, &result) == JsNoError);
+        CHECK(result);
+
+        REQUIRE(JsCopyString(string, buffer, _countof(buffer), &written) == JsNoError);
+        CHECK(written == contentLength);
+        CHECK(memcmp(buffer, content, contentLength) == 0);
+    }
+
+    TEST_CASE("ApiTest_OneByteStringTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::OneByteStringTest);
+    }
+
+    void StringifyToUtf8Test(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Stringify results are copied out as UTF-8 without flattening them first; check against the flattened text
+        const char16* scripts[] = {
+            _u("JSON.stringify({ a: [1, 'two', null, true], b: { c: 'quote\" back\\\\ tab\\t \\u0001' }, d: '\\u00e9\\u20ac\\ud83d\\ude00' })"),
+            _u("JSON.stringify({ a: [1, { b: 2 }], c: 'x' }, null, 2)"),
+            _u("JSON.stringify({ a: '\\ud800 lone' }, null, '\\t')")
+        };
+
+        for (int i = 0; i < _countof(scripts); i++)
+        {
+            JsValueRef lazyString = JS_INVALID_REFERENCE;
+            REQUIRE(JsRunScript(scripts[i], JS_SOURCE_CONTEXT_NONE, _u(""), &lazyString) == JsNoError);
+            JsValueRef flatString = JS_INVALID_REFERENCE;
+            REQUIRE(JsRunScript(scripts[i], JS_SOURCE_CONTEXT_NONE, _u(""), &flatString) == JsNoError);
+            LPCWSTR flatContent = nullptr;
+            size_t flatLength = 0;
+            REQUIRE(JsStringToPointer(flatString, &flatContent, &flatLength) == JsNoError);
+
+            size_t expectedLength = 0;
+            REQUIRE(JsCopyString(flatString, nullptr, 0, &expectedLength) == JsNoError);
+            size_t length = 0;
+            REQUIRE(JsCopyString(lazyString, nullptr, 0, &length) == JsNoError);
+            CHECK(length == expectedLength);
+
+            char* expected = new char[expectedLength];
+            char* actual = new char[expectedLength];
+            REQUIRE(JsCopyString(flatString, expected, expectedLength, nullptr) == JsNoError);
+            REQUIRE(JsCopyString(lazyString, actual, expectedLength, &length) == JsNoError);
+            CHECK(length == expectedLength);
+            CHECK(memcmp(expected, actual, expectedLength) == 0);
+
+            // A short buffer gets the same truncated copy as a regular string
+            REQUIRE(JsCopyString(lazyString, actual, 5, &length) == JsNoError);
+            CHECK(length == 5);
+            CHECK(memcmp(expected, actual, 5) == 0);
+
+            delete[] expected;
+            delete[] actual;
+        }
+    }
+
+    TEST_CASE("ApiTest_StringifyToUtf8Test", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::StringifyToUtf8Test);
+    }
+
     struct ThreadArgsData
     {
         JsRuntimeHandle runtime;
@@ -62,6 +62,8 @@ PRINT_USAGE() {
     echo "     --sanitize=CHECKS Build with clang -fsanitize checks,"
     echo "                       e.g. undefined,signed-integer-overflow."
     echo " -t, --test-build      Test build. Enables test flags on a release build."
+    echo "     --usdt            Enables USDT probes (perf, bpftrace, SystemTap)"
+    echo "                       Requires sys/sdt.h, e.g. from systemtap-sdt-dev"
     echo "     --target[=S]      Target OS (i.e. android)"
     echo "     --target-path[=S] Output path for compiled binaries. Default: out/"
     echo "     --trace           Enables experimental built-in trace."
@@ -115,6 +117,7 @@ OS_APT_GET=0
 OS_UNIX=0
 LTO=""
 LTTNG=""
+USDT=""
 TARGET_OS=""
 ENABLE_CC_XPLAT_TRACE=""
 WB_CHECK=
@@ -387,6 +390,10 @@ while [[ $# -gt 0 ]]; do
         WB_ARGS=${WB_ARGS// /;}  # replace space with ; to generate a cmake list
         ;;
 
+    --usdt)
+        USDT="-DENABLE_JS_USDT_SH=1"
+        ;;
+
     --valgrind)
         VALGRIND="-DENABLE_VALGRIND_SH=1"
         ;;
@@ -665,7 +672,7 @@ fi
 
 echo Generating $BUILD_TYPE makefiles
 echo $EXTRA_DEFINES
-cmake $CMAKE_GEN $CC_PREFIX $CMAKE_ICU $LTO $LTTNG $STATIC_LIBRARY $ARCH $TARGET_OS \
+cmake $CMAKE_GEN $CC_PREFIX $CMAKE_ICU $LTO $LTTNG $USDT $STATIC_LIBRARY $ARCH $TARGET_OS \
     $ENABLE_CC_XPLAT_TRACE $EXTRA_DEFINES -DCMAKE_BUILD_TYPE=$BUILD_TYPE $SANITIZE $NO_JIT $CMAKE_INTL \
     $WITHOUT_FEATURES $WB_FLAG $WB_ARGS $CMAKE_EXPORT_COMPILE_COMMANDS $LIBS_ONLY_BUILD\
     $VALGRIND $BUILD_RELATIVE_DIRECTORY $CCACHE_NAME
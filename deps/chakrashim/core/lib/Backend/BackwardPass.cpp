@@ -2843,6 +2843,10 @@ BackwardPass::ProcessBlock(BasicBlock * block)
                 instrPrev = instrNext->m_prev;
                 continue;
             }
+            if (this->DeadStoreTempObjectInitFld(instr))
+            {
+                continue;
+            }
             if (instr->m_opcode == Js::OpCode::Conv_Bool)
             {
                 isRemoved = this->FoldCmBool(instr);
@@ -7665,7 +7669,9 @@ BackwardPass::ProcessDef(IR::Opnd * opnd)
     // that depend on the bailout are made later in the function.
 
     // Special case StFld for trackable fields
+    // A temp object literal with no use left never escapes, so its allocation has no visible effect
     bool hasSideEffects = instr->HasAnySideEffects()
+        && !(instr->m_opcode == Js::OpCode::NewScObjectLiteral && instr->dstIsTempObject && !PHASE_OFF(Js::DeadStoreTempObjectPhase, this->func))
         && instr->m_opcode != Js::OpCode::StFld
         && instr->m_opcode != Js::OpCode::StRootFld
         && instr->m_opcode != Js::OpCode::StFldStrict
@@ -8448,6 +8454,93 @@ BackwardPass::ReverseCopyProp(IR::Instr *instr)
     return true;
 }
 
+bool
+BackwardPass::DeadStoreTempObjectInitFld(IR::Instr *instr)
+{
+    // Look for :
+    //
+    //  s1 = NewScObjectLiteral     >> marked temp, so s1 doesn't escape
+    //       InitFld s1.a = s2
+    //       InitFld s1.b = s3      >> s1 !upwardExposed
+    //
+    // The globopt copy props field loads from temp objects, so once no use of s1 is left (including the bailouts,
+    // which need the object materialized) the field initializations are dead. Removing them leaves the allocation
+    // itself dead, which ProcessDef then removes too.
+    if (PHASE_OFF(Js::DeadStoreTempObjectPhase, this->func))
+    {
+        return false;
+    }
+    if (this->tag != Js::DeadStorePhase || this->IsPrePass() || this->IsCollectionPass() || !this->DoDeadStore())
+    {
+        return false;
+    }
+    if (this->func->GetJITFunctionBody()->IsCoroutine())
+    {
+        // UpwardExposedUsed info can't be relied on
+        return false;
+    }
+    if (instr->m_opcode != Js::OpCode::InitFld || instr->HasBailOutInfo() || !instr->GetDst()->IsSymOpnd())
+    {
+        return false;
+    }
+
+    PropertySym * propertySym = instr->GetDst()->AsSymOpnd()->m_sym->AsPropertySym();
+    StackSym * objSym = propertySym->m_stackSym;
+    if (this->currentBlock->upwardExposedUses->Test(objSym->m_id) || !DoDeadStore(this->func, objSym))
+    {
+        return false;
+    }
+
+    // Every for-of loop runs in a try region, so the {value, done} results of an inlined iterator next() are only
+    // removable if we allow this under try. The object must not be live into the catch or finally though.
+    if (this->currentRegion && this->CheckWriteThroughSymInRegion(this->currentRegion, objSym))
+    {
+        return false;
+    }
+
+    // The object must be the temp literal defined in this block. Any other reference to it before the InitFld
+    // could have aliased it, so only other initializations and byte code uses of it may come in between.
+    IR::Instr * scanInstr = instr->m_prev;
+    while (!scanInstr->IsLabelInstr())
+    {
+        if (scanInstr->GetDst() && scanInstr->GetDst()->IsRegOpnd() && scanInstr->GetDst()->AsRegOpnd()->m_sym == objSym)
+        {
+            if (scanInstr->m_opcode != Js::OpCode::NewScObjectLiteral || !scanInstr->dstIsTempObject)
+            {
+                return false;
+            }
+            break;
+        }
+
+        if (!scanInstr->IsByteCodeUsesInstr() && scanInstr->HasSymUse(objSym) &&
+            !(scanInstr->m_opcode == Js::OpCode::InitFld && !scanInstr->HasBailOutInfo() &&
+                scanInstr->GetDst()->IsSymOpnd() && scanInstr->GetDst()->AsSymOpnd()->m_sym->AsPropertySym()->m_stackSym == objSym &&
+                scanInstr->GetSrc1()->GetStackSym() != objSym))
+        {
+            return false;
+        }
+        scanInstr = scanInstr->m_prev;
+    }
+    if (scanInstr->IsLabelInstr())
+    {
+        return false;
+    }
+
+#if DBG_DUMP
+    if (this->IsTraceEnabled())
+    {
+        Output::Print(_u("Dead temp object InitFld: "));
+        instr->Dump();
+    }
+#endif
+
+    if (this->currentBlock->upwardExposedFields)
+    {
+        this->currentBlock->upwardExposedFields->Clear(propertySym->m_id);
+    }
+    return this->DeadStoreInstr(instr);
+}
+
 bool
 BackwardPass::FoldCmBool(IR::Instr *instr)
 {
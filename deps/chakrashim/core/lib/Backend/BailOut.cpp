@@ -2269,6 +2269,13 @@ void BailOutRecord::ScheduleFunctionCodeGen(Js::ScriptFunction * function, Js::S
         reThunk = false;
         rejitReason = RejitReason::AfterLoopBodyRejit;
     }
+
+    Js::JitStatistics * jitStatistics = executeFunction->GetScriptContext()->GetThreadContext()->GetJitStatistics();
+    if (jitStatistics != nullptr)
+    {
+        jitStatistics->RecordBailOut(executeFunction, bailOutKind, rejitReason, Js::LoopHeader::NoLoop);
+    }
+
     if (reThunk)
     {
         Js::FunctionEntryPointInfo *const defaultEntryPointInfo = executeFunction->GetDefaultFunctionEntryPointInfo();
@@ -2614,6 +2621,12 @@ void BailOutRecord::ScheduleLoopBodyCodeGen(Js::ScriptFunction * function, Js::S
     executeFunction->GetScriptContext()->LogBailout(executeFunction, bailOutKind);
 #endif
 
+    Js::JitStatistics * jitStatistics = executeFunction->GetScriptContext()->GetThreadContext()->GetJitStatistics();
+    if (jitStatistics != nullptr)
+    {
+        jitStatistics->RecordBailOut(executeFunction, bailOutKind, rejitReason, executeFunction->GetLoopNumber(loopHeader));
+    }
+
     if (rejitReason != RejitReason::None)
     {
 #ifdef REJIT_STATS
@@ -77,6 +77,16 @@ bool CodeGenWorkItem::ShouldSpeculativelyJitBasedOnProfile() const
 {
     Js::FunctionBody* functionBody = this->GetFunctionBody();
 
+    // A function that was hot enough for full JIT when its profile was saved is likely to get there again, with the
+    // same profile. JIT it now instead of warming it up in the interpreter and the simple JIT first.
+    if(functionBody->GetSourceContextInfo()->sourceDynamicProfileManager != nullptr &&
+        functionBody->HasDynamicProfileInfo() &&
+        functionBody->GetAnyDynamicProfileInfo()->WasFullJitted())
+    {
+        functionBody->SetIsSpeculativeJitCandidate();
+        return true;
+    }
+
     uint loopPercentage = (functionBody->GetByteCodeInLoopCount()*100) / (functionBody->GetByteCodeCount() + 1);
     uint straightLineSize = functionBody->GetByteCodeCount() - functionBody->GetByteCodeInLoopCount();
 
@@ -2161,6 +2161,13 @@ bool Func::DoRecordNativeMap() const
     {
         return true;
     }
+#if PERFMAP_TRACE_ENABLED
+    // The jitdump line info comes from the same maps
+    if (PlatformAgnostic::PerfTrace::IsJitDumpEnabled())
+    {
+        return true;
+    }
+#endif
 #endif
 #if DBG_DUMP
     return PHASE_DUMP(Js::EncoderPhase, this) && Js::Configuration::Global.flags.Verbose;
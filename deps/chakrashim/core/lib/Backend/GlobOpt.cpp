@@ -3687,6 +3687,12 @@ GlobOpt::CopyProp(IR::Opnd *opnd, IR::Instr *instr, Value *val, IR::IndirOpnd *p
         return opnd;
     }
 
+    // The wasm bulk memory ops read their arguments through their own ExtendedArg chain
+    if ((instr->m_opcode == Js::OpCode::CopyWasmMemory || instr->m_opcode == Js::OpCode::FillWasmMemory) && opnd == instr->GetSrc2())
+    {
+        return opnd;
+    }
+
     // Don't copy-prop operand of SIMD instr with ExtendedArg operands. Each instr should have its exclusive EA sequence.
     if (
             Js::IsSimd128Opcode(instr->m_opcode) &&
@@ -169,6 +169,7 @@ class Instr
         isCallInstrProtectedByNoProfileBailout(false),
         hasSideEffects(false),
         isNonFastPathFrameDisplay(false),
+        isStoreToFreshObject(false),
         isSafeToSpeculate(false)
 #if DBG
         , highlight(0)
@@ -531,6 +532,7 @@ class Instr
     bool            isCallInstrProtectedByNoProfileBailout : 1;
     bool            hasSideEffects : 1; // The instruction cannot be dead stored
     bool            isNonFastPathFrameDisplay : 1;
+    bool            isStoreToFreshObject : 1; // The store doesn't need a write barrier, see Lowerer::MarkStoresToFreshObjects
 protected:
     bool            isCloned : 1;
     bool            hasBailOutInfo : 1;
@@ -2529,6 +2529,41 @@ IR::RegOpnd* IRBuilderAsmJs::BuildTrapIfMinIntOverNegOne(IR::RegOpnd* src1Opnd,
     return newSrc;
 }
 
+void IRBuilderAsmJs::BuildWasmBulkMemory(Js::OpCodeAsmJs newOpcode, uint32 offset, Js::RegSlot dstIndexRegSlot, Js::RegSlot srcRegSlot, Js::RegSlot countRegSlot)
+{
+#ifdef ENABLE_WASM
+    Assert(m_func->GetJITFunctionBody()->IsWasmFunction());
+
+    IR::RegOpnd * dstIndexOpnd = BuildSrcOpnd(dstIndexRegSlot, TyInt32);
+    dstIndexOpnd->SetValueType(ValueType::GetInt(false));
+
+    IR::RegOpnd * srcOpnd = BuildSrcOpnd(srcRegSlot, TyInt32);
+    srcOpnd->SetValueType(ValueType::GetInt(false));
+
+    IR::RegOpnd * countOpnd = BuildSrcOpnd(countRegSlot, TyInt32);
+    countOpnd->SetValueType(ValueType::GetInt(false));
+
+    // Given bytecode: op dstIndex, src, count
+    // Generate:
+    // t1 = ExtendedArg_A count
+    // t2 = ExtendedArg_A src, t1
+    // t3 = ExtendedArg_A dstIndex, t2
+    // CopyWasmMemory/FillWasmMemory memory, t3
+    // The lowerer follows the chain to load the arguments of the helper call.
+    IR::Instr * instr = AddExtendedArg(countOpnd, nullptr, offset);
+    instr = AddExtendedArg(srcOpnd, instr->GetDst()->AsRegOpnd(), offset);
+    instr = AddExtendedArg(dstIndexOpnd, instr->GetDst()->AsRegOpnd(), offset);
+
+    Js::OpCode opcode = newOpcode == Js::OpCodeAsmJs::MemoryCopy ? Js::OpCode::CopyWasmMemory : Js::OpCode::FillWasmMemory;
+    IR::Instr * bulkInstr = IR::Instr::New(opcode, m_func);
+    bulkInstr->SetSrc1(BuildSrcOpnd(AsmJsRegSlots::WasmMemoryReg, TyVar));
+    bulkInstr->SetSrc2(instr->GetDst());
+    AddInstr(bulkInstr, offset);
+#else
+    Assert(UNREACHED);
+#endif
+}
+
 IR::Instr* IRBuilderAsmJs::CreateSignExtendInstr(IR::Opnd* dst, IR::Opnd* src, IRType fromType)
 {
     // Since CSE ignores the type of the type, the int const value carries that information to prevent
@@ -2541,6 +2576,13 @@ IR::Instr* IRBuilderAsmJs::CreateSignExtendInstr(IR::Opnd* dst, IR::Opnd* src, I
 void
 IRBuilderAsmJs::BuildInt3(Js::OpCodeAsmJs newOpcode, uint32 offset, Js::RegSlot dstRegSlot, Js::RegSlot src1RegSlot, Js::RegSlot src2RegSlot)
 {
+    if (newOpcode == Js::OpCodeAsmJs::MemoryCopy || newOpcode == Js::OpCodeAsmJs::MemoryFill)
+    {
+        // All three registers are sources
+        BuildWasmBulkMemory(newOpcode, offset, dstRegSlot, src1RegSlot, src2RegSlot);
+        return;
+    }
+
     IR::RegOpnd * src1Opnd = BuildSrcOpnd(src1RegSlot, TyInt32);
     src1Opnd->SetValueType(ValueType::GetInt(false));
 
@@ -217,6 +217,7 @@ class IRBuilderAsmJs
 
     IR::RegOpnd*            BuildTrapIfZero(IR::RegOpnd* srcOpnd, uint32 offset);
     IR::RegOpnd*            BuildTrapIfMinIntOverNegOne(IR::RegOpnd* src1Opnd, IR::RegOpnd* src2Opnd, uint32 offset);
+    void                    BuildWasmBulkMemory(Js::OpCodeAsmJs newOpcode, uint32 offset, Js::RegSlot dstIndexRegSlot, Js::RegSlot srcRegSlot, Js::RegSlot countRegSlot);
 
     IR::Instr*              CreateSignExtendInstr(IR::Opnd* dst, IR::Opnd* src, IRType fromType);
 
@@ -776,7 +776,7 @@ Inline::InlinePolymorphicFunctionUsingFixedMethods(IR::Instr *callInstr, const F
         tmpInlineeJitTimeData = tmpInlineeJitTimeData->GetNext();
     }
 
-    // Inlinee count too small (<2) or too large (>4)
+    // Inlinee count too small (<2) or too large (>maxPolymorphicInliningSize)
     if (inlineeCount < 2 || inlineeCount > Js::DynamicProfileInfo::maxPolymorphicInliningSize)
     {
         POLYMORPHIC_INLINE_TESTTRACE(_u("INLINING (Polymorphic): Skip Inline: Inlinee count either too small or too large: InlineeCount %d (Max: %d)\tInlinee: %s (%s):\tCaller: %s (%s)\n"),
@@ -3509,6 +3509,86 @@ Inline::SetupInlineInstrForCallDirect(Js::BuiltinFunction builtInId, IR::Instr*
         callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperObject_HasOwnProperty, callInstr->m_func));
         break;
 
+    case Js::BuiltinFunction::JavascriptMap_Get:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperMap_Get, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::JavascriptMap_Has:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperMap_Has, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::JavascriptMap_Set:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperMap_Set, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::JavascriptSet_Has:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperSet_Has, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_GetInt8:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_GetInt8, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_GetUint8:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_GetUint8, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_GetInt16:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_GetInt16, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_GetUint16:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_GetUint16, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_GetInt32:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_GetInt32, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_GetUint32:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_GetUint32, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_GetFloat32:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_GetFloat32, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_GetFloat64:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_GetFloat64, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_SetInt8:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_SetInt8, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_SetUint8:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_SetUint8, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_SetInt16:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_SetInt16, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_SetUint16:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_SetUint16, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_SetInt32:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_SetInt32, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_SetUint32:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_SetUint32, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_SetFloat32:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_SetFloat32, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::DataView_SetFloat64:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperDataView_SetFloat64, callInstr->m_func));
+        break;
+
     case Js::BuiltinFunction::JavascriptArray_IsArray:
         callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperArray_IsArray, callInstr->m_func));
         break;
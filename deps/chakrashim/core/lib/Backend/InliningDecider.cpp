@@ -210,7 +210,8 @@ Js::FunctionInfo *InliningDecider::Inline(Js::FunctionBody *const inliner,
     uint16 constantArgInfo, 
     Js::ProfileId callSiteId, 
     uint recursiveInlineDepth, 
-    bool allowRecursiveInlining)
+    bool allowRecursiveInlining,
+    bool isProfiledCallSite)
 {
 #if defined(DBG_DUMP) || defined(ENABLE_DEBUG_CONFIG_OPTIONS)
     char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
@@ -294,7 +295,8 @@ Js::FunctionInfo *InliningDecider::Inline(Js::FunctionBody *const inliner,
             return nullptr;
         }
 
-        if (!DeciderInlineIntoInliner(inlinee, inliner, isConstructorCall, isPolymorphicCall, constantArgInfo, recursiveInlineDepth, allowRecursiveInlining))
+        if (!DeciderInlineIntoInliner(inlinee, inliner, isConstructorCall, isPolymorphicCall, constantArgInfo, recursiveInlineDepth, allowRecursiveInlining,
+                isProfiledCallSite ? callSiteId : Js::Constants::NoProfileId))
         {
             return nullptr;
         }
@@ -491,6 +493,7 @@ bool InliningDecider::GetBuiltInInfoCommon(
     case Js::JavascriptBuiltInFunction::JavascriptArray_Splice:
 
     case Js::JavascriptBuiltInFunction::JavascriptString_Link:
+    case Js::JavascriptBuiltInFunction::JavascriptMap_Get:
         goto CallDirectCommon;
 
     case Js::JavascriptBuiltInFunction::JavascriptArray_Join:
@@ -517,9 +520,40 @@ bool InliningDecider::GetBuiltInInfoCommon(
     case Js::JavascriptBuiltInFunction::JavascriptArray_Includes:
     case Js::JavascriptBuiltInFunction::JavascriptObject_HasOwnProperty:
     case Js::JavascriptBuiltInFunction::JavascriptArray_IsArray:
+    case Js::JavascriptBuiltInFunction::JavascriptMap_Has:
+    case Js::JavascriptBuiltInFunction::JavascriptSet_Has:
         *returnType = ValueType::Boolean;
         goto CallDirectCommon;
 
+    case Js::JavascriptBuiltInFunction::JavascriptMap_Set:
+        *returnType = ValueType::GetObject(ObjectType::Object);
+        goto CallDirectCommon;
+
+    case Js::JavascriptBuiltInFunction::DataView_GetInt8:
+    case Js::JavascriptBuiltInFunction::DataView_GetUint8:
+    case Js::JavascriptBuiltInFunction::DataView_GetInt16:
+    case Js::JavascriptBuiltInFunction::DataView_GetUint16:
+    case Js::JavascriptBuiltInFunction::DataView_GetInt32:
+    case Js::JavascriptBuiltInFunction::DataView_GetUint32:
+        *returnType = ValueType::GetNumberAndLikelyInt(true);
+        goto CallDirectCommon;
+
+    case Js::JavascriptBuiltInFunction::DataView_GetFloat32:
+    case Js::JavascriptBuiltInFunction::DataView_GetFloat64:
+        *returnType = ValueType::Number;
+        goto CallDirectCommon;
+
+    case Js::JavascriptBuiltInFunction::DataView_SetInt8:
+    case Js::JavascriptBuiltInFunction::DataView_SetUint8:
+    case Js::JavascriptBuiltInFunction::DataView_SetInt16:
+    case Js::JavascriptBuiltInFunction::DataView_SetUint16:
+    case Js::JavascriptBuiltInFunction::DataView_SetInt32:
+    case Js::JavascriptBuiltInFunction::DataView_SetUint32:
+    case Js::JavascriptBuiltInFunction::DataView_SetFloat32:
+    case Js::JavascriptBuiltInFunction::DataView_SetFloat64:
+        *returnType = ValueType::Undefined;
+        goto CallDirectCommon;
+
     case Js::JavascriptBuiltInFunction::JavascriptArray_IndexOf:
     case Js::JavascriptBuiltInFunction::JavascriptArray_LastIndexOf:
     case Js::JavascriptBuiltInFunction::JavascriptArray_Unshift:
@@ -693,7 +727,7 @@ bool InliningDecider::CanRecursivelyInline(Js::FunctionBody * inlinee, Js::Funct
 
 // This only enables collection of the inlinee data, we are much more aggressive here.
 // Actual decision of whether something is inlined or not is taken in CommitInlineIntoInliner
-bool InliningDecider::DeciderInlineIntoInliner(Js::FunctionBody * inlinee, Js::FunctionBody * inliner, bool isConstructorCall, bool isPolymorphicCall, uint16 constantArgInfo, uint recursiveInlineDepth, bool allowRecursiveInlining)
+bool InliningDecider::DeciderInlineIntoInliner(Js::FunctionBody * inlinee, Js::FunctionBody * inliner, bool isConstructorCall, bool isPolymorphicCall, uint16 constantArgInfo, uint recursiveInlineDepth, bool allowRecursiveInlining, Js::ProfileId callSiteId)
 {
 
     if (!CanRecursivelyInline(inlinee, inliner, allowRecursiveInlining, recursiveInlineDepth))
@@ -876,6 +910,8 @@ bool InliningDecider::DeciderInlineIntoInliner(Js::FunctionBody * inlinee, Js::F
         inlineThreshold /= CONFIG_FLAG(InlineInLoopBodyScaleDownFactor);
     }
 
+    inlineThreshold = ScaleThresholdForCallSiteFrequency(inliner, callSiteId, inlineThreshold);
+
     if (inlineThreshold > 0 && inlineeByteCodeCount <= (uint)inlineThreshold)
     {
         if (inlinee->GetLoopCount())
@@ -896,6 +932,45 @@ bool InliningDecider::DeciderInlineIntoInliner(Js::FunctionBody * inlinee, Js::F
     }
 }
 
+// Give call sites that run more often than the inliner itself a bigger budget. The frequency is the number of profiled
+// calls at the call site per profiled call of the inliner; every InlineHotCallSiteFrequency of it adds
+// InlineHotCallSiteScale percent to the threshold, up to InlineHotCallSiteMaxScale percent.
+int InliningDecider::ScaleThresholdForCallSiteFrequency(Js::FunctionBody * inliner, Js::ProfileId callSiteId, int inlineThreshold) const
+{
+    if (inlineThreshold <= 0 ||
+        callSiteId == Js::Constants::NoProfileId ||
+        callSiteId >= inliner->GetProfiledCallSiteCount() ||
+        !inliner->HasDynamicProfileInfo() ||
+        CONFIG_FLAG(InlineHotCallSiteFrequency) <= 0 ||
+        CONFIG_FLAG(InlineHotCallSiteMaxScale) <= 100)
+    {
+        return inlineThreshold;
+    }
+
+    const uint callCount = inliner->GetAnyDynamicProfileInfo()->GetCallSiteCallCount(callSiteId);
+    const uint inlinerCallCount = max<uint>(inliner->GetProfiledIterations(), 1);
+    const uint frequency = callCount / inlinerCallCount;
+    const uint hotMultiple = frequency / (uint)CONFIG_FLAG(InlineHotCallSiteFrequency);
+    if (hotMultiple == 0)
+    {
+        return inlineThreshold;
+    }
+
+    const uint maxScale = (uint)CONFIG_FLAG(InlineHotCallSiteMaxScale);
+    const uint scaleStep = (uint)max(CONFIG_FLAG(InlineHotCallSiteScale), 0);
+    const uint scale = (scaleStep == 0 || hotMultiple >= (maxScale - 100) / scaleStep) ? maxScale : 100 + hotMultiple * scaleStep;
+    const int scaledThreshold = (int)(((int64)inlineThreshold * scale) / 100);
+
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+#endif
+    INLINE_TESTTRACE_VERBOSE(_u("INLINING: Hot call site \tcallSiteId: %d\tFrequency: %d\tThreshold: %d -> %d\tCaller: %s (%s)\n"),
+        callSiteId, frequency, inlineThreshold, scaledThreshold,
+        inliner->GetDisplayName(), inliner->GetDebugNumberSet(debugStringBuffer));
+
+    return scaledThreshold;
+}
+
 bool InliningDecider::ContinueInliningUserDefinedFunctions(uint32 bytecodeInlinedCount) const
 {
 #if ENABLE_DEBUG_CONFIG_OPTIONS
@@ -27,7 +27,7 @@ class InliningDecider
     bool InlineIntoTopFunc() const;
     bool InlineIntoInliner(Js::FunctionBody *const inliner) const;
 
-    Js::FunctionInfo *Inline(Js::FunctionBody *const inliner, Js::FunctionInfo* functionInfo, bool isConstructorCall, bool isPolymorphicCall, bool isCallback, uint16 constantArgInfo, Js::ProfileId callSiteId, uint recursiveInlineDepth, bool allowRecursiveInline);
+    Js::FunctionInfo *Inline(Js::FunctionBody *const inliner, Js::FunctionInfo* functionInfo, bool isConstructorCall, bool isPolymorphicCall, bool isCallback, uint16 constantArgInfo, Js::ProfileId callSiteId, uint recursiveInlineDepth, bool allowRecursiveInline, bool isProfiledCallSite = true);
     Js::FunctionInfo *InlineCallSite(Js::FunctionBody *const inliner, const Js::ProfileId profiledCallSiteId, uint recursiveInlineDepth = 0);
     Js::FunctionInfo *GetCallSiteFuncInfo(Js::FunctionBody *const inliner, const Js::ProfileId profiledCallSiteId, bool* isConstructorCall, bool* isPolymorphicCall);
     Js::FunctionInfo * InlineCallback(Js::FunctionBody *const inliner, const Js::ProfileId profiledCallSiteId, uint recursiveInlineDepth);
@@ -38,7 +38,8 @@ class InliningDecider
     bool GetIsLoopBody() const { return isLoopBody;};
     bool ContinueInliningUserDefinedFunctions(uint32 bytecodeInlinedCount) const;
     bool CanRecursivelyInline(Js::FunctionBody * inlinee, Js::FunctionBody * inliner, bool allowRecursiveInlining, uint recursiveInlineDepth);
-    bool DeciderInlineIntoInliner(Js::FunctionBody * inlinee, Js::FunctionBody * inliner, bool isConstructorCall, bool isPolymorphicCall, uint16 constantArgInfo, uint recursiveInlineDepth, bool allowRecursiveInlining);
+    bool DeciderInlineIntoInliner(Js::FunctionBody * inlinee, Js::FunctionBody * inliner, bool isConstructorCall, bool isPolymorphicCall, uint16 constantArgInfo, uint recursiveInlineDepth, bool allowRecursiveInlining, Js::ProfileId callSiteId);
+    int ScaleThresholdForCallSiteFrequency(Js::FunctionBody * inliner, Js::ProfileId callSiteId, int inlineThreshold) const;
 
     void SetAggressiveHeuristics() { this->threshold.SetAggressiveHeuristics(); }
     void ResetInlineHeuristics() { this->threshold.Reset(); }
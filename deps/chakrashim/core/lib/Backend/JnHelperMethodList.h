@@ -88,6 +88,8 @@ HELPERCALLCHK(Op_Rem_Double, Js::NumberUtilities::Modulus, AttrCanNotBeReentrant
 #ifdef ENABLE_WASM
 HELPERCALLCHK(Op_CheckWasmSignature, Js::WebAssembly::CheckSignature, AttrCanThrow | AttrCanNotBeReentrant)
 HELPERCALLCHK(Op_GrowWasmMemory, Js::WebAssemblyMemory::GrowHelper, AttrCanNotBeReentrant)
+HELPERCALLCHK(Op_CopyWasmMemory, Js::WebAssemblyMemory::CopyHelper, AttrCanThrow | AttrCanNotBeReentrant)
+HELPERCALLCHK(Op_FillWasmMemory, Js::WebAssemblyMemory::FillHelper, AttrCanThrow | AttrCanNotBeReentrant)
 #if DBG
 HELPERCALLCHK(Op_WasmMemoryTraceWrite, Js::WebAssemblyMemory::TraceMemWrite, AttrCanNotBeReentrant)
 #endif
@@ -497,6 +499,26 @@ HELPERCALL(String_PadStart, Js::JavascriptString::EntryPadStart, 0)
 HELPERCALL(String_PadEnd, Js::JavascriptString::EntryPadEnd, 0)
 HELPERCALLCHK(GlobalObject_ParseInt, Js::GlobalObject::EntryParseInt, 0)
 HELPERCALLCHK(Object_HasOwnProperty, Js::JavascriptObject::EntryHasOwnProperty, 0)
+HELPERCALLCHK(Map_Get, Js::JavascriptMap::EntryGet, 0)
+HELPERCALLCHK(Map_Has, Js::JavascriptMap::EntryHas, 0)
+HELPERCALLCHK(Map_Set, Js::JavascriptMap::EntrySet, 0)
+HELPERCALLCHK(Set_Has, Js::JavascriptSet::EntryHas, 0)
+HELPERCALLCHK(DataView_GetInt8, Js::DataView::EntryGetInt8, 0)
+HELPERCALLCHK(DataView_GetUint8, Js::DataView::EntryGetUint8, 0)
+HELPERCALLCHK(DataView_GetInt16, Js::DataView::EntryGetInt16, 0)
+HELPERCALLCHK(DataView_GetUint16, Js::DataView::EntryGetUint16, 0)
+HELPERCALLCHK(DataView_GetInt32, Js::DataView::EntryGetInt32, 0)
+HELPERCALLCHK(DataView_GetUint32, Js::DataView::EntryGetUint32, 0)
+HELPERCALLCHK(DataView_GetFloat32, Js::DataView::EntryGetFloat32, 0)
+HELPERCALLCHK(DataView_GetFloat64, Js::DataView::EntryGetFloat64, 0)
+HELPERCALLCHK(DataView_SetInt8, Js::DataView::EntrySetInt8, 0)
+HELPERCALLCHK(DataView_SetUint8, Js::DataView::EntrySetUint8, 0)
+HELPERCALLCHK(DataView_SetInt16, Js::DataView::EntrySetInt16, 0)
+HELPERCALLCHK(DataView_SetUint16, Js::DataView::EntrySetUint16, 0)
+HELPERCALLCHK(DataView_SetInt32, Js::DataView::EntrySetInt32, 0)
+HELPERCALLCHK(DataView_SetUint32, Js::DataView::EntrySetUint32, 0)
+HELPERCALLCHK(DataView_SetFloat32, Js::DataView::EntrySetFloat32, 0)
+HELPERCALLCHK(DataView_SetFloat64, Js::DataView::EntrySetFloat64, 0)
 
 HELPERCALL(RegExp_SplitResultUsed, Js::RegexHelper::RegexSplitResultUsed, 0)
 HELPERCALL(RegExp_SplitResultUsedAndMayBeTemp, Js::RegexHelper::RegexSplitResultUsedAndMayBeTemp, 0)
@@ -4292,7 +4292,15 @@ void LinearScan::AvoidCompensationConflicts(IR::LabelInstr *labelInstr, IR::Bran
 RegNum
 LinearScan::SecondChanceAllocation(Lifetime *lifetime, bool force)
 {
-    if (PHASE_OFF(Js::SecondChancePhase, this->func) || this->func->HasTry())
+    if (PHASE_OFF(Js::SecondChancePhase, this->func))
+    {
+        return RegNOREG;
+    }
+
+    // With optimized try, every lifetime is spilled on entry to a try and at each Leave, and write-through syms are
+    // stored at each def, so nothing reaches a catch or finally in a register. Without second chance, everything
+    // live across a try (every for-of loop) would be reloaded from the stack at each use for the rest of the function.
+    if (this->func->HasTry() && (!this->func->DoOptimizeTry() || PHASE_OFF(Js::SecondChanceInTryPhase, this->func)))
     {
         return RegNOREG;
     }
@@ -101,6 +101,10 @@ Lowerer::Lower()
         Assert(!m_func->HasAnyStackNestedFunc());
     }
 
+#ifdef RECYCLER_WRITE_BARRIER_JIT
+    this->MarkStoresToFreshObjects();
+#endif
+
     this->LowerRange(m_func->m_headInstr, m_func->m_tailInstr, defaultDoFastPath, loopFastPath);
 
 #if DBG && GLOBAL_ENABLE_WRITE_BARRIER
@@ -1774,6 +1778,12 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
         case Js::OpCode::GrowWasmMemory:
             instrPrev = this->LowerGrowWasmMemory(instr);
             break;
+        case Js::OpCode::CopyWasmMemory:
+            instrPrev = this->LowerWasmBulkMemory(instr, IR::HelperOp_CopyWasmMemory);
+            break;
+        case Js::OpCode::FillWasmMemory:
+            instrPrev = this->LowerWasmBulkMemory(instr, IR::HelperOp_FillWasmMemory);
+            break;
 #endif
         case Js::OpCode::Ld_I4:
             LowererMD::ChangeToAssign(instr);
@@ -3521,7 +3531,8 @@ Lowerer::GenerateDynamicObjectAlloc(IR::Instr * newObjInstr, uint inlineSlotCoun
         GenerateMemInit(newObjDst, 0, LoadVTableValueOpnd(newObjInstr, VTableValue::VtableDynamicObject), newObjInstr, isZeroed);
     }
     // MOV [newObjDst + offset(type)], newObjectType
-    GenerateMemInit(newObjDst, Js::DynamicObject::GetOffsetOfType(), typeSrc, newObjInstr, isZeroed);
+    // Nothing can enter the recycler between the allocation and here, so the new object doesn't need a write barrier.
+    InsertMove(IR::IndirOpnd::New(newObjDst, Js::DynamicObject::GetOffsetOfType(), typeSrc->GetType(), m_func), typeSrc, newObjInstr, !DoWriteBarrierElision());
 
     // CALL JavascriptOperators::AllocMemForVarArray((slotCount - inlineSlotCount) * sizeof(Js::Var))
     if (slotCount > inlineSlotCount)
@@ -7096,6 +7107,8 @@ Lowerer::LowerStFld(
     bool withPutFlags,
     Js::PropertyOperationFlags flags)
 {
+    AssertMsg(!stFldInstr->isStoreToFreshObject, "Store to a fresh object without barrier can't call the helper");
+
     if (stFldInstr->IsJitProfilingInstr())
     {
         // If we want to profile then do something completely different
@@ -7232,7 +7245,14 @@ Lowerer::GenerateDirectFieldStore(IR::Instr* instrStFld, IR::PropertySymOpnd* pr
     if (opndSlotArray->IsRegOpnd())
     {
         IR::IndirOpnd * opndDst = IR::IndirOpnd::New(opndSlotArray->AsRegOpnd(), index * sizeof(Js::Var), TyMachReg, func);
-        this->GetLowererMD()->GenerateWriteBarrierAssign(opndDst, instrStFld->GetSrc1(), instrStFld);
+        if (instrStFld->isStoreToFreshObject)
+        {
+            this->InsertMove(opndDst, instrStFld->GetSrc1(), instrStFld, false);
+        }
+        else
+        {
+            this->GetLowererMD()->GenerateWriteBarrierAssign(opndDst, instrStFld->GetSrc1(), instrStFld);
+        }
     }
     else
     {
@@ -7252,9 +7272,175 @@ Lowerer::GenerateDirectFieldStore(IR::Instr* instrStFld, IR::PropertySymOpnd* pr
         opnd = IR::MemRefOpnd::New((char*)opndSlotArray->AsMemRefOpnd()->GetMemLoc() + (index * sizeof(Js::Var)), TyMachReg, func);
     }
 
-    this->InsertMove(opnd, instrStFld->GetSrc1(), instrStFld);
+    this->InsertMove(opnd, instrStFld->GetSrc1(), instrStFld, !instrStFld->isStoreToFreshObject);
+#endif
+}
+
+bool
+Lowerer::DoWriteBarrierElision() const
+{
+#if DBG && GLOBAL_ENABLE_WRITE_BARRIER
+    if (CONFIG_FLAG(ForceSoftwareWriteBarrier) && CONFIG_FLAG(VerifyBarrierBit))
+    {
+        // The verification expects every store of a pointer to set its card
+        return false;
+    }
 #endif
+
+    return !PHASE_OFF(Js::JitWriteBarrierElisionPhase, m_func);
+}
+
+#ifdef RECYCLER_WRITE_BARRIER_JIT
+///----------------------------------------------------------------------------
+///
+/// Lowerer::MarkStoresToFreshObjects
+///
+///     Flag the field stores that go to an object allocated by this function
+///     without the recycler being entered since, so that they can skip the write
+///     barrier. Such an object is only reachable from registers and the stack,
+///     which the concurrent marker doesn't look at: it is either not marked yet,
+///     and will be scanned in full when it is found, or it was allocated after
+///     the mark started and is ignored by the marker. Any instruction that may
+///     call into the runtime (calls, helpers, other allocations, bailouts that
+///     resume in the interpreter) ends the window, so only the call-free fast
+///     paths of field stores are allowed in it.
+///
+///----------------------------------------------------------------------------
+void
+Lowerer::MarkStoresToFreshObjects()
+{
+    if (!this->DoWriteBarrierElision())
+    {
+        return;
+    }
+
+    BVSparse<JitArenaAllocator> freshObjectSyms(this->m_alloc);
+
+    FOREACH_INSTR_IN_FUNC(instr, m_func)
+    {
+        if (IsFreshObjectAlloc(instr))
+        {
+            // The allocation itself may collect, so the objects allocated before it are no longer fresh.
+            freshObjectSyms.ClearAll();
+            freshObjectSyms.Set(instr->GetDst()->AsRegOpnd()->m_sym->m_id);
+            continue;
+        }
+
+        if (freshObjectSyms.IsEmpty() || instr->m_opcode == Js::OpCode::ByteCodeUses)
+        {
+            continue;
+        }
+
+        if (IsCallFreeStFldOnFreshObject(instr, &freshObjectSyms))
+        {
+            instr->isStoreToFreshObject = true;
+            PHASE_PRINT_TRACE(Js::JitWriteBarrierElisionPhase, m_func, _u("Eliding write barrier for store to fresh object s%u, property ID: %d\n"),
+                instr->GetDst()->AsPropertySymOpnd()->GetObjectSym()->m_id, instr->GetDst()->AsPropertySymOpnd()->GetPropertyId());
+            continue;
+        }
+
+        // Labels, branches and anything else we don't know to be call-free end the window.
+        freshObjectSyms.ClearAll();
+    } NEXT_INSTR_IN_FUNC;
+}
+
+bool
+Lowerer::IsFreshObjectAlloc(IR::Instr * instr)
+{
+    if (instr->IsJitProfilingInstr() || !instr->GetDst() || !instr->GetDst()->IsRegOpnd())
+    {
+        return false;
+    }
+
+    switch (instr->m_opcode)
+    {
+    case Js::OpCode::NewScObjectSimple:
+        return true;
+
+    case Js::OpCode::NewScObjectLiteral:
+    {
+        // Leave out literals that need aux slots, since allocating those comes after the object and may collect.
+        const Js::PropertyIdArray * propIds =
+            instr->m_func->GetJITFunctionBody()->ReadPropertyIdArrayFromAuxData(instr->GetSrc1()->AsIntConstOpnd()->AsUint32());
+        return Js::JavascriptOperators::GetLiteralSlotCapacity(propIds) <= Js::JavascriptOperators::GetLiteralInlineSlotCapacity(propIds);
+    }
+
+    default:
+        // NewScObjectNoCtor and friends go through helpers that may hand back an existing object.
+        return false;
+    }
+}
+
+bool
+Lowerer::IsCallFreeStFldOnFreshObject(IR::Instr * instr, const BVSparse<JitArenaAllocator> * freshObjectSyms)
+{
+    switch (instr->m_opcode)
+    {
+    case Js::OpCode::StFld:
+    case Js::OpCode::StFldStrict:
+    case Js::OpCode::InitFld:
+        break;
+
+    default:
+        return false;
+    }
+
+    if (instr->IsJitProfilingInstr() || instr->CallsAccessor() ||
+        !instr->GetDst()->IsSymOpnd() || !instr->GetDst()->AsSymOpnd()->IsPropertySymOpnd())
+    {
+        return false;
+    }
+
+    IR::PropertySymOpnd * propertySymOpnd = instr->GetDst()->AsPropertySymOpnd();
+    if (!freshObjectSyms->Test(propertySymOpnd->GetObjectSym()->m_id) ||
+        propertySymOpnd->GetPropertyId() == Js::PropertyIds::lastIndex)
+    {
+        // lastIndex goes through GenerateFastStFldForCustomProperty first
+        return false;
+    }
+
+    if (instr->HasAuxBailOut() || (instr->HasBailOutInfo() && (instr->GetBailOutKind() & IR::BailOutForDebuggerBits)))
+    {
+        return false;
+    }
+
+    // What follows mirrors the paths of GenerateStFldWithCachedType that don't fall back to the helper.
+    if (!propertySymOpnd->IsTypeCheckSeqCandidate() ||
+        (!propertySymOpnd->IsTypeCheckSeqParticipant() && !propertySymOpnd->NeedsLocalTypeCheck()))
+    {
+        return false;
+    }
+
+    if (propertySymOpnd->IsTypeChecked())
+    {
+        // Adding a property to a prototype invalidates the proto caches through a helper.
+        return !instr->HasBailOutInfo() &&
+            !(propertySymOpnd->HasInitialType() && propertySymOpnd->HasFinalType() &&
+              propertySymOpnd->GetInitialType()->GetTypeHandler()->IsPrototype());
+    }
+
+    if (propertySymOpnd->HasFinalType() && propertySymOpnd->HasInitialType() && !propertySymOpnd->IsTypeDead())
+    {
+        // Hard coded type transition, which must not need to grow the slots.
+        JITTypeHolder initialType = propertySymOpnd->GetInitialType();
+        JITTypeHolder finalType = propertySymOpnd->GetFinalType();
+        int oldCount = 0;
+        int newCount = 0;
+        Js::PropertyIndex inlineSlotCapacity = 0;
+        Js::PropertyIndex newInlineSlotCapacity = 0;
+        return instr->HasBailOutInfo() &&
+            !initialType->GetTypeHandler()->IsPrototype() &&
+            !JITTypeHandler::NeedSlotAdjustment(initialType->GetTypeHandler(), finalType->GetTypeHandler(), &oldCount, &newCount, &inlineSlotCapacity, &newInlineSlotCapacity);
+    }
+
+    // Local type check that bails out on failure, with no equivalent type check helper and no second chance add property.
+    return !propertySymOpnd->HasTypeMismatch() &&
+        instr->HasTypeCheckBailOut() &&
+        !instr->HasEquivalentTypeCheckBailOut() &&
+        !propertySymOpnd->HasEquivalentTypeSet() &&
+        !(propertySymOpnd->IsMono() && propertySymOpnd->HasInitialType());
 }
+#endif
 
 bool
 Lowerer::GenerateStFldWithCachedType(IR::Instr *instrStFld, bool* continueAsHelperOut, IR::LabelInstr** labelHelperOut, IR::RegOpnd** typeOpndOut)
@@ -8205,7 +8391,7 @@ Lowerer::GenerateFieldStoreWithTypeChange(IR::Instr * instrStFld, IR::PropertySy
     // Set the new type.
     IR::RegOpnd *baseOpnd = propertySymOpnd->CreatePropertyOwnerOpnd(instrStFld->m_func);
     IR::Opnd *opnd = IR::IndirOpnd::New(baseOpnd, Js::RecyclableObject::GetOffsetOfType(), TyMachReg, instrStFld->m_func);
-    this->InsertMove(opnd, finalTypeOpnd, instrStFld);
+    this->InsertMove(opnd, finalTypeOpnd, instrStFld, !instrStFld->isStoreToFreshObject);
 
     // Now do the store.
     GenerateDirectFieldStore(instrStFld, propertySymOpnd);
@@ -8533,6 +8719,42 @@ Lowerer::LowerGrowWasmMemory(IR::Instr* instr)
 
     return instrPrev;
 }
+
+IR::Instr *
+Lowerer::LowerWasmBulkMemory(IR::Instr* instr, IR::JnHelperMethod helperMethod)
+{
+    Assert(m_func->GetJITFunctionBody()->IsWasmFunction());
+    IR::Instr * instrPrev = instr->m_prev;
+
+    // src2 is the ExtendArg_A chain built by the IRBuilder: dstIndex, src (or fill value), count
+    IR::Opnd * args[3];
+    IR::Opnd * linkOpnd = instr->UnlinkSrc2();
+    IR::Opnd * nextOpnd = linkOpnd;
+    for (uint i = 0; i < _countof(args); ++i)
+    {
+        Assert(nextOpnd && nextOpnd->GetStackSym()->IsSingleDef());
+        IR::Instr * argInstr = nextOpnd->GetStackSym()->GetInstrDef();
+        Assert(argInstr->m_opcode == Js::OpCode::ExtendArg_A);
+
+        args[i] = argInstr->GetSrc1()->Copy(m_func);
+        if (args[i]->IsRegOpnd())
+        {
+            // The ExtendArg_A may have been hoisted out of a loop, keep its source alive on the back edge
+            this->addToLiveOnBackEdgeSyms->Set(args[i]->AsRegOpnd()->m_sym->m_id);
+        }
+        nextOpnd = argInstr->GetSrc2();
+    }
+    Assert(nextOpnd == nullptr);
+    linkOpnd->Free(m_func);
+
+    m_lowererMD.LoadHelperArgument(instr, args[2]);
+    m_lowererMD.LoadHelperArgument(instr, args[1]);
+    m_lowererMD.LoadHelperArgument(instr, args[0]);
+    m_lowererMD.LoadHelperArgument(instr, instr->UnlinkSrc1());
+    m_lowererMD.ChangeToHelperCall(instr, helperMethod);
+
+    return instrPrev;
+}
 #endif
 
 IR::Instr *
@@ -22168,8 +22390,27 @@ Lowerer::GenerateFastLdFld(IR::Instr * const instrLdFld, IR::JnHelperMethod help
     }
 
     Assert(labelNextBranchToPatch);
-    labelNextBranchToPatch->SetTarget(labelHelper);
-    labelNext->Remove();
+    if (doLocal &&
+        usePolymorphicInlineCache &&
+        propertySymOpnd->m_runtimePolymorphicInlineCache->GetSize() == MaxPolymorphicInlineCacheSize &&
+        !m_func->IsOOPJIT() &&
+        !PHASE_OFF(Js::MegamorphicInlineCachePhase, this->m_func))
+    {
+        // The polymorphic inline cache is as big as it gets. Before calling the helper, look the type and property up in
+        // the script context's megamorphic cache, which the helper fills in for sites like this one.
+        if (doAuxSlots && opndTaggedType == nullptr)
+        {
+            opndTaggedType = IR::RegOpnd::New(TyMachPtr, this->m_func);
+            LowererMD::GenerateLoadTaggedType(instrLdFld, typeOpnd, opndTaggedType);
+        }
+        GenerateLdFldFromMegamorphicInlineCache(
+            instrLdFld, opndBase, opndDst, typeOpnd, opndTaggedType, propertySym->m_propertyId, doInlineSlots, doAuxSlots, labelFallThru, labelHelper);
+    }
+    else
+    {
+        labelNextBranchToPatch->SetTarget(labelHelper);
+        labelNext->Remove();
+    }
 
     // $helper:
     //     dst = CALL Helper(inlineCache, base, field, scriptContext)
@@ -22180,6 +22421,98 @@ Lowerer::GenerateFastLdFld(IR::Instr * const instrLdFld, IR::JnHelperMethod help
     return false;
 }
 
+void
+Lowerer::GenerateLdFldFromMegamorphicInlineCache(
+    IR::Instr * instrLdFld,
+    IR::RegOpnd * opndBase,
+    IR::Opnd * opndDst,
+    IR::RegOpnd * opndType,
+    IR::RegOpnd * opndTaggedType,
+    Js::PropertyId propertyId,
+    bool doInlineSlots,
+    bool doAuxSlots,
+    IR::LabelInstr * labelFallThru,
+    IR::LabelInstr * labelHelper)
+{
+    // Generate:
+    //
+    // s1 = SHR type, PolymorphicInlineCacheShift
+    // s1 = XOR s1, propertyId
+    // s1 = AND s1, MegamorphicInlineCache::Size - 1
+    // s1 = SHL s1, Log2(sizeof(MegamorphicInlineCacheEntry))
+    // s2 = MOV &scriptContext->megamorphicInlineCache
+    // s2 = LEA [s2 + s1]
+    //      CMP [&(s2->propertyId)], propertyId
+    //      JNE $helper
+    //      CMP type, [&(s2->type)]
+    //      JNE $aux
+    //      load inline slot [&(s2->slotIndex)] from base
+    //      JMP $fallthru
+    // $aux:
+    //      CMP taggedType, [&(s2->type)]
+    //      JNE $helper
+    //      load aux slot [&(s2->slotIndex)] from base
+    //      JMP $fallthru
+
+    Func * func = instrLdFld->m_func;
+
+    IntConstType rightShiftAmount = PolymorphicInlineCacheShift;
+    IntConstType leftShiftAmount = Math::Log2(sizeof(Js::MegamorphicInlineCacheEntry));
+    IR::RegOpnd * opndOffset = IR::RegOpnd::New(TyMachPtr, func);
+    InsertShift(Js::OpCode::ShrU_A, false, opndOffset, opndType, IR::IntConstOpnd::New(rightShiftAmount, TyUint8, func, true), instrLdFld);
+    InsertXor(opndOffset, opndOffset, IR::IntConstOpnd::New(propertyId, TyMachPtr, func, true), instrLdFld);
+    InsertAnd(opndOffset, opndOffset, IR::IntConstOpnd::New(Js::MegamorphicInlineCache::Size - 1, TyMachPtr, func, true), instrLdFld);
+    InsertShift(Js::OpCode::Shl_A, false, opndOffset, opndOffset, IR::IntConstOpnd::New(leftShiftAmount, TyUint8, func, true), instrLdFld);
+
+    IR::RegOpnd * opndEntry = IR::RegOpnd::New(TyMachPtr, func);
+    InsertMove(opndEntry, IR::AddrOpnd::New((intptr_t)func->GetScriptContext()->GetMegamorphicInlineCache(), IR::AddrOpndKindDynamicMisc, func, true), instrLdFld);
+    InsertLea(opndEntry, IR::IndirOpnd::New(opndEntry, opndOffset, TyMachPtr, func), instrLdFld);
+
+    InsertCompareBranch(
+        IR::IndirOpnd::New(opndEntry, (int32)offsetof(Js::MegamorphicInlineCacheEntry, propertyId), TyInt32, func),
+        IR::IntConstOpnd::New(propertyId, TyInt32, func, true),
+        Js::OpCode::BrNeq_A,
+        labelHelper,
+        instrLdFld);
+
+    IR::IndirOpnd * opndEntryType = IR::IndirOpnd::New(opndEntry, (int32)offsetof(Js::MegamorphicInlineCacheEntry, type), TyMachReg, func);
+    IR::IndirOpnd * opndEntrySlotIndex = IR::IndirOpnd::New(opndEntry, (int32)offsetof(Js::MegamorphicInlineCacheEntry, slotIndex), TyUint16, func);
+
+    if (doInlineSlots)
+    {
+        IR::LabelInstr * labelAux = doAuxSlots ? IR::LabelInstr::New(Js::OpCode::Label, func) : labelHelper;
+        InsertCompareBranch(opndType, opndEntryType, Js::OpCode::BrNeq_A, labelAux, instrLdFld);
+
+        // dst = MOV [base + slotIndex * Scale]
+        IR::RegOpnd * opndSlotIndex = IR::RegOpnd::New(TyMachReg, func);
+        InsertMove(opndSlotIndex, opndEntrySlotIndex, instrLdFld);
+        InsertMove(opndDst, IR::IndirOpnd::New(opndBase, opndSlotIndex, LowererMD::GetDefaultIndirScale(), TyMachReg, func), instrLdFld);
+        InsertBranch(Js::OpCode::Br, labelFallThru, instrLdFld);
+
+        if (doAuxSlots)
+        {
+            instrLdFld->InsertBefore(labelAux);
+            opndEntryType = opndEntryType->Copy(func)->AsIndirOpnd();
+            opndEntrySlotIndex = opndEntrySlotIndex->Copy(func)->AsIndirOpnd();
+        }
+    }
+
+    if (doAuxSlots)
+    {
+        Assert(opndTaggedType);
+        InsertCompareBranch(opndTaggedType, opndEntryType, Js::OpCode::BrNeq_A, labelHelper, instrLdFld);
+
+        // s3 = MOV base->auxSlots
+        // dst = MOV [s3 + slotIndex * Scale]
+        IR::RegOpnd * opndSlotArray = IR::RegOpnd::New(TyMachReg, func);
+        InsertMove(opndSlotArray, IR::IndirOpnd::New(opndBase, Js::DynamicObject::GetOffsetOfAuxSlots(), TyMachReg, func), instrLdFld);
+        IR::RegOpnd * opndSlotIndex = IR::RegOpnd::New(TyMachReg, func);
+        InsertMove(opndSlotIndex, opndEntrySlotIndex, instrLdFld);
+        InsertMove(opndDst, IR::IndirOpnd::New(opndSlotArray, opndSlotIndex, LowererMD::GetDefaultIndirScale(), TyMachReg, func), instrLdFld);
+        InsertBranch(Js::OpCode::Br, labelFallThru, instrLdFld);
+    }
+}
+
 void
 Lowerer::GenerateAuxSlotAdjustmentRequiredCheck(
     IR::Instr * instrToInsertBefore,
@@ -164,6 +164,12 @@ class Lowerer
     IR::Instr *     GeneratePropertyGuardCheckBailoutAndLoadType(IR::Instr *insertInstr);
     void            GenerateFieldStoreWithTypeChange(IR::Instr * instrStFld, IR::PropertySymOpnd *propertySymOpnd, JITTypeHolder initialType, JITTypeHolder finalType);
     void            GenerateDirectFieldStore(IR::Instr* instrStFld, IR::PropertySymOpnd* propertySymOpnd);
+    bool            DoWriteBarrierElision() const;
+#ifdef RECYCLER_WRITE_BARRIER_JIT
+    void            MarkStoresToFreshObjects();
+    static bool     IsFreshObjectAlloc(IR::Instr * instr);
+    static bool     IsCallFreeStFldOnFreshObject(IR::Instr * instr, const BVSparse<JitArenaAllocator> * freshObjectSyms);
+#endif
     void            GenerateAdjustSlots(IR::Instr * instrStFld, IR::PropertySymOpnd *propertySymOpnd, JITTypeHolder initialType, JITTypeHolder finalType);
     bool            GenerateAdjustBaseSlots(IR::Instr * instrStFld, IR::RegOpnd *baseOpnd, JITTypeHolder initialType, JITTypeHolder finalType);
     void            PinTypeRef(JITTypeHolder type, void* typeRef, IR::Instr* instr, Js::PropertyId propertyId);
@@ -262,6 +268,7 @@ class Lowerer
     IR::Instr *     LowerCheckWasmSignature(IR::Instr * instr);
     IR::Instr *     LowerLdWasmFunc(IR::Instr* instr);
     IR::Instr *     LowerGrowWasmMemory(IR::Instr* instr);
+    IR::Instr *     LowerWasmBulkMemory(IR::Instr* instr, IR::JnHelperMethod helperMethod);
 #endif
     IR::Instr *     LowerInitCachedScope(IR::Instr * instr);
     IR::Instr *     LowerBrBReturn(IR::Instr * instr, IR::JnHelperMethod helperMethod, bool isHelper);
@@ -713,6 +720,8 @@ class Lowerer
     static IR::BranchInstr * GenerateProtoInlineCacheCheck(IR::Instr * instrLdSt, IR::RegOpnd * opndType, IR::RegOpnd * opndInlineCache, IR::LabelInstr * labelNext);
     static void GenerateLdFldFromLocalInlineCache(IR::Instr * instrLdFld, IR::RegOpnd * opndBase, IR::Opnd * opndDst, IR::RegOpnd * opndInlineCache, IR::LabelInstr * labelFallThru, bool isInlineSlot);
     static void GenerateLdFldFromProtoInlineCache(IR::Instr * instrLdFld, IR::RegOpnd * opndBase, IR::Opnd * opndDst, IR::RegOpnd * opndInlineCache, IR::LabelInstr * labelFallThru, bool isInlineSlot);
+    static void GenerateLdFldFromMegamorphicInlineCache(IR::Instr * instrLdFld, IR::RegOpnd * opndBase, IR::Opnd * opndDst, IR::RegOpnd * opndType, IR::RegOpnd * opndTaggedType, Js::PropertyId propertyId,
+                                                        bool doInlineSlots, bool doAuxSlots, IR::LabelInstr * labelFallThru, IR::LabelInstr * labelHelper);
 
     IR::Instr *         LoadScriptContext(IR::Instr *instr);
     IR::Instr *         LoadFunctionBody(IR::Instr * instr);
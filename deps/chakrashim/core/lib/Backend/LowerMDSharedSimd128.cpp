@@ -988,6 +988,14 @@ IR::Instr* LowererMD::Simd128LowerMulI4(IR::Instr *instr)
     Assert(src1->IsRegOpnd() && src1->IsSimd128());
     Assert(src2->IsRegOpnd() && src2->IsSimd128());
 
+    if (AutoSystemInfo::Data.SSE4_1Available())
+    {
+        // dst = PMULLD src1, src2
+        instr->m_opcode = Js::OpCode::PMULLD;
+        Legalize(instr);
+        return instr->m_prev;
+    }
+
     temp1 = IR::RegOpnd::New(src1->GetType(), m_func);
     temp2 = IR::RegOpnd::New(src1->GetType(), m_func);
     temp3 = IR::RegOpnd::New(src1->GetType(), m_func);
@@ -674,6 +674,13 @@ void NativeCodeGenerator::GenerateLoopBody(Js::FunctionBody * fn, Js::LoopHeader
         return;
     }
 
+    if (fn->GetScriptContext()->GetThreadContext()->GetJitStatistics() != nullptr)
+    {
+        Js::LoopEntryPointInfo* loopEntryPointInfo = static_cast<Js::LoopEntryPointInfo*>(entryPoint);
+        loopEntryPointInfo->jitScheduledTime = Js::JitStatistics::Now();
+        loopEntryPointInfo->jitDoneTime = 0;
+    }
+
     entryPoint->SetCodeGenPending(workitem);
 
     try
@@ -1306,6 +1313,9 @@ void NativeCodeGenerator::LogCodeGenStart(CodeGenWorkItem * workItem, LARGE_INTE
         }
     }
 
+    CHAKRA_USDT(FUNCTION_JIT_START, body->GetFunctionNumber(), body->GetDisplayName(), body->GetDisplayNameLength(),
+        workItem->GetEntryPoint()->IsLoopBody(), (int)workItem->GetJitMode());
+
 #if DBG_DUMP
     if (Js::Configuration::Global.flags.TestTrace.IsEnabled(Js::BackEndPhase))
     {
@@ -1424,6 +1434,9 @@ void NativeCodeGenerator::LogCodeGenDone(CodeGenWorkItem * workItem, LARGE_INTEG
         }
     }
 
+    CHAKRA_USDT(FUNCTION_JIT_STOP, body->GetFunctionNumber(), body->GetDisplayName(), body->GetDisplayNameLength(),
+        workItem->GetEntryPoint()->IsLoopBody(), workItem->GetEntryPoint()->GetCodeSize());
+
 #if DBG_DUMP
     if (Js::Configuration::Global.flags.TestTrace.IsEnabled(Js::BackEndPhase))
     {
@@ -2124,6 +2137,13 @@ NativeCodeGenerator::JobProcessed(JsUtil::Job *const job, const bool succeeded)
 
             uint loopNum = loopBodyCodeGen->GetJITData()->loopNumber;
             functionBody->SetLoopBodyEntryPoint(loopBodyCodeGen->loopHeader, entryPoint, (Js::JavascriptMethod)loopBodyCodeGen->GetCodeAddress(), loopNum);
+
+            // The script thread reads this once it sees the code gen done
+            Js::LoopEntryPointInfo * loopEntryPointInfo = static_cast<Js::LoopEntryPointInfo *>(entryPoint);
+            if (loopEntryPointInfo->jitScheduledTime != 0)
+            {
+                loopEntryPointInfo->jitDoneTime = Js::JitStatistics::Now();
+            }
             entryPoint->SetCodeGenDone();
         }
         else
@@ -3006,7 +3026,7 @@ NativeCodeGenerator::GatherCodeGenData(
                     continue;
                 }
 
-                const auto inlinee = inliningDecider.Inline(functionBody, inlineeFunctionInfo, false /*isConstructorCall*/, false /*isPolymorphicCall*/, false /*isCallback*/, 0, (uint16)inlineCacheIndex, 0, false);
+                const auto inlinee = inliningDecider.Inline(functionBody, inlineeFunctionInfo, false /*isConstructorCall*/, false /*isPolymorphicCall*/, false /*isCallback*/, 0, (uint16)inlineCacheIndex, 0, false, false /*isProfiledCallSite*/);
                 if(!inlinee)
                 {
                     continue;
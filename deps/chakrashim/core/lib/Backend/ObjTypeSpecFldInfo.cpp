@@ -884,7 +884,7 @@ ObjTypeSpecFldInfo* ObjTypeSpecFldInfo::CreateFrom(uint id, Js::PolymorphicInlin
     }
 
 #if ENABLE_FIXED_FIELDS
-    gatherDataForInlining = gatherDataForInlining && (typeCount <= 4); // Only support 4-way (max) polymorphic inlining
+    gatherDataForInlining = gatherDataForInlining && (typeCount <= Js::DynamicProfileInfo::maxPolymorphicInliningSize); // Only support up to maxPolymorphicInliningSize-way polymorphic inlining
 #else
     gatherDataForInlining = false;
 #endif
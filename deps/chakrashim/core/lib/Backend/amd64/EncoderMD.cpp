@@ -714,7 +714,7 @@ EncoderMD::Encode(IR::Instr *instr, BYTE *pc, BYTE* beginCodeAddress)
     else if (opdope & D66)
     {
         Assert((opdope & (D66 | DF2 | DF3)) == D66);
-        Assert(leadIn == OLB_0F || leadIn == OLB_0F3A);
+        Assert(leadIn == OLB_0F || leadIn == OLB_0F3A || leadIn == OLB_0F38);
         *instrRestart++ = 0x66;
     }
     else if (opdope & DF2)
@@ -752,6 +752,10 @@ EncoderMD::Encode(IR::Instr *instr, BYTE *pc, BYTE* beginCodeAddress)
         *instrRestart++ = 0x0f;
         *instrRestart++ = 0x3a;
         break;
+    case OLB_0F38:
+        *instrRestart++ = 0x0f;
+        *instrRestart++ = 0x38;
+        break;
     default:
         Assert(UNREACHED);
         __assume(UNREACHED);
@@ -163,6 +163,7 @@ MACRO(PMAXUB       , Reg2   , None         , RNON , f(MODRM)   , o(PMAXUB)    ,
 MACRO(PMINSW       , Reg2   , None         , RNON , f(MODRM)   , o(PMINSW)    , DNO16|DOPEQ|D66|DCOMMOP     , OLB_0F   , LEGAL_R_R_RM   )
 MACRO(PMINUB       , Reg2   , None         , RNON , f(MODRM)   , o(PMINUB)    , DNO16|DOPEQ|D66|DCOMMOP     , OLB_0F   , LEGAL_R_R_RM   )
 MACRO(PMOVMSKB     , Reg2   , None         , RNON , f(SPECIAL) , o(PMOVMSKB)  , DDST|DNO16|D66              , OLB_0F   , LEGAL_R_R      )
+MACRO(PMULLD       , Reg2   , None         , RNON , f(MODRM)   , o(PMULLD)    , DNO16|DOPEQ|D66|DCOMMOP     , OLB_0F38 , LEGAL_R_R_RM   )
 MACRO(PMULLW       , Reg2   , None         , RNON , f(MODRM)   , o(PMULLW)    , DNO16|DOPEQ|D66|DCOMMOP     , OLB_0F   , LEGAL_R_R_RM   )
 MACRO(PMULUDQ      , Reg2   , None         , RNON , f(MODRM)   , o(PMULUDQ)   , DNO16|DOPEQ|D66|DCOMMOP     , OLB_0F   , LEGAL_R_R_RM   )
 MACRO(POP          , Reg1   , OpSideEffect , R000 , f(PSHPOP)  , o(POP)       , DDST                        , OLB_NONE , LEGAL_R_OR     )
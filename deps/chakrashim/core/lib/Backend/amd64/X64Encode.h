@@ -96,7 +96,7 @@
 #define OLB_NONE 0x0    // opcode is one byte: no lead-in bytes
 #define OLB_0F   0x1    // opcode is 0F xx or VEX.mmmmm = 00001
 //#define OLB_0F01 0x2    // opcode is 0F 01 xx (no VEX encoding)
-//#define OLB_0F38 0x3    // opcode is 0F 38 xx or VEX.mmmmm = 00010
+#define OLB_0F38 0x3    // opcode is 0F 38 xx or VEX.mmmmm = 00010
 #define OLB_0F3A 0x4    // opcode is 0F 3A xx or VEX.mmmmm = 00011
 //#define OLB_XOP8 0x8    // XOP prefix with mmmmm = 01000
 //#define OLB_XOP9 0x9    // XOP prefix with mmmmm = 01001
@@ -286,6 +286,7 @@ enum Forms : BYTE
 #define OPBYTE_PMINSW   {0xea}                  // modrm
 #define OPBYTE_PMINUB   {0xda}                  // modrm
 #define OPBYTE_PMOVMSKB {0xd7}                  // modrm
+#define OPBYTE_PMULLD   {0x40}                  // modrm
 #define OPBYTE_PMULLW   {0xd5}                  // modrm
 #define OPBYTE_PMULUDQ  {0xf4}                  // modrm
 #define OPBYTE_PMULLW   {0xd5}                  // modrm
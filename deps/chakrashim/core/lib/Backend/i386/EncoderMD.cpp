@@ -701,6 +701,10 @@ EncoderMD::Encode(IR::Instr *instr, BYTE *pc, BYTE* beginCodeAddress)
             *instrRestart++ = 0x3a;
             break;
 
+        case OLB_0F38:
+            *instrRestart++ = 0x38;
+            break;
+
         default:
             Assert(UNREACHED);
             __assume(UNREACHED);
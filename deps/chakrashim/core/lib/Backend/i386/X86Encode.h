@@ -122,6 +122,7 @@ enum Forms : BYTE
 // LeadIn
 #define OLB_NONE 0x1
 #define OLB_0F3A 0x2
+#define OLB_0F38 0x3
 
 // OpBytes
 #define OPBYTE_ADD      {0x4, 0x80, 0x0}        // binop, byte2=0x0
@@ -267,6 +268,7 @@ enum Forms : BYTE
 #define OPBYTE_PMINSW   {0xea}                  // modrm
 #define OPBYTE_PMINUB   {0xda}                  // modrm
 #define OPBYTE_PMOVMSKB {0xd7}                  // modrm
+#define OPBYTE_PMULLD   {0x40}                  // modrm
 #define OPBYTE_PMULLW   {0xd5}                  // modrm
 #define OPBYTE_PMULUDQ  {0xf4}                  // modrm
 #define OPBYTE_PMULLW   {0xd5}                  // modrm
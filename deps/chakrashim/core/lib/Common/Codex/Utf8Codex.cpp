@@ -4,6 +4,12 @@
 //-------------------------------------------------------------------------------------------------------
 #include "Utf8Codex.h"
 
+#if defined(_M_IX86) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
 #ifndef _WIN32
 #undef _Analysis_assume_
 #define _Analysis_assume_(expr)
@@ -39,6 +45,84 @@ namespace utf8
         return (reinterpret_cast<size_t>(pb) & mAlignmentMask) == 0 && (reinterpret_cast<size_t>(pch) & mAlignmentMask) == 0;
     }
 
+    // Widens whole blocks of sixteen ASCII bytes at the start of [p, pbEnd) into dest, and returns the number of bytes
+    // widened. The rest of the run is left to the caller. Returns 0 where no vector unit is available.
+    inline size_t WidenAsciiRun(char16 *dest, LPCUTF8 p, LPCUTF8 pbEnd)
+    {
+        size_t count = 0;
+#if defined(_M_IX86) || defined(_M_X64)
+        const __m128i zero = _mm_setzero_si128();
+        while (p + count + 16 <= pbEnd)
+        {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + count));
+            if (_mm_movemask_epi8(bytes) != 0)
+            {
+                break;
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + count), _mm_unpacklo_epi8(bytes, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + count + 8), _mm_unpackhi_epi8(bytes, zero));
+            count += 16;
+        }
+#elif defined(_M_ARM64)
+        while (p + count + 16 <= pbEnd)
+        {
+            uint8x16_t bytes = vld1q_u8(p + count);
+            if (vmaxvq_u8(bytes) >= 0x80)
+            {
+                break;
+            }
+            vst1q_u16(reinterpret_cast<uint16_t*>(dest + count), vmovl_u8(vget_low_u8(bytes)));
+            vst1q_u16(reinterpret_cast<uint16_t*>(dest + count + 8), vmovl_high_u8(bytes));
+            count += 16;
+        }
+#endif
+        return count;
+    }
+
+    // Narrows whole blocks of sixteen ASCII chars at the start of [source, source + cch) into dest (unless only
+    // counting), and returns the number of chars narrowed. Stops rather than write past bufferEnd. Returns 0 where no
+    // vector unit is available.
+    template <bool countBytesOnly>
+    inline charcount_t NarrowAsciiRun(utf8char_t *dest, const utf8char_t *bufferEnd, const char16 *source, charcount_t cch)
+    {
+        charcount_t count = 0;
+#if defined(_M_IX86) || defined(_M_X64)
+        const __m128i nonAscii = _mm_set1_epi16((short)0xFF80);
+        const __m128i zero = _mm_setzero_si128();
+        while (count + 16 <= cch && (countBytesOnly || dest + count + 16 <= bufferEnd))
+        {
+            __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + count));
+            __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + count + 8));
+            __m128i high = _mm_and_si128(_mm_or_si128(first, second), nonAscii);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xFFFF)
+            {
+                break;
+            }
+            if (!countBytesOnly)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + count), _mm_packus_epi16(first, second));
+            }
+            count += 16;
+        }
+#elif defined(_M_ARM64)
+        while (count + 16 <= cch && (countBytesOnly || dest + count + 16 <= bufferEnd))
+        {
+            uint16x8_t first = vld1q_u16(reinterpret_cast<const uint16_t*>(source + count));
+            uint16x8_t second = vld1q_u16(reinterpret_cast<const uint16_t*>(source + count + 8));
+            if (vmaxvq_u16(vorrq_u16(first, second)) >= 0x80)
+            {
+                break;
+            }
+            if (!countBytesOnly)
+            {
+                vst1q_u8(dest + count, vcombine_u8(vmovn_u16(first), vmovn_u16(second)));
+            }
+            count += 16;
+        }
+#endif
+        return count;
+    }
+
     inline size_t EncodedBytes(char16 prefix)
     {
          CodexAssert(0 == (prefix & 0xFF00)); // prefix must really be a byte. We use char16 for as a convenience for the API.
@@ -367,9 +451,15 @@ namespace utf8
         LPCUTF8 p = pbUtf8;
         char16 *dest = buffer;
 
+LFastPath:
+        {
+            size_t asciiCount = WidenAsciiRun(dest, p, pbEnd);
+            p += asciiCount;
+            dest += asciiCount;
+        }
+
         if (!ShouldFastPath(p, dest)) goto LSlowPath;
 
-LFastPath:
         while (p + 3 < pbEnd)
         {
             unsigned bytes = *(unsigned *)p;
@@ -397,7 +487,8 @@ namespace utf8
                 break;
             }
 
-            if (ShouldFastPath(p, dest)) goto LFastPath;
+            // Go back to the fast path at the start of the next ASCII run
+            if (ShouldFastPath(p, dest) || (p < pbEnd && *p < 0x80)) goto LFastPath;
         }
 
         pbUtf8 = p;
@@ -446,9 +537,16 @@ namespace utf8
 
         CodexAssertOrFailFast(dest <= bufferEnd);
 
+LFastPath:
+        {
+            charcount_t asciiCount = NarrowAsciiRun<countBytesOnly>(dest, bufferEnd, source, cch);
+            dest += asciiCount;
+            source += asciiCount;
+            cch -= asciiCount;
+        }
+
         if (!ShouldFastPath(dest, source)) goto LSlowPath;
 
-LFastPath:
         while (cch >= 4)
         {
             uint32 first = ((const uint32 *)source)[0];
@@ -472,7 +570,7 @@ namespace utf8
             while (cch-- > 0)
             {
                 dest = Encode<countBytesOnly>(*source++, dest, bufferEnd);
-                if (ShouldFastPath(dest, source)) goto LFastPath;
+                if (ShouldFastPath(dest, source) || (cch > 0 && *source < 0x80)) goto LFastPath;
             }
         }
         else
@@ -484,7 +582,7 @@ namespace utf8
                 // EncodeTrueUtf8 will consume the low surrogate code unit too by decrementing cch
                 // and incrementing source
                 dest = EncodeTrueUtf8<countBytesOnly>(*source++, &source, &cch, dest, bufferEnd);
-                if (ShouldFastPath(dest, source)) goto LFastPath;
+                if (ShouldFastPath(dest, source) || (cch > 0 && *source < 0x80)) goto LFastPath;
             }
         }
 
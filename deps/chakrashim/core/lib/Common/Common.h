@@ -65,6 +65,7 @@ template<> struct IntMath<int64> { using Type = Int64Math; };
 #include "Common/DateUtilities.h"
 #include "Common/NumberUtilitiesBase.h"
 #include "Common/NumberUtilities.h"
+#include "Common/CharSearch.h"
 #include <Codex/Utf8Codex.h>
 
 #include "Core/DelayLoadLibrary.h"
@@ -102,6 +103,7 @@ template<> struct IntMath<int64> { using Type = Int64Math; };
 // Data Structures 2
 
 #include "DataStructures/QuickSort.h"
+#include "DataStructures/MergeSort.h"
 #include "DataStructures/StringBuilder.h"
 #include "DataStructures/WeakReferenceDictionary.h"
 #include "DataStructures/LeafValueDictionary.h"
@@ -0,0 +1,83 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
+// Searches char16 strings eight characters at a time, with SSE2 on x86 and x64 and NEON on ARM64. The caller
+// says which characters it looks for by combining the block operations below, and SkipBlocks skips the blocks
+// that have none of them. Whatever is left (the block with the match, and a tail shorter than a block) is up to
+// the caller to look at one character at a time. On other targets SkipBlocks skips nothing.
+class CharSearch
+{
+public:
+    static const charcount_t BlockLength = 8;
+
+#if defined(_M_IX86) || defined(_M_X64)
+    typedef __m128i Block;
+
+    static Block Load(const char16* chars) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars)); }
+    static Block Splat(const char16 c) { return _mm_set1_epi16((short)c); }
+    static Block Equal(const Block a, const Block b) { return _mm_cmpeq_epi16(a, b); }
+    // Saturating subtract leaves 0 exactly where a <= b
+    static Block LessOrEqual(const Block a, const Block b) { return _mm_cmpeq_epi16(_mm_subs_epu16(a, b), _mm_setzero_si128()); }
+    static Block Or(const Block a, const Block b) { return _mm_or_si128(a, b); }
+    static Block And(const Block a, const Block b) { return _mm_and_si128(a, b); }
+#elif defined(_M_ARM64)
+    typedef uint16x8_t Block;
+
+    static Block Load(const char16* chars) { return vld1q_u16(reinterpret_cast<const uint16_t*>(chars)); }
+    static Block Splat(const char16 c) { return vdupq_n_u16(c); }
+    static Block Equal(const Block a, const Block b) { return vceqq_u16(a, b); }
+    static Block LessOrEqual(const Block a, const Block b) { return vcleq_u16(a, b); }
+    static Block Or(const Block a, const Block b) { return vorrq_u16(a, b); }
+    static Block And(const Block a, const Block b) { return vandq_u16(a, b); }
+#else
+    // Never looked at; only here so that the callers' matchers compile.
+    struct Block {};
+
+    static Block Load(const char16*) { return Block(); }
+    static Block Splat(const char16) { return Block(); }
+    static Block Equal(const Block a, const Block) { return a; }
+    static Block LessOrEqual(const Block a, const Block) { return a; }
+    static Block Or(const Block a, const Block) { return a; }
+    static Block And(const Block a, const Block) { return a; }
+#endif
+
+    // Skips the blocks of input from offset on that have no match, where matches(input + i) returns the block
+    // starting at i with all the bits of the matching characters set. Every character before the returned offset
+    // fails to match. Unless fewer than BlockLength characters are left before length, one of the BlockLength
+    // characters starting at the returned offset matches; on x86 and x64 it is the one at the returned offset.
+    template <typename Matches>
+    static charcount_t SkipBlocks(const char16* const input, charcount_t offset, const charcount_t length, Matches matches)
+    {
+#if defined(_M_IX86) || defined(_M_X64)
+        while (offset + BlockLength <= length)
+        {
+            DWORD mask = (DWORD)_mm_movemask_epi8(matches(input + offset));
+            if (mask != 0)
+            {
+                // Two mask bits per character
+                DWORD bit;
+                _BitScanForward(&bit, mask);
+                return offset + bit / 2;
+            }
+            offset += BlockLength;
+        }
+#elif defined(_M_ARM64)
+        while (offset + BlockLength <= length && vmaxvq_u16(matches(input + offset)) == 0)
+        {
+            offset += BlockLength;
+        }
+#else
+        Unused(input);
+        Unused(length);
+        Unused(matches);
+#endif
+        return offset;
+    }
+};
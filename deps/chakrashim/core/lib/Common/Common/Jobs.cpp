@@ -502,7 +502,7 @@ namespace JsUtil
     {
     }
 
-    void BackgroundJobProcessor::InitializeThreadCount()
+    void BackgroundJobProcessor::InitializeThreadCount(unsigned int requestedThreadCount)
     {
         if (CONFIG_FLAG(ForceMaxJitThreadCount))
         {
@@ -513,6 +513,13 @@ namespace JsUtil
             // In a low-memory scenario, don't spin up multiple threads, regardless of how many cores we have.
             this->maxThreadCount = 1;
         }
+        else if (requestedThreadCount != 0)
+        {
+            // The host asked for a specific number of workers. Leave the main thread a core of its own, but
+            // otherwise trust the host to know how many cores are idle.
+            int processorCount = AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
+            this->maxThreadCount = max(1, min(processorCount - 1, (int)requestedThreadCount));
+        }
         else
         {
             int processorCount = AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
@@ -522,11 +529,11 @@ namespace JsUtil
         }
     }
 
-    void BackgroundJobProcessor::InitializeParallelThreadData(AllocationPolicyManager* policyManager, bool disableParallelThreads)
+    void BackgroundJobProcessor::InitializeParallelThreadData(AllocationPolicyManager* policyManager, bool disableParallelThreads, unsigned int requestedThreadCount)
     {
         if (!disableParallelThreads)
         {
-            InitializeThreadCount();
+            InitializeThreadCount(requestedThreadCount);
         }
         else
         {
@@ -632,7 +639,7 @@ namespace JsUtil
         return;
     }
 
-    BackgroundJobProcessor::BackgroundJobProcessor(AllocationPolicyManager* policyManager, JsUtil::ThreadService *threadService, bool disableParallelThreads)
+    BackgroundJobProcessor::BackgroundJobProcessor(AllocationPolicyManager* policyManager, JsUtil::ThreadService *threadService, bool disableParallelThreads, unsigned int requestedThreadCount)
         : JobProcessor(true),
         jobReady(true),
         wakeAllBackgroundThreads(false),
@@ -648,7 +655,7 @@ namespace JsUtil
         if (!threadService->HasCallback())
         {
             // We don't have a thread service, so create a dedicated thread to handle background jobs.
-            InitializeParallelThreadData(policyManager, disableParallelThreads);
+            InitializeParallelThreadData(policyManager, disableParallelThreads, requestedThreadCount);
         }
         else
         {
@@ -713,7 +720,9 @@ namespace JsUtil
         {
             if (threadData->CanDecommit())
             {
-                // If its 1sec time out decommit and wait for INFINITE
+                // If its 1sec time out decommit and wait for INFINITE. The arena pages cached for the
+                // next job are given back first, so that they are decommitted too.
+                threadData->backgroundPageAllocator.FlushArenaPageCache();
                 threadData->backgroundPageAllocator.DecommitNow();
                 this->ForEachManager([&](JobManager *manager){
                     manager->OnDecommit(threadData);
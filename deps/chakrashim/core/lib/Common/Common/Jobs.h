@@ -469,7 +469,7 @@ namespace JsUtil
 #endif
 
     public:
-        BackgroundJobProcessor(AllocationPolicyManager* policyManager, ThreadService *threadService, bool disableParallelThreads);
+        BackgroundJobProcessor(AllocationPolicyManager* policyManager, ThreadService *threadService, bool disableParallelThreads, unsigned int requestedThreadCount = 0);
         ~BackgroundJobProcessor();
 
 #if PDATA_ENABLED && defined(_WIN32)
@@ -489,8 +489,8 @@ namespace JsUtil
         Job* GetCurrentJobOfManager(JobManager *const manager);
         ParallelThreadData * GetThreadDataFromCurrentJob(Job* job);
 
-        void InitializeThreadCount();
-        void InitializeParallelThreadData(AllocationPolicyManager* policyManager, bool disableParallelThreads);
+        void InitializeThreadCount(unsigned int requestedThreadCount);
+        void InitializeParallelThreadData(AllocationPolicyManager* policyManager, bool disableParallelThreads, unsigned int requestedThreadCount);
         void InitializeParallelThreadDataForThreadServiceCallBack(AllocationPolicyManager* policyManager);
 
 #if PDATA_ENABLED && defined(_WIN32)
@@ -889,6 +889,475 @@ static double AdjustDbl(double dbl, const EncodedChar *prgch, int32 cch, int32 l
 }
 
 
+// A floating point value with a 64 bit significand: f * 2^e. Unlike a double
+// there is no hidden bit.
+struct DiyFp
+{
+    uint64 f;
+    int e;
+};
+
+static const int kcbitDiyFp = 64;
+
+static inline DiyFp DiyFpSub(const DiyFp &x, const DiyFp &y)
+{
+    Assert(x.e == y.e && x.f >= y.f);
+    DiyFp res = { x.f - y.f, x.e };
+    return res;
+}
+
+// The upper 64 bits of the product, rounded.
+static inline DiyFp DiyFpMul(const DiyFp &x, const DiyFp &y)
+{
+    const uint64 luMask32 = 0xFFFFFFFF;
+    uint64 a = x.f >> 32;
+    uint64 b = x.f & luMask32;
+    uint64 c = y.f >> 32;
+    uint64 d = y.f & luMask32;
+    uint64 ac = a * c;
+    uint64 bc = b * c;
+    uint64 ad = a * d;
+    uint64 bd = b * d;
+    uint64 tmp = (bd >> 32) + (ad & luMask32) + (bc & luMask32);
+    tmp += 1U << 31;
+
+    DiyFp res = { ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), x.e + y.e + kcbitDiyFp };
+    return res;
+}
+
+static inline DiyFp DiyFpNormalize(DiyFp x)
+{
+    Assert(x.f != 0);
+    while (0 == (x.f & 0xFFC0000000000000ULL))
+    {
+        x.f <<= 10;
+        x.e -= 10;
+    }
+    while (0 == (x.f & 0x8000000000000000ULL))
+    {
+        x.f <<= 1;
+        x.e--;
+    }
+    return x;
+}
+
+// The full 128 bit product of x and y.
+static inline uint64 MulLu64(uint64 x, uint64 y, uint64 *pluLo)
+{
+    const uint64 luMask32 = 0xFFFFFFFF;
+    uint64 a = x >> 32;
+    uint64 b = x & luMask32;
+    uint64 c = y >> 32;
+    uint64 d = y & luMask32;
+    uint64 ac = a * c;
+    uint64 bc = b * c;
+    uint64 ad = a * d;
+    uint64 bd = b * d;
+    uint64 mid = (bd >> 32) + (ad & luMask32) + (bc & luMask32);
+
+    *pluLo = (mid << 32) | (bd & luMask32);
+    return ac + (ad >> 32) + (bc >> 32) + (mid >> 32);
+}
+
+/***************************************************************************
+Decimal to double for a mantissa of up to 19 digits, with the algorithm from
+Daniel Lemire, "Number Parsing at a Gigabyte per Second", 2021 (after Michael
+Eisel). The mantissa is multiplied by a 64 bit approximation of the power of
+ten; this gives the bits of the double unless they are too close to the middle
+of two doubles, in which case this fails and StrToDbl does the precise
+conversion. Results that would be denormal or infinite also fail.
+***************************************************************************/
+
+// Normalized powers of ten 10^k for k = -326 to 308, truncated to 64 bits. 10^0 to
+// 10^27 are exact.
+static const int kwMinFastExp10 = -326;
+static const int kwMaxFastExp10 = 308;
+static const int kwMaxExactPow10 = 27;
+
+static const DiyFp g_rgPowersOfTen[] =
+{
+    { 0x84A57695FE98746DULL, -1146 }, { 0xA5CED43B7E3E9188ULL, -1143 },
+    { 0xCF42894A5DCE35EAULL, -1140 }, { 0x818995CE7AA0E1B2ULL, -1136 },
+    { 0xA1EBFB4219491A1FULL, -1133 }, { 0xCA66FA129F9B60A6ULL, -1130 },
+    { 0xFD00B897478238D0ULL, -1127 }, { 0x9E20735E8CB16382ULL, -1123 },
+    { 0xC5A890362FDDBC62ULL, -1120 }, { 0xF712B443BBD52B7BULL, -1117 },
+    { 0x9A6BB0AA55653B2DULL, -1113 }, { 0xC1069CD4EABE89F8ULL, -1110 },
+    { 0xF148440A256E2C76ULL, -1107 }, { 0x96CD2A865764DBCAULL, -1103 },
+    { 0xBC807527ED3E12BCULL, -1100 }, { 0xEBA09271E88D976BULL, -1097 },
+    { 0x93445B8731587EA3ULL, -1093 }, { 0xB8157268FDAE9E4CULL, -1090 },
+    { 0xE61ACF033D1A45DFULL, -1087 }, { 0x8FD0C16206306BABULL, -1083 },
+    { 0xB3C4F1BA87BC8696ULL, -1080 }, { 0xE0B62E2929ABA83CULL, -1077 },
+    { 0x8C71DCD9BA0B4925ULL, -1073 }, { 0xAF8E5410288E1B6FULL, -1070 },
+    { 0xDB71E91432B1A24AULL, -1067 }, { 0x892731AC9FAF056EULL, -1063 },
+    { 0xAB70FE17C79AC6CAULL, -1060 }, { 0xD64D3D9DB981787DULL, -1057 },
+    { 0x85F0468293F0EB4EULL, -1053 }, { 0xA76C582338ED2621ULL, -1050 },
+    { 0xD1476E2C07286FAAULL, -1047 }, { 0x82CCA4DB847945CAULL, -1043 },
+    { 0xA37FCE126597973CULL, -1040 }, { 0xCC5FC196FEFD7D0CULL, -1037 },
+    { 0xFF77B1FCBEBCDC4FULL, -1034 }, { 0x9FAACF3DF73609B1ULL, -1030 },
+    { 0xC795830D75038C1DULL, -1027 }, { 0xF97AE3D0D2446F25ULL, -1024 },
+    { 0x9BECCE62836AC577ULL, -1020 }, { 0xC2E801FB244576D5ULL, -1017 },
+    { 0xF3A20279ED56D48AULL, -1014 }, { 0x9845418C345644D6ULL, -1010 },
+    { 0xBE5691EF416BD60CULL, -1007 }, { 0xEDEC366B11C6CB8FULL, -1004 },
+    { 0x94B3A202EB1C3F39ULL, -1000 }, { 0xB9E08A83A5E34F07ULL,  -997 },
+    { 0xE858AD248F5C22C9ULL,  -994 }, { 0x91376C36D99995BEULL,  -990 },
+    { 0xB58547448FFFFB2DULL,  -987 }, { 0xE2E69915B3FFF9F9ULL,  -984 },
+    { 0x8DD01FAD907FFC3BULL,  -980 }, { 0xB1442798F49FFB4AULL,  -977 },
+    { 0xDD95317F31C7FA1DULL,  -974 }, { 0x8A7D3EEF7F1CFC52ULL,  -970 },
+    { 0xAD1C8EAB5EE43B66ULL,  -967 }, { 0xD863B256369D4A40ULL,  -964 },
+    { 0x873E4F75E2224E68ULL,  -960 }, { 0xA90DE3535AAAE202ULL,  -957 },
+    { 0xD3515C2831559A83ULL,  -954 }, { 0x8412D9991ED58091ULL,  -950 },
+    { 0xA5178FFF668AE0B6ULL,  -947 }, { 0xCE5D73FF402D98E3ULL,  -944 },
+    { 0x80FA687F881C7F8EULL,  -940 }, { 0xA139029F6A239F72ULL,  -937 },
+    { 0xC987434744AC874EULL,  -934 }, { 0xFBE9141915D7A922ULL,  -931 },
+    { 0x9D71AC8FADA6C9B5ULL,  -927 }, { 0xC4CE17B399107C22ULL,  -924 },
+    { 0xF6019DA07F549B2BULL,  -921 }, { 0x99C102844F94E0FBULL,  -917 },
+    { 0xC0314325637A1939ULL,  -914 }, { 0xF03D93EEBC589F88ULL,  -911 },
+    { 0x96267C7535B763B5ULL,  -907 }, { 0xBBB01B9283253CA2ULL,  -904 },
+    { 0xEA9C227723EE8BCBULL,  -901 }, { 0x92A1958A7675175FULL,  -897 },
+    { 0xB749FAED14125D36ULL,  -894 }, { 0xE51C79A85916F484ULL,  -891 },
+    { 0x8F31CC0937AE58D2ULL,  -887 }, { 0xB2FE3F0B8599EF07ULL,  -884 },
+    { 0xDFBDCECE67006AC9ULL,  -881 }, { 0x8BD6A141006042BDULL,  -877 },
+    { 0xAECC49914078536DULL,  -874 }, { 0xDA7F5BF590966848ULL,  -871 },
+    { 0x888F99797A5E012DULL,  -867 }, { 0xAAB37FD7D8F58178ULL,  -864 },
+    { 0xD5605FCDCF32E1D6ULL,  -861 }, { 0x855C3BE0A17FCD26ULL,  -857 },
+    { 0xA6B34AD8C9DFC06FULL,  -854 }, { 0xD0601D8EFC57B08BULL,  -851 },
+    { 0x823C12795DB6CE57ULL,  -847 }, { 0xA2CB1717B52481EDULL,  -844 },
+    { 0xCB7DDCDDA26DA268ULL,  -841 }, { 0xFE5D54150B090B02ULL,  -838 },
+    { 0x9EFA548D26E5A6E1ULL,  -834 }, { 0xC6B8E9B0709F109AULL,  -831 },
+    { 0xF867241C8CC6D4C0ULL,  -828 }, { 0x9B407691D7FC44F8ULL,  -824 },
+    { 0xC21094364DFB5636ULL,  -821 }, { 0xF294B943E17A2BC4ULL,  -818 },
+    { 0x979CF3CA6CEC5B5AULL,  -814 }, { 0xBD8430BD08277231ULL,  -811 },
+    { 0xECE53CEC4A314EBDULL,  -808 }, { 0x940F4613AE5ED136ULL,  -804 },
+    { 0xB913179899F68584ULL,  -801 }, { 0xE757DD7EC07426E5ULL,  -798 },
+    { 0x9096EA6F3848984FULL,  -794 }, { 0xB4BCA50B065ABE63ULL,  -791 },
+    { 0xE1EBCE4DC7F16DFBULL,  -788 }, { 0x8D3360F09CF6E4BDULL,  -784 },
+    { 0xB080392CC4349DECULL,  -781 }, { 0xDCA04777F541C567ULL,  -778 },
+    { 0x89E42CAAF9491B60ULL,  -774 }, { 0xAC5D37D5B79B6239ULL,  -771 },
+    { 0xD77485CB25823AC7ULL,  -768 }, { 0x86A8D39EF77164BCULL,  -764 },
+    { 0xA8530886B54DBDEBULL,  -761 }, { 0xD267CAA862A12D66ULL,  -758 },
+    { 0x8380DEA93DA4BC60ULL,  -754 }, { 0xA46116538D0DEB78ULL,  -751 },
+    { 0xCD795BE870516656ULL,  -748 }, { 0x806BD9714632DFF6ULL,  -744 },
+    { 0xA086CFCD97BF97F3ULL,  -741 }, { 0xC8A883C0FDAF7DF0ULL,  -738 },
+    { 0xFAD2A4B13D1B5D6CULL,  -735 }, { 0x9CC3A6EEC6311A63ULL,  -731 },
+    { 0xC3F490AA77BD60FCULL,  -728 }, { 0xF4F1B4D515ACB93BULL,  -725 },
+    { 0x991711052D8BF3C5ULL,  -721 }, { 0xBF5CD54678EEF0B6ULL,  -718 },
+    { 0xEF340A98172AACE4ULL,  -715 }, { 0x9580869F0E7AAC0EULL,  -711 },
+    { 0xBAE0A846D2195712ULL,  -708 }, { 0xE998D258869FACD7ULL,  -705 },
+    { 0x91FF83775423CC06ULL,  -701 }, { 0xB67F6455292CBF08ULL,  -698 },
+    { 0xE41F3D6A7377EECAULL,  -695 }, { 0x8E938662882AF53EULL,  -691 },
+    { 0xB23867FB2A35B28DULL,  -688 }, { 0xDEC681F9F4C31F31ULL,  -685 },
+    { 0x8B3C113C38F9F37EULL,  -681 }, { 0xAE0B158B4738705EULL,  -678 },
+    { 0xD98DDAEE19068C76ULL,  -675 }, { 0x87F8A8D4CFA417C9ULL,  -671 },
+    { 0xA9F6D30A038D1DBCULL,  -668 }, { 0xD47487CC8470652BULL,  -665 },
+    { 0x84C8D4DFD2C63F3BULL,  -661 }, { 0xA5FB0A17C777CF09ULL,  -658 },
+    { 0xCF79CC9DB955C2CCULL,  -655 }, { 0x81AC1FE293D599BFULL,  -651 },
+    { 0xA21727DB38CB002FULL,  -648 }, { 0xCA9CF1D206FDC03BULL,  -645 },
+    { 0xFD442E4688BD304AULL,  -642 }, { 0x9E4A9CEC15763E2EULL,  -638 },
+    { 0xC5DD44271AD3CDBAULL,  -635 }, { 0xF7549530E188C128ULL,  -632 },
+    { 0x9A94DD3E8CF578B9ULL,  -628 }, { 0xC13A148E3032D6E7ULL,  -625 },
+    { 0xF18899B1BC3F8CA1ULL,  -622 }, { 0x96F5600F15A7B7E5ULL,  -618 },
+    { 0xBCB2B812DB11A5DEULL,  -615 }, { 0xEBDF661791D60F56ULL,  -612 },
+    { 0x936B9FCEBB25C995ULL,  -608 }, { 0xB84687C269EF3BFBULL,  -605 },
+    { 0xE65829B3046B0AFAULL,  -602 }, { 0x8FF71A0FE2C2E6DCULL,  -598 },
+    { 0xB3F4E093DB73A093ULL,  -595 }, { 0xE0F218B8D25088B8ULL,  -592 },
+    { 0x8C974F7383725573ULL,  -588 }, { 0xAFBD2350644EEACFULL,  -585 },
+    { 0xDBAC6C247D62A583ULL,  -582 }, { 0x894BC396CE5DA772ULL,  -578 },
+    { 0xAB9EB47C81F5114FULL,  -575 }, { 0xD686619BA27255A2ULL,  -572 },
+    { 0x8613FD0145877585ULL,  -568 }, { 0xA798FC4196E952E7ULL,  -565 },
+    { 0xD17F3B51FCA3A7A0ULL,  -562 }, { 0x82EF85133DE648C4ULL,  -558 },
+    { 0xA3AB66580D5FDAF5ULL,  -555 }, { 0xCC963FEE10B7D1B3ULL,  -552 },
+    { 0xFFBBCFE994E5C61FULL,  -549 }, { 0x9FD561F1FD0F9BD3ULL,  -545 },
+    { 0xC7CABA6E7C5382C8ULL,  -542 }, { 0xF9BD690A1B68637BULL,  -539 },
+    { 0x9C1661A651213E2DULL,  -535 }, { 0xC31BFA0FE5698DB8ULL,  -532 },
+    { 0xF3E2F893DEC3F126ULL,  -529 }, { 0x986DDB5C6B3A76B7ULL,  -525 },
+    { 0xBE89523386091465ULL,  -522 }, { 0xEE2BA6C0678B597FULL,  -519 },
+    { 0x94DB483840B717EFULL,  -515 }, { 0xBA121A4650E4DDEBULL,  -512 },
+    { 0xE896A0D7E51E1566ULL,  -509 }, { 0x915E2486EF32CD60ULL,  -505 },
+    { 0xB5B5ADA8AAFF80B8ULL,  -502 }, { 0xE3231912D5BF60E6ULL,  -499 },
+    { 0x8DF5EFABC5979C8FULL,  -495 }, { 0xB1736B96B6FD83B3ULL,  -492 },
+    { 0xDDD0467C64BCE4A0ULL,  -489 }, { 0x8AA22C0DBEF60EE4ULL,  -485 },
+    { 0xAD4AB7112EB3929DULL,  -482 }, { 0xD89D64D57A607744ULL,  -479 },
+    { 0x87625F056C7C4A8BULL,  -475 }, { 0xA93AF6C6C79B5D2DULL,  -472 },
+    { 0xD389B47879823479ULL,  -469 }, { 0x843610CB4BF160CBULL,  -465 },
+    { 0xA54394FE1EEDB8FEULL,  -462 }, { 0xCE947A3DA6A9273EULL,  -459 },
+    { 0x811CCC668829B887ULL,  -455 }, { 0xA163FF802A3426A8ULL,  -452 },
+    { 0xC9BCFF6034C13052ULL,  -449 }, { 0xFC2C3F3841F17C67ULL,  -446 },
+    { 0x9D9BA7832936EDC0ULL,  -442 }, { 0xC5029163F384A931ULL,  -439 },
+    { 0xF64335BCF065D37DULL,  -436 }, { 0x99EA0196163FA42EULL,  -432 },
+    { 0xC06481FB9BCF8D39ULL,  -429 }, { 0xF07DA27A82C37088ULL,  -426 },
+    { 0x964E858C91BA2655ULL,  -422 }, { 0xBBE226EFB628AFEAULL,  -419 },
+    { 0xEADAB0ABA3B2DBE5ULL,  -416 }, { 0x92C8AE6B464FC96FULL,  -412 },
+    { 0xB77ADA0617E3BBCBULL,  -409 }, { 0xE55990879DDCAABDULL,  -406 },
+    { 0x8F57FA54C2A9EAB6ULL,  -402 }, { 0xB32DF8E9F3546564ULL,  -399 },
+    { 0xDFF9772470297EBDULL,  -396 }, { 0x8BFBEA76C619EF36ULL,  -392 },
+    { 0xAEFAE51477A06B03ULL,  -389 }, { 0xDAB99E59958885C4ULL,  -386 },
+    { 0x88B402F7FD75539BULL,  -382 }, { 0xAAE103B5FCD2A881ULL,  -379 },
+    { 0xD59944A37C0752A2ULL,  -376 }, { 0x857FCAE62D8493A5ULL,  -372 },
+    { 0xA6DFBD9FB8E5B88EULL,  -369 }, { 0xD097AD07A71F26B2ULL,  -366 },
+    { 0x825ECC24C873782FULL,  -362 }, { 0xA2F67F2DFA90563BULL,  -359 },
+    { 0xCBB41EF979346BCAULL,  -356 }, { 0xFEA126B7D78186BCULL,  -353 },
+    { 0x9F24B832E6B0F436ULL,  -349 }, { 0xC6EDE63FA05D3143ULL,  -346 },
+    { 0xF8A95FCF88747D94ULL,  -343 }, { 0x9B69DBE1B548CE7CULL,  -339 },
+    { 0xC24452DA229B021BULL,  -336 }, { 0xF2D56790AB41C2A2ULL,  -333 },
+    { 0x97C560BA6B0919A5ULL,  -329 }, { 0xBDB6B8E905CB600FULL,  -326 },
+    { 0xED246723473E3813ULL,  -323 }, { 0x9436C0760C86E30BULL,  -319 },
+    { 0xB94470938FA89BCEULL,  -316 }, { 0xE7958CB87392C2C2ULL,  -313 },
+    { 0x90BD77F3483BB9B9ULL,  -309 }, { 0xB4ECD5F01A4AA828ULL,  -306 },
+    { 0xE2280B6C20DD5232ULL,  -303 }, { 0x8D590723948A535FULL,  -299 },
+    { 0xB0AF48EC79ACE837ULL,  -296 }, { 0xDCDB1B2798182244ULL,  -293 },
+    { 0x8A08F0F8BF0F156BULL,  -289 }, { 0xAC8B2D36EED2DAC5ULL,  -286 },
+    { 0xD7ADF884AA879177ULL,  -283 }, { 0x86CCBB52EA94BAEAULL,  -279 },
+    { 0xA87FEA27A539E9A5ULL,  -276 }, { 0xD29FE4B18E88640EULL,  -273 },
+    { 0x83A3EEEEF9153E89ULL,  -269 }, { 0xA48CEAAAB75A8E2BULL,  -266 },
+    { 0xCDB02555653131B6ULL,  -263 }, { 0x808E17555F3EBF11ULL,  -259 },
+    { 0xA0B19D2AB70E6ED6ULL,  -256 }, { 0xC8DE047564D20A8BULL,  -253 },
+    { 0xFB158592BE068D2EULL,  -250 }, { 0x9CED737BB6C4183DULL,  -246 },
+    { 0xC428D05AA4751E4CULL,  -243 }, { 0xF53304714D9265DFULL,  -240 },
+    { 0x993FE2C6D07B7FABULL,  -236 }, { 0xBF8FDB78849A5F96ULL,  -233 },
+    { 0xEF73D256A5C0F77CULL,  -230 }, { 0x95A8637627989AADULL,  -226 },
+    { 0xBB127C53B17EC159ULL,  -223 }, { 0xE9D71B689DDE71AFULL,  -220 },
+    { 0x9226712162AB070DULL,  -216 }, { 0xB6B00D69BB55C8D1ULL,  -213 },
+    { 0xE45C10C42A2B3B05ULL,  -210 }, { 0x8EB98A7A9A5B04E3ULL,  -206 },
+    { 0xB267ED1940F1C61CULL,  -203 }, { 0xDF01E85F912E37A3ULL,  -200 },
+    { 0x8B61313BBABCE2C6ULL,  -196 }, { 0xAE397D8AA96C1B77ULL,  -193 },
+    { 0xD9C7DCED53C72255ULL,  -190 }, { 0x881CEA14545C7575ULL,  -186 },
+    { 0xAA242499697392D2ULL,  -183 }, { 0xD4AD2DBFC3D07787ULL,  -180 },
+    { 0x84EC3C97DA624AB4ULL,  -176 }, { 0xA6274BBDD0FADD61ULL,  -173 },
+    { 0xCFB11EAD453994BAULL,  -170 }, { 0x81CEB32C4B43FCF4ULL,  -166 },
+    { 0xA2425FF75E14FC31ULL,  -163 }, { 0xCAD2F7F5359A3B3EULL,  -160 },
+    { 0xFD87B5F28300CA0DULL,  -157 }, { 0x9E74D1B791E07E48ULL,  -153 },
+    { 0xC612062576589DDAULL,  -150 }, { 0xF79687AED3EEC551ULL,  -147 },
+    { 0x9ABE14CD44753B52ULL,  -143 }, { 0xC16D9A0095928A27ULL,  -140 },
+    { 0xF1C90080BAF72CB1ULL,  -137 }, { 0x971DA05074DA7BEEULL,  -133 },
+    { 0xBCE5086492111AEAULL,  -130 }, { 0xEC1E4A7DB69561A5ULL,  -127 },
+    { 0x9392EE8E921D5D07ULL,  -123 }, { 0xB877AA3236A4B449ULL,  -120 },
+    { 0xE69594BEC44DE15BULL,  -117 }, { 0x901D7CF73AB0ACD9ULL,  -113 },
+    { 0xB424DC35095CD80FULL,  -110 }, { 0xE12E13424BB40E13ULL,  -107 },
+    { 0x8CBCCC096F5088CBULL,  -103 }, { 0xAFEBFF0BCB24AAFEULL,  -100 },
+    { 0xDBE6FECEBDEDD5BEULL,   -97 }, { 0x89705F4136B4A597ULL,   -93 },
+    { 0xABCC77118461CEFCULL,   -90 }, { 0xD6BF94D5E57A42BCULL,   -87 },
+    { 0x8637BD05AF6C69B5ULL,   -83 }, { 0xA7C5AC471B478423ULL,   -80 },
+    { 0xD1B71758E219652BULL,   -77 }, { 0x83126E978D4FDF3BULL,   -73 },
+    { 0xA3D70A3D70A3D70AULL,   -70 }, { 0xCCCCCCCCCCCCCCCCULL,   -67 },
+    { 0x8000000000000000ULL,   -63 }, { 0xA000000000000000ULL,   -60 },
+    { 0xC800000000000000ULL,   -57 }, { 0xFA00000000000000ULL,   -54 },
+    { 0x9C40000000000000ULL,   -50 }, { 0xC350000000000000ULL,   -47 },
+    { 0xF424000000000000ULL,   -44 }, { 0x9896800000000000ULL,   -40 },
+    { 0xBEBC200000000000ULL,   -37 }, { 0xEE6B280000000000ULL,   -34 },
+    { 0x9502F90000000000ULL,   -30 }, { 0xBA43B74000000000ULL,   -27 },
+    { 0xE8D4A51000000000ULL,   -24 }, { 0x9184E72A00000000ULL,   -20 },
+    { 0xB5E620F480000000ULL,   -17 }, { 0xE35FA931A0000000ULL,   -14 },
+    { 0x8E1BC9BF04000000ULL,   -10 }, { 0xB1A2BC2EC5000000ULL,    -7 },
+    { 0xDE0B6B3A76400000ULL,    -4 }, { 0x8AC7230489E80000ULL,     0 },
+    { 0xAD78EBC5AC620000ULL,     3 }, { 0xD8D726B7177A8000ULL,     6 },
+    { 0x878678326EAC9000ULL,    10 }, { 0xA968163F0A57B400ULL,    13 },
+    { 0xD3C21BCECCEDA100ULL,    16 }, { 0x84595161401484A0ULL,    20 },
+    { 0xA56FA5B99019A5C8ULL,    23 }, { 0xCECB8F27F4200F3AULL,    26 },
+    { 0x813F3978F8940984ULL,    30 }, { 0xA18F07D736B90BE5ULL,    33 },
+    { 0xC9F2C9CD04674EDEULL,    36 }, { 0xFC6F7C4045812296ULL,    39 },
+    { 0x9DC5ADA82B70B59DULL,    43 }, { 0xC5371912364CE305ULL,    46 },
+    { 0xF684DF56C3E01BC6ULL,    49 }, { 0x9A130B963A6C115CULL,    53 },
+    { 0xC097CE7BC90715B3ULL,    56 }, { 0xF0BDC21ABB48DB20ULL,    59 },
+    { 0x96769950B50D88F4ULL,    63 }, { 0xBC143FA4E250EB31ULL,    66 },
+    { 0xEB194F8E1AE525FDULL,    69 }, { 0x92EFD1B8D0CF37BEULL,    73 },
+    { 0xB7ABC627050305ADULL,    76 }, { 0xE596B7B0C643C719ULL,    79 },
+    { 0x8F7E32CE7BEA5C6FULL,    83 }, { 0xB35DBF821AE4F38BULL,    86 },
+    { 0xE0352F62A19E306EULL,    89 }, { 0x8C213D9DA502DE45ULL,    93 },
+    { 0xAF298D050E4395D6ULL,    96 }, { 0xDAF3F04651D47B4CULL,    99 },
+    { 0x88D8762BF324CD0FULL,   103 }, { 0xAB0E93B6EFEE0053ULL,   106 },
+    { 0xD5D238A4ABE98068ULL,   109 }, { 0x85A36366EB71F041ULL,   113 },
+    { 0xA70C3C40A64E6C51ULL,   116 }, { 0xD0CF4B50CFE20765ULL,   119 },
+    { 0x82818F1281ED449FULL,   123 }, { 0xA321F2D7226895C7ULL,   126 },
+    { 0xCBEA6F8CEB02BB39ULL,   129 }, { 0xFEE50B7025C36A08ULL,   132 },
+    { 0x9F4F2726179A2245ULL,   136 }, { 0xC722F0EF9D80AAD6ULL,   139 },
+    { 0xF8EBAD2B84E0D58BULL,   142 }, { 0x9B934C3B330C8577ULL,   146 },
+    { 0xC2781F49FFCFA6D5ULL,   149 }, { 0xF316271C7FC3908AULL,   152 },
+    { 0x97EDD871CFDA3A56ULL,   156 }, { 0xBDE94E8E43D0C8ECULL,   159 },
+    { 0xED63A231D4C4FB27ULL,   162 }, { 0x945E455F24FB1CF8ULL,   166 },
+    { 0xB975D6B6EE39E436ULL,   169 }, { 0xE7D34C64A9C85D44ULL,   172 },
+    { 0x90E40FBEEA1D3A4AULL,   176 }, { 0xB51D13AEA4A488DDULL,   179 },
+    { 0xE264589A4DCDAB14ULL,   182 }, { 0x8D7EB76070A08AECULL,   186 },
+    { 0xB0DE65388CC8ADA8ULL,   189 }, { 0xDD15FE86AFFAD912ULL,   192 },
+    { 0x8A2DBF142DFCC7ABULL,   196 }, { 0xACB92ED9397BF996ULL,   199 },
+    { 0xD7E77A8F87DAF7FBULL,   202 }, { 0x86F0AC99B4E8DAFDULL,   206 },
+    { 0xA8ACD7C0222311BCULL,   209 }, { 0xD2D80DB02AABD62BULL,   212 },
+    { 0x83C7088E1AAB65DBULL,   216 }, { 0xA4B8CAB1A1563F52ULL,   219 },
+    { 0xCDE6FD5E09ABCF26ULL,   222 }, { 0x80B05E5AC60B6178ULL,   226 },
+    { 0xA0DC75F1778E39D6ULL,   229 }, { 0xC913936DD571C84CULL,   232 },
+    { 0xFB5878494ACE3A5FULL,   235 }, { 0x9D174B2DCEC0E47BULL,   239 },
+    { 0xC45D1DF942711D9AULL,   242 }, { 0xF5746577930D6500ULL,   245 },
+    { 0x9968BF6ABBE85F20ULL,   249 }, { 0xBFC2EF456AE276E8ULL,   252 },
+    { 0xEFB3AB16C59B14A2ULL,   255 }, { 0x95D04AEE3B80ECE5ULL,   259 },
+    { 0xBB445DA9CA61281FULL,   262 }, { 0xEA1575143CF97226ULL,   265 },
+    { 0x924D692CA61BE758ULL,   269 }, { 0xB6E0C377CFA2E12EULL,   272 },
+    { 0xE498F455C38B997AULL,   275 }, { 0x8EDF98B59A373FECULL,   279 },
+    { 0xB2977EE300C50FE7ULL,   282 }, { 0xDF3D5E9BC0F653E1ULL,   285 },
+    { 0x8B865B215899F46CULL,   289 }, { 0xAE67F1E9AEC07187ULL,   292 },
+    { 0xDA01EE641A708DE9ULL,   295 }, { 0x884134FE908658B2ULL,   299 },
+    { 0xAA51823E34A7EEDEULL,   302 }, { 0xD4E5E2CDC1D1EA96ULL,   305 },
+    { 0x850FADC09923329EULL,   309 }, { 0xA6539930BF6BFF45ULL,   312 },
+    { 0xCFE87F7CEF46FF16ULL,   315 }, { 0x81F14FAE158C5F6EULL,   319 },
+    { 0xA26DA3999AEF7749ULL,   322 }, { 0xCB090C8001AB551CULL,   325 },
+    { 0xFDCB4FA002162A63ULL,   328 }, { 0x9E9F11C4014DDA7EULL,   332 },
+    { 0xC646D63501A1511DULL,   335 }, { 0xF7D88BC24209A565ULL,   338 },
+    { 0x9AE757596946075FULL,   342 }, { 0xC1A12D2FC3978937ULL,   345 },
+    { 0xF209787BB47D6B84ULL,   348 }, { 0x9745EB4D50CE6332ULL,   352 },
+    { 0xBD176620A501FBFFULL,   355 }, { 0xEC5D3FA8CE427AFFULL,   358 },
+    { 0x93BA47C980E98CDFULL,   362 }, { 0xB8A8D9BBE123F017ULL,   365 },
+    { 0xE6D3102AD96CEC1DULL,   368 }, { 0x9043EA1AC7E41392ULL,   372 },
+    { 0xB454E4A179DD1877ULL,   375 }, { 0xE16A1DC9D8545E94ULL,   378 },
+    { 0x8CE2529E2734BB1DULL,   382 }, { 0xB01AE745B101E9E4ULL,   385 },
+    { 0xDC21A1171D42645DULL,   388 }, { 0x899504AE72497EBAULL,   392 },
+    { 0xABFA45DA0EDBDE69ULL,   395 }, { 0xD6F8D7509292D603ULL,   398 },
+    { 0x865B86925B9BC5C2ULL,   402 }, { 0xA7F26836F282B732ULL,   405 },
+    { 0xD1EF0244AF2364FFULL,   408 }, { 0x8335616AED761F1FULL,   412 },
+    { 0xA402B9C5A8D3A6E7ULL,   415 }, { 0xCD036837130890A1ULL,   418 },
+    { 0x802221226BE55A64ULL,   422 }, { 0xA02AA96B06DEB0FDULL,   425 },
+    { 0xC83553C5C8965D3DULL,   428 }, { 0xFA42A8B73ABBF48CULL,   431 },
+    { 0x9C69A97284B578D7ULL,   435 }, { 0xC38413CF25E2D70DULL,   438 },
+    { 0xF46518C2EF5B8CD1ULL,   441 }, { 0x98BF2F79D5993802ULL,   445 },
+    { 0xBEEEFB584AFF8603ULL,   448 }, { 0xEEAABA2E5DBF6784ULL,   451 },
+    { 0x952AB45CFA97A0B2ULL,   455 }, { 0xBA756174393D88DFULL,   458 },
+    { 0xE912B9D1478CEB17ULL,   461 }, { 0x91ABB422CCB812EEULL,   465 },
+    { 0xB616A12B7FE617AAULL,   468 }, { 0xE39C49765FDF9D94ULL,   471 },
+    { 0x8E41ADE9FBEBC27DULL,   475 }, { 0xB1D219647AE6B31CULL,   478 },
+    { 0xDE469FBD99A05FE3ULL,   481 }, { 0x8AEC23D680043BEEULL,   485 },
+    { 0xADA72CCC20054AE9ULL,   488 }, { 0xD910F7FF28069DA4ULL,   491 },
+    { 0x87AA9AFF79042286ULL,   495 }, { 0xA99541BF57452B28ULL,   498 },
+    { 0xD3FA922F2D1675F2ULL,   501 }, { 0x847C9B5D7C2E09B7ULL,   505 },
+    { 0xA59BC234DB398C25ULL,   508 }, { 0xCF02B2C21207EF2EULL,   511 },
+    { 0x8161AFB94B44F57DULL,   515 }, { 0xA1BA1BA79E1632DCULL,   518 },
+    { 0xCA28A291859BBF93ULL,   521 }, { 0xFCB2CB35E702AF78ULL,   524 },
+    { 0x9DEFBF01B061ADABULL,   528 }, { 0xC56BAEC21C7A1916ULL,   531 },
+    { 0xF6C69A72A3989F5BULL,   534 }, { 0x9A3C2087A63F6399ULL,   538 },
+    { 0xC0CB28A98FCF3C7FULL,   541 }, { 0xF0FDF2D3F3C30B9FULL,   544 },
+    { 0x969EB7C47859E743ULL,   548 }, { 0xBC4665B596706114ULL,   551 },
+    { 0xEB57FF22FC0C7959ULL,   554 }, { 0x9316FF75DD87CBD8ULL,   558 },
+    { 0xB7DCBF5354E9BECEULL,   561 }, { 0xE5D3EF282A242E81ULL,   564 },
+    { 0x8FA475791A569D10ULL,   568 }, { 0xB38D92D760EC4455ULL,   571 },
+    { 0xE070F78D3927556AULL,   574 }, { 0x8C469AB843B89562ULL,   578 },
+    { 0xAF58416654A6BABBULL,   581 }, { 0xDB2E51BFE9D0696AULL,   584 },
+    { 0x88FCF317F22241E2ULL,   588 }, { 0xAB3C2FDDEEAAD25AULL,   591 },
+    { 0xD60B3BD56A5586F1ULL,   594 }, { 0x85C7056562757456ULL,   598 },
+    { 0xA738C6BEBB12D16CULL,   601 }, { 0xD106F86E69D785C7ULL,   604 },
+    { 0x82A45B450226B39CULL,   608 }, { 0xA34D721642B06084ULL,   611 },
+    { 0xCC20CE9BD35C78A5ULL,   614 }, { 0xFF290242C83396CEULL,   617 },
+    { 0x9F79A169BD203E41ULL,   621 }, { 0xC75809C42C684DD1ULL,   624 },
+    { 0xF92E0C3537826145ULL,   627 }, { 0x9BBCC7A142B17CCBULL,   631 },
+    { 0xC2ABF989935DDBFEULL,   634 }, { 0xF356F7EBF83552FEULL,   637 },
+    { 0x98165AF37B2153DEULL,   641 }, { 0xBE1BF1B059E9A8D6ULL,   644 },
+    { 0xEDA2EE1C7064130CULL,   647 }, { 0x9485D4D1C63E8BE7ULL,   651 },
+    { 0xB9A74A0637CE2EE1ULL,   654 }, { 0xE8111C87C5C1BA99ULL,   657 },
+    { 0x910AB1D4DB9914A0ULL,   661 }, { 0xB54D5E4A127F59C8ULL,   664 },
+    { 0xE2A0B5DC971F303AULL,   667 }, { 0x8DA471A9DE737E24ULL,   671 },
+    { 0xB10D8E1456105DADULL,   674 }, { 0xDD50F1996B947518ULL,   677 },
+    { 0x8A5296FFE33CC92FULL,   681 }, { 0xACE73CBFDC0BFB7BULL,   684 },
+    { 0xD8210BEFD30EFA5AULL,   687 }, { 0x8714A775E3E95C78ULL,   691 },
+    { 0xA8D9D1535CE3B396ULL,   694 }, { 0xD31045A8341CA07CULL,   697 },
+    { 0x83EA2B892091E44DULL,   701 }, { 0xA4E4B66B68B65D60ULL,   704 },
+    { 0xCE1DE40642E3F4B9ULL,   707 }, { 0x80D2AE83E9CE78F3ULL,   711 },
+    { 0xA1075A24E4421730ULL,   714 }, { 0xC94930AE1D529CFCULL,   717 },
+    { 0xFB9B7CD9A4A7443CULL,   720 }, { 0x9D412E0806E88AA5ULL,   724 },
+    { 0xC491798A08A2AD4EULL,   727 }, { 0xF5B5D7EC8ACB58A2ULL,   730 },
+    { 0x9991A6F3D6BF1765ULL,   734 }, { 0xBFF610B0CC6EDD3FULL,   737 },
+    { 0xEFF394DCFF8A948EULL,   740 }, { 0x95F83D0A1FB69CD9ULL,   744 },
+    { 0xBB764C4CA7A4440FULL,   747 }, { 0xEA53DF5FD18D5513ULL,   750 },
+    { 0x92746B9BE2F8552CULL,   754 }, { 0xB7118682DBB66A77ULL,   757 },
+    { 0xE4D5E82392A40515ULL,   760 }, { 0x8F05B1163BA6832DULL,   764 },
+    { 0xB2C71D5BCA9023F8ULL,   767 }, { 0xDF78E4B2BD342CF6ULL,   770 },
+    { 0x8BAB8EEFB6409C1AULL,   774 }, { 0xAE9672ABA3D0C320ULL,   777 },
+    { 0xDA3C0F568CC4F3E8ULL,   780 }, { 0x8865899617FB1871ULL,   784 },
+    { 0xAA7EEBFB9DF9DE8DULL,   787 }, { 0xD51EA6FA85785631ULL,   790 },
+    { 0x8533285C936B35DEULL,   794 }, { 0xA67FF273B8460356ULL,   797 },
+    { 0xD01FEF10A657842CULL,   800 }, { 0x8213F56A67F6B29BULL,   804 },
+    { 0xA298F2C501F45F42ULL,   807 }, { 0xCB3F2F7642717713ULL,   810 },
+    { 0xFE0EFB53D30DD4D7ULL,   813 }, { 0x9EC95D1463E8A506ULL,   817 },
+    { 0xC67BB4597CE2CE48ULL,   820 }, { 0xF81AA16FDC1B81DAULL,   823 },
+    { 0x9B10A4E5E9913128ULL,   827 }, { 0xC1D4CE1F63F57D72ULL,   830 },
+    { 0xF24A01A73CF2DCCFULL,   833 }, { 0x976E41088617CA01ULL,   837 },
+    { 0xBD49D14AA79DBC82ULL,   840 }, { 0xEC9C459D51852BA2ULL,   843 },
+    { 0x93E1AB8252F33B45ULL,   847 }, { 0xB8DA1662E7B00A17ULL,   850 },
+    { 0xE7109BFBA19C0C9DULL,   853 }, { 0x906A617D450187E2ULL,   857 },
+    { 0xB484F9DC9641E9DAULL,   860 }, { 0xE1A63853BBD26451ULL,   863 },
+    { 0x8D07E33455637EB2ULL,   867 }, { 0xB049DC016ABC5E5FULL,   870 },
+    { 0xDC5C5301C56B75F7ULL,   873 }, { 0x89B9B3E11B6329BAULL,   877 },
+    { 0xAC2820D9623BF429ULL,   880 }, { 0xD732290FBACAF133ULL,   883 },
+    { 0x867F59A9D4BED6C0ULL,   887 }, { 0xA81F301449EE8C70ULL,   890 },
+    { 0xD226FC195C6A2F8CULL,   893 }, { 0x83585D8FD9C25DB7ULL,   897 },
+    { 0xA42E74F3D032F525ULL,   900 }, { 0xCD3A1230C43FB26FULL,   903 },
+    { 0x80444B5E7AA7CF85ULL,   907 }, { 0xA0555E361951C366ULL,   910 },
+    { 0xC86AB5C39FA63440ULL,   913 }, { 0xFA856334878FC150ULL,   916 },
+    { 0x9C935E00D4B9D8D2ULL,   920 }, { 0xC3B8358109E84F07ULL,   923 },
+    { 0xF4A642E14C6262C8ULL,   926 }, { 0x98E7E9CCCFBD7DBDULL,   930 },
+    { 0xBF21E44003ACDD2CULL,   933 }, { 0xEEEA5D5004981478ULL,   936 },
+    { 0x95527A5202DF0CCBULL,   940 }, { 0xBAA718E68396CFFDULL,   943 },
+    { 0xE950DF20247C83FDULL,   946 }, { 0x91D28B7416CDD27EULL,   950 },
+    { 0xB6472E511C81471DULL,   953 }, { 0xE3D8F9E563A198E5ULL,   956 },
+    { 0x8E679C2F5E44FF8FULL,   960 },
+};
+
+_Success_(return)
+static BOOL FDblFromDecimalFast(uint64 luMan, int32 lwExp10, double *pdbl)
+{
+    Assert(luMan != 0);
+    CompileAssert(_countof(g_rgPowersOfTen) == kwMaxFastExp10 - kwMinFastExp10 + 1);
+
+    if (lwExp10 < kwMinFastExp10 || lwExp10 > kwMaxFastExp10)
+    {
+        return FALSE;
+    }
+
+    DiyFp w = { luMan, 0 };
+    w = DiyFpNormalize(w);
+    const DiyFp &pow = g_rgPowersOfTen[lwExp10 - kwMinFastExp10];
+
+    uint64 luLo;
+    uint64 luHi = MulLu64(w.f, pow.f, &luLo);
+
+    // 54 bits for the double and a rounding bit. The top bit of the product is bit 63 or 62.
+    int cbitShift = (int)(luHi >> 63) + 9;
+    uint64 luMask = ((uint64)1 << cbitShift) - 1;
+    uint64 luTop = luHi >> cbitShift;
+
+    if (lwExp10 >= 0 && lwExp10 <= kwMaxExactPow10)
+    {
+        // The product is exact. Round half to even.
+        if ((luTop & 3) == 1 && 0 == (luHi & luMask) && 0 == luLo)
+        {
+            luTop--;
+        }
+    }
+    else if ((luHi & 0x1FF) == 0x1FF && luLo + w.f < luLo)
+    {
+        // The power of ten is truncated, so the exact product is in [luHi:luLo, luHi:luLo + w.f).
+        // Adding w.f may carry into the bits we keep, so we can't tell how this rounds.
+        // Otherwise the exact product is not a tie: it is above luHi:luLo, which isn't below
+        // a tie when its rounding bit is set.
+        return FALSE;
+    }
+
+    // Round, which may carry into the next power of two
+    uint64 luMant = (luTop + 1) >> 1;
+    int wExp2 = cbitShift + 1 + kcbitDiyFp + w.e + pow.e;
+    if (luMant == ((uint64)1 << 53))
+    {
+        luMant >>= 1;
+        wExp2++;
+    }
+    Assert(luMant >> 52 == 1);
+
+    int wBiasedExp = wExp2 + 52 + 1023;
+    if (wBiasedExp <= 0 || wBiasedExp >= 0x7FF)
+    {
+        return FALSE;
+    }
+
+    uint64 luBits = ((uint64)wBiasedExp << 52) | (luMant & 0x000FFFFFFFFFFFFFULL);
+    *pdbl = Js::NumberUtilities::ReinterpretBits((int64)luBits);
+    return TRUE;
+}
+
+
 /***************************************************************************
 String to Double.
 ***************************************************************************/
@@ -907,6 +1376,8 @@ double Js::NumberUtilities::StrToDbl( const EncodedChar *psz, const EncodedChar
     Js::NumberUtilities::LuHiDbl(dblLowPrec) = 0x7FFFFFFF;
     Js::NumberUtilities::LuLoDbl(dblLowPrec) = 0xFFFFFFFF;
     Assert(Js::NumberUtilities::IsNan(dblLowPrec));
+    bool canUseFastPath = false;
+    double dblFastPath = 0;
 #endif //DBG
 
     // For the mantissa digits. After leaving the state machine, pchMinDig
@@ -1173,6 +1644,32 @@ double Js::NumberUtilities::StrToDbl( const EncodedChar *psz, const EncodedChar
 #endif //!DBG
     }
 
+    // Up to 19 digits fit in a uint64.
+    if (cchDig <= 19)
+    {
+        uint64 luMan = 0;
+        for (pch = pchMinDig; pch < pchLimDig; pch++)
+        {
+            if (*pch != '.')
+            {
+                Assert(Js::NumberUtilities::IsDigit(*pch));
+                luMan = luMan * 10 + (*pch - '0');
+            }
+        }
+
+        if (FDblFromDecimalFast(luMan, lwExp, &dbl))
+        {
+#if DBG
+            // In the debug version, execute the high precision code also and
+            // verify that the results are the same.
+            canUseFastPath = true;
+            dblFastPath = dbl;
+#else //!DBG
+            goto LDone;
+#endif //!DBG
+        }
+    }
+
     lwExp += cchDig;
     if (lwExp >= klwMaxExp10)
     {
@@ -1244,6 +1741,7 @@ double Js::NumberUtilities::StrToDbl( const EncodedChar *psz, const EncodedChar
     //    Assert(Js::NumberUtilities::IsNan(dblLowPrec) || dblLowPrec == dbl);
 
 #if DBG
+    Assert(!canUseFastPath || dblFastPath == dbl);
     if(canUseLowPrec)
     {
         // Use the same final behavior in debug builds as for non-debug builds by using the low-precision value
@@ -1561,6 +2059,41 @@ static BOOL FDblToRgbPrecise(double dbl, __out_ecount(kcbMaxRgb) byte *prgb, int
 }
 
 
+/***************************************************************************
+Get mantissa bytes (BCD) of an integer from 1 to 2^53 with integer arithmetic.
+***************************************************************************/
+static void IntegralDblToRgb(double dbl, _Out_writes_to_(kcbMaxRgb, (*ppbLim - prgb)) byte *prgb,
+                             int *pwExp10, byte **ppbLim)
+{
+    // dbl should be an integer from 1 to 2^53.
+    Assert(dbl == floor(dbl) && 1 <= dbl && dbl <= 9007199254740992.0);
+
+    uint64 lu = (uint64)dbl;
+
+    // Write the digits from the least significant one at the end of a 20 digit window,
+    // skipping the trailing zeros.
+    byte rgbT[20];
+    int ibT = _countof(rgbT);
+    int cbZeros = 0;
+    while (0 == lu % 10)
+    {
+        lu /= 10;
+        cbZeros++;
+    }
+    do
+    {
+        Assert(ibT > 0);
+        rgbT[--ibT] = (byte)(lu % 10);
+        lu /= 10;
+    } while (0 != lu);
+
+    int cb = _countof(rgbT) - ibT;
+    Assert(cb < kcbMaxRgb);
+    js_memcpy_s(prgb, kcbMaxRgb, &rgbT[ibT], cb);
+    *pwExp10 = cb + cbZeros;
+    *ppbLim = &prgb[cb];
+}
+
 /***************************************************************************
 Get mantissa bytes (BCD).
 ***************************************************************************/
@@ -1849,31 +2382,7 @@ static BOOL FDblToRgbFast(double dbl, _Out_writes_to_(kcbMaxRgb, (*ppbLim - prgb
     return TRUE;
 
 LSmallInt:
-    // dbl should be an integer from 1 to (2^53 - 1).
-    Assert(dbl == floor(dbl) && 1 <= dbl && dbl <= 9007199254740991.0L);
-
-    iT = 0;
-    if (dbl >= g_rgdblTens[iT + 8])
-        iT += 8;
-    if (dbl >= g_rgdblTens[iT + 4])
-        iT += 4;
-    if (dbl >= g_rgdblTens[iT + 2])
-        iT += 2;
-    if (dbl >= g_rgdblTens[iT + 1])
-        iT += 1;
-    Assert(iT >= 0 && iT <= 15);
-    Assert(dbl >= g_rgdblTens[iT] && dbl < g_rgdblTens[iT + 1]);
-    *pwExp10 = iT + 1;
-
-    for (ib = 0; 0 != dbl && ib < kcbMaxRgb && 0 <= iT; iT--)
-    {
-        Assert(iT >= 0);
-        bHH = (byte)(dbl / g_rgdblTens[iT]);
-        dbl -= bHH * g_rgdblTens[iT];
-        Assert(dbl == floor(dbl) && 0 <= dbl && dbl < g_rgdblTens[iT]);
-        prgb[ib++] = bHH;
-    }
-    *ppbLim = &prgb[ib];
+    IntegralDblToRgb(dbl, prgb, pwExp10, ppbLim);
     return TRUE;
 
 LFail:
@@ -1881,6 +2390,339 @@ static BOOL FDblToRgbFast(double dbl, _Out_writes_to_(kcbMaxRgb, (*ppbLim - prgb
 }
 
 
+/***************************************************************************
+Shortest digits using the Grisu3 algorithm from Florian Loitsch, "Printing
+Floating-Point Numbers Quickly and Accurately with Integers", PLDI 2010.
+
+The double and its boundaries are scaled by a cached power of ten so that the
+integral part of the scaled upper boundary fits in 32 bits, and the digits are
+generated with 64 bit integer arithmetic only. Grisu3 knows when the imprecision
+of the scaled values may give digits that are not the shortest or closest, and
+fails in that case (for less than 0.5% of the doubles), so the caller falls back to
+FDblToRgbFast / FDblToRgbPrecise.
+***************************************************************************/
+
+// The digit generation needs the scaled values to have a binary exponent in this range.
+static const int kwMinTargetExp2 = -60;
+static const int kwMaxTargetExp2 = -32;
+
+// Normalized powers of ten 10^k for k = -348, -340, ..., 340. Adjacent entries are
+// 10^8 apart, so one of them scales any double into the target exponent range.
+struct CachedPowerOfTen
+{
+    uint64 f;
+    int16 e;
+    int16 wExp10;
+};
+
+static const CachedPowerOfTen g_rgCachedPowers[] =
+{
+    { 0xFA8FD5A0081C0288ULL, -1220, -348 },
+    { 0xBAAEE17FA23EBF76ULL, -1193, -340 },
+    { 0x8B16FB203055AC76ULL, -1166, -332 },
+    { 0xCF42894A5DCE35EAULL, -1140, -324 },
+    { 0x9A6BB0AA55653B2DULL, -1113, -316 },
+    { 0xE61ACF033D1A45DFULL, -1087, -308 },
+    { 0xAB70FE17C79AC6CAULL, -1060, -300 },
+    { 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+    { 0xBE5691EF416BD60CULL, -1007, -284 },
+    { 0x8DD01FAD907FFC3CULL,  -980, -276 },
+    { 0xD3515C2831559A83ULL,  -954, -268 },
+    { 0x9D71AC8FADA6C9B5ULL,  -927, -260 },
+    { 0xEA9C227723EE8BCBULL,  -901, -252 },
+    { 0xAECC49914078536DULL,  -874, -244 },
+    { 0x823C12795DB6CE57ULL,  -847, -236 },
+    { 0xC21094364DFB5637ULL,  -821, -228 },
+    { 0x9096EA6F3848984FULL,  -794, -220 },
+    { 0xD77485CB25823AC7ULL,  -768, -212 },
+    { 0xA086CFCD97BF97F4ULL,  -741, -204 },
+    { 0xEF340A98172AACE5ULL,  -715, -196 },
+    { 0xB23867FB2A35B28EULL,  -688, -188 },
+    { 0x84C8D4DFD2C63F3BULL,  -661, -180 },
+    { 0xC5DD44271AD3CDBAULL,  -635, -172 },
+    { 0x936B9FCEBB25C996ULL,  -608, -164 },
+    { 0xDBAC6C247D62A584ULL,  -582, -156 },
+    { 0xA3AB66580D5FDAF6ULL,  -555, -148 },
+    { 0xF3E2F893DEC3F126ULL,  -529, -140 },
+    { 0xB5B5ADA8AAFF80B8ULL,  -502, -132 },
+    { 0x87625F056C7C4A8BULL,  -475, -124 },
+    { 0xC9BCFF6034C13053ULL,  -449, -116 },
+    { 0x964E858C91BA2655ULL,  -422, -108 },
+    { 0xDFF9772470297EBDULL,  -396, -100 },
+    { 0xA6DFBD9FB8E5B88FULL,  -369,  -92 },
+    { 0xF8A95FCF88747D94ULL,  -343,  -84 },
+    { 0xB94470938FA89BCFULL,  -316,  -76 },
+    { 0x8A08F0F8BF0F156BULL,  -289,  -68 },
+    { 0xCDB02555653131B6ULL,  -263,  -60 },
+    { 0x993FE2C6D07B7FACULL,  -236,  -52 },
+    { 0xE45C10C42A2B3B06ULL,  -210,  -44 },
+    { 0xAA242499697392D3ULL,  -183,  -36 },
+    { 0xFD87B5F28300CA0EULL,  -157,  -28 },
+    { 0xBCE5086492111AEBULL,  -130,  -20 },
+    { 0x8CBCCC096F5088CCULL,  -103,  -12 },
+    { 0xD1B71758E219652CULL,   -77,   -4 },
+    { 0x9C40000000000000ULL,   -50,    4 },
+    { 0xE8D4A51000000000ULL,   -24,   12 },
+    { 0xAD78EBC5AC620000ULL,     3,   20 },
+    { 0x813F3978F8940984ULL,    30,   28 },
+    { 0xC097CE7BC90715B3ULL,    56,   36 },
+    { 0x8F7E32CE7BEA5C70ULL,    83,   44 },
+    { 0xD5D238A4ABE98068ULL,   109,   52 },
+    { 0x9F4F2726179A2245ULL,   136,   60 },
+    { 0xED63A231D4C4FB27ULL,   162,   68 },
+    { 0xB0DE65388CC8ADA8ULL,   189,   76 },
+    { 0x83C7088E1AAB65DBULL,   216,   84 },
+    { 0xC45D1DF942711D9AULL,   242,   92 },
+    { 0x924D692CA61BE758ULL,   269,  100 },
+    { 0xDA01EE641A708DEAULL,   295,  108 },
+    { 0xA26DA3999AEF774AULL,   322,  116 },
+    { 0xF209787BB47D6B85ULL,   348,  124 },
+    { 0xB454E4A179DD1877ULL,   375,  132 },
+    { 0x865B86925B9BC5C2ULL,   402,  140 },
+    { 0xC83553C5C8965D3DULL,   428,  148 },
+    { 0x952AB45CFA97A0B3ULL,   455,  156 },
+    { 0xDE469FBD99A05FE3ULL,   481,  164 },
+    { 0xA59BC234DB398C25ULL,   508,  172 },
+    { 0xF6C69A72A3989F5CULL,   534,  180 },
+    { 0xB7DCBF5354E9BECEULL,   561,  188 },
+    { 0x88FCF317F22241E2ULL,   588,  196 },
+    { 0xCC20CE9BD35C78A5ULL,   614,  204 },
+    { 0x98165AF37B2153DFULL,   641,  212 },
+    { 0xE2A0B5DC971F303AULL,   667,  220 },
+    { 0xA8D9D1535CE3B396ULL,   694,  228 },
+    { 0xFB9B7CD9A4A7443CULL,   720,  236 },
+    { 0xBB764C4CA7A44410ULL,   747,  244 },
+    { 0x8BAB8EEFB6409C1AULL,   774,  252 },
+    { 0xD01FEF10A657842CULL,   800,  260 },
+    { 0x9B10A4E5E9913129ULL,   827,  268 },
+    { 0xE7109BFBA19C0C9DULL,   853,  276 },
+    { 0xAC2820D9623BF429ULL,   880,  284 },
+    { 0x80444B5E7AA7CF85ULL,   907,  292 },
+    { 0xBF21E44003ACDD2DULL,   933,  300 },
+    { 0x8E679C2F5E44FF8FULL,   960,  308 },
+    { 0xD433179D9C8CB841ULL,   986,  316 },
+    { 0x9E19DB92B4E31BA9ULL,  1013,  324 },
+    { 0xEB96BF6EBADF77D9ULL,  1039,  332 },
+    { 0xAF87023B9BF0EE6BULL,  1066,  340 },
+};
+
+static const int kwCachedPowersMinExp10 = -348;
+static const int kwCachedPowersExp10Step = 8;
+
+// Get a cached power of ten c such that kwMinTargetExp2 <= w.e + c.e + 64 <= kwMaxTargetExp2
+// for a normalized w.
+static inline const CachedPowerOfTen &GetCachedPowerForExp2(int wExp2)
+{
+    // 1 / log2(10)
+    const double kdblInvLog2Of10 = 0.30102999566398114;
+    int wMinExp2 = kwMinTargetExp2 - (wExp2 + kcbitDiyFp);
+    int k = (int)ceil((wMinExp2 + kcbitDiyFp - 1) * kdblInvLog2Of10);
+    int index = (k - kwCachedPowersMinExp10 - 1) / kwCachedPowersExp10Step + 1;
+    Assert(index >= 0 && index < (int)_countof(g_rgCachedPowers));
+    __analysis_assume(index >= 0 && index < (int)_countof(g_rgCachedPowers));
+
+    const CachedPowerOfTen &cached = g_rgCachedPowers[index];
+    Assert(wMinExp2 <= cached.e);
+    Assert(cached.e <= kwMaxTargetExp2 - (wExp2 + kcbitDiyFp));
+    return cached;
+}
+
+// The last digit of the buffer is within unsafeInterval of the value, but it may not be the
+// closest shortest representation. Move it closer to w while it stays in the interval, and
+// check that the result is certainly correct given the imprecision 'unit' of the scaled values.
+//
+// distanceTooHighW: distance of the scaled w to the (unsafe) upper boundary.
+// rest: distance of the digits to the upper boundary.
+// tenKappa: the value of one unit of the last digit.
+static BOOL GrisuRoundWeed(byte *prgb, int cb, uint64 distanceTooHighW, uint64 unsafeInterval,
+                           uint64 rest, uint64 tenKappa, uint64 unit)
+{
+    uint64 smallDistance = distanceTooHighW - unit;
+    uint64 bigDistance = distanceTooHighW + unit;
+
+    // Decrement the last digit while it gets closer to w. smallDistance is the distance to the
+    // farthest w could be, so this never overshoots.
+    while (rest < smallDistance &&
+           unsafeInterval - rest >= tenKappa &&
+           (rest + tenKappa < smallDistance ||
+            smallDistance - rest >= rest + tenKappa - smallDistance))
+    {
+        prgb[cb - 1]--;
+        rest += tenKappa;
+    }
+
+    // If decrementing once more would be closer to the nearest possible w as well, we can't
+    // tell which of the two is the right one.
+    if (rest < bigDistance &&
+        unsafeInterval - rest >= tenKappa &&
+        (rest + tenKappa < bigDistance ||
+         bigDistance - rest > rest + tenKappa - bigDistance))
+    {
+        return FALSE;
+    }
+
+    // The digits have to be in the safe interval, which is unit away from the unsafe one on
+    // both sides, with some extra room for the imprecision of the conversions.
+    return 2 * unit <= rest && rest <= unsafeInterval - 4 * unit;
+}
+
+// Generate the shortest digits in the interval (low, high) around w, where the three have
+// the same exponent in the target range. Returns the number of digits and the decimal
+// exponent kappa of one unit of the last digit.
+static BOOL GrisuDigitGen(const DiyFp &low, const DiyFp &w, const DiyFp &high,
+                          __out_ecount(kcbMaxRgb) byte *prgb, int *pcb, int *pkappa)
+{
+    Assert(low.e == w.e && w.e == high.e);
+    Assert(low.f + 1 <= high.f - 1);
+    Assert(kwMinTargetExp2 <= w.e && w.e <= kwMaxTargetExp2);
+
+    // low, w and high are imprecise by less than one unit; work on the widest interval
+    // that could contain the digits and check against the narrowest one in GrisuRoundWeed.
+    uint64 unit = 1;
+    DiyFp tooLow = { low.f - unit, low.e };
+    DiyFp tooHigh = { high.f + unit, high.e };
+    uint64 unsafeInterval = DiyFpSub(tooHigh, tooLow).f;
+
+    // one = 2^-w.e, so the integral part of tooHigh is tooHigh.f / one.
+    const int cbitShift = -w.e;
+    const uint64 luOne = (uint64)1 << cbitShift;
+    uint32 luIntegrals = (uint32)(tooHigh.f >> cbitShift);
+    uint64 luFractionals = tooHigh.f & (luOne - 1);
+
+    // Largest power of ten not greater than the integral part. The integral part is not
+    // zero since tooHigh.f is normalized and the shift is at most 60.
+    Assert(luIntegrals != 0);
+    uint32 luDivisor = 1;
+    int kappa = 1;
+    while (kappa < 10 && luIntegrals >= luDivisor * 10)
+    {
+        luDivisor *= 10;
+        kappa++;
+    }
+
+    int cb = 0;
+    while (kappa > 0)
+    {
+        Assert(cb < kcbMaxRgb);
+        prgb[cb++] = (byte)(luIntegrals / luDivisor);
+        luIntegrals %= luDivisor;
+        kappa--;
+
+        uint64 rest = ((uint64)luIntegrals << cbitShift) + luFractionals;
+        if (rest < unsafeInterval)
+        {
+            *pcb = cb;
+            *pkappa = kappa;
+            return GrisuRoundWeed(prgb, cb, DiyFpSub(tooHigh, w).f, unsafeInterval, rest,
+                                  (uint64)luDivisor << cbitShift, unit);
+        }
+        luDivisor /= 10;
+    }
+
+    // The fractional digits. unit grows with every digit, so this ends before it overflows.
+    for (;;)
+    {
+        luFractionals *= 10;
+        unit *= 10;
+        unsafeInterval *= 10;
+
+        Assert(cb < kcbMaxRgb);
+        prgb[cb++] = (byte)(luFractionals >> cbitShift);
+        luFractionals &= luOne - 1;
+        kappa--;
+
+        if (luFractionals < unsafeInterval)
+        {
+            *pcb = cb;
+            *pkappa = kappa;
+            return GrisuRoundWeed(prgb, cb, DiyFpSub(tooHigh, w).f * unit, unsafeInterval,
+                                  luFractionals, luOne, unit);
+        }
+    }
+}
+
+_Success_(return)
+static BOOL FDblToRgbGrisu(double dbl, _Out_writes_to_(kcbMaxRgb, (*ppbLim - prgb)) byte *prgb,
+                           int *pwExp10, byte **ppbLim)
+{
+    // Caller should take care of 0, negative and non-finite values.
+    Assert(Js::NumberUtilities::IsFinite(dbl));
+    Assert(0 < dbl);
+
+    uint64 luBits = Js::NumberUtilities::ToSpecial(dbl);
+    uint64 luMantissa = luBits & 0x000FFFFFFFFFFFFFULL;
+    int wBiasedExp = (int)(luBits >> 52);
+
+    // Integers below 2^53 are exact, so their digits are the shortest ones.
+    if (wBiasedExp >= 1023 && wBiasedExp <= 1075 && dbl == floor(dbl))
+    {
+        IntegralDblToRgb(dbl, prgb, pwExp10, ppbLim);
+        return TRUE;
+    }
+
+    DiyFp v;
+    if (wBiasedExp != 0)
+    {
+        v.f = luMantissa | 0x0010000000000000ULL;
+        v.e = wBiasedExp - 1075;
+    }
+    else
+    {
+        // Denormal
+        v.f = luMantissa;
+        v.e = -1074;
+    }
+
+    // The boundaries are half way to the neighboring doubles. The lower one is closer when
+    // the mantissa is a power of two, except for the smallest normal exponent.
+    DiyFp high = { (v.f << 1) + 1, v.e - 1 };
+    high = DiyFpNormalize(high);
+    DiyFp low;
+    if (luMantissa == 0 && wBiasedExp > 1)
+    {
+        low.f = (v.f << 2) - 1;
+        low.e = v.e - 2;
+    }
+    else
+    {
+        low.f = (v.f << 1) - 1;
+        low.e = v.e - 1;
+    }
+    low.f <<= low.e - high.e;
+    low.e = high.e;
+
+    DiyFp w = DiyFpNormalize(v);
+    Assert(w.e == high.e);
+
+    const CachedPowerOfTen &cached = GetCachedPowerForExp2(w.e);
+    DiyFp tenMk = { cached.f, cached.e };
+
+    DiyFp scaledW = DiyFpMul(w, tenMk);
+    DiyFp scaledLow = DiyFpMul(low, tenMk);
+    DiyFp scaledHigh = DiyFpMul(high, tenMk);
+
+    int cb;
+    int kappa;
+    if (!GrisuDigitGen(scaledLow, scaledW, scaledHigh, prgb, &cb, &kappa))
+    {
+        return FALSE;
+    }
+
+    // The digits, read as an integer, are dbl * 10^(kappa - wExp10 of the cached power).
+    // Drop the trailing zeros since FormatDigits expects none.
+    Assert(cb > 0 && prgb[0] != 0);
+    while (prgb[cb - 1] == 0)
+    {
+        cb--;
+        kappa++;
+    }
+
+    *pwExp10 = cb + kappa - cached.wExp10;
+    *ppbLim = &prgb[cb];
+    return TRUE;
+}
+
+
 static BOOL FormatDigits(_In_reads_(pbLim - pbSrc) byte *pbSrc, byte *pbLim, int wExp10, _Out_writes_(cchDst) OLECHAR *pchDst, int cchDst)
 {
     AnalysisAssert(pbLim > pbSrc);
@@ -2315,7 +3157,8 @@ int Js::NumberUtilities::FDblToStr(double dbl, Js::NumberUtilities::FormatType f
         }
 
         // in case we restrict the number of digits, do not push for a higher bound
-        if (!FDblToRgbFast(dbl, rgb, &wExp10, &pbLim, nDigits) &&
+        if (!(nDigits < 0 && FDblToRgbGrisu(dbl, rgb, &wExp10, &pbLim)) &&
+            !FDblToRgbFast(dbl, rgb, &wExp10, &pbLim, nDigits) &&
             !FDblToRgbPrecise(dbl, rgb, &wExp10, &pbLim, nDigits))
         {
             AssertMsg(FALSE, "Failure in FDblToRgbPrecise");
@@ -2451,7 +3294,8 @@ BOOL Js::NumberUtilities::FNonZeroFiniteDblToStr(double dbl, __out_ecount(cchDst
         AssertMsg(FALSE, "Failure in FDblToRgbPrecise");
 #endif //DBG
 
-    if (!FDblToRgbFast(dbl, rgb, &wExp10, &pbLim) &&
+    if (!FDblToRgbGrisu(dbl, rgb, &wExp10, &pbLim) &&
+        !FDblToRgbFast(dbl, rgb, &wExp10, &pbLim) &&
         !FDblToRgbPrecise(dbl, rgb, &wExp10, &pbLim))
     {
         AssertMsg(FALSE, "Failure in FDblToRgbPrecise");
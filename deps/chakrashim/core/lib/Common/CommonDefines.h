@@ -405,6 +405,7 @@
 #define REJIT_STATS
 #define PERF_HINT
 #define POLY_INLINE_CACHE_SIZE_STATS
+#define TYPE_TRANSITION_STATS
 
 #define JS_PROFILE_DATA_INTERFACE 1
 #define EXCEPTION_RECOVERY 1
@@ -477,20 +478,19 @@
 #define ENABLE_TTD_INTERNAL_DIAGNOSTICS 0
 #endif
 
+//Use the (lower performance) text format for logs and snapshots when diagnostics are on for easier debugging etc.
+//and the compact binary format otherwise -- traces can only be replayed by a build with the same setting anyway
+#if ENABLE_TTD_INTERNAL_DIAGNOSTICS
 #define TTD_LOG_READER TextFormatReader
 #define TTD_LOG_WRITER TextFormatWriter
-
-//For now always use the (lower performance) text format for snapshots for easier debugging etc.
 #define TTD_SNAP_READER TextFormatReader
 #define TTD_SNAP_WRITER TextFormatWriter
-
-//#if ENABLE_TTD_INTERNAL_DIAGNOSTICS
-//#define TTD_SNAP_READER TextFormatReader
-//#define TTD_SNAP_WRITER TextFormatWriter
-//#else
-//#define TTD_SNAP_READER BinaryFormatReader
-//#define TTD_SNAP_WRITER BinaryFormatWriter
-//#endif
+#else
+#define TTD_LOG_READER BinaryFormatReader
+#define TTD_LOG_WRITER BinaryFormatWriter
+#define TTD_SNAP_READER BinaryFormatReader
+#define TTD_SNAP_WRITER BinaryFormatWriter
+#endif
 
 #if ENABLE_TTD_INTERNAL_DIAGNOSTICS
 #define ENABLE_SNAPSHOT_COMPARE 1
@@ -207,6 +207,7 @@ PHASE(All)
                 PHASE(IncrementalBailout)
             PHASE(DeadStore)
                 PHASE(ReverseCopyProp)
+                PHASE(DeadStoreTempObject)
                 PHASE(MarkTemp)
                     PHASE(MarkTempNumber)
                     PHASE(MarkTempObject)
@@ -235,6 +236,7 @@ PHASE(All)
                 PHASE(HoistMarkTempInit)
                 PHASE(HoistConstAddr)
             PHASE(JitWriteBarrier)
+                PHASE(JitWriteBarrierElision)
             PHASE(PreLowererPeeps)
             PHASE(CFGInJit)
             PHASE(TypedArray)
@@ -248,6 +250,7 @@ PHASE(All)
                 PHASE(OpHelperRegOpt)
                 PHASE(StackPack)
                 PHASE(SecondChance)
+                    PHASE(SecondChanceInTry)
                 PHASE(RegionUseCount)
                 PHASE(RegHoistLoads)
                 PHASE(ClearRegLoopExit)
@@ -294,6 +297,7 @@ PHASE(All)
                 PHASE(BackgroundRescan)
                 PHASE(BackgroundRepeatMark)
                 PHASE(BackgroundFinishMark)
+                PHASE(IncrementalMark)
             PHASE(ConcurrentPartialCollect)
             PHASE(ParallelMark)
             PHASE(PartialCollect)
@@ -324,6 +328,8 @@ PHASE(All)
         PHASE(InlineCache)
         PHASE(PolymorphicInlineCache)
         PHASE(MissingPropertyCache)
+        PHASE(ProxyTrapCache)
+        PHASE(JsrtPropertyCache)
         PHASE(PropertyCache) // Trace caching of property lookups using PropertyString and JavascriptSymbol
         PHASE(CloneCacheInCollision)
         PHASE(ConstructorCache)
@@ -339,6 +345,7 @@ PHASE(All)
             PHASE(ObjectHeaderInliningForEmptyObjects)
         PHASE(OptUnknownElementName)
         PHASE(TypePropertyCache)
+            PHASE(MegamorphicInlineCache)
 #if DBG_DUMP
         PHASE(InlineSlots)
 #endif
@@ -371,6 +378,8 @@ PHASE(All)
         PHASE(ExtendedExceptionInfoStackTrace)
         PHASE(ProjectionMetadata)
         PHASE(TypeHandlerTransition)
+        PHASE(DictionaryToPathType)
+        PHASE(TypeTransition)
         PHASE(Debugger)
             PHASE(ENC)
         PHASE(ConsoleScope)
@@ -436,6 +445,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_WasmMultiValue       (false)
 #define DEFAULT_CONFIG_WasmSignExtends      (true)
 #define DEFAULT_CONFIG_WasmNontrapping      (true)
+#define DEFAULT_CONFIG_WasmBulkMemory       (true)
 #define DEFAULT_CONFIG_WasmExperimental     (false)
 #define DEFAULT_CONFIG_BgParse              (false)
 #define DEFAULT_CONFIG_BgJitDelayFgBuffer   (0)
@@ -462,6 +472,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_ForceCleanPropertyOnCollect (false)
 #define DEFAULT_CONFIG_ForceCleanCacheOnCollect (false)
 #define DEFAULT_CONFIG_ForceGCAfterJSONParse (false)
+#define DEFAULT_CONFIG_LazyJSONParseMinLength (0)
 #define DEFAULT_CONFIG_ForceSerialized      (false)
 #define DEFAULT_CONFIG_ForceES5Array        (false)
 #define DEFAULT_CONFIG_ForceAsmJsLinkFail   (false)
@@ -496,6 +507,9 @@ PHASE(All)
 #define DEFAULT_CONFIG_RecursiveInlineDepthMax      (8)      // Maximum inline depth for recursive calls
 #define DEFAULT_CONFIG_RecursiveInlineDepthMin      (2)      // Minimum inline depth for recursive call
 #define DEFAULT_CONFIG_InlineInLoopBodyScaleDownFactor    (4)
+#define DEFAULT_CONFIG_InlineHotCallSiteFrequency   (2)  // Profiled calls at a call site per profiled call of the inliner for the site to be considered hot
+#define DEFAULT_CONFIG_InlineHotCallSiteScale       (25) // Percentage added to the inline threshold of a hot call site for each multiple of InlineHotCallSiteFrequency
+#define DEFAULT_CONFIG_InlineHotCallSiteMaxScale    (200) // Maximum percentage of the inline threshold a hot call site can be given
 #define DEFAULT_CONFIG_PropertyCacheMissPenalty (10)
 #define DEFAULT_CONFIG_PropertyCacheMissThreshold (-100)
 #define DEFAULT_CONFIG_PropertyCacheMissReset (-5000)
@@ -562,6 +576,8 @@ PHASE(All)
 #define DEFAULT_CONFIG_RegexBytecodeDebug   (false)
 #define DEFAULT_CONFIG_RegexOptimize        (true)
 #define DEFAULT_CONFIG_DynamicRegexMruListSize (16)
+#define DEFAULT_CONFIG_RegexLinear          (false)
+#define DEFAULT_CONFIG_RegexBacktrackLimit  (100000)
 #define DEFAULT_CONFIG_GoptCleanupThreshold  (25)
 #define DEFAULT_CONFIG_AsmGoptCleanupThreshold  (500)
 #define DEFAULT_CONFIG_OptimizeForManyInstances (false)
@@ -680,6 +696,7 @@ PHASE(All)
 
 #define DEFAULT_CONFIG_MinTemplatizedJitRunCount      (100)     // Minimum number of times a function needs to be interpreted before it is jitted
 #define DEFAULT_CONFIG_MinAsmJsInterpreterRunCount      (10)     // Minimum number of times a function needs to be Asm interpreted before it is jitted
+#define DEFAULT_CONFIG_MinWasmInterpreterRunCount      (2)     // Minimum number of times a wasm function needs to be interpreted before it is jitted
 #define DEFAULT_CONFIG_MinTemplatizedJitLoopRunCount      (500)     // Minimum number of times a function needs to be interpreted before it is jitted
 #define DEFAULT_CONFIG_MaxTemplatizedJitRunCount      (-1)     // Maximum number of times a function can be TJ before it is jitted
 #define DEFAULT_CONFIG_MaxAsmJsInterpreterRunCount      (-1)     // Maximum number of times a function can be Asm interpreted before it is jitted
@@ -728,6 +745,8 @@ PHASE(All)
 #define DEFAULT_CONFIG_Sse                  (-1)
 
 #define DEFAULT_CONFIG_DeletedPropertyReuseThreshold (32)
+#define DEFAULT_CONFIG_DictionaryToPathTypeThreshold (16)
+#define DEFAULT_CONFIG_TypeTransitionStatsCount (10)
 #define DEFAULT_CONFIG_BigDictionaryTypeHandlerThreshold (0xffff)
 #define DEFAULT_CONFIG_ForceStringKeyedSimpleDictionaryTypeHandler (false)
 #define DEFAULT_CONFIG_TypeSnapshotEnumeration (true)
@@ -786,6 +805,12 @@ PHASE(All)
 #endif
 
 #define DEFAULT_CONFIG_RecyclerForceMarkInterior (false)
+#define DEFAULT_CONFIG_MaxParallelMarkThreads    (16)
+#define DEFAULT_CONFIG_RecyclerIncrementalMark   (2)
+#define DEFAULT_CONFIG_RecyclerNurserySize       (4)
+#define DEFAULT_CONFIG_RecyclerPauseBudget       (0)
+#define DEFAULT_CONFIG_RecyclerGCCpuShare        (10)
+#define DEFAULT_CONFIG_RecyclerReuseDenseBlocksFirst (false)
 
 #define DEFAULT_CONFIG_MemProtectHeap (false)
 
@@ -949,6 +974,7 @@ FLAGNR(Boolean, WasmThreads           , "Enable WebAssembly threads feature", DE
 FLAGNR(Boolean, WasmMultiValue        , "Use new WebAssembly multi-value", DEFAULT_CONFIG_WasmMultiValue)
 FLAGNR(Boolean, WasmSignExtends       , "Use new WebAssembly sign extension operators", DEFAULT_CONFIG_WasmSignExtends)
 FLAGNR(Boolean, WasmNontrapping, "Enable non-trapping float-to-int conversions in WebAssembly", DEFAULT_CONFIG_WasmNontrapping)
+FLAGNR(Boolean, WasmBulkMemory        , "Enable WebAssembly bulk memory copy and fill operators", DEFAULT_CONFIG_WasmBulkMemory)
 
 // WebAssembly Experimental Features
 // Master WasmExperimental flag to activate WebAssembly experimental features
@@ -1183,6 +1209,7 @@ FLAGNR(Boolean, StrongArraySort       , "Add secondary comparisons to the defaul
 FLAGNR(Boolean, ForceCleanPropertyOnCollect, "Force cleaning of property on collection", DEFAULT_CONFIG_ForceCleanPropertyOnCollect)
 FLAGNR(Boolean, ForceCleanCacheOnCollect, "Force cleaning of dynamic caches on collection", DEFAULT_CONFIG_ForceCleanCacheOnCollect)
 FLAGNR(Boolean, ForceGCAfterJSONParse, "Force GC to happen after JSON parsing", DEFAULT_CONFIG_ForceGCAfterJSONParse)
+FLAGR (Number,  LazyJSONParseMinLength, "JSON.parse of text at least this long (without a reviver) only builds objects when they are first used (default: 0, never)", DEFAULT_CONFIG_LazyJSONParseMinLength)
 FLAGNR(Boolean, ForceDecommitOnCollect, "Force decommit collect", DEFAULT_CONFIG_ForceDecommitOnCollect)
 FLAGNR(Boolean, ForceDeferParse       , "Defer parsing of all function bodies", DEFAULT_CONFIG_ForceDeferParse)
 FLAGNR(Boolean, ForceDiagnosticsMode  , "Enable diagnostics mode and debug interpreter loop", false)
@@ -1247,6 +1274,9 @@ FLAGNR(Boolean, HighPrecisionDate, "Enable sub-millisecond resolution in Javascr
 FLAGNR(Number,  InlineCountMax        , "Maximum count in bytecodes to inline in a given function", DEFAULT_CONFIG_InlineCountMax)
 FLAGNRA(Number, InlineCountMaxInLoopBodies, icminlb, "Maximum count in bytecodes to inline in a given function", DEFAULT_CONFIG_InlineCountMaxInLoopBodies)
 FLAGNRA(Number, InlineInLoopBodyScaleDownFactor, iilbsdf, "Maximum depth of a recursive inline call", DEFAULT_CONFIG_InlineInLoopBodyScaleDownFactor)
+FLAGNR(Number,  InlineHotCallSiteFrequency, "Profiled calls at a call site per profiled call of the inliner before the inline threshold for the site is raised", DEFAULT_CONFIG_InlineHotCallSiteFrequency)
+FLAGNR(Number,  InlineHotCallSiteScale, "Percentage the inline threshold of a call site is raised by for each multiple of InlineHotCallSiteFrequency", DEFAULT_CONFIG_InlineHotCallSiteScale)
+FLAGNR(Number,  InlineHotCallSiteMaxScale, "Maximum percentage of the inline threshold given to a hot call site", DEFAULT_CONFIG_InlineHotCallSiteMaxScale)
 FLAGNR(Number,  InlineThreshold       , "Maximum size in bytecodes of an inline candidate", DEFAULT_CONFIG_InlineThreshold)
 FLAGNR(Number,  AggressiveInlineCountMax, "Maximum count in bytecodes to inline in a given function", DEFAULT_CONFIG_AggressiveInlineCountMax)
 FLAGNR(Number,  AggressiveInlineThreshold, "Maximum size in bytecodes of an inline candidate for aggressive inlining", DEFAULT_CONFIG_AggressiveInlineThreshold)
@@ -1323,6 +1353,7 @@ FLAGNR(Number,  CopyOnAccessArraySegmentCacheSize, "Size of copy-on-access array
 
 FLAGNR(Number, MinTemplatizedJitRunCount, "Minimum number of times a function must be Templatized Jitted", DEFAULT_CONFIG_MinTemplatizedJitRunCount)
 FLAGNR(Number, MinAsmJsInterpreterRunCount, "Minimum number of times a function must be Asm Interpreted", DEFAULT_CONFIG_MinAsmJsInterpreterRunCount)
+FLAGNR(Number, MinWasmInterpreterRunCount, "Minimum number of times a wasm function must be interpreted", DEFAULT_CONFIG_MinWasmInterpreterRunCount)
 
 FLAGNR(Number, MinTemplatizedJitLoopRunCount, "Minimum LoopCount run of the Templatized Jit function to run FullJited", DEFAULT_CONFIG_MinTemplatizedJitLoopRunCount)
 FLAGNRA(Number, MaxTemplatizedJitRunCount, Mtjrc, "Maximum number of times a function must be templatized jit", DEFAULT_CONFIG_MaxTemplatizedJitRunCount)
@@ -1440,9 +1471,17 @@ FLAGNR(Boolean, RecyclerTrackStress, "Stress tracked object handling by simulati
 FLAGNR(Boolean, RecyclerInduceFalsePositives, "Stress recycler by forcing false positive object marks", false)
 #endif // RECYCLER_STRESS
 FLAGNR(Boolean, RecyclerForceMarkInterior, "Force all the mark as interior", DEFAULT_CONFIG_RecyclerForceMarkInterior)
+FLAGR (Boolean, RecyclerReuseDenseBlocksFirst, "After a sweep, allocate from the fullest small heap blocks first so that sparse blocks can empty out and be released", DEFAULT_CONFIG_RecyclerReuseDenseBlocksFirst)
+FLAGR (Number,  RecyclerPauseBudget, "Target GC pause in milliseconds; adapts when and how to collect to it and -RecyclerGCCpuShare (default: 0, fixed heuristics)", DEFAULT_CONFIG_RecyclerPauseBudget)
+FLAGR (Number,  RecyclerGCCpuShare, "Percent of the script thread's time GC may take with -RecyclerPauseBudget (default: 10)", DEFAULT_CONFIG_RecyclerGCCpuShare)
+#if ENABLE_PARTIAL_GC
+FLAGR (Number,  RecyclerNurserySize, "Minimum megabytes of new pages allocated before a partial collect of the young objects (default: 4)", DEFAULT_CONFIG_RecyclerNurserySize)
+#endif
 #if ENABLE_CONCURRENT_GC
 FLAGNR(Number,  RecyclerPriorityBoostTimeout, "Adjust priority boost timeout", 5000)
 FLAGNR(Number,  RecyclerThreadCollectTimeout, "Adjust thread collect timeout", 1000)
+FLAGR (Number,  MaxParallelMarkThreads, "Max number of threads marking in parallel, including the collecting thread (default: one per processor, up to 16)", DEFAULT_CONFIG_MaxParallelMarkThreads)
+FLAGR (Number,  RecyclerIncrementalMark, "On a single processor, mark on the script thread in slices of this many milliseconds, from allocation, instead of on the background thread (default: 2, 0 disables)", DEFAULT_CONFIG_RecyclerIncrementalMark)
 FLAGRA(Boolean, EnableConcurrentSweepAlloc, ecsa, "Turns off the feature to allow allocations during concurrent sweep.", true)
 #endif
 #ifdef RECYCLER_PAGE_HEAP
@@ -1462,6 +1501,9 @@ FLAGNR(Number,  RecyclerVerifyPadSize  , "Padding size to verify recycler memory
 #endif
 FLAGNR(Boolean, RecyclerTest           , "Run recycler tests instead of executing script", false)
 FLAGNR(Boolean, RecyclerProtectPagesOnRescan, "Temporarily switch all pages to read only during rescan", false)
+FLAGR (Boolean, RecyclerHugePages     , "Advise the OS to back committed recycler pages with transparent huge pages (Linux only)", false)
+FLAGR (Boolean, RecyclerNumaAffinity  , "Bind the recycler background and parallel mark threads to the NUMA node of the script thread", false)
+FLAGR (Boolean, JitHugeCodePages      , "Advise the OS to back committed JIT code pages with transparent huge pages (Linux only)", false)
 #ifdef RECYCLER_VERIFY_MARK
 FLAGNR(Boolean, RecyclerVerifyMark    , "verify concurrent gc", false)
 #endif
@@ -1544,6 +1586,8 @@ FLAGR (Boolean, RegexBytecodeDebug    , "Display layout of UnifiedRegex bytecode
 FLAGR (Boolean, RegexOptimize         , "Optimize regular expressions in the unified Regex system (default: true)", DEFAULT_CONFIG_RegexOptimize)
 FLAGR (Number,  DynamicRegexMruListSize, "Size of the MRU list for dynamic regexes", DEFAULT_CONFIG_DynamicRegexMruListSize)
 #endif
+FLAGR (Boolean, RegexLinear           , "Match regular expressions without backreferences or lookarounds in linear time, never backtracking (default: false)", DEFAULT_CONFIG_RegexLinear)
+FLAGR (Number,  RegexBacktrackLimit   , "Number of backtracks after which a regular expression match switches to the linear-time matcher, if the pattern allows (0 = never)", DEFAULT_CONFIG_RegexBacktrackLimit)
 
 FLAGR (Boolean, OptimizeForManyInstances, "Optimize script engine for many instances (low memory footprint per engine, assume low spare CPU cycles) (default: false)", DEFAULT_CONFIG_OptimizeForManyInstances)
 FLAGNR(Boolean, EnableArrayTypeMutation, "Enable force array type mutation on re-entrant region", DEFAULT_CONFIG_EnableArrayTypeMutation)
@@ -1561,6 +1605,8 @@ FLAGR(Boolean, FailFastIfDisconnectedDelegate, "When set fail fast if disconnect
 #endif
 FLAGNR(Number, Sse, "Virtually disables SSE-based optimizations above the specified SSE level in the Chakra JIT (does not affect CRT SSE usage)", DEFAULT_CONFIG_Sse)
 FLAGNR(Number,  DeletedPropertyReuseThreshold, "Start reusing deleted property indexes after this many properties are deleted. Zero to disable reuse.", DEFAULT_CONFIG_DeletedPropertyReuseThreshold)
+FLAGNR(Number,  DictionaryToPathTypeThreshold, "Convert an object with an unshared SimpleDictionaryTypeHandler back to a PathTypeHandler after this many lookups, plus two per property, with no property added or deleted", DEFAULT_CONFIG_DictionaryToPathTypeThreshold)
+FLAGNR(Number,  TypeTransitionStatsCount, "Number of type transition trees, transition sites and polymorphic inline caches listed by -stats:TypeTransition", DEFAULT_CONFIG_TypeTransitionStatsCount)
 FLAGNR(Boolean, ForceStringKeyedSimpleDictionaryTypeHandler, "Force switch to string keyed version of SimpleDictionaryTypeHandler on first new property added to a SimpleDictionaryTypeHandler", DEFAULT_CONFIG_ForceStringKeyedSimpleDictionaryTypeHandler)
 FLAGNR(Number,  BigDictionaryTypeHandlerThreshold, "Min Slot Capacity required to convert DictionaryTypeHandler to BigDictionaryTypeHandler.(Advisable to give more than 15 - to avoid false positive cases)", DEFAULT_CONFIG_BigDictionaryTypeHandlerThreshold)
 FLAGNR(Boolean, TypeSnapshotEnumeration, "Create a true snapshot of the type of an object before enumeration and enumerate only those properties.", DEFAULT_CONFIG_TypeSnapshotEnumeration)
@@ -787,6 +787,7 @@ namespace Js
                 if (MaxAsmJsInterpreterRunCount >= 0)
                 {
                     MinAsmJsInterpreterRunCount = MaxAsmJsInterpreterRunCount;
+                    MinWasmInterpreterRunCount = MaxAsmJsInterpreterRunCount;
                 }
             }
 
@@ -4,6 +4,8 @@
 //-------------------------------------------------------------------------------------------------------
 #pragma once
 
+#include "Core/UsdtTrace.h"
+
 #ifdef ENABLE_JS_ETW
 #define PAIR(a,b) a ## b
 
@@ -35,7 +37,8 @@
 #define EDGE_ETW_INTERNAL(s) s
 #else  // !NTBUILD
 #define GCETW(e, args)                          \
-    PAIR(EventWriteJSCRIPT_ ## e, args);
+    PAIR(EventWriteJSCRIPT_ ## e, args);        \
+    CHAKRA_USDT_GC(e, args);
 
 #define IS_GCETW_Enabled(e)  EventEnabledJSCRIPT_##e()
 
@@ -100,7 +103,7 @@ class EtwTraceCore
 #endif // ENABLE_JS_LTTNG
 
 #else
-#define GCETW(e, ...)
+#define GCETW(e, args) CHAKRA_USDT_GC(e, args)
 #define IS_GCETW_Enabled(e)  false
 #define JS_ETW(s)
 #define IS_JS_ETW(s) (false)
@@ -175,6 +175,7 @@ namespace Js
 #define FAULTINJECT_SCRIPT_TERMINATION \
     if((this->threadContextFlags & ThreadContextFlagCanDisableExecution) != 0){ \
         if( Js::FaultInjection::Global.ShouldInjectFault(Js::FaultInjection::Global.ScriptTermination)){ \
+            this->isExecutionDisabled = true; \
             this->stackLimitForCurrentThread = Js::Constants::StackLimitForScriptInterrupt; \
         }\
     }
@@ -0,0 +1,44 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// User-level statically defined tracing (USDT) probes, for tracing the engine
+// with SystemTap, perf or bpftrace on Linux (build.sh --usdt).
+//
+// All of the probes are in the 'chakra' provider and are named after the ETW
+// event they mirror, so that e.g. GC_MARK_START fires wherever
+// GCETW(GC_MARK_START, ...) does. A probe site that isn't being traced is a
+// single nop, and none of them need an ETW session or an LTTng build.
+//
+// The probes that aren't ETW events, and their arguments, are:
+//
+//   GC_START(recycler, phase, reason, flags)         a collection begins
+//   GC_STOP(recycler, phase, reason, flags)          a collection ends
+//   FUNCTION_JIT_START(functionNumber, displayName, displayNameLength,
+//                      isLoopBody, jitMode)          a JIT job begins
+//   FUNCTION_JIT_STOP(functionNumber, displayName, displayNameLength,
+//                     isLoopBody, codeSize)          a JIT job ends
+//   PARSE_START(scriptContext, parseType, length)    a script, or a deferred
+//                                                    function, is parsed
+//   PARSE_STOP(scriptContext, parseType, hr)         the parse ends
+//   PARSE_FUNC(scriptContext, functionId, undefer)   a function body is parsed
+//
+// Display names are char16 strings of displayNameLength code units, which
+// are not null terminated.
+
+#ifdef ENABLE_JS_USDT
+#include <sys/sdt.h>
+
+#define CHAKRA_USDT(name, ...) STAP_PROBEV(chakra, name, __VA_ARGS__)
+
+// GCETW style parenthesized argument lists
+#define CHAKRA_USDT_UNPAREN(...) __VA_ARGS__
+#define CHAKRA_USDT_APPLY(m, args) m args
+#define CHAKRA_USDT_GC(e, args) \
+    CHAKRA_USDT_APPLY(STAP_PROBEV, (chakra, e, CHAKRA_USDT_UNPAREN args))
+#else
+#define CHAKRA_USDT(name, ...)
+#define CHAKRA_USDT_GC(e, args)
+#endif
@@ -0,0 +1,391 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#pragma once
+namespace JsUtil
+{
+    // Stable, run adaptive merge sort (a simplified TimSort).
+    //
+    // Ascending and strictly descending runs already present in the input are detected and kept,
+    // short runs are extended with binary insertion sort, and pending runs are merged so that
+    // their lengths stay balanced. Sorted or reverse sorted input takes n - 1 comparisons.
+    //
+    // Elements are only moved with plain assignments so types that need a write barrier can be
+    // sorted. The comparer may reenter script: it is called with pointers into 'base', 'temp' or a
+    // local copy of one element, so callers sorting GC pointers must allocate 'temp' from the recycler.
+    // If the comparer throws, 'base' is left holding a permutation of the original elements.
+    template <class T, class Comparer>
+    class MergeSort
+    {
+    public:
+        // Number of elements the caller has to provide in the 'temp' buffer for Sort
+        static size_t GetTempCount(size_t nmemb)
+        {
+            return nmemb < MinMerge ? 0 : nmemb / 2;
+        }
+
+        static void Sort(T* base, size_t nmemb, T* temp, const Comparer& comparer, void* context)
+        {
+            if (!base || nmemb < 2)
+            {
+                return;
+            }
+
+            if (nmemb < MinMerge)
+            {
+                size_t runLength = CountRunAndMakeAscending(base, nmemb, comparer, context);
+                BinaryInsertionSort(base, nmemb, runLength, comparer, context);
+                return;
+            }
+
+            Assert(temp != nullptr);
+
+            MergeState state = { base, temp, comparer, context, 0 };
+            const size_t minRun = GetMinRunLength(nmemb);
+            size_t low = 0;
+            size_t remaining = nmemb;
+            do
+            {
+                size_t runLength = CountRunAndMakeAscending(base + low, remaining, comparer, context);
+                if (runLength < minRun)
+                {
+                    // Extend the run to min(minRun, remaining) elements
+                    size_t forced = remaining < minRun ? remaining : minRun;
+                    BinaryInsertionSort(base + low, forced, runLength, comparer, context);
+                    runLength = forced;
+                }
+
+                state.PushRun(low, runLength);
+                state.MergeCollapse();
+
+                low += runLength;
+                remaining -= runLength;
+            } while (remaining != 0);
+
+            state.MergeForceCollapse();
+            Assert(state.runCount == 1 && state.runs[0].length == nmemb);
+        }
+
+    private:
+        static const size_t MinMerge = 32;
+
+        // Enough for any input that fits in memory, given the run length invariants maintained in MergeCollapse
+        static const size_t MaxPendingRuns = 85;
+
+        struct Run
+        {
+            size_t start;
+            size_t length;
+        };
+
+        // While merging, the elements of temp[temp, tempEnd) that are not merged yet are missing from
+        // the array. These copy them back on scope exit, so the array still holds every element if the
+        // comparer throws in the middle of a merge.
+        struct AutoFlushForward
+        {
+            T* dest;
+            T* temp;
+            T* tempEnd;
+
+            ~AutoFlushForward()
+            {
+                while (temp != tempEnd)
+                {
+                    *dest++ = *temp++;
+                }
+            }
+        };
+
+        struct AutoFlushBackward
+        {
+            T* dest;
+            T* temp;
+            T* tempEnd;
+
+            ~AutoFlushBackward()
+            {
+                while (tempEnd != temp)
+                {
+                    *--dest = *--tempEnd;
+                }
+            }
+        };
+
+        struct MergeState
+        {
+            T* base;
+            T* temp;
+            const Comparer& comparer;
+            void* context;
+            size_t runCount;
+            Run runs[MaxPendingRuns];
+
+            void PushRun(size_t start, size_t length)
+            {
+                AssertOrFailFast(runCount < MaxPendingRuns);
+                runs[runCount].start = start;
+                runs[runCount].length = length;
+                runCount++;
+            }
+
+            // Merge pending runs until, for the three topmost runs A, B, C:
+            //     A.length > B.length + C.length and B.length > C.length
+            void MergeCollapse()
+            {
+                while (runCount > 1)
+                {
+                    size_t n = runCount - 2;
+                    if ((n > 0 && runs[n - 1].length <= runs[n].length + runs[n + 1].length) ||
+                        (n > 1 && runs[n - 2].length <= runs[n - 1].length + runs[n].length))
+                    {
+                        if (runs[n - 1].length < runs[n + 1].length)
+                        {
+                            n--;
+                        }
+                    }
+                    else if (runs[n].length > runs[n + 1].length)
+                    {
+                        break;
+                    }
+                    MergeAt(n);
+                }
+            }
+
+            void MergeForceCollapse()
+            {
+                while (runCount > 1)
+                {
+                    size_t n = runCount - 2;
+                    if (n > 0 && runs[n - 1].length < runs[n + 1].length)
+                    {
+                        n--;
+                    }
+                    MergeAt(n);
+                }
+            }
+
+            // Merge runs n and n + 1
+            void MergeAt(size_t n)
+            {
+                Assert(n + 2 == runCount || n + 3 == runCount);
+
+                T* left = base + runs[n].start;
+                size_t leftLength = runs[n].length;
+                T* right = base + runs[n + 1].start;
+                size_t rightLength = runs[n + 1].length;
+                Assert(left + leftLength == right);
+
+                runs[n].length = leftLength + rightLength;
+                if (n + 3 == runCount)
+                {
+                    runs[n + 1] = runs[n + 2];
+                }
+                runCount--;
+
+                // Elements at the start of the left run that are not greater than the first element
+                // of the right run are already in place.
+                size_t skip = UpperBound(right, left, leftLength, comparer, context);
+                left += skip;
+                leftLength -= skip;
+                if (leftLength == 0)
+                {
+                    return;
+                }
+
+                // So are elements at the end of the right run not less than the last element of the left run.
+                rightLength = LowerBound(left + leftLength - 1, right, rightLength, comparer, context);
+                if (rightLength == 0)
+                {
+                    return;
+                }
+
+                if (leftLength <= rightLength)
+                {
+                    MergeLow(left, leftLength, right, rightLength);
+                }
+                else
+                {
+                    MergeHigh(left, leftLength, right, rightLength);
+                }
+            }
+
+            // Copy the left run out and merge front to back
+            void MergeLow(T* left, size_t leftLength, T* right, size_t rightLength)
+            {
+                for (size_t i = 0; i < leftLength; i++)
+                {
+                    temp[i] = left[i];
+                }
+
+                // Whatever is left of the right run is already in place
+                AutoFlushForward flush = { left, temp, temp + leftLength };
+                size_t j = 0;
+                while (flush.temp != flush.tempEnd && j < rightLength)
+                {
+                    // Take from the left run on ties to keep the sort stable
+                    if (comparer(context, right + j, flush.temp) < 0)
+                    {
+                        *flush.dest++ = right[j++];
+                    }
+                    else
+                    {
+                        *flush.dest++ = *flush.temp++;
+                    }
+                }
+            }
+
+            // Copy the right run out and merge back to front
+            void MergeHigh(T* left, size_t leftLength, T* right, size_t rightLength)
+            {
+                for (size_t j = 0; j < rightLength; j++)
+                {
+                    temp[j] = right[j];
+                }
+
+                // Whatever is left of the left run is already in place
+                AutoFlushBackward flush = { right + rightLength, temp, temp + rightLength };
+                size_t i = leftLength;
+                while (i > 0 && flush.tempEnd != flush.temp)
+                {
+                    // Take from the right run on ties to keep the sort stable
+                    if (comparer(context, flush.tempEnd - 1, left + i - 1) < 0)
+                    {
+                        *--flush.dest = left[--i];
+                    }
+                    else
+                    {
+                        *--flush.dest = *--flush.tempEnd;
+                    }
+                }
+            }
+        };
+
+        // Pick a minimum run length in [MinMerge / 2, MinMerge] so that nmemb / minRun is a power of
+        // two or slightly less than one, which keeps the final merges balanced.
+        static size_t GetMinRunLength(size_t nmemb)
+        {
+            size_t r = 0;
+            while (nmemb >= MinMerge)
+            {
+                r |= nmemb & 1;
+                nmemb >>= 1;
+            }
+            return nmemb + r;
+        }
+
+        // Returns the length of the run at the start of 'base', reversing it if it is strictly descending
+        static size_t CountRunAndMakeAscending(T* base, size_t nmemb, const Comparer& comparer, void* context)
+        {
+            Assert(nmemb > 0);
+            size_t runEnd = 1;
+            if (runEnd == nmemb)
+            {
+                return 1;
+            }
+
+            if (comparer(context, base + runEnd, base) < 0)
+            {
+                runEnd++;
+                while (runEnd < nmemb && comparer(context, base + runEnd, base + runEnd - 1) < 0)
+                {
+                    runEnd++;
+                }
+
+                for (size_t low = 0, high = runEnd - 1; low < high; low++, high--)
+                {
+                    T swap = base[low];
+                    base[low] = base[high];
+                    base[high] = swap;
+                }
+            }
+            else
+            {
+                runEnd++;
+                while (runEnd < nmemb && comparer(context, base + runEnd, base + runEnd - 1) >= 0)
+                {
+                    runEnd++;
+                }
+            }
+
+            return runEnd;
+        }
+
+        // Sort base[0, nmemb) given that base[0, sortedLength) is already sorted
+        static void BinaryInsertionSort(T* base, size_t nmemb, size_t sortedLength, const Comparer& comparer, void* context)
+        {
+            Assert(sortedLength > 0);
+            for (size_t i = sortedLength; i < nmemb; i++)
+            {
+                if (comparer(context, base + i, base + i - 1) >= 0)
+                {
+                    continue;
+                }
+
+                // Find the left-most element greater than base[i]
+                size_t first = 0;
+                size_t last = i - 1;
+                while (first < last)
+                {
+                    size_t middle = first + (last - first) / 2;
+                    if (comparer(context, base + i, base + middle) < 0)
+                    {
+                        last = middle;
+                    }
+                    else
+                    {
+                        first = middle + 1;
+                    }
+                }
+
+                T value = base[i];
+                for (size_t j = i; j > first; j--)
+                {
+                    base[j] = base[j - 1];
+                }
+                base[first] = value;
+            }
+        }
+
+        // Index of the first element of 'base' greater than *key
+        static size_t UpperBound(T* key, T* base, size_t nmemb, const Comparer& comparer, void* context)
+        {
+            size_t first = 0;
+            size_t last = nmemb;
+            while (first < last)
+            {
+                size_t middle = first + (last - first) / 2;
+                if (comparer(context, key, base + middle) < 0)
+                {
+                    last = middle;
+                }
+                else
+                {
+                    first = middle + 1;
+                }
+            }
+            return first;
+        }
+
+        // Index of the first element of 'base' not less than *key
+        static size_t LowerBound(T* key, T* base, size_t nmemb, const Comparer& comparer, void* context)
+        {
+            size_t first = 0;
+            size_t last = nmemb;
+            while (first < last)
+            {
+                size_t middle = first + (last - first) / 2;
+                if (comparer(context, base + middle, key) < 0)
+                {
+                    first = middle + 1;
+                }
+                else
+                {
+                    last = middle;
+                }
+            }
+            return first;
+        }
+    };
+}
@@ -26,6 +26,11 @@ class PageStack
 
     uint Split(uint targetCount, __in_ecount(targetCount) PageStack<T> ** targetStacks);
 
+    // Move whole chunks between stacks so parallel markers can share work. Neither stack may be in use
+    // by another thread.
+    bool GiveSpareChunk(PageStack<T> * targetStack);
+    bool TakeChunk(PageStack<T> * sourceStack);
+
     void Abort();
     void Release();
 
@@ -44,11 +49,12 @@ class PageStack
     }
 #endif
 
-    static const uint MaxSplitTargets = 3;     // Not counting original stack, so this supports 4-way parallel
+    static const uint MaxSplitTargets = 15;    // Not counting original stack, so this supports 16-way parallel
 
 private:
     Chunk * CreateChunk();
     void FreeChunk(Chunk * chunk);
+    void AddFullChunk(Chunk * chunk);
 
 private:
     T * nextEntry;
@@ -356,6 +362,96 @@ uint PageStack<T>::Split(uint targetCount, __in_ecount(targetCount) PageStack<T>
 }
 
 
+template <typename T>
+bool PageStack<T>::GiveSpareChunk(PageStack<T> * targetStack)
+{
+    // Only chunks behind the current one are given away; they are always full, and the
+    // entries being worked on stay where they are.
+    if (currentChunk == nullptr || currentChunk->nextChunk == nullptr)
+    {
+        return false;
+    }
+
+    Chunk * chunk = currentChunk->nextChunk;
+    currentChunk->nextChunk = chunk->nextChunk;
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    this->pageCount--;
+#endif
+#if DBG
+    this->count -= EntriesPerChunk;
+#endif
+
+    targetStack->AddFullChunk(chunk);
+    return true;
+}
+
+
+template <typename T>
+bool PageStack<T>::TakeChunk(PageStack<T> * sourceStack)
+{
+    // The source stack is only ever filled with GiveSpareChunk, so all its chunks are full,
+    // including the current one.
+    Chunk * chunk = sourceStack->currentChunk;
+    if (chunk == nullptr)
+    {
+        return false;
+    }
+
+    if (chunk->nextChunk != nullptr)
+    {
+        Chunk * current = chunk;
+        chunk = current->nextChunk;
+        current->nextChunk = chunk->nextChunk;
+    }
+    else
+    {
+        Assert(sourceStack->nextEntry == sourceStack->chunkEnd);
+        sourceStack->currentChunk = nullptr;
+        sourceStack->nextEntry = nullptr;
+        sourceStack->chunkStart = nullptr;
+        sourceStack->chunkEnd = nullptr;
+    }
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    sourceStack->pageCount--;
+#endif
+#if DBG
+    sourceStack->count -= EntriesPerChunk;
+#endif
+
+    this->AddFullChunk(chunk);
+    return true;
+}
+
+
+template <typename T>
+void PageStack<T>::AddFullChunk(Chunk * chunk)
+{
+    if (currentChunk == nullptr)
+    {
+        chunk->nextChunk = nullptr;
+        currentChunk = chunk;
+        chunkStart = chunk->entries;
+        chunkEnd = &chunk->entries[EntriesPerChunk];
+        nextEntry = chunkEnd;
+    }
+    else
+    {
+        // Keep the current chunk, which may be partially filled, on top
+        chunk->nextChunk = currentChunk->nextChunk;
+        currentChunk->nextChunk = chunk;
+    }
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    this->pageCount++;
+#endif
+#if DBG
+    this->count += EntriesPerChunk;
+#endif
+}
+
+
 template <typename T>
 void PageStack<T>::Abort()
 {
@@ -36,6 +36,26 @@ struct AllocatorDecommitStats
     {}
 };
 
+// Pages handed to arena allocators and the cache of released arena pages, see PageAllocatorBase::AllocArenaPagesForBytes
+struct AllocatorArenaPageStats
+{
+    size_t arenaPageCount;
+    size_t maxArenaPageCount;
+    size_t cachedPageCount;
+    size_t maxCachedPageCount;
+    int64 numCacheHits;
+    int64 numCacheMisses;
+
+    AllocatorArenaPageStats() :
+        arenaPageCount(0),
+        maxArenaPageCount(0),
+        cachedPageCount(0),
+        maxCachedPageCount(0),
+        numCacheHits(0),
+        numCacheMisses(0)
+    {}
+};
+
 struct AllocatorSizes
 {
     size_t usedBytes;
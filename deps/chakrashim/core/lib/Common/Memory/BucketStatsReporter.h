@@ -29,22 +29,24 @@ template<> char16 DumpBlockTypeName<SmallAllocationBlockAttributes>::name[] = _u
 template<> char16 DumpBlockTypeName<MediumAllocationBlockAttributes>::name[] = _u("(M)");
 #endif  // DUMP_FRAGMENTATION_STATS
 
+// This header is included by more than one translation unit, so the codes are
+// in-class constants rather than out-of-line static member definitions.
 template <ObjectInfoBits TBucketType>
-struct EtwBucketTypeEnum { static uint16 code; };
-template<> uint16 EtwBucketTypeEnum<NoBit>::code = 0;
-template<> uint16 EtwBucketTypeEnum<LeafBit>::code = 1;
-template<> uint16 EtwBucketTypeEnum<FinalizeBit>::code = 2;
+struct EtwBucketTypeEnum;
+template<> struct EtwBucketTypeEnum<NoBit> { static const uint16 code = 0; };
+template<> struct EtwBucketTypeEnum<LeafBit> { static const uint16 code = 1; };
+template<> struct EtwBucketTypeEnum<FinalizeBit> { static const uint16 code = 2; };
 #ifdef RECYCLER_WRITE_BARRIER
-template<> uint16 EtwBucketTypeEnum<WithBarrierBit>::code = 3;
-template<> uint16 EtwBucketTypeEnum<FinalizableWithBarrierBit>::code = 4;
+template<> struct EtwBucketTypeEnum<WithBarrierBit> { static const uint16 code = 3; };
+template<> struct EtwBucketTypeEnum<FinalizableWithBarrierBit> { static const uint16 code = 4; };
 #endif
 #ifdef RECYCLER_VISITED_HOST
-template<> uint16 EtwBucketTypeEnum<RecyclerVisitedHostBit>::code = 5;
+template<> struct EtwBucketTypeEnum<RecyclerVisitedHostBit> { static const uint16 code = 5; };
 #endif
 template <typename TBlockType>
-struct EtwBlockTypeEnum { static uint16 code; };
-template<> uint16 EtwBlockTypeEnum<SmallAllocationBlockAttributes>::code = 0;
-template<> uint16 EtwBlockTypeEnum<MediumAllocationBlockAttributes>::code = 1;
+struct EtwBlockTypeEnum;
+template<> struct EtwBlockTypeEnum<SmallAllocationBlockAttributes> { static const uint16 code = 0; };
+template<> struct EtwBlockTypeEnum<MediumAllocationBlockAttributes> { static const uint16 code = 1; };
 
 class BucketStatsReporter
 {
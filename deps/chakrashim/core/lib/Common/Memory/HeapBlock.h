@@ -515,6 +515,7 @@ class SmallHeapBlockT : public HeapBlock
     friend class SmallHeapBlockAllocator;
     friend class HeapInfo;
     friend class RecyclerSweep;
+    friend class Recycler;  // Needed for ForEachAllocatedObject during heap walks
 
     template <typename TBlockType>
     friend class SmallNormalHeapBucketBase;
@@ -963,6 +964,52 @@ class HeapBlockList
         return tail;
     }
 
+    // Stable merge sort, returns the new head of the list
+    template <typename TBlockType, typename Fn>
+    static TBlockType * Sort(TBlockType * list, Fn lessThan)
+    {
+        if (list == nullptr || list->GetNextBlock() == nullptr)
+        {
+            return list;
+        }
+
+        // Split the list in half
+        TBlockType * middle = list;
+        TBlockType * end = list->GetNextBlock();
+        while (end != nullptr && end->GetNextBlock() != nullptr)
+        {
+            middle = middle->GetNextBlock();
+            end = end->GetNextBlock()->GetNextBlock();
+        }
+        TBlockType * first = list;
+        TBlockType * second = middle->GetNextBlock();
+        middle->SetNextBlock(nullptr);
+
+        first = HeapBlockList::Sort(first, lessThan);
+        second = HeapBlockList::Sort(second, lessThan);
+
+        TBlockType * head = nullptr;
+        TBlockType * tail = nullptr;
+        while (first != nullptr && second != nullptr)
+        {
+            TBlockType *& next = lessThan(second, first) ? second : first;
+            TBlockType * heapBlock = next;
+            next = heapBlock->GetNextBlock();
+
+            if (tail == nullptr)
+            {
+                head = heapBlock;
+            }
+            else
+            {
+                tail->SetNextBlock(heapBlock);
+            }
+            tail = heapBlock;
+        }
+        tail->SetNextBlock(first != nullptr ? first : second);
+        return head;
+    }
+
 #if DBG
     template <typename TBlockType>
     static bool Contains(TBlockType * block, TBlockType * list, TBlockType * tail = nullptr)
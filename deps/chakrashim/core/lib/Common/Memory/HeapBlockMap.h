@@ -76,6 +76,10 @@ class HeapBlockMap32
 
     bool OOMRescan(Recycler * recycler);
 
+    // Visits each heap block once, even if it spans several pages
+    template <class Fn>
+    void ForEachHeapBlock(Fn fn);
+
 #ifdef RECYCLER_STRESS
     void InduceFalsePositives(Recycler * recycler);
 #endif
@@ -269,6 +273,9 @@ class HeapBlockMap64
 
     void Cleanup(bool concurrentFindImplicitRoot);
 
+    template <class Fn>
+    void ForEachHeapBlock(Fn fn);
+
 #ifdef RECYCLER_STRESS
     void InduceFalsePositives(Recycler * recycler);
 #endif
@@ -461,6 +461,37 @@ HeapBlockMap32::MarkInterior(void * candidate, MarkContext * markContext)
     }
 }
 
+template <class Fn>
+inline
+void
+HeapBlockMap32::ForEachHeapBlock(Fn fn)
+{
+    for (uint id1 = 0; id1 < L1Count; id1++)
+    {
+        L2MapChunk * chunk = map[id1];
+        if (chunk == nullptr)
+        {
+            continue;
+        }
+
+        for (uint id2 = 0; id2 < L2Count; id2++)
+        {
+            HeapBlock * heapBlock = chunk->map[id2];
+            if (heapBlock == nullptr)
+            {
+                continue;
+            }
+
+            // Multi-page blocks are mapped on each of their pages; only report them from the first one
+            char * blockAddress = heapBlock->GetAddress();
+            if (GetLevel1Id(blockAddress) == id1 && GetLevel2Id(blockAddress) == id2)
+            {
+                fn(heapBlock);
+            }
+        }
+    }
+}
+
 #if defined(TARGET_64)
 
 //
@@ -524,4 +555,15 @@ HeapBlockMap64::MarkInterior(void * candidate, MarkContext * markContext)
     // No Node found; must be an invalid reference. Do nothing.
 }
 
+template <class Fn>
+inline
+void
+HeapBlockMap64::ForEachHeapBlock(Fn fn)
+{
+    for (Node * node = list; node != nullptr; node = node->next)
+    {
+        node->map.ForEachHeapBlock(fn);
+    }
+}
+
 #endif // defined(TARGET_64)
@@ -1420,6 +1420,17 @@ HeapBucketT<TBlockType>::StartAllocationAfterSweep()
 {
     Assert(this->IsAllocationStopped());
     this->isAllocationStopped = false;
+
+    if (this->GetRecycler()->GetRecyclerFlagsTable().RecyclerReuseDenseBlocksFirst)
+    {
+        // Fill up the fullest blocks first. The sparse ones are allocated from last, so they are
+        // more likely to become empty and get their pages released on the next sweep.
+        this->heapBlockList = HeapBlockList::Sort(this->heapBlockList, [](TBlockType * heapBlock, TBlockType * otherHeapBlock)
+        {
+            return heapBlock->freeCount < otherHeapBlock->freeCount;
+        });
+    }
+
     this->nextAllocableBlockHead = this->heapBlockList;
 }
 
@@ -9,6 +9,23 @@
 
 namespace Memory
 {
+    // Coarse grouping of heap blocks reported to hosts, see Recycler::GetHeapSpaceStats
+    enum HeapSpaceKind
+    {
+        HeapSpaceSmallNormal,
+        HeapSpaceSmallLeaf,
+        HeapSpaceSmallFinalizable,
+        HeapSpaceMedium,
+        HeapSpaceLarge,
+        HeapSpaceCount
+    };
+
+    struct HeapSpaceStats
+    {
+        size_t usedBytes;
+        size_t committedBytes;
+    };
+
 #if ENABLE_MEM_STATS
     struct MemStats
     {
@@ -1056,10 +1056,10 @@ HeapInfo::Sweep(RecyclerSweep& recyclerSweep, bool concurrent)
     // CONCURRENT-TODO: Allow this in the background as well
     for (uint i = 0; i < HeapConstants::MediumBucketCount; i++)
     {
-        mediumHeapBuckets[i].Sweep(recyclerSweep);
+        mediumHeapBuckets[i].Sweep(recyclerSweep, false);
     }
 #endif
-    largeObjectBucket.Sweep(recyclerSweep);
+    largeObjectBucket.Sweep(recyclerSweep, concurrent);
 
     RECYCLER_PROFILE_EXEC_END(recyclerSweep.GetRecycler(), Js::SweepLargePhase);
 
@@ -1527,6 +1527,14 @@ HeapInfo::DisposeObjects()
 #endif
 
         largeObjectBucket.DisposeObjects();
+
+        if (recycler->IsDisposeDeadlinePassed())
+        {
+            // The buckets stopped at the deadline. The blocks stay in the pending dispose lists,
+            // so the next dispose picks up from where this one left and does the transfer.
+            recycler->hasDisposableObject = true;
+            return;
+        }
     }
     // Calling dispose may enter the GC again and dispose more objects, loop until we don't have any more
     while (recycler->hasDisposableObject);
@@ -190,6 +190,10 @@ IdleDecommitPageAllocator::DecommitNow(bool all)
 {
     SuspendIdleDecommit();
 
+    // The cached arena pages are only touched by the owning thread, give them back here rather
+    // than in the timed decommit on the recycler thread
+    FlushArenaPageCache();
+
     // If we are in non-idle-decommit mode, then always decommit all.
     // Otherwise, we will end up with some un-decommitted pages and get confused later.
     if (maxFreePageCount == maxNonIdleDecommitFreePageCount)
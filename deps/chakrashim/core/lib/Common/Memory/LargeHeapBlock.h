@@ -216,9 +216,7 @@ class LargeHeapBlock sealed : public HeapBlock
 #endif
 private:
     friend class LargeHeapBucket;
-#ifdef RECYCLER_MEMORY_VERIFY
     friend class Recycler;
-#endif
 
     LargeHeapBlock(__in char * address, DECLSPEC_GUARD_OVERFLOW size_t pageCount, Segment * segment, DECLSPEC_GUARD_OVERFLOW uint objectCount, LargeHeapBucket* bucket);
     static LargeObjectHeader * GetHeaderFromAddress(void * address);
@@ -583,10 +583,11 @@ LargeHeapBucket::ScanNewImplicitRoots(Recycler * recycler)
 #pragma region Sweep
 
 void
-LargeHeapBucket::Sweep(RecyclerSweep& recyclerSweep)
+LargeHeapBucket::Sweep(RecyclerSweep& recyclerSweep, bool concurrent)
 {
 #if ENABLE_CONCURRENT_GC
-    // CONCURRENT-TODO: large buckets are not swept in the background currently.
+    // Blocks are always classified in thread; with a concurrent sweep, the ones without
+    // finalizable objects are queued and have their dead objects swept in the background.
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     Assert(!recyclerSweep.GetRecycler()->IsConcurrentExecutingState() && !recyclerSweep.GetRecycler()->IsConcurrentSweepState());
 #else
@@ -620,24 +621,28 @@ LargeHeapBucket::Sweep(RecyclerSweep& recyclerSweep)
 #if ENABLE_CONCURRENT_GC
     Assert(this->pendingSweepLargeBlockList == nullptr);
 #endif
-    SweepLargeHeapBlockList(recyclerSweep, currentLargeObjectBlocks);
+    SweepLargeHeapBlockList(recyclerSweep, currentLargeObjectBlocks, concurrent);
 #ifdef RECYCLER_PAGE_HEAP
-    SweepLargeHeapBlockList(recyclerSweep, currentLargePageHeapObjectBlocks);
+    SweepLargeHeapBlockList(recyclerSweep, currentLargePageHeapObjectBlocks, concurrent);
 #endif
-    SweepLargeHeapBlockList(recyclerSweep, currentFullLargeObjectBlocks);
-    SweepLargeHeapBlockList(recyclerSweep, currentDisposeLargeBlockList);
+    SweepLargeHeapBlockList(recyclerSweep, currentFullLargeObjectBlocks, concurrent);
+    SweepLargeHeapBlockList(recyclerSweep, currentDisposeLargeBlockList, concurrent);
 }
 
 void
-LargeHeapBucket::SweepLargeHeapBlockList(RecyclerSweep& recyclerSweep, LargeHeapBlock * heapBlockList)
+LargeHeapBucket::SweepLargeHeapBlockList(RecyclerSweep& recyclerSweep, LargeHeapBlock * heapBlockList, bool concurrent)
 {
     Recycler * recycler = recyclerSweep.GetRecycler();
-    HeapBlockList::ForEachEditing(heapBlockList, [this, &recyclerSweep, recycler](LargeHeapBlock * heapBlock)
+    HeapBlockList::ForEachEditing(heapBlockList, [this, &recyclerSweep, recycler, concurrent](LargeHeapBlock * heapBlock)
     {
         this->UnregisterFreeList(heapBlock->GetFreeList());
 
-        // CONCURRENT-TODO: Allow large block to be sweep in the background
-        SweepState state = heapBlock->Sweep(recyclerSweep, false);
+        bool queuePendingSweep = concurrent;
+#ifdef RECYCLER_PAGE_HEAP
+        // Page heap blocks are never swept concurrently
+        queuePendingSweep = queuePendingSweep && !heapBlock->InPageHeapMode();
+#endif
+        SweepState state = heapBlock->Sweep(recyclerSweep, queuePendingSweep);
 
         // If the block is already in the pending dispose list (re-entrant GC scenario), do nothing, leave it there
         if (heapBlock->IsInPendingDisposeList()) return;
@@ -816,32 +821,16 @@ void
 LargeHeapBucket::SweepPendingObjects(RecyclerSweep& recyclerSweep)
 {
 #if ENABLE_CONCURRENT_GC
-    if (recyclerSweep.IsBackground())
-    {
-        Recycler * recycler = recyclerSweep.GetRecycler();
-#if ENABLE_PARTIAL_GC
-        if (recycler->inPartialCollectMode)
-        {
-            HeapBlockList::ForEach(this->pendingSweepLargeBlockList, [recycler](LargeHeapBlock * heapBlock)
-            {
-                // Page heap blocks are never swept concurrently
-                heapBlock->SweepObjects<SweepMode_ConcurrentPartial>(recycler);
-            });
-        }
-        else
-#endif
-        {
-            HeapBlockList::ForEach(this->pendingSweepLargeBlockList, [recycler](LargeHeapBlock * heapBlock)
-            {
-                // Page heap blocks are never swept concurrently
-                heapBlock->SweepObjects<SweepMode_Concurrent>(recycler);
-            });
-        }
-    }
-    else
+    // This runs on the background thread, or in thread if the background sweep was forced to the foreground.
+    // The queued blocks have no finalizable objects, so their dead objects are freed right away even in a
+    // partial collect: holding freed large objects until the partial collect finishes would keep the pages
+    // of big buffers alive for no benefit, and the in thread sweep doesn't do that for large blocks either.
+    Recycler * recycler = recyclerSweep.GetRecycler();
+    HeapBlockList::ForEach(this->pendingSweepLargeBlockList, [recycler](LargeHeapBlock * heapBlock)
     {
-        Assert(this->pendingSweepLargeBlockList == nullptr);
-    }
+        // Page heap blocks are never swept concurrently
+        heapBlock->SweepObjects<SweepMode_Concurrent>(recycler);
+    });
 #endif
 }
 
@@ -855,15 +844,8 @@ LargeHeapBucket::ConcurrentPartialTransferSweptObjects(RecyclerSweep& recyclerSw
 
     RECYCLER_SLOW_CHECK(this->VerifyLargeHeapBlockCount());
 
-    LargeHeapBlock * list = this->pendingSweepLargeBlockList;
-    this->pendingSweepLargeBlockList = nullptr;
-    HeapBlockList::ForEachEditing(list, [this](LargeHeapBlock * heapBlock)
-    {
-        // GC-REVIEW: We could maybe reuse the large objects
-        heapBlock->PartialTransferSweptObjects();
-        heapBlock->SetNextBlock(this->partialSweptLargeBlockList);
-        this->partialSweptLargeBlockList = heapBlock;
-    });
+    // SweepPendingObjects fully swept these blocks, they can be allocated from again
+    this->TransferPendingSweptBlocks();
 
     RECYCLER_SLOW_CHECK(this->VerifyLargeHeapBlockCount());
 }
@@ -898,6 +880,24 @@ LargeHeapBucket::FinishPartialCollect(RecyclerSweep * recyclerSweep)
 #endif
 
 #if ENABLE_CONCURRENT_GC
+void
+LargeHeapBucket::TransferPendingSweptBlocks()
+{
+    HeapBlockList::ForEachEditing(this->pendingSweepLargeBlockList, [this](LargeHeapBlock * heapBlock)
+    {
+        heapBlock->TransferSweptObjects();
+        if (this->supportFreeList)
+        {
+            ConstructFreelist(heapBlock);
+        }
+        else
+        {
+            ReinsertLargeHeapBlock(heapBlock);
+        }
+    });
+    this->pendingSweepLargeBlockList = nullptr;
+}
+
 void
 LargeHeapBucket::ConcurrentTransferSweptObjects(RecyclerSweep& recyclerSweep)
 {
@@ -906,12 +906,7 @@ LargeHeapBucket::ConcurrentTransferSweptObjects(RecyclerSweep& recyclerSweep)
 #endif
     Assert(!recyclerSweep.IsBackground());
 
-    HeapBlockList::ForEachEditing(this->pendingSweepLargeBlockList, [this](LargeHeapBlock * heapBlock)
-    {
-        heapBlock->TransferSweptObjects();
-        ReinsertLargeHeapBlock(heapBlock);
-    });
-    this->pendingSweepLargeBlockList = nullptr;
+    this->TransferPendingSweptBlocks();
 
 #if ENABLE_PARTIAL_GC
     // If we did a background finish partial collect, we have left the partialSweptLargeBlockList
@@ -972,10 +967,14 @@ void
 LargeHeapBucket::DisposeObjects()
 {
     Recycler * recycler = this->heapInfo->recycler;
-    HeapBlockList::ForEach(this->pendingDisposeLargeBlockList, [recycler](LargeHeapBlock * heapBlock)
+    for (LargeHeapBlock * heapBlock = this->pendingDisposeLargeBlockList; heapBlock != nullptr; heapBlock = heapBlock->GetNextBlock())
     {
+        if (recycler->IsDisposeDeadlinePassed())
+        {
+            break;
+        }
         heapBlock->DisposeObjects(recycler);
-    });
+    }
 }
 
 void
@@ -52,7 +52,7 @@ class LargeHeapBucket: public HeapBucket
     void ScanInitialImplicitRoots(Recycler * recycler);
     void ScanNewImplicitRoots(Recycler * recycler);
 
-    void Sweep(RecyclerSweep& recyclerSweep);
+    void Sweep(RecyclerSweep& recyclerSweep, bool concurrent);
     void ReinsertLargeHeapBlock(LargeHeapBlock * heapBlock);
 
     void RegisterFreeList(LargeHeapBlockFreeList* freeList);
@@ -107,7 +107,10 @@ class LargeHeapBucket: public HeapBucket
     template <class Fn> void ForEachLargeHeapBlock(Fn fn);
     template <class Fn> void ForEachEditingLargeHeapBlock(Fn fn);
     void Finalize(Recycler* recycler, LargeHeapBlock* heapBlock);
-    void SweepLargeHeapBlockList(RecyclerSweep& recyclerSweep, LargeHeapBlock * heapBlockList);
+    void SweepLargeHeapBlockList(RecyclerSweep& recyclerSweep, LargeHeapBlock * heapBlockList, bool concurrent);
+#if ENABLE_CONCURRENT_GC
+    void TransferPendingSweptBlocks();
+#endif
 
     void ConstructFreelist(LargeHeapBlock * heapBlock);
 
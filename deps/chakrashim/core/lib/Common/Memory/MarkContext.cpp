@@ -17,7 +17,8 @@ MarkContext::MarkContext(Recycler * recycler, PagePool * pagePool) :
 #ifdef RECYCLER_VISITED_HOST
     preciseStack(pagePool),
 #endif
-    trackStack(pagePool)
+    trackStack(pagePool),
+    workPool(nullptr)
 {
 }
 
@@ -133,4 +134,107 @@ void MarkContext::ProcessTracked()
 }
 
 
+ParallelMarkWorkPool::ParallelMarkWorkPool(PagePool * pagePool) :
+    markStack(pagePool),
+#ifdef RECYCLER_VISITED_HOST
+    preciseStack(pagePool),
+#endif
+    markerCount(0),
+    idleMarkerCount(0),
+    pooledChunkCount(0)
+{
+}
+
+void ParallelMarkWorkPool::Reset(uint markerCount)
+{
+    Assert(markStack.IsEmpty());
+#ifdef RECYCLER_VISITED_HOST
+    Assert(preciseStack.IsEmpty());
+#endif
+    Assert(this->pooledChunkCount == 0);
+
+    this->markerCount = markerCount;
+    this->idleMarkerCount = 0;
+}
+
+void ParallelMarkWorkPool::RemoveMarker()
+{
+    AutoCriticalSection autoCS(&cs);
+    Assert(this->markerCount > this->idleMarkerCount);
+    this->markerCount--;
+}
+
+void ParallelMarkWorkPool::GiveWork(MarkContext * markContext)
+{
+    AutoCriticalSection autoCS(&cs);
+
+    // Give one chunk per waiting context at most; they each take one at a time
+    while (this->idleMarkerCount > this->pooledChunkCount)
+    {
+        bool gaveChunk = markContext->markStack.GiveSpareChunk(&markStack);
+#ifdef RECYCLER_VISITED_HOST
+        if (!gaveChunk)
+        {
+            gaveChunk = markContext->preciseStack.GiveSpareChunk(&preciseStack);
+        }
+#endif
+        if (!gaveChunk)
+        {
+            break;
+        }
+
+        this->pooledChunkCount++;
+    }
+}
 
+bool ParallelMarkWorkPool::TakeWork(MarkContext * markContext)
+{
+    bool isCountedIdle = false;
+    uint spinCount = 0;
+
+    while (true)
+    {
+        {
+            AutoCriticalSection autoCS(&cs);
+
+            bool tookChunk = markContext->markStack.TakeChunk(&markStack);
+#ifdef RECYCLER_VISITED_HOST
+            if (!tookChunk)
+            {
+                tookChunk = markContext->preciseStack.TakeChunk(&preciseStack);
+            }
+#endif
+            if (tookChunk)
+            {
+                this->pooledChunkCount--;
+                if (isCountedIdle)
+                {
+                    this->idleMarkerCount--;
+                }
+                return true;
+            }
+
+            if (!isCountedIdle)
+            {
+                isCountedIdle = true;
+                this->idleMarkerCount++;
+            }
+
+            // No context has work left and none can produce more
+            if (this->idleMarkerCount == this->markerCount)
+            {
+                return false;
+            }
+        }
+
+        // Wait for a busy context to give up some work
+        if (++spinCount % 64 == 0)
+        {
+            SwitchToThread();
+        }
+        else
+        {
+            YieldProcessor();
+        }
+    }
+}
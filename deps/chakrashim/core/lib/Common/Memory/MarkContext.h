@@ -14,8 +14,12 @@ typedef JsUtil::SynchronizedDictionary<void *, void *, NoCheckHeapAllocator, Pri
 enum class RecyclerScanMemoryType { General, Stack };
 #endif
 
+class ParallelMarkWorkPool;
+
 class MarkContext
 {
+    friend class ParallelMarkWorkPool;
+
 private:
     struct MarkCandidate
     {
@@ -55,6 +59,8 @@ class MarkContext
 
     template <bool parallel, bool interior>
     void ProcessMark();
+    template <bool interior>
+    bool ProcessMarkSlice(uint objectCount);
 
     void MarkTrackedObject(FinalizableObject * obj);
     void ProcessTracked();
@@ -125,9 +131,18 @@ class MarkContext
     }
 #endif
 
+    // While set, parallel marking shares work with the other contexts using the same pool
+    void SetWorkPool(ParallelMarkWorkPool * workPool) { this->workPool = workPool; }
+
 private:
+    template <bool parallel, bool interior>
+    void ProcessMarkStacks(uint * scanCount);
+    template <bool parallel>
+    void ShareWork(uint * scanCount);
+
     Recycler * recycler;
     PagePool * pagePool;
+    ParallelMarkWorkPool * workPool;
     PageStack<MarkCandidate> markStack;
 #ifdef RECYCLER_VISITED_HOST
     PageStack<IRecyclerVisitedObject*> preciseStack;
@@ -146,5 +161,37 @@ class MarkContext
 #endif
 };
 
+// Work shared between the mark contexts of a parallel mark. A context with spare chunks on its
+// stacks gives them to the pool while another context is out of work, and a context that runs
+// out of work waits for them here. Marking is done once every context is out of work at the
+// same time.
+class ParallelMarkWorkPool
+{
+public:
+    // Number of objects a context scans between checks for contexts out of work
+    static const uint ShareWorkInterval = 256;
+
+    ParallelMarkWorkPool(PagePool * pagePool);
+
+    // Called before any of the [markerCount] contexts starts marking
+    void Reset(uint markerCount);
+    // One of the contexts counted in Reset won't be marking after all
+    void RemoveMarker();
+
+    bool NeedsWork() const { return this->idleMarkerCount > this->pooledChunkCount; }
+    void GiveWork(MarkContext * markContext);
+    bool TakeWork(MarkContext * markContext);
+
+private:
+    CriticalSection cs;
+    PageStack<MarkContext::MarkCandidate> markStack;
+#ifdef RECYCLER_VISITED_HOST
+    PageStack<IRecyclerVisitedObject*> preciseStack;
+#endif
+    uint markerCount;
+    uint volatile idleMarkerCount;
+    uint volatile pooledChunkCount;
+};
+
 
 }
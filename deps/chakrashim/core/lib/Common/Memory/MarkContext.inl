@@ -215,6 +215,17 @@ void MarkContext::MarkTrackedObject(FinalizableObject * trackedObject)
     END_NO_EXCEPTION
 }
 
+template <bool parallel>
+inline
+void MarkContext::ShareWork(uint * scanCount)
+{
+    if (parallel && ++(*scanCount) % ParallelMarkWorkPool::ShareWorkInterval == 0 &&
+        this->workPool != nullptr && this->workPool->NeedsWork())
+    {
+        this->workPool->GiveWork(this);
+    }
+}
+
 template <bool parallel, bool interior>
 inline
 void MarkContext::ProcessMark()
@@ -230,6 +241,55 @@ void MarkContext::ProcessMark()
     }
 #endif
 
+    uint scanCount = 0;
+
+    // When marking in parallel with a work pool, keep taking the work other contexts give up
+    // until all of them are out of work.
+    do
+    {
+        ProcessMarkStacks<parallel, interior>(&scanCount);
+    }
+    while (parallel && this->workPool != nullptr && this->workPool->TakeWork(this));
+}
+
+// Scan at most objectCount objects off the mark stacks, for incremental marking on the script thread.
+// Returns true once both stacks are empty.
+template <bool interior>
+inline
+bool MarkContext::ProcessMarkSlice(uint objectCount)
+{
+    if (!markStack.IsEmpty())
+    {
+        MarkCandidate current;
+        while (objectCount != 0 && markStack.Pop(&current))
+        {
+            ScanObject<false, interior>(current.obj, current.byteCount);
+            objectCount--;
+        }
+    }
+
+#ifdef RECYCLER_VISITED_HOST
+    if (objectCount != 0 && !preciseStack.IsEmpty())
+    {
+        MarkContextWrapper<false> markContextWrapper(this);
+        IRecyclerVisitedObject* tracedObject;
+        while (objectCount != 0 && preciseStack.Pop(&tracedObject))
+        {
+            tracedObject->Trace(&markContextWrapper);
+            objectCount--;
+        }
+    }
+
+    return markStack.IsEmpty() && preciseStack.IsEmpty();
+#else
+    return markStack.IsEmpty();
+#endif
+}
+
+template <bool parallel, bool interior>
+inline
+void MarkContext::ProcessMarkStacks(uint * scanCount)
+{
 #ifdef RECYCLER_VISITED_HOST
     // Flip between processing the generic mark stack (conservatively traced with ScanMemory) and
     // the precise stack (precisely traced via IRecyclerVisitedObject::Trace). Each of those
@@ -259,6 +319,8 @@ void MarkContext::ProcessMark()
                     _mm_prefetch((char *)*(next.obj), _MM_HINT_T0);
 
                     current = next;
+
+                    ShareWork<parallel>(scanCount);
                 }
 
                 // The stack is empty, but we still have a previously retrieved entry; process it now.
@@ -275,6 +337,8 @@ void MarkContext::ProcessMark()
             while (markStack.Pop(&current))
             {
                 ScanObject<parallel, interior>(current.obj, current.byteCount);
+
+                ShareWork<parallel>(scanCount);
             }
 #endif
         }
@@ -289,6 +353,8 @@ void MarkContext::ProcessMark()
             while (preciseStack.Pop(&tracedObject))
             {
                 tracedObject->Trace(&markContextWrapper);
+
+                ShareWork<parallel>(scanCount);
             }
         }
 
@@ -4,6 +4,10 @@
 //-------------------------------------------------------------------------------------------------------
 #include "CommonMemoryPch.h"
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 #define UpdateMinimum(dst, src) if (dst > src) { dst = src; }
 
 #if ENABLE_OOP_NATIVE_CODEGEN
@@ -157,6 +161,11 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
         this->address = this->address + (leadingGuardPageCount*AutoSystemInfo::PageSize);
     }
 
+    if (committed)
+    {
+        GetAllocator()->AdviseHugePages(this->address, this->segmentPageCount);
+    }
+
     if (!GetAllocator()->CreateSecondaryAllocator(this, committed, &this->secondaryAllocator))
     {
         GetAllocator()->GetVirtualAllocator()->Free(originalAddress,
@@ -444,6 +453,7 @@ PageSegmentBase<TVirtualAlloc>::AllocDecommitPages(uint pageCount, T freePages,
             if (ret != nullptr)
             {
                 Assert(ret == pages);
+                this->GetAllocator()->AdviseHugePages(pages, pageCount);
 
                 this->ClearRangeInFreePagesBitVector(index, pageCount);
                 this->ClearRangeInDecommitPagesBitVector(index, pageCount);
@@ -663,6 +673,24 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::GetMaxAllocPageCount()
     return maxAllocPageCount;
 }
 
+// Ask the OS to back the newly committed range with transparent huge pages. This is only advice: the kernel ignores it
+// if THP is disabled, only backs the 2MB aligned parts of the mapping, and splits a huge page again when part of it is
+// decommitted. Committing remaps the range, so this has to be redone after every commit.
+// For code pages the advice leaves the protection alone: HeapPageAllocator::ProtectPages still flips pages between
+// RW and RX, which splits a huge page while it is being written; once the range is uniformly RX again the kernel can
+// collapse it back.
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+void
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::AdviseHugePages(__in void * address, size_t pageCount)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (this->adviseHugePages)
+    {
+        madvise(address, pageCount * AutoSystemInfo::PageSize, MADV_HUGEPAGE);
+    }
+#endif
+}
+
 template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
 PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::PageAllocatorBase(AllocationPolicyManager * policyManager,
     Js::ConfigFlagsTable& flagTable,
@@ -708,6 +736,7 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::PageAllocatorBase(Allo
     , numberOfSegments(0)
     , processHandle(processHandle)
     , enableWriteBarrier(enableWriteBarrier)
+    , adviseHugePages((type == PageAllocatorType_Recycler && flagTable.RecyclerHugePages) || (type == PageAllocatorType_CustomHeap && flagTable.JitHugeCodePages))
 #ifdef ENABLE_BASIC_TELEMETRY
     ,decommitStats(nullptr)
 #endif
@@ -716,6 +745,11 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::PageAllocatorBase(Allo
 
     this->maxAllocPageCount = maxAllocPageCount;
 
+    for (uint i = 0; i < ArenaPageCacheSizeClassCount; i++)
+    {
+        this->arenaPageCache[i] = nullptr;
+    }
+
 #if DBG
     // By default, a page allocator is not associated with any thread context
     // Any host which wishes to associate it with a thread context must do so explicitly
@@ -1532,6 +1566,99 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::ReleaseAllocationNoSus
     this->Release((char *)allocation, allocation->pageCount, allocation->segment);
 }
 
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+PageAllocation *
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::AllocArenaPagesForBytes(size_t requestBytes)
+{
+    Assert(!isClosed);
+    ASSERT_THREAD();
+
+    uint pageSize = AutoSystemInfo::PageSize;
+    uint addSize = sizeof(PageAllocation) + pageSize - 1;   // this shouldn't overflow
+    size_t allocSize = AllocSizeMath::Add(requestBytes, addSize);
+    if (allocSize == (size_t)-1)
+    {
+        return nullptr;
+    }
+
+    size_t pages = allocSize / pageSize;
+    PageAllocation * allocation = nullptr;
+    if (pages <= ArenaPageCacheSizeClassCount)
+    {
+        SuspendIdleDecommit();
+        allocation = this->arenaPageCache[pages - 1];
+        if (allocation != nullptr)
+        {
+            this->arenaPageCache[pages - 1] = *(PageAllocation **)allocation->GetAddress();
+            this->arenaPageStats.cachedPageCount -= pages;
+            this->arenaPageStats.numCacheHits++;
+        }
+        ResumeIdleDecommit();
+    }
+
+    if (allocation == nullptr)
+    {
+        this->arenaPageStats.numCacheMisses++;
+        allocation = this->AllocAllocation(pages);
+        if (allocation == nullptr)
+        {
+            return nullptr;
+        }
+    }
+
+    this->arenaPageStats.arenaPageCount += allocation->pageCount;
+    if (this->arenaPageStats.arenaPageCount > this->arenaPageStats.maxArenaPageCount)
+    {
+        this->arenaPageStats.maxArenaPageCount = this->arenaPageStats.arenaPageCount;
+    }
+    return allocation;
+}
+
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+void
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::ReleaseArenaAllocationNoSuspend(PageAllocation * allocation)
+{
+    size_t pageCount = allocation->pageCount;
+    Assert(this->arenaPageStats.arenaPageCount >= pageCount);
+    this->arenaPageStats.arenaPageCount -= pageCount;
+
+    bool canCache = pageCount <= ArenaPageCacheSizeClassCount
+        && this->arenaPageStats.cachedPageCount + pageCount <= ArenaPageCacheMaxPageCount;
+#if defined(RECYCLER_NO_PAGE_REUSE) || defined(ARENA_MEMORY_VERIFY)
+    canCache = canCache && !this->disablePageReuse;
+#endif
+    if (!canCache)
+    {
+        this->ReleaseAllocationNoSuspend(allocation);
+        return;
+    }
+
+    *(PageAllocation **)allocation->GetAddress() = this->arenaPageCache[pageCount - 1];
+    this->arenaPageCache[pageCount - 1] = allocation;
+    this->arenaPageStats.cachedPageCount += pageCount;
+    if (this->arenaPageStats.cachedPageCount > this->arenaPageStats.maxCachedPageCount)
+    {
+        this->arenaPageStats.maxCachedPageCount = this->arenaPageStats.cachedPageCount;
+    }
+}
+
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+void
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::FlushArenaPageCache()
+{
+    for (uint i = 0; i < ArenaPageCacheSizeClassCount; i++)
+    {
+        while (this->arenaPageCache[i] != nullptr)
+        {
+            PageAllocation * allocation = this->arenaPageCache[i];
+            this->arenaPageCache[i] = *(PageAllocation **)allocation->GetAddress();
+            this->arenaPageStats.cachedPageCount -= allocation->pageCount;
+            this->ReleaseAllocationNoSuspend(allocation);
+        }
+    }
+    Assert(this->arenaPageStats.cachedPageCount == 0);
+}
+
 template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
 void
 PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::Release(void * address, size_t pageCount, void * segmentParam)
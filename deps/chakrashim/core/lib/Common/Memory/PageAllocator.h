@@ -668,6 +668,7 @@ class PageAllocatorBase: public PageAllocatorBaseCommon
     AllocationPolicyManager * GetAllocationPolicyManager() const { return policyManager; }
 
     uint GetMaxAllocPageCount();
+    void AdviseHugePages(__in void * address, size_t pageCount);
 
     //VirtualAllocator APIs
     TVirtualAlloc * GetVirtualAllocator() const;
@@ -678,6 +679,14 @@ class PageAllocatorBase: public PageAllocatorBaseCommon
     void ReleaseAllocation(PageAllocation * allocation);
     void ReleaseAllocationNoSuspend(PageAllocation * allocation);
 
+    // Arena blocks are taken from, and released to, a small cache of allocations segregated by
+    // page count, so that the arenas of consecutive parser and JIT work items on a thread reuse
+    // the same pages without going through the segment lists. The cached pages are not zeroed.
+    PageAllocation * AllocArenaPagesForBytes(DECLSPEC_GUARD_OVERFLOW size_t requestedBytes);
+    void ReleaseArenaAllocationNoSuspend(PageAllocation * allocation);
+    void FlushArenaPageCache();
+    const AllocatorArenaPageStats& GetArenaPageStats() const { return this->arenaPageStats; }
+
     char * Alloc(size_t * pageCount, TSegment ** segment);
 
     void Release(void * address, size_t pageCount, void * segment);
@@ -842,6 +851,7 @@ class PageAllocatorBase: public PageAllocatorBaseCommon
     bool disableAllocationOutOfMemory;
     bool excludeGuardPages;
     bool enableWriteBarrier;
+    bool adviseHugePages;
     AllocationPolicyManager * policyManager;
 
     Js::ConfigFlagsTable& pageAllocatorFlagTable;
@@ -892,6 +902,12 @@ class PageAllocatorBase: public PageAllocatorBaseCommon
     bool disablePageReuse;
 #endif
 
+    // Arena page cache, one list per page count, linked through the first word of the allocation
+    static const uint ArenaPageCacheSizeClassCount = 8;
+    static const uint ArenaPageCacheMaxPageCount = 32;
+    PageAllocation * arenaPageCache[ArenaPageCacheSizeClassCount];
+    AllocatorArenaPageStats arenaPageStats;
+
     friend TSegment;
     friend TPageSegment;
     friend class IdleDecommit;
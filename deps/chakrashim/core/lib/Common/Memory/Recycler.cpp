@@ -117,13 +117,9 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #endif
     threadService(nullptr),
     markPagePool(configFlagsTable),
-    parallelMarkPagePool1(configFlagsTable),
-    parallelMarkPagePool2(configFlagsTable),
-    parallelMarkPagePool3(configFlagsTable),
     markContext(this, &this->markPagePool),
-    parallelMarkContext1(this, &this->parallelMarkPagePool1),
-    parallelMarkContext2(this, &this->parallelMarkPagePool2),
-    parallelMarkContext3(this, &this->parallelMarkPagePool3),
+    parallelMarkContextCount(0),
+    parallelMarkWorkPool(&this->markPagePool),
 #if ENABLE_PARTIAL_GC
     clientTrackedObjectAllocator(_u("CTO-List"), pageAllocator, Js::Throw::OutOfMemory),
 #endif
@@ -133,6 +129,16 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #endif
     externalRootMarker(NULL),
     externalRootMarkerContext(NULL),
+    externalRootScanner(NULL),
+    externalRootScannerContext(NULL),
+    allocationSampleInterval(0),
+    bytesUntilAllocationSample(SIZE_MAX),
+    allocationSampleCallback(nullptr),
+    allocationSampleFreeCallback(nullptr),
+    allocationSampleContext(nullptr),
+    allocationSamples(nullptr),
+    nextAllocationSampleId(1),
+    isInAllocationSampleCallback(false),
     recyclerSweepManager(nullptr),
     inEndMarkOnLowMemory(false),
     enableScanInteriorPointers(CUSTOM_CONFIG_FLAG(configFlagsTable, RecyclerForceMarkInterior)),
@@ -148,14 +154,14 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     enableConcurrentMark(false),  // Default to non-concurrent
     enableParallelMark(false),
     enableConcurrentSweep(false),
+    enableIncrementalMark(false),
+    inIncrementalMark(false),
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     allowAllocationsDuringConcurrentSweepForCollection(false),
 #endif
     concurrentThread(NULL),
     concurrentWorkReadyEvent(NULL),
     concurrentWorkDoneEvent(NULL),
-    parallelThread1(this, &Recycler::ParallelWorkFunc<0>),
-    parallelThread2(this, &Recycler::ParallelWorkFunc<1>),
     priorityBoost(false),
     isAborting(false),
 #if DBG
@@ -193,6 +199,8 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     hasDisposableObject(false),
     hasNativeGCHost(false),
     tickCountNextDispose(0),
+    hasDisposeDeadline(false),
+    disposeDeadlineTick(0),
     transientPinnedObject(nullptr),
     pinnedObjectMap(1024, HeapAllocator::GetNoMemProtectInstance()),
     weakReferenceMap(1024, HeapAllocator::GetNoMemProtectInstance()),
@@ -276,9 +284,17 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #ifdef RECYCLER_MARK_TRACK
     this->markMap = NoCheckHeapNew(MarkMap, &NoCheckHeapAllocator::Instance, 163, &markMapCriticalSection);
     markContext.SetMarkMap(markMap);
-    parallelMarkContext1.SetMarkMap(markMap);
-    parallelMarkContext2.SetMarkMap(markMap);
-    parallelMarkContext3.SetMarkMap(markMap);
+#endif
+
+    for (uint i = 0; i < _countof(parallelMarkContexts); i++)
+    {
+        parallelMarkContexts[i] = nullptr;
+    }
+#if ENABLE_CONCURRENT_GC
+    for (uint i = 0; i < _countof(parallelThreads); i++)
+    {
+        parallelThreads[i].Initialize(this, i);
+    }
 #endif
 
 #ifdef RECYCLER_MEMORY_VERIFY
@@ -342,9 +358,6 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     // recycler requires at least Recycler::PrimaryMarkStackReservedPageCount to function properly for the main mark context
     this->markContext.SetMaxPageCount(max(static_cast<size_t>(GetRecyclerFlagsTable().MaxMarkStackPageCount), static_cast<size_t>(Recycler::PrimaryMarkStackReservedPageCount)));
-    this->parallelMarkContext1.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
-    this->parallelMarkContext2.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
-    this->parallelMarkContext3.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
 
     if (GetRecyclerFlagsTable().IsEnabled(Js::GCMemoryThresholdFlag))
     {
@@ -473,6 +486,7 @@ Recycler::~Recycler()
 #endif
 
     ClearObjectBeforeCollectCallbacks();
+    SetAllocationSampling(0, nullptr, nullptr, nullptr);
 
 #ifdef RECYCLER_DUMP_OBJECT_GRAPH
     if (GetRecyclerFlagsTable().DumpObjectGraphOnExit)
@@ -516,9 +530,13 @@ Recycler::~Recycler()
     autoHeap.Close();
 
     markContext.Release();
-    parallelMarkContext1.Release();
-    parallelMarkContext2.Release();
-    parallelMarkContext3.Release();
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        parallelMarkContexts[i]->markContext.Release();
+        HeapDelete(parallelMarkContexts[i]);
+        parallelMarkContexts[i] = nullptr;
+    }
+    this->parallelMarkContextCount = 0;
 
     // Clean up the weak reference map so that
     // objects being finalized can safely refer to weak references
@@ -822,6 +840,7 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 #endif
 
     this->recyclerStress = GetRecyclerFlagsTable().RecyclerStress;
+    this->pauseBudgetHeuristic.Initialize(GetRecyclerFlagsTable());
 #if ENABLE_CONCURRENT_GC
     this->recyclerBackgroundStress = GetRecyclerFlagsTable().RecyclerBackgroundStress;
     this->recyclerConcurrentStress = GetRecyclerFlagsTable().RecyclerConcurrentStress;
@@ -837,7 +856,10 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 #if ENABLE_CONCURRENT_GC
     // Default to non-concurrent
     uint numProcs = (uint)AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
-    this->maxParallelism = (numProcs > 4) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? 4 : numProcs;
+    uint parallelismLimit = min((uint)max(GetRecyclerFlagsTable().MaxParallelMarkThreads, 1), Recycler::MaxParallelism);
+    this->maxParallelism = (numProcs > parallelismLimit) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? parallelismLimit : numProcs;
+    this->numaNode = PlatformAgnostic::Thread::InvalidNumaNode;
+    this->CreateParallelMarkContexts();
 
     if (forceInThread)
     {
@@ -967,9 +989,46 @@ Recycler::ClearNeedOOMRescan()
 {
     this->needOOMRescan = false;
     markContext.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-    parallelMarkContext1.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-    parallelMarkContext2.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-    parallelMarkContext3.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        parallelMarkContexts[i]->markContext.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+    }
+}
+
+bool
+Recycler::HasPendingMarkObjects() const
+{
+    if (markContext.HasPendingMarkObjects())
+    {
+        return true;
+    }
+
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        if (parallelMarkContexts[i]->markContext.HasPendingMarkObjects())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+Recycler::HasPendingTrackObjects() const
+{
+    if (markContext.HasPendingTrackObjects())
+    {
+        return true;
+    }
+
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        if (parallelMarkContexts[i]->markContext.HasPendingTrackObjects())
+        {
+            return true;
+        }
+    }
+    return false;
 }
 
 bool
@@ -1033,6 +1092,24 @@ Recycler::AddExternalMemoryUsage(size_t size)
     CollectNow<CollectOnAllocation>();
 }
 
+// Memory the host allocated for script objects, which the runtime neither owns nor frees. It counts
+// towards the next collection like AddExternalMemoryUsage, but isn't charged to the allocation policy,
+// which limits the memory of the runtime itself. Hosts may report it while the recycler calls back into
+// them, so only collect when that can't reenter an in-thread collection.
+void
+Recycler::AddExternalMemoryPressure(size_t size)
+{
+    this->autoHeap.uncollectedAllocBytes += size;
+    this->autoHeap.uncollectedExternalBytes += size;
+
+    if (this->IsInObjectBeforeCollectCallback() ||
+        (this->CollectionInProgress() && !this->IsConcurrentState()))
+    {
+        return;
+    }
+    CollectNow<CollectOnAllocation>();
+}
+
 bool Recycler::RequestExternalMemoryAllocation(size_t size)
 {
     AllocationPolicyManager * allocationPolicyManager = autoHeap.GetAllocationPolicyManager();
@@ -1057,6 +1134,27 @@ void Recycler::ReportExternalMemoryFree(size_t size)
     }
 }
 
+// Bytes the time heuristic lets build up before it collects. When the host has set an allocation policy
+// limit this shrinks with the remaining headroom, so a bounded heap collects more often as it nears the
+// limit instead of running into it.
+size_t Recycler::GetMaxUncollectedAllocBytes()
+{
+    size_t maxUncollectedAllocBytes = RecyclerHeuristic::Instance.MaxUncollectedAllocBytes;
+    AllocationPolicyManager * allocationPolicyManager = autoHeap.GetAllocationPolicyManager();
+    if (allocationPolicyManager)
+    {
+        size_t limit = allocationPolicyManager->GetLimit();
+        if (limit != (size_t)-1)
+        {
+            size_t usage = allocationPolicyManager->GetUsage();
+            size_t headroom = limit > usage ? limit - usage : 0;
+            maxUncollectedAllocBytes = min(maxUncollectedAllocBytes,
+                max(headroom / 4, (size_t)RecyclerHeuristic::UncollectedAllocBytesCollection()));
+        }
+    }
+    return maxUncollectedAllocBytes;
+}
+
 /*------------------------------------------------------------------------------------------------
  * Idle Decommit
  *------------------------------------------------------------------------------------------------*/
@@ -1946,6 +2044,14 @@ Recycler::FindRoots()
     }
     RECYCLER_PROFILE_EXEC_END(this, Js::FindRootArenaPhase);
 
+    if (externalRootScanner != NULL)
+    {
+        BEGIN_DUMP_OBJECT(this, _u("External Scanned Roots"));
+        RecyclerScanMemoryCallback scanMemoryCallback(this);
+        externalRootScanner(externalRootScannerContext, scanMemoryCallback);
+        END_DUMP_OBJECT(this);
+    }
+
     this->ScanImplicitRoots();
 
     RECYCLER_PROFILE_EXEC_END(this, Js::FindRootPhase);
@@ -2348,9 +2454,11 @@ Recycler::ResetMarkCollectionState()
 
     // If we aborted after doing a background parallel Mark, we wouldn't have cleaned up the
     // parallel markContexts yet. Clean these up now.
-    // Note parallelMarkContext1 is not used in background parallel (see DoBackgroundParallelMark)
-    parallelMarkContext2.Cleanup();
-    parallelMarkContext3.Cleanup();
+    // Note parallelMarkContexts[0] is not used in background parallel (see DoBackgroundParallelMark)
+    for (uint i = 1; i < this->parallelMarkContextCount; i++)
+    {
+        parallelMarkContexts[i]->markContext.Cleanup();
+    }
 
     this->ClearNeedOOMRescan();
     DebugOnly(this->isProcessingRescan = false);
@@ -2511,18 +2619,89 @@ Recycler::FinishMark(DWORD waitTime)
 }
 
 #if ENABLE_CONCURRENT_GC
+void
+Recycler::CreateParallelMarkContexts()
+{
+    Assert(this->parallelMarkContextCount == 0);
+
+    // The main context is split up to [this->maxParallelism] ways
+    while (this->parallelMarkContextCount < this->maxParallelism - 1)
+    {
+        ParallelMarkContext * parallelMarkContext = HeapNewNoThrow(ParallelMarkContext, this, this->recyclerFlagsTable);
+        if (parallelMarkContext == nullptr)
+        {
+            // Mark with as many threads as we have contexts for
+            this->maxParallelism = this->parallelMarkContextCount + 1;
+            break;
+        }
+
+#ifdef RECYCLER_MARK_TRACK
+        parallelMarkContext->markContext.SetMarkMap(this->markMap);
+#endif
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        parallelMarkContext->markContext.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
+#endif
+        this->parallelMarkContexts[this->parallelMarkContextCount++] = parallelMarkContext;
+    }
+}
+
+void
+Recycler::StartParallelMarkWorkSharing(MarkContext ** markContexts, uint count)
+{
+    // Contexts waiting for work spin until the other contexts are out of work too, which only works
+    // if they all run at the same time. Work handed to the host's thread service may be run one after
+    // another, so in that case each context only marks its own part of the split.
+    if (this->threadService->HasCallback())
+    {
+        return;
+    }
+
+    this->parallelMarkWorkPool.Reset(count);
+    for (uint i = 0; i < count; i++)
+    {
+        markContexts[i]->SetWorkPool(&this->parallelMarkWorkPool);
+    }
+}
+
+void
+Recycler::RemoveParallelMarker(MarkContext * markContext)
+{
+    // The thread that was going to mark this context couldn't be started. The context is marked
+    // in thread once the others are done, so they must not wait for it.
+    if (this->threadService->HasCallback())
+    {
+        return;
+    }
+
+    markContext->SetWorkPool(nullptr);
+    this->parallelMarkWorkPool.RemoveMarker();
+}
+
+void
+Recycler::StopParallelMarkWorkSharing(MarkContext ** markContexts, uint count)
+{
+    for (uint i = 0; i < count; i++)
+    {
+        markContexts[i]->SetWorkPool(nullptr);
+    }
+}
+
 void
 Recycler::DoParallelMark()
 {
     Assert(this->enableParallelMark);
-    Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+    Assert(this->maxParallelism > 1 && this->maxParallelism <= this->parallelMarkContextCount + 1);
 
     // Split the mark stack into [this->maxParallelism] equal pieces.
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
-    MarkContext * splitContexts[3] = { &parallelMarkContext1, &parallelMarkContext2, &parallelMarkContext3 };
+    MarkContext * splitContexts[MaxParallelism - 1];
+    for (uint i = 0; i < this->maxParallelism - 1; i++)
+    {
+        splitContexts[i] = &parallelMarkContexts[i]->markContext;
+    }
     uint actualSplitCount = markContext.Split(this->maxParallelism - 1, splitContexts);
 
-    Assert(actualSplitCount <= 3);
+    Assert(actualSplitCount <= this->maxParallelism - 1);
 
     // If we failed to split at all, just mark in thread with no parallelism.
     if (actualSplitCount == 0)
@@ -2540,24 +2719,44 @@ Recycler::DoParallelMark()
         StartQueueTrackedObject();
     }
 
+    // We mark the first split, the background thread marks the main context and
+    // parallel thread N marks split N + 1.
+    MarkContext * markerContexts[MaxParallelism];
+    markerContexts[0] = splitContexts[0];
+    markerContexts[1] = &markContext;
+    for (uint i = 1; i < actualSplitCount; i++)
+    {
+        markerContexts[i + 1] = splitContexts[i];
+    }
+    const uint markerCount = actualSplitCount + 1;
+    this->StartParallelMarkWorkSharing(markerContexts, markerCount);
+
     // Kick off marking on the background thread
     bool concurrentSuccess = StartConcurrent(CollectionStateParallelMark);
+    if (!concurrentSuccess)
+    {
+        this->RemoveParallelMarker(&markContext);
+    }
 
     // If there's enough work to split, then kick off marking on parallel threads too.
     // If the threads haven't been created yet, this will create them (or fail).
-    bool parallelSuccess1 = false;
-    bool parallelSuccess2 = false;
-    if (concurrentSuccess && actualSplitCount >= 2)
+    uint parallelThreadCount = actualSplitCount - 1;
+    uint startedThreadCount = 0;
+    if (concurrentSuccess)
     {
-        parallelSuccess1 = parallelThread1.StartConcurrent();
-        if (parallelSuccess1 && actualSplitCount == 3)
+        while (startedThreadCount < parallelThreadCount && parallelThreads[startedThreadCount].StartConcurrent())
         {
-            parallelSuccess2 = parallelThread2.StartConcurrent();
+            startedThreadCount++;
         }
     }
 
+    for (uint i = startedThreadCount; i < parallelThreadCount; i++)
+    {
+        this->RemoveParallelMarker(splitContexts[i + 1]);
+    }
+
     // Process our portion of the split.
-    this->ProcessParallelMark(false, &parallelMarkContext1);
+    this->ProcessParallelMark(false, splitContexts[0]);
 
     // If we successfully launched parallel work, wait for it to complete.
     // If we failed, then process the work in-thread now.
@@ -2570,30 +2769,20 @@ Recycler::DoParallelMark()
         this->ProcessParallelMark(false, &markContext);
     }
 
-    if (actualSplitCount >= 2)
+    for (uint i = 0; i < parallelThreadCount; i++)
     {
-        if (parallelSuccess1)
+        if (i < startedThreadCount)
         {
-            parallelThread1.WaitForConcurrent();
+            parallelThreads[i].WaitForConcurrent();
         }
         else
         {
-            this->ProcessParallelMark(false, &parallelMarkContext2);
-        }
-
-        if (actualSplitCount == 3)
-        {
-            if (parallelSuccess2)
-            {
-                parallelThread2.WaitForConcurrent();
-            }
-            else
-            {
-                this->ProcessParallelMark(false, &parallelMarkContext3);
-            }
+            this->ProcessParallelMark(false, splitContexts[i + 1]);
         }
     }
 
+    this->StopParallelMarkWorkSharing(markerContexts, markerCount);
+
     this->SetCollectionState(CollectionStateMark);
 
     // Process tracked objects, if any, then do one final mark phase in case they marked any new objects.
@@ -2619,19 +2808,23 @@ Recycler::DoBackgroundParallelMark()
 {
     // Split the mark stack into [this->maxParallelism - 1] equal pieces (thus, "- 2" below).
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
-    // The parallel threads are hardwired to use parallelMarkContext2/3, so we split using those.
+    // Parallel thread N marks parallelMarkContexts[N + 1], so we split using those.
     uint actualSplitCount = 0;
-    MarkContext * splitContexts[2] = { &parallelMarkContext2, &parallelMarkContext3 };
+    MarkContext * splitContexts[MaxParallelism - 2];
     if (this->enableParallelMark)
     {
-        Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+        Assert(this->maxParallelism > 1 && this->maxParallelism <= this->parallelMarkContextCount + 1);
         if (this->maxParallelism > 2)
         {
+            for (uint i = 0; i < this->maxParallelism - 2; i++)
+            {
+                splitContexts[i] = &parallelMarkContexts[i + 1]->markContext;
+            }
             actualSplitCount = markContext.Split(this->maxParallelism - 2, splitContexts);
         }
     }
 
-    Assert(actualSplitCount <= 2);
+    Assert(actualSplitCount <= MaxParallelism - 2);
 
     // If we failed to split at all, just mark in thread with no parallelism.
     if (actualSplitCount == 0)
@@ -2649,14 +2842,27 @@ Recycler::DoBackgroundParallelMark()
 
     this->SetCollectionState(CollectionStateBackgroundParallelMark);
 
+    // We mark the main context and parallel thread N marks split N.
+    MarkContext * markerContexts[MaxParallelism - 1];
+    markerContexts[0] = &markContext;
+    for (uint i = 0; i < actualSplitCount; i++)
+    {
+        markerContexts[i + 1] = splitContexts[i];
+    }
+    const uint markerCount = actualSplitCount + 1;
+    this->StartParallelMarkWorkSharing(markerContexts, markerCount);
+
     // Kick off marking on parallel threads too, if there is work for them
     // If the threads haven't been created yet, this will create them (or fail).
-    bool parallelSuccess1 = false;
-    bool parallelSuccess2 = false;
-    parallelSuccess1 = parallelThread1.StartConcurrent();
-    if (parallelSuccess1 && actualSplitCount == 2)
+    uint startedThreadCount = 0;
+    while (startedThreadCount < actualSplitCount && parallelThreads[startedThreadCount].StartConcurrent())
     {
-        parallelSuccess2 = parallelThread2.StartConcurrent();
+        startedThreadCount++;
+    }
+
+    for (uint i = startedThreadCount; i < actualSplitCount; i++)
+    {
+        this->RemoveParallelMarker(splitContexts[i]);
     }
 
     // Process our portion of the split.
@@ -2664,27 +2870,20 @@ Recycler::DoBackgroundParallelMark()
 
     // If we successfully launched parallel work, wait for it to complete.
     // If we failed, then process the work in-thread now.
-    if (parallelSuccess1)
-    {
-        parallelThread1.WaitForConcurrent();
-    }
-    else
-    {
-        this->ProcessParallelMark(true, &parallelMarkContext2);
-    }
-
-    if (actualSplitCount == 2)
+    for (uint i = 0; i < actualSplitCount; i++)
     {
-        if (parallelSuccess2)
+        if (i < startedThreadCount)
         {
-            parallelThread2.WaitForConcurrent();
+            parallelThreads[i].WaitForConcurrent();
         }
         else
         {
-            this->ProcessParallelMark(true, &parallelMarkContext3);
+            this->ProcessParallelMark(true, splitContexts[i]);
         }
     }
 
+    this->StopParallelMarkWorkSharing(markerContexts, markerCount);
+
     this->SetCollectionState(CollectionStateConcurrentMark);
 }
 #endif
@@ -2797,21 +2996,26 @@ Recycler::EndMark()
         oomRescan |= EndMarkCheckOOMRescan();
     }
 
+    // After the callbacks above, so that objects they revive are not reported as freed
+    ProcessAllocationSamples();
+
     // GC-CONSIDER: Consider keeping some page around
     GCETW(GC_DECOMMIT_CONCURRENT_COLLECT_PAGE_ALLOCATOR_START, (this));
 
     // Clean up mark contexts, which will release held free pages
     // Do this for all contexts before we decommit, to make sure all pages are freed
     markContext.Cleanup();
-    parallelMarkContext1.Cleanup();
-    parallelMarkContext2.Cleanup();
-    parallelMarkContext3.Cleanup();
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        parallelMarkContexts[i]->markContext.Cleanup();
+    }
 
     // Decommit all pages
     markContext.DecommitPages();
-    parallelMarkContext1.DecommitPages();
-    parallelMarkContext2.DecommitPages();
-    parallelMarkContext3.DecommitPages();
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        parallelMarkContexts[i]->markContext.DecommitPages();
+    }
 
     GCETW(GC_DECOMMIT_CONCURRENT_COLLECT_PAGE_ALLOCATOR_STOP, (this));
 
@@ -2898,9 +3102,12 @@ Recycler::EndMarkOnLowMemory()
     while (this->NeedOOMRescan());
 
     Assert(!markContext.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext1.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext2.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext3.GetPageAllocator()->DisableAllocationOutOfMemory());
+#if DBG
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        Assert(!parallelMarkContexts[i]->markContext.GetPageAllocator()->DisableAllocationOutOfMemory());
+    }
+#endif
     CUSTOM_PHASE_PRINT_TRACE1(GetRecyclerFlagsTable(), Js::RecyclerPhase, _u("EndMarkOnLowMemory iterations: %d\n"), iterations);
 
 #if ENABLE_PARTIAL_GC
@@ -2925,7 +3132,19 @@ Recycler::EndMarkOnLowMemory()
 bool
 Recycler::IsMarkStackEmpty()
 {
-    return (markContext.IsEmpty() && parallelMarkContext1.IsEmpty() && parallelMarkContext2.IsEmpty() && parallelMarkContext3.IsEmpty());
+    if (!markContext.IsEmpty())
+    {
+        return false;
+    }
+
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        if (!parallelMarkContexts[i]->markContext.IsEmpty())
+        {
+            return false;
+        }
+    }
+    return true;
 }
 #endif
 
@@ -3701,12 +3920,17 @@ Recycler::CollectWithHeuristic()
     // Otherwise, we should check the heuristics to see if a GC is necessary
     if (!isScriptContextCloseGCPending)
     {
+        if (allocSize && timed && this->pauseBudgetHeuristic.IsEnabled())
+        {
+            return CollectWithPauseBudget<flags>();
+        }
+
 #if ENABLE_PARTIAL_GC
         if (GetPartialFlag<flags>())
         {
             Assert(enablePartialCollect);
             Assert(allocSize);
-            Assert(this->uncollectedNewPageCountPartialCollect >= RecyclerSweepManager::MinPartialUncollectedNewPageCount
+            Assert(this->uncollectedNewPageCountPartialCollect >= RecyclerHeuristic::MinPartialUncollectedNewPageCount(GetRecyclerFlagsTable())
                 && this->uncollectedNewPageCountPartialCollect <= RecyclerHeuristic::Instance.MaxPartialUncollectedNewPageCount);
 
             // PARTIAL-GC-REVIEW: For now, we have only alloc size heuristic
@@ -3730,8 +3954,8 @@ Recycler::CollectWithHeuristic()
             return FinishDisposeObjectsWrapped<flags>();
         }
 
-        // time heuristic, allocate every 1000 clock tick, or 64 MB is allocated in a short time
-        if (timed && (autoHeap.uncollectedAllocBytes < RecyclerHeuristic::Instance.MaxUncollectedAllocBytes))
+        // time heuristic, allocate every 1000 clock tick, or 64 MB (less near the memory limit) is allocated in a short time
+        if (timed && (autoHeap.uncollectedAllocBytes < GetMaxUncollectedAllocBytes()))
         {
             uint currentTickCount = GetTickCount();
 #ifdef RECYCLER_TRACE
@@ -3755,6 +3979,43 @@ Recycler::CollectWithHeuristic()
     return Collect<(CollectionFlags)(flags & ~CollectMode_Partial)>();
 }
 
+// The allocation heuristic with -RecyclerPauseBudget: collect once the adapted trigger is reached, in thread
+// while the predicted pause fits the budget and partially while young objects mostly die.
+template <CollectionFlags flags>
+BOOL
+Recycler::CollectWithPauseBudget()
+{
+    if (autoHeap.uncollectedAllocBytes < min(this->pauseBudgetHeuristic.GetTriggerBytes(), GetMaxUncollectedAllocBytes()))
+    {
+        return FinishDisposeObjectsWrapped<flags>();
+    }
+
+#ifdef ENABLE_JS_ETW
+    if (IS_UNKNOWN_GC_TRIGGER(collectionStartReason))
+    {
+        collectionStartReason = ETWEventGCActivationTrigger::ETWEvent_GC_Trigger_TimeAndAllocSize_Heuristic;
+    }
+#endif
+
+    const bool inThread = (flags & CollectMode_Concurrent) != 0 && !this->CollectionInProgress()
+        && this->pauseBudgetHeuristic.PreferInThreadCollect(autoHeap.GetUsedBytes());
+#if ENABLE_PARTIAL_GC
+    if (GetPartialFlag<flags>() && this->pauseBudgetHeuristic.PreferPartialCollect())
+    {
+        if (inThread)
+        {
+            return Collect<(CollectionFlags)(flags & ~CollectMode_Concurrent)>();
+        }
+        return Collect<flags>();
+    }
+#endif
+    if (inThread)
+    {
+        return Collect<(CollectionFlags)(flags & ~(CollectMode_Concurrent | CollectMode_Partial))>();
+    }
+    return Collect<(CollectionFlags)(flags & ~CollectMode_Partial)>();
+}
+
 template <CollectionFlags flags>
 BOOL
 Recycler::Collect()
@@ -3827,6 +4088,33 @@ void Recycler::SetupPostCollectionFlags()
     }
 }
 
+// Adds the time the script thread spends in a collection call to the pause of the current collection
+class AutoRecordCollectionPause
+{
+public:
+    AutoRecordCollectionPause(RecyclerPauseBudgetHeuristic * heuristic) :
+        heuristic(heuristic->IsEnabled() ? heuristic : nullptr)
+    {
+        if (this->heuristic)
+        {
+            this->start = Js::Tick::Now();
+        }
+    }
+
+    ~AutoRecordCollectionPause()
+    {
+        if (this->heuristic)
+        {
+            Js::TickDelta pause = Js::Tick::Now() - this->start;
+            this->heuristic->RecordPause(pause.ToMicroseconds() / 1000.0);
+        }
+    }
+
+private:
+    RecyclerPauseBudgetHeuristic * heuristic;
+    Js::Tick start;
+};
+
 BOOL
 Recycler::DoCollectWrapped(CollectionFlags flags)
 {
@@ -3835,6 +4123,16 @@ Recycler::DoCollectWrapped(CollectionFlags flags)
     DebugOnly(this->isConcurrentGCOnIdle = (flags == CollectOnScriptIdle));
 #endif
 
+    if (this->pauseBudgetHeuristic.IsEnabled())
+    {
+        bool concurrent = false;
+#if ENABLE_CONCURRENT_GC
+        concurrent = (flags & CollectMode_Concurrent) != 0 && (flags & CollectOverride_ForceInThread) == 0 && this->IsConcurrentEnabled();
+#endif
+        this->pauseBudgetHeuristic.StartCollection(autoHeap.GetUsedBytes(), concurrent);
+    }
+    AutoRecordCollectionPause autoRecordPause(&this->pauseBudgetHeuristic);
+
     this->allowDispose = (flags & CollectOverride_AllowDispose) == CollectOverride_AllowDispose;
     BOOL collected = collectionWrapper->ExecuteRecyclerCollectionFunction(this, &Recycler::DoCollect, flags);
 
@@ -4271,6 +4569,57 @@ Recycler::EnsureNotCollecting()
     Assert(!this->CollectionInProgress());
 }
 
+void
+Recycler::GetHeapSpaceStats(HeapSpaceStats * spaceStats)
+{
+    // The blocks are only consistent once any concurrent collection has finished
+    EnsureNotCollecting();
+    memset(spaceStats, 0, sizeof(HeapSpaceStats) * HeapSpaceCount);
+
+    // This walks the heap block map rather than aggregating the buckets' MemStats, which only exist in
+    // ENABLE_MEM_STATS builds. The objects of small and medium blocks count as used unless they were free after
+    // the block's last sweep, so objects allocated since then are not counted until the next one.
+    heapBlockMap.ForEachHeapBlock([&](HeapBlock * heapBlock)
+    {
+        if (heapBlock->IsLargeHeapBlock())
+        {
+            LargeHeapBlock * largeBlock = (LargeHeapBlock *)heapBlock;
+            HeapSpaceStats& stats = spaceStats[HeapSpaceLarge];
+            for (uint i = 0; i < largeBlock->allocCount; i++)
+            {
+                LargeObjectHeader * header = largeBlock->GetHeaderByIndex(i);
+                if (header != nullptr)
+                {
+                    stats.usedBytes += header->objectSize;
+                }
+            }
+            stats.committedBytes += largeBlock->GetPageCount() * AutoSystemInfo::PageSize;
+            return;
+        }
+
+        HeapSpaceKind kind;
+        size_t usedBytes;
+        size_t committedBytes;
+        if (heapBlock->GetHeapBlockType() < HeapBlock::HeapBlockType::MediumNormalBlockType)
+        {
+            SmallHeapBlock * smallBlock = (SmallHeapBlock *)heapBlock;
+            usedBytes = (size_t)(smallBlock->objectCount - smallBlock->freeCount) * smallBlock->objectSize;
+            committedBytes = smallBlock->GetPageCount() * AutoSystemInfo::PageSize;
+            kind = heapBlock->IsLeafBlock() ? HeapSpaceSmallLeaf :
+                heapBlock->IsAnyFinalizableBlock() ? HeapSpaceSmallFinalizable : HeapSpaceSmallNormal;
+        }
+        else
+        {
+            MediumHeapBlock * mediumBlock = (MediumHeapBlock *)heapBlock;
+            usedBytes = (size_t)(mediumBlock->objectCount - mediumBlock->freeCount) * mediumBlock->objectSize;
+            committedBytes = mediumBlock->GetPageCount() * AutoSystemInfo::PageSize;
+            kind = HeapSpaceMedium;
+        }
+        spaceStats[kind].usedBytes += usedBytes;
+        spaceStats[kind].committedBytes += committedBytes;
+    });
+}
+
 void Recycler::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
 {
     // Make sure we are not collecting
@@ -4329,6 +4678,7 @@ Recycler::CollectionBegin()
     RECYCLER_PROFILE_EXEC_BEGIN2(this, Js::RecyclerPhase, phase);
     GCETW_INTERNAL(GC_START, (this, GetETWEventGCActivationKind<phase>()));
     GCETW_INTERNAL(GC_START2, (this, GetETWEventGCActivationKind<phase>(), this->collectionStartReason, this->collectionStartFlags));
+    CHAKRA_USDT(GC_START, this, phase, this->collectionStartReason, this->collectionStartFlags);
 }
 
 template <Js::Phase phase>
@@ -4337,6 +4687,7 @@ Recycler::CollectionEnd()
 {
     GCETW_INTERNAL(GC_STOP, (this, GetETWEventGCActivationKind<phase>()));
     GCETW_INTERNAL(GC_STOP2, (this, GetETWEventGCActivationKind<phase>(), this->collectionFinishReason, this->collectionStartFlags));
+    CHAKRA_USDT(GC_STOP, this, phase, this->collectionFinishReason, this->collectionStartFlags);
     RECYCLER_PROFILE_EXEC_END2(this, phase, Js::RecyclerPhase);
 }
 
@@ -4469,9 +4820,10 @@ Recycler::ProcessTrackedObjects()
 
     // If we did a parallel mark, we need to process any queued tracked objects from the parallel mark stack as well.
     // If we didn't, this will do nothing.
-    parallelMarkContext1.ProcessTracked();
-    parallelMarkContext2.ProcessTracked();
-    parallelMarkContext3.ProcessTracked();
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        parallelMarkContexts[i]->markContext.ProcessTracked();
+    }
 
     DebugOnly(this->isProcessingTrackedObjects = false);
 
@@ -4592,6 +4944,12 @@ Recycler::FinishConcurrent()
 
         const BOOL forceFinish = flags & CollectOverride_ForceFinish;
 
+        if ((flags & CollectMode_Concurrent) && !forceFinish && this->inIncrementalMark)
+        {
+            this->DoIncrementalMarkSlice((uint)GetRecyclerFlagsTable().RecyclerIncrementalMark);
+            return false;
+        }
+
         if (forceFinish || !IsConcurrentExecutingState())
         {
 #if ENABLE_BACKGROUND_PAGE_FREEING
@@ -4635,6 +4993,7 @@ Recycler::TryFinishConcurrentCollect()
     Assert(this->CollectionInProgress());
 
     RECYCLER_STATS_INC(this, finishCollectTryCount);
+    AutoRecordCollectionPause autoRecordPause(&this->pauseBudgetHeuristic);
 
     SetupPostCollectionFlags<flags>();
     const BOOL concurrent = flags & CollectMode_Concurrent;
@@ -4643,6 +5002,13 @@ Recycler::TryFinishConcurrentCollect()
     Assert(this->IsConcurrentEnabled());
     Assert(IsConcurrentState() || IsCollectionDisabled());
     Assert(!concurrent || !forceInThread);
+    if (concurrent && this->inIncrementalMark)
+    {
+        // Take the background thread's place for a slice, then let the script run until the next allocation
+        this->DoIncrementalMarkSlice((uint)GetRecyclerFlagsTable().RecyclerIncrementalMark);
+        return FinishDisposeObjectsWrapped<flags>();
+    }
+
     if (concurrent && concurrentThread != NULL)
     {
         if (IsConcurrentExecutingState())
@@ -4853,6 +5219,11 @@ bool Recycler::AbortConcurrent(bool restoreState)
     {
         this->isAborting = true;
 
+        if (this->inIncrementalMark)
+        {
+            this->FinishIncrementalMark();
+        }
+
         if (this->concurrentThread != NULL)
         {
             SetThreadPriority(this->concurrentThread, THREAD_PRIORITY_NORMAL);
@@ -5022,8 +5393,10 @@ Recycler::FinalizeConcurrent(bool restoreState)
 
     // Shutdown parallel threads and return the handle for them so the caller can
     // close it.
-    parallelThread1.Shutdown();
-    parallelThread2.Shutdown();
+    for (uint i = 0; i < _countof(parallelThreads); i++)
+    {
+        parallelThreads[i].Shutdown();
+    }
 
 #ifdef IDLE_DECOMMIT_ENABLED
     if (concurrentIdleDecommitEvent != nullptr)
@@ -5049,6 +5422,7 @@ Recycler::FinalizeConcurrent(bool restoreState)
         this->enableConcurrentMark = false;
         this->enableParallelMark = false;
         this->enableConcurrentSweep = false;
+        this->enableIncrementalMark = false;
     }
 
     this->threadService = nullptr;
@@ -5073,6 +5447,14 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
         return false;
     }
 
+    if (threadService == nullptr && GetRecyclerFlagsTable().RecyclerNumaAffinity)
+    {
+        // Run our own background threads on the node of the script thread. Pages are placed on the node that first
+        // touches them, so this keeps both the heap blocks the main thread allocates and the pages zeroed and swept
+        // in the background local to the threads that mark them.
+        this->numaNode = PlatformAgnostic::Thread::GetCurrentNumaNode();
+    }
+
 #if ENABLE_DEBUG_CONFIG_OPTIONS
     this->enableConcurrentMark = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ConcurrentMarkPhase);
     this->enableParallelMark = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase);
@@ -5089,6 +5471,11 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
         this->enableParallelMark = false;
     }
 
+    // With only 1 CPU the background thread just takes turns with the script thread, so rather than leaving the
+    // script to wait on it in FinishConcurrentCollect, mark in short slices on the script thread as it allocates.
+    this->enableIncrementalMark = this->enableConcurrentMark && GetRecyclerFlagsTable().RecyclerIncrementalMark > 0
+        && (AutoSystemInfo::Data.GetNumberOfPhysicalProcessors() == 1 || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::IncrementalMarkPhase));
+
     if (threadService->HasCallback())
     {
         this->threadService = threadService;
@@ -5097,31 +5484,21 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
     else
     {
         bool startConcurrentThread = true;
-        bool startedParallelThread1 = false;
-        bool startedParallelThread2 = false;
+        uint startedParallelThreadCount = 0;
 
         if (startAllThreads)
         {
-            if (this->enableParallelMark && this->maxParallelism > 2)
+            if (this->enableParallelMark)
             {
-                if (!parallelThread1.EnableConcurrent(true))
+                // All but the collecting and the background thread mark in parallel threads
+                while (startedParallelThreadCount + 2 < this->maxParallelism)
                 {
-                    startConcurrentThread = false;
-                }
-                else
-                {
-                    startedParallelThread1 = true;
-                    if (this->maxParallelism > 3)
+                    if (!parallelThreads[startedParallelThreadCount].EnableConcurrent(true))
                     {
-                        if (!parallelThread2.EnableConcurrent(true))
-                        {
-                            startConcurrentThread = false;
-                        }
-                        else
-                        {
-                            startedParallelThread2 = true;
-                        }
+                        startConcurrentThread = false;
+                        break;
                     }
+                    startedParallelThreadCount++;
                 }
             }
         }
@@ -5150,13 +5527,9 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
             }
         }
 
-        if (startedParallelThread1)
+        for (uint i = 0; i < startedParallelThreadCount; i++)
         {
-            parallelThread1.Shutdown();
-            if (startedParallelThread2)
-            {
-                parallelThread2.Shutdown();
-            }
+            parallelThreads[i].Shutdown();
         }
     }
 
@@ -5164,6 +5537,7 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
     this->enableConcurrentMark = false;
     this->enableParallelMark = false;
     this->enableConcurrentSweep = false;
+    this->enableIncrementalMark = false;
 
     if (concurrentWorkReadyEvent)
     {
@@ -5218,6 +5592,13 @@ Recycler::StartConcurrent(CollectionState const state)
     CollectionState oldState = this->collectionState;
     this->SetCollectionState(state);
 
+    if (this->enableIncrementalMark &&
+        (state == CollectionStateConcurrentResetMarks || state == CollectionStateConcurrentFindRoots || state == CollectionStateConcurrentMark))
+    {
+        this->StartIncrementalMark();
+        return true;
+    }
+
     if (threadService->HasCallback())
     {
         Assert(concurrentThread == NULL);
@@ -5532,6 +5913,116 @@ Recycler::BackgroundMarkWeakRefs()
 #endif
 }
 
+// With -RecyclerIncrementalMark, StartConcurrent leaves the background mark states to the script thread:
+// TryFinishConcurrentCollect runs them a slice at a time as the script allocates, and the write barrier keeps
+// track of what the script changes in between, for the rescan in FinishConcurrentCollect, just as it does when
+// the background thread marks.
+void
+Recycler::StartIncrementalMark()
+{
+    Assert(this->enableIncrementalMark);
+    Assert(!this->inIncrementalMark);
+    Assert(this->IsConcurrentMarkExecutingState());
+
+    this->inIncrementalMark = true;
+    this->backgroundRescanCount = 0;
+    this->StartQueueTrackedObject();
+}
+
+// Do the background mark states from wherever the last slice stopped, for about sliceTime milliseconds,
+// or to the end with a sliceTime of 0.
+void
+Recycler::DoIncrementalMarkSlice(uint sliceTime)
+{
+    Assert(this->inIncrementalMark);
+    Assert(this->IsConcurrentMarkExecutingState());
+
+    const DWORD startTickCount = ::GetTickCount();
+    const auto isSliceOver = [&]() { return sliceTime != 0 && ::GetTickCount() - startTickCount >= sliceTime; };
+    bool sliceOver = false;
+
+    RECYCLER_PROFILE_EXEC_BEGIN(this, Js::IncrementalMarkPhase);
+
+    if (this->collectionState == CollectionStateConcurrentResetMarks)
+    {
+        this->BackgroundResetMarks();
+        this->BackgroundResetWriteWatchAll();
+        this->SetCollectionState(CollectionStateConcurrentFindRoots);
+        sliceOver = isSliceOver();
+    }
+
+    if (!sliceOver && this->collectionState == CollectionStateConcurrentFindRoots)
+    {
+        // The stack saved when the mark started is stale by now, the rescan will scan the live one
+        this->BackgroundFindRoots();
+        Assert(this->collectionState == CollectionStateConcurrentMark);
+        sliceOver = isSliceOver();
+    }
+
+    if (!sliceOver && this->collectionState == CollectionStateConcurrentMark)
+    {
+        while (!this->NeedOOMRescan() && !this->isAborting)
+        {
+            if (!this->ProcessMarkSlice(RecyclerHeuristic::IncrementalMarkObjectsPerBudgetCheck))
+            {
+                sliceOver = isSliceOver();
+                if (sliceOver)
+                {
+                    break;
+                }
+                continue;
+            }
+
+            // Like BackgroundMark, do one repeat mark of the pages the script has changed so far
+            // so that there is less left for the rescan to do
+            if (this->backgroundRescanCount != 0 || PHASE_OFF1(Js::BackgroundRepeatMarkPhase))
+            {
+                break;
+            }
+            this->BackgroundRescan(RescanFlags_ResetWriteWatch);
+        }
+
+        if (!sliceOver)
+        {
+            this->SetCollectionState(CollectionStateConcurrentMarkWeakRef);
+        }
+    }
+
+    if (!sliceOver && this->collectionState == CollectionStateConcurrentMarkWeakRef)
+    {
+        this->BackgroundMarkWeakRefs();
+        RECORD_TIMESTAMP(concurrentMarkFinishTime);
+
+        this->SetCollectionState(CollectionStateRescanWait);
+        this->inIncrementalMark = false;
+
+        // Signal the mark done as the background thread would, for WaitForConcurrentThread
+        SetEvent(this->concurrentWorkDoneEvent);
+    }
+
+    RECYCLER_PROFILE_EXEC_END(this, Js::IncrementalMarkPhase);
+}
+
+void
+Recycler::FinishIncrementalMark()
+{
+    Assert(this->inIncrementalMark);
+
+    this->DoIncrementalMarkSlice(0);
+
+    Assert(!this->inIncrementalMark);
+}
+
+bool
+Recycler::ProcessMarkSlice(uint objectCount)
+{
+    if (this->enableScanInteriorPointers)
+    {
+        return markContext.ProcessMarkSlice</* interior */ true>(objectCount);
+    }
+    return markContext.ProcessMarkSlice</* interior */ false>(objectCount);
+}
+
 void
 Recycler::BackgroundResetMarks()
 {
@@ -5737,6 +6228,12 @@ Recycler::WaitForConcurrentThread(DWORD waitTime, RecyclerWaitReason caller)
 {
     Assert(this->IsConcurrentState() || this->collectionState == CollectionStateParallelMark);
 
+    if (this->inIncrementalMark)
+    {
+        // Nothing is marking in the background, finish the rest of the mark here so there is something to wait for
+        this->FinishIncrementalMark();
+    }
+
     RECYCLER_PROFILE_EXEC_BEGIN(this, Js::ConcurrentWaitPhase);
 
     if (concurrentThread != NULL)
@@ -6379,6 +6876,11 @@ Recycler::ThreadProc()
 
     SetThreadPriority(::GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
 
+    if (this->numaNode != PlatformAgnostic::Thread::InvalidNumaNode)
+    {
+        PlatformAgnostic::Thread::SetCurrentThreadNumaNode(this->numaNode);
+    }
+
 #if defined(DBG) && defined(PROFILE_EXEC)
     this->backgroundProfilerPageAllocator.SetConcurrentThreadId(::GetCurrentThreadId());
 #endif
@@ -6571,6 +7073,11 @@ Recycler::FinishCollection()
     // Reset the time heuristics
     ScheduleNextCollection();
 
+    if (this->pauseBudgetHeuristic.IsEnabled())
+    {
+        this->pauseBudgetHeuristic.FinishCollection(autoHeap.lastUncollectedAllocBytes, autoHeap.GetUsedBytes());
+    }
+
     {
         AutoSwitchCollectionStates collectionState(this,
             /* entry  state */ CollectionStatePostCollectionCallback,
@@ -6649,6 +7156,145 @@ Recycler::SetExternalRootMarker(ExternalRootMarker fn, void * context)
     externalRootMarkerContext = context;
 }
 
+void
+Recycler::SetExternalRootScanner(ExternalRootScanner fn, void * context)
+{
+    externalRootScanner = fn;
+    externalRootScannerContext = context;
+}
+
+void
+Recycler::SetAllocationSampling(size_t sampleInterval, AllocationSampleCallback sampleCallback,
+    AllocationSampleFreeCallback freeCallback, void * context)
+{
+    Assert(!this->isInAllocationSampleCallback);
+
+    // The ids of the samples taken so far mean nothing to the new callbacks
+    if (this->allocationSamples != nullptr)
+    {
+        HeapDelete(this->allocationSamples);
+        this->allocationSamples = nullptr;
+    }
+
+    if (sampleCallback == nullptr || sampleInterval == 0)
+    {
+        this->allocationSampleInterval = 0;
+        this->bytesUntilAllocationSample = SIZE_MAX;
+        this->allocationSampleCallback = nullptr;
+        this->allocationSampleFreeCallback = nullptr;
+        this->allocationSampleContext = nullptr;
+        return;
+    }
+
+    this->allocationSampleInterval = sampleInterval;
+    this->allocationSampleCallback = sampleCallback;
+    this->allocationSampleFreeCallback = freeCallback;
+    this->allocationSampleContext = context;
+    this->bytesUntilAllocationSample = GetNextAllocationSampleDistance();
+}
+
+size_t
+Recycler::GetNextAllocationSampleDistance() const
+{
+    Assert(this->allocationSampleInterval != 0);
+
+    // Exponentially distributed gaps make the sampled bytes a Poisson process with the
+    // interval as its mean. u is uniform in (0, 1], so the log is finite.
+    double u = (static_cast<double>(Math::Rand() & UINT32_MAX) + 1) / (static_cast<double>(UINT32_MAX) + 1);
+    double distance = -log(u) * static_cast<double>(this->allocationSampleInterval);
+    if (distance < 1)
+    {
+        return 1;
+    }
+    if (distance >= static_cast<double>(SIZE_MAX))
+    {
+        return SIZE_MAX - 1;
+    }
+    return static_cast<size_t>(distance);
+}
+
+void
+Recycler::SampleAllocation(void * address, size_t size)
+{
+    if (this->allocationSampleCallback == nullptr)
+    {
+        // Sampling is off, and more than SIZE_MAX bytes have been allocated since it was
+        this->bytesUntilAllocationSample = SIZE_MAX;
+        return;
+    }
+
+    this->bytesUntilAllocationSample = GetNextAllocationSampleDistance();
+
+    // Don't sample the allocations of the callback itself, or of in-thread collection work; an
+    // object allocated while marking in thread is not marked and would be reported freed at once
+    if (this->isInAllocationSampleCallback ||
+        this->IsInObjectBeforeCollectCallback() ||
+        (this->CollectionInProgress() && !this->IsConcurrentState()))
+    {
+        return;
+    }
+
+    AutoRestoreValue<bool> autoInAllocationSampleCallback(&this->isInAllocationSampleCallback, true);
+
+    uint sampleId = this->nextAllocationSampleId++;
+    if (this->allocationSampleFreeCallback != nullptr)
+    {
+        if (this->allocationSamples == nullptr)
+        {
+            this->allocationSamples = HeapNewNoThrow(AllocationSampleMap, &HeapAllocator::Instance);
+            if (this->allocationSamples == nullptr)
+            {
+                return;
+            }
+        }
+
+        // An explicitly freed object can hand its address to the new allocation
+        uint previousSampleId;
+        if (this->allocationSamples->TryGetValue(address, &previousSampleId))
+        {
+            this->allocationSampleFreeCallback(this->allocationSampleContext, previousSampleId);
+        }
+
+        try
+        {
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_OutOfMemory);
+            this->allocationSamples->Item(address, sampleId);
+        }
+        catch (Js::OutOfMemoryException)
+        {
+            // Drop the sample rather than failing the allocation
+            this->allocationSamples->Remove(address);
+            return;
+        }
+    }
+
+    this->allocationSampleCallback(this->allocationSampleContext, sampleId, size);
+}
+
+void
+Recycler::ProcessAllocationSamples()
+{
+    if (this->allocationSamples == nullptr)
+    {
+        return;
+    }
+
+    Assert(this->IsMarkState());
+    Assert(this->allocationSampleFreeCallback != nullptr);
+    AutoRestoreValue<bool> autoInAllocationSampleCallback(&this->isInAllocationSampleCallback, true);
+
+    this->allocationSamples->MapAndRemoveIf([&](const AllocationSampleMap::EntryType& entry)
+    {
+        if (this->IsObjectMarked(entry.Key()))
+        {
+            return false;
+        }
+
+        this->allocationSampleFreeCallback(this->allocationSampleContext, entry.Value());
+        return true;
+    });
+}
+
 void
 Recycler::SetCollectionWrapper(RecyclerCollectionWrapper * wrapper)
 {
@@ -6802,6 +7448,68 @@ Recycler::ShouldIdleCollectOnExit()
     return (autoHeap.uncollectedAllocBytes >= RecyclerHeuristic::IdleUncollectedAllocBytesCollection);
 }
 
+// Called by the host while it has nothing else to do, at most until deadlineTick.
+// Each step is skipped once the deadline has passed. Returns the tick count at
+// which more idle time would help, or UINT_MAX if there is no GC work left.
+DWORD
+Recycler::DoIdleWork(DWORD deadlineTick)
+{
+    Assert(!this->isInScript);
+
+    if (this->IsCollectionDisabled() || this->inDispose)
+    {
+        return UINT_MAX;
+    }
+
+#if ENABLE_CONCURRENT_GC
+    if (this->CollectionInProgress())
+    {
+        // Only finishes if the background thread is done with its part, so this doesn't block.
+        // Otherwise give it the time a concurrent collection is expected to take.
+        this->FinishConcurrent<FinishConcurrentOnIdleAtRoot>();
+        if (this->CollectionInProgress())
+        {
+            return GetTickCount() + RecyclerHeuristic::TickCountFinishCollection;
+        }
+    }
+#endif
+
+    if (this->NeedDispose() && (int)(deadlineTick - GetTickCount()) > 0)
+    {
+        // Finalizer callbacks can take a while after a lot of host objects died, so the dispose is
+        // cut at the deadline and picked up again in the next idle period
+        AutoRestoreValue<bool> hasDeadline(&this->hasDisposeDeadline, true);
+        AutoRestoreValue<DWORD> deadline(&this->disposeDeadlineTick, deadlineTick);
+        this->FinishDisposeObjectsNow<FinishDispose>();
+        if (this->NeedDispose())
+        {
+            return GetTickCount();
+        }
+    }
+
+    if ((int)(deadlineTick - GetTickCount()) <= 0)
+    {
+        // Out of time, there is more to do in the next idle period
+        return GetTickCount();
+    }
+
+    if (autoHeap.uncollectedAllocBytes >= RecyclerHeuristic::IdleUncollectedAllocBytesCollection)
+    {
+        // Script isn't on the stack, so the collection can skip the stack scan. With concurrent
+        // GC enabled only the rescan at the end runs on this thread, in a later idle period.
+        this->CollectNow<CollectOnScriptIdle>();
+        if (this->CollectionInProgress())
+        {
+            return GetTickCount() + RecyclerHeuristic::TickCountFinishCollection;
+        }
+        return this->NeedDispose() ? GetTickCount() : UINT_MAX;
+    }
+
+    // Nothing left to collect: give back the free pages
+    autoHeap.DecommitNow(false);
+    return UINT_MAX;
+}
+
 #if ENABLE_CONCURRENT_GC
 bool
 RecyclerParallelThread::StartConcurrent()
@@ -6905,13 +7613,12 @@ RecyclerParallelThread::EnableConcurrent(bool waitForThread)
 }
 
 
-template <uint parallelId>
 void
-Recycler::ParallelWorkFunc()
+Recycler::ParallelWorkFunc(uint parallelId)
 {
-    Assert(parallelId == 0 || parallelId == 1);
+    Assert(parallelId + 1 < this->parallelMarkContextCount);
 
-    MarkContext * markContext = (parallelId == 0 ? &this->parallelMarkContext2 : &this->parallelMarkContext3);
+    MarkContext * markContext = &this->parallelMarkContexts[parallelId + 1]->markContext;
 
     switch (this->collectionState)
     {
@@ -6991,7 +7698,7 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
 #endif
         RecyclerParallelThread * parallelThread = (RecyclerParallelThread *)lpParameter;
         Recycler * recycler = parallelThread->recycler;
-        RecyclerParallelThread::WorkFunc workFunc = parallelThread->workFunc;
+        uint parallelId = parallelThread->parallelId;
 
         Assert(recycler->IsConcurrentEnabled());
 
@@ -7010,6 +7717,11 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
         Assert(eventActivityIdControlResult == ERROR_SUCCESS);
 #endif
 
+        if (recycler->numaNode != PlatformAgnostic::Thread::InvalidNumaNode)
+        {
+            PlatformAgnostic::Thread::SetCurrentThreadNumaNode(recycler->numaNode);
+        }
+
         // If this thread is created on demand we already have work to process and do not need to wait
         bool mustWait = parallelThread->synchronizeOnStartup;
 
@@ -7030,7 +7742,7 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
             }
 
             // Invoke the workFunc to do real work
-            (recycler->*workFunc)();
+            recycler->ParallelWorkFunc(parallelId);
 
             // We always wait after the first time
             mustWait = true;
@@ -7067,9 +7779,8 @@ RecyclerParallelThread::StaticBackgroundWorkCallback(void * callbackData)
 {
     RecyclerParallelThread * parallelThread = (RecyclerParallelThread *)callbackData;
     Recycler * recycler = parallelThread->recycler;
-    RecyclerParallelThread::WorkFunc workFunc = parallelThread->workFunc;
 
-    (recycler->*workFunc)();
+    recycler->ParallelWorkFunc(parallelThread->parallelId);
 
     SetEvent(parallelThread->concurrentWorkDoneEvent);
 }
@@ -7962,6 +8673,76 @@ Recycler::AutoSetupRecyclerForNonCollectingMark::~AutoSetupRecyclerForNonCollect
     m_recycler.isCollectionDisabled = false;
 }
 
+Recycler::AutoHeapWalk::AutoHeapWalk(Recycler * recycler)
+    : m_recycler(recycler), m_setup(*recycler, true)
+{
+    Assert(!recycler->isHeapEnumInProgress);
+    recycler->EnsureNotCollecting();
+    m_setup.DoCommonSetup();
+
+    // A full in-thread mark leaves exactly the reachable objects marked
+    recycler->Mark();
+
+    recycler->SetCollectionState(CollectionStateNotCollecting);
+    recycler->isHeapEnumInProgress = true;
+    recycler->isCollectionDisabled = true;
+}
+
+Recycler::AutoHeapWalk::~AutoHeapWalk()
+{
+    // m_setup restores the collection state and re-enables collection
+}
+
+template <class TBlockAttributes>
+void
+Recycler::AutoHeapWalk::ForEachLiveObject(SmallHeapBlockT<TBlockAttributes> * heapBlock, HeapWalkCallback callback, void * context)
+{
+    HeapBlockMap& heapBlockMap = m_recycler->heapBlockMap;
+    size_t objectSize = heapBlock->GetObjectSize();
+    bool isLeaf = heapBlock->IsLeafBlock();
+    heapBlock->ForEachAllocatedObject([&](uint index, void * objectAddress)
+    {
+        if (heapBlockMap.IsMarked(objectAddress))
+        {
+            callback(objectAddress, objectSize, isLeaf, context);
+        }
+    });
+}
+
+void
+Recycler::AutoHeapWalk::ForEachLiveObject(HeapWalkCallback callback, void * context)
+{
+    Recycler * recycler = m_recycler;
+    Assert(recycler->isHeapEnumInProgress);
+    HeapBlockMap& heapBlockMap = recycler->heapBlockMap;
+
+    heapBlockMap.ForEachHeapBlock([&](HeapBlock * heapBlock)
+    {
+        if (heapBlock->IsLargeHeapBlock())
+        {
+            LargeHeapBlock * largeBlock = (LargeHeapBlock *)heapBlock;
+            for (uint i = 0; i < largeBlock->allocCount; i++)
+            {
+                LargeObjectHeader * header = largeBlock->GetHeaderByIndex(i);
+                if (header == nullptr || !heapBlockMap.IsMarked(header->GetAddress()))
+                {
+                    continue;
+                }
+                bool isLeaf = (header->GetAttributes(recycler->Cookie) & LeafBit) != 0;
+                callback(header->GetAddress(), header->objectSize, isLeaf, context);
+            }
+        }
+        else if (heapBlock->GetHeapBlockType() < HeapBlock::HeapBlockType::MediumNormalBlockType)
+        {
+            this->ForEachLiveObject((SmallHeapBlock *)heapBlock, callback, context);
+        }
+        else
+        {
+            this->ForEachLiveObject((MediumHeapBlock *)heapBlock, callback, context);
+        }
+    });
+}
+
 #ifdef RECYCLER_DUMP_OBJECT_GRAPH
 bool Recycler::DumpObjectGraph(RecyclerObjectGraphDumper::Param * param)
 {
@@ -8951,9 +9732,31 @@ void Recycler::SetObjectBeforeCollectCallback(void* object,
         return; // NOP at shutdown
     }
 
+    if (callback == nullptr)
+    {
+        if (objectBeforeCollectCallbackMap == nullptr)
+        {
+            return;
+        }
+
+        // Outside of the callbacks the map holds every callback, so just drop the entry. While they run,
+        // the entry of a live object may still be in the map being processed and has to be overridden on
+        // the merge; a dead object is either being called back or already was, so there is nothing to do.
+        // Hosts clear the handles of dead objects from their callbacks, so this keeps those clears from
+        // building a new map of entries that only get merged back and dropped by the next collection.
+        if (!this->IsInObjectBeforeCollectCallback())
+        {
+            objectBeforeCollectCallbackMap->Remove(object);
+            return;
+        }
+        if (!this->IsObjectMarked(object))
+        {
+            return;
+        }
+    }
+
     if (objectBeforeCollectCallbackMap == nullptr)
     {
-        if (callback == nullptr) return;
         objectBeforeCollectCallbackMap = HeapNew(ObjectBeforeCollectCallbackMap, &HeapAllocator::Instance);
     }
 
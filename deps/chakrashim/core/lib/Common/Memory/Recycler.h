@@ -301,6 +301,13 @@ class RecyclerWeakReferenceRegion {
 #define RecyclerHeapDelete(recycler,heapInfo,addr) (static_cast<Recycler *>(recycler)->HeapFree(heapInfo,addr))
 
 typedef void (__cdecl* ExternalRootMarker)(void *);
+// Unlike the root marker, the scanner is called in partial collections as well,
+// for hosts that keep recycler pointers in their own memory like on the stack
+typedef void (__cdecl* ExternalRootScanner)(void *, RecyclerScanMemoryCallback&);
+// Allocation sampling reports the sampled objects with an id, and reports the id again once
+// the object is found unmarked at the end of a mark
+typedef void (__cdecl* AllocationSampleCallback)(void *, uint sampleId, size_t size);
+typedef void (__cdecl* AllocationSampleFreeCallback)(void *, uint sampleId);
 
 class RecyclerCollectionWrapper
 {
@@ -539,17 +546,21 @@ class RecyclerParallelThread
     friend class ThreadContext;
 
 public:
-    typedef void (Recycler::* WorkFunc)();
-
-    RecyclerParallelThread(Recycler * recycler, WorkFunc workFunc) :
-        recycler(recycler),
-        workFunc(workFunc),
+    RecyclerParallelThread() :
+        recycler(nullptr),
+        parallelId(0),
         concurrentWorkReadyEvent(NULL),
         concurrentWorkDoneEvent(NULL),
         concurrentThread(NULL)
     {
     }
 
+    void Initialize(Recycler * recycler, uint parallelId)
+    {
+        this->recycler = recycler;
+        this->parallelId = parallelId;
+    }
+
     ~RecyclerParallelThread()
     {
         Assert(concurrentThread == NULL);
@@ -570,7 +581,7 @@ class RecyclerParallelThread
     static void CALLBACK StaticBackgroundWorkCallback(void * callbackData);
 
 private:
-    WorkFunc workFunc;
+    uint parallelId;
     Recycler * recycler;
     HANDLE concurrentWorkReadyEvent;// main thread uses this event to tell concurrent threads that the work is ready
     HANDLE concurrentWorkDoneEvent;// concurrent threads use this event to tell main thread that the work allocated is done
@@ -836,23 +847,40 @@ class Recycler
     static const int PrimaryMarkStackReservedPageCount =
         ((SmallAllocationBlockAttributes::PageCount * MarkContext::MarkCandidateSize) / SmallAllocationBlockAttributes::MinObjectSize) + 1;
 
+    // Most threads that mark in parallel, which is also the most ways a mark stack can be split
+    static const uint MaxParallelism = PageStack<void *>::MaxSplitTargets + 1;
+
     MarkContext markContext;
 
-    // Contexts for parallel marking.
-    // We support up to 4 way parallelism, main context + 3 additional parallel contexts.
-    MarkContext parallelMarkContext1;
-    MarkContext parallelMarkContext2;
-    MarkContext parallelMarkContext3;
+    // Context for one of the additional threads of a parallel mark, with the page pool for its stacks
+    struct ParallelMarkContext
+    {
+        ParallelMarkContext(Recycler * recycler, Js::ConfigFlagsTable& flagsTable) :
+            pagePool(flagsTable),
+            markContext(recycler, &pagePool)
+        {
+        }
+
+        PagePool pagePool;
+        MarkContext markContext;
+    };
+
+    // Contexts for parallel marking, created when the recycler is initialized.
+    // We support up to [maxParallelism] way parallelism, main context + [maxParallelism - 1] additional parallel contexts.
+    // The first one is marked by the collecting thread during a foreground parallel mark, parallel thread N marks
+    // parallelMarkContexts[N + 1].
+    ParallelMarkContext * parallelMarkContexts[MaxParallelism - 1];
+    uint parallelMarkContextCount;
 
-    // Page pools for above markContexts
+    // Page pool for above markContext
     PagePool markPagePool;
-    PagePool parallelMarkPagePool1;
-    PagePool parallelMarkPagePool2;
-    PagePool parallelMarkPagePool3;
+
+    // Lets the threads of a parallel mark take work from each other
+    ParallelMarkWorkPool parallelMarkWorkPool;
 
     bool IsMarkStackEmpty();
-    bool HasPendingMarkObjects() const { return markContext.HasPendingMarkObjects() || parallelMarkContext1.HasPendingMarkObjects() || parallelMarkContext2.HasPendingMarkObjects() || parallelMarkContext3.HasPendingMarkObjects(); }
-    bool HasPendingTrackObjects() const { return markContext.HasPendingTrackObjects() || parallelMarkContext1.HasPendingTrackObjects() || parallelMarkContext2.HasPendingTrackObjects() || parallelMarkContext3.HasPendingTrackObjects(); }
+    bool HasPendingMarkObjects() const;
+    bool HasPendingTrackObjects() const;
 
     RecyclerCollectionWrapper * collectionWrapper;
 
@@ -915,6 +943,10 @@ class Recycler
     bool hasDisposableObject;
     bool hasNativeGCHost;
     DWORD tickCountNextDispose;
+    // Set while DoIdleWork disposes objects: dispose stops between heap blocks once the deadline
+    // passes and leaves the rest for the next idle period
+    bool hasDisposeDeadline;
+    DWORD disposeDeadlineTick;
     bool inExhaustiveCollection;
     bool hasExhaustiveCandidate;
     bool inCacheCleanupCollection;
@@ -972,8 +1004,11 @@ class Recycler
     bool enableConcurrentMark;
     bool enableParallelMark;
     bool enableConcurrentSweep;
+    bool enableIncrementalMark;     // Mark in slices on the script thread instead of the background thread, see RecyclerIncrementalMark
+    bool inIncrementalMark;
 
-    uint maxParallelism;        // Max # of total threads to run in parallel
+    uint maxParallelism;        // Max # of total threads to run in parallel, see MaxParallelMarkThreads
+    uint numaNode;              // NUMA node the background threads are bound to, see RecyclerNumaAffinity
 
     byte backgroundRescanCount;             // for ETW events and stats
     byte backgroundFinishMarkCount;
@@ -982,11 +1017,9 @@ class Recycler
     HANDLE concurrentWorkDoneEvent; // concurrent threads use this event to tell main thread that the work allocated is done
     HANDLE concurrentThread;
 
-    template <uint parallelId>
-    void ParallelWorkFunc();
+    void ParallelWorkFunc(uint parallelId);
 
-    RecyclerParallelThread parallelThread1;
-    RecyclerParallelThread parallelThread2;
+    RecyclerParallelThread parallelThreads[MaxParallelism - 2];
 
 #if DBG
     // Variable indicating if the concurrent thread has exited or not
@@ -1036,6 +1069,7 @@ class Recycler
 
     uint tickCountNextCollection;
     uint tickCountNextFinishCollection;
+    RecyclerPauseBudgetHeuristic pauseBudgetHeuristic;
 
     void (*outOfMemoryFunc)();
 #ifdef RECYCLER_TEST_SUPPORT
@@ -1043,6 +1077,20 @@ class Recycler
 #endif
     ExternalRootMarker externalRootMarker;
     void * externalRootMarkerContext;
+    ExternalRootScanner externalRootScanner;
+    void * externalRootScannerContext;
+
+    // Allocation sampling; bytesUntilAllocationSample stays at SIZE_MAX while sampling is off
+    typedef JsUtil::BaseDictionary<void *, uint, HeapAllocator, PrimeSizePolicy, RecyclerPointerComparer,
+        JsUtil::SimpleDictionaryEntry, JsUtil::NoResizeLock> AllocationSampleMap;
+    size_t allocationSampleInterval;
+    size_t bytesUntilAllocationSample;
+    AllocationSampleCallback allocationSampleCallback;
+    AllocationSampleFreeCallback allocationSampleFreeCallback;
+    void * allocationSampleContext;
+    AllocationSampleMap * allocationSamples;
+    uint nextAllocationSampleId;
+    bool isInAllocationSampleCallback;
 
 #ifdef PROFILE_EXEC
     Js::Profiler * profiler;
@@ -1177,6 +1225,7 @@ class Recycler
     bool HasNativeGCHost() const;
     void SetHasNativeGCHost();
     bool ShouldIdleCollectOnExit();
+    DWORD DoIdleWork(DWORD deadlineTick);
     void ScheduleNextCollection();
 
     BOOL IsShuttingDown() const { return this->isShuttingDown; }
@@ -1214,6 +1263,23 @@ class Recycler
 
     // Finalizer support
     void SetExternalRootMarker(ExternalRootMarker fn, void * context);
+    void SetExternalRootScanner(ExternalRootScanner fn, void * context);
+
+    // Allocation sampling: an allocation is sampled about every sampleInterval bytes. The gaps
+    // between samples are drawn from an exponential distribution, so every allocated byte is
+    // equally likely to be sampled and regular allocation patterns don't bias the samples.
+    void SetAllocationSampling(size_t sampleInterval, AllocationSampleCallback sampleCallback,
+        AllocationSampleFreeCallback freeCallback, void * context);
+    bool IsAllocationSamplingEnabled() const { return allocationSampleCallback != nullptr; }
+    void CountAllocationForSampling(void * address, size_t size)
+    {
+        if (size < bytesUntilAllocationSample)
+        {
+            bytesUntilAllocationSample -= size;
+            return;
+        }
+        SampleAllocation(address, size);
+    }
     ArenaAllocator * CreateGuestArena(char16 const * name, void (*outOfMemoryFunc)());
     void DeleteGuestArena(ArenaAllocator * arenaAllocator);
     ArenaData ** RegisterExternalGuestArena(ArenaData* guestArena)
@@ -1255,14 +1321,20 @@ class Recycler
 #endif
 
     void AddExternalMemoryUsage(size_t size);
+    void AddExternalMemoryPressure(size_t size);
 
     bool NeedDispose() { return this->hasDisposableObject; }
+    bool IsDisposeDeadlinePassed() const
+    {
+        return this->hasDisposeDeadline && (int)(this->disposeDeadlineTick - ::GetTickCount()) <= 0;
+    }
 
     template <CollectionFlags flags>
     bool FinishDisposeObjectsNow();
     bool RequestExternalMemoryAllocation(size_t size);
     void ReportExternalMemoryFailure(size_t size);
     void ReportExternalMemoryFree(size_t size);
+    size_t GetMaxUncollectedAllocBytes();
     // ExternalAllocFunc returns true when allocation succeeds
     template <typename ExternalAllocFunc>
     bool DoExternalAllocation(size_t size, ExternalAllocFunc externalAllocFunc);
@@ -1422,6 +1494,8 @@ class Recycler
     void HeapFree(HeapInfo* eHeap,void* candidate);
 
     void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
+    // Fills HeapSpaceCount entries with the used/committed bytes of each heap space
+    void GetHeapSpaceStats(HeapSpaceStats * spaceStats);
 
     void RootAddRef(void* obj, uint *count = nullptr);
     void RootRelease(void* obj, uint *count = nullptr);
@@ -1509,6 +1583,8 @@ class Recycler
     template <CollectionFlags flags>
     BOOL CollectWithHeuristic();
     template <CollectionFlags flags>
+    BOOL CollectWithPauseBudget();
+    template <CollectionFlags flags>
     BOOL CollectWithExhaustiveCandidate();
     template <CollectionFlags flags>
     BOOL GetPartialFlag();
@@ -1598,6 +1674,10 @@ class Recycler
 #if ENABLE_CONCURRENT_GC
     void DoParallelMark();
     void DoBackgroundParallelMark();
+    void CreateParallelMarkContexts();
+    void StartParallelMarkWorkSharing(MarkContext ** markContexts, uint count);
+    void RemoveParallelMarker(MarkContext * markContext);
+    void StopParallelMarkWorkSharing(MarkContext ** markContexts, uint count);
 #endif
 
     size_t RootMark(CollectionState markState);
@@ -1760,6 +1840,10 @@ class Recycler
     BOOL FinishConcurrentCollectWrapped(CollectionFlags flags);
     void BackgroundMark();
     void BackgroundMarkWeakRefs();
+    void StartIncrementalMark();
+    void DoIncrementalMarkSlice(uint sliceTime);
+    void FinishIncrementalMark();
+    bool ProcessMarkSlice(uint objectCount);
     void BackgroundResetMarks();
     void PrepareBackgroundFindRoots();
     void RevertPrepareBackgroundFindRoots();
@@ -1952,6 +2036,24 @@ class Recycler
         void SetupForHeapEnumeration();
     };
 
+    // Marks the heap without collecting and keeps collection disabled for the lifetime of the
+    // object, so the marked objects can be enumerated as the live object graph (heap snapshots).
+    // Nothing may be allocated from the recycler while a heap walk is active.
+    typedef void (*HeapWalkCallback)(void * address, size_t size, bool isLeaf, void * context);
+    class AutoHeapWalk
+    {
+    private:
+        Recycler * m_recycler;
+        AutoSetupRecyclerForNonCollectingMark m_setup;
+
+        template <class TBlockAttributes>
+        void ForEachLiveObject(SmallHeapBlockT<TBlockAttributes> * heapBlock, HeapWalkCallback callback, void * context);
+    public:
+        AutoHeapWalk(Recycler * recycler);
+        ~AutoHeapWalk();
+        void ForEachLiveObject(HeapWalkCallback callback, void * context);
+    };
+
     friend class RecyclerHeapObjectInfo;
 
     bool FindImplicitRootObject(void* candidate, RecyclerHeapObjectInfo& heapObject);
@@ -2065,6 +2167,10 @@ class Recycler
 
     bool ProcessObjectBeforeCollectCallbacks(bool atShutdown = false);
 
+    void SampleAllocation(void * address, size_t size);
+    size_t GetNextAllocationSampleDistance() const;
+    void ProcessAllocationSamples();
+
 #if GLOBAL_ENABLE_WRITE_BARRIER
 private:
     typedef JsUtil::BaseDictionary<void *, size_t, HeapAllocator, PrimeSizePolicy, RecyclerPointerComparer, JsUtil::SimpleDictionaryEntry, JsUtil::AsymetricResizeLock> PendingWriteBarrierBlockMap;
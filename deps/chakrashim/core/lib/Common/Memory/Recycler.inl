@@ -218,6 +218,7 @@ Recycler::AllocWithAttributesInlined(DECLSPEC_GUARD_OVERFLOW size_t size)
 #ifdef RECYCLER_PAGE_HEAP
     VerifyPageHeapFillAfterAlloc(memBlock, size, attributes);
 #endif
+    this->CountAllocationForSampling(memBlock, size);
     return memBlock;
 }
 
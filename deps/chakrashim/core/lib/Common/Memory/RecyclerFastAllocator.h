@@ -78,6 +78,7 @@ class RecyclerFastAllocator
 #ifdef RECYCLER_PAGE_HEAP
         recycler->VerifyPageHeapFillAfterAlloc(memBlock, size, attributes);
 #endif
+        recycler->CountAllocationForSampling(memBlock, sizeof(T));
         return memBlock;
     };
     static uint32 GetEndAddressOffset()
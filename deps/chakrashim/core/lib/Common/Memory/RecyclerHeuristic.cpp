@@ -78,6 +78,77 @@ RecyclerHeuristic::UncollectedAllocBytesCollection()
     return DefaultUncollectedAllocBytesCollection;
 }
 
+RecyclerPauseBudgetHeuristic::RecyclerPauseBudgetHeuristic() :
+    pauseBudgetMs(0),
+    cpuSharePercent(0),
+    triggerBytes(RecyclerHeuristic::UncollectedAllocBytesCollection()),
+    allocationBytesPerMs(0),
+    pauseMsPerMB(DefaultPauseMsPerMB),
+    survivalRatio(0),
+    lastPauseMs(0),
+    currentPauseMs(0),
+    usedBytesAtStart(0),
+    usedBytesAfterLastCollection(0),
+    currentIsConcurrent(false),
+    lastCollectionTickCount(::GetTickCount())
+{
+}
+
+void
+RecyclerPauseBudgetHeuristic::Initialize(Js::ConfigFlagsTable& flags)
+{
+    this->pauseBudgetMs = (uint)max(flags.RecyclerPauseBudget, 0);
+    this->cpuSharePercent = (uint)min(max(flags.RecyclerGCCpuShare, 1), 99);
+}
+
+double
+RecyclerPauseBudgetHeuristic::PredictPauseMs(size_t usedBytes) const
+{
+    return this->pauseMsPerMB * usedBytes / (1 MEGABYTES);
+}
+
+void
+RecyclerPauseBudgetHeuristic::StartCollection(size_t usedBytes, bool concurrent)
+{
+    // The pause of the previous collection is only complete once script is back, an in thread collection
+    // finishes before the call that started it returns.
+    this->lastPauseMs = this->currentPauseMs;
+
+    // Only an in thread collection measures the whole marking cost, a concurrent one pauses for part of it
+    if (!this->currentIsConcurrent && this->usedBytesAtStart >= 1 MEGABYTES)
+    {
+        this->pauseMsPerMB = Average(this->pauseMsPerMB, this->currentPauseMs * (1 MEGABYTES) / this->usedBytesAtStart);
+    }
+
+    this->usedBytesAtStart = usedBytes;
+    this->currentIsConcurrent = concurrent;
+    this->currentPauseMs = 0;
+}
+
+void
+RecyclerPauseBudgetHeuristic::FinishCollection(size_t allocatedBytes, size_t usedBytes)
+{
+    DWORD tickCount = ::GetTickCount();
+    DWORD intervalMs = max(tickCount - this->lastCollectionTickCount, (DWORD)1);
+    this->lastCollectionTickCount = tickCount;
+    this->allocationBytesPerMs = Average(this->allocationBytesPerMs, (double)allocatedBytes / intervalMs);
+
+    // How much of what was allocated since the last collection is still alive
+    if (allocatedBytes != 0)
+    {
+        double survived = usedBytes > this->usedBytesAfterLastCollection ? (double)(usedBytes - this->usedBytesAfterLastCollection) : 0;
+        this->survivalRatio = Average(this->survivalRatio, min(survived / allocatedBytes, 1.0));
+    }
+    this->usedBytesAfterLastCollection = usedBytes;
+
+    // Spending cost ms per collection, collecting every trigger bytes keeps GC at the CPU share when
+    // cost / (cost + trigger / allocation rate) == share
+    double costMs = PredictPauseMs(usedBytes);
+    double trigger = this->allocationBytesPerMs * costMs * (100 - this->cpuSharePercent) / this->cpuSharePercent;
+    this->triggerBytes = (size_t)min(max(trigger, (double)RecyclerHeuristic::UncollectedAllocBytesCollection()),
+        (double)RecyclerHeuristic::Instance.MaxUncollectedAllocBytes);
+}
+
 #if ENABLE_CONCURRENT_GC
 uint
 RecyclerHeuristic::MaxBackgroundFinishMarkCount(Js::ConfigFlagsTable& flags)
@@ -157,6 +228,23 @@ RecyclerHeuristic::PriorityBoostTimeout(Js::ConfigFlagsTable& flags)
 }
 #endif
 
+#if ENABLE_PARTIAL_GC
+uint
+RecyclerHeuristic::MinPartialUncollectedNewPageCount(Js::ConfigFlagsTable& flags)
+{
+    // The new pages allocated since the last collect are the young generation that a partial collect
+    // sweeps. A bigger nursery gives short lived objects more time to die before they are marked.
+    // Compare in megabytes first so that a large flag value can't overflow the page count.
+    const uint pagesPerMegabyte = 1 MEGABYTES_OF_PAGES;
+    const uint nurseryMegabytes = (uint)max(flags.RecyclerNurserySize, 1);
+    if (nurseryMegabytes >= Instance.MaxPartialUncollectedNewPageCount / pagesPerMegabyte)
+    {
+        return Instance.MaxPartialUncollectedNewPageCount;
+    }
+    return nurseryMegabytes * pagesPerMegabyte;
+}
+#endif
+
 #if ENABLE_PARTIAL_GC && ENABLE_CONCURRENT_GC
 bool
 RecyclerHeuristic::PartialConcurrentNextCollection(double ratio, Js::ConfigFlagsTable& flags)
@@ -43,6 +43,9 @@ class RecyclerHeuristic
     static DWORD FinishConcurrentCollectWaitTime(Js::ConfigFlagsTable&);
     static DWORD PriorityBoostTimeout(Js::ConfigFlagsTable&);
 #endif
+#if ENABLE_PARTIAL_GC
+    static uint MinPartialUncollectedNewPageCount(Js::ConfigFlagsTable& flags);
+#endif
 #if ENABLE_PARTIAL_GC && ENABLE_CONCURRENT_GC
     static bool PartialConcurrentNextCollection(double ratio, Js::ConfigFlagsTable& flags);
 #endif
@@ -65,6 +68,9 @@ class RecyclerHeuristic
     // then trigger a second repeat mark pass.
     static const uint BackgroundSecondRepeatMarkThreshold = 128;
 
+    // Number of objects an incremental mark slice scans between checks of its time budget.
+    static const uint IncrementalMarkObjectsPerBudgetCheck = 256;
+
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     // Number of blocks a heap bucket needs to have before allocations during concurrent sweep feature kicks-in.
 #if DBG
@@ -90,4 +96,55 @@ class RecyclerHeuristic
     static const size_t DefaultMinBackgroundRepeatMarkRescanBytes = 1 MEGABYTES;
 #endif
 };
+
+// Collection triggers for -RecyclerPauseBudget. Instead of the fixed byte and time thresholds above, the next
+// collection is triggered once enough has been allocated that, at the measured allocation rate, the script
+// thread spends no more than -RecyclerGCCpuShare percent of its time collecting. Collections run in thread
+// while their predicted pause fits the budget and concurrently once it doesn't, and partial while most of
+// what was allocated since the last collection dies young.
+class RecyclerPauseBudgetHeuristic
+{
+public:
+    RecyclerPauseBudgetHeuristic();
+
+    void Initialize(Js::ConfigFlagsTable& flags);
+    bool IsEnabled() const { return this->pauseBudgetMs != 0; }
+
+    void StartCollection(size_t usedBytes, bool concurrent);
+    void RecordPause(double pauseMs) { this->currentPauseMs += pauseMs; }
+    void FinishCollection(size_t allocatedBytes, size_t usedBytes);
+
+    size_t GetTriggerBytes() const { return this->triggerBytes; }
+    bool PreferPartialCollect() const { return this->survivalRatio < MaxPartialCollectSurvivalRatio; }
+    bool PreferInThreadCollect(size_t usedBytes) const { return PredictPauseMs(usedBytes) <= this->pauseBudgetMs; }
+
+    double GetAllocationBytesPerMs() const { return this->allocationBytesPerMs; }
+    double GetSurvivalRatio() const { return this->survivalRatio; }
+    double GetLastPauseMs() const { return this->lastPauseMs; }
+
+private:
+    double PredictPauseMs(size_t usedBytes) const;
+    static double Average(double average, double sample) { return average + (sample - average) * SampleWeight; }
+
+    // Moving averages weigh each new collection by this much
+    static constexpr double SampleWeight = 0.25;
+    // Marking cost assumed until an in thread collection has been measured (about 1GB/s)
+    static constexpr double DefaultPauseMsPerMB = 1.0;
+    static constexpr double MaxPartialCollectSurvivalRatio = 0.5;
+
+    uint pauseBudgetMs;
+    uint cpuSharePercent;
+
+    size_t triggerBytes;
+    double allocationBytesPerMs;
+    double pauseMsPerMB;
+    double survivalRatio;
+    double lastPauseMs;
+
+    double currentPauseMs;
+    size_t usedBytesAtStart;
+    size_t usedBytesAfterLastCollection;
+    bool currentIsConcurrent;
+    DWORD lastCollectionTickCount;
+};
 }
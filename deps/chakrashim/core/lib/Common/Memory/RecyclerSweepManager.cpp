@@ -9,7 +9,6 @@
 #define MEGABYTES * 1024 KILOBYTES
 #define MEGABYTES_OF_PAGES * 1024 * 1024 / AutoSystemInfo::PageSize;
 
-const uint RecyclerSweepManager::MinPartialUncollectedNewPageCount = 4 MEGABYTES_OF_PAGES;
 const uint RecyclerSweepManager::MaxPartialCollectRescanRootBytes = 5 MEGABYTES;
 static const uint MinPartialCollectRescanRootBytes = 128 KILOBYTES;
 
@@ -503,10 +502,11 @@ RecyclerSweepManager::AdjustPartialHeuristics()
     Assert(0.0 <= ratio && ratio <= 1.0);
 
     // Linear scale the partial GC new page heuristic using the ratio calculated
-    recycler->uncollectedNewPageCountPartialCollect = MinPartialUncollectedNewPageCount
-        + (size_t)((double)(RecyclerHeuristic::Instance.MaxPartialUncollectedNewPageCount - MinPartialUncollectedNewPageCount) * ratio);
+    const uint minPartialUncollectedNewPageCount = RecyclerHeuristic::MinPartialUncollectedNewPageCount(recycler->GetRecyclerFlagsTable());
+    recycler->uncollectedNewPageCountPartialCollect = minPartialUncollectedNewPageCount
+        + (size_t)((double)(RecyclerHeuristic::Instance.MaxPartialUncollectedNewPageCount - minPartialUncollectedNewPageCount) * ratio);
 
-    Assert(recycler->uncollectedNewPageCountPartialCollect >= MinPartialUncollectedNewPageCount &&
+    Assert(recycler->uncollectedNewPageCountPartialCollect >= minPartialUncollectedNewPageCount &&
         recycler->uncollectedNewPageCountPartialCollect <= RecyclerHeuristic::Instance.MaxPartialUncollectedNewPageCount);
 
     // If the number of new page to reach the partial heuristics plus the existing uncollectedAllocBytes
@@ -51,7 +51,6 @@ class RecyclerSweepManager
     void NotifyAllocableObjects(SmallHeapBlockT<TBlockAttributes> * smallHeapBlock);
     void AddUnusedFreeByteCount(uint expectedFreeByteCount);
 
-    static const uint MinPartialUncollectedNewPageCount; // 4MB pages
     static const uint MaxPartialCollectRescanRootBytes; // 5MB
 #endif
 
@@ -177,6 +177,15 @@ namespace Memory
                 stats->startPassProcessingElapsedTime = Js::Tick::Now() - start;
 
                 stats->pinnedObjectCount = this->recycler->pinnedObjectMap.Count();
+
+                const RecyclerPauseBudgetHeuristic& pauseBudgetHeuristic = this->recycler->pauseBudgetHeuristic;
+                if (pauseBudgetHeuristic.IsEnabled())
+                {
+                    stats->pauseBudgetTriggerBytes = pauseBudgetHeuristic.GetTriggerBytes();
+                    stats->pauseBudgetAllocationBytesPerMs = pauseBudgetHeuristic.GetAllocationBytesPerMs();
+                    stats->pauseBudgetSurvivalRatio = pauseBudgetHeuristic.GetSurvivalRatio();
+                    stats->pauseBudgetLastPauseMs = pauseBudgetHeuristic.GetLastPauseMs();
+                }
             }
         }
     }
@@ -207,6 +216,7 @@ namespace Memory
         this->FillInSizeData(this->recycler->GetHeapInfo()->GetRecyclerLeafPageAllocator(), &lastPassStats->threadPageAllocator_end);
         this->FillInSizeData(this->recycler->GetHeapInfo()->GetRecyclerPageAllocator(), &lastPassStats->recyclerLeafPageAllocator_end);
         this->FillInSizeData(this->recycler->GetHeapInfo()->GetRecyclerLargeBlockPageAllocator(), &lastPassStats->recyclerLargeBlockPageAllocator_end);
+        lastPassStats->threadPageAllocator_arenaStats = this->recycler->GetHeapInfo()->GetRecyclerLeafPageAllocator()->GetArenaPageStats();
 #ifdef RECYCLER_WRITE_BARRIER_ALLOC_SEPARATE_PAGE
         this->FillInSizeData(this->recycler->GetHeapInfo()->GetRecyclerWithBarrierPageAllocator(), &lastPassStats->recyclerWithBarrierPageAllocator_end);
 #endif
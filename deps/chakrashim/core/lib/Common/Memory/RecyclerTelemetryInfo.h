@@ -68,6 +68,12 @@ namespace Memory
         uint closedContextCount;
         uint pinnedObjectCount;
 
+        // -RecyclerPauseBudget estimates when the pass started, zero when the budget isn't set
+        size_t pauseBudgetTriggerBytes;
+        double pauseBudgetAllocationBytesPerMs;
+        double pauseBudgetSurvivalRatio;
+        double pauseBudgetLastPauseMs;
+
         size_t processAllocaterUsedBytes_start;
         size_t processAllocaterUsedBytes_end;
         size_t processCommittedBytes_start;
@@ -82,6 +88,9 @@ namespace Memory
         AllocatorSizes recyclerLargeBlockPageAllocator_start;
         AllocatorSizes recyclerLargeBlockPageAllocator_end;
 
+        // Arena blocks of the thread page allocator, including the high-water marks
+        AllocatorArenaPageStats threadPageAllocator_arenaStats;
+
 #ifdef RECYCLER_WRITE_BARRIER_ALLOC_SEPARATE_PAGE
         AllocatorSizes recyclerWithBarrierPageAllocator_start;
         AllocatorSizes recyclerWithBarrierPageAllocator_end;
@@ -139,11 +139,21 @@ template <class TBlockType>
 void
 SmallFinalizableHeapBucketBaseT<TBlockType>::DisposeObjects()
 {
-    HeapBlockList::ForEach(this->pendingDisposeList, [](TBlockType * heapBlock)
+    Recycler * recycler = this->heapInfo->recycler;
+    for (TBlockType * heapBlock = this->pendingDisposeList; heapBlock != nullptr; heapBlock = heapBlock->GetNextBlock())
     {
         Assert(heapBlock->HasAnyDisposeObjects());
+        if (!heapBlock->HasPendingDisposeObjects())
+        {
+            // Already disposed by a dispose that stopped at its deadline
+            continue;
+        }
+        if (recycler->IsDisposeDeadlinePassed())
+        {
+            break;
+        }
         heapBlock->DisposeObjects();
-    });
+    }
 }
 
 template <class TBlockType>
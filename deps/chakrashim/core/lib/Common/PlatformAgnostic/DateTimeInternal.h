@@ -94,7 +94,37 @@ namespace DateTime
 
 #else // ! _WIN32
 
-    typedef void* DaylightTimeHelperPlatformData;
+    // Caches the intervals over which the local time offset doesn't change, so that converting
+    // between UTC and local time only calls localtime_r when a time falls outside of them
+    class DaylightTimeHelperPlatformData // DateTime.cpp
+    {
+    public:
+        struct OffsetInterval
+        {
+            // the offset holds for every second in [startSeconds, endSeconds]
+            int64 startSeconds;
+            int64 endSeconds;
+            int offset;
+            bool isDaylightSavings;
+            uint64 lastUse;
+        };
+
+        static const int IntervalCount = 8;
+
+        OffsetInterval intervals[IntervalCount];
+        int intervalCount;
+        uint64 useCount;
+        uint32 lastUpdateTickCount;
+
+        DaylightTimeHelperPlatformData() :
+            intervalCount(0),
+            useCount(0),
+            lastUpdateTickCount(0)
+        {
+        }
+
+        void GetOffset(int64 seconds, int *offset, bool *isDaylightSavings);
+    };
 
     #define __CC_PA_TIMEZONE_ABVR_NAME_LENGTH 32
     struct UtilityPlatformData
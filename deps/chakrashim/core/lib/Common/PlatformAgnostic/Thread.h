@@ -19,11 +19,28 @@ class Thread
     typedef uintptr_t ThreadHandle;
 
     static const uintptr_t InvalidHandle = (uintptr_t)-1;
+    static const unsigned int InvalidNumaNode = (unsigned int)-1;
 
     static ThreadHandle Create(unsigned int stack_size,
                                unsigned int ( *start_address )( void * ),
                                void* arg_list,
                                ThreadInitFlag init_flag,
                                const char16* description);
+
+    // NUMA node of the processor the calling thread is currently running on, or InvalidNumaNode if unknown
+    static unsigned int GetCurrentNumaNode();
+
+    // Restrict the calling thread to the processors of the given NUMA node
+    static bool SetCurrentThreadNumaNode(unsigned int node);
+
+#ifndef _WIN32
+    // Block the calling thread while *address == expected, until WakeAddress is called for the address
+    // or timeout ms have passed (INFINITE waits without a timeout). This can also return spuriously,
+    // so callers must recheck their condition.
+    static void WaitOnAddress(volatile int32 *address, int32 expected, uint32 timeout);
+
+    // Wake all threads waiting on the address
+    static void WakeAddress(volatile int32 *address);
+#endif
 };
 } // namespace PlatformAgnostic
@@ -107,6 +107,21 @@ typedef enum _JsPromiseState
     JsPromiseStateRejected = 0x2
 } JsPromiseState;
 
+/// <summary>
+///     The proxy traps a native proxy can implement, see <c>JsCreateNativeProxy</c>.
+/// </summary>
+typedef enum _JsNativeProxyTrap
+{
+    JsNativeProxyTrapGetOwnPropertyDescriptor = 0x0,
+    JsNativeProxyTrapDefineProperty = 0x1,
+    JsNativeProxyTrapHas = 0x2,
+    JsNativeProxyTrapGet = 0x3,
+    JsNativeProxyTrapSet = 0x4,
+    JsNativeProxyTrapDeleteProperty = 0x5,
+    JsNativeProxyTrapOwnKeys = 0x6,
+    JsNativeProxyTrapCount = 0x7
+} JsNativeProxyTrap;
+
 /// <summary>
 ///     User implemented callback to fetch additional imported modules in ES modules.
 /// </summary>
@@ -216,6 +231,162 @@ typedef _Ret_maybenull_ JsValueRef(CHAKRA_CALLBACK * JsEnhancedNativeFunction)(_
 /// <param name="callbackState">The state passed to <c>JsSetHostPromiseRejectionTracker</c>.</param>
 typedef void (CHAKRA_CALLBACK *JsHostPromiseRejectionTrackerCallback)(_In_ JsValueRef promise, _In_ JsValueRef reason, _In_ bool handled, _In_opt_ void *callbackState);
 
+/// <summary>
+///     A callback telling the host that promise jobs are waiting to be run.
+/// </summary>
+/// <remarks>
+///     The host can specify this callback in <c>JsSetPromiseJobsPendingCallback</c>. It is called
+///     when a job is queued while the queue is empty and no <c>JsRunPromiseJobs</c> call is draining it.
+///     The host should call <c>JsRunPromiseJobs</c> once it is ready to run them.
+///     Note - the callback must not call into script or set an exception.
+/// </remarks>
+/// <param name="callbackState">The state passed to <c>JsSetPromiseJobsPendingCallback</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsPromiseJobsPendingCallback)(_In_opt_ void *callbackState);
+
+/// <summary>
+///     The phase of a garbage collection reported to a <c>JsCollectEventCallback</c>.
+/// </summary>
+typedef enum _JsCollectEventType
+{
+    JsCollectEventBegin = 0x0,
+    JsCollectEventEnd = 0x1
+} JsCollectEventType;
+
+/// <summary>
+///     The kind of a garbage collection reported to a <c>JsCollectEventCallback</c>.
+/// </summary>
+/// <remarks>
+///     A collection that is neither partial nor concurrent is a full, in-thread collection.
+/// </remarks>
+typedef enum _JsCollectKind
+{
+    JsCollectKindFull = 0x0,
+    JsCollectKindConcurrent = 0x1,
+    JsCollectKindPartial = 0x2
+} JsCollectKind;
+
+/// <summary>
+///     A callback called when a garbage collection begins and when it ends.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Use <c>JsSetRuntimeCollectEventCallback</c> to register this callback.
+///     </para>
+///     <para>
+///     The callback is invoked on the runtime thread while the recycler is collecting. It must
+///     not call back into the engine or allocate JavaScript objects.
+///     </para>
+/// </remarks>
+/// <param name="eventType">Whether the collection is beginning or ending.</param>
+/// <param name="collectKind">
+///     A combination of <c>JsCollectKind</c> values describing the collection. The end event
+///     reports the same kind as the matching begin event.
+/// </param>
+/// <param name="callbackState">The state passed to <c>JsSetRuntimeCollectEventCallback</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsCollectEventCallback)(_In_ JsCollectEventType eventType, _In_ JsCollectKind collectKind, _In_opt_ void *callbackState);
+
+/// <summary>
+///     The execution tier of a frame reported to a <c>JsSampleCallback</c>.
+/// </summary>
+typedef enum _JsSampleFrameKind
+{
+    JsSampleFrameInterpreted = 0x0,
+    JsSampleFrameSimpleJit = 0x1,
+    JsSampleFrameFullJit = 0x2
+} JsSampleFrameKind;
+
+/// <summary>
+///     A JavaScript frame captured by a runtime sample.
+/// </summary>
+/// <remarks>
+///     Line and column numbers are zero-based. The strings are only valid for the duration of
+///     the <c>JsSampleCallback</c> invocation that reports the frame.
+/// </remarks>
+typedef struct _JsSampleFrame
+{
+    /// <summary>The id of the script the function belongs to, as reported by the debugger APIs.</summary>
+    unsigned int scriptId;
+    /// <summary>An id of the function that is unique within its script.</summary>
+    unsigned int functionId;
+    /// <summary>The null-terminated UTF-16 display name of the function.</summary>
+    const uint16_t *functionName;
+    /// <summary>The null-terminated UTF-16 source URL of the script, or an empty string.</summary>
+    const uint16_t *url;
+    /// <summary>The line where the function is declared.</summary>
+    unsigned int functionLine;
+    /// <summary>The column where the function is declared.</summary>
+    unsigned int functionColumn;
+    /// <summary>The line of the statement being executed.</summary>
+    unsigned int line;
+    /// <summary>The column of the statement being executed.</summary>
+    unsigned int column;
+    /// <summary>The tier the function was running in.</summary>
+    JsSampleFrameKind kind;
+} JsSampleFrame;
+
+/// <summary>
+///     A callback called on the runtime thread when a sample requested with
+///     <c>JsRequestRuntimeSample</c> is taken.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Use <c>JsSetRuntimeSampleCallback</c> to register this callback.
+///     </para>
+///     <para>
+///     The callback is invoked while script is running. It must not call back into the engine.
+///     </para>
+/// </remarks>
+/// <param name="frames">The JavaScript frames on the stack, innermost first.</param>
+/// <param name="frameCount">The number of frames.</param>
+/// <param name="callbackState">The state passed to <c>JsSetRuntimeSampleCallback</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsSampleCallback)(_In_reads_(frameCount) const JsSampleFrame *frames, _In_ unsigned int frameCount, _In_opt_ void *callbackState);
+
+/// <summary>
+///     The groups of recycler heap blocks reported by <c>JsGetRuntimeHeapSpaceStatistics</c>.
+/// </summary>
+typedef enum _JsHeapSpace
+{
+    /// <summary>
+    ///     Small blocks holding objects that may contain references.
+    /// </summary>
+    JsHeapSpaceSmallNormal = 0,
+    /// <summary>
+    ///     Small blocks holding leaf objects, which are never scanned for references.
+    /// </summary>
+    JsHeapSpaceSmallLeaf = 1,
+    /// <summary>
+    ///     Small blocks holding objects with finalizers.
+    /// </summary>
+    JsHeapSpaceSmallFinalizable = 2,
+    /// <summary>
+    ///     Medium blocks, of every object kind.
+    /// </summary>
+    JsHeapSpaceMedium = 3,
+    /// <summary>
+    ///     Large object blocks.
+    /// </summary>
+    JsHeapSpaceLarge = 4,
+    /// <summary>
+    ///     The number of heap spaces.
+    /// </summary>
+    JsHeapSpaceCount = 5
+} JsHeapSpace;
+
+/// <summary>
+///     Memory held by one heap space.
+/// </summary>
+typedef struct _JsHeapSpaceStatistics
+{
+    /// <summary>
+    ///     Bytes occupied by allocated objects.
+    /// </summary>
+    size_t usedSize;
+    /// <summary>
+    ///     Bytes of pages committed to the space's blocks, used or not.
+    /// </summary>
+    size_t committedSize;
+} JsHeapSpaceStatistics;
+
 /// <summary>
 ///     Creates a new enhanced JavaScript function.
 /// </summary>
@@ -238,6 +409,75 @@ JsCreateEnhancedFunction(
     _In_opt_ void *callbackState,
     _Out_ JsValueRef *function);
 
+/// <summary>
+///     Creates a new enhanced JavaScript function that owns its callback state.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     The callback state is kept by the function itself and passed to the callback without a
+///     lookup. The <paramref name="finalizeCallback" /> is called with it once the function has
+///     been collected, so hosts do not need a separate external object to release it.
+///     </para>
+/// </remarks>
+/// <param name="nativeFunction">The method to call when the function is invoked.</param>
+/// <param name="metadata">If this is not <c>JS_INVALID_REFERENCE</c>, it is converted to a string and used as the name of the function.</param>
+/// <param name="callbackState">
+///     User provided state that will be passed back to the callback.
+/// </param>
+/// <param name="finalizeCallback">
+///     A callback for when the function is collected, may be null.
+/// </param>
+/// <param name="function">The new function object.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsCreateEnhancedFunctionWithFinalizer(
+    _In_ JsEnhancedNativeFunction nativeFunction,
+    _In_opt_ JsValueRef metadata,
+    _In_opt_ void *callbackState,
+    _In_opt_ JsFinalizeCallback finalizeCallback,
+    _Out_ JsValueRef *function);
+
+/// <summary>
+///     Creates a proxy for an object whose traps are native functions.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     Each trap is called directly, with the same arguments a handler method of a Proxy
+///     created from script would get: the (empty) handler, the target and then the trap
+///     specific arguments. The Proxy invariants are checked on the results as usual.
+///     Operations without a trap are forwarded to the target.
+///     </para>
+///     <para>
+///     Native proxies can't be recorded or replayed, so this returns
+///     <c>JsErrorNotImplemented</c> while Time Travel Debugging is recording or replaying.
+///     </para>
+/// </remarks>
+/// <param name="target">The object to create a proxy for.</param>
+/// <param name="traps">
+///     The traps, indexed by <c>JsNativeProxyTrap</c>. Entries may be null.
+/// </param>
+/// <param name="callbackState">
+///     User provided state that will be passed back to the traps.
+/// </param>
+/// <param name="proxy">The new proxy.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsCreateNativeProxy(
+    _In_ JsValueRef target,
+    _In_reads_(JsNativeProxyTrapCount) const JsNativeFunction *traps,
+    _In_opt_ void *callbackState,
+    _Out_ JsValueRef *proxy);
+
 /// <summary>
 ///     Initialize a ModuleRecord from host
 /// </summary>
@@ -593,6 +833,34 @@ CHAKRA_API
         _In_ size_t length,
         _Out_ JsPropertyIdRef *propertyId);
 
+/// <summary>
+///     Gets the property ID associated with the content of a string.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Property IDs are specific to a context and cannot be used across contexts.
+///     </para>
+///     <para>
+///         Requires an active script context.
+///     </para>
+///     <para>
+///         Unlike copying the string out and calling <c>JsCreatePropertyId</c>, this uses the
+///         string's content directly, and strings that can remember their property ID (such as
+///         those created with <c>JsCreateString</c> or used as property names by script) only
+///         look it up the first time.
+///     </para>
+/// </remarks>
+/// <param name="string">The string.</param>
+/// <param name="propertyId">The property ID in this runtime for the string's content.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if
+///     the value is not a string, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetPropertyIdFromString(
+        _In_ JsValueRef string,
+        _Out_ JsPropertyIdRef *propertyId);
+
 /// <summary>
 ///     Copies the name associated with the property ID into a buffer.
 /// </summary>
@@ -662,6 +930,11 @@ CHAKRA_API
 ///     <para>
 ///     Requires an active script context.
 ///     </para>
+///     <para>
+///     The buffer is not copied and is never written to; functions are deserialized from it the
+///     first time they are called. An ExternalArrayBuffer over a read-only file mapping can be
+///     passed, so that processes running the same serialized script share its pages.
+///     </para>
 /// </remarks>
 /// <param name="buffer">The serialized script as an ArrayBuffer (preferably ExternalArrayBuffer).</param>
 /// <param name="scriptLoadCallback">
@@ -697,6 +970,10 @@ CHAKRA_API
 ///     The runtime will detach the data from the buffer and hold on to it until all
 ///     instances of any functions created from the buffer are garbage collected.
 ///     </para>
+///     <para>
+///     As with <c>JsParseSerialized</c>, the buffer is never written to and can be a read-only
+///     file mapping.
+///     </para>
 /// </remarks>
 /// <param name="buffer">The serialized script as an ArrayBuffer (preferably ExternalArrayBuffer).</param>
 /// <param name="scriptLoadCallback">Callback called when the source code of the script needs to be loaded.</param>
@@ -719,6 +996,77 @@ CHAKRA_API
         _In_ JsValueRef sourceUrl,
         _Out_ JsValueRef *result);
 
+/// <summary>
+///     Parses a serialized script like <c>JsParseSerialized</c>, and tells the host when the
+///     runtime is done with the script.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     A host that holds on to the source for <c>scriptLoadCallback</c> can let it go once the
+///     callback was called, or once <c>scriptUnloadCallback</c> is, whichever comes first. The
+///     unload callback is called while the runtime collects garbage and must not call back into
+///     the runtime.
+///     </para>
+/// </remarks>
+/// <param name="buffer">The serialized script as an ArrayBuffer (preferably ExternalArrayBuffer).</param>
+/// <param name="scriptLoadCallback">Callback called when the source code of the script needs to be loaded.</param>
+/// <param name="scriptUnloadCallback">Callback called when the script and its source are no longer needed.</param>
+/// <param name="sourceContext">
+///     A cookie identifying the script that can be used by debuggable script contexts.
+///     This context will passed into both callbacks.
+/// </param>
+/// <param name="sourceUrl">The location the script came from.</param>
+/// <param name="result">A function representing the script code.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsParseSerializedWithUnloadCallback(
+        _In_ JsValueRef buffer,
+        _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
+        _In_ JsSerializedScriptUnloadCallback scriptUnloadCallback,
+        _In_ JsSourceContext sourceContext,
+        _In_ JsValueRef sourceUrl,
+        _Out_ JsValueRef *result);
+
+/// <summary>
+///     Runs a serialized script like <c>JsRunSerialized</c>, and tells the host when the runtime
+///     is done with the script.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     See <c>JsParseSerializedWithUnloadCallback</c> for when the callbacks are called.
+///     </para>
+/// </remarks>
+/// <param name="buffer">The serialized script as an ArrayBuffer (preferably ExternalArrayBuffer).</param>
+/// <param name="scriptLoadCallback">Callback called when the source code of the script needs to be loaded.</param>
+/// <param name="scriptUnloadCallback">Callback called when the script and its source are no longer needed.</param>
+/// <param name="sourceContext">
+///     A cookie identifying the script that can be used by debuggable script contexts.
+///     This context will passed into both callbacks.
+/// </param>
+/// <param name="sourceUrl">The location the script came from.</param>
+/// <param name="result">
+///     The result of running the script, if any. This parameter can be null.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsRunSerializedWithUnloadCallback(
+        _In_ JsValueRef buffer,
+        _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
+        _In_ JsSerializedScriptUnloadCallback scriptUnloadCallback,
+        _In_ JsSourceContext sourceContext,
+        _In_ JsValueRef sourceUrl,
+        _Out_ JsValueRef *result);
+
 /// <summary>
 ///     Gets the state of a given Promise object.
 /// </summary>
@@ -847,7 +1195,8 @@ JsGetSharedArrayBufferContent(
 ///     Decrease the reference count on a SharedArrayBuffer storage object.
 /// </summary>
 /// <remarks>
-///     Requires an active script context.
+///     Does not require an active script context, the storage object can be released on any
+///     thread. The memory is freed with the last reference.
 /// </remarks>
 /// <param name="sharedContents">
 ///     The storage object of a SharedArrayBuffer which can be shared between multiple thread.
@@ -859,6 +1208,27 @@ CHAKRA_API
 JsReleaseSharedArrayBufferContentHandle(
     _In_ JsSharedArrayBufferContentHandle sharedContents);
 
+/// <summary>
+///     Obtains the memory of a SharedArrayBuffer storage object.
+/// </summary>
+/// <remarks>
+///     Does not require an active script context. The memory stays valid as long as the caller
+///     holds its reference on the storage object.
+/// </remarks>
+/// <param name="sharedContents">
+///     The storage object of a SharedArrayBuffer which can be shared between multiple thread.
+/// </param>
+/// <param name="buffer">The memory of the buffer, may be null when the length is 0.</param>
+/// <param name="bufferLength">The length in bytes.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsGetSharedArrayBufferContentStorage(
+    _In_ JsSharedArrayBufferContentHandle sharedContents,
+    _Outptr_result_maybenull_ BYTE **buffer,
+    _Out_ unsigned int *bufferLength);
+
 /// <summary>
 ///     Determines whether an object has a non-inherited property.
 /// </summary>
@@ -1001,69 +1371,161 @@ CHAKRA_API
         _Out_ JsValueRef *object);
 
 /// <summary>
-///     Gets an object's property.
+///     Creates a new object (with prototype) that stores some external data and a fixed
+///     number of internal fields.
 /// </summary>
 /// <remarks>
+///     <para>
 ///     Requires an active script context.
+///     </para>
+///     <para>
+///     The internal fields are stored in the object itself, start out as
+///     <c>JS_INVALID_REFERENCE</c> and keep the values stored in them alive. A field may also
+///     hold a pointer aligned to at least two bytes, which the engine never dereferences.
+///     </para>
+///     <para>
+///     Internal fields can't be recorded or replayed, so this returns
+///     <c>JsErrorNotImplemented</c> for a non-zero <paramref name="internalFieldCount" /> while
+///     Time Travel Debugging is recording or replaying.
+///     </para>
 /// </remarks>
-/// <param name="object">The object that contains the property.</param>
-/// <param name="key">The key (JavascriptString or JavascriptSymbol) to the property.</param>
-/// <param name="value">The value of the property.</param>
+/// <param name="data">External data that the object will represent. May be null.</param>
+/// <param name="finalizeCallback">
+///     A callback for when the object is finalized. May be null.
+/// </param>
+/// <param name="prototype">Prototype object or nullptr.</param>
+/// <param name="internalFieldCount">The number of internal fields.</param>
+/// <param name="object">The new object.</param>
 /// <returns>
 ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
 /// </returns>
 CHAKRA_API
-    JsObjectGetProperty(
-        _In_ JsValueRef object,
-        _In_ JsValueRef key,
-        _Out_ JsValueRef *value);
+    JsCreateExternalObjectWithInternalFields(
+        _In_opt_ void *data,
+        _In_opt_ JsFinalizeCallback finalizeCallback,
+        _In_opt_ JsValueRef prototype,
+        _In_ unsigned int internalFieldCount,
+        _Out_ JsValueRef *object);
 
 /// <summary>
-///     Puts an object's property.
+///     Gets the number of internal fields of an object.
 /// </summary>
 /// <remarks>
-///     Requires an active script context.
+///     Does not require an active script context.
 /// </remarks>
-/// <param name="object">The object that contains the property.</param>
-/// <param name="key">The key (JavascriptString or JavascriptSymbol) to the property.</param>
-/// <param name="value">The new value of the property.</param>
-/// <param name="useStrictRules">The property set should follow strict mode rules.</param>
+/// <param name="object">The object created by <c>JsCreateExternalObjectWithInternalFields</c>.</param>
+/// <param name="count">The number of internal fields.</param>
 /// <returns>
-///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if
+///     the object is not an external object.
 /// </returns>
 CHAKRA_API
-    JsObjectSetProperty(
+    JsGetInternalFieldCount(
         _In_ JsValueRef object,
-        _In_ JsValueRef key,
-        _In_ JsValueRef value,
-        _In_ bool useStrictRules);
+        _Out_ unsigned int *count);
 
 /// <summary>
-///     Determines whether an object has a property.
+///     Gets an internal field of an object.
 /// </summary>
 /// <remarks>
-///     Requires an active script context.
+///     Does not require an active script context.
 /// </remarks>
-/// <param name="object">The object that may contain the property.</param>
-/// <param name="key">The key (JavascriptString or JavascriptSymbol) to the property.</param>
-/// <param name="hasProperty">Whether the object (or a prototype) has the property.</param>
+/// <param name="object">The object created by <c>JsCreateExternalObjectWithInternalFields</c>.</param>
+/// <param name="index">The index of the field.</param>
+/// <param name="value">The value of the field.</param>
 /// <returns>
-///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if
+///     the object is not an external object or has no such field.
 /// </returns>
 CHAKRA_API
-    JsObjectHasProperty(
+    JsGetInternalField(
         _In_ JsValueRef object,
-        _In_ JsValueRef key,
-        _Out_ bool *hasProperty);
+        _In_ unsigned int index,
+        _Out_ JsValueRef *value);
 
 /// <summary>
-///     Defines a new object's own property from a property descriptor.
+///     Sets an internal field of an object.
 /// </summary>
 /// <remarks>
-///     Requires an active script context.
+///     Does not require an active script context.
 /// </remarks>
-/// <param name="object">The object that has the property.</param>
-/// <param name="key">The key (JavascriptString or JavascriptSymbol) to the property.</param>
+/// <param name="object">The object created by <c>JsCreateExternalObjectWithInternalFields</c>.</param>
+/// <param name="index">The index of the field.</param>
+/// <param name="value">The new value of the field. May be null.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if
+///     the object is not an external object or has no such field.
+/// </returns>
+CHAKRA_API
+    JsSetInternalField(
+        _In_ JsValueRef object,
+        _In_ unsigned int index,
+        _In_opt_ JsValueRef value);
+
+/// <summary>
+///     Gets an object's property.
+/// </summary>
+/// <remarks>
+///     Requires an active script context.
+/// </remarks>
+/// <param name="object">The object that contains the property.</param>
+/// <param name="key">The key (JavascriptString or JavascriptSymbol) to the property.</param>
+/// <param name="value">The value of the property.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsObjectGetProperty(
+        _In_ JsValueRef object,
+        _In_ JsValueRef key,
+        _Out_ JsValueRef *value);
+
+/// <summary>
+///     Puts an object's property.
+/// </summary>
+/// <remarks>
+///     Requires an active script context.
+/// </remarks>
+/// <param name="object">The object that contains the property.</param>
+/// <param name="key">The key (JavascriptString or JavascriptSymbol) to the property.</param>
+/// <param name="value">The new value of the property.</param>
+/// <param name="useStrictRules">The property set should follow strict mode rules.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsObjectSetProperty(
+        _In_ JsValueRef object,
+        _In_ JsValueRef key,
+        _In_ JsValueRef value,
+        _In_ bool useStrictRules);
+
+/// <summary>
+///     Determines whether an object has a property.
+/// </summary>
+/// <remarks>
+///     Requires an active script context.
+/// </remarks>
+/// <param name="object">The object that may contain the property.</param>
+/// <param name="key">The key (JavascriptString or JavascriptSymbol) to the property.</param>
+/// <param name="hasProperty">Whether the object (or a prototype) has the property.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsObjectHasProperty(
+        _In_ JsValueRef object,
+        _In_ JsValueRef key,
+        _Out_ bool *hasProperty);
+
+/// <summary>
+///     Defines a new object's own property from a property descriptor.
+/// </summary>
+/// <remarks>
+///     Requires an active script context.
+/// </remarks>
+/// <param name="object">The object that has the property.</param>
+/// <param name="key">The key (JavascriptString or JavascriptSymbol) to the property.</param>
 /// <param name="propertyDescriptor">The property descriptor.</param>
 /// <param name="result">Whether the property was defined.</param>
 /// <returns>
@@ -1154,6 +1616,58 @@ CHAKRA_API
         _In_ JsHostPromiseRejectionTrackerCallback promiseRejectionTrackerCallback, 
         _In_opt_ void *callbackState);
 
+/// <summary>
+///     Makes the engine queue the promise jobs of all script contexts of the runtime itself,
+///     instead of handing each of them to the promise continuation callback.
+/// </summary>
+/// <remarks>
+///     Requires an active script context.
+///     Not supported while Time Travel Debugging records or replays.
+/// </remarks>
+/// <param name="promiseJobsPendingCallback">
+///     The callback telling the host that jobs are waiting, or null to hand jobs to the
+///     promise continuation callback again. Jobs that are queued already stay queued.
+/// </param>
+/// <param name="callbackState">
+///     User provided state that will be passed back to the callback.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetPromiseJobsPendingCallback(
+        _In_opt_ JsPromiseJobsPendingCallback promiseJobsPendingCallback,
+        _In_opt_ void *callbackState);
+
+/// <summary>
+///     Queues a job of the host behind the promise jobs queued by the engine.
+/// </summary>
+/// <remarks>
+///     Requires an active script context and a callback set with <c>JsSetPromiseJobsPendingCallback</c>.
+/// </remarks>
+/// <param name="job">The function to call with no arguments when the job is run.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsEnqueuePromiseJob(
+        _In_ JsValueRef job);
+
+/// <summary>
+///     Runs the promise jobs queued by the engine in order, including the ones they queue,
+///     until the queue is empty.
+/// </summary>
+/// <remarks>
+///     Requires an active script context.
+///     An exception thrown by a job is cleared and the remaining jobs are run. If the runtime
+///     is disabled or script execution is terminated, the remaining jobs stay queued.
+/// </remarks>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsRunPromiseJobs();
+
 /// <summary>
 ///     Retrieve the namespace object for a module.
 /// </summary>
@@ -1271,5 +1785,976 @@ CHAKRA_API
         _In_ JsValueRef parserState,
         _Out_ JsValueRef * result);
 
+/// <summary>
+///     Detaches an ArrayBuffer, releasing its backing store.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Requires an active script context.
+///     </para>
+///     <para>
+///         After this call the ArrayBuffer and every view onto it report a length of zero.
+///         Detaching an ArrayBuffer that is already detached, or one that backs a WebAssembly
+///         memory, fails with <c>JsErrorInvalidArgument</c>.
+///     </para>
+/// </remarks>
+/// <param name="arrayBuffer">The ArrayBuffer to detach.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsDetachArrayBuffer(
+        _In_ JsValueRef arrayBuffer);
+
+/// <summary>
+///     Sets a callback function that is called at the beginning and the end of every garbage
+///     collection in the runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The callback is invoked on the runtime thread between the moment the recycler decides
+///     to collect and the moment the collection finishes, so hosts can use it to measure GC
+///     pauses. Passing a null callback removes a previously set callback.
+///     </para>
+///     <para>
+///     This API is independent of <c>JsSetRuntimeBeforeCollectCallback</c>; both callbacks may
+///     be registered at the same time.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime for which to register the callback.</param>
+/// <param name="callbackState">
+///     User provided state that will be passed back to the callback.
+/// </param>
+/// <param name="collectEventCallback">The callback function being set.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeCollectEventCallback(
+        _In_ JsRuntimeHandle runtime,
+        _In_opt_ void *callbackState,
+        _In_opt_ JsCollectEventCallback collectEventCallback);
+
+/// <summary>
+///     Gets the used and committed sizes of each recycler heap space in the runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Any concurrent collection in progress is finished first, and every heap block is
+///     visited, so the cost grows with the size of the heap.
+///     </para>
+///     <para>
+///     The total of the committed sizes is less than <c>JsGetRuntimeMemoryUsage</c>, which also
+///     counts memory the runtime allocates outside the recycler heap.
+///     </para>
+///     <para>
+///     The used sizes of the small and medium spaces are as of the last sweep of each heap block;
+///     objects allocated since then are counted once their block is swept again.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to inspect.</param>
+/// <param name="statistics">
+///     An array of <c>JsHeapSpaceCount</c> entries, indexed by <c>JsHeapSpace</c>.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetRuntimeHeapSpaceStatistics(
+        _In_ JsRuntimeHandle runtime,
+        _Out_writes_(JsHeapSpaceCount) JsHeapSpaceStatistics *statistics);
+
+/// <summary>
+///     Sets a callback function that receives the JavaScript stack of the runtime thread each
+///     time a sample requested with <c>JsRequestRuntimeSample</c> is taken.
+/// </summary>
+/// <remarks>
+///     Passing a null callback removes a previously set callback; pending requests are then
+///     dropped.
+/// </remarks>
+/// <param name="runtime">The runtime for which to register the callback.</param>
+/// <param name="callbackState">
+///     User provided state that will be passed back to the callback.
+/// </param>
+/// <param name="sampleCallback">The callback function being set.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeSampleCallback(
+        _In_ JsRuntimeHandle runtime,
+        _In_opt_ void *callbackState,
+        _In_opt_ JsSampleCallback sampleCallback);
+
+/// <summary>
+///     Requests that the JavaScript stack of the runtime thread is sampled.
+/// </summary>
+/// <remarks>
+///     <para>
+///     This API does not have to be called on the thread the runtime is active on; a profiler
+///     typically calls it from a timer thread. The sample is taken the next time the running
+///     script reaches a safe point (a function entry or a call into the host) and reported to
+///     the callback set with <c>JsSetRuntimeSampleCallback</c>. Requests made while a previous
+///     one is still pending are coalesced, and a request made while no script is running is
+///     reported when script next reaches a safe point.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to sample.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsRequestRuntimeSample(
+        _In_ JsRuntimeHandle runtime);
+
+/// <summary>
+///     Performs garbage collection work that fits in the time the host expects to stay idle.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The work is done in bounded steps: a concurrent collection in progress is finished,
+///     objects waiting to be disposed are disposed, and, if enough memory has been allocated
+///     since the last collection, a partial collection is started. When there is nothing
+///     left to collect, unused pages are decommitted.
+///     </para>
+///     <para>
+///     The time limit is checked between steps, and between heap blocks while disposing, so
+///     finalize callbacks of objects that died in large numbers are spread over several idle
+///     periods. A single step may still run past the limit. This API must not be called while
+///     script is running on the runtime.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime on which to do the work.</param>
+/// <param name="idleTimeInMs">The number of milliseconds the host expects to stay idle.</param>
+/// <param name="nextIdleTimeInMs">
+///     The number of milliseconds after which more idle time would help, 0 if the host should
+///     call again at its next idle period. Returns <c>UINT_MAX</c> if the recycler has no more
+///     idle work to do; a host can then stop calling this API until script runs again.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsIdleCollectGarbage(
+        _In_ JsRuntimeHandle runtime,
+        _In_ unsigned int idleTimeInMs,
+        _Out_opt_ unsigned int *nextIdleTimeInMs);
+
+/// <summary>
+///     Creates a string that refers to Latin-1 content owned by the host, without copying it.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     The content must not change and must stay valid until <c>finalizeCallback</c> is called,
+///     which happens when the string is collected. The engine may still make its own copy if an
+///     operation needs the characters as a null terminated buffer.
+///     </para>
+/// </remarks>
+/// <param name="content">Pointer to the Latin-1 characters; one byte per character.</param>
+/// <param name="length">Number of characters within the string.</param>
+/// <param name="finalizeCallback">
+///     Callback to invoke when the string is collected and the content is no longer used.
+/// </param>
+/// <param name="callbackState">User provided state that will be passed to the callback.</param>
+/// <param name="value">JsValueRef representing the JavascriptString.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateExternalStringLatin1(
+        _In_reads_(length) const char *content,
+        _In_ size_t length,
+        _In_opt_ JsFinalizeCallback finalizeCallback,
+        _In_opt_ void *callbackState,
+        _Out_ JsValueRef *value);
+
+/// <summary>
+///     Creates a string that refers to UTF-16 content owned by the host, without copying it.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     The content must not change and must stay valid until <c>finalizeCallback</c> is called,
+///     which happens when the string is collected. The engine may still make its own copy if an
+///     operation needs the characters as a null terminated buffer.
+///     </para>
+/// </remarks>
+/// <param name="content">Pointer to the UTF-16 characters.</param>
+/// <param name="length">Number of characters within the string.</param>
+/// <param name="finalizeCallback">
+///     Callback to invoke when the string is collected and the content is no longer used.
+/// </param>
+/// <param name="callbackState">User provided state that will be passed to the callback.</param>
+/// <param name="value">JsValueRef representing the JavascriptString.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateExternalStringUtf16(
+        _In_reads_(length) const uint16_t *content,
+        _In_ size_t length,
+        _In_opt_ JsFinalizeCallback finalizeCallback,
+        _In_opt_ void *callbackState,
+        _Out_ JsValueRef *value);
+
+/// <summary>
+///     Gets the host-owned content of a string created by <c>JsCreateExternalStringLatin1</c> or
+///     <c>JsCreateExternalStringUtf16</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///     For any other string, <c>content</c> and <c>callbackState</c> are set to null. The content
+///     stays valid as long as the string is reachable, so the host can read it in place, for
+///     example to write it out, instead of copying the string.
+///     </para>
+/// </remarks>
+/// <param name="value">The string.</param>
+/// <param name="content">The characters, as passed when the string was created.</param>
+/// <param name="length">Number of characters within the string.</param>
+/// <param name="isOneByte">Whether the content is Latin-1 (one byte per character) or UTF-16.</param>
+/// <param name="callbackState">The state passed when the string was created.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetExternalStringContent(
+        _In_ JsValueRef value,
+        _Outptr_result_maybenull_ const void **content,
+        _Out_ size_t *length,
+        _Out_ bool *isOneByte,
+        _Outptr_result_maybenull_ void **callbackState);
+
+/// <summary>
+///     Gets several properties of an object.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     This is the same as calling <c>JsGetProperty</c> for each property in order, but enters
+///     the engine only once. If getting a property throws, the properties after it are not read.
+///     </para>
+/// </remarks>
+/// <param name="object">The object that contains the properties.</param>
+/// <param name="propertyIds">The IDs of the properties.</param>
+/// <param name="count">Number of properties.</param>
+/// <param name="values">The values of the properties.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetProperties(
+        _In_ JsValueRef object,
+        _In_reads_(count) const JsPropertyIdRef *propertyIds,
+        _In_ size_t count,
+        _Out_writes_(count) JsValueRef *values);
+
+/// <summary>
+///     Puts several properties of an object.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     This is the same as calling <c>JsSetProperty</c> for each property in order, but enters
+///     the engine only once. If setting a property throws, the properties after it are not set.
+///     </para>
+/// </remarks>
+/// <param name="object">The object that contains the properties.</param>
+/// <param name="propertyIds">The IDs of the properties.</param>
+/// <param name="values">The new values of the properties.</param>
+/// <param name="count">Number of properties.</param>
+/// <param name="useStrictRules">The property sets should follow strict mode rules.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetProperties(
+        _In_ JsValueRef object,
+        _In_reads_(count) const JsPropertyIdRef *propertyIds,
+        _In_reads_(count) const JsValueRef *values,
+        _In_ size_t count,
+        _In_ bool useStrictRules);
+
+/// <summary>
+///     A property ID paired with inline caches for getting and setting that property.
+/// </summary>
+/// <remarks>
+///     A host that reads or writes the same property of many objects from one place keeps a
+///     property cache for it. Once the cache has seen an object of a given shape, later objects
+///     of that shape find the property without a full lookup. Like other references, a property
+///     cache must be kept alive with <c>JsAddRef</c> to be used after a garbage collection. A
+///     property cache doesn't keep the script contexts it was used from alive.
+/// </remarks>
+typedef JsRef JsPropertyCacheRef;
+
+/// <summary>
+///     Creates a property cache for a property ID.
+/// </summary>
+/// <remarks>
+///     Requires an active script context. The cache may be used from any script context of the
+///     same runtime, but it works best when it is used from one script context only.
+/// </remarks>
+/// <param name="propertyId">The ID of the property.</param>
+/// <param name="propertyCache">The new property cache.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreatePropertyCache(
+        _In_ JsPropertyIdRef propertyId,
+        _Out_ JsPropertyCacheRef *propertyCache);
+
+/// <summary>
+///     Gets an object's property through a property cache.
+/// </summary>
+/// <remarks>
+///     Requires an active script context. This is the same as calling <c>JsGetProperty</c> with
+///     the property ID of the cache.
+/// </remarks>
+/// <param name="object">The object that contains the property.</param>
+/// <param name="propertyCache">The property cache of the property.</param>
+/// <param name="value">The value of the property.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetPropertyCached(
+        _In_ JsValueRef object,
+        _In_ JsPropertyCacheRef propertyCache,
+        _Out_ JsValueRef *value);
+
+/// <summary>
+///     Puts an object's property through a property cache.
+/// </summary>
+/// <remarks>
+///     Requires an active script context. This is the same as calling <c>JsSetProperty</c> with
+///     the property ID of the cache.
+/// </remarks>
+/// <param name="object">The object that contains the property.</param>
+/// <param name="propertyCache">The property cache of the property.</param>
+/// <param name="value">The new value of the property.</param>
+/// <param name="useStrictRules">The property set should follow strict mode rules.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetPropertyCached(
+        _In_ JsValueRef object,
+        _In_ JsPropertyCacheRef propertyCache,
+        _In_ JsValueRef value,
+        _In_ bool useStrictRules);
+
+/// <summary>
+///     Sets the number of background threads the runtime uses to JIT compile hot functions.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The threads are started when the first script context of the runtime is created, so this
+///     API must be called before that; afterwards it fails with <c>JsErrorRuntimeInUse</c>.
+///     Passing 0 restores the engine default. The count is capped so that one core is left for
+///     the runtime thread, and it has no effect on runtimes created with
+///     <c>JsRuntimeAttributeDisableBackgroundWork</c> or built without the JIT.
+///     </para>
+///     <para>
+///     Loop bodies and fully optimized functions are queued ahead of simple JIT work, so extra
+///     threads mostly shorten the time until hot code reaches full optimization.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to configure.</param>
+/// <param name="threadCount">The number of background JIT threads, 0 for the default.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeMaxJitThreadCount(
+        _In_ JsRuntimeHandle runtime,
+        _In_ unsigned int threadCount);
+
+/// <summary>
+///     Serializes the dynamic profile collected for the functions of a script.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The profile records which functions of the script ran and the type and call-target
+///     feedback gathered for them. A host can persist it and pass it to
+///     <c>JsLoadDynamicProfile</c> in a later process, so that the script starts out with the
+///     profile of the previous run instead of an empty one.
+///     </para>
+///     <para>
+///     The profile can only be loaded by the same build of the engine, and only applies to the
+///     exact same script source. Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="sourceContext">The cookie the script was run or parsed with.</param>
+/// <param name="buffer">An ArrayBuffer holding the serialized profile.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if
+///     there is no profile for the source context, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSerializeDynamicProfile(
+        _In_ JsSourceContext sourceContext,
+        _Out_ JsValueRef *buffer);
+
+/// <summary>
+///     Loads a dynamic profile produced by <c>JsSerializeDynamicProfile</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Must be called before the script with the same source context is run or parsed in the
+///     current script context. Functions the profile marks as executed are parsed eagerly and
+///     are considered for JIT compilation from the start, using the recorded feedback.
+///     </para>
+///     <para>
+///     The host is responsible for keying stored profiles by the script source; loading the
+///     profile of a different script only degrades the generated code. Requires an active
+///     script context.
+///     </para>
+/// </remarks>
+/// <param name="sourceContext">The cookie the script will be run or parsed with.</param>
+/// <param name="sourceUrl">The URL the script will be run or parsed with.</param>
+/// <param name="buffer">The serialized profile.</param>
+/// <param name="bufferLength">The length of the serialized profile in bytes.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorBadSerializedScript</c>
+///     if the buffer isn't a profile of this build, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsLoadDynamicProfile(
+        _In_ JsSourceContext sourceContext,
+        _In_ JsValueRef sourceUrl,
+        _In_reads_(bufferLength) const BYTE *buffer,
+        _In_ unsigned int bufferLength);
+
+/// <summary>
+///     Flags for <c>JsSetPerfMapFlags</c>.
+/// </summary>
+typedef enum _JsPerfMapFlags
+{
+    /// <summary>
+    ///     No perf output is written as code is generated.
+    /// </summary>
+    JsPerfMapNone = 0,
+    /// <summary>
+    ///     Append the address, size and name of each JIT compiled function to
+    ///     <c>/tmp/perf-&lt;pid&gt;.map</c>.
+    /// </summary>
+    JsPerfMapBasic = 1,
+    /// <summary>
+    ///     Write each JIT compiled function with its code bytes to <c>/tmp/jit-&lt;pid&gt;.dump</c>
+    ///     for <c>perf inject --jit</c>.
+    /// </summary>
+    JsPerfMapJitDump = 2,
+} JsPerfMapFlags;
+
+/// <summary>
+///     Starts writing Linux perf symbol files as JIT compiled code is installed.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The files are process wide and stay open until the process exits; code that was generated
+///     before the call is not written. Should be called before the first runtime is created.
+///     </para>
+///     <para>
+///     Only supported on Linux builds with <c>PERFMAP_TRACE_ENABLED</c>; other builds return
+///     <c>JsErrorNotImplemented</c>.
+///     </para>
+/// </remarks>
+/// <param name="flags">The files to write.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorFatal</c> if a file could
+///     not be created, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetPerfMapFlags(
+        _In_ JsPerfMapFlags flags);
+
+/// <summary>
+///     Reports host memory holding JavaScript values to the garbage collector.
+/// </summary>
+/// <remarks>
+///     Called from a <c>JsExternalRootsCallback</c>. The values are scanned like the native
+///     stack, so entries that are not values are ignored.
+/// </remarks>
+/// <param name="scanState">The state passed to the <c>JsExternalRootsCallback</c>.</param>
+/// <param name="roots">The values to keep alive.</param>
+/// <param name="rootCount">The number of values.</param>
+typedef void (CHAKRA_CALLBACK *JsScanRootsCallback)(_In_ void *scanState, _In_reads_(rootCount) JsValueRef *roots, _In_ size_t rootCount);
+
+/// <summary>
+///     A callback called by the garbage collector to find values the host keeps outside of the
+///     native stack without adding references to them.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Use <c>JsSetRuntimeExternalRootsCallback</c> to register this callback.
+///     </para>
+///     <para>
+///     The callback is invoked on the runtime thread during every collection, including partial
+///     ones, and may be invoked more than once per collection. It must not call back into the
+///     engine, except through <paramref name="scan" />.
+///     </para>
+/// </remarks>
+/// <param name="callbackState">The state passed to <c>JsSetRuntimeExternalRootsCallback</c>.</param>
+/// <param name="scan">The function to report the values with.</param>
+/// <param name="scanState">The state to pass to <paramref name="scan" />.</param>
+typedef void (CHAKRA_CALLBACK *JsExternalRootsCallback)(_In_opt_ void *callbackState, _In_ JsScanRootsCallback scan, _In_ void *scanState);
+
+/// <summary>
+///     Sets a callback function that reports host memory holding JavaScript values each time the
+///     garbage collector looks for roots.
+/// </summary>
+/// <remarks>
+///     This is cheaper than <c>JsAddRef</c> for values that are kept for a short time, like the
+///     handles of a host that are released in bulk. Only one callback can be set per runtime.
+/// </remarks>
+/// <param name="runtime">The runtime to report the values for.</param>
+/// <param name="callbackState">
+///     User provided state that will be passed back to the callback.
+/// </param>
+/// <param name="externalRootsCallback">The callback function being set, or null to unset it.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeExternalRootsCallback(
+        _In_ JsRuntimeHandle runtime,
+        _In_opt_ void *callbackState,
+        _In_opt_ JsExternalRootsCallback externalRootsCallback);
+
+/// <summary>
+///     The number of bailouts of one kind, in <c>JsJitFunctionStatistics</c>.
+/// </summary>
+typedef struct _JsJitBailOutKindCount
+{
+    /// <summary>
+    ///     The name of the bailout kind, like <c>BailOutOnImplicitCalls</c>. Kinds with extra
+    ///     condition bits read like <c>BailOutIntOnly | BailOutOnOverflow</c>.
+    /// </summary>
+    const char *kind;
+    /// <summary>
+    ///     The number of bailouts of this kind.
+    /// </summary>
+    unsigned int count;
+} JsJitBailOutKindCount;
+
+/// <summary>
+///     The number of rejits of a function for one reason, reported in <c>JsJitFunctionStatistics</c>.
+/// </summary>
+typedef struct _JsJitRejitReasonCount
+{
+    /// <summary>
+    ///     The name of the rejit reason, like <c>FailedTypeCheck</c>.
+    /// </summary>
+    const char *reason;
+    /// <summary>
+    ///     The number of rejits for this reason.
+    /// </summary>
+    unsigned int count;
+} JsJitRejitReasonCount;
+
+/// <summary>
+///     The JIT statistics of one function, reported by <c>JsEnumerateRuntimeJitStatistics</c>.
+/// </summary>
+typedef struct _JsJitFunctionStatistics
+{
+    /// <summary>
+    ///     A number identifying the function within the runtime.
+    /// </summary>
+    unsigned int functionId;
+    /// <summary>
+    ///     The name of the function, UTF-8 encoded, or null.
+    /// </summary>
+    const char *name;
+    /// <summary>
+    ///     The URL of the script the function is in, UTF-8 encoded, or null.
+    /// </summary>
+    const char *url;
+    /// <summary>
+    ///     The zero based line and column of the function in its script.
+    /// </summary>
+    unsigned int line;
+    unsigned int column;
+    /// <summary>
+    ///     The number of compiled loop bodies that were entered.
+    /// </summary>
+    unsigned int loopBodyJitCount;
+    /// <summary>
+    ///     The total and the longest time, in milliseconds, from scheduling the compile of one of
+    ///     those loop bodies until it was compiled. The loop keeps running in the interpreter meanwhile.
+    /// </summary>
+    double loopBodyJitQueueTime;
+    double maxLoopBodyJitQueueTime;
+    /// <summary>
+    ///     The number of times the interpreter entered a compiled loop body (on-stack replacement).
+    /// </summary>
+    unsigned int osrEntryCount;
+    /// <summary>
+    ///     The number of bailouts out of compiled loop bodies back into the interpreter.
+    /// </summary>
+    unsigned int osrBailOutCount;
+    /// <summary>
+    ///     The number of bailouts out of all compiled code of the function, including its loop bodies.
+    /// </summary>
+    unsigned int bailOutCount;
+    /// <summary>
+    ///     The bailouts by kind.
+    /// </summary>
+    const JsJitBailOutKindCount *bailOutKinds;
+    unsigned int bailOutKindCount;
+    /// <summary>
+    ///     The number of times those bailouts caused the function or one of its loop bodies to be
+    ///     compiled again, and the rejits by reason.
+    /// </summary>
+    unsigned int rejitCount;
+    const JsJitRejitReasonCount *rejitReasons;
+    unsigned int rejitReasonCount;
+} JsJitFunctionStatistics;
+
+/// <summary>
+///     Events reported to a <c>JsJitEventCallback</c>.
+/// </summary>
+typedef enum _JsJitEventType
+{
+    /// <summary>
+    ///     A compiled loop body was entered for the first time.
+    /// </summary>
+    JsJitEventLoopBodyJitted = 0,
+    /// <summary>
+    ///     Compiled code bailed out to the interpreter.
+    /// </summary>
+    JsJitEventBailOut = 1
+} JsJitEventType;
+
+/// <summary>
+///     An event reported to a <c>JsJitEventCallback</c>.
+/// </summary>
+typedef struct _JsJitEvent
+{
+    JsJitEventType type;
+    /// <summary>
+    ///     The statistics of the function, already updated for the event, without its
+    ///     <c>bailOutKinds</c> and <c>rejitReasons</c>.
+    /// </summary>
+    const JsJitFunctionStatistics *function;
+    /// <summary>
+    ///     For <c>JsJitEventLoopBodyJitted</c>, the loop and the time in milliseconds it waited
+    ///     for its compile.
+    /// </summary>
+    unsigned int loopNumber;
+    double queueTime;
+    /// <summary>
+    ///     For <c>JsJitEventBailOut</c>, the bailout kind, the reason of the rejit it caused or null,
+    ///     and whether it left a loop body, which <c>loopNumber</c> is then the number of.
+    /// </summary>
+    const char *bailOutKind;
+    const char *rejitReason;
+    bool fromLoopBody;
+} JsJitEvent;
+
+/// <summary>
+///     A bailout in the deopt log, reported by <c>JsEnumerateRuntimeDeoptLog</c>.
+/// </summary>
+typedef struct _JsJitDeoptLogEntry
+{
+    /// <summary>
+    ///     The time of the bailout, in milliseconds since the JIT statistics were turned on.
+    /// </summary>
+    double time;
+    /// <summary>
+    ///     The statistics of the function as they are now, without its <c>bailOutKinds</c> and
+    ///     <c>rejitReasons</c>.
+    /// </summary>
+    const JsJitFunctionStatistics *function;
+    /// <summary>
+    ///     The loop whose compiled body bailed out, if <c>fromLoopBody</c>.
+    /// </summary>
+    unsigned int loopNumber;
+    bool fromLoopBody;
+    /// <summary>
+    ///     The bailout kind, and the reason of the rejit the bailout caused or null.
+    /// </summary>
+    const char *bailOutKind;
+    const char *rejitReason;
+} JsJitDeoptLogEntry;
+
+/// <summary>
+///     A callback called for JIT events while the JIT statistics of a runtime are turned on.
+/// </summary>
+/// <remarks>
+///     The callback is invoked while script is running. It must not call back into the engine.
+/// </remarks>
+/// <param name="event">The event, only valid during the call.</param>
+/// <param name="callbackState">The state passed to <c>JsSetRuntimeJitStatisticsEnabled</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsJitEventCallback)(_In_ const JsJitEvent *event, _In_opt_ void *callbackState);
+
+/// <summary>
+///     A callback called for each function by <c>JsEnumerateRuntimeJitStatistics</c>.
+/// </summary>
+/// <param name="statistics">The statistics of the function, only valid during the call.</param>
+/// <param name="callbackState">The state passed to <c>JsEnumerateRuntimeJitStatistics</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsJitStatisticsCallback)(_In_ const JsJitFunctionStatistics *statistics, _In_opt_ void *callbackState);
+
+/// <summary>
+///     A callback called for each entry by <c>JsEnumerateRuntimeDeoptLog</c>.
+/// </summary>
+/// <param name="entry">The entry, only valid during the call.</param>
+/// <param name="callbackState">The state passed to <c>JsEnumerateRuntimeDeoptLog</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsJitDeoptLogCallback)(_In_ const JsJitDeoptLogEntry *entry, _In_opt_ void *callbackState);
+
+/// <summary>
+///     Turns the per function JIT statistics of a runtime on or off.
+/// </summary>
+/// <remarks>
+///     <para>
+///     While they are on, the runtime counts the compiles of loop bodies and the time each one
+///     waited in the JIT queue, the entries of the interpreter into compiled loop bodies, the
+///     bailouts out of compiled code by kind and the rejits they cause by reason, for every function
+///     that has any of them. The last 256 bailouts are also kept in the deopt log.
+///     </para>
+///     <para>
+///     Turning the statistics off drops the collected statistics. Turning them on again only
+///     changes the event callback.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="enabled">Whether to collect the statistics.</param>
+/// <param name="eventCallback">An optional callback to report each event to as it happens.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeJitStatisticsEnabled(
+        _In_ JsRuntimeHandle runtime,
+        _In_ bool enabled,
+        _In_opt_ JsJitEventCallback eventCallback,
+        _In_opt_ void *callbackState);
+
+/// <summary>
+///     Reports the JIT statistics collected since <c>JsSetRuntimeJitStatisticsEnabled</c> or the
+///     last reset, one function at a time.
+/// </summary>
+/// <remarks>
+///     The order of the functions is unspecified. The statistics of a function are kept after the
+///     function is collected.
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="callback">The callback to call for each function.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <param name="reset">Whether to clear the statistics after reporting them.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if the
+///     statistics are turned off, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsEnumerateRuntimeJitStatistics(
+        _In_ JsRuntimeHandle runtime,
+        _In_ JsJitStatisticsCallback callback,
+        _In_opt_ void *callbackState,
+        _In_ bool reset);
+
+/// <summary>
+///     Reports the bailouts in the deopt log of the runtime, from the oldest to the newest.
+/// </summary>
+/// <remarks>
+///     The deopt log keeps the last 256 bailouts since <c>JsSetRuntimeJitStatisticsEnabled</c> or
+///     the last reset of the log or of the statistics.
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="callback">The callback to call for each entry.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <param name="reset">Whether to clear the log after reporting it.</param>
+/// <param name="deoptCount">
+///     The number of bailouts since the log was last cleared, including those that no longer fit.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if the
+///     JIT statistics are turned off, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsEnumerateRuntimeDeoptLog(
+        _In_ JsRuntimeHandle runtime,
+        _In_ JsJitDeoptLogCallback callback,
+        _In_opt_ void *callbackState,
+        _In_ bool reset,
+        _Out_opt_ unsigned int *deoptCount);
+
+/// <summary>
+///     A callback called by <c>JsTakeRuntimeHeapSnapshot</c> with each chunk of the snapshot.
+/// </summary>
+/// <remarks>
+///     The callback is called while the heap is being walked, it must not call back into the
+///     runtime.
+/// </remarks>
+/// <param name="chunk">The next chunk of the snapshot. It is only valid during the call.</param>
+/// <param name="length">The length of the chunk in bytes.</param>
+/// <param name="callbackState">The state passed to <c>JsTakeRuntimeHeapSnapshot</c>.</param>
+/// <returns>
+///     Whether to continue writing the snapshot. Returning false stops the snapshot.
+/// </returns>
+typedef bool (CHAKRA_CALLBACK *JsHeapSnapshotWriteCallback)(_In_reads_(length) const char *chunk, _In_ size_t length, _In_opt_ void *callbackState);
+
+/// <summary>
+///     Writes a snapshot of the live objects of a runtime and the references between them, in the
+///     JSON heap snapshot format of the V8 heap profiler.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The live objects are found with a mark of the heap that does not collect anything. The
+///     references of an object are found by scanning it for pointers to other live objects, so an
+///     object may show references that are no longer used. Objects only referenced from the stack
+///     or from a host root are reported as references of the root node, next to the global objects.
+///     </para>
+///     <para>
+///     The snapshot is written to the callback in chunks of up to 64KB of ASCII text as it is
+///     produced. Memory use grows with the number of live objects, not with the size of the output.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="writeCallback">The callback to write each chunk of the snapshot to.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsTakeRuntimeHeapSnapshot(
+        _In_ JsRuntimeHandle runtime,
+        _In_ JsHeapSnapshotWriteCallback writeCallback,
+        _In_opt_ void *callbackState);
+
+/// <summary>
+///     A callback called on the runtime thread for each allocation picked by allocation sampling.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Use <c>JsSetRuntimeAllocationSampling</c> to register this callback.
+///     </para>
+///     <para>
+///     The callback is invoked in the middle of the allocation. It must not call back into the
+///     engine.
+///     </para>
+/// </remarks>
+/// <param name="sampleId">An id of the sample, reported again when the object is collected.</param>
+/// <param name="size">The size of the sampled allocation in bytes.</param>
+/// <param name="frames">
+///     The JavaScript frames on the stack, innermost first, in the same form as the frames of a
+///     runtime sample. Allocations made outside of any script call have no frames.
+/// </param>
+/// <param name="frameCount">The number of frames.</param>
+/// <param name="callbackState">The state passed to <c>JsSetRuntimeAllocationSampling</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsAllocationSampleCallback)(_In_ unsigned int sampleId, _In_ size_t size, _In_reads_(frameCount) const JsSampleFrame *frames, _In_ unsigned int frameCount, _In_opt_ void *callbackState);
+
+/// <summary>
+///     A callback called when the object of an allocation sample is found to be garbage.
+/// </summary>
+/// <remarks>
+///     The callback is invoked at the end of the mark phase of a collection. It must not call
+///     back into the engine.
+/// </remarks>
+/// <param name="sampleId">The id the sample was reported with.</param>
+/// <param name="callbackState">The state passed to <c>JsSetRuntimeAllocationSampling</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsAllocationSampleFreeCallback)(_In_ unsigned int sampleId, _In_opt_ void *callbackState);
+
+/// <summary>
+///     Starts or stops sampling the recycler allocations of a runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     An allocation is sampled about every <c>sampleInterval</c> bytes. The distance to the next
+///     sample is drawn from an exponential distribution, so every allocated byte is equally likely
+///     to be sampled; an allocation of <c>size</c> bytes stands for about
+///     <c>1 / (1 - exp(-size / sampleInterval))</c> allocations of its size.
+///     </para>
+///     <para>
+///     Only the sampled allocations pay for the stack walk, so a large interval like 512KB is cheap
+///     enough to leave on. Allocations made by jitted code without calling into the runtime are
+///     not counted.
+///     </para>
+///     <para>
+///     With a free callback the samples whose objects are still live can be tracked, for a
+///     profile of the live heap. Passing a null sample callback or a zero interval stops
+///     sampling; the samples taken so far are not reported as freed.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to sample.</param>
+/// <param name="sampleInterval">The mean number of bytes allocated between two samples.</param>
+/// <param name="callbackState">
+///     User provided state that will be passed back to the callbacks.
+/// </param>
+/// <param name="sampleCallback">The callback called for each sampled allocation.</param>
+/// <param name="freeCallback">The callback called when a sampled object is collected.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeAllocationSampling(
+        _In_ JsRuntimeHandle runtime,
+        _In_ size_t sampleInterval,
+        _In_opt_ void *callbackState,
+        _In_opt_ JsAllocationSampleCallback sampleCallback,
+        _In_opt_ JsAllocationSampleFreeCallback freeCallback);
+
+/// <summary>
+///     Reports memory the host allocated for objects of the runtime, like the backing stores of
+///     external array buffers.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The bytes count towards the allocations that trigger the next collection, so that small
+///     objects holding on to large host allocations don't let them build up between collections.
+///     A collection may be started before this returns. Freeing the memory needs no report, the
+///     count starts over with every collection.
+///     </para>
+///     <para>
+///     The bytes are not charged against the limit set with <c>JsSetRuntimeMemoryLimit</c>.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime the memory was allocated for.</param>
+/// <param name="allocatedBytes">The number of bytes the host allocated.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsAddRuntimeExternalMemoryPressure(
+        _In_ JsRuntimeHandle runtime,
+        _In_ size_t allocatedBytes);
+
+/// <summary>
+///     Releases the bytecode of functions that have not run for a while, so that it is
+///     regenerated from the source when they are called again.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The runtime already does this from time to time after collections once it has been
+///     running for a while. This starts a full collection and does it right away, which lets
+///     hosts reclaim the functions that only ran during startup once it is over.
+///     </para>
+///     <para>
+///     Only functions that have not been called since the previous redeferral check, and
+///     are not on the stack, are redeferred. Calling this once after startup and then again
+///     later releases the functions that did not run in between.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to redefer functions of.</param>
+/// <param name="redeferredFunctionCount">The number of functions that were redeferred.</param>
+/// <param name="freedBytes">An estimate of the number of bytes that were released.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsRedeferRuntimeInactiveFunctions(
+        _In_ JsRuntimeHandle runtime,
+        _Out_opt_ unsigned int *redeferredFunctionCount,
+        _Out_opt_ size_t *freedBytes);
+
 #endif // _CHAKRACOREBUILD
 #endif // _CHAKRACORE_H_
@@ -6,14 +6,19 @@
 #include "JsrtInternal.h"
 #include "JsrtExternalObject.h"
 #include "JsrtExternalArrayBuffer.h"
+#include "JsrtExternalString.h"
+#include "JsrtPropertyCache.h"
 #include "jsrtHelper.h"
 
 #include "JsrtSourceHolder.h"
+#include "JsrtHeapSnapshot.h"
 #include "ByteCode/ByteCodeSerializer.h"
 #include "Common/ByteSwap.h"
 #include "Library/DataView.h"
 #include "Library/JavascriptExceptionMetadata.h"
 #include "Library/JavascriptPromise.h"
+#include "Library/LazyJSONString.h"
+#include "Language/SourceDynamicProfileManager.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Codex/Utf8Helper.h"
 
@@ -1327,8 +1332,24 @@ CHAKRA_API JsCreateExternalObjectWithPrototype(_In_opt_ void *data,
     _In_opt_ JsFinalizeCallback finalizeCallback,
     _In_opt_ JsValueRef prototype,
     _Out_ JsValueRef *object)
+{
+    return JsCreateExternalObjectWithInternalFields(data, finalizeCallback, prototype, 0, object);
+}
+
+CHAKRA_API JsCreateExternalObjectWithInternalFields(_In_opt_ void *data,
+    _In_opt_ JsFinalizeCallback finalizeCallback,
+    _In_opt_ JsValueRef prototype,
+    _In_ unsigned int internalFieldCount,
+    _Out_ JsValueRef *object)
 {
     return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+#if ENABLE_TTD
+        if (internalFieldCount != 0 && scriptContext->IsTTDRecordOrReplayModeEnabled())
+        {
+            return JsErrorNotImplemented;
+        }
+#endif
+
         PERFORM_JSRT_TTD_RECORD_ACTION(scriptContext, RecordJsRTAllocateExternalObject, prototype);
 
         PARAM_NOT_NULL(object);
@@ -1340,7 +1361,7 @@ CHAKRA_API JsCreateExternalObjectWithPrototype(_In_opt_ void *data,
             prototypeObject = Js::RecyclableObject::FromVar(prototype);
         }
 
-        *object = JsrtExternalObject::Create(data, finalizeCallback, prototypeObject, scriptContext);
+        *object = JsrtExternalObject::Create(data, finalizeCallback, prototypeObject, scriptContext, internalFieldCount);
 
         PERFORM_JSRT_TTD_RECORD_ACTION_RESULT(scriptContext, object);
 
@@ -1705,6 +1726,123 @@ CHAKRA_API JsObjectSetProperty(_In_ JsValueRef object, _In_ JsValueRef propertyI
 }
 #endif
 
+CHAKRA_API JsGetProperties(_In_ JsValueRef object, _In_reads_(count) const JsPropertyIdRef *propertyIds,
+    _In_ size_t count, _Out_writes_(count) JsValueRef *values)
+{
+    return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&] (Js::ScriptContext *scriptContext,
+        TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        VALIDATE_INCOMING_OBJECT(object, scriptContext);
+        if (count == 0)
+        {
+            return JsNoError;
+        }
+        PARAM_NOT_NULL(propertyIds);
+        PARAM_NOT_NULL(values);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            VALIDATE_INCOMING_PROPERTYID(propertyIds[i]);
+            values[i] = nullptr;
+        }
+
+        Js::RecyclableObject * instance = Js::RecyclableObject::FromVar(object);
+        for (size_t i = 0; i < count; i++)
+        {
+            JsGetPropertyCommon(scriptContext, instance, (const Js::PropertyRecord *)propertyIds[i], &values[i]);
+        }
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSetProperties(_In_ JsValueRef object, _In_reads_(count) const JsPropertyIdRef *propertyIds,
+    _In_reads_(count) const JsValueRef *values, _In_ size_t count, _In_ bool useStrictRules)
+{
+    return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&] (Js::ScriptContext *scriptContext,
+        TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        VALIDATE_INCOMING_OBJECT(object, scriptContext);
+        if (count == 0)
+        {
+            return JsNoError;
+        }
+        PARAM_NOT_NULL(propertyIds);
+        PARAM_NOT_NULL(values);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            VALIDATE_INCOMING_PROPERTYID(propertyIds[i]);
+            VALIDATE_JSREF(values[i]);
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            JsValueRef value = values[i];
+            VALIDATE_INCOMING_REFERENCE(value, scriptContext);
+            JsSetPropertyCommon(scriptContext, object, (const Js::PropertyRecord *)propertyIds[i], value, useStrictRules);
+        }
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsCreatePropertyCache(_In_ JsPropertyIdRef propertyId, _Out_ JsPropertyCacheRef *propertyCache)
+{
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext * scriptContext) -> JsErrorCode {
+        VALIDATE_INCOMING_PROPERTYID(propertyId);
+        PARAM_NOT_NULL(propertyCache);
+        *propertyCache = nullptr;
+
+        *propertyCache = Js::JsrtPropertyCache::New((const Js::PropertyRecord *)propertyId, scriptContext);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetPropertyCached(_In_ JsValueRef object, _In_ JsPropertyCacheRef propertyCache, _Out_ JsValueRef *value)
+{
+    return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&] (Js::ScriptContext *scriptContext,
+        TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        VALIDATE_JSREF(propertyCache);
+        Js::JsrtPropertyCache * cache = (Js::JsrtPropertyCache *)propertyCache;
+
+        // Replays as a plain JsGetProperty; the cache doesn't change the result.
+        PERFORM_JSRT_TTD_RECORD_ACTION(scriptContext, RecordJsRTGetProperty, cache->GetPropertyRecord(), object);
+
+        VALIDATE_INCOMING_OBJECT(object, scriptContext);
+        PARAM_NOT_NULL(value);
+        *value = nullptr;
+
+        *value = cache->GetProperty(Js::RecyclableObject::FromVar(object), scriptContext);
+        Assert(*value == nullptr || !Js::CrossSite::NeedMarshalVar(*value, scriptContext));
+
+        PERFORM_JSRT_TTD_RECORD_ACTION_RESULT(scriptContext, value);
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSetPropertyCached(_In_ JsValueRef object, _In_ JsPropertyCacheRef propertyCache, _In_ JsValueRef value, _In_ bool useStrictRules)
+{
+    return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&] (Js::ScriptContext *scriptContext,
+        TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        VALIDATE_JSREF(propertyCache);
+        Js::JsrtPropertyCache * cache = (Js::JsrtPropertyCache *)propertyCache;
+
+        PERFORM_JSRT_TTD_RECORD_ACTION(scriptContext, RecordJsRTSetProperty, object, cache->GetPropertyRecord(), value, useStrictRules);
+
+        VALIDATE_INCOMING_OBJECT(object, scriptContext);
+        VALIDATE_INCOMING_REFERENCE(value, scriptContext);
+
+        cache->SetProperty(Js::RecyclableObject::FromVar(object), value,
+            useStrictRules ? Js::PropertyOperation_StrictMode : Js::PropertyOperation_None, scriptContext);
+
+        return JsNoError;
+    });
+}
+
 CHAKRA_API JsHasProperty(_In_ JsValueRef object, _In_ JsPropertyIdRef propertyId, _Out_ bool *hasProperty)
 {
     VALIDATE_JSREF(object);
@@ -2031,11 +2169,29 @@ CHAKRA_API JsGetSharedArrayBufferContent(_In_ JsValueRef sharedArrayBuffer, _Out
 
 CHAKRA_API JsReleaseSharedArrayBufferContentHandle(_In_ JsSharedArrayBufferContentHandle sharedContents)
 {
-    return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+    // The reference count is interlocked, so the last worker to let go can do it from any thread
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        PARAM_NOT_NULL(sharedContents);
+
         ((Js::SharedContents*)sharedContents)->Release();
         return JsNoError;
     });
 }
+
+CHAKRA_API JsGetSharedArrayBufferContentStorage(_In_ JsSharedArrayBufferContentHandle sharedContents,
+    _Outptr_result_maybenull_ BYTE **buffer, _Out_ unsigned int *bufferLength)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        PARAM_NOT_NULL(sharedContents);
+        PARAM_NOT_NULL(buffer);
+        PARAM_NOT_NULL(bufferLength);
+
+        Js::SharedContents * contents = (Js::SharedContents*)sharedContents;
+        *buffer = contents->buffer;
+        *bufferLength = contents->bufferLength;
+        return JsNoError;
+    });
+}
 #endif // _CHAKRACOREBUILD
 
 CHAKRA_API JsCreateExternalArrayBuffer(_Pre_maybenull_ _Pre_writable_byte_size_(byteLength) void *data, _In_ unsigned int byteLength,
@@ -2726,6 +2882,72 @@ CHAKRA_API JsSetExternalData(_In_ JsValueRef object, _In_opt_ void *data)
     END_JSRT_NO_EXCEPTION
 }
 
+CHAKRA_API JsGetInternalFieldCount(_In_ JsValueRef object, _Out_ unsigned int *count)
+{
+    VALIDATE_JSREF(object);
+    PARAM_NOT_NULL(count);
+
+    BEGIN_JSRT_NO_EXCEPTION
+    {
+        if (JsrtExternalObject::Is(object))
+        {
+            *count = JsrtExternalObject::FromVar(object)->GetInternalFieldCount();
+        }
+        else
+        {
+            *count = 0;
+            RETURN_NO_EXCEPTION(JsErrorInvalidArgument);
+        }
+    }
+    END_JSRT_NO_EXCEPTION
+}
+
+CHAKRA_API JsGetInternalField(_In_ JsValueRef object, _In_ unsigned int index, _Out_ JsValueRef *value)
+{
+    VALIDATE_JSREF(object);
+    PARAM_NOT_NULL(value);
+
+    BEGIN_JSRT_NO_EXCEPTION
+    {
+        *value = JS_INVALID_REFERENCE;
+        if (!JsrtExternalObject::Is(object))
+        {
+            RETURN_NO_EXCEPTION(JsErrorInvalidArgument);
+        }
+
+        JsrtExternalObject * externalObject = JsrtExternalObject::FromVar(object);
+        if (index >= externalObject->GetInternalFieldCount())
+        {
+            RETURN_NO_EXCEPTION(JsErrorInvalidArgument);
+        }
+
+        *value = externalObject->GetInternalField(index);
+    }
+    END_JSRT_NO_EXCEPTION
+}
+
+CHAKRA_API JsSetInternalField(_In_ JsValueRef object, _In_ unsigned int index, _In_opt_ JsValueRef value)
+{
+    VALIDATE_JSREF(object);
+
+    BEGIN_JSRT_NO_EXCEPTION
+    {
+        if (!JsrtExternalObject::Is(object))
+        {
+            RETURN_NO_EXCEPTION(JsErrorInvalidArgument);
+        }
+
+        JsrtExternalObject * externalObject = JsrtExternalObject::FromVar(object);
+        if (index >= externalObject->GetInternalFieldCount())
+        {
+            RETURN_NO_EXCEPTION(JsErrorInvalidArgument);
+        }
+
+        externalObject->SetInternalField(index, value);
+    }
+    END_JSRT_NO_EXCEPTION
+}
+
 CHAKRA_API JsCallFunction(_In_ JsValueRef function, _In_reads_(cargs) JsValueRef *args, _In_ ushort cargs, _Out_opt_ JsValueRef *result)
 {
     if(result != nullptr)
@@ -2855,7 +3077,7 @@ JsValueRef CALLBACK JsNativeFunctionWrapper(JsValueRef callee, JsValueRef *argum
 }
 
 template <bool wrapNativeFunction, class T>
-JsErrorCode JsCreateEnhancedFunctionHelper(_In_ T nativeFunction, _In_opt_ JsValueRef metadata, _In_opt_ void *callbackState, _Out_ JsValueRef *function)
+JsErrorCode JsCreateEnhancedFunctionHelper(_In_ T nativeFunction, _In_opt_ JsValueRef metadata, _In_opt_ void *callbackState, _In_opt_ JsFinalizeCallback finalizeCallback, _Out_ JsValueRef *function)
 {
     return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
         PERFORM_JSRT_TTD_RECORD_ACTION(scriptContext, RecordJsRTAllocateFunction, metadata);
@@ -2889,6 +3111,11 @@ JsErrorCode JsCreateEnhancedFunctionHelper(_In_ T nativeFunction, _In_opt_ JsVal
         }
 
         Js::JavascriptExternalFunction *externalFunction = scriptContext->GetLibrary()->CreateStdCallExternalFunction(method, metadata, callbackState);
+        if (finalizeCallback != nullptr)
+        {
+            // Finalized when the function goes, since nothing else references it
+            externalFunction->SetCallbackStateOwner(JsrtExternalObject::Create(callbackState, finalizeCallback, nullptr, scriptContext));
+        }
         *function = (JsValueRef)externalFunction;
 
         PERFORM_JSRT_TTD_RECORD_ACTION_RESULT(scriptContext, function);
@@ -2899,17 +3126,59 @@ JsErrorCode JsCreateEnhancedFunctionHelper(_In_ T nativeFunction, _In_opt_ JsVal
 
 CHAKRA_API JsCreateEnhancedFunction(_In_ JsEnhancedNativeFunction nativeFunction, _In_opt_ JsValueRef metadata, _In_opt_ void *callbackState, _Out_ JsValueRef *function)
 {
-    return JsCreateEnhancedFunctionHelper<false>(nativeFunction, metadata, callbackState, function);
+    return JsCreateEnhancedFunctionHelper<false>(nativeFunction, metadata, callbackState, nullptr, function);
+}
+
+CHAKRA_API JsCreateEnhancedFunctionWithFinalizer(_In_ JsEnhancedNativeFunction nativeFunction, _In_opt_ JsValueRef metadata, _In_opt_ void *callbackState, _In_opt_ JsFinalizeCallback finalizeCallback, _Out_ JsValueRef *function)
+{
+    return JsCreateEnhancedFunctionHelper<false>(nativeFunction, metadata, callbackState, finalizeCallback, function);
 }
 
 CHAKRA_API JsCreateFunction(_In_ JsNativeFunction nativeFunction, _In_opt_ void *callbackState, _Out_ JsValueRef *function)
 {
-    return JsCreateEnhancedFunctionHelper<true>(nativeFunction, JS_INVALID_REFERENCE, callbackState, function);
+    return JsCreateEnhancedFunctionHelper<true>(nativeFunction, JS_INVALID_REFERENCE, callbackState, nullptr, function);
 }
 
 CHAKRA_API JsCreateNamedFunction(_In_ JsValueRef name, _In_ JsNativeFunction nativeFunction, _In_opt_ void *callbackState, _Out_ JsValueRef *function)
 {
-    return JsCreateEnhancedFunctionHelper<true>(nativeFunction, name, callbackState, function);
+    return JsCreateEnhancedFunctionHelper<true>(nativeFunction, name, callbackState, nullptr, function);
+}
+
+CHAKRA_API JsCreateNativeProxy(_In_ JsValueRef target, _In_reads_(JsNativeProxyTrapCount) const JsNativeFunction *traps, _In_opt_ void *callbackState, _Out_ JsValueRef *proxy)
+{
+    CompileAssert((int)JsNativeProxyTrapGetOwnPropertyDescriptor == (int)Js::JavascriptProxy::NativeTrap_GetOwnPropertyDescriptor);
+    CompileAssert((int)JsNativeProxyTrapDefineProperty == (int)Js::JavascriptProxy::NativeTrap_DefineProperty);
+    CompileAssert((int)JsNativeProxyTrapHas == (int)Js::JavascriptProxy::NativeTrap_Has);
+    CompileAssert((int)JsNativeProxyTrapGet == (int)Js::JavascriptProxy::NativeTrap_Get);
+    CompileAssert((int)JsNativeProxyTrapSet == (int)Js::JavascriptProxy::NativeTrap_Set);
+    CompileAssert((int)JsNativeProxyTrapDeleteProperty == (int)Js::JavascriptProxy::NativeTrap_DeleteProperty);
+    CompileAssert((int)JsNativeProxyTrapOwnKeys == (int)Js::JavascriptProxy::NativeTrap_OwnKeys);
+    CompileAssert((int)JsNativeProxyTrapCount == (int)Js::JavascriptProxy::NativeTrapCount);
+
+    return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        VALIDATE_INCOMING_OBJECT(target, scriptContext);
+        PARAM_NOT_NULL(traps);
+        PARAM_NOT_NULL(proxy);
+        *proxy = nullptr;
+
+#if ENABLE_TTD
+        if (scriptContext->IsTTDRecordOrReplayModeEnabled())
+        {
+            return JsErrorNotImplemented;
+        }
+#endif
+
+        Js::RecyclableObject *targetObject = Js::RecyclableObject::FromVar(target);
+        if (Js::JavascriptProxy::Is(targetObject) && Js::JavascriptProxy::FromVar(targetObject)->IsRevoked())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        *proxy = Js::JavascriptProxy::CreateNative(scriptContext, targetObject,
+            reinterpret_cast<const Js::JavascriptProxy::NativeTrap *>(traps), callbackState);
+
+        return JsNoError;
+    });
 }
 
 void SetErrorMessage(Js::ScriptContext *scriptContext, Js::JavascriptError *newError, JsValueRef message)
@@ -4781,8 +5050,18 @@ CHAKRA_API JsCreateString(
 
     return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
 
-        Js::JavascriptString *stringValue = Js::LiteralStringWithPropertyStringPtr::
-            NewFromCString(content, (CharCount)length, scriptContext->GetLibrary());
+        // Long ASCII content stays one-byte until something needs it widened
+        Js::JavascriptString *stringValue = nullptr;
+        if (length >= Js::OneByteString::MinLength)
+        {
+            stringValue = Js::OneByteString::TryNew(content, (CharCount)length, true /*asciiOnly*/, scriptContext);
+        }
+
+        if (stringValue == nullptr)
+        {
+            stringValue = Js::LiteralStringWithPropertyStringPtr::
+                NewFromCString(content, (CharCount)length, scriptContext->GetLibrary());
+        }
 
         PERFORM_JSRT_TTD_RECORD_ACTION(scriptContext, RecordJsRTCreateString, stringValue->GetSz(), stringValue->GetLength());
 
@@ -4896,78 +5175,254 @@ CHAKRA_API JsCopyStringUtf16(
         });
 }
 
-CHAKRA_API JsCopyString(
-    _In_ JsValueRef value,
-    _Out_opt_ char* buffer,
-    _In_ size_t bufferSize,
-    _Out_opt_ size_t* length)
+// Encodes a string to UTF-8 a piece at a time. The leaves of a concat string tree are encoded straight into the
+// destination, so the tree is not flattened into a UTF-16 copy first. Pieces that can't be walked (such as compound
+// strings), and subtrees nested deeper than MaxDepth, are flattened on their own.
+class StringUtf8Encoder
 {
-    PARAM_NOT_NULL(value);
-    VALIDATE_JSREF(value);
-
-    const char16* str = nullptr;
-    size_t strLength = 0;
-    JsErrorCode errorCode = JsStringToPointer(value, &str, &strLength);
-    if (errorCode != JsNoError)
+public:
+    StringUtf8Encoder(_Out_writes_opt_(bufferSize) char* buffer, size_t bufferSize) :
+        buffer(buffer), bufferSize(bufferSize), count(0), pendingHighSurrogate(0)
     {
-        return errorCode;
     }
 
-    utf8::WideToNarrow utf8Str(str, strLength, buffer, bufferSize);
-    if (length)
+    void Encode(Js::JavascriptString* str)
     {
-        *length = utf8Str.Length();
-    }
+        EncodeTree(str, 0);
 
-    return JsNoError;
-}
+        if (pendingHighSurrogate != 0)
+        {
+            EncodeChars(&pendingHighSurrogate, 1);
+            pendingHighSurrogate = 0;
+        }
+    }
 
-_ALWAYSINLINE JsErrorCode CompileRun(
-    JsValueRef scriptVal,
-    JsSourceContext sourceContext,
-    JsValueRef sourceUrl,
-    JsParseScriptAttributes parseAttributes,
-    _Out_ JsValueRef *result,
-    bool parseOnly)
-{
-    PARAM_NOT_NULL(scriptVal);
-    VALIDATE_JSREF(scriptVal);
-    PARAM_NOT_NULL(sourceUrl);
+    size_t Count() const
+    {
+        return count;
+    }
 
-    bool isExternalArray = Js::ExternalArrayBuffer::Is(scriptVal),
-         isString = false;
-    bool isUtf8   = !(parseAttributes & JsParseScriptAttributeArrayBufferIsUtf16Encoded);
+private:
+    static const uint MaxDepth = 32;
 
-    LoadScriptFlag scriptFlag = LoadScriptFlag_None;
-    const byte* script;
-    size_t cb;
-    const WCHAR *url;
+    char* buffer;
+    size_t bufferSize;
+    size_t count;
+    char16 pendingHighSurrogate; // last char of the previous piece, which may pair with the first char of the next
 
-    if (isExternalArray)
+    void EncodeTree(Js::JavascriptString* str, uint depth)
     {
-        script = ((Js::ExternalArrayBuffer*)(scriptVal))->GetBuffer();
+        while (true)
+        {
+            Js::JavascriptString * const * items = nullptr;
+            int itemCount = -1;
+            if (!str->IsFinalized() && depth < MaxDepth)
+            {
+                itemCount = str->GetRandomAccessItemsFromConcatString(items);
+            }
 
-        cb = ((Js::ExternalArrayBuffer*)(scriptVal))->GetByteLength();
+            if (itemCount < 0)
+            {
+                EncodePiece(str->GetString(), str->GetLength());
+                return;
+            }
 
-        scriptFlag = (LoadScriptFlag)(isUtf8 ?
-            LoadScriptFlag_ExternalArrayBuffer | LoadScriptFlag_Utf8Source :
-            LoadScriptFlag_ExternalArrayBuffer);
+            // The last item is walked by this loop rather than recursively, so right-leaning trees stay shallow
+            Js::JavascriptString* lastItem = nullptr;
+            for (int i = 0; i < itemCount && items[i] != nullptr; i++)
+            {
+                if (lastItem != nullptr)
+                {
+                    EncodeTree(lastItem, depth + 1);
+                }
+                lastItem = items[i];
+            }
+
+            if (lastItem == nullptr)
+            {
+                return;
+            }
+            str = lastItem;
+        }
     }
-    else
+
+    void EncodePiece(const char16* str, size_t strLength)
     {
-        isString = Js::JavascriptString::Is(scriptVal);
-        if (!isString)
+        if (strLength == 0)
         {
-            return JsErrorInvalidArgument;
+            return;
         }
-    }
 
-    JsErrorCode error = GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
-        if (isString)
+        if (pendingHighSurrogate != 0)
         {
-            Js::JavascriptString* jsString = Js::JavascriptString::FromVar(scriptVal);
-            script = (const byte*)jsString->GetSz();
-
+            char16 pair[2] = { pendingHighSurrogate, str[0] };
+            pendingHighSurrogate = 0;
+            if (Js::NumberUtilities::IsSurrogateLowerPart(str[0]))
+            {
+                EncodeChars(pair, 2);
+                str++;
+                strLength--;
+            }
+            else
+            {
+                EncodeChars(pair, 1);
+            }
+        }
+
+        if (strLength != 0 && Js::NumberUtilities::IsSurrogateUpperPart(str[strLength - 1]))
+        {
+            pendingHighSurrogate = str[strLength - 1];
+            strLength--;
+        }
+
+        EncodeChars(str, strLength);
+    }
+
+    void EncodeChars(const char16* str, size_t strLength)
+    {
+        if (strLength == 0)
+        {
+            return;
+        }
+
+        size_t written = 0;
+        if (buffer)
+        {
+            utf8::WideStringToNarrowNoAlloc(str, strLength, buffer + count, bufferSize - count, &written);
+        }
+        else
+        {
+            utf8::WideStringToNarrowNoAlloc(str, strLength, nullptr, 0, &written);
+        }
+        count += written;
+    }
+};
+
+CHAKRA_API JsCopyString(
+    _In_ JsValueRef value,
+    _Out_opt_ char* buffer,
+    _In_ size_t bufferSize,
+    _Out_opt_ size_t* length)
+{
+    PARAM_NOT_NULL(value);
+    VALIDATE_JSREF(value);
+
+    // JSON.stringify results can be encoded without building the UTF-16 string first
+    Js::LazyJSONString* lazyJSONString = Js::LazyJSONString::TryFromVar(value);
+    if (lazyJSONString != nullptr)
+    {
+        size_t written = 0;
+        if (lazyJSONString->TryCopyUtf8(buffer, bufferSize, &written))
+        {
+            if (length)
+            {
+                *length = written;
+            }
+
+            return JsNoError;
+        }
+    }
+
+    // ASCII is already valid UTF-8, copy it without widening the string
+    if (Js::OneByteString::Is(value))
+    {
+        Js::OneByteString *oneByteString = Js::OneByteString::FromVar(value);
+        const char *content = oneByteString->GetOneByteContent();
+        if (content != nullptr && oneByteString->IsAscii())
+        {
+            size_t count = oneByteString->GetLength();
+            if (buffer)
+            {
+                count = min(count, bufferSize);
+                memmove(buffer, content, count);
+            }
+
+            if (length)
+            {
+                *length = count;
+            }
+
+            return JsNoError;
+        }
+    }
+
+    // Concat strings are encoded a piece at a time, rather than flattened first
+    if (Js::JavascriptString::Is(value) && Js::JavascriptString::FromVar(value)->IsTree())
+    {
+        return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+            StringUtf8Encoder encoder(buffer, bufferSize);
+            encoder.Encode(Js::JavascriptString::FromVar(value));
+            if (length)
+            {
+                *length = encoder.Count();
+            }
+            return JsNoError;
+        });
+    }
+
+    const char16* str = nullptr;
+    size_t strLength = 0;
+    JsErrorCode errorCode = JsStringToPointer(value, &str, &strLength);
+    if (errorCode != JsNoError)
+    {
+        return errorCode;
+    }
+
+    utf8::WideToNarrow utf8Str(str, strLength, buffer, bufferSize);
+    if (length)
+    {
+        *length = utf8Str.Length();
+    }
+
+    return JsNoError;
+}
+
+_ALWAYSINLINE JsErrorCode CompileRun(
+    JsValueRef scriptVal,
+    JsSourceContext sourceContext,
+    JsValueRef sourceUrl,
+    JsParseScriptAttributes parseAttributes,
+    _Out_ JsValueRef *result,
+    bool parseOnly)
+{
+    PARAM_NOT_NULL(scriptVal);
+    VALIDATE_JSREF(scriptVal);
+    PARAM_NOT_NULL(sourceUrl);
+
+    bool isExternalArray = Js::ExternalArrayBuffer::Is(scriptVal),
+         isString = false;
+    bool isUtf8   = !(parseAttributes & JsParseScriptAttributeArrayBufferIsUtf16Encoded);
+
+    LoadScriptFlag scriptFlag = LoadScriptFlag_None;
+    const byte* script;
+    size_t cb;
+    const WCHAR *url;
+
+    if (isExternalArray)
+    {
+        script = ((Js::ExternalArrayBuffer*)(scriptVal))->GetBuffer();
+
+        cb = ((Js::ExternalArrayBuffer*)(scriptVal))->GetByteLength();
+
+        scriptFlag = (LoadScriptFlag)(isUtf8 ?
+            LoadScriptFlag_ExternalArrayBuffer | LoadScriptFlag_Utf8Source :
+            LoadScriptFlag_ExternalArrayBuffer);
+    }
+    else
+    {
+        isString = Js::JavascriptString::Is(scriptVal);
+        if (!isString)
+        {
+            return JsErrorInvalidArgument;
+        }
+    }
+
+    JsErrorCode error = GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        if (isString)
+        {
+            Js::JavascriptString* jsString = Js::JavascriptString::FromVar(scriptVal);
+            script = (const byte*)jsString->GetSz();
+
             // JavascriptString is 2 bytes (WCHAR/char16)
             cb = jsString->GetLength() * sizeof(WCHAR);
         }
@@ -5029,6 +5484,26 @@ CHAKRA_API JsCreatePropertyId(
     return JsGetPropertyIdFromNameInternal(wname, wname.Length(), propertyId);
 }
 
+CHAKRA_API JsGetPropertyIdFromString(
+    _In_ JsValueRef string,
+    _Out_ JsPropertyIdRef *propertyId)
+{
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext * scriptContext) -> JsErrorCode {
+        VALIDATE_INCOMING_REFERENCE(string, scriptContext);
+        PARAM_NOT_NULL(propertyId);
+        *propertyId = nullptr;
+
+        if (!Js::JavascriptString::Is(string))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::JavascriptString::FromVar(string)->GetPropertyRecord((Js::PropertyRecord const **)propertyId);
+
+        return JsNoError;
+    });
+}
+
 CHAKRA_API JsCopyPropertyId(
     _In_ JsPropertyIdRef propertyId,
     _Out_ char* buffer,
@@ -5120,19 +5595,19 @@ CHAKRA_API JsSerialize(
     return errorCode;
 }
 
-CHAKRA_API JsParseSerialized(
+static JsErrorCode RunSerializedCore(
     _In_ JsValueRef bufferVal,
     _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
+    _In_ JsSerializedScriptUnloadCallback scriptUnloadCallback,
     _In_ JsSourceContext sourceContext,
     _In_ JsValueRef sourceUrl,
+    bool parseOnly,
     _Out_ JsValueRef *result)
 {
     PARAM_NOT_NULL(bufferVal);
-    PARAM_NOT_NULL(sourceUrl);
-
     const WCHAR *url;
 
-    if (Js::JavascriptString::Is(sourceUrl))
+    if (sourceUrl && Js::JavascriptString::Is(sourceUrl))
     {
         url = ((Js::JavascriptString*)(sourceUrl))->GetSz();
     }
@@ -5151,43 +5626,53 @@ CHAKRA_API JsParseSerialized(
     byte* buffer = arrayBuffer->GetBuffer();
 
     return RunSerializedScriptCore(
-      scriptLoadCallback, DummyScriptUnloadCallback,
-      sourceContext,// use the same user provided sourceContext as scriptLoadSourceContext
-      buffer, arrayBuffer, sourceContext, url, true, false, result, Js::Constants::InvalidSourceIndex);
+        scriptLoadCallback, scriptUnloadCallback,
+        sourceContext, // use the same user provided sourceContext as scriptLoadSourceContext
+        buffer, arrayBuffer, sourceContext, url, parseOnly, false, result, Js::Constants::InvalidSourceIndex);
 }
 
-CHAKRA_API JsRunSerialized(
+CHAKRA_API JsParseSerialized(
     _In_ JsValueRef bufferVal,
     _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
     _In_ JsSourceContext sourceContext,
     _In_ JsValueRef sourceUrl,
     _Out_ JsValueRef *result)
 {
-    PARAM_NOT_NULL(bufferVal);
-    const WCHAR *url;
-
-    if (sourceUrl && Js::JavascriptString::Is(sourceUrl))
-    {
-        url = ((Js::JavascriptString*)(sourceUrl))->GetSz();
-    }
-    else
-    {
-        return JsErrorInvalidArgument;
-    }
+    PARAM_NOT_NULL(sourceUrl);
+    return RunSerializedCore(bufferVal, scriptLoadCallback, DummyScriptUnloadCallback, sourceContext, sourceUrl, true, result);
+}
 
-    // JsParseSerialized only accepts ArrayBuffer (incl. ExternalArrayBuffer)
-    if (!Js::ExternalArrayBuffer::Is(bufferVal))
-    {
-        return JsErrorInvalidArgument;
-    }
+CHAKRA_API JsRunSerialized(
+    _In_ JsValueRef bufferVal,
+    _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
+    _In_ JsSourceContext sourceContext,
+    _In_ JsValueRef sourceUrl,
+    _Out_ JsValueRef *result)
+{
+    return RunSerializedCore(bufferVal, scriptLoadCallback, DummyScriptUnloadCallback, sourceContext, sourceUrl, false, result);
+}
 
-    Js::ArrayBuffer* arrayBuffer = Js::ArrayBuffer::FromVar(bufferVal);
-    byte* buffer = arrayBuffer->GetBuffer();
+CHAKRA_API JsParseSerializedWithUnloadCallback(
+    _In_ JsValueRef bufferVal,
+    _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
+    _In_ JsSerializedScriptUnloadCallback scriptUnloadCallback,
+    _In_ JsSourceContext sourceContext,
+    _In_ JsValueRef sourceUrl,
+    _Out_ JsValueRef *result)
+{
+    PARAM_NOT_NULL(sourceUrl);
+    return RunSerializedCore(bufferVal, scriptLoadCallback, scriptUnloadCallback, sourceContext, sourceUrl, true, result);
+}
 
-    return RunSerializedScriptCore(
-        scriptLoadCallback, DummyScriptUnloadCallback,
-        sourceContext, // use the same user provided sourceContext as scriptLoadSourceContext
-        buffer, arrayBuffer, sourceContext, url, false, false, result, Js::Constants::InvalidSourceIndex);
+CHAKRA_API JsRunSerializedWithUnloadCallback(
+    _In_ JsValueRef bufferVal,
+    _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
+    _In_ JsSerializedScriptUnloadCallback scriptUnloadCallback,
+    _In_ JsSourceContext sourceContext,
+    _In_ JsValueRef sourceUrl,
+    _Out_ JsValueRef *result)
+{
+    return RunSerializedCore(bufferVal, scriptLoadCallback, scriptUnloadCallback, sourceContext, sourceUrl, false, result);
 }
 
 CHAKRA_API JsCreatePromise(_Out_ JsValueRef *promise, _Out_ JsValueRef *resolve, _Out_ JsValueRef *reject)
@@ -5431,6 +5916,39 @@ CHAKRA_API JsCopyStringOneByte(
 {
     PARAM_NOT_NULL(value);
     VALIDATE_JSREF(value);
+
+    if (Js::OneByteString::Is(value))
+    {
+        Js::OneByteString *oneByteString = Js::OneByteString::FromVar(value);
+        const char *content = oneByteString->GetOneByteContent();
+        if (content != nullptr)
+        {
+            if (written)
+            {
+                *written = 0;
+            }
+
+            size_t strLength = oneByteString->GetLength();
+            if (start < 0 || (size_t)start > strLength)
+            {
+                return JsErrorInvalidArgument;
+            }
+
+            size_t count = min(static_cast<size_t>(length), strLength - start);
+            if (buffer)
+            {
+                memmove(buffer, content + start, count);
+            }
+
+            if (written)
+            {
+                *written = count;
+            }
+
+            return JsNoError;
+        }
+    }
+
     return WriteStringCopy(value, start, length, written,
         [buffer](const char16* src, size_t count, size_t *needed)
     {
@@ -5494,45 +6012,122 @@ CHAKRA_API JsSetHostPromiseRejectionTracker(_In_ JsHostPromiseRejectionTrackerCa
     /*allowInObjectBeforeCollectCallback*/true);
 }
 
-CHAKRA_API JsGetProxyProperties (_In_ JsValueRef object, _Out_ bool* isProxy, _Out_opt_ JsValueRef* target, _Out_opt_ JsValueRef* handler)
+CHAKRA_API JsSetPromiseJobsPendingCallback(_In_opt_ JsPromiseJobsPendingCallback promiseJobsPendingCallback, _In_opt_ void *callbackState)
 {
-    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext * scriptContext) -> JsErrorCode {
-        VALIDATE_INCOMING_REFERENCE(object, scriptContext);
-        PARAM_NOT_NULL(isProxy);
-
-        if (target != nullptr)
-        {
-            *target = JS_INVALID_REFERENCE;
-        }
-
-        if (handler != nullptr)
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+#if ENABLE_TTD
+        if (scriptContext->IsTTDRecordOrReplayModeEnabled())
         {
-            *handler = JS_INVALID_REFERENCE;
+            return JsErrorNotImplemented;
         }
+#endif
 
-        *isProxy = Js::JavascriptProxy::Is(object);
-
-        if (!*isProxy)
-        {
-            return JsNoError;
-        }
+        scriptContext->GetThreadContext()->SetPromiseJobsPendingCallback((ThreadContext::PromiseJobsPendingCallback)promiseJobsPendingCallback, callbackState);
+        return JsNoError;
+    },
+    /*allowInObjectBeforeCollectCallback*/true);
+}
 
-        Js::JavascriptProxy* proxy = Js::JavascriptProxy::UnsafeFromVar(object);
-        bool revoked = proxy->IsRevoked();
+CHAKRA_API JsEnqueuePromiseJob(_In_ JsValueRef job)
+{
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        VALIDATE_INCOMING_FUNCTION(job, scriptContext);
 
-        if (target != nullptr && !revoked)
+        ThreadContext *threadContext = scriptContext->GetThreadContext();
+        if (!threadContext->IsPromiseJobQueueEnabled())
         {
-            *target = static_cast<JsValueRef>(proxy->GetTarget());
+            return JsErrorInvalidArgument;
         }
 
-        if (handler != nullptr && !revoked)
+        if (threadContext->EnqueuePromiseJob(job))
         {
-            *handler = static_cast<JsValueRef>(proxy->GetHandler());
+            threadContext->NotifyPromiseJobsPending();
         }
-
         return JsNoError;
-    },
-    /*allowInObjectBeforeCollectCallback*/true);
+    });
+}
+
+CHAKRA_API JsRunPromiseJobs()
+{
+    return ContextAPIWrapper_NoRecord<JSRT_MAYBE_TRUE>([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        ThreadContext *threadContext = scriptContext->GetThreadContext();
+        bool wasRunningPromiseJobs = threadContext->IsRunningPromiseJobs();
+        threadContext->SetIsRunningPromiseJobs(true);
+
+        try
+        {
+            Js::Var job;
+            while ((job = threadContext->DequeuePromiseJob()) != nullptr)
+            {
+                Js::RecyclableObject *function = Js::RecyclableObject::FromVar(job);
+                if (function->GetScriptContext() != scriptContext)
+                {
+                    function = Js::RecyclableObject::FromVar(Js::CrossSite::MarshalVar(scriptContext, function));
+                }
+
+                Js::Var undefined = scriptContext->GetLibrary()->GetUndefined();
+                Js::Arguments args(Js::CallInfo(1), &undefined);
+                try
+                {
+                    Js::JavascriptFunction::FromVar(function)->CallRootFunction(args, scriptContext, true);
+                }
+                catch (const Js::JavascriptException& err)
+                {
+                    // Like a host running the jobs one at a time with JsCallFunction, ignore what a job throws.
+                    err.GetAndClear();
+                }
+            }
+        }
+        catch (...)
+        {
+            threadContext->SetIsRunningPromiseJobs(wasRunningPromiseJobs);
+            throw;
+        }
+
+        threadContext->SetIsRunningPromiseJobs(wasRunningPromiseJobs);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetProxyProperties (_In_ JsValueRef object, _Out_ bool* isProxy, _Out_opt_ JsValueRef* target, _Out_opt_ JsValueRef* handler)
+{
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext * scriptContext) -> JsErrorCode {
+        VALIDATE_INCOMING_REFERENCE(object, scriptContext);
+        PARAM_NOT_NULL(isProxy);
+
+        if (target != nullptr)
+        {
+            *target = JS_INVALID_REFERENCE;
+        }
+
+        if (handler != nullptr)
+        {
+            *handler = JS_INVALID_REFERENCE;
+        }
+
+        *isProxy = Js::JavascriptProxy::Is(object);
+
+        if (!*isProxy)
+        {
+            return JsNoError;
+        }
+
+        Js::JavascriptProxy* proxy = Js::JavascriptProxy::UnsafeFromVar(object);
+        bool revoked = proxy->IsRevoked();
+
+        if (target != nullptr && !revoked)
+        {
+            *target = static_cast<JsValueRef>(proxy->GetTarget());
+        }
+
+        if (handler != nullptr && !revoked)
+        {
+            *handler = static_cast<JsValueRef>(proxy->GetHandler());
+        }
+
+        return JsNoError;
+    },
+    /*allowInObjectBeforeCollectCallback*/true);
 }
 
 CHAKRA_API JsSerializeParserStateCore(
@@ -5776,4 +6371,678 @@ CHAKRA_API JsRunScriptWithParserState(
         buffer, arrayBuffer, sourceContext, url, false, true, result, sourceIndex);
 }
 
+
+CHAKRA_API JsDetachArrayBuffer(_In_ JsValueRef arrayBuffer)
+{
+    return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        VALIDATE_INCOMING_REFERENCE(arrayBuffer, scriptContext);
+
+        if (!Js::ArrayBuffer::Is(arrayBuffer))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::ArrayBuffer* buffer = Js::ArrayBuffer::FromVar(arrayBuffer);
+        if (buffer->IsDetached() || buffer->IsWebAssemblyArrayBuffer())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::ArrayBufferDetachedStateBase* state = buffer->DetachAndGetState(false /*queueForDelayFree*/);
+        state->CleanUp();
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSetRuntimeCollectEventCallback(_In_ JsRuntimeHandle runtime, _In_opt_ void *callbackState, _In_opt_ JsCollectEventCallback collectEventCallback)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+        JsrtRuntime::FromHandle(runtime)->SetCollectEventCallback(collectEventCallback, callbackState);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetRuntimeHeapSpaceStatistics(_In_ JsRuntimeHandle runtime, _Out_writes_(JsHeapSpaceCount) JsHeapSpaceStatistics *statistics)
+{
+    CompileAssert((int)JsHeapSpaceSmallNormal == (int)HeapSpaceSmallNormal);
+    CompileAssert((int)JsHeapSpaceSmallLeaf == (int)HeapSpaceSmallLeaf);
+    CompileAssert((int)JsHeapSpaceSmallFinalizable == (int)HeapSpaceSmallFinalizable);
+    CompileAssert((int)JsHeapSpaceMedium == (int)HeapSpaceMedium);
+    CompileAssert((int)JsHeapSpaceLarge == (int)HeapSpaceLarge);
+    CompileAssert((int)JsHeapSpaceCount == (int)HeapSpaceCount);
+
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+        PARAM_NOT_NULL(statistics);
+        memset(statistics, 0, sizeof(JsHeapSpaceStatistics) * JsHeapSpaceCount);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtime)->GetThreadContext();
+        Recycler * recycler = threadContext->GetRecycler();
+
+        if (recycler && recycler->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        if (recycler == nullptr)
+        {
+            // Nothing has been allocated yet
+            return JsNoError;
+        }
+
+        HeapSpaceStats spaceStats[HeapSpaceCount];
+        recycler->GetHeapSpaceStats(spaceStats);
+
+        for (int i = 0; i < JsHeapSpaceCount; i++)
+        {
+            statistics[i].usedSize = spaceStats[i].usedBytes;
+            statistics[i].committedSize = spaceStats[i].committedBytes;
+        }
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSetRuntimeSampleCallback(_In_ JsRuntimeHandle runtime, _In_opt_ void *callbackState, _In_opt_ JsSampleCallback sampleCallback)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+        JsrtRuntime::FromHandle(runtime)->SetSampleCallback(sampleCallback, callbackState);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsRequestRuntimeSample(_In_ JsRuntimeHandle runtimeHandle)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+    JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext()->RequestScriptSample();
+    return JsNoError;
+}
+
+CHAKRA_API JsIdleCollectGarbage(_In_ JsRuntimeHandle runtimeHandle, _In_ unsigned int idleTimeInMs, _Out_opt_ unsigned int *nextIdleTimeInMs)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        if (nextIdleTimeInMs != nullptr)
+        {
+            *nextIdleTimeInMs = 0;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->GetRecycler() && threadContext->GetRecycler()->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        // Idle work can't run underneath script
+        if (threadContext->IsScriptActive())
+        {
+            return JsErrorRuntimeInUse;
+        }
+
+        Recycler* recycler = threadContext->EnsureRecycler();
+        DWORD nextIdleTick = recycler->DoIdleWork(::GetTickCount() + idleTimeInMs);
+        if (nextIdleTimeInMs != nullptr)
+        {
+            int remaining = (int)(nextIdleTick - ::GetTickCount());
+            *nextIdleTimeInMs = nextIdleTick == UINT_MAX ? UINT_MAX : (remaining > 0 ? remaining : 0);
+        }
+        return JsNoError;
+    });
+}
+
+template <class CharType>
+static JsErrorCode CreateExternalString(
+    _In_reads_(length) const CharType *content,
+    _In_ size_t length,
+    _In_opt_ JsFinalizeCallback finalizeCallback,
+    _In_opt_ void *callbackState,
+    _Out_ JsValueRef *value)
+{
+    PARAM_NOT_NULL(value);
+    *value = JS_INVALID_REFERENCE;
+
+    if (content == nullptr && length > 0)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    if (length > static_cast<CharCount>(-1))
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+
+        Js::JavascriptString *stringValue = Js::JsrtExternalString::New(content, (CharCount)length,
+            finalizeCallback, callbackState, scriptContext);
+
+        PERFORM_JSRT_TTD_RECORD_ACTION(scriptContext, RecordJsRTCreateString, stringValue->GetSz(), stringValue->GetLength());
+
+        *value = stringValue;
+
+        PERFORM_JSRT_TTD_RECORD_ACTION_RESULT(scriptContext, value);
+
+        JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(*value));
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsCreateExternalStringLatin1(
+    _In_reads_(length) const char *content,
+    _In_ size_t length,
+    _In_opt_ JsFinalizeCallback finalizeCallback,
+    _In_opt_ void *callbackState,
+    _Out_ JsValueRef *value)
+{
+    return CreateExternalString(content, length, finalizeCallback, callbackState, value);
+}
+
+CHAKRA_API JsCreateExternalStringUtf16(
+    _In_reads_(length) const uint16_t *content,
+    _In_ size_t length,
+    _In_opt_ JsFinalizeCallback finalizeCallback,
+    _In_opt_ void *callbackState,
+    _Out_ JsValueRef *value)
+{
+    return CreateExternalString((const char16 *)content, length, finalizeCallback, callbackState, value);
+}
+
+CHAKRA_API JsGetExternalStringContent(
+    _In_ JsValueRef value,
+    _Outptr_result_maybenull_ const void **content,
+    _Out_ size_t *length,
+    _Out_ bool *isOneByte,
+    _Outptr_result_maybenull_ void **callbackState)
+{
+    VALIDATE_JSREF(value);
+    PARAM_NOT_NULL(content);
+    PARAM_NOT_NULL(length);
+    PARAM_NOT_NULL(isOneByte);
+    PARAM_NOT_NULL(callbackState);
+
+    *content = nullptr;
+    *length = 0;
+    *isOneByte = false;
+    *callbackState = nullptr;
+
+    BEGIN_JSRT_NO_EXCEPTION
+    {
+        if (!Js::JavascriptString::Is(value))
+        {
+            RETURN_NO_EXCEPTION(JsErrorInvalidArgument);
+        }
+
+        if (Js::JsrtExternalString::Is(value))
+        {
+            Js::JsrtExternalString *externalString = static_cast<Js::JsrtExternalString *>(Js::JavascriptString::FromVar(value));
+            *content = externalString->GetContent();
+            *length = externalString->GetLength();
+            *isOneByte = externalString->IsOneByte();
+            *callbackState = externalString->GetCallbackState();
+        }
+    }
+    END_JSRT_NO_EXCEPTION
+}
+
+CHAKRA_API JsSetRuntimeMaxJitThreadCount(_In_ JsRuntimeHandle runtimeHandle, _In_ unsigned int threadCount)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+#if ENABLE_NATIVE_CODEGEN
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        if (!threadContext->SetMaxJitThreadCount(threadCount))
+        {
+            // The background threads are already running
+            return JsErrorRuntimeInUse;
+        }
+#endif
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSerializeDynamicProfile(_In_ JsSourceContext sourceContext, _Out_ JsValueRef *buffer)
+{
+    PARAM_NOT_NULL(buffer);
+    *buffer = JS_INVALID_REFERENCE;
+
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+#if ENABLE_PROFILE_INFO
+        SourceContextInfo * sourceContextInfo = scriptContext->GetSourceContextInfo(sourceContext, nullptr);
+        if (sourceContextInfo == nullptr || sourceContextInfo->sourceDynamicProfileManager == nullptr)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::SourceDynamicProfileManager * manager = sourceContextInfo->sourceDynamicProfileManager;
+        size_t bufferSize = 0;
+        if (!manager->SaveToHostBuffer(scriptContext, sourceContextInfo, nullptr, &bufferSize))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        if (bufferSize > UINT_MAX)
+        {
+            return JsErrorOutOfMemory;
+        }
+
+        Js::ArrayBuffer * arrayBuffer = scriptContext->GetLibrary()->CreateArrayBuffer(static_cast<uint32>(bufferSize));
+        if (!manager->SaveToHostBuffer(scriptContext, sourceContextInfo, (char *)arrayBuffer->GetBuffer(), &bufferSize))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        *buffer = arrayBuffer;
+        return JsNoError;
+#else
+        return JsErrorInvalidArgument;
+#endif
+    });
+}
+
+CHAKRA_API JsLoadDynamicProfile(
+    _In_ JsSourceContext sourceContext,
+    _In_ JsValueRef sourceUrl,
+    _In_reads_(bufferLength) const BYTE *buffer,
+    _In_ unsigned int bufferLength)
+{
+    PARAM_NOT_NULL(buffer);
+
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        if (sourceUrl == JS_INVALID_REFERENCE || !Js::JavascriptString::Is(sourceUrl))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+#if ENABLE_PROFILE_INFO
+        // The profile seeds the source before any of its functions are created
+        if (scriptContext->GetSourceContextInfo(sourceContext, nullptr) != nullptr)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::SourceDynamicProfileManager * manager = Js::SourceDynamicProfileManager::LoadFromHostBuffer(
+            (char const *)buffer, bufferLength, scriptContext->GetRecycler());
+        if (manager == nullptr)
+        {
+            return JsErrorBadSerializedScript;
+        }
+
+        const char16 * url = ((Js::JavascriptString*)(sourceUrl))->GetSz();
+        SourceContextInfo * sourceContextInfo = scriptContext->CreateSourceContextInfo(sourceContext, url, wcslen(url), nullptr);
+        sourceContextInfo->sourceDynamicProfileManager = manager;
+#endif
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSetPerfMapFlags(_In_ JsPerfMapFlags flags)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        if ((flags & ~(JsPerfMapBasic | JsPerfMapJitDump)) != 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+#if PERFMAP_TRACE_ENABLED && ENABLE_NATIVE_CODEGEN && !defined(_WIN32)
+        int mode = PlatformAgnostic::PerfTrace::ModeNone;
+        if (flags & JsPerfMapBasic)
+        {
+            mode |= PlatformAgnostic::PerfTrace::ModePerfMap;
+        }
+        if (flags & JsPerfMapJitDump)
+        {
+            mode |= PlatformAgnostic::PerfTrace::ModeJitDump;
+        }
+        if (!PlatformAgnostic::PerfTrace::Enable(mode))
+        {
+            return JsErrorFatal;
+        }
+        return JsNoError;
+#else
+        return flags == JsPerfMapNone ? JsNoError : JsErrorNotImplemented;
+#endif
+    });
+}
+
+CHAKRA_API JsSetRuntimeExternalRootsCallback(_In_ JsRuntimeHandle runtime, _In_opt_ void *callbackState, _In_opt_ JsExternalRootsCallback externalRootsCallback)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+        JsrtRuntime::FromHandle(runtime)->SetExternalRootsCallback(externalRootsCallback, callbackState);
+        return JsNoError;
+    });
+}
+
+static void FillJitFunctionStatistics(const Js::JitStatistics::FunctionStats * stats, JsJitFunctionStatistics * statistics)
+{
+    memset(statistics, 0, sizeof(*statistics));
+    statistics->functionId = stats->functionNumber;
+    statistics->name = stats->name;
+    statistics->url = stats->url;
+    statistics->line = stats->line;
+    statistics->column = stats->column;
+    statistics->loopBodyJitCount = stats->loopBodyJitCount;
+    statistics->loopBodyJitQueueTime = stats->loopBodyJitQueueTime / 1000.0;
+    statistics->maxLoopBodyJitQueueTime = stats->maxLoopBodyJitQueueTime / 1000.0;
+    statistics->osrEntryCount = stats->osrEntryCount;
+    statistics->osrBailOutCount = stats->osrBailOutCount;
+    statistics->bailOutCount = stats->bailOutCount;
+    statistics->rejitCount = stats->rejitCount;
+}
+
+static void JitStatisticsEventThunk(const Js::JitStatistics::Event& event, void * callback, void * callbackState)
+{
+    JsJitFunctionStatistics statistics;
+    FillJitFunctionStatistics(event.function, &statistics);
+
+    JsJitEvent jitEvent;
+    jitEvent.type = event.type == Js::JitStatistics::EventType::LoopBodyJitted ? JsJitEventLoopBodyJitted : JsJitEventBailOut;
+    jitEvent.function = &statistics;
+    jitEvent.loopNumber = event.loopNumber;
+    jitEvent.queueTime = event.queueTime / 1000.0;
+    jitEvent.bailOutKind = event.bailOutKind;
+    jitEvent.rejitReason = event.rejitReason;
+    jitEvent.fromLoopBody = event.fromLoopBody;
+
+    reinterpret_cast<JsJitEventCallback>(callback)(&jitEvent, callbackState);
+}
+
+CHAKRA_API JsSetRuntimeJitStatisticsEnabled(_In_ JsRuntimeHandle runtime, _In_ bool enabled, _In_opt_ JsJitEventCallback eventCallback, _In_opt_ void *callbackState)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtime)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        threadContext->SetJitStatisticsEnabled(enabled);
+        if (enabled)
+        {
+            threadContext->GetJitStatistics()->SetEventCallback(JitStatisticsEventThunk, reinterpret_cast<void *>(eventCallback), callbackState);
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsEnumerateRuntimeJitStatistics(_In_ JsRuntimeHandle runtime, _In_ JsJitStatisticsCallback callback, _In_opt_ void *callbackState, _In_ bool reset)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+        PARAM_NOT_NULL(callback);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtime)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Js::JitStatistics * jitStatistics = threadContext->GetJitStatistics();
+        if (jitStatistics == nullptr)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        JsUtil::List<JsJitBailOutKindCount, HeapAllocator> bailOutKinds(&HeapAllocator::Instance);
+        JsUtil::List<JsJitRejitReasonCount, HeapAllocator> rejitReasons(&HeapAllocator::Instance);
+        jitStatistics->Map([&](const Js::JitStatistics::FunctionStats * stats)
+        {
+            JsJitFunctionStatistics statistics;
+            FillJitFunctionStatistics(stats, &statistics);
+
+#if ENABLE_NATIVE_CODEGEN
+            bailOutKinds.Clear();
+            stats->bailOutKindCounts.Map([&](uint kind, uint count)
+            {
+                JsJitBailOutKindCount kindCount = { jitStatistics->GetBailOutKindName(kind), count };
+                bailOutKinds.Add(kindCount);
+            });
+            statistics.bailOutKinds = bailOutKinds.GetBuffer();
+            statistics.bailOutKindCount = bailOutKinds.Count();
+#endif
+
+            rejitReasons.Clear();
+            stats->rejitReasonCounts.Map([&](uint reason, uint count)
+            {
+                JsJitRejitReasonCount reasonCount = { GetRejitReasonName(static_cast<RejitReason>(reason)), count };
+                rejitReasons.Add(reasonCount);
+            });
+            statistics.rejitReasons = rejitReasons.GetBuffer();
+            statistics.rejitReasonCount = rejitReasons.Count();
+
+            callback(&statistics, callbackState);
+        });
+
+        if (reset)
+        {
+            jitStatistics->Reset();
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsEnumerateRuntimeDeoptLog(_In_ JsRuntimeHandle runtime, _In_ JsJitDeoptLogCallback callback, _In_opt_ void *callbackState, _In_ bool reset, _Out_opt_ unsigned int *deoptCount)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+        PARAM_NOT_NULL(callback);
+
+        if (deoptCount != nullptr)
+        {
+            *deoptCount = 0;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtime)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Js::JitStatistics * jitStatistics = threadContext->GetJitStatistics();
+        if (jitStatistics == nullptr)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        uint64 startTime = jitStatistics->GetStartTime();
+        jitStatistics->MapDeoptLog([&](const Js::JitStatistics::DeoptLogEntry& logEntry)
+        {
+            JsJitFunctionStatistics statistics;
+            FillJitFunctionStatistics(logEntry.function, &statistics);
+
+            JsJitDeoptLogEntry entry;
+            entry.time = (logEntry.time - startTime) / 1000.0;
+            entry.function = &statistics;
+            entry.loopNumber = logEntry.loopNumber;
+            entry.fromLoopBody = logEntry.loopNumber != Js::LoopHeader::NoLoop;
+#if ENABLE_NATIVE_CODEGEN
+            entry.bailOutKind = jitStatistics->GetBailOutKindName(logEntry.bailOutKind);
+#else
+            entry.bailOutKind = nullptr;
+#endif
+            entry.rejitReason = logEntry.rejitReason != RejitReason::None ? GetRejitReasonName(logEntry.rejitReason) : nullptr;
+
+            callback(&entry, callbackState);
+        });
+
+        if (deoptCount != nullptr)
+        {
+            *deoptCount = jitStatistics->GetDeoptCount();
+        }
+
+        if (reset)
+        {
+            jitStatistics->ClearDeoptLog();
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsTakeRuntimeHeapSnapshot(_In_ JsRuntimeHandle runtime, _In_ JsHeapSnapshotWriteCallback writeCallback, _In_opt_ void *callbackState)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+        PARAM_NOT_NULL(writeCallback);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtime)->GetThreadContext();
+        Recycler * recycler = threadContext->GetRecycler();
+
+        if (recycler && recycler->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        JsrtHeapSnapshot snapshot(threadContext, writeCallback, callbackState);
+        snapshot.Write();
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSetRuntimeAllocationSampling(_In_ JsRuntimeHandle runtime, _In_ size_t sampleInterval, _In_opt_ void *callbackState,
+    _In_opt_ JsAllocationSampleCallback sampleCallback, _In_opt_ JsAllocationSampleFreeCallback freeCallback)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+        JsrtRuntime::FromHandle(runtime)->SetAllocationSampling(sampleInterval, sampleCallback, freeCallback, callbackState);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsAddRuntimeExternalMemoryPressure(_In_ JsRuntimeHandle runtime, _In_ size_t allocatedBytes)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtime)->GetThreadContext();
+        Recycler * recycler = threadContext->GetRecycler();
+
+        if (recycler && recycler->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        if (recycler == nullptr || allocatedBytes == 0)
+        {
+            return JsNoError;
+        }
+
+        recycler->AddExternalMemoryPressure(allocatedBytes);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsRedeferRuntimeInactiveFunctions(_In_ JsRuntimeHandle runtime, _Out_opt_ unsigned int *redeferredFunctionCount, _Out_opt_ size_t *freedBytes)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+        if (redeferredFunctionCount)
+        {
+            *redeferredFunctionCount = 0;
+        }
+        if (freedBytes)
+        {
+            *freedBytes = 0;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtime)->GetThreadContext();
+        Recycler * recycler = threadContext->GetRecycler();
+
+        if (recycler && recycler->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        uint functionCount = 0;
+        size_t byteCount = 0;
+        threadContext->RedeferInactiveFunctions(&functionCount, &byteCount);
+
+        if (redeferredFunctionCount)
+        {
+            *redeferredFunctionCount = functionCount;
+        }
+        if (freedBytes)
+        {
+            *freedBytes = byteCount;
+        }
+        return JsNoError;
+    });
+}
+
 #endif // _CHAKRACOREBUILD
@@ -4,6 +4,7 @@
 //-------------------------------------------------------------------------------------------------------
 #include "JsrtPch.h"
 #include "JsrtRuntime.h"
+#include "JsrtPropertyCache.h"
 #include "Base/ThreadContextTlsEntry.h"
 
 static THREAD_LOCAL JsrtContext* s_tlvSlot = nullptr;
@@ -110,6 +111,25 @@ bool JsrtContext::TrySetCurrent(JsrtContext * context)
     return true;
 }
 
+Js::JsrtPropertyInlineCaches * JsrtContext::EnsurePropertyInlineCaches(const Js::PropertyRecord * propertyRecord)
+{
+    Recycler * recycler = this->GetScriptContext()->GetRecycler();
+    if (this->propertyInlineCaches == nullptr)
+    {
+        this->propertyInlineCaches = RecyclerNew(recycler, PropertyInlineCacheMap, recycler);
+    }
+
+    Js::JsrtPropertyInlineCaches * inlineCaches = nullptr;
+    if (!this->propertyInlineCaches->TryGetValue(propertyRecord->GetPropertyId(), &inlineCaches))
+    {
+        inlineCaches = RecyclerNewStructZ(recycler, Js::JsrtPropertyInlineCaches);
+        inlineCaches->getInlineCache = Js::ScriptContextPolymorphicInlineCache::New(MinPolymorphicInlineCacheSize, this->javascriptLibrary);
+        inlineCaches->setInlineCache = Js::ScriptContextPolymorphicInlineCache::New(MinPolymorphicInlineCacheSize, this->javascriptLibrary);
+        this->propertyInlineCaches->Add(propertyRecord->GetPropertyId(), inlineCaches);
+    }
+    return inlineCaches;
+}
+
 void JsrtContext::Mark(Recycler * recycler)
 {
     AssertMsg(false, "Mark called on object that isn't TrackableObject");
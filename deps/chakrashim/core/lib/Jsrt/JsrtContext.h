@@ -6,6 +6,11 @@
 
 #include "JsrtRuntime.h"
 
+namespace Js
+{
+    struct JsrtPropertyInlineCaches;
+}
+
 class JsrtContext : public FinalizableObject
 {
 public:
@@ -28,6 +33,7 @@ class JsrtContext : public FinalizableObject
     static void OnReplayDisposeContext_TTDCallback(FinalizableObject* jsrtCtx);
 #endif
     void OnScriptLoad(Js::JavascriptFunction * scriptFunction, Js::Utf8SourceInfo* utf8SourceInfo, CompileScriptException* compileException);
+    Js::JsrtPropertyInlineCaches * EnsurePropertyInlineCaches(const Js::PropertyRecord * propertyRecord);
 protected:
     DEFINE_VTABLE_CTOR_NOBASE(JsrtContext);
     JsrtContext(JsrtRuntime * runtime);
@@ -41,4 +47,9 @@ class JsrtContext : public FinalizableObject
     Field(void*) externalData = nullptr;
     Field(TaggedPointer<JsrtContext>) previous;
     Field(TaggedPointer<JsrtContext>) next;
+
+    // The inline caches that property caches use in this context, by property. Property caches only hold
+    // them weakly, so a host keeping a property cache doesn't keep the context alive.
+    typedef JsUtil::BaseDictionary<Js::PropertyId, Js::JsrtPropertyInlineCaches *, RecyclerNonLeafAllocator> PropertyInlineCacheMap;
+    Field(PropertyInlineCacheMap *) propertyInlineCaches = nullptr;
 };
@@ -32,7 +32,11 @@ namespace Js
     void JsrtExternalArrayBuffer::Finalize(bool isShutdown)
     {
         ReleaseBufferContent();
+    }
 
+    void JsrtExternalArrayBuffer::Dispose(bool isShutdown)
+    {
+        // See JsrtExternalObject::Dispose
         if (finalizeCallback != nullptr && !isDetached)
         {
             finalizeCallback(callbackState);
@@ -19,6 +19,7 @@ namespace Js {
         static JsrtExternalArrayBuffer* New(byte *buffer, uint32 length, JsFinalizeCallback finalizeCallback, void *callbackState, DynamicType *type);
         static JsrtExternalArrayBuffer* New(RefCountedBuffer *buffer, uint32 length, JsFinalizeCallback finalizeCallback, void *callbackState, DynamicType *type);
         void Finalize(bool isShutdown) override;
+        void Dispose(bool isShutdown) override;
 
     private:
         FieldNoBarrier(JsFinalizeCallback) finalizeCallback;
@@ -21,14 +21,20 @@ JsrtExternalType::JsrtExternalType(Js::ScriptContext* scriptContext, JsFinalizeC
     this->flags |= TypeFlagMask_JsrtExternal;
 }
 
-JsrtExternalObject::JsrtExternalObject(JsrtExternalType * type, void *data) :
+JsrtExternalObject::JsrtExternalObject(JsrtExternalType * type, void *data, uint internalFieldCount) :
     slot(data),
+    internalFieldCount(internalFieldCount),
     Js::DynamicObject(type, false/* initSlots*/)
 {
+    Field(Js::Var) * internalFields = this->GetInternalFields();
+    for (uint i = 0; i < internalFieldCount; i++)
+    {
+        internalFields[i] = nullptr;
+    }
 }
 
 /* static */
-JsrtExternalObject* JsrtExternalObject::Create(void *data, JsFinalizeCallback finalizeCallback, Js::RecyclableObject * prototype, Js::ScriptContext *scriptContext)
+JsrtExternalObject* JsrtExternalObject::Create(void *data, JsFinalizeCallback finalizeCallback, Js::RecyclableObject * prototype, Js::ScriptContext *scriptContext, uint internalFieldCount)
 {
     Js::DynamicType * dynamicType = scriptContext->GetLibrary()->GetCachedJsrtExternalType(reinterpret_cast<uintptr_t>(finalizeCallback));
 
@@ -41,7 +47,16 @@ JsrtExternalObject* JsrtExternalObject::Create(void *data, JsFinalizeCallback fi
     Assert(dynamicType->IsJsrtExternal());
     Assert(dynamicType->GetIsShared());
 
-    JsrtExternalObject * externalObject = RecyclerNewFinalized(scriptContext->GetRecycler(), JsrtExternalObject, static_cast<JsrtExternalType*>(dynamicType), data);
+    JsrtExternalObject * externalObject;
+    if (internalFieldCount == 0)
+    {
+        externalObject = RecyclerNewFinalized(scriptContext->GetRecycler(), JsrtExternalObject, static_cast<JsrtExternalType*>(dynamicType), data, 0);
+    }
+    else
+    {
+        size_t internalFieldsSize = UInt32Math::Mul<sizeof(Js::Var)>(internalFieldCount);
+        externalObject = RecyclerNewFinalizedPlus(scriptContext->GetRecycler(), internalFieldsSize, JsrtExternalObject, static_cast<JsrtExternalType*>(dynamicType), data, internalFieldCount);
+    }
 
     if (prototype != nullptr)
     {
@@ -76,6 +91,12 @@ JsrtExternalObject * JsrtExternalObject::UnsafeFromVar(Js::Var value)
 
 void JsrtExternalObject::Finalize(bool isShutdown)
 {
+}
+
+void JsrtExternalObject::Dispose(bool isShutdown)
+{
+    // The host callback doesn't need to run before the rest of the sweep, so it is made from
+    // Dispose, outside of the collection pause, where the recycler can also spread it over idle time.
     JsFinalizeCallback finalizeCallback = this->GetExternalType()->GetJsFinalizeCallback();
     if (nullptr != finalizeCallback)
     {
@@ -84,10 +105,6 @@ void JsrtExternalObject::Finalize(bool isShutdown)
     }
 }
 
-void JsrtExternalObject::Dispose(bool isShutdown)
-{
-}
-
 void * JsrtExternalObject::GetSlotData() const
 {
     return this->slot;
@@ -98,6 +115,18 @@ void JsrtExternalObject::SetSlotData(void * data)
     this->slot = data;
 }
 
+Js::Var JsrtExternalObject::GetInternalField(uint index) const
+{
+    Assert(index < this->internalFieldCount);
+    return this->GetInternalFields()[index];
+}
+
+void JsrtExternalObject::SetInternalField(uint index, Js::Var value)
+{
+    Assert(index < this->internalFieldCount);
+    this->GetInternalFields()[index] = value;
+}
+
 Js::DynamicType* JsrtExternalObject::DuplicateType()
 {
     return RecyclerNew(this->GetScriptContext()->GetRecycler(), JsrtExternalType,
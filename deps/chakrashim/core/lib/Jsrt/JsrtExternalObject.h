@@ -45,12 +45,12 @@ class JsrtExternalObject : public Js::DynamicObject
     DEFINE_MARSHAL_OBJECT_TO_SCRIPT_CONTEXT(JsrtExternalObject);
 
 public:
-    JsrtExternalObject(JsrtExternalType * type, void *data);
+    JsrtExternalObject(JsrtExternalType * type, void *data, uint internalFieldCount);
 
     static bool Is(Js::Var value);
     static JsrtExternalObject * FromVar(Js::Var value);
     static JsrtExternalObject * UnsafeFromVar(Js::Var value);
-    static JsrtExternalObject * Create(void *data, JsFinalizeCallback finalizeCallback, Js::RecyclableObject * prototype, Js::ScriptContext *scriptContext);
+    static JsrtExternalObject * Create(void *data, JsFinalizeCallback finalizeCallback, Js::RecyclableObject * prototype, Js::ScriptContext *scriptContext, uint internalFieldCount = 0);
 
     JsrtExternalType * GetExternalType() const { return (JsrtExternalType *)this->GetType(); }
 
@@ -64,8 +64,19 @@ class JsrtExternalObject : public Js::DynamicObject
     void * GetSlotData() const;
     void SetSlotData(void * data);
 
+    uint GetInternalFieldCount() const { return this->internalFieldCount; }
+    Js::Var GetInternalField(uint index) const;
+    void SetInternalField(uint index, Js::Var value);
+
 private:
+    // The internal fields are allocated right after the object
+    Field(Js::Var) * GetInternalFields() const
+    {
+        return reinterpret_cast<Field(Js::Var) *>(const_cast<JsrtExternalObject *>(this) + 1);
+    }
+
     Field(void *) slot;
+    Field(uint) internalFieldCount;
 
 #if ENABLE_TTD
 public:
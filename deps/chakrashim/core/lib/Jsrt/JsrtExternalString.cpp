@@ -0,0 +1,92 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "JsrtExternalString.h"
+
+namespace Js
+{
+    JsrtExternalString::JsrtExternalString(const void *content, charcount_t length, bool isOneByte, JsFinalizeCallback finalizeCallback, void *callbackState, StaticType *type)
+        : JavascriptString(type), content(content), isOneByte(isOneByte), finalizeCallback(finalizeCallback), callbackState(callbackState)
+    {
+        // Use SetLength to ensure length is valid
+        SetLength(length);
+    }
+
+    JsrtExternalString* JsrtExternalString::New(const char *content, charcount_t length, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext *scriptContext)
+    {
+        Recycler* recycler = scriptContext->GetRecycler();
+        return RecyclerNewFinalized(recycler, JsrtExternalString, content, length, true, finalizeCallback, callbackState, scriptContext->GetLibrary()->GetStringTypeStatic());
+    }
+
+    JsrtExternalString* JsrtExternalString::New(const char16 *content, charcount_t length, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext *scriptContext)
+    {
+        Recycler* recycler = scriptContext->GetRecycler();
+        return RecyclerNewFinalized(recycler, JsrtExternalString, content, length, false, finalizeCallback, callbackState, scriptContext->GetLibrary()->GetStringTypeStatic());
+    }
+
+    bool JsrtExternalString::Is(Var var)
+    {
+        return RecyclableObject::Is(var) && VirtualTableInfo<JsrtExternalString>::HasVirtualTable(RecyclableObject::FromVar(var));
+    }
+
+    const char16* JsrtExternalString::GetSz()
+    {
+        if (this->IsFinalized())
+        {
+            return this->UnsafeGetBuffer();
+        }
+
+        // The host's memory isn't necessarily null terminated, so it can't be used as is
+        Recycler* recycler = GetScriptContext()->GetRecycler();
+        char16* buffer = RecyclerNewArrayLeaf(recycler, char16, this->SafeSzSize());
+        this->CopyContent(buffer);
+        buffer[this->GetLength()] = _u('\0');
+
+        this->SetBuffer(buffer);
+        return buffer;
+    }
+
+    void JsrtExternalString::CopyVirtual(
+        _Out_writes_(m_charLength) char16 *const buffer,
+        StringCopyInfoStack &nestedStringTreeCopyInfos,
+        const byte recursionDepth)
+    {
+        Assert(buffer);
+        Assert(!this->IsFinalized());   // CopyVirtual should only be called for unfinalized buffers
+
+        // Copy straight from the host's memory without flattening this string
+        this->CopyContent(buffer);
+    }
+
+    void JsrtExternalString::CopyContent(_Out_writes_(m_charLength) char16 *const buffer) const
+    {
+        const charcount_t length = this->GetLength();
+        if (this->isOneByte)
+        {
+            const unsigned char * oneByteContent = static_cast<const unsigned char *>(this->content);
+            for (charcount_t i = 0; i < length; i++)
+            {
+                buffer[i] = oneByteContent[i];
+            }
+        }
+        else
+        {
+            js_wmemcpy_s(buffer, length, static_cast<const char16 *>(this->content), length);
+        }
+    }
+
+    void JsrtExternalString::Finalize(bool isShutdown)
+    {
+    }
+
+    void JsrtExternalString::Dispose(bool isShutdown)
+    {
+        // See JsrtExternalObject::Dispose
+        if (finalizeCallback != nullptr)
+        {
+            finalizeCallback(callbackState);
+        }
+    }
+}
@@ -0,0 +1,44 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js {
+    // String whose characters live in memory owned by the host. The content isn't copied until
+    // a null terminated buffer is needed; the host is told through the finalize callback when the
+    // string is collected and the memory can be released.
+    class JsrtExternalString : public JavascriptString
+    {
+    protected:
+        DEFINE_VTABLE_CTOR(JsrtExternalString, JavascriptString);
+
+        JsrtExternalString(const void *content, charcount_t length, bool isOneByte, JsFinalizeCallback finalizeCallback, void *callbackState, StaticType *type);
+
+    public:
+        // Latin-1 content
+        static JsrtExternalString* New(const char *content, charcount_t length, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext *scriptContext);
+        // UTF-16 content
+        static JsrtExternalString* New(const char16 *content, charcount_t length, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext *scriptContext);
+
+        static bool Is(Var var);
+
+        const void *GetContent() const { return this->content; }
+        bool IsOneByte() const { return this->isOneByte; }
+        void *GetCallbackState() const { return this->callbackState; }
+
+        virtual const char16* GetSz() override sealed;
+        virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override sealed;
+        virtual void Finalize(bool isShutdown) override;
+        virtual void Dispose(bool isShutdown) override;
+
+    private:
+        void CopyContent(_Out_writes_(m_charLength) char16 *const buffer) const;
+
+        FieldNoBarrier(const void *) content;
+        FieldNoBarrier(bool) isOneByte;
+        FieldNoBarrier(JsFinalizeCallback) finalizeCallback;
+        FieldNoBarrier(void *) callbackState;
+    };
+}
+AUTO_REGISTER_RECYCLER_OBJECT_DUMPER(Js::JsrtExternalString, &Js::RecyclableObject::DumpObjectFunction);
@@ -0,0 +1,508 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "JsrtHeapSnapshot.h"
+
+static JsUtil::CharacterBuffer<char16> NameFromLiteral(const char16 * text)
+{
+    return JsUtil::CharacterBuffer<char16>(text, (charcount_t)wcslen(text));
+}
+
+JsrtHeapSnapshot::JsrtHeapSnapshot(ThreadContext * threadContext, JsHeapSnapshotWriteCallback writeCallback, void * callbackState) :
+    threadContext(threadContext),
+    writeCallback(writeCallback),
+    callbackState(callbackState),
+    aborted(false),
+    libraries(&HeapAllocator::Instance),
+    nodes(&HeapAllocator::Instance),
+    nodeIndices(&HeapAllocator::Instance),
+    edgeCount(0),
+    rootEdgeCount(0),
+    strings(&HeapAllocator::Instance),
+    stringIndices(&HeapAllocator::Instance),
+    buffer(nullptr),
+    bufferUsed(0)
+{
+    this->buffer = HeapNewArray(char, BufferSize);
+
+    for (Js::ScriptContext * scriptContext = threadContext->GetScriptContextList(); scriptContext != nullptr; scriptContext = scriptContext->next)
+    {
+        if (!scriptContext->IsClosed() && scriptContext->GetLibrary() != nullptr)
+        {
+            this->libraries.Add(scriptContext->GetLibrary());
+        }
+    }
+}
+
+JsrtHeapSnapshot::~JsrtHeapSnapshot()
+{
+    HeapDeleteArray(BufferSize, this->buffer);
+}
+
+void
+JsrtHeapSnapshot::Write()
+{
+    Recycler * recycler = this->threadContext->GetRecycler();
+    if (recycler == nullptr)
+    {
+        // Nothing has been allocated yet, the snapshot only has the root
+        WriteSnapshot();
+        return;
+    }
+
+    // Nothing is allocated from the recycler until the walk is done; the tables and the output
+    // buffer live in the heap allocator.
+    Recycler::AutoHeapWalk heapWalk(recycler);
+    heapWalk.ForEachLiveObject(&JsrtHeapSnapshot::AddNode, this);
+    CountEdges();
+    WriteSnapshot();
+}
+
+void
+JsrtHeapSnapshot::AddNode(void * address, size_t size, bool isLeaf, void * context)
+{
+    JsrtHeapSnapshot * snapshot = (JsrtHeapSnapshot *)context;
+
+    NodeEntry node;
+    node.address = (char *)address;
+    node.size = size;
+    node.edgeCount = 0;
+    node.isLeaf = isLeaf;
+    node.flags = NodeFlagsNone;
+
+    uint32 index = (uint32)snapshot->nodes.Add(node) + 1;
+    snapshot->nodeIndices.Add(address, index);
+}
+
+uint32
+JsrtHeapSnapshot::FindNode(void * address) const
+{
+    uint32 index = RootNodeIndex;
+    this->nodeIndices.TryGetValue(address, &index);
+    return index;
+}
+
+bool
+JsrtHeapSnapshot::IsRootEdgeTarget(const NodeEntry& node) const
+{
+    return (node.flags & NodeFlagsRoot) != 0 || (node.flags & NodeFlagsRetained) == 0;
+}
+
+template <class Fn>
+void
+JsrtHeapSnapshot::ForEachReference(const NodeEntry& node, Fn fn) const
+{
+    if (node.isLeaf)
+    {
+        return;
+    }
+
+    void ** slots = (void **)node.address;
+    size_t slotCount = node.size / sizeof(void *);
+    for (size_t i = 0; i < slotCount; i++)
+    {
+        // Recycler objects always start on the object granularity, skip anything else without a lookup
+        void * candidate = slots[i];
+        if (candidate == nullptr || ((size_t)candidate & (HeapConstants::ObjectGranularity - 1)) != 0)
+        {
+            continue;
+        }
+
+        uint32 targetIndex = FindNode(candidate);
+        if (targetIndex != RootNodeIndex)
+        {
+            fn((uint32)i, targetIndex);
+        }
+    }
+}
+
+void
+JsrtHeapSnapshot::CountEdges()
+{
+    for (int i = 0; i < this->nodes.Count(); i++)
+    {
+        NodeEntry& node = this->nodes.Item(i);
+        uint32 nodeIndex = (uint32)i + 1;
+        ForEachReference(node, [&](uint32 slot, uint32 targetIndex)
+        {
+            node.edgeCount++;
+            if (targetIndex != nodeIndex)
+            {
+                this->nodes.Item(targetIndex - 1).flags |= NodeFlagsRetained;
+            }
+        });
+        this->edgeCount += node.edgeCount;
+    }
+
+    this->libraries.Map([&](int, Js::JavascriptLibrary * library)
+    {
+        uint32 globalIndex = FindNode(library->GetGlobalObject());
+        if (globalIndex != RootNodeIndex)
+        {
+            this->nodes.Item(globalIndex - 1).flags |= NodeFlagsRoot;
+        }
+    });
+
+    for (int i = 0; i < this->nodes.Count(); i++)
+    {
+        if (IsRootEdgeTarget(this->nodes.Item(i)))
+        {
+            this->rootEdgeCount++;
+        }
+    }
+    this->edgeCount += this->rootEdgeCount;
+}
+
+Js::Type *
+JsrtHeapSnapshot::GetJavascriptType(const NodeEntry& node) const
+{
+    // Only an object that starts with a pointer to a live type of one of the libraries of the
+    // runtime is treated as a script object. Anything else is internal engine memory.
+    if (node.isLeaf || node.size < sizeof(Js::RecyclableObject))
+    {
+        return nullptr;
+    }
+
+    Js::Type * type = *(Js::Type **)(node.address + Js::RecyclableObject::GetOffsetOfType());
+    uint32 typeIndex = FindNode(type);
+    if (typeIndex == RootNodeIndex || this->nodes.Item(typeIndex - 1).size < sizeof(Js::Type))
+    {
+        return nullptr;
+    }
+
+    if ((uint)type->GetTypeId() >= (uint)Js::TypeIds_Limit || !this->libraries.Contains(type->GetLibrary()))
+    {
+        return nullptr;
+    }
+
+    return type;
+}
+
+JsrtHeapSnapshot::NodeType
+JsrtHeapSnapshot::DescribeNode(const NodeEntry& node, StringEntry * name) const
+{
+    Js::Type * type = GetJavascriptType(node);
+    if (type == nullptr)
+    {
+        *name = NameFromLiteral(_u("(internal)"));
+        return NodeType_Hidden;
+    }
+
+    switch (type->GetTypeId())
+    {
+    case Js::TypeIds_String:
+    {
+        Js::JavascriptString * string = (Js::JavascriptString *)node.address;
+        if (!string->IsFinalized())
+        {
+            *name = NameFromLiteral(_u("(concatenated string)"));
+            return NodeType_ConcatenatedString;
+        }
+        *name = StringEntry(string->UnsafeGetBuffer(), min(string->GetLength(), MaxNameLength));
+        return NodeType_String;
+    }
+
+    case Js::TypeIds_Symbol:
+        *name = NameFromLiteral(_u("symbol"));
+        return NodeType_Symbol;
+
+    case Js::TypeIds_Number:
+    case Js::TypeIds_Int64Number:
+    case Js::TypeIds_UInt64Number:
+        *name = NameFromLiteral(_u("heap number"));
+        return NodeType_Number;
+
+    case Js::TypeIds_Function:
+    {
+        Js::JavascriptFunction * function = (Js::JavascriptFunction *)node.address;
+        Js::FunctionProxy * proxy = function->GetFunctionInfo() != nullptr ? function->GetFunctionProxy() : nullptr;
+        const char16 * displayName = proxy != nullptr ? proxy->GetDisplayName() : nullptr;
+        if (displayName == nullptr)
+        {
+            *name = NameFromLiteral(_u("(native function)"));
+        }
+        else
+        {
+            *name = StringEntry(displayName, min((charcount_t)proxy->GetDisplayNameLength(), MaxNameLength));
+        }
+        return NodeType_Closure;
+    }
+
+    case Js::TypeIds_RegEx:
+        *name = NameFromLiteral(_u("RegExp"));
+        return NodeType_RegExp;
+
+    case Js::TypeIds_Array:
+    case Js::TypeIds_NativeIntArray:
+#if ENABLE_COPYONACCESS_ARRAY
+    case Js::TypeIds_CopyOnAccessNativeIntArray:
+#endif
+    case Js::TypeIds_NativeFloatArray:
+    case Js::TypeIds_ES5Array:
+        *name = NameFromLiteral(_u("Array"));
+        return NodeType_Object;
+
+    case Js::TypeIds_Proxy:             *name = NameFromLiteral(_u("Proxy")); return NodeType_Object;
+    case Js::TypeIds_Date:              *name = NameFromLiteral(_u("Date")); return NodeType_Object;
+    case Js::TypeIds_Error:             *name = NameFromLiteral(_u("Error")); return NodeType_Object;
+    case Js::TypeIds_BooleanObject:     *name = NameFromLiteral(_u("Boolean")); return NodeType_Object;
+    case Js::TypeIds_NumberObject:      *name = NameFromLiteral(_u("Number")); return NodeType_Object;
+    case Js::TypeIds_StringObject:      *name = NameFromLiteral(_u("String")); return NodeType_Object;
+    case Js::TypeIds_SymbolObject:      *name = NameFromLiteral(_u("Symbol")); return NodeType_Object;
+    case Js::TypeIds_Arguments:         *name = NameFromLiteral(_u("Arguments")); return NodeType_Object;
+    case Js::TypeIds_ArrayBuffer:       *name = NameFromLiteral(_u("ArrayBuffer")); return NodeType_Object;
+    case Js::TypeIds_SharedArrayBuffer: *name = NameFromLiteral(_u("SharedArrayBuffer")); return NodeType_Object;
+    case Js::TypeIds_DataView:          *name = NameFromLiteral(_u("DataView")); return NodeType_Object;
+    case Js::TypeIds_Map:               *name = NameFromLiteral(_u("Map")); return NodeType_Object;
+    case Js::TypeIds_Set:               *name = NameFromLiteral(_u("Set")); return NodeType_Object;
+    case Js::TypeIds_WeakMap:           *name = NameFromLiteral(_u("WeakMap")); return NodeType_Object;
+    case Js::TypeIds_WeakSet:           *name = NameFromLiteral(_u("WeakSet")); return NodeType_Object;
+    case Js::TypeIds_Generator:         *name = NameFromLiteral(_u("Generator")); return NodeType_Object;
+    case Js::TypeIds_Promise:           *name = NameFromLiteral(_u("Promise")); return NodeType_Object;
+    case Js::TypeIds_GlobalObject:      *name = NameFromLiteral(_u("global")); return NodeType_Object;
+    case Js::TypeIds_ActivationObject:  *name = NameFromLiteral(_u("(scope)")); return NodeType_Hidden;
+    default:
+        break;
+    }
+
+    if (type->GetTypeId() >= Js::TypeIds_TypedArrayMin && type->GetTypeId() <= Js::TypeIds_TypedArrayMax)
+    {
+        *name = NameFromLiteral(_u("TypedArray"));
+        return NodeType_Object;
+    }
+
+    if (Js::StaticType::Is(type->GetTypeId()))
+    {
+        *name = NameFromLiteral(_u("(system)"));
+        return NodeType_Hidden;
+    }
+
+    *name = NameFromLiteral(_u("Object"));
+    return NodeType_Object;
+}
+
+JsrtHeapSnapshot::EdgeType
+JsrtHeapSnapshot::DescribeEdge(Js::Type * type, uint32 slot, StringEntry * name) const
+{
+    if (type != nullptr)
+    {
+        size_t offset = slot * sizeof(void *);
+        if (offset == Js::RecyclableObject::GetOffsetOfType())
+        {
+            *name = NameFromLiteral(_u("type"));
+            return EdgeType_Internal;
+        }
+        if (!Js::StaticType::Is(type->GetTypeId()))
+        {
+            if (offset == Js::DynamicObject::GetOffsetOfAuxSlots())
+            {
+                *name = NameFromLiteral(_u("properties"));
+                return EdgeType_Internal;
+            }
+            if (offset == Js::DynamicObject::GetOffsetOfObjectArray())
+            {
+                *name = NameFromLiteral(_u("elements"));
+                return EdgeType_Internal;
+            }
+        }
+    }
+    return EdgeType_Element;
+}
+
+void
+JsrtHeapSnapshot::WriteSnapshot()
+{
+    WriteAscii("{\"snapshot\":{\"meta\":{"
+        "\"node_fields\":[\"type\",\"name\",\"id\",\"self_size\",\"edge_count\",\"trace_node_id\"],"
+        "\"node_types\":[[\"hidden\",\"array\",\"string\",\"object\",\"code\",\"closure\",\"regexp\",\"number\",\"native\",\"synthetic\",\"concatenated string\",\"sliced string\",\"symbol\"],"
+        "\"string\",\"number\",\"number\",\"number\",\"number\",\"number\"],"
+        "\"edge_fields\":[\"type\",\"name_or_index\",\"to_node\"],"
+        "\"edge_types\":[[\"context\",\"element\",\"property\",\"internal\",\"hidden\",\"shortcut\",\"weak\"],\"string_or_number\",\"node\"],"
+        "\"trace_function_info_fields\":[\"function_id\",\"name\",\"script_name\",\"script_id\",\"line\",\"column\"],"
+        "\"trace_node_fields\":[\"id\",\"function_info_index\",\"count\",\"size\",\"children\"],"
+        "\"sample_fields\":[\"timestamp_us\",\"last_assigned_id\"],"
+        "\"location_fields\":[\"object_index\",\"script_id\",\"line\",\"column\"]},"
+        "\"node_count\":");
+    WriteNumber((uint64)this->nodes.Count() + 1);
+    WriteAscii(",\"edge_count\":");
+    WriteNumber(this->edgeCount);
+    WriteAscii(",\"trace_function_count\":0},\n\"nodes\":[");
+    WriteNodes();
+    WriteAscii("],\n\"edges\":[");
+    WriteEdges();
+    WriteAscii("],\n\"trace_function_infos\":[],\n\"trace_tree\":[],\n\"samples\":[],\n\"locations\":[],\n\"strings\":[");
+    WriteStrings();
+    WriteAscii("]}\n");
+    Flush();
+}
+
+void
+JsrtHeapSnapshot::WriteNodes()
+{
+    auto writeNode = [&](NodeType type, const StringEntry& name, uint32 index, size_t size, uint32 nodeEdgeCount)
+    {
+        WriteNumber(type);
+        WriteAscii(",");
+        WriteNumber(GetStringIndex(name));
+        WriteAscii(",");
+        // Odd ids, like the ids V8 gives to heap objects
+        WriteNumber((uint64)index * 2 + 1);
+        WriteAscii(",");
+        WriteNumber(size);
+        WriteAscii(",");
+        WriteNumber(nodeEdgeCount);
+        WriteAscii(",0");
+    };
+
+    writeNode(NodeType_Synthetic, NameFromLiteral(_u("(GC roots)")), RootNodeIndex, 0, this->rootEdgeCount);
+
+    for (int i = 0; i < this->nodes.Count() && !this->aborted; i++)
+    {
+        const NodeEntry& node = this->nodes.Item(i);
+        StringEntry name;
+        NodeType type = DescribeNode(node, &name);
+        WriteAscii("\n,");
+        writeNode(type, name, (uint32)i + 1, node.size, node.edgeCount);
+    }
+}
+
+void
+JsrtHeapSnapshot::WriteEdges()
+{
+    bool first = true;
+    auto writeEdge = [&](EdgeType type, uint64 nameOrIndex, uint32 targetIndex)
+    {
+        WriteAscii(first ? "" : "\n,");
+        first = false;
+        WriteNumber(type);
+        WriteAscii(",");
+        WriteNumber(nameOrIndex);
+        WriteAscii(",");
+        WriteNumber((uint64)targetIndex * NodeFieldCount);
+    };
+
+    uint32 rootEdgeIndex = 0;
+    for (int i = 0; i < this->nodes.Count() && !this->aborted; i++)
+    {
+        if (IsRootEdgeTarget(this->nodes.Item(i)))
+        {
+            writeEdge(EdgeType_Element, ++rootEdgeIndex, (uint32)i + 1);
+        }
+    }
+    Assert(this->aborted || rootEdgeIndex == this->rootEdgeCount);
+
+    for (int i = 0; i < this->nodes.Count() && !this->aborted; i++)
+    {
+        const NodeEntry& node = this->nodes.Item(i);
+        Js::Type * type = GetJavascriptType(node);
+        ForEachReference(node, [&](uint32 slot, uint32 targetIndex)
+        {
+            StringEntry name;
+            EdgeType edgeType = DescribeEdge(type, slot, &name);
+            writeEdge(edgeType, edgeType == EdgeType_Element ? slot : GetStringIndex(name), targetIndex);
+        });
+    }
+}
+
+void
+JsrtHeapSnapshot::WriteStrings()
+{
+    for (int i = 0; i < this->strings.Count() && !this->aborted; i++)
+    {
+        WriteAscii(i == 0 ? "" : "\n,");
+        WriteJsonString(this->strings.Item(i));
+    }
+}
+
+uint32
+JsrtHeapSnapshot::GetStringIndex(const StringEntry& string)
+{
+    uint32 index;
+    if (!this->stringIndices.TryGetValue(string, &index))
+    {
+        index = (uint32)this->strings.Add(string);
+        this->stringIndices.Add(string, index);
+    }
+    return index;
+}
+
+void
+JsrtHeapSnapshot::WriteAscii(const char * text)
+{
+    Append(text, strlen(text));
+}
+
+void
+JsrtHeapSnapshot::WriteNumber(uint64 value)
+{
+    char digits[20];
+    size_t count = 0;
+    do
+    {
+        digits[sizeof(digits) - ++count] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    Append(digits + sizeof(digits) - count, count);
+}
+
+void
+JsrtHeapSnapshot::WriteJsonString(const StringEntry& string)
+{
+    // The output is kept to ASCII, everything else is escaped
+    static const char hexDigits[] = "0123456789abcdef";
+
+    Append("\"", 1);
+    const char16 * chars = string.GetBuffer();
+    for (charcount_t i = 0; i < string.GetLength(); i++)
+    {
+        char16 c = chars[i];
+        if (c == _u('"') || c == _u('\\'))
+        {
+            char escaped[2] = { '\\', (char)c };
+            Append(escaped, 2);
+        }
+        else if (c >= 0x20 && c < 0x7F)
+        {
+            char ascii = (char)c;
+            Append(&ascii, 1);
+        }
+        else
+        {
+            char escaped[6] = { '\\', 'u', hexDigits[(c >> 12) & 0xF], hexDigits[(c >> 8) & 0xF], hexDigits[(c >> 4) & 0xF], hexDigits[c & 0xF] };
+            Append(escaped, 6);
+        }
+    }
+    Append("\"", 1);
+}
+
+void
+JsrtHeapSnapshot::Append(const char * data, size_t length)
+{
+    while (length != 0 && !this->aborted)
+    {
+        if (this->bufferUsed == BufferSize)
+        {
+            Flush();
+            continue;
+        }
+
+        size_t count = min(length, BufferSize - this->bufferUsed);
+        js_memcpy_s(this->buffer + this->bufferUsed, BufferSize - this->bufferUsed, data, count);
+        this->bufferUsed += count;
+        data += count;
+        length -= count;
+    }
+}
+
+void
+JsrtHeapSnapshot::Flush()
+{
+    if (this->bufferUsed != 0 && !this->aborted)
+    {
+        // The host stops the snapshot by returning false
+        this->aborted = !this->writeCallback(this->buffer, this->bufferUsed, this->callbackState);
+    }
+    this->bufferUsed = 0;
+}
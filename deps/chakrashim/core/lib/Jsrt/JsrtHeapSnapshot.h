@@ -0,0 +1,119 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Writes the live object graph of a runtime in the JSON heap snapshot format of the V8 heap
+// profiler, so that the existing tools can load it.
+//
+// The graph comes from a non-collecting mark of the recycler. The references of an object are
+// found by scanning it conservatively for pointers to other live objects, the same way the
+// recycler marks it. Objects that nothing in the heap refers to were found through the stack or
+// another root and hang off the synthetic root node, next to the global objects.
+//
+// The JSON is handed to the write callback in chunks as it is produced; only the node table is
+// kept for the whole walk.
+class JsrtHeapSnapshot
+{
+public:
+    JsrtHeapSnapshot(ThreadContext * threadContext, JsHeapSnapshotWriteCallback writeCallback, void * callbackState);
+    ~JsrtHeapSnapshot();
+
+    void Write();
+
+private:
+    // The node and edge types, as indices into the type lists of the snapshot meta data
+    enum NodeType : byte
+    {
+        NodeType_Hidden = 0,
+        NodeType_Array = 1,
+        NodeType_String = 2,
+        NodeType_Object = 3,
+        NodeType_Code = 4,
+        NodeType_Closure = 5,
+        NodeType_RegExp = 6,
+        NodeType_Number = 7,
+        NodeType_Native = 8,
+        NodeType_Synthetic = 9,
+        NodeType_ConcatenatedString = 10,
+        NodeType_SlicedString = 11,
+        NodeType_Symbol = 12,
+    };
+
+    enum EdgeType : byte
+    {
+        EdgeType_Context = 0,
+        EdgeType_Element = 1,
+        EdgeType_Property = 2,
+        EdgeType_Internal = 3,
+        EdgeType_Hidden = 4,
+        EdgeType_Shortcut = 5,
+        EdgeType_Weak = 6,
+    };
+
+    enum NodeFlags : byte
+    {
+        NodeFlagsNone = 0x0,
+        NodeFlagsRetained = 0x1,    // Another object refers to the node
+        NodeFlagsRoot = 0x2,        // The node is a global object
+    };
+
+    struct NodeEntry
+    {
+        char * address;
+        size_t size;
+        uint32 edgeCount;
+        bool isLeaf;
+        byte flags;
+    };
+
+    typedef JsUtil::CharacterBuffer<char16> StringEntry;
+
+    // Node 0 is the synthetic root, the objects are numbered from 1 in heap walk order
+    static const uint32 RootNodeIndex = 0;
+    static const uint32 NodeFieldCount = 6;
+    static const charcount_t MaxNameLength = 1024;
+    static const size_t BufferSize = 64 * 1024;
+
+    static void AddNode(void * address, size_t size, bool isLeaf, void * context);
+    uint32 FindNode(void * address) const;
+    bool IsRootEdgeTarget(const NodeEntry& node) const;
+    void CountEdges();
+
+    template <class Fn>
+    void ForEachReference(const NodeEntry& node, Fn fn) const;
+
+    Js::Type * GetJavascriptType(const NodeEntry& node) const;
+    NodeType DescribeNode(const NodeEntry& node, StringEntry * name) const;
+    EdgeType DescribeEdge(Js::Type * type, uint32 slot, StringEntry * name) const;
+
+    void WriteSnapshot();
+    void WriteNodes();
+    void WriteEdges();
+    void WriteStrings();
+
+    uint32 GetStringIndex(const StringEntry& string);
+    void WriteAscii(const char * text);
+    void WriteNumber(uint64 value);
+    void WriteJsonString(const StringEntry& string);
+    void Append(const char * data, size_t length);
+    void Flush();
+
+    ThreadContext * threadContext;
+    JsHeapSnapshotWriteCallback writeCallback;
+    void * callbackState;
+    bool aborted;
+
+    JsUtil::List<Js::JavascriptLibrary *, HeapAllocator> libraries;
+    JsUtil::List<NodeEntry, HeapAllocator> nodes;
+    JsUtil::BaseDictionary<void *, uint32, HeapAllocator> nodeIndices;
+    uint64 edgeCount;
+    uint32 rootEdgeCount;
+
+    JsUtil::List<StringEntry, HeapAllocator> strings;
+    JsUtil::BaseDictionary<StringEntry, uint32, HeapAllocator> stringIndices;
+
+    char * buffer;
+    size_t bufferUsed;
+};
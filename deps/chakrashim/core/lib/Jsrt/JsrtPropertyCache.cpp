@@ -0,0 +1,102 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "JsrtPropertyCache.h"
+#include "Language/CacheOperators.h"
+#include "Types/TypePropertyCache.h"
+#include "Language/CacheOperators.inl"
+
+namespace Js
+{
+    JsrtPropertyCache::JsrtPropertyCache(const PropertyRecord *propertyRecord)
+        : propertyRecord(propertyRecord), inlineCaches(nullptr)
+    {
+    }
+
+    JsrtPropertyCache *JsrtPropertyCache::New(const PropertyRecord *propertyRecord, ScriptContext *scriptContext)
+    {
+        return RecyclerNew(scriptContext->GetRecycler(), JsrtPropertyCache, propertyRecord);
+    }
+
+    bool JsrtPropertyCache::ShouldUseCache() const
+    {
+        // Indexed properties aren't kept in type handlers, so there is nothing to cache for them.
+        return !PHASE_OFF1(JsrtPropertyCachePhase) && !this->propertyRecord->IsNumeric();
+    }
+
+    JsrtPropertyInlineCaches *JsrtPropertyCache::EnsureInlineCaches(ScriptContext *scriptContext)
+    {
+        // Caches of another script context hold types that objects of this context never have, so this
+        // context's own are used instead. Those of a context that has been collected are gone.
+        JsrtPropertyInlineCaches *caches = this->inlineCaches != nullptr ? this->inlineCaches->Get() : nullptr;
+        if (caches == nullptr || caches->getInlineCache->GetScriptContext() != scriptContext)
+        {
+            JsrtContext *context = (JsrtContext *)scriptContext->GetLibrary()->GetJsrtContext();
+            caches = context->EnsurePropertyInlineCaches(this->propertyRecord);
+            this->inlineCaches = scriptContext->GetRecycler()->CreateWeakReferenceHandle(caches);
+        }
+        return caches;
+    }
+
+    Var JsrtPropertyCache::GetProperty(RecyclableObject *instance, ScriptContext *scriptContext)
+    {
+        PropertyId propertyId = this->propertyRecord->GetPropertyId();
+        if (!ShouldUseCache())
+        {
+            return JavascriptOperators::GetPropertyNoCache(instance, propertyId, scriptContext);
+        }
+
+        Var value;
+        PropertyValueInfo info;
+        PropertyValueInfo::SetCacheInfo(&info, EnsureInlineCaches(scriptContext)->getInlineCache, false);
+        if (CacheOperators::TryGetProperty<
+                true,                                       // CheckLocal
+                true,                                       // CheckProto
+                true,                                       // CheckAccessor
+                false,                                      // CheckMissing
+                true,                                       // CheckPolymorphicInlineCache
+                true,                                       // CheckTypePropertyCache
+                false,                                      // IsInlineCacheAvailable
+                true,                                       // IsPolymorphicInlineCacheAvailable
+                false,                                      // ReturnOperationInfo
+                false>                                      // OutputExistence
+                (instance, false, instance, propertyId, &value, scriptContext, nullptr, &info))
+        {
+            return value;
+        }
+
+        // The full lookup fills the cache for the next object of this type.
+        JavascriptOperators::GetProperty(instance, propertyId, &value, scriptContext, &info);
+        return value;
+    }
+
+    void JsrtPropertyCache::SetProperty(RecyclableObject *instance, Var value, PropertyOperationFlags flags, ScriptContext *scriptContext)
+    {
+        PropertyId propertyId = this->propertyRecord->GetPropertyId();
+        if (!ShouldUseCache() || this->propertyRecord->ShouldDisableWriteCache())
+        {
+            JavascriptOperators::OP_SetProperty(instance, propertyId, value, scriptContext, nullptr, flags);
+            return;
+        }
+
+        PropertyValueInfo info;
+        PropertyValueInfo::SetCacheInfo(&info, EnsureInlineCaches(scriptContext)->setInlineCache, false);
+        if (CacheOperators::TrySetProperty<
+                true,                                       // CheckLocal
+                true,                                       // CheckLocalTypeWithoutProperty
+                true,                                       // CheckAccessor
+                true,                                       // CheckPolymorphicInlineCache
+                true,                                       // CheckTypePropertyCache
+                false,                                      // IsInlineCacheAvailable
+                true,                                       // IsPolymorphicInlineCacheAvailable
+                false>                                      // ReturnOperationInfo
+                (instance, false, propertyId, value, scriptContext, flags, nullptr, &info))
+        {
+            return;
+        }
+
+        JavascriptOperators::OP_SetProperty(instance, propertyId, value, scriptContext, &info, flags);
+    }
+}
@@ -0,0 +1,41 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // The inline caches for loads and stores of one property in one script context. They are owned by the
+    // context's JsrtContext, see JsrtContext::EnsurePropertyInlineCaches.
+    struct JsrtPropertyInlineCaches
+    {
+        Field(PolymorphicInlineCache *) getInlineCache;
+        Field(PolymorphicInlineCache *) setInlineCache;
+    };
+
+    // The object behind a JsPropertyCacheRef. It pairs a property record with inline caches for loads and
+    // stores of that property, so a host that keeps one per call site finds the property on an object of a
+    // type it has seen before without walking the type and prototype chain. The inline caches are those of
+    // the script context that last used the cache. They are only held weakly, since they reference their
+    // context's library, and are looked up again when the cache is used from another context.
+    class JsrtPropertyCache sealed
+    {
+    private:
+        Field(const PropertyRecord *) propertyRecord;
+        Field(RecyclerWeakReference<JsrtPropertyInlineCaches> *) inlineCaches;
+
+        JsrtPropertyCache(const PropertyRecord *propertyRecord);
+
+        JsrtPropertyInlineCaches *EnsureInlineCaches(ScriptContext *scriptContext);
+        bool ShouldUseCache() const;
+
+    public:
+        static JsrtPropertyCache *New(const PropertyRecord *propertyRecord, ScriptContext *scriptContext);
+
+        const PropertyRecord *GetPropertyRecord() const { return this->propertyRecord; }
+
+        Var GetProperty(RecyclableObject *instance, ScriptContext *scriptContext);
+        void SetProperty(RecyclableObject *instance, Var value, PropertyOperationFlags flags, ScriptContext *scriptContext);
+    };
+}
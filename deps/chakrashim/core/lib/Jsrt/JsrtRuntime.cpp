@@ -7,6 +7,7 @@
 #include "jsrtHelper.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Base/ThreadBoundThreadContextManager.h"
+#include "Language/JavascriptStackWalker.h"
 JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispatchExceptions)
 {
     Assert(threadContext != NULL);
@@ -15,6 +16,19 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
     this->collectCallback = NULL;
     this->beforeCollectCallback = NULL;
     this->callbackContext = NULL;
+#ifdef _CHAKRACOREBUILD
+    this->collectEventRegistration = NULL;
+    this->collectEventCallback = NULL;
+    this->collectEventCallbackContext = NULL;
+    this->currentCollectKind = JsCollectKindFull;
+    this->sampleCallback = NULL;
+    this->sampleCallbackContext = NULL;
+    this->externalRootsCallback = NULL;
+    this->externalRootsCallbackContext = NULL;
+    this->allocationSampleCallback = NULL;
+    this->allocationSampleFreeCallback = NULL;
+    this->allocationSampleCallbackContext = NULL;
+#endif
     this->allocationPolicyManager = threadContext->GetAllocationPolicyManager();
     this->useIdle = useIdle;
     this->dispatchExceptions = dispatchExceptions;
@@ -125,6 +139,241 @@ void JsrtRuntime::RecyclerCollectCallbackStatic(void * context, RecyclerCollectC
     }
 }
 
+#ifdef _CHAKRACOREBUILD
+void JsrtRuntime::SetCollectEventCallback(JsCollectEventCallback collectEventCallback, void * callbackContext)
+{
+    if (collectEventCallback != NULL)
+    {
+        if (this->collectEventRegistration == NULL)
+        {
+            this->collectEventRegistration = this->threadContext->AddRecyclerCollectCallBack(RecyclerCollectEventCallbackStatic, this);
+        }
+
+        this->collectEventCallback = collectEventCallback;
+        this->collectEventCallbackContext = callbackContext;
+    }
+    else
+    {
+        if (this->collectEventRegistration != NULL)
+        {
+            this->threadContext->RemoveRecyclerCollectCallBack(this->collectEventRegistration);
+            this->collectEventRegistration = NULL;
+        }
+
+        this->collectEventCallback = NULL;
+        this->collectEventCallbackContext = NULL;
+    }
+}
+
+void JsrtRuntime::RecyclerCollectEventCallbackStatic(void * context, RecyclerCollectCallBackFlags flags)
+{
+    JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(context);
+    JsCollectEventType eventType;
+
+    if (flags & Collect_Begin)
+    {
+        // Collect_Begin_Concurrent and Collect_Begin_Partial both carry the Collect_Begin bit;
+        // the remaining bits tell the kinds apart. Remember the kind so that the end event,
+        // which carries no kind of its own, can report the same one.
+        int kind = JsCollectKindFull;
+        if ((flags & Collect_Begin_Concurrent) == Collect_Begin_Concurrent)
+        {
+            kind |= JsCollectKindConcurrent;
+        }
+        if ((flags & Collect_Begin_Partial) == Collect_Begin_Partial)
+        {
+            kind |= JsCollectKindPartial;
+        }
+        _this->currentCollectKind = (JsCollectKind)kind;
+        eventType = JsCollectEventBegin;
+    }
+    else if (flags & Collect_End)
+    {
+        eventType = JsCollectEventEnd;
+    }
+    else
+    {
+        // Collect_Wait can be raised from a background thread; it is not reported to the host.
+        return;
+    }
+
+    try
+    {
+        JsrtCallbackState scope(reinterpret_cast<ThreadContext*>(_this->GetThreadContext()));
+        _this->collectEventCallback(eventType, _this->currentCollectKind, _this->collectEventCallbackContext);
+    }
+    catch (...)
+    {
+        AssertMsg(false, "Unexpected non-engine exception.");
+    }
+}
+
+void JsrtRuntime::SetSampleCallback(JsSampleCallback sampleCallback, void * callbackContext)
+{
+    this->sampleCallback = sampleCallback;
+    this->sampleCallbackContext = callbackContext;
+    this->threadContext->SetScriptSampleCallBack(sampleCallback != NULL ? ScriptSampleCallbackStatic : NULL, this);
+}
+
+void JsrtRuntime::ScriptSampleCallbackStatic(void * context)
+{
+    JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(context);
+    uint frameCount = _this->CollectSampleFrames(_this->threadContext->GetScriptEntryExit()->scriptContext);
+
+    try
+    {
+        JsrtCallbackState scope(reinterpret_cast<ThreadContext*>(_this->GetThreadContext()));
+        _this->sampleCallback(_this->sampleFrames, frameCount, _this->sampleCallbackContext);
+    }
+    catch (...)
+    {
+        AssertMsg(false, "Unexpected non-engine exception.");
+    }
+}
+
+uint JsrtRuntime::CollectSampleFrames(Js::ScriptContext * scriptContext)
+{
+    static const uint16_t emptyString[] = { 0 };
+
+    // The sample is taken in the middle of running script, so the walk must neither allocate
+    // nor throw: line numbers are only resolved when the source already has a line cache.
+    uint frameCount = 0;
+    Js::JavascriptStackWalker walker(scriptContext);
+    walker.WalkUntil(MaxSampleFrameCount, [&](Js::JavascriptFunction* function, ushort frameIndex) -> bool
+    {
+        if (!function->IsScriptFunction() || function->IsLibraryCode())
+        {
+            return false;
+        }
+
+        Js::FunctionBody * functionBody = function->GetFunctionBody();
+        Js::Utf8SourceInfo * sourceInfo = functionBody->GetUtf8SourceInfo();
+        JsSampleFrame * frame = &this->sampleFrames[frameCount++];
+
+        LPCWSTR url = functionBody->GetSourceName();
+        frame->scriptId = sourceInfo->GetSourceInfoId();
+        frame->functionId = functionBody->GetLocalFunctionId();
+        frame->functionName = reinterpret_cast<const uint16_t *>(functionBody->GetExternalDisplayName());
+        frame->url = url != nullptr ? reinterpret_cast<const uint16_t *>(url) : emptyString;
+        frame->functionLine = functionBody->GetLineNumber();
+        frame->functionColumn = functionBody->GetColumnNumber();
+        frame->line = frame->functionLine;
+        frame->column = frame->functionColumn;
+
+        ULONG line;
+        LONG column;
+        if (sourceInfo->HasLineOffsetCache() &&
+            functionBody->GetLineCharOffset(walker.GetByteCodeOffset(), &line, &column, false /*canAllocateLineCache*/))
+        {
+            frame->line = line;
+            frame->column = column;
+        }
+
+        frame->kind = JsSampleFrameInterpreted;
+#if ENABLE_NATIVE_CODEGEN
+        if (walker.IsInlineFrame() || walker.IsCurrentPhysicalFrameForLoopBody())
+        {
+            // Only the full JIT inlines and jits loop bodies
+            frame->kind = JsSampleFrameFullJit;
+        }
+        else if (walker.GetCurrentInterpreterFrame() == nullptr)
+        {
+            Js::FunctionEntryPointInfo * entryPoint = functionBody->GetEntryPointFromNativeAddress((DWORD_PTR)walker.GetCurrentCodeAddr());
+            frame->kind = (entryPoint != nullptr && entryPoint->GetJitMode() == ExecutionMode::SimpleJit) ?
+                JsSampleFrameSimpleJit : JsSampleFrameFullJit;
+        }
+#endif
+        return false;
+    });
+
+    return frameCount;
+}
+
+void JsrtRuntime::SetAllocationSampling(size_t sampleInterval, JsAllocationSampleCallback sampleCallback,
+    JsAllocationSampleFreeCallback freeCallback, void * callbackContext)
+{
+    if (sampleCallback == NULL)
+    {
+        sampleInterval = 0;
+        freeCallback = NULL;
+        callbackContext = NULL;
+    }
+
+    this->allocationSampleCallback = sampleCallback;
+    this->allocationSampleFreeCallback = freeCallback;
+    this->allocationSampleCallbackContext = callbackContext;
+    this->threadContext->GetRecycler()->SetAllocationSampling(sampleInterval,
+        sampleCallback != NULL ? AllocationSampleCallbackStatic : NULL,
+        freeCallback != NULL ? AllocationSampleFreeCallbackStatic : NULL, this);
+}
+
+void JsrtRuntime::AllocationSampleCallbackStatic(void * context, uint sampleId, size_t size)
+{
+    JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(context);
+
+    // Allocations made outside of any script call, like during library initialization, are
+    // reported without a stack; those of host calls made by script get the script frames
+    ThreadContext * threadContext = _this->threadContext;
+    uint frameCount = 0;
+    if (threadContext->GetScriptEntryExit() != nullptr)
+    {
+        frameCount = _this->CollectSampleFrames(threadContext->GetScriptEntryExit()->scriptContext);
+    }
+
+    try
+    {
+        JsrtCallbackState scope(threadContext);
+        _this->allocationSampleCallback(sampleId, size, _this->sampleFrames, frameCount, _this->allocationSampleCallbackContext);
+    }
+    catch (...)
+    {
+        AssertMsg(false, "Unexpected non-engine exception.");
+    }
+}
+
+void JsrtRuntime::AllocationSampleFreeCallbackStatic(void * context, uint sampleId)
+{
+    JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(context);
+
+    try
+    {
+        JsrtCallbackState scope(_this->threadContext);
+        _this->allocationSampleFreeCallback(sampleId, _this->allocationSampleCallbackContext);
+    }
+    catch (...)
+    {
+        AssertMsg(false, "Unexpected non-engine exception.");
+    }
+}
+
+void JsrtRuntime::SetExternalRootsCallback(JsExternalRootsCallback externalRootsCallback, void * callbackContext)
+{
+    this->externalRootsCallback = externalRootsCallback;
+    this->externalRootsCallbackContext = callbackContext;
+    this->threadContext->GetRecycler()->SetExternalRootScanner(externalRootsCallback != NULL ? ExternalRootScannerStatic : NULL, this);
+}
+
+void JsrtRuntime::ExternalRootScannerStatic(void * context, RecyclerScanMemoryCallback& scanMemoryCallback)
+{
+    JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(context);
+    try
+    {
+        JsrtCallbackState scope(reinterpret_cast<ThreadContext*>(_this->GetThreadContext()));
+        _this->externalRootsCallback(_this->externalRootsCallbackContext, ScanExternalRoots, &scanMemoryCallback);
+    }
+    catch (...)
+    {
+        AssertMsg(false, "Unexpected non-engine exception.");
+    }
+}
+
+void JsrtRuntime::ScanExternalRoots(void * scanState, JsValueRef * roots, size_t rootCount)
+{
+    RecyclerScanMemoryCallback& scanMemoryCallback = *reinterpret_cast<RecyclerScanMemoryCallback *>(scanState);
+    scanMemoryCallback(reinterpret_cast<void **>(roots), rootCount * sizeof(JsValueRef));
+}
+#endif
+
 unsigned int JsrtRuntime::Idle()
 {
     return this->threadService.Idle();
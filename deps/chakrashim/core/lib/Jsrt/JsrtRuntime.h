@@ -38,6 +38,13 @@ class JsrtRuntime
 
     void CloseContexts();
     void SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollectCallback, void * callbackContext);
+#ifdef _CHAKRACOREBUILD
+    void SetCollectEventCallback(JsCollectEventCallback collectEventCallback, void * callbackContext);
+    void SetSampleCallback(JsSampleCallback sampleCallback, void * callbackContext);
+    void SetExternalRootsCallback(JsExternalRootsCallback externalRootsCallback, void * callbackContext);
+    void SetAllocationSampling(size_t sampleInterval, JsAllocationSampleCallback sampleCallback,
+        JsAllocationSampleFreeCallback freeCallback, void * callbackContext);
+#endif
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     void SetSerializeByteCodeForLibrary(bool set) { serializeByteCodeForLibrary = set; }
@@ -58,6 +65,20 @@ class JsrtRuntime
 
 private:
     static void __cdecl RecyclerCollectCallbackStatic(void * context, RecyclerCollectCallBackFlags flags);
+#ifdef _CHAKRACOREBUILD
+    static void __cdecl RecyclerCollectEventCallbackStatic(void * context, RecyclerCollectCallBackFlags flags);
+    static void __cdecl ScriptSampleCallbackStatic(void * context);
+    static void __cdecl ExternalRootScannerStatic(void * context, RecyclerScanMemoryCallback& scanMemoryCallback);
+    static void CHAKRA_CALLBACK ScanExternalRoots(void * scanState, JsValueRef * roots, size_t rootCount);
+    static void __cdecl AllocationSampleCallbackStatic(void * context, uint sampleId, size_t size);
+    static void __cdecl AllocationSampleFreeCallbackStatic(void * context, uint sampleId);
+
+    // Fills sampleFrames with the script frames on the stack, innermost first
+    uint CollectSampleFrames(Js::ScriptContext * scriptContext);
+
+    // Deeper frames are dropped from a sample
+    static const ushort MaxSampleFrameCount = 128;
+#endif
 
 private:
     ThreadContext * threadContext;
@@ -67,6 +88,20 @@ class JsrtRuntime
     JsBeforeCollectCallback beforeCollectCallback;
     JsrtThreadService threadService;
     void * callbackContext;
+#ifdef _CHAKRACOREBUILD
+    ThreadContext::CollectCallBack * collectEventRegistration;
+    JsCollectEventCallback collectEventCallback;
+    void * collectEventCallbackContext;
+    JsCollectKind currentCollectKind;
+    JsSampleCallback sampleCallback;
+    void * sampleCallbackContext;
+    JsSampleFrame sampleFrames[MaxSampleFrameCount];
+    JsExternalRootsCallback externalRootsCallback;
+    void * externalRootsCallbackContext;
+    JsAllocationSampleCallback allocationSampleCallback;
+    JsAllocationSampleFreeCallback allocationSampleFreeCallback;
+    void * allocationSampleCallbackContext;
+#endif
     bool useIdle;
     bool dispatchExceptions;
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
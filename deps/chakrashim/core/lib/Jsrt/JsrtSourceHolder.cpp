@@ -305,6 +305,12 @@ namespace Js
         }
         this->mappedScriptValue = nullptr;
 
+        // The host may be holding on to the source until it is told the script is gone
+        if (scriptUnloadCallback != nullptr)
+        {
+            scriptUnloadCallback(sourceContext);
+        }
+
         // Don't allow load or unload again after told to unload.
         scriptLoadCallback = nullptr;
         scriptUnloadCallback = nullptr;
@@ -315,6 +315,7 @@ HRESULT Parser::ParseSourceInternal(
     m_scriptContext->ProfileBegin(Js::ParsePhase);
 #endif
     JS_ETW_INTERNAL(EventWriteJSCRIPT_PARSE_START(m_scriptContext, 0));
+    CHAKRA_USDT(PARSE_START, m_scriptContext, m_parseType, encodedCharCount);
 
     *parseTree = NULL;
     m_sourceLim = 0;
@@ -415,6 +416,7 @@ HRESULT Parser::ParseSourceInternal(
     m_scriptContext->ProfileEnd(Js::ParsePhase);
 #endif
     JS_ETW_INTERNAL(EventWriteJSCRIPT_PARSE_STOP(m_scriptContext, 0));
+    CHAKRA_USDT(PARSE_STOP, m_scriptContext, m_parseType, hr);
 
     return hr;
 }
@@ -7128,6 +7130,7 @@ void Parser::FinishFncDecl(ParseNodeFnc * pnodeFnc, LPCOLESTR pNameHint, bool fL
     }
 
     JS_ETW_INTERNAL(EventWriteJSCRIPT_PARSE_FUNC(GetScriptContext(), pnodeFnc->functionId, /*Undefer*/FALSE));
+    CHAKRA_USDT(PARSE_FUNC, GetScriptContext(), pnodeFnc->functionId, /*Undefer*/false);
 
 
     // Do the work of creating an AST for a function body.
@@ -11003,6 +11006,7 @@ void Parser::FinishDeferredFunction(ParseNodeBlock * pnodeScopeList)
         {
             // Go back and generate an AST for this function.
             JS_ETW_INTERNAL(EventWriteJSCRIPT_PARSE_FUNC(this->GetScriptContext(), pnodeFnc->functionId, /*Undefer*/TRUE));
+            CHAKRA_USDT(PARSE_FUNC, this->GetScriptContext(), pnodeFnc->functionId, /*Undefer*/true);
 
             ParseNodeFnc * pnodeFncSave = this->m_currentNodeFunc;
             this->m_currentNodeFunc = pnodeFnc;
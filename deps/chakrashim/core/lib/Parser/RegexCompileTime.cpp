@@ -4782,6 +4782,14 @@ namespace UnifiedRegex
 
                     compiler.Emit<SuccInst>();
                     compiler.CaptureInsts();
+
+                    // Only a pattern which may need to backtrack can blow up, so only those get a linear matcher to fall
+                    // back on
+                    if (CONFIG_FLAG_RELEASE(RegexLinear) ||
+                        (CONFIG_FLAG_RELEASE(RegexBacktrackLimit) != 0 && (root->features & Node::HasLoop) != 0 && !root->isDeterministic))
+                    {
+                        program->linearMatcher = LinearMatcher::New(scriptContext, rtAllocator, program, program->rep.insts.litbuf, root);
+                    }
                 }
             }
             else
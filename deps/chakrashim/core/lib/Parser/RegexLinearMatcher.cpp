@@ -0,0 +1,710 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "ParserPch.h"
+
+namespace UnifiedRegex
+{
+    // ----------------------------------------------------------------------
+    // LinearMatcher::Builder
+    // ----------------------------------------------------------------------
+
+    class LinearMatcher::Builder : private Chars<char16>
+    {
+    private:
+        Js::ScriptContext* const scriptContext;
+        ArenaAllocator* const rtAllocator;
+        const Program* const program;
+        const Char* const litbuf;
+        LinearMatcher* const matcher;
+        uint nextInst;
+        uint nextSet;
+
+        uint NewInst(InstTag tag)
+        {
+            Assert(nextInst < matcher->numInsts);
+            Inst& inst = matcher->insts[nextInst];
+            inst.tag = tag;
+            return nextInst++;
+        }
+
+        void EmitChar(const Char* cs, bool isEquivClass)
+        {
+            Inst& inst = matcher->insts[NewInst(InstTag::Char)];
+            for (int i = 0; i < CaseInsensitive::EquivClassSize; i++)
+            {
+                inst.cs[i] = isEquivClass ? cs[i] : cs[0];
+            }
+        }
+
+        void EmitLoopBody(Node* body, int minBodyGroupId, int maxBodyGroupId)
+        {
+            if (minBodyGroupId <= maxBodyGroupId)
+            {
+                // Each iteration begins with empty inner groups
+                Inst& inst = matcher->insts[NewInst(InstTag::ResetGroups)];
+                inst.x = minBodyGroupId;
+                inst.y = maxBodyGroupId;
+            }
+            Emit(body);
+        }
+
+    public:
+        Builder(Js::ScriptContext* scriptContext, ArenaAllocator* rtAllocator, const Program* program, const Char* litbuf, LinearMatcher* matcher)
+            : scriptContext(scriptContext)
+            , rtAllocator(rtAllocator)
+            , program(program)
+            , litbuf(litbuf)
+            , matcher(matcher)
+            , nextInst(0)
+            , nextSet(0)
+        {
+        }
+
+        // Accumulate the number of instructions and sets needed for node. Returns false if the node can't be run by the
+        // linear matcher.
+        static bool Measure(Js::ScriptContext* scriptContext, Node* node, uint64& numInsts, uint64& numSets)
+        {
+            PROBE_STACK_NO_DISPOSE(scriptContext, Js::Constants::MinStackRegex);
+
+            switch (node->tag)
+            {
+            case Node::Empty:
+                break;
+            case Node::BOL:
+            case Node::EOL:
+            case Node::WordBoundary:
+            case Node::MatchChar:
+                numInsts++;
+                break;
+            case Node::MatchSet:
+                numInsts++;
+                numSets++;
+                break;
+            case Node::MatchLiteral:
+                numInsts += static_cast<MatchLiteralNode*>(node)->length;
+                break;
+            case Node::Concat:
+                for (ConcatNode* curr = static_cast<ConcatNode*>(node); curr != nullptr; curr = curr->tail)
+                {
+                    if (!Measure(scriptContext, curr->head, numInsts, numSets))
+                    {
+                        return false;
+                    }
+                }
+                break;
+            case Node::Alt:
+                for (AltNode* curr = static_cast<AltNode*>(node); curr != nullptr; curr = curr->tail)
+                {
+                    if (!Measure(scriptContext, curr->head, numInsts, numSets))
+                    {
+                        return false;
+                    }
+                    if (curr->tail != nullptr)
+                    {
+                        // Split before, Jump after
+                        numInsts += 2;
+                    }
+                }
+                break;
+            case Node::DefineGroup:
+                numInsts += 2;
+                return Measure(scriptContext, static_cast<DefineGroupNode*>(node)->body, numInsts, numSets);
+            case Node::Loop:
+                {
+                    LoopNode* loop = static_cast<LoopNode*>(node);
+
+                    // JavaScript stops a loop on an empty iteration, which threads merging at the loop head would not
+                    // reproduce exactly. Such loops are left to the backtracking matcher.
+                    if (loop->body->thisConsumes.CouldMatchEmpty())
+                    {
+                        return false;
+                    }
+
+                    uint64 bodyInsts = 0;
+                    uint64 bodySets = 0;
+                    if (!Measure(scriptContext, loop->body, bodyInsts, bodySets))
+                    {
+                        return false;
+                    }
+                    if (loop->body->ContainsDefineGroup())
+                    {
+                        bodyInsts++;
+                    }
+
+                    const uint64 lower = loop->repeats.lower;
+                    if (lower > MaxInsts)
+                    {
+                        return false;
+                    }
+                    numInsts += lower * bodyInsts;
+                    numSets += lower * bodySets;
+                    if (loop->repeats.upper == CharCountFlag)
+                    {
+                        // Split, body, Jump
+                        numInsts += bodyInsts + 2;
+                        numSets += bodySets;
+                    }
+                    else
+                    {
+                        // Split before each optional iteration
+                        const uint64 optional = loop->repeats.upper - lower;
+                        if (optional > MaxInsts)
+                        {
+                            return false;
+                        }
+                        numInsts += optional * (bodyInsts + 1);
+                        numSets += optional * bodySets;
+                    }
+                    break;
+                }
+            default:
+                // Backreferences and assertions need the backtracking matcher
+                return false;
+            }
+
+            return numInsts <= MaxInsts;
+        }
+
+        void Emit(Node* node)
+        {
+            PROBE_STACK_NO_DISPOSE(scriptContext, Js::Constants::MinStackRegex);
+
+            const bool isMultiline = (program->flags & MultilineRegexFlag) != 0;
+            switch (node->tag)
+            {
+            case Node::Empty:
+                break;
+            case Node::BOL:
+                NewInst(isMultiline ? InstTag::BOLTest : InstTag::BOITest);
+                break;
+            case Node::EOL:
+                NewInst(isMultiline ? InstTag::EOLTest : InstTag::EOITest);
+                break;
+            case Node::WordBoundary:
+                matcher->insts[NewInst(InstTag::WordBoundaryTest)].isNegation = static_cast<WordBoundaryNode*>(node)->isNegation;
+                break;
+            case Node::MatchChar:
+                {
+                    MatchCharNode* matchChar = static_cast<MatchCharNode*>(node);
+                    EmitChar(matchChar->cs, matchChar->isEquivClass);
+                    break;
+                }
+            case Node::MatchLiteral:
+                {
+                    MatchLiteralNode* literal = static_cast<MatchLiteralNode*>(node);
+                    const CharCount width = literal->isEquivClass ? CaseInsensitive::EquivClassSize : 1;
+                    for (CharCount i = 0; i < literal->length; i++)
+                    {
+                        EmitChar(litbuf + literal->offset + i * width, literal->isEquivClass);
+                    }
+                    break;
+                }
+            case Node::MatchSet:
+                {
+                    MatchSetNode* matchSet = static_cast<MatchSetNode*>(node);
+                    Assert(nextSet < matcher->numSets);
+                    Inst& inst = matcher->insts[NewInst(InstTag::Set)];
+                    inst.isNegation = matchSet->isNegation;
+                    inst.x = nextSet;
+                    matcher->sets[nextSet++].CloneFrom(rtAllocator, matchSet->set);
+                    break;
+                }
+            case Node::Concat:
+                for (ConcatNode* curr = static_cast<ConcatNode*>(node); curr != nullptr; curr = curr->tail)
+                {
+                    Emit(curr->head);
+                }
+                break;
+            case Node::Alt:
+                {
+                    //
+                    // Compilation scheme:
+                    //
+                    //          Split L1, L2
+                    //   L1:    <item 1>
+                    //          Jump Lexit
+                    //   L2:    Split L3, ...
+                    //          ...
+                    //   Ln:    <item n>
+                    //   Lexit:
+                    //
+                    // The Jumps are chained through their targets until Lexit is known.
+                    uint jumps = NoLabel;
+                    for (AltNode* curr = static_cast<AltNode*>(node); curr != nullptr; curr = curr->tail)
+                    {
+                        if (curr->tail == nullptr)
+                        {
+                            Emit(curr->head);
+                            break;
+                        }
+                        const uint split = NewInst(InstTag::Split);
+                        matcher->insts[split].x = nextInst;
+                        Emit(curr->head);
+                        const uint jump = NewInst(InstTag::Jump);
+                        matcher->insts[jump].x = jumps;
+                        jumps = jump;
+                        matcher->insts[split].y = nextInst;
+                    }
+                    while (jumps != NoLabel)
+                    {
+                        const uint next = matcher->insts[jumps].x;
+                        matcher->insts[jumps].x = nextInst;
+                        jumps = next;
+                    }
+                    break;
+                }
+            case Node::DefineGroup:
+                {
+                    DefineGroupNode* group = static_cast<DefineGroupNode*>(node);
+                    matcher->insts[NewInst(InstTag::Save)].x = group->groupId * 2;
+                    Emit(group->body);
+                    matcher->insts[NewInst(InstTag::Save)].x = group->groupId * 2 + 1;
+                    break;
+                }
+            case Node::Loop:
+                {
+                    LoopNode* loop = static_cast<LoopNode*>(node);
+                    int minBodyGroupId = program->numGroups;
+                    int maxBodyGroupId = -1;
+                    loop->body->AccumDefineGroups(scriptContext, minBodyGroupId, maxBodyGroupId);
+
+                    for (CharCount i = 0; i < loop->repeats.lower; i++)
+                    {
+                        EmitLoopBody(loop->body, minBodyGroupId, maxBodyGroupId);
+                    }
+
+                    if (loop->repeats.upper == CharCountFlag)
+                    {
+                        //
+                        // Compilation scheme (greedy; non-greedy swaps the Split targets):
+                        //
+                        //   Lloop: Split Lbody, Lexit
+                        //   Lbody: <body>
+                        //          Jump Lloop
+                        //   Lexit:
+                        //
+                        const uint split = NewInst(InstTag::Split);
+                        EmitLoopBody(loop->body, minBodyGroupId, maxBodyGroupId);
+                        matcher->insts[NewInst(InstTag::Jump)].x = split;
+                        matcher->insts[split].x = loop->isGreedy ? split + 1 : nextInst;
+                        matcher->insts[split].y = loop->isGreedy ? nextInst : split + 1;
+                    }
+                    else
+                    {
+                        //
+                        // Compilation scheme (greedy; non-greedy swaps the Split targets):
+                        //
+                        //          Split L1, Lexit
+                        //   L1:    <body>
+                        //          Split L2, Lexit
+                        //   L2:    <body>
+                        //          ...
+                        //   Lexit:
+                        //
+                        // The Splits are chained through their exit targets until Lexit is known.
+                        uint splits = NoLabel;
+                        for (CharCount i = loop->repeats.lower; i < loop->repeats.upper; i++)
+                        {
+                            const uint split = NewInst(InstTag::Split);
+                            if (loop->isGreedy)
+                            {
+                                matcher->insts[split].x = split + 1;
+                                matcher->insts[split].y = splits;
+                            }
+                            else
+                            {
+                                matcher->insts[split].x = splits;
+                                matcher->insts[split].y = split + 1;
+                            }
+                            splits = split;
+                            EmitLoopBody(loop->body, minBodyGroupId, maxBodyGroupId);
+                        }
+                        while (splits != NoLabel)
+                        {
+                            Inst& split = matcher->insts[splits];
+                            if (loop->isGreedy)
+                            {
+                                splits = split.y;
+                                split.y = nextInst;
+                            }
+                            else
+                            {
+                                splits = split.x;
+                                split.x = nextInst;
+                            }
+                        }
+                    }
+                    break;
+                }
+            default:
+                Assert(false);
+                __assume(false);
+            }
+        }
+
+        void EmitMatch()
+        {
+            NewInst(InstTag::Match);
+            Assert(nextInst == matcher->numInsts);
+            Assert(nextSet == matcher->numSets);
+        }
+    };
+
+    // ----------------------------------------------------------------------
+    // LinearMatcher
+    // ----------------------------------------------------------------------
+
+    LinearMatcher::LinearMatcher(uint16 numGroups)
+        : insts(nullptr)
+        , numInsts(0)
+        , sets(nullptr)
+        , numSets(0)
+        , numGroups(numGroups)
+    {
+    }
+
+    LinearMatcher *LinearMatcher::New(Js::ScriptContext* scriptContext, ArenaAllocator* rtAllocator, const Program* program, const Char* litbuf, Node* root)
+    {
+        if (root->ContainsMatchGroup() || (root->features & Node::HasAssertion) != 0)
+        {
+            return nullptr;
+        }
+
+        // Final Match instruction
+        uint64 numInsts = 1;
+        uint64 numSets = 0;
+        if (!Builder::Measure(scriptContext, root, numInsts, numSets) || numInsts * program->numGroups * 2 > MaxThreadSlots)
+        {
+            return nullptr;
+        }
+
+        Recycler* recycler = scriptContext->GetRecycler();
+        LinearMatcher* matcher = RecyclerNew(recycler, LinearMatcher, program->numGroups);
+        matcher->insts = RecyclerNewArrayLeafZ(recycler, Inst, static_cast<size_t>(numInsts));
+        matcher->numInsts = static_cast<uint>(numInsts);
+        if (numSets > 0)
+        {
+            matcher->sets = RecyclerNewArrayLeaf(recycler, RuntimeCharSet<Char>, static_cast<size_t>(numSets));
+            matcher->numSets = static_cast<uint>(numSets);
+        }
+
+        Builder builder(scriptContext, rtAllocator, program, litbuf, matcher);
+        builder.Emit(root);
+        builder.EmitMatch();
+        return matcher;
+    }
+
+    void LinearMatcher::FreeBody(ArenaAllocator* rtAllocator)
+    {
+        for (uint i = 0; i < numSets; i++)
+        {
+            sets[i].FreeBody(rtAllocator);
+        }
+    }
+
+    void LinearMatcher::AddThread
+        ( const StandardChars<Char>* standardChars
+        , ThreadList& list
+        , uint label
+        , const Char* const input
+        , const CharCount inputLength
+        , const CharCount inputOffset
+        , CharCountOrFlag* caps
+        , AddStep* stack
+        ) const
+    {
+        // Follow all the non-consuming instructions reachable from label, in priority order, adding every instruction
+        // reached to the list. Captures are updated in place and restored as the stack unwinds. Each instruction reached
+        // pushes at most numGroups steps, and is reached at most once per list.
+        const uint numSlots = numGroups * 2;
+        uint top = 0;
+        stack[top].label = label;
+        top++;
+        while (top > 0)
+        {
+            const AddStep step = stack[--top];
+            if (step.label == NoLabel)
+            {
+                caps[step.slot] = step.value;
+                continue;
+            }
+
+            label = step.label;
+            while (true)
+            {
+                Assert(label < numInsts);
+                uint index = list.sparse[label];
+                if (index < list.count && list.dense[index] == label)
+                {
+                    // Already reached by a higher priority thread
+                    break;
+                }
+                index = list.count++;
+                list.sparse[label] = index;
+                list.dense[index] = label;
+
+                // Cases which carry on to another instruction 'continue', those which end the thread here 'break'
+                const Inst& inst = insts[label];
+                switch (inst.tag)
+                {
+                case InstTag::Char:
+                case InstTag::Set:
+                case InstTag::Match:
+                    js_memcpy_s(list.caps + index * numSlots, numSlots * sizeof(CharCountOrFlag), caps, numSlots * sizeof(CharCountOrFlag));
+                    break;
+                case InstTag::Jump:
+                    label = inst.x;
+                    continue;
+                case InstTag::Split:
+                    stack[top].label = inst.y;
+                    top++;
+                    label = inst.x;
+                    continue;
+                case InstTag::Save:
+                    stack[top].label = NoLabel;
+                    stack[top].slot = inst.x;
+                    stack[top].value = caps[inst.x];
+                    top++;
+                    caps[inst.x] = inputOffset;
+                    label++;
+                    continue;
+                case InstTag::ResetGroups:
+                    for (uint groupId = inst.x; groupId <= inst.y; groupId++)
+                    {
+                        stack[top].label = NoLabel;
+                        stack[top].slot = groupId * 2 + 1;
+                        stack[top].value = caps[groupId * 2 + 1];
+                        top++;
+                        caps[groupId * 2 + 1] = CharCountFlag;
+                    }
+                    label++;
+                    continue;
+                case InstTag::BOITest:
+                    if (inputOffset > 0)
+                    {
+                        break;
+                    }
+                    label++;
+                    continue;
+                case InstTag::EOITest:
+                    if (inputOffset < inputLength)
+                    {
+                        break;
+                    }
+                    label++;
+                    continue;
+                case InstTag::BOLTest:
+                    if (inputOffset > 0 && !standardChars->IsNewline(input[inputOffset - 1]))
+                    {
+                        break;
+                    }
+                    label++;
+                    continue;
+                case InstTag::EOLTest:
+                    if (inputOffset < inputLength && !standardChars->IsNewline(input[inputOffset]))
+                    {
+                        break;
+                    }
+                    label++;
+                    continue;
+                case InstTag::WordBoundaryTest:
+                    {
+                        const bool prev = inputOffset > 0 && standardChars->IsWord(input[inputOffset - 1]);
+                        const bool curr = inputOffset < inputLength && standardChars->IsWord(input[inputOffset]);
+                        if (inst.isNegation == (prev != curr))
+                        {
+                            break;
+                        }
+                        label++;
+                        continue;
+                    }
+                default:
+                    Assert(false);
+                    __assume(false);
+                }
+                break;
+            }
+        }
+    }
+
+    bool LinearMatcher::Match
+        ( const StandardChars<Char>* standardChars
+        , const Char* const input
+        , const CharCount inputLength
+        , const CharCount offset
+        , const bool isAnchored
+        , GroupInfo* const groupInfos
+#if ENABLE_REGEX_CONFIG_OPTIONS
+        , RegexStats* stats
+#endif
+        ) const
+    {
+        Assert(offset <= inputLength);
+
+        const uint numSlots = numGroups * 2;
+        const size_t numLabels = numInsts * 4;
+        const size_t numCaps = numInsts * numSlots * 2 + numSlots * 2;
+        const size_t numSteps = numInsts * numGroups + 1;
+        AutoArrayPtr<uint> labels(HeapNewArrayZ(uint, numLabels), numLabels);
+        AutoArrayPtr<CharCountOrFlag> allCaps(HeapNewArray(CharCountOrFlag, numCaps), numCaps);
+        AutoArrayPtr<AddStep> stack(HeapNewArray(AddStep, numSteps), numSteps);
+
+        ThreadList lists[2];
+        for (int i = 0; i < 2; i++)
+        {
+            lists[i].count = 0;
+            lists[i].sparse = labels + numInsts * (i * 2);
+            lists[i].dense = labels + numInsts * (i * 2 + 1);
+            lists[i].caps = allCaps + numInsts * numSlots * i;
+        }
+        CharCountOrFlag *const matchCaps = allCaps + numInsts * numSlots * 2;
+        CharCountOrFlag *const startCaps = matchCaps + numSlots;
+
+        ThreadList* curr = &lists[0];
+        ThreadList* next = &lists[1];
+        bool matched = false;
+        CharCount inputOffset = offset;
+        while (true)
+        {
+            if (!matched && (!isAnchored || inputOffset == offset))
+            {
+                // A match starting here has the lowest priority of all
+                for (uint i = 0; i < numSlots; i++)
+                {
+                    startCaps[i] = CharCountFlag;
+                }
+                startCaps[0] = inputOffset;
+                AddThread(standardChars, *curr, 0, input, inputLength, inputOffset, startCaps, stack);
+            }
+            else if (curr->count == 0)
+            {
+                break;
+            }
+
+            next->count = 0;
+            for (uint i = 0; i < curr->count; i++)
+            {
+                const uint label = curr->dense[i];
+                const Inst& inst = insts[label];
+                CharCountOrFlag *const threadCaps = curr->caps + i * numSlots;
+                if (inst.tag == InstTag::Match)
+                {
+                    js_memcpy_s(matchCaps, numSlots * sizeof(CharCountOrFlag), threadCaps, numSlots * sizeof(CharCountOrFlag));
+                    matchCaps[1] = inputOffset;
+                    matched = true;
+                    // Remaining threads have lower priority than this match
+                    break;
+                }
+                if (inputOffset == inputLength || (inst.tag != InstTag::Char && inst.tag != InstTag::Set))
+                {
+                    continue;
+                }
+#if ENABLE_REGEX_CONFIG_OPTIONS
+                if (stats != 0)
+                {
+                    stats->numCompares++;
+                }
+#endif
+                const Char c = input[inputOffset];
+                const bool isMatch = inst.tag == InstTag::Char
+                    ? c == inst.cs[0] || c == inst.cs[1] || c == inst.cs[2] || c == inst.cs[3]
+                    : sets[inst.x].Get(c) != inst.isNegation;
+                if (isMatch)
+                {
+                    AddThread(standardChars, *next, label + 1, input, inputLength, inputOffset + 1, threadCaps, stack);
+                }
+            }
+
+            if (inputOffset == inputLength)
+            {
+                break;
+            }
+            ThreadList* temp = curr;
+            curr = next;
+            next = temp;
+            inputOffset++;
+        }
+
+        for (uint16 groupId = 0; groupId < numGroups; groupId++)
+        {
+            GroupInfo* const groupInfo = groupInfos + groupId;
+            const CharCountOrFlag end = matchCaps[groupId * 2 + 1];
+            if (!matched || end == CharCountFlag)
+            {
+                groupInfo->Reset();
+            }
+            else
+            {
+                groupInfo->offset = matchCaps[groupId * 2];
+                groupInfo->length = end - matchCaps[groupId * 2];
+            }
+        }
+        return matched;
+    }
+
+#if ENABLE_REGEX_CONFIG_OPTIONS
+    void LinearMatcher::Print(DebugWriter* w) const
+    {
+        for (uint label = 0; label < numInsts; label++)
+        {
+            const Inst& inst = insts[label];
+            w->Print(_u("L%04x: "), label);
+            switch (inst.tag)
+            {
+            case InstTag::Char:
+                w->Print(_u("Char("));
+                for (int i = 0; i < CaseInsensitive::EquivClassSize; i++)
+                {
+                    if (i > 0)
+                    {
+                        w->Print(_u(", "));
+                    }
+                    w->PrintQuotedChar(inst.cs[i]);
+                }
+                w->PrintEOL(_u(")"));
+                break;
+            case InstTag::Set:
+                w->Print(inst.isNegation ? _u("NegatedSet(") : _u("Set("));
+                sets[inst.x].Print(w);
+                w->PrintEOL(_u(")"));
+                break;
+            case InstTag::Split:
+                w->PrintEOL(_u("Split(L%04x, L%04x)"), inst.x, inst.y);
+                break;
+            case InstTag::Jump:
+                w->PrintEOL(_u("Jump(L%04x)"), inst.x);
+                break;
+            case InstTag::Save:
+                w->PrintEOL(_u("Save(%u)"), inst.x);
+                break;
+            case InstTag::ResetGroups:
+                w->PrintEOL(_u("ResetGroups(%u, %u)"), inst.x, inst.y);
+                break;
+            case InstTag::BOITest:
+                w->PrintEOL(_u("BOITest"));
+                break;
+            case InstTag::EOITest:
+                w->PrintEOL(_u("EOITest"));
+                break;
+            case InstTag::BOLTest:
+                w->PrintEOL(_u("BOLTest"));
+                break;
+            case InstTag::EOLTest:
+                w->PrintEOL(_u("EOLTest"));
+                break;
+            case InstTag::WordBoundaryTest:
+                w->PrintEOL(inst.isNegation ? _u("NegatedWordBoundaryTest") : _u("WordBoundaryTest"));
+                break;
+            case InstTag::Match:
+                w->PrintEOL(_u("Match"));
+                break;
+            default:
+                Assert(false);
+                __assume(false);
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,113 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// Linear-time matcher for patterns without backreferences or lookaround assertions.
+//
+// The pattern is compiled to a small NFA program which is simulated one input character at a time, keeping at most one
+// thread per program instruction (a Pike VM). Threads are kept in priority order, so the first thread to reach Match
+// yields the same match and captures as the backtracking matcher would, in O(input length * program size) time.
+// It is used when the backtracking matcher exceeds its backtrack budget (-RegexBacktrackLimit), or always when
+// -RegexLinear is on.
+#pragma once
+
+namespace UnifiedRegex
+{
+    class LinearMatcher : private Chars<char16>
+    {
+    public:
+        // Patterns whose program (with counted loops unrolled) would be larger than this are left to the backtracking matcher
+        static const uint MaxInsts = 2048;
+        // Bound on instructions * capture slots, which sizes the thread lists
+        static const uint MaxThreadSlots = 64 * 1024;
+
+    private:
+        enum class InstTag : uint8
+        {
+            Char,           // consume a character in cs
+            Set,            // consume a character in (or, if isNegation, not in) sets[x]
+            Split,          // continue at x, then at y with lower priority
+            Jump,           // continue at x
+            Save,           // record input offset in capture slot x
+            ResetGroups,    // make groups x..y undefined (start of a loop iteration)
+            BOITest,
+            EOITest,
+            BOLTest,
+            EOLTest,
+            WordBoundaryTest,
+            Match
+        };
+
+        struct Inst
+        {
+            Field(InstTag) tag;
+            Field(bool) isNegation;
+            Field(uint) x;
+            Field(uint) y;
+            Field(Char) cs[CaseInsensitive::EquivClassSize];
+        };
+
+        // One pending step of AddThread: either an instruction to follow, or (if label is NoLabel) a capture slot to restore
+        struct AddStep
+        {
+            uint label;
+            uint slot;
+            CharCountOrFlag value;
+        };
+
+        struct ThreadList
+        {
+            uint count;
+            uint *sparse;              // label => index into dense, valid only if dense agrees
+            uint *dense;               // labels of threads, in priority order
+            CharCountOrFlag *caps;     // capture slots of dense[i] at caps[i * numSlots]
+        };
+
+        static const uint NoLabel = (uint)-1;
+
+        Field(Inst*) insts;            // in recycler, owned by matcher
+        Field(uint) numInsts;
+        Field(RuntimeCharSet<Char>*) sets; // in recycler, contents in run-time allocator
+        Field(uint) numSets;
+        Field(uint16) numGroups;
+
+        LinearMatcher(uint16 numGroups);
+
+        class Builder;
+
+        void AddThread
+            ( const StandardChars<Char>* standardChars
+            , ThreadList& list
+            , uint label
+            , const Char* const input
+            , const CharCount inputLength
+            , const CharCount inputOffset
+            , CharCountOrFlag* caps
+            , AddStep* stack
+            ) const;
+
+    public:
+        // Returns nullptr if the pattern is not supported or too large
+        static LinearMatcher *New(Js::ScriptContext* scriptContext, ArenaAllocator* rtAllocator, const Program* program, const Char* litbuf, Node* root);
+
+        // Find the first match starting at or after offset (or exactly at offset if isAnchored) and fill in all groups
+        bool Match
+            ( const StandardChars<Char>* standardChars
+            , const Char* const input
+            , const CharCount inputLength
+            , const CharCount offset
+            , const bool isAnchored
+            , GroupInfo* const groupInfos
+#if ENABLE_REGEX_CONFIG_OPTIONS
+            , RegexStats* stats
+#endif
+            ) const;
+
+        void FreeBody(ArenaAllocator* rtAllocator);
+
+#if ENABLE_REGEX_CONFIG_OPTIONS
+        void Print(DebugWriter* w) const;
+#endif
+    };
+}
@@ -28,6 +28,33 @@ namespace UnifiedRegex
     }
 #endif
 
+    // ----------------------------------------------------------------------
+    // Character search (inlined, called from the sync instructions)
+    // ----------------------------------------------------------------------
+
+    // Offset of the first c0 or c1 at or after offset, inputLength if there is none. Blocks of eight characters
+    // are compared at once, the rest of the input one character at a time.
+    static inline CharCount FindCharOf2(const char16* const input, const CharCount inputLength, CharCount offset, const char16 c0, const char16 c1)
+    {
+        const CharSearch::Block matchC0 = CharSearch::Splat(c0);
+        const CharSearch::Block matchC1 = CharSearch::Splat(c1);
+        offset = CharSearch::SkipBlocks(input, offset, inputLength, [&](const char16* block)
+        {
+            CharSearch::Block chars = CharSearch::Load(block);
+            return CharSearch::Or(CharSearch::Equal(chars, matchC0), CharSearch::Equal(chars, matchC1));
+        });
+        while (offset < inputLength && input[offset] != c0 && input[offset] != c1)
+        {
+            offset++;
+        }
+        return offset;
+    }
+
+    static inline CharCount FindChar(const char16* const input, const CharCount inputLength, CharCount offset, const char16 c)
+    {
+        return FindCharOf2(input, inputLength, offset, c, c);
+    }
+
     // ----------------------------------------------------------------------
     // Matcher (inlined, called from instruction Exec methods)
     // ----------------------------------------------------------------------
@@ -1813,17 +1840,10 @@ namespace UnifiedRegex
 
     inline bool SyncToCharAndContinueInst::Exec(REGEX_INST_EXEC_PARAMETERS) const
     {
-        const Char matchC = c;
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
 #endif
-        while (inputOffset < inputLength && input[inputOffset] != matchC)
-        {
-#if ENABLE_REGEX_CONFIG_OPTIONS
-            matcher.CompStats();
-#endif
-            inputOffset++;
-        }
+        inputOffset = FindChar(input, inputLength, inputOffset, c);
 
         matchStart = inputOffset;
         instPointer += sizeof(*this);
@@ -1847,18 +1867,10 @@ namespace UnifiedRegex
 
     inline bool SyncToChar2SetAndContinueInst::Exec(REGEX_INST_EXEC_PARAMETERS) const
     {
-        const Char matchC0 = cs[0];
-        const Char matchC1 = cs[1];
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
 #endif
-        while (inputOffset < inputLength && input[inputOffset] != matchC0 && input[inputOffset] != matchC1)
-        {
-#if ENABLE_REGEX_CONFIG_OPTIONS
-            matcher.CompStats();
-#endif
-            inputOffset++;
-        }
+        inputOffset = FindCharOf2(input, inputLength, inputOffset, cs[0], cs[1]);
 
         matchStart = inputOffset;
         instPointer += sizeof(*this);
@@ -2012,17 +2024,10 @@ namespace UnifiedRegex
 
     inline bool SyncToCharAndConsumeInst::Exec(REGEX_INST_EXEC_PARAMETERS) const
     {
-        const Char matchC = c;
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
 #endif
-        while (inputOffset < inputLength && input[inputOffset] != matchC)
-        {
-#if ENABLE_REGEX_CONFIG_OPTIONS
-            matcher.CompStats();
-#endif
-            inputOffset++;
-        }
+        inputOffset = FindChar(input, inputLength, inputOffset, c);
 
         if (inputOffset >= inputLength)
         {
@@ -2051,18 +2056,10 @@ namespace UnifiedRegex
 
     inline bool SyncToChar2SetAndConsumeInst::Exec(REGEX_INST_EXEC_PARAMETERS) const
     {
-        const Char matchC0 = cs[0];
-        const Char matchC1 = cs[1];
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
 #endif
-        while (inputOffset < inputLength && (input[inputOffset] != matchC0 && input[inputOffset] != matchC1))
-        {
-#if ENABLE_REGEX_CONFIG_OPTIONS
-            matcher.CompStats();
-#endif
-            inputOffset++;
-        }
+        inputOffset = FindCharOf2(input, inputLength, inputOffset, cs[0], cs[1]);
 
         if (inputOffset >= inputLength)
         {
@@ -2246,14 +2243,10 @@ namespace UnifiedRegex
             inputOffset = matchStart + backup.lower;
         }
 
-        const Char matchC = c;
-        while (inputOffset < inputLength && input[inputOffset] != matchC)
-        {
 #if ENABLE_REGEX_CONFIG_OPTIONS
-            matcher.CompStats();
+        matcher.CompStats();
 #endif
-            inputOffset++;
-        }
+        inputOffset = FindChar(input, inputLength, inputOffset, c);
 
         if (inputOffset >= inputLength)
         {
@@ -4922,6 +4915,8 @@ namespace UnifiedRegex
         , literalNextSyncInputOffsets(nullptr)
         , recycler(scriptContext->GetRecycler())
         , previousQcTime(0)
+        , backtrackBudget(0)
+        , isBacktrackBudgetExhausted(false)
 #if ENABLE_REGEX_CONFIG_OPTIONS
         , stats(0)
         , w(0)
@@ -5047,7 +5042,12 @@ namespace UnifiedRegex
     {
         if (!contStack.IsEmpty())
         {
-            if (!RunContStack(input, inputOffset, instPointer, contStack, assertionStack, qcTicks))
+            if (backtrackBudget != 0 && --backtrackBudget == 0)
+            {
+                // Stop here, Match will rerun the pattern with the linear matcher
+                isBacktrackBudgetExhausted = true;
+            }
+            else if (!RunContStack(input, inputOffset, instPointer, contStack, assertionStack, qcTicks))
             {
                 return false;
             }
@@ -5246,19 +5246,16 @@ namespace UnifiedRegex
             }
         }
 
-        while (offset < inputLength)
-        {
 #if ENABLE_REGEX_CONFIG_OPTIONS
-            CompStats();
+        CompStats();
 #endif
-            if (input[offset] == c)
-            {
-                GroupInfo* const info = GroupIdToGroupInfo(0);
-                info->offset = offset;
-                info->length = 1;
-                return true;
-            }
-            offset++;
+        offset = FindChar(input, inputLength, offset, c);
+        if (offset < inputLength)
+        {
+            GroupInfo* const info = GroupIdToGroupInfo(0);
+            info->offset = offset;
+            info->length = 1;
+            return true;
         }
 
         ResetGroup(0);
@@ -5452,6 +5449,22 @@ namespace UnifiedRegex
         return false;
     }
 
+    inline bool Matcher::MatchLinear(const Char* const input, const CharCount inputLength, CharCount offset, bool isAnchored)
+    {
+        Assert(program->linearMatcher != nullptr);
+        return program->linearMatcher->Match
+            ( standardChars
+            , input
+            , inputLength
+            , offset
+            , isAnchored
+            , groupInfos
+#if ENABLE_REGEX_CONFIG_OPTIONS
+            , stats
+#endif
+            );
+    }
+
     bool Matcher::Match
         ( const Char* const input
         , const CharCount inputLength
@@ -5494,9 +5507,20 @@ namespace UnifiedRegex
 
         case Program::ProgramTag::InstructionsTag:
             {
+                if (prog->linearMatcher != nullptr && CONFIG_FLAG_RELEASE(RegexLinear))
+                {
+                    res = MatchLinear(input, inputLength, offset, !loopMatchHere);
+                    break;
+                }
+
                 previousQcTime = 0;
                 uint qcTicks = 0;
 
+                // Without a linear matcher to fall back on, backtracking is unlimited
+                const CharCount startOffset = offset;
+                backtrackBudget = prog->linearMatcher != nullptr ? static_cast<uint>(CONFIG_FLAG_RELEASE(RegexBacktrackLimit)) : 0;
+                isBacktrackBudgetExhausted = false;
+
                 // This is the next offset in the input from where we will try to sync. For sync instructions that back up, this
                 // is used to avoid trying to sync when we have not yet reached the offset in the input we last synced to before
                 // backing up.
@@ -5513,8 +5537,12 @@ namespace UnifiedRegex
                     // multiple calls to MatchHere() would bloat the code.
                     res = MatchHere(input, inputLength, offset, nextSyncInputOffset, regexStacks->contStack, regexStacks->assertionStack, qcTicks, firstIteration);
                     firstIteration = false;
-                } while(!res && loopMatchHere && ++offset <= inputLength);
+                } while(!res && loopMatchHere && !isBacktrackBudgetExhausted && ++offset <= inputLength);
 
+                if (isBacktrackBudgetExhausted)
+                {
+                    res = MatchLinear(input, inputLength, startOffset, !loopMatchHere);
+                }
                 break;
             }
 
@@ -5667,6 +5695,7 @@ namespace UnifiedRegex
         rep.insts.litbuf = nullptr;
         rep.insts.litbufLen = 0;
         rep.insts.scannersForSyncToLiterals = nullptr;
+        linearMatcher = nullptr;
     }
 
     Program *Program::New(Recycler *recycler, RegexFlags flags)
@@ -5706,6 +5735,11 @@ namespace UnifiedRegex
 
     void Program::FreeBody(ArenaAllocator* rtAllocator)
     {
+        if (linearMatcher != nullptr)
+        {
+            linearMatcher->FreeBody(rtAllocator);
+        }
+
         if (tag != ProgramTag::InstructionsTag || !rep.insts.insts)
         {
             return;
@@ -5820,6 +5854,14 @@ namespace UnifiedRegex
             w->PrintEOL(_u(">"));
             break;
         }
+        if (linearMatcher != nullptr)
+        {
+            w->PrintEOL(_u("linear instructions: {"));
+            w->Indent();
+            linearMatcher->Print(w);
+            w->Unindent();
+            w->PrintEOL(_u("}"));
+        }
         w->Unindent();
         w->PrintEOL(_u("}"));
     }
@@ -17,6 +17,7 @@ namespace UnifiedRegex
     class ContStack;
     class AssertionStack;
     class OctoquadMatcher;
+    class LinearMatcher;
 
     enum class ChompMode : uint8
     {
@@ -138,6 +139,10 @@ namespace UnifiedRegex
         };
         Field(RepType) rep;
 
+        // Linear-time matcher for the same pattern, used instead of the instructions once backtracking gets out of hand.
+        // Only for instruction programs, and null if the pattern needs backtracking or is not worth it.
+        Field(LinearMatcher*) linearMatcher;
+
     public:
         Program(RegexFlags flags);
         static Program *New(Recycler *recycler, RegexFlags flags);
@@ -1822,6 +1827,11 @@ namespace UnifiedRegex
 
         Field(uint) previousQcTime;
 
+        // Number of backtracks left before Match gives up on the instructions and uses the program's linear matcher
+        // (0 => never give up)
+        Field(uint) backtrackBudget;
+        Field(bool) isBacktrackBudgetExhausted;
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
         FieldNoBarrier(RegexStats*) stats;
         FieldNoBarrier(DebugWriter*) w;
@@ -1948,6 +1958,9 @@ namespace UnifiedRegex
         // Specialized matcher for regex ^literal
         inline bool MatchBOILiteral2(const Char * const input, const CharCount inputLength, CharCount offset, DWORD literal2);
 
+        // Linear-time matcher, for patterns which backtrack too much
+        inline bool MatchLinear(const Char* const input, const CharCount inputLength, CharCount offset, bool isAnchored);
+
         void SaveInnerGroups(const int fromGroupId, const int toGroupId, const bool reset, const Char *const input, ContStack &contStack);
         void DoSaveInnerGroups(const int fromGroupId, const int toGroupId, const bool reset, const Char *const input, ContStack &contStack);
         void SaveInnerGroups_AllUndefined(const int fromGroupId, const int toGroupId, const Char *const input, ContStack &contStack);
@@ -4,6 +4,170 @@
 //-------------------------------------------------------------------------------------------------------
 #include "ParserPch.h"
 
+#if defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
+/*****************************************************************************
+*
+*  Skip runs of plain ASCII source text sixteen code units at a time. These
+*  return how many UTF-8 units starting at p can be consumed by the caller
+*  without looking at them one by one; the scalar loop of the caller takes
+*  over at the first unit that needs attention. The ARM64 versions only count
+*  whole blocks.
+*/
+
+// Units that are neither control characters (other than tab), nor part of a
+// multi-unit character, nor equal to one of the stop characters.
+static inline size_t ScanPlainAsciiRun(LPCUTF8 p, LPCUTF8 last, char stop1, char stop2, char stop3)
+{
+    LPCUTF8 start = p;
+#if defined(_M_IX86) || defined(_M_X64)
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i matchStop1 = _mm_set1_epi8(stop1);
+    const __m128i matchStop2 = _mm_set1_epi8(stop2);
+    const __m128i matchStop3 = _mm_set1_epi8(stop3);
+    while (last - p >= 16)
+    {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        // The units of multi-unit characters are negative as signed bytes, so the compare picks them up
+        // along with the control characters
+        __m128i special = _mm_andnot_si128(_mm_cmpeq_epi8(chars, tab), _mm_cmplt_epi8(chars, space));
+        special = _mm_or_si128(special,
+            _mm_or_si128(_mm_cmpeq_epi8(chars, matchStop1),
+                _mm_or_si128(_mm_cmpeq_epi8(chars, matchStop2), _mm_cmpeq_epi8(chars, matchStop3))));
+        DWORD mask = (DWORD)_mm_movemask_epi8(special);
+        if (mask != 0)
+        {
+            DWORD bit;
+            _BitScanForward(&bit, mask);
+            return (size_t)(p - start) + bit;
+        }
+        p += 16;
+    }
+#elif defined(_M_ARM64)
+    const int8x16_t space = vdupq_n_s8(' ');
+    const int8x16_t tab = vdupq_n_s8('\t');
+    const int8x16_t matchStop1 = vdupq_n_s8(stop1);
+    const int8x16_t matchStop2 = vdupq_n_s8(stop2);
+    const int8x16_t matchStop3 = vdupq_n_s8(stop3);
+    while (last - p >= 16)
+    {
+        int8x16_t chars = vld1q_s8(reinterpret_cast<const int8_t*>(p));
+        uint8x16_t special = vbicq_u8(vcltq_s8(chars, space), vceqq_s8(chars, tab));
+        special = vorrq_u8(special,
+            vorrq_u8(vceqq_s8(chars, matchStop1), vorrq_u8(vceqq_s8(chars, matchStop2), vceqq_s8(chars, matchStop3))));
+        if (vmaxvq_u8(special) != 0)
+        {
+            break;
+        }
+        p += 16;
+    }
+#else
+    Unused(last);
+    Unused(stop1);
+    Unused(stop2);
+    Unused(stop3);
+#endif
+    return (size_t)(p - start);
+}
+
+// Units that are spaces or tabs, as in indentation.
+static inline size_t ScanWhiteSpaceRun(LPCUTF8 p, LPCUTF8 last)
+{
+    LPCUTF8 start = p;
+#if defined(_M_IX86) || defined(_M_X64)
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    while (last - p >= 16)
+    {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i blanks = _mm_or_si128(_mm_cmpeq_epi8(chars, space), _mm_cmpeq_epi8(chars, tab));
+        DWORD mask = ~(DWORD)_mm_movemask_epi8(blanks) & 0xFFFF;
+        if (mask != 0)
+        {
+            DWORD bit;
+            _BitScanForward(&bit, mask);
+            return (size_t)(p - start) + bit;
+        }
+        p += 16;
+    }
+#elif defined(_M_ARM64)
+    const uint8x16_t space = vdupq_n_u8(' ');
+    const uint8x16_t tab = vdupq_n_u8('\t');
+    while (last - p >= 16)
+    {
+        uint8x16_t chars = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+        if (vminvq_u8(vorrq_u8(vceqq_u8(chars, space), vceqq_u8(chars, tab))) == 0)
+        {
+            break;
+        }
+        p += 16;
+    }
+#else
+    Unused(last);
+#endif
+    return (size_t)(p - start);
+}
+
+// Units that are ASCII identifier characters, which are [A-Za-z0-9_$].
+static inline size_t ScanAsciiIdentifierRun(LPCUTF8 p, LPCUTF8 last)
+{
+    LPCUTF8 start = p;
+#if defined(_M_IX86) || defined(_M_X64)
+    const __m128i toLower = _mm_set1_epi8(0x20);
+    const __m128i beforeA = _mm_set1_epi8('a' - 1);
+    const __m128i afterZ = _mm_set1_epi8('z' + 1);
+    const __m128i before0 = _mm_set1_epi8('0' - 1);
+    const __m128i after9 = _mm_set1_epi8('9' + 1);
+    const __m128i underscore = _mm_set1_epi8('_');
+    const __m128i dollar = _mm_set1_epi8('$');
+    while (last - p >= 16)
+    {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        // Setting 0x20 folds the upper case letters onto the lower case ones, and maps nothing else onto
+        // them. Units of multi-unit characters stay negative and fail the signed compares.
+        __m128i lower = _mm_or_si128(chars, toLower);
+        __m128i idChars = _mm_and_si128(_mm_cmpgt_epi8(lower, beforeA), _mm_cmplt_epi8(lower, afterZ));
+        idChars = _mm_or_si128(idChars, _mm_and_si128(_mm_cmpgt_epi8(chars, before0), _mm_cmplt_epi8(chars, after9)));
+        idChars = _mm_or_si128(idChars, _mm_or_si128(_mm_cmpeq_epi8(chars, underscore), _mm_cmpeq_epi8(chars, dollar)));
+        DWORD mask = ~(DWORD)_mm_movemask_epi8(idChars) & 0xFFFF;
+        if (mask != 0)
+        {
+            DWORD bit;
+            _BitScanForward(&bit, mask);
+            return (size_t)(p - start) + bit;
+        }
+        p += 16;
+    }
+#elif defined(_M_ARM64)
+    const uint8x16_t toLower = vdupq_n_u8(0x20);
+    const uint8x16_t a = vdupq_n_u8('a');
+    const uint8x16_t z = vdupq_n_u8('z');
+    const uint8x16_t zero = vdupq_n_u8('0');
+    const uint8x16_t nine = vdupq_n_u8('9');
+    const uint8x16_t underscore = vdupq_n_u8('_');
+    const uint8x16_t dollar = vdupq_n_u8('$');
+    while (last - p >= 16)
+    {
+        uint8x16_t chars = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+        uint8x16_t lower = vorrq_u8(chars, toLower);
+        uint8x16_t idChars = vandq_u8(vcgeq_u8(lower, a), vcleq_u8(lower, z));
+        idChars = vorrq_u8(idChars, vandq_u8(vcgeq_u8(chars, zero), vcleq_u8(chars, nine)));
+        idChars = vorrq_u8(idChars, vorrq_u8(vceqq_u8(chars, underscore), vceqq_u8(chars, dollar)));
+        if (vminvq_u8(idChars) == 0)
+        {
+            break;
+        }
+        p += 16;
+    }
+#else
+    Unused(last);
+#endif
+    return (size_t)(p - start);
+}
+
 /*****************************************************************************
 *
 *  The following table speeds various tests of characters, such as whether
@@ -435,6 +599,7 @@ BOOL Scanner<EncodingPolicy>::FastIdentifierContinue(EncodedCharPtr&p, EncodedCh
 {
     if (EncodingPolicy::MultiUnitEncoding)
     {
+        p += ScanAsciiIdentifierRun(reinterpret_cast<LPCUTF8>(p), reinterpret_cast<LPCUTF8>(last));
         while (p < last)
         {
             EncodedChar currentChar = *p;
@@ -1041,6 +1206,20 @@ tokens Scanner<EncodingPolicy>::ScanStringConstant(OLECHAR delim, EncodedCharPtr
 
     for (;;)
     {
+        if (EncodingPolicy::MultiUnitEncoding)
+        {
+            // Copy the run of characters that need no attention in one go. In a template the delimiter
+            // is '`' and '$' may start a substitution.
+            size_t cch = ScanPlainAsciiRun(reinterpret_cast<LPCUTF8>(p), reinterpret_cast<LPCUTF8>(last),
+                (char)delim, '\\', stringTemplateMode ? '$' : '\0');
+            if (cch != 0)
+            {
+                m_tempChBuf.AppendAscii(reinterpret_cast<LPCUTF8>(p), (uint32)cch);
+                m_tempChBufSecondary.template AppendAscii<createRawString>(reinterpret_cast<LPCUTF8>(p), (uint32)cch);
+                p += cch;
+            }
+        }
+
         switch ((rawch = ch = this->ReadFirst(p, last)))
         {
         case kchRET:
@@ -1455,6 +1634,11 @@ tokens Scanner<EncodingPolicy>::SkipComment(EncodedCharPtr *pp, /* out */ bool*
 
     for (;;)
     {
+        if (EncodingPolicy::MultiUnitEncoding)
+        {
+            p += ScanPlainAsciiRun(reinterpret_cast<LPCUTF8>(p), reinterpret_cast<LPCUTF8>(last), '*', '*', '*');
+        }
+
         switch((ch = this->ReadFirst(p, last)))
         {
         case '*':
@@ -1702,6 +1886,10 @@ tokens Scanner<EncodingPolicy>::ScanCore(bool identifyKwds)
         case 0x000C:
         case 0x0020:
             Assert(chType == _C_WSP);
+            if (EncodingPolicy::MultiUnitEncoding)
+            {
+                p += ScanWhiteSpaceRun(reinterpret_cast<LPCUTF8>(p), reinterpret_cast<LPCUTF8>(last));
+            }
             continue;
 
         case '.':
@@ -1967,6 +2155,11 @@ tokens Scanner<EncodingPolicy>::ScanCore(bool identifyKwds)
                 pchT = NULL;
                 for (;;)
                 {
+                    if (EncodingPolicy::MultiUnitEncoding)
+                    {
+                        p += ScanPlainAsciiRun(reinterpret_cast<LPCUTF8>(p), reinterpret_cast<LPCUTF8>(last), '\0', '\0', '\0');
+                    }
+
                     switch ((ch = this->ReadFirst(p, last)))
                     {
                     case kchLS:         // 0x2028, classifies as new line
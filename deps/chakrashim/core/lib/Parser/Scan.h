@@ -660,6 +660,33 @@ class Scanner : public IScanner, public EncodingPolicy
             }
         }
 
+        void AppendAscii(LPCUTF8 pch, uint32 cch)
+        {
+            return AppendAscii<true>(pch, cch);
+        }
+
+        // Append a run of ASCII code units, widening each of them to an OLECHAR.
+        template<bool performAppend> void AppendAscii(LPCUTF8 pch, uint32 cch)
+        {
+            if (performAppend)
+            {
+                while (m_cchMax - m_ichCur < cch)
+                {
+                    Grow();
+                }
+
+                Assert(m_ichCur + cch <= m_cchMax);
+                __analysis_assume(m_ichCur + cch <= m_cchMax);
+
+                for (uint32 i = 0; i < cch; i++)
+                {
+                    Assert(pch[i] < 0x80);
+                    m_prgch[m_ichCur + i] = static_cast<OLECHAR>(pch[i]);
+                }
+                m_ichCur += cch;
+            }
+        }
+
     private:
         void Grow()
         {
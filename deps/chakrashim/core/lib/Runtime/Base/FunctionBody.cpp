@@ -912,27 +912,25 @@ namespace Js
     {
         Assert(this->CanBeDeferred());
 
-#if DBG
-        if (PHASE_STATS(RedeferralPhase, this))
+        // Hosts can ask how much a redeferral recovered, so account for it in all builds.
+        ThreadContext * threadContext = this->GetScriptContext()->GetThreadContext();
+        threadContext->redeferredFunctions++;
+        threadContext->recoveredBytes += sizeof(*this) + this->GetInlineCacheCount() * sizeof(InlineCache);
+        if (this->byteCodeBlock)
         {
-            ThreadContext * threadContext = this->GetScriptContext()->GetThreadContext();
-            threadContext->redeferredFunctions++;
-            threadContext->recoveredBytes += sizeof(*this) + this->GetInlineCacheCount() * sizeof(InlineCache);
-            if (this->byteCodeBlock)
+            threadContext->recoveredBytes += this->byteCodeBlock->GetLength();
+            if (this->GetAuxiliaryData())
             {
-                threadContext->recoveredBytes += this->byteCodeBlock->GetLength();
-                if (this->GetAuxiliaryData())
-                {
-                    threadContext->recoveredBytes += this->GetAuxiliaryData()->GetLength();
-                }
+                threadContext->recoveredBytes += this->GetAuxiliaryData()->GetLength();
             }
-            this->MapEntryPoints([&](int index, FunctionEntryPointInfo * info) {
-                threadContext->recoveredBytes += sizeof(info);
-            });
-
-            // TODO: Get size of polymorphic caches, jitted code, etc.
         }
+        this->MapEntryPoints([&](int index, FunctionEntryPointInfo * info) {
+            threadContext->recoveredBytes += sizeof(*info);
+        });
+
+        // TODO: Get size of polymorphic caches, jitted code, etc.
 
+#if DBG
         // We can't get here if the function is being jitted. Jitting was either completed or not begun.
         this->UnlockCounters();
 #endif
@@ -3840,6 +3838,9 @@ namespace Js
 #ifdef VTUNE_PROFILING
         VTuneChakraProfile::LogMethodNativeLoadEvent(this, entryPointInfo);
 #endif
+#if PERFMAP_TRACE_ENABLED
+        PlatformAgnostic::PerfTrace::LogMethodNativeLoadEvent(this, entryPointInfo);
+#endif
 
 #ifdef _M_ARM
         // For ARM we need to make sure that pipeline is synchronized with memory/cache for newly jitted code.
@@ -3907,6 +3908,9 @@ namespace Js
         JS_ETW(EtwTrace::LogLoopBodyLoadEvent(this, ((LoopEntryPointInfo*)entryPointInfo), ((uint16)loopNum)));
 #ifdef VTUNE_PROFILING
         VTuneChakraProfile::LogLoopBodyLoadEvent(this, ((LoopEntryPointInfo*)entryPointInfo), ((uint16)loopNum));
+#endif
+#if PERFMAP_TRACE_ENABLED
+        PlatformAgnostic::PerfTrace::LogLoopBodyLoadEvent(this, ((LoopEntryPointInfo*)entryPointInfo), ((uint16)loopNum));
 #endif
     }
 #endif
@@ -659,11 +659,16 @@ namespace Js
         Field(LoopHeader*) loopHeader;
         Field(uint) jittedLoopIterationsSinceLastBailout; // number of times the loop iterated in the jitted code before bailing out
         Field(uint) totalJittedLoopIterations; // total number of times the loop has iterated in the jitted code for this entry point for a particular invocation of the loop
+        // Set while JitStatistics are on, from scheduling the compile to the first entry (see JitStatistics::RecordOsrEntry)
+        Field(uint64) jitScheduledTime;
+        Field(uint64) jitDoneTime;
         LoopEntryPointInfo(LoopHeader* loopHeader, Js::JavascriptLibrary* library) :
             EntryPointInfo(nullptr, library, /*threadContext*/ nullptr, /*isLoopBody*/ true),
             loopHeader(loopHeader),
             jittedLoopIterationsSinceLastBailout(0),
-            totalJittedLoopIterations(0)
+            totalJittedLoopIterations(0),
+            jitScheduledTime(0),
+            jitDoneTime(0)
 #ifdef BGJIT_STATS
             ,used(false)
 #endif
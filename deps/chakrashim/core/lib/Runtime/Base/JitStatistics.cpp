@@ -0,0 +1,193 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+
+namespace Js
+{
+    static char * CopyToUtf8(LPCWSTR string)
+    {
+        char * result = nullptr;
+        if (string == nullptr || FAILED(utf8::WideStringToNarrowDynamic(string, &result)))
+        {
+            return nullptr;
+        }
+        return result;
+    }
+
+    JitStatistics::FunctionStats::FunctionStats(FunctionBody * functionBody) :
+        functionNumber(functionBody->GetFunctionNumber()),
+        name(CopyToUtf8(functionBody->GetExternalDisplayName())),
+        url(CopyToUtf8(functionBody->GetSourceName())),
+        line(functionBody->GetLineNumber()),
+        column(functionBody->GetColumnNumber()),
+        loopBodyJitCount(0),
+        loopBodyJitQueueTime(0),
+        maxLoopBodyJitQueueTime(0),
+        osrEntryCount(0),
+        osrBailOutCount(0),
+        bailOutCount(0),
+        bailOutKindCounts(&HeapAllocator::Instance),
+        rejitCount(0),
+        rejitReasonCounts(&HeapAllocator::Instance)
+    {
+    }
+
+    JitStatistics::FunctionStats::~FunctionStats()
+    {
+        free(this->name);
+        free(this->url);
+    }
+
+    JitStatistics::JitStatistics() :
+        functions(&HeapAllocator::Instance),
+        bailOutKindNames(&HeapAllocator::Instance),
+        deoptLogCount(0),
+        startTime(Now()),
+        eventThunk(nullptr),
+        eventCallback(nullptr),
+        eventCallbackState(nullptr)
+    {
+    }
+
+    JitStatistics::~JitStatistics()
+    {
+        this->Reset();
+        this->bailOutKindNames.Map([](uint, char * name)
+        {
+            HeapDeleteArray(strlen(name) + 1, name);
+        });
+    }
+
+    JitStatistics::FunctionStats *
+    JitStatistics::EnsureFunctionStats(FunctionBody * functionBody)
+    {
+        FunctionStats * stats;
+        if (!this->functions.TryGetValue(functionBody->GetFunctionNumber(), &stats))
+        {
+            stats = HeapNew(FunctionStats, functionBody);
+            this->functions.Add(stats->functionNumber, stats);
+        }
+        return stats;
+    }
+
+#if ENABLE_NATIVE_CODEGEN
+    void
+    JitStatistics::RecordOsrEntry(FunctionBody * functionBody, LoopEntryPointInfo * entryPointInfo)
+    {
+        FunctionStats * stats = this->EnsureFunctionStats(functionBody);
+        stats->osrEntryCount++;
+
+        // Only the first entry after a compile that was scheduled while the statistics were on counts
+        // as a compile.
+        if (entryPointInfo->jitScheduledTime == 0 || entryPointInfo->jitDoneTime == 0)
+        {
+            return;
+        }
+
+        uint64 queueTime = entryPointInfo->jitDoneTime > entryPointInfo->jitScheduledTime ?
+            entryPointInfo->jitDoneTime - entryPointInfo->jitScheduledTime : 0;
+        entryPointInfo->jitScheduledTime = 0;
+        entryPointInfo->jitDoneTime = 0;
+
+        stats->loopBodyJitCount++;
+        stats->loopBodyJitQueueTime += queueTime;
+        stats->maxLoopBodyJitQueueTime = max(stats->maxLoopBodyJitQueueTime, queueTime);
+
+        Event event = { EventType::LoopBodyJitted, stats, functionBody->GetLoopNumber(entryPointInfo->loopHeader), queueTime, nullptr, nullptr, true };
+        this->RaiseEvent(event);
+    }
+
+    void
+    JitStatistics::RecordBailOut(FunctionBody * functionBody, uint bailOutKind, RejitReason rejitReason, uint loopNumber)
+    {
+        FunctionStats * stats = this->EnsureFunctionStats(functionBody);
+        bool fromLoopBody = loopNumber != LoopHeader::NoLoop;
+        stats->bailOutCount++;
+        if (fromLoopBody)
+        {
+            stats->osrBailOutCount++;
+        }
+
+        uint count = 0;
+        stats->bailOutKindCounts.TryGetValue(bailOutKind, &count);
+        stats->bailOutKindCounts.Item(bailOutKind, count + 1);
+
+        if (rejitReason != RejitReason::None)
+        {
+            stats->rejitCount++;
+            count = 0;
+            stats->rejitReasonCounts.TryGetValue(static_cast<uint>(rejitReason), &count);
+            stats->rejitReasonCounts.Item(static_cast<uint>(rejitReason), count + 1);
+        }
+
+        DeoptLogEntry& entry = this->deoptLog[this->deoptLogCount % DeoptLogSize];
+        entry.time = Now();
+        entry.function = stats;
+        entry.loopNumber = loopNumber;
+        entry.bailOutKind = bailOutKind;
+        entry.rejitReason = rejitReason;
+        this->deoptLogCount++;
+
+        if (this->eventThunk != nullptr)
+        {
+            Event event = { EventType::BailOut, stats, loopNumber, 0, this->GetBailOutKindName(bailOutKind),
+                rejitReason != RejitReason::None ? GetRejitReasonName(rejitReason) : nullptr, fromLoopBody };
+            this->RaiseEvent(event);
+        }
+    }
+
+    const char *
+    JitStatistics::GetBailOutKindName(uint bailOutKind)
+    {
+        IR::BailOutKind kind = static_cast<IR::BailOutKind>(bailOutKind);
+        if (!(kind & IR::BailOutKindBits))
+        {
+            return ::GetBailOutKindName(kind);
+        }
+
+        // Names with bits are built in a static buffer that the next call overwrites.
+        char * name;
+        if (!this->bailOutKindNames.TryGetValue(bailOutKind, &name))
+        {
+            const char * combined = ::GetBailOutKindName(kind);
+            size_t length = strlen(combined) + 1;
+            name = HeapNewArray(char, length);
+            memcpy(name, combined, length);
+            this->bailOutKindNames.Add(bailOutKind, name);
+        }
+        return name;
+    }
+#endif
+
+    void
+    JitStatistics::SetEventCallback(EventCallback thunk, void * callback, void * callbackState)
+    {
+        this->eventThunk = callback != nullptr ? thunk : nullptr;
+        this->eventCallback = callback;
+        this->eventCallbackState = callbackState;
+    }
+
+    void
+    JitStatistics::RaiseEvent(const Event& event) const
+    {
+        if (this->eventThunk != nullptr)
+        {
+            this->eventThunk(event, this->eventCallback, this->eventCallbackState);
+        }
+    }
+
+    void
+    JitStatistics::Reset()
+    {
+        this->functions.Map([](uint, FunctionStats * stats)
+        {
+            HeapDelete(stats);
+        });
+        this->functions.Clear();
+
+        // The log points at the statistics just deleted.
+        this->ClearDeoptLog();
+    }
+}
@@ -0,0 +1,143 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // Per function counters of how loop bodies get JIT compiled and entered, and of the bailouts out
+    // of JIT compiled code and the rejits they cause, for hosts that want to find de-optimization
+    // storms in production. The last bailouts are also kept in order in a small ring buffer, the
+    // deopt log. A thread context only has one while its host has the statistics turned on.
+    //
+    // All of the counters are updated on the script thread. The background JIT thread only stamps
+    // the time at which a loop body finished compiling on its entry point.
+    class JitStatistics
+    {
+    public:
+        struct FunctionStats
+        {
+            uint functionNumber;
+            // UTF-8 copies, so that the statistics outlive the function.
+            char * name;
+            char * url;
+            ULONG line;
+            ULONG column;
+
+            // Loop bodies that were entered after they were compiled, and the time from scheduling
+            // their compile to the end of it, in microseconds.
+            uint loopBodyJitCount;
+            uint64 loopBodyJitQueueTime;
+            uint64 maxLoopBodyJitQueueTime;
+
+            // Entries from the interpreter into JIT compiled loop bodies, and bailouts out of them.
+            uint osrEntryCount;
+            uint osrBailOutCount;
+
+            // All bailouts, out of the function's own code and its loop bodies, by bailout kind.
+            uint bailOutCount;
+            JsUtil::BaseDictionary<uint, uint, HeapAllocator> bailOutKindCounts;
+
+            // Rejits caused by those bailouts, by reason. A function that keeps rejitting for the
+            // same reason is stuck.
+            uint rejitCount;
+            JsUtil::BaseDictionary<uint, uint, HeapAllocator> rejitReasonCounts;
+
+            FunctionStats(FunctionBody * functionBody);
+            ~FunctionStats();
+        };
+
+        enum class EventType
+        {
+            LoopBodyJitted,
+            BailOut,
+        };
+
+        struct Event
+        {
+            EventType type;
+            const FunctionStats * function;
+            uint loopNumber;
+            uint64 queueTime;       // LoopBodyJitted
+            const char * bailOutKind; // BailOut
+            const char * rejitReason; // BailOut, null if the bailout did not cause a rejit
+            bool fromLoopBody;      // BailOut
+        };
+
+        struct DeoptLogEntry
+        {
+            uint64 time;
+            const FunctionStats * function;
+            uint loopNumber;        // LoopHeader::NoLoop for bailouts out of the function's own code
+            uint bailOutKind;
+            RejitReason rejitReason;
+        };
+
+        static const uint DeoptLogSize = 256;
+
+        typedef void (*EventCallback)(const Event& event, void * callback, void * callbackState);
+
+        JitStatistics();
+        ~JitStatistics();
+
+        static uint64 Now() { return Tick::Now().ToMicroseconds(); }
+
+#if ENABLE_NATIVE_CODEGEN
+        // Called for each compiled loop body when the interpreter enters it.
+        void RecordOsrEntry(FunctionBody * functionBody, LoopEntryPointInfo * entryPointInfo);
+        // Called once the rejit the bailout causes, if any, is decided.
+        void RecordBailOut(FunctionBody * functionBody, uint bailOutKind, RejitReason rejitReason, uint loopNumber);
+#endif
+
+        void SetEventCallback(EventCallback thunk, void * callback, void * callbackState);
+        void Reset();
+
+        template <typename Fn>
+        void Map(Fn fn) const
+        {
+            this->functions.Map([&](uint, FunctionStats * stats)
+            {
+                fn(stats);
+            });
+        }
+
+        uint GetFunctionCount() const { return this->functions.Count(); }
+
+        // Maps the deopt log from the oldest entry to the newest.
+        template <typename Fn>
+        void MapDeoptLog(Fn fn) const
+        {
+            uint count = min(this->deoptLogCount, DeoptLogSize);
+            for (uint i = this->deoptLogCount - count; i < this->deoptLogCount; i++)
+            {
+                fn(this->deoptLog[i % DeoptLogSize]);
+            }
+        }
+
+        // Bailouts recorded since the last reset, including those that fell out of the deopt log.
+        uint GetDeoptCount() const { return this->deoptLogCount; }
+        void ClearDeoptLog() { this->deoptLogCount = 0; }
+        uint64 GetStartTime() const { return this->startTime; }
+
+#if ENABLE_NATIVE_CODEGEN
+        // Returns a static string; bailout kinds with extra bits share a copy owned by this object.
+        const char * GetBailOutKindName(uint bailOutKind);
+#endif
+
+    private:
+        FunctionStats * EnsureFunctionStats(FunctionBody * functionBody);
+        void RaiseEvent(const Event& event) const;
+
+        JsUtil::BaseDictionary<uint, FunctionStats *, HeapAllocator> functions;
+        JsUtil::BaseDictionary<uint, char *, HeapAllocator> bailOutKindNames;
+
+        DeoptLogEntry deoptLog[DeoptLogSize];
+        uint deoptLogCount;
+        uint64 startTime;
+
+        EventCallback eventThunk;
+        void * eventCallback;
+        void * eventCallbackState;
+    };
+}
@@ -50,3 +50,18 @@ void WritePerfHint(PerfHints hint, Js::FunctionBody * functionBody, uint byteCod
         Output::Flush();
     }
 }
+
+// Reports the hint at the current statement of the innermost script function on the stack, for hints raised by the runtime
+void WritePerfHintForCaller(PerfHints hint, Js::ScriptContext * scriptContext)
+{
+    Js::JavascriptStackWalker walker(scriptContext);
+    Js::JavascriptFunction * caller = nullptr;
+    while (walker.GetCaller(&caller))
+    {
+        if (caller != nullptr && Js::ScriptFunction::Test(caller))
+        {
+            WritePerfHint(hint, caller->GetFunctionBody(), walker.GetByteCodeOffset());
+            return;
+        }
+    }
+}
@@ -30,4 +30,5 @@ struct PerfHintItem
 extern const PerfHintItem s_perfHintContainer[];
 
 void WritePerfHint(PerfHints hint, Js::FunctionBody * functionBody, uint byteCodeOffset = Js::Constants::NoByteCodeOffset);
+void WritePerfHintForCaller(PerfHints hint, Js::ScriptContext * scriptContext);
 
@@ -15,4 +15,6 @@ PERFHINT_REASON(HeapArgumentsDueToWriteToFormals,   true, PerfHintLevels::L1,
 PERFHINT_REASON(HeapArgumentsDueToNonLocalRef,      true, PerfHintLevels::L1,      _u("Arguments object not optimized as there were some nested functions or non-local refs found in nested functions"),  _u("Scope object creation is required in this case"), _u("Check for nested functions and non-local refs inside")  )
 PERFHINT_REASON(HeapArgumentsModification,          true, PerfHintLevels::L1,      _u("Modification to arguments"),              _u("Slower lookups, high overhead in the JIT code"), _u("Avoid modification to the arguments"))
 PERFHINT_REASON(HeapArgumentsCreated,               true, PerfHintLevels::L1,      _u("Arguments object not optimized"),         _u("Slower lookups, high overhead in the JIT code"), _u("Check the usage of arguments in the function"))
-PERFHINT_REASON(PolymorphicInilineCap,              true, PerfHintLevels::L1,      _u("Function has reached polymorphic-inline cap"), _u("This function will not inline more than 4 functions for this call-site."), _u("Check the polymorphic usage of this function"))
\ No newline at end of file
+PERFHINT_REASON(PolymorphicInilineCap,              true, PerfHintLevels::L1,      _u("Function has reached polymorphic-inline cap"), _u("This function will not inline more than 4 functions for this call-site."), _u("Check the polymorphic usage of this function"))
+PERFHINT_REASON(ObjectDictionaryModeOnDelete,       true, PerfHintLevels::L1,      _u("Object switched to dictionary mode because a property was deleted"), _u("Slower property lookups, inline caches and the JIT code cannot use the object's shape"), _u("Set the property to undefined instead of deleting it, or use a Map for keyed collections"))
+PERFHINT_REASON(ObjectDictionaryModeTooManyProperties, true, PerfHintLevels::VERBOSE, _u("Object switched to dictionary mode because it has too many properties"), _u("Slower property lookups, inline caches and the JIT code cannot use the object's shape"), _u("Use a Map for objects with many distinct keys"))
\ No newline at end of file
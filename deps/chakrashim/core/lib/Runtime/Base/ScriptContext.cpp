@@ -149,6 +149,7 @@ namespace Js
         hasUsedInlineCache(false),
         hasProtoOrStoreFieldInlineCache(false),
         hasIsInstInlineCache(false),
+        hasMegamorphicInlineCacheEntry(false),
         noSpecialPropertyRegistry(this, threadContext->GetNoSpecialPropertyRegistry()),
         onlyWritablePropertyRegistry(this, threadContext->GetOnlyWritablePropertyRegistry()),
         firstInterpreterFrameReturnAddress(nullptr),
@@ -192,6 +193,10 @@ namespace Js
 #ifdef INLINE_CACHE_STATS
         , cacheDataMap(nullptr)
 #endif
+#ifdef TYPE_TRANSITION_STATS
+        , typeTransitionTreeMap(nullptr)
+        , typeTransitionSiteMap(nullptr)
+#endif
 #ifdef FIELD_ACCESS_STATS
         , fieldAccessStatsByFunctionNumber(nullptr)
 #endif
@@ -259,6 +264,7 @@ namespace Js
         convertPathToSimpleDictionaryCount = 0;
         convertSimplePathToPathCount = 0;
         convertSimpleDictionaryToDictionaryCount = 0;
+        convertSimpleDictionaryToPathCount = 0;
         convertSimpleSharedDictionaryToNonSharedCount = 0;
         convertSimpleSharedToNonSharedCount = 0;
         pathTypeHandlerCount = 0;
@@ -1013,6 +1019,7 @@ namespace Js
         Output::Print(_u("    Shared SimpleMap to non-shared %8d\n"), convertSimpleSharedDictionaryToNonSharedCount);
         Output::Print(_u("    Deferred to Map                %8d\n"), convertDeferredToDictionaryCount);
         Output::Print(_u("    SimpleMap to Map               %8d\n"), convertSimpleDictionaryToDictionaryCount);
+        Output::Print(_u("    SimpleMap to Path              %8d\n"), convertSimpleDictionaryToPathCount);
         Output::Print(_u("    Path Cache Hits                %8d\n"), cacheCount);
         Output::Print(_u("    Path Branches                  %8d\n"), branchCount);
         Output::Print(_u("    Path Promotions                %8d\n"), promoteCount);
@@ -1159,7 +1166,7 @@ namespace Js
 
             if (pActiveFuncs)
             {
-                Assert(this->GetThreadContext()->DoRedeferFunctionBodies());
+                Assert(this->GetThreadContext()->CanRedeferFunctionBodies());
                 bool doRedefer = functionBody->DoRedeferFunction(inactiveThreshold);
                 if (!doRedefer)
                 {
@@ -5101,6 +5108,23 @@ void ScriptContext::ClearEnumeratorCaches()
     DebugOnly(enumeratorCacheAllocator.CheckIsAllZero(false));
 }
 
+void ScriptContext::CacheMegamorphicLoad(Type * type, const PropertyId propertyId, const PropertyIndex slotIndex, const bool isInlineSlot)
+{
+    Assert(type->GetScriptContext() == this);
+
+    megamorphicInlineCache.Cache(type, propertyId, slotIndex, isInlineSlot);
+    hasMegamorphicInlineCacheEntry = true;
+}
+
+void ScriptContext::ClearMegamorphicInlineCache()
+{
+    if (this->hasMegamorphicInlineCacheEntry)
+    {
+        megamorphicInlineCache.Clear();
+        this->hasMegamorphicInlineCacheEntry = false;
+    }
+}
+
 #ifdef PERSISTENT_INLINE_CACHES
 void ScriptContext::ClearInlineCachesWithDeadWeakRefs()
 {
@@ -6175,6 +6199,14 @@ ScriptContext::GetJitFuncRangeCache()
         }
 #endif
 
+#ifdef TYPE_TRANSITION_STATS
+        if (PHASE_STATS1(Js::TypeTransitionPhase))
+        {
+            PrintTypeTransitionStats();
+            PrintInlineCacheStates();
+        }
+#endif
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
         if (regexStatsDatabase != 0)
             regexStatsDatabase->Print(GetRegexDebugWriter());
@@ -6459,6 +6491,259 @@ ScriptContext::GetJitFuncRangeCache()
     }
 #endif
 
+#ifdef TYPE_TRANSITION_STATS
+    void ScriptContext::LogTypeTransition(const Js::DynamicType *rootType, uint pathLength, bool isBranch)
+    {
+        if (typeTransitionTreeMap == nullptr)
+        {
+            typeTransitionTreeMap = RecyclerNew(this->recycler, TypeTransitionTreeMap, this->recycler);
+            BindReference(typeTransitionTreeMap);
+            typeTransitionSiteMap = RecyclerNew(this->recycler, TypeTransitionSiteMap, this->recycler);
+            BindReference(typeTransitionSiteMap);
+        }
+
+        TypeTransitionTreeData *treeData = nullptr;
+        if (!typeTransitionTreeMap->TryGetValue(rootType, &treeData))
+        {
+            treeData = Anew(GeneralAllocator(), TypeTransitionTreeData);
+            typeTransitionTreeMap->Item(rootType, treeData);
+        }
+        treeData->typeCount++;
+        treeData->branchCount += isBranch ? 1 : 0;
+        treeData->maxPathLength = max(treeData->maxPathLength, pathLength);
+
+        // Blame the new type on the current statement of the innermost script function
+        JavascriptStackWalker walker(this);
+        JavascriptFunction *caller = nullptr;
+        while (walker.GetCaller(&caller))
+        {
+            if (caller == nullptr || !ScriptFunction::Test(caller))
+            {
+                continue;
+            }
+
+            FunctionBody *functionBody = caller->GetFunctionBody();
+            uint byteCodeOffset = walker.GetByteCodeOffset();
+
+            TypeTransitionSiteList *sites = nullptr;
+            if (!typeTransitionSiteMap->TryGetValue(functionBody, &sites))
+            {
+                sites = Anew(GeneralAllocator(), TypeTransitionSiteList, GeneralAllocator());
+                typeTransitionSiteMap->Item(functionBody, sites);
+            }
+
+            for (int i = 0; i < sites->Count(); i++)
+            {
+                TypeTransitionSiteData &site = sites->Item(i);
+                if (site.rootType == rootType && site.byteCodeOffset == byteCodeOffset)
+                {
+                    site.typeCount++;
+                    site.branchCount += isBranch ? 1 : 0;
+                    return;
+                }
+            }
+
+            TypeTransitionSiteData site = { rootType, byteCodeOffset, 1, isBranch ? 1u : 0u };
+            sites->Add(site);
+            return;
+        }
+    }
+
+    static void PrintFunctionLocation(FunctionBody *functionBody, uint byteCodeOffset)
+    {
+        ULONG lineNumber = functionBody->GetLineNumber();
+        LONG columnNumber = functionBody->GetColumnNumber();
+        if (byteCodeOffset != Constants::NoByteCodeOffset)
+        {
+            functionBody->GetLineCharOffset(byteCodeOffset, &lineNumber, &columnNumber, false /*canAllocateLineCache*/);
+
+            // returned values are 0-based. Adjusting.
+            lineNumber++;
+            columnNumber++;
+        }
+
+        char16 shortName[255];
+        FunctionBody::GetShortNameFromUrl(functionBody->GetSourceName(), shortName, 255);
+        Output::Print(_u("%s [%s @ %u, %d]"), functionBody->GetExternalDisplayName(), shortName, lineNumber, columnNumber);
+    }
+
+    void ScriptContext::PrintTypeTransitionStats()
+    {
+        struct TreeEntry
+        {
+            const DynamicType *rootType;
+            TypeTransitionTreeData *data;
+        };
+        struct SiteEntry
+        {
+            FunctionBody *functionBody;
+            TypeTransitionSiteData *data;
+        };
+
+        const int maxCount = max(CONFIG_FLAG(TypeTransitionStatsCount), 0);
+        const int treeCount = typeTransitionTreeMap != nullptr ? typeTransitionTreeMap->Count() : 0;
+        ArenaAllocator *alloc = GeneralAllocator();
+
+        if (treeCount == 0)
+        {
+            Output::Print(_u("Type transition trees: 0, types created: 0\n"));
+            return;
+        }
+
+        uint typeCount = 0;
+        TreeEntry *trees = AnewArray(alloc, TreeEntry, treeCount);
+        for (int i = 0; i < treeCount; i++)
+        {
+            trees[i].rootType = typeTransitionTreeMap->GetKeyAt(i);
+            trees[i].data = typeTransitionTreeMap->GetValueAt(i);
+            typeCount += trees[i].data->typeCount;
+        }
+
+        Output::Print(_u("Type transition trees: %d, types created: %u\n"), treeCount, typeCount);
+        Output::Print(_u("    Types Branches   Length  Root type\n"));
+
+        // List the biggest trees first, each with the statements that created the most types in it
+        for (int i = 0; i < treeCount && i < maxCount; i++)
+        {
+            for (int j = i + 1; j < treeCount; j++)
+            {
+                if (trees[j].data->typeCount > trees[i].data->typeCount)
+                {
+                    TreeEntry temp = trees[i];
+                    trees[i] = trees[j];
+                    trees[j] = temp;
+                }
+            }
+
+            const DynamicType *rootType = trees[i].rootType;
+            TypeTransitionTreeData *treeData = trees[i].data;
+            RecyclableObject *prototype = rootType->GetPrototype();
+            Output::Print(_u("  %7u %8u %8u  0x%p (prototype: %s)\n"), treeData->typeCount, treeData->branchCount, treeData->maxPathLength, rootType,
+                prototype == GetLibrary()->GetObjectPrototype() ? _u("Object.prototype") :
+                prototype == GetLibrary()->GetNull() ? _u("null") : _u("other"));
+
+            JsUtil::List<SiteEntry, ArenaAllocator> sites(alloc);
+            typeTransitionSiteMap->Map([&](FunctionBody *functionBody, TypeTransitionSiteList *siteList)
+            {
+                for (int k = 0; k < siteList->Count(); k++)
+                {
+                    TypeTransitionSiteData *site = &siteList->Item(k);
+                    if (site->rootType == rootType)
+                    {
+                        SiteEntry entry = { functionBody, site };
+                        sites.Add(entry);
+                    }
+                }
+            });
+
+            for (int j = 0; j < sites.Count() && j < maxCount; j++)
+            {
+                for (int k = j + 1; k < sites.Count(); k++)
+                {
+                    if (sites.Item(k).data->typeCount > sites.Item(j).data->typeCount)
+                    {
+                        SiteEntry temp = sites.Item(j);
+                        sites.Item(j) = sites.Item(k);
+                        sites.Item(k) = temp;
+                    }
+                }
+
+                Output::Print(_u("  %7u %8u           "), sites.Item(j).data->typeCount, sites.Item(j).data->branchCount);
+                PrintFunctionLocation(sites.Item(j).functionBody, sites.Item(j).data->byteCodeOffset);
+                Output::Print(_u("\n"));
+            }
+        }
+    }
+
+    void ScriptContext::PrintInlineCacheStates()
+    {
+        struct CacheEntry
+        {
+            FunctionBody *functionBody;
+            PropertyId propertyId;
+            uint typeCount;
+            bool isMegamorphic;
+        };
+
+        uint emptyCount = 0;
+        uint monomorphicCount = 0;
+        uint polymorphicCount = 0;
+        uint megamorphicCount = 0;
+        JsUtil::List<CacheEntry, ArenaAllocator> caches(GeneralAllocator());
+
+        // Only the plain inline caches can be polymorphic; root object caches are shared by all functions
+        this->MapFunction([&](FunctionBody *functionBody)
+        {
+            if (functionBody->GetInlineCaches() == nullptr)
+            {
+                return;
+            }
+
+            const uint plainInlineCacheEnd = functionBody->GetRootObjectLoadInlineCacheStart();
+            for (uint i = 0; i < plainInlineCacheEnd; i++)
+            {
+                PolymorphicInlineCache *polymorphicInlineCache = functionBody->GetPolymorphicInlineCache(i);
+                if (polymorphicInlineCache != nullptr)
+                {
+                    // A polymorphic cache that can't grow any more keeps evicting types
+                    CacheEntry entry = { functionBody, functionBody->GetPropertyIdFromCacheId(i),
+                        ::Math::PopCnt32(polymorphicInlineCache->GetInlineCachesFillInfo()), !polymorphicInlineCache->CanAllocateBigger() };
+                    caches.Add(entry);
+                    if (entry.isMegamorphic)
+                    {
+                        megamorphicCount++;
+                    }
+                    else
+                    {
+                        polymorphicCount++;
+                    }
+                    continue;
+                }
+
+                InlineCache *inlineCache = reinterpret_cast<InlineCache *>(functionBody->GetInlineCaches()[i]);
+                if (inlineCache == nullptr || inlineCache->IsEmpty())
+                {
+                    emptyCount++;
+                }
+                else
+                {
+                    monomorphicCount++;
+                }
+            }
+        });
+
+        Output::Print(_u("Inline caches: %u empty, %u monomorphic, %u polymorphic, %u megamorphic\n"), emptyCount, monomorphicCount, polymorphicCount, megamorphicCount);
+        if (caches.Count() == 0)
+        {
+            return;
+        }
+        Output::Print(_u("  State          Types  Property  Function\n"));
+
+        // List megamorphic caches first, then by the number of types seen
+        const int maxCount = max(CONFIG_FLAG(TypeTransitionStatsCount), 0);
+        for (int i = 0; i < caches.Count() && i < maxCount; i++)
+        {
+            for (int j = i + 1; j < caches.Count(); j++)
+            {
+                const CacheEntry &a = caches.Item(j);
+                const CacheEntry &b = caches.Item(i);
+                if (a.isMegamorphic > b.isMegamorphic || (a.isMegamorphic == b.isMegamorphic && a.typeCount > b.typeCount))
+                {
+                    CacheEntry temp = caches.Item(i);
+                    caches.Item(i) = caches.Item(j);
+                    caches.Item(j) = temp;
+                }
+            }
+
+            const CacheEntry &entry = caches.Item(i);
+            Output::Print(_u("  %-12s %7u  %-8s  "), entry.isMegamorphic ? _u("megamorphic") : _u("polymorphic"), entry.typeCount,
+                GetPropertyName(entry.propertyId)->GetBuffer());
+            PrintFunctionLocation(entry.functionBody, Constants::NoByteCodeOffset);
+            Output::Print(_u("\n"));
+        }
+    }
+#endif
+
 #ifdef FIELD_ACCESS_STATS
     void ScriptContext::RecordFieldAccessStats(FunctionBody* functionBody, FieldAccessStatsPtr fieldAccessStats)
     {
@@ -150,6 +150,30 @@ struct InlineCacheData
 
 #endif
 
+#ifdef TYPE_TRANSITION_STATS
+// Used to store the number of types created from a root type
+
+struct TypeTransitionTreeData
+{
+    uint typeCount;
+    uint branchCount;
+    uint maxPathLength;
+
+    TypeTransitionTreeData() : typeCount(0), branchCount(0), maxPathLength(0) { }
+};
+
+// Used to store the number of types created from a root type by one statement
+
+struct TypeTransitionSiteData
+{
+    const Js::DynamicType * rootType;
+    uint byteCodeOffset;
+    uint typeCount;
+    uint branchCount;
+};
+
+#endif
+
 class HostScriptContext
 {
 public:
@@ -585,6 +609,7 @@ namespace Js
         InlineCacheAllocator inlineCacheAllocator;
         CacheAllocator isInstInlineCacheAllocator;
         CacheAllocator enumeratorCacheAllocator;
+        MegamorphicInlineCache megamorphicInlineCache;
 
         ArenaAllocator* interpreterArena;
 
@@ -665,6 +690,7 @@ namespace Js
         int convertPathToSimpleDictionaryCount;
         int convertSimplePathToPathCount;
         int convertSimpleDictionaryToDictionaryCount;
+        int convertSimpleDictionaryToPathCount;
         int convertSimpleSharedDictionaryToNonSharedCount;
         int convertSimpleSharedToNonSharedCount;
         int pathTypeHandlerCount;
@@ -768,6 +794,17 @@ namespace Js
         CacheDataMap *cacheDataMap;
         void LogCacheUsage(Js::PolymorphicInlineCache *cache, bool isGet, Js::PropertyId propertyId, bool hit, bool collision);
 #endif
+#ifdef TYPE_TRANSITION_STATS
+        // These are strongly referenced dictionaries, since we want to report root types and functions that are dead.
+        typedef JsUtil::BaseDictionary<const Js::DynamicType*, TypeTransitionTreeData*, Recycler> TypeTransitionTreeMap;
+        typedef JsUtil::List<TypeTransitionSiteData, ArenaAllocator> TypeTransitionSiteList;
+        typedef JsUtil::BaseDictionary<Js::FunctionBody*, TypeTransitionSiteList*, Recycler> TypeTransitionSiteMap;
+        TypeTransitionTreeMap *typeTransitionTreeMap;
+        TypeTransitionSiteMap *typeTransitionSiteMap;
+        void LogTypeTransition(const Js::DynamicType *rootType, uint pathLength, bool isBranch);
+        void PrintTypeTransitionStats();
+        void PrintInlineCacheStates();
+#endif
 
 #ifdef FIELD_ACCESS_STATS
         typedef SList<FieldAccessStatsPtr, Recycler> FieldAccessStatsList;
@@ -884,6 +921,7 @@ namespace Js
         bool hasUsedInlineCache;
         bool hasProtoOrStoreFieldInlineCache;
         bool hasIsInstInlineCache;
+        bool hasMegamorphicInlineCacheEntry;
         bool deferredBody;
         bool isPerformingNonreentrantWork;
         bool isDiagnosticsScriptContext;   // mentions that current script context belongs to the diagnostics OM.
@@ -1377,6 +1415,7 @@ namespace Js
         InlineCacheAllocator* GetInlineCacheAllocator() { return &inlineCacheAllocator; }
         CacheAllocator* GetIsInstInlineCacheAllocator() { return &isInstInlineCacheAllocator; }
         CacheAllocator * GetEnumeratorAllocator() { return &enumeratorCacheAllocator; }
+        MegamorphicInlineCache * GetMegamorphicInlineCache() { return &megamorphicInlineCache; }
         ArenaAllocator* DynamicProfileInfoAllocator() { return &dynamicProfileInfoAllocator; }
 
 #ifdef ENABLE_SCRIPT_DEBUGGING
@@ -1554,6 +1593,8 @@ namespace Js
         void ClearInlineCaches();
         void ClearIsInstInlineCaches();
         void ClearEnumeratorCaches();
+        void CacheMegamorphicLoad(Type * type, const PropertyId propertyId, const PropertyIndex slotIndex, const bool isInlineSlot);
+        void ClearMegamorphicInlineCache();
 #ifdef PERSISTENT_INLINE_CACHES
         void ClearInlineCachesWithDeadWeakRefs();
 #endif
@@ -69,6 +69,8 @@ const Js::PropertyRecord * const ThreadContext::builtInPropertyRecords[] =
 #include "Base/JnDirectFields.h"
 };
 
+ThreadContext::PropertyMap * ThreadContext::builtInPropertyMap = nullptr;
+
 ThreadContext::RecyclableData::RecyclableData(Recycler *const recycler) :
     pendingFinallyException(nullptr),
     soErrorObject(nullptr, nullptr, nullptr, true),
@@ -112,6 +114,7 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     callDispose(true),
 #if ENABLE_NATIVE_CODEGEN
     jobProcessor(nullptr),
+    maxJitThreadCount(0),
 #endif
     interruptPoller(nullptr),
     expirableCollectModeGcCount(-1),
@@ -120,6 +123,11 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     numExpirableObjects(0),
     disableExpiration(false),
     callRootLevel(0),
+    promiseJobsPendingCallback(nullptr),
+    promiseJobsPendingCallbackState(nullptr),
+    promiseJobQueueHead(0),
+    isRunningPromiseJobs(false),
+    jitStatistics(nullptr),
     nextTypeId((Js::TypeId)Js::Constants::ReservedTypeIds),
     entryExitRecord(nullptr),
     leafInterpreterFrame(nullptr),
@@ -136,6 +144,10 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
 #endif
     polymorphicCacheState(0),
     stackProbeCount(0),
+    scriptSampleCallBack(nullptr),
+    scriptSampleCallBackContext(nullptr),
+    isScriptSamplePending(false),
+    isExecutionDisabled(false),
 #ifdef BAILOUT_INJECTION
     bailOutByteCodeLocationCount(0),
 #endif
@@ -189,13 +201,20 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     isProfilingUserCode(true),
     loopDepth(0),
     redeferralState(InitialRedeferralState),
+    isRedeferralRequested(false),
     gcSinceLastRedeferral(0),
     gcSinceCallCountsCollected(0),
+    redeferredFunctions(0),
+    recoveredBytes(0),
     tridentLoadAddress(nullptr),
     m_remoteThreadContextInfo(nullptr)
 #ifdef ENABLE_SCRIPT_DEBUGGING
     , debugManager(nullptr)
 #endif
+#ifdef INTL_ICU
+    , icuNumberFormatCache(nullptr)
+    , icuDateFormatCache(nullptr)
+#endif
 #if ENABLE_TTD
     , TTDContext(nullptr)
     , TTDExecutionInfo(nullptr)
@@ -427,6 +446,26 @@ ThreadContext::~ThreadContext()
         interruptPoller = nullptr;
     }
 
+    if (jitStatistics)
+    {
+        HeapDelete(jitStatistics);
+        jitStatistics = nullptr;
+    }
+
+#ifdef INTL_ICU
+    if (icuNumberFormatCache)
+    {
+        HeapDelete(icuNumberFormatCache);
+        icuNumberFormatCache = nullptr;
+    }
+
+    if (icuDateFormatCache)
+    {
+        HeapDelete(icuDateFormatCache);
+        icuDateFormatCache = nullptr;
+    }
+#endif
+
 #if DBG
     // ThreadContext dtor may be running on a different thread.
     // Recycler may call finalizer that free temp Arenas, which will free pages back to
@@ -530,7 +569,10 @@ ThreadContext::~ThreadContext()
 
 #if ENABLE_CONCURRENT_GC && defined(_WIN32)
         AssertOrFailFastMsg(recycler->concurrentThread == NULL, "Recycler background thread should have been shutdown before destroying Recycler.");
-        AssertOrFailFastMsg((recycler->parallelThread1.concurrentThread == NULL) && (recycler->parallelThread2.concurrentThread == NULL), "Recycler parallelThread(s) should have been shutdown before destroying Recycler.");
+        for (uint i = 0; i < _countof(recycler->parallelThreads); i++)
+        {
+            AssertOrFailFastMsg(recycler->parallelThreads[i].concurrentThread == NULL, "Recycler parallelThread(s) should have been shutdown before destroying Recycler.");
+        }
 #endif
 
         HeapDelete(recycler);
@@ -938,7 +980,8 @@ void ThreadContext::InitializePropertyMaps()
 
     try
     {
-        this->propertyMap = HeapNew(PropertyMap, &HeapAllocator::Instance, TotalNumberOfBuiltInProperties + 700);
+        // Left empty so that UncheckedAddBuiltInPropertyId can copy builtInPropertyMap into it
+        this->propertyMap = HeapNew(PropertyMap, &HeapAllocator::Instance);
         this->recyclableData->boundPropertyStrings = RecyclerNew(this->recycler, JsUtil::List<Js::PropertyRecord const*>, this->recycler);
 
         memset(propertyNamesDirect, 0, 128*sizeof(Js::PropertyRecord *));
@@ -967,10 +1010,61 @@ void ThreadContext::InitializePropertyMaps()
 
 void ThreadContext::UncheckedAddBuiltInPropertyId()
 {
+    Assert(this->propertyMap->Count() == 0);
+    Assert(this->caseInvariantPropertySet == nullptr);
+
+#if ENABLE_TTD
+    if (this->IsRuntimeInTTDMode())
+    {
+        // The TTD log has to see every property record being added
+        for (int i = 0; i < _countof(builtInPropertyRecords); i++)
+        {
+            AddPropertyRecordInternal(builtInPropertyRecords[i]);
+        }
+        return;
+    }
+#endif
+
+    // The built-in property records are static and get the same ids in every thread context, so their
+    // part of the property map only needs to be hashed once per process. Every other thread context,
+    // e.g. the one of each worker, copies the buckets and entries instead of adding them one by one.
+    {
+        AutoCriticalSection autocs(ThreadContext::GetCriticalSection());
+        if (builtInPropertyMap == nullptr)
+        {
+            // Leave room for the properties the first scripts add, to avoid an early resize
+            PropertyMap * map = HeapNew(PropertyMap, &HeapAllocator::Instance, TotalNumberOfBuiltInProperties + 700);
+            for (int i = 0; i < _countof(builtInPropertyRecords); i++)
+            {
+                Assert(builtInPropertyRecords[i]->GetPropertyId() == map->GetNextIndex() + Js::PropertyIds::_none);
+                map->Add(builtInPropertyRecords[i]);
+            }
+            builtInPropertyMap = map;
+        }
+    }
+    this->propertyMap->Copy(builtInPropertyMap);
+
+    // Replicate what AddPropertyRecordInternal does besides adding to the map
     for (int i = 0; i < _countof(builtInPropertyRecords); i++)
     {
-        AddPropertyRecordInternal(builtInPropertyRecords[i]);
+        const Js::PropertyRecord * propertyRecord = builtInPropertyRecords[i];
+#if ENABLE_NATIVE_CODEGEN
+        if (m_jitNumericProperties && propertyRecord->IsNumeric())
+        {
+            m_jitNumericProperties->Set(propertyRecord->GetPropertyId());
+            m_jitNeedsPropertyUpdate = true;
+        }
+#endif
+        if (!propertyRecord->IsSymbol() && IsDirectPropertyName(propertyRecord->GetBuffer(), propertyRecord->GetLength()))
+        {
+            Assert(propertyRecord->IsBound());
+            Assert(propertyNamesDirect[propertyRecord->GetBuffer()[0]] == nullptr);
+            propertyNamesDirect[propertyRecord->GetBuffer()[0]] = propertyRecord;
+        }
+        Assert(propertyRecord->GetLength() == 0 || propertyRecord->IsSymbol() ||
+            FindPropertyRecord(propertyRecord->GetBuffer(), propertyRecord->GetLength()) == propertyRecord);
     }
+    Assert(GetNextPropertyId() == Js::PropertyIds::_countJSOnlyProperty);
 }
 
 bool
@@ -1167,6 +1261,64 @@ ThreadContext::AddCaseInvariantPropertyRecord(const Js::PropertyRecord * propert
     }
 }
 
+void
+ThreadContext::SetPromiseJobsPendingCallback(PromiseJobsPendingCallback callback, void * callbackState)
+{
+    if (callback != nullptr && this->recyclableData->promiseJobQueue == nullptr)
+    {
+        this->recyclableData->promiseJobQueue = RecyclerNew(this->recycler, JsUtil::List<Js::Var>, this->recycler);
+    }
+
+    this->promiseJobsPendingCallback = callback;
+    this->promiseJobsPendingCallbackState = callbackState;
+}
+
+bool
+ThreadContext::EnqueuePromiseJob(Js::Var job)
+{
+    Assert(this->IsPromiseJobQueueEnabled());
+
+    JsUtil::List<Js::Var> * queue = this->recyclableData->promiseJobQueue;
+    bool wasEmpty = queue->Count() == this->promiseJobQueueHead;
+    queue->Add(job);
+
+    // A host draining the queue runs the new job in the same drain.
+    return wasEmpty && !this->isRunningPromiseJobs;
+}
+
+Js::Var
+ThreadContext::DequeuePromiseJob()
+{
+    JsUtil::List<Js::Var> * queue = this->recyclableData->promiseJobQueue;
+    if (queue == nullptr || this->promiseJobQueueHead == queue->Count())
+    {
+        return nullptr;
+    }
+
+    Js::Var job = queue->Item(this->promiseJobQueueHead);
+    queue->Item(this->promiseJobQueueHead, nullptr);
+    if (++this->promiseJobQueueHead == queue->Count())
+    {
+        queue->Clear();
+        this->promiseJobQueueHead = 0;
+    }
+    return job;
+}
+
+void
+ThreadContext::SetJitStatisticsEnabled(bool enabled)
+{
+    if (enabled && this->jitStatistics == nullptr)
+    {
+        this->jitStatistics = HeapNew(Js::JitStatistics);
+    }
+    else if (!enabled && this->jitStatistics != nullptr)
+    {
+        HeapDelete(this->jitStatistics);
+        this->jitStatistics = nullptr;
+    }
+}
+
 void
 ThreadContext::BindPropertyRecord(const Js::PropertyRecord * propertyRecord)
 {
@@ -1380,7 +1532,7 @@ ThreadContext::GetJobProcessor()
     {
         if(bgJit && !isOptimizedForManyInstances)
         {
-            jobProcessor = HeapNew(JsUtil::BackgroundJobProcessor, GetAllocationPolicyManager(), &threadService, false /*disableParallelThreads*/);
+            jobProcessor = HeapNew(JsUtil::BackgroundJobProcessor, GetAllocationPolicyManager(), &threadService, false /*disableParallelThreads*/, maxJitThreadCount);
         }
         else
         {
@@ -1641,6 +1793,19 @@ ThreadContext::IsStackAvailable(size_t size, bool* isInterrupt)
         return true;
     }
 
+    if (stackLimit == Js::Constants::StackLimitForScriptInterrupt && !this->isExecutionDisabled)
+    {
+        // The limit was hammered to get a script sample taken, not to abort script. The sample
+        // itself is taken by ProbeStack once the probe has passed.
+        this->RestoreStackLimitForScriptSample();
+        stackLimit = this->GetStackLimitForCurrentThread();
+        stackAvailable = (sp > size && (sp - size) > stackLimit);
+        if (stackAvailable)
+        {
+            return true;
+        }
+    }
+
     if (sp <= stackLimit)
     {
         if (stackLimit == Js::Constants::StackLimitForScriptInterrupt)
@@ -1669,6 +1834,13 @@ ThreadContext::IsStackAvailableNoThrow(size_t size)
     size_t stackLimit = this->GetStackLimitForCurrentThread();
     bool stackAvailable = (sp > stackLimit) && (sp > size) && ((sp - size) > stackLimit);
 
+    if (!stackAvailable && stackLimit == Js::Constants::StackLimitForScriptInterrupt && !this->isExecutionDisabled)
+    {
+        this->RestoreStackLimitForScriptSample();
+        stackLimit = this->GetStackLimitForCurrentThread();
+        stackAvailable = (sp > stackLimit) && (sp > size) && ((sp - size) > stackLimit);
+    }
+
     FAULTINJECT_STACK_PROBE
 
     return stackAvailable;
@@ -1720,6 +1892,11 @@ ThreadContext::ProbeStackNoDispose(size_t size, Js::ScriptContext *scriptContext
         }
     }
 #endif
+
+    if (this->isScriptSamplePending)
+    {
+        this->TakeScriptSample();
+    }
 }
 
 void
@@ -1767,6 +1944,10 @@ ThreadContext::ProbeStack(size_t size, Js::RecyclableObject * obj, Js::ScriptCon
         Js::Throw::StackOverflow(scriptContext, NULL);
     }
 
+    if (this->isScriptSamplePending)
+    {
+        this->TakeScriptSample();
+    }
 }
 
 void
@@ -2608,6 +2789,8 @@ ThreadContext::PreSweepCallback()
 
     ClearIsInstInlineCaches();
 
+    ClearMegamorphicInlineCaches();
+
     ClearEquivalentTypeCaches();
 
     ClearEnumeratorCaches();
@@ -2720,6 +2903,11 @@ ThreadContext::PostSweepRedeferralCallBack()
 bool
 ThreadContext::DoTryRedeferral() const
 {
+    if (this->isRedeferralRequested)
+    {
+        return true;
+    }
+
     if (PHASE_FORCE1(Js::RedeferralPhase) || PHASE_STRESS1(Js::RedeferralPhase))
     {
         return true;
@@ -2762,7 +2950,7 @@ ThreadContext::OnScanStackCallback(void ** stackTop, size_t byteCount, void ** r
 }
 
 bool
-ThreadContext::DoRedeferFunctionBodies() const
+ThreadContext::CanRedeferFunctionBodies() const
 {
 #if ENABLE_TTD
     if (this->IsRuntimeInTTDMode())
@@ -2776,11 +2964,22 @@ ThreadContext::DoRedeferFunctionBodies() const
         return true;
     }
 
-    if (PHASE_OFF1(Js::RedeferralPhase))
+    return !PHASE_OFF1(Js::RedeferralPhase);
+}
+
+bool
+ThreadContext::DoRedeferFunctionBodies() const
+{
+    if (!this->CanRedeferFunctionBodies())
     {
         return false;
     }
 
+    if (this->isRedeferralRequested || PHASE_FORCE1(Js::RedeferralPhase) || PHASE_STRESS1(Js::RedeferralPhase))
+    {
+        return true;
+    }
+
     switch (this->redeferralState)
     {
         case InitialRedeferralState:
@@ -2841,21 +3040,55 @@ ThreadContext::GetRedeferralInactiveThreshold() const
 void
 ThreadContext::TryRedeferral()
 {
-    bool doRedefer = this->DoRedeferFunctionBodies();
+    this->RedeferFunctionBodies(this->DoRedeferFunctionBodies(), this->GetRedeferralInactiveThreshold());
+}
+
+void
+ThreadContext::RedeferInactiveFunctions(uint * redeferredFunctionCount, size_t * recoveredByteCount)
+{
+    // Unlike the checks after collections this ignores how long the runtime
+    // has been running, the host knows better when startup is over. Functions
+    // still have to be inactive since the call counts were last collected, by
+    // this or by a collection, and recompiled ones for longer.
+    this->redeferredFunctions = 0;
+    this->recoveredBytes = 0;
 
+    Recycler * recycler = this->GetRecycler();
+    if (recycler != nullptr && this->CanRedeferFunctionBodies())
+    {
+        // Function bodies that only the native stack refers to are found
+        // while a collection scans it, so redefer from one that starts now.
+#if ENABLE_CONCURRENT_GC
+        recycler->FinishConcurrent<ForceFinishCollection>();
+#endif
+        this->isRedeferralRequested = true;
+        recycler->CollectNow<CollectNowExhaustive>();
+        this->isRedeferralRequested = false;
+    }
+
+    if (redeferredFunctionCount)
+    {
+        *redeferredFunctionCount = this->redeferredFunctions;
+    }
+    if (recoveredByteCount)
+    {
+        *recoveredByteCount = this->recoveredBytes;
+    }
+}
+
+void
+ThreadContext::RedeferFunctionBodies(bool doRedefer, uint inactiveThreshold)
+{
     // Collect the set of active functions.
     ActiveFunctionSet *pActiveFuncs = nullptr;
     if (doRedefer)
     {
         pActiveFuncs = Anew(this->GetThreadAlloc(), ActiveFunctionSet, this->GetThreadAlloc());
         this->GetActiveFunctions(pActiveFuncs);
-#if DBG
         this->redeferredFunctions = 0;
         this->recoveredBytes = 0;
-#endif
     }
 
-    uint inactiveThreshold = this->GetRedeferralInactiveThreshold();
     Js::ScriptContext *scriptContext;
     for (scriptContext = GetScriptContextList(); scriptContext; scriptContext = scriptContext->next)
     {
@@ -2872,7 +3105,7 @@ ThreadContext::TryRedeferral()
 #if DBG
         if (PHASE_STATS1(Js::RedeferralPhase) && this->redeferredFunctions)
         {
-            Output::Print(_u("Redeferred: %d, Bytes: 0x%x\n"), this->redeferredFunctions, this->recoveredBytes);
+            Output::Print(_u("Redeferred: %d, Bytes: 0x%Ix\n"), this->redeferredFunctions, this->recoveredBytes);
         }
 #endif
     }
@@ -3240,6 +3473,18 @@ ThreadContext::ClearIsInstInlineCaches()
     isInstInlineCacheByFunction.ResetNoDelete();
 }
 
+void
+ThreadContext::ClearMegamorphicInlineCaches()
+{
+    // Megamorphic inline caches don't keep their types alive, so they must be dropped before sweeping.
+    Js::ScriptContext *scriptContext = this->scriptContextList;
+    while (scriptContext != nullptr)
+    {
+        scriptContext->ClearMegamorphicInlineCache();
+        scriptContext = scriptContext->next;
+    }
+}
+
 void
 ThreadContext::ClearEnumeratorCaches()
 {
@@ -4626,15 +4871,58 @@ void ThreadContext::DisableExecution()
 {
     Assert(TestThreadContextFlag(ThreadContextFlagCanDisableExecution));
     // Hammer the stack limit with a value that will cause script abort on the next stack probe.
+    // The flag goes first so that a sample request being serviced can't restore the limit.
+    this->isExecutionDisabled = true;
     this->SetStackLimitForCurrentThread(Js::Constants::StackLimitForScriptInterrupt);
 
     return;
 }
 
+void ThreadContext::SetScriptSampleCallBack(ScriptSampleCallBackFunction callback, void * context)
+{
+    this->scriptSampleCallBackContext = context;
+    this->scriptSampleCallBack = callback;
+}
+
+void ThreadContext::RequestScriptSample()
+{
+    this->isScriptSamplePending = true;
+
+    // Hammer the stack limit the way DisableExecution does, so that jitted code, which only
+    // calls into ProbeStack when its inline check fails, stops at its next function entry.
+    this->SetStackLimitForCurrentThread(Js::Constants::StackLimitForScriptInterrupt);
+}
+
+void ThreadContext::RestoreStackLimitForScriptSample()
+{
+    Assert(this->GetStackProber());
+    this->SetStackLimitForCurrentThread(this->GetStackProber()->GetScriptStackLimit());
+
+    // DisableExecution may have run on another thread after the caller checked for it.
+    if (this->isExecutionDisabled)
+    {
+        this->SetStackLimitForCurrentThread(Js::Constants::StackLimitForScriptInterrupt);
+    }
+}
+
+void ThreadContext::TakeScriptSample()
+{
+    // Clear the request first so that a probe hit while the callback walks the stack
+    // doesn't take the sample again.
+    this->isScriptSamplePending = false;
+
+    // Without an entry/exit record there is no script on the stack to walk.
+    if (this->scriptSampleCallBack != nullptr && this->GetScriptEntryExit() != nullptr)
+    {
+        this->scriptSampleCallBack(this->scriptSampleCallBackContext);
+    }
+}
+
 void ThreadContext::EnableExecution()
 {
     Assert(this->GetStackProber());
     // Restore the normal stack limit.
+    this->isExecutionDisabled = false;
     this->SetStackLimitForCurrentThread(this->GetStackProber()->GetScriptStackLimit());
 
     // It's possible that the host disabled execution after the script threw an exception
@@ -4708,6 +4996,28 @@ Js::DelayLoadWindowsGlobalization* ThreadContext::GetWindowsGlobalizationLibrary
 #endif // INTL_WINGLOB
 #endif
 
+#ifdef INTL_ICU
+ThreadContext::ICUNumberFormatCache* ThreadContext::GetICUNumberFormatCache()
+{
+    if (icuNumberFormatCache == nullptr)
+    {
+        icuNumberFormatCache = HeapNew(ICUNumberFormatCache);
+    }
+
+    return icuNumberFormatCache;
+}
+
+ThreadContext::ICUDateFormatCache* ThreadContext::GetICUDateFormatCache()
+{
+    if (icuDateFormatCache == nullptr)
+    {
+        icuDateFormatCache = HeapNew(ICUDateFormatCache);
+    }
+
+    return icuDateFormatCache;
+}
+#endif
+
 #ifdef ENABLE_FOUNDATION_OBJECT
 Js::WindowsFoundationAdapter* ThreadContext::GetWindowsFoundationAdapter()
 {
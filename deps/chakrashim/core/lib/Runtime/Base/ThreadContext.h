@@ -15,6 +15,7 @@ namespace Js
     typedef JsUtil::List<ReturnedValue*> ReturnedValueList;
 #endif
     class DelayedFreeArrayBuffer;
+    class JitStatistics;
 }
 
 typedef BVSparse<ArenaAllocator> ActiveFunctionSet;
@@ -192,6 +193,7 @@ enum RecyclerCollectCallBackFlags
     Collect_Wait                     = 0x04     // callback can be from another thread
 };
 typedef void (__cdecl *RecyclerCollectCallBackFunction)(void * context, RecyclerCollectCallBackFlags flags);
+typedef void (__cdecl *ScriptSampleCallBackFunction)(void * context);
 
 #ifdef ENABLE_PROJECTION
 class ExternalWeakReferenceCache
@@ -366,6 +368,8 @@ class ThreadContext sealed :
         }
     };
 
+    typedef void (CALLBACK *PromiseJobsPendingCallback)(void *callbackState);
+
     void SetCurrentThreadId(DWORD threadId) { this->currentThreadId = threadId; }
     DWORD GetCurrentThreadId() const { return this->currentThreadId; }
     void SetIsThreadBound()
@@ -604,6 +608,9 @@ class ThreadContext sealed :
 
         Field(JsUtil::List<Js::PropertyRecord const*>*) boundPropertyStrings; // Recycler allocated list of property strings that we need to strongly reference so that they're not reclaimed
 
+        // Promise jobs of all script contexts, in the order they were enqueued, while the host lets the engine run them
+        Field(JsUtil::List<Js::Var>*) promiseJobQueue;
+
         Field(SourceProfileManagersByUrlMap*) sourceProfileManagersByUrl;
 
         // Used to register recyclable data that needs to be kept alive while jitting
@@ -656,6 +663,15 @@ class ThreadContext sealed :
 
     uint callRootLevel;
 
+    // Set when the host lets the engine queue and run the promise jobs itself, see EnqueuePromiseJob.
+    PromiseJobsPendingCallback promiseJobsPendingCallback;
+    void * promiseJobsPendingCallbackState;
+    int promiseJobQueueHead;
+    bool isRunningPromiseJobs;
+
+    // Set while the host has the per function JIT statistics turned on.
+    Js::JitStatistics * jitStatistics;
+
 #if ENABLE_BACKGROUND_PAGE_FREEING
     // The thread page allocator is used by the recycler and need the background page queue
     PageAllocator::BackgroundPageQueue backgroundPageQueue;
@@ -679,6 +695,9 @@ class ThreadContext sealed :
     };
 
     static const Js::PropertyRecord * const builtInPropertyRecords[];
+    // Property map holding only builtInPropertyRecords, built by the first thread context and copied
+    // by the others. It is never modified afterwards and lives as long as the process.
+    static PropertyMap * builtInPropertyMap;
 
     PropertyNoCaseSetType * caseInvariantPropertySet;
 
@@ -699,6 +718,7 @@ class ThreadContext sealed :
         MainRedeferralState
     };
     RedeferralState redeferralState;
+    bool isRedeferralRequested;
     uint gcSinceLastRedeferral;
     uint gcSinceCallCountsCollected;
 
@@ -720,6 +740,7 @@ class ThreadContext sealed :
 
 #if ENABLE_NATIVE_CODEGEN
     JsUtil::JobProcessor *jobProcessor;
+    uint maxJitThreadCount;
     Js::Var * bailOutRegisterSaveSpace;
 #if !FLOATVAR
     CodeGenNumberThreadAllocator * codeGenNumberThreadAllocator;
@@ -753,6 +774,15 @@ class ThreadContext sealed :
     int stackProbeCount;
     // Count stack probes and poll for continuation every n probes
     static const int StackProbePollThreshold = 1000;
+
+    // A sample requested by a profiler is taken on the script thread at the next stack probe
+    ScriptSampleCallBackFunction scriptSampleCallBack;
+    void * scriptSampleCallBackContext;
+    volatile bool isScriptSamplePending;
+    // Mutable for FAULTINJECT_SCRIPT_TERMINATION, which disables execution from a const getter
+    mutable volatile bool isExecutionDisabled;
+
+    void RestoreStackLimitForScriptSample();
     EXCEPTION_POINTERS exceptionInfo;
     uint32 exceptionCode;
 
@@ -819,6 +849,17 @@ class ThreadContext sealed :
 #endif
 #endif
 
+#ifdef INTL_ICU
+public:
+    typedef PlatformAgnostic::ICUHelpers::ICUObjectCache<UNumberFormat, unum_clone, unum_close> ICUNumberFormatCache;
+    typedef PlatformAgnostic::ICUHelpers::ICUObjectCache<UDateFormat, udat_clone, udat_close> ICUDateFormatCache;
+
+private:
+    // Configured ICU formatters shared by the Intl objects and toLocaleString calls of all script contexts on this thread
+    ICUNumberFormatCache *icuNumberFormatCache;
+    ICUDateFormatCache *icuDateFormatCache;
+#endif
+
     // Number of script context attached with probe manager.
     // This counter will be used as addref when the script context is created, this way we maintain the life of diagnostic object.
     // Once no script context available , diagnostic will go away.
@@ -881,6 +922,18 @@ class ThreadContext sealed :
     bool IsInScript() const { return callRootLevel != 0; }
     uint GetCallRootLevel() const { return callRootLevel; }
 
+    void SetPromiseJobsPendingCallback(PromiseJobsPendingCallback callback, void * callbackState);
+    bool IsPromiseJobQueueEnabled() const { return promiseJobsPendingCallback != nullptr; }
+    // Returns true if the host has to be told that there are jobs to run.
+    bool EnqueuePromiseJob(Js::Var job);
+    Js::Var DequeuePromiseJob();
+    void NotifyPromiseJobsPending() { promiseJobsPendingCallback(promiseJobsPendingCallbackState); }
+    bool IsRunningPromiseJobs() const { return isRunningPromiseJobs; }
+    void SetIsRunningPromiseJobs(bool isRunning) { isRunningPromiseJobs = isRunning; }
+
+    Js::JitStatistics * GetJitStatistics() const { return jitStatistics; }
+    void SetJitStatisticsEnabled(bool enabled);
+
     PageAllocator * GetPageAllocator() { return &pageAllocator; }
 
     AllocationPolicyManager * GetAllocationPolicyManager() { return allocationPolicyManager; }
@@ -937,6 +990,11 @@ class ThreadContext sealed :
 #endif
 #endif
 
+#ifdef INTL_ICU
+    ICUNumberFormatCache *GetICUNumberFormatCache();
+    ICUDateFormatCache *GetICUDateFormatCache();
+#endif
+
     void SetAbnormalExceptionRecord(EXCEPTION_POINTERS *exceptionInfo) { this->exceptionInfo = *exceptionInfo; }
     void SetAbnormalExceptionCode(uint32 exceptionInfo) { this->exceptionCode = exceptionInfo; }
     uint32 GetAbnormalExceptionCode() const { return this->exceptionCode; }
@@ -1261,15 +1319,16 @@ class ThreadContext sealed :
 
     bool DoTryRedeferral() const;
     void TryRedeferral();
+    void RedeferFunctionBodies(bool doRedefer, uint inactiveThreshold);
+    bool CanRedeferFunctionBodies() const;
     bool DoRedeferFunctionBodies() const;
+    void RedeferInactiveFunctions(uint * redeferredFunctionCount, size_t * recoveredByteCount);
     void UpdateRedeferralState();
     uint GetRedeferralCollectionInterval() const;
     uint GetRedeferralInactiveThreshold() const;
     void GetActiveFunctions(ActiveFunctionSet * pActive);
-#if DBG
     uint redeferredFunctions;
-    uint recoveredBytes;
-#endif
+    size_t recoveredBytes;
 
     Js::ScriptEntryExitRecord * GetScriptEntryExit() const { return entryExitRecord; }
     void RegisterCodeGenRecyclableData(Js::CodeGenRecyclableData *const codeGenRecyclableData);
@@ -1450,6 +1509,7 @@ class ThreadContext sealed :
     void ClearInvalidatedUniqueGuards();
     void ClearInlineCaches();
     void ClearIsInstInlineCaches();
+    void ClearMegamorphicInlineCaches();
     void ClearEnumeratorCaches();
     void ClearEquivalentTypeCaches();
     void ClearScriptContextCaches();
@@ -1759,10 +1819,17 @@ class ThreadContext sealed :
     void SetIsScriptActive(bool isActive) { isScriptActive = isActive; }
     bool IsExecutionDisabled() const
     {
-        return this->GetStackLimitForCurrentThread() == Js::Constants::StackLimitForScriptInterrupt;
+        // A pending script sample hammers the stack limit too, so the limit alone doesn't tell.
+        return this->isExecutionDisabled;
     }
     void DisableExecution();
     void EnableExecution();
+
+    void SetScriptSampleCallBack(ScriptSampleCallBackFunction callback, void * context);
+    // May be called from any thread
+    void RequestScriptSample();
+    bool IsScriptSamplePending() const { return this->isScriptSamplePending; }
+    void TakeScriptSample();
     bool TestThreadContextFlag(ThreadContextFlags threadContextFlag) const;
     void SetThreadContextFlag(ThreadContextFlags threadContextFlag);
     void ClearThreadContextFlag(ThreadContextFlags threadContextFlag);
@@ -1815,6 +1882,18 @@ class ThreadContext sealed :
         Assert(!jobProcessor || enableBgJit == bgJit);
         bgJit = enableBgJit;
     }
+
+    // Number of background JIT workers to start, 0 for the engine default. Only takes effect before the job
+    // processor is created.
+    bool SetMaxJitThreadCount(uint threadCount)
+    {
+        if (jobProcessor)
+        {
+            return false;
+        }
+        maxJitThreadCount = threadCount;
+        return true;
+    }
 #endif
 
     void* GetJSRTRuntime() const { return jsrtRuntime; }
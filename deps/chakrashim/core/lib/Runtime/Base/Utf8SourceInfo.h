@@ -317,6 +317,11 @@ namespace Js
             return this->GetLineOffsetCache()->GetLineCount();
         }
 
+        bool HasLineOffsetCache() const
+        {
+            return this->m_lineOffsetCache != nullptr;
+        }
+
         LineOffsetCache *GetLineOffsetCache()
         {
             AssertMsg(this->m_lineOffsetCache != nullptr, "LineOffsetCache wasn't created, EnsureLineOffsetCache should have been called.");
@@ -5,6 +5,6 @@
 // NOTE: If there is a merge conflict the correct fix is to make a new GUID.
 // This file was generated with tools\update_bytecode_version.ps1
 
-// {81AEEA4B-AE4E-40C0-848F-6DB7C5F49F55}
+// {22D166B5-C3EB-4A7B-B65F-687864395D71}
 const GUID byteCodeCacheReleaseFileVersion =
-{ 0x81AEEA4B, 0xAE4E, 0x40C0, { 0x84, 0x8F, 0x6D, 0xB7, 0xC5, 0xF4, 0x9F, 0x55 } };
+{ 0x22D166B5, 0xC3EB, 0x4A7B, { 0xB6, 0x5F, 0x68, 0x78, 0x64, 0x39, 0x5D, 0x71 } };
@@ -4239,8 +4239,15 @@ class ByteCodeBufferReader
                 {
                     (*functionBody)->byteCodeBlock = nullptr;
                 }
+                else if (scriptContext->IsScriptContextInDebugMode())
+                {
+                    // Breakpoints are installed by patching the byte code, which must not write
+                    // through to the serialized buffer: hosts may pass a read-only file mapping.
+                    (*functionBody)->byteCodeBlock = ByteBlock::New(scriptContext->GetRecycler(), buffer, contentLength);
+                }
                 else
                 {
+                    // The byte code is used in place, the buffer is never written to
                     // TODO: Abstract this out to ByteBlock::New
                     (*functionBody)->byteCodeBlock = RecyclerNewLeaf(scriptContext->GetRecycler(), ByteBlock, contentLength, (byte*)buffer);
                 }
@@ -487,6 +487,8 @@ MACRO_BACKEND_ONLY(     LdWasmFunc,                 ElementSlot,    OpSideEffect
 
 MACRO_BACKEND_ONLY(     CheckWasmSignature,         Reg2,           OpSideEffect)
 MACRO_BACKEND_ONLY(     GrowWasmMemory,             Reg3,           OpSideEffect)
+MACRO_BACKEND_ONLY(     CopyWasmMemory,             Reg2,           OpSideEffect)
+MACRO_BACKEND_ONLY(     FillWasmMemory,             Reg2,           OpSideEffect)
 
 #ifndef FLOAT_VAR
 MACRO_BACKEND_ONLY(     StSlotBoxTemp,              Empty,          OpSideEffect|OpTempNumberSources)
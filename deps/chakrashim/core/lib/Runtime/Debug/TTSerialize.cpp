@@ -1697,6 +1697,8 @@ namespace TTD
 
     void BinaryFormatReader::ReadInlineCode(_Out_writes_(length) char16* code, uint32 length, bool readSeparator)
     {
+        this->ReadSeparator(readSeparator);
+
         uint32 wlen = 0;
         this->ReadBytesInto_Fixed<uint32>(wlen);
         TTDAssert(wlen == length, "Not expected string length!!!");
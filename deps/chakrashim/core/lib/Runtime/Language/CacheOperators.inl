@@ -517,6 +517,13 @@ namespace Js
         }
         Assert(!IsAccessor);
 
+        if(IsRead && !isProto && createTypePropertyCache && !PHASE_OFF1(Js::MegamorphicInlineCachePhase))
+        {
+            // The site has seen more types than its inline caches hold. Also record the load in the script context's
+            // megamorphic cache, which jitted code probes before calling the helper.
+            requestContext->CacheMegamorphicLoad(type, propertyId, propertyIndex, isInlineSlot);
+        }
+
         TypePropertyCache *typePropertyCache = type->GetPropertyCache();
         if(!typePropertyCache)
         {
@@ -7,12 +7,10 @@
 #if ENABLE_NATIVE_CODEGEN
 namespace Js
 {
-#ifdef DYNAMIC_PROFILE_STORAGE
     DynamicProfileInfo::DynamicProfileInfo()
     {
         hasFunctionBody = false;
     }
-#endif
 
     struct Allocation
     {
@@ -71,6 +69,7 @@ namespace Js
             { (uint)offsetof(DynamicProfileInfo, slotInfo), functionBody->GetProfiledSlotCount() * sizeof(ValueType) },
             { (uint)offsetof(DynamicProfileInfo, parameterInfo), functionBody->GetProfiledInParamsCount() * sizeof(ValueType) },
             { (uint)offsetof(DynamicProfileInfo, returnTypeInfo), functionBody->GetProfiledReturnTypeCount() * sizeof(ValueType) },
+            { (uint)offsetof(DynamicProfileInfo, callSiteCallCounts), functionBody->GetProfiledCallSiteCount() * sizeof(uint16) },
             { (uint)offsetof(DynamicProfileInfo, loopImplicitCallFlags), (EnableImplicitCallFlags(functionBody) ? (functionBody->GetLoopCount() * sizeof(ImplicitCallFlags)) : 0) },
             { (uint)offsetof(DynamicProfileInfo, loopFlags), functionBody->GetLoopCount() ? BVFixed::GetAllocSize(functionBody->GetLoopCount() * LoopFlags::COUNT) : 0 }
         };
@@ -557,6 +556,13 @@ namespace Js
         Assert(!DynamicProfileInfo::NeedProfileInfoList() || this->persistsAcrossScriptContexts || this->functionBody == callerBody);
 #endif
 
+        // The call count feeds the inline threshold of hot call sites. It is not serialized, so a profile loaded from
+        // the cache starts counting from zero.
+        if (this->callSiteCallCounts && this->callSiteCallCounts[callSiteId] < UINT16_MAX)
+        {
+            this->callSiteCallCounts[callSiteId]++;
+        }
+
         bool doInline = true;
         // This is a hard limit as we only use 4 bits to encode the actual count in the InlineeCallInfo
         if (calleeBody->GetAsmJsFunctionInfo()->GetArgCount() > Js::InlineeCallInfo::MaxInlineeArgoutCount)
@@ -699,6 +705,13 @@ namespace Js
         // different script context
         Assert(!DynamicProfileInfo::NeedProfileInfoList() || this->persistsAcrossScriptContexts || this->functionBody == functionBody);
 #endif
+
+        // See RecordAsmJsCallSiteInfo
+        if (this->callSiteCallCounts && this->callSiteCallCounts[callSiteId] < UINT16_MAX)
+        {
+            this->callSiteCallCounts[callSiteId]++;
+        }
+
         bool doInline = true;
         // This is a hard limit as we only use 4 bits to encode the actual count in the InlineeCallInfo
         if (actualArgCount > Js::InlineeCallInfo::MaxInlineeArgoutCount)
@@ -850,7 +863,8 @@ namespace Js
         {
             char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
 
-            Output::Print(_u("INLINING (Polymorphic): More than 4 functions at this call site \t callSiteId: %d\t calleeFunctionId: %d TopFunc %s (%s)\n"),
+            Output::Print(_u("INLINING (Polymorphic): More than %d functions at this call site \t callSiteId: %d\t calleeFunctionId: %d TopFunc %s (%s)\n"),
+                maxPolymorphicInliningSize,
                 callSiteId,
                 curFunctionId,
                 inliner->GetDisplayName(),
@@ -2076,25 +2090,23 @@ namespace Js
     }
 #endif
 
-#ifdef DYNAMIC_PROFILE_STORAGE
 #if DBG_DUMP
-    void BufferWriter::Log(DynamicProfileInfo* info)
+    void BufferWriter::Log(DynamicProfileInfo* info, FunctionBody* functionBody)
     {
-        if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, info->GetFunctionBody()->GetSourceContextId(), info->GetFunctionBody()->GetLocalFunctionId()))
+        if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, functionBody->GetSourceContextId(), functionBody->GetLocalFunctionId()))
         {
             Output::Print(_u("Saving:"));
-            info->Dump(info->GetFunctionBody());
+            info->Dump(functionBody);
         }
     }
 #endif
 
     template <typename T>
-    bool DynamicProfileInfo::Serialize(T * writer)
+    bool DynamicProfileInfo::Serialize(T * writer, FunctionBody * functionBody)
     {
 #if DBG_DUMP
-        writer->Log(this);
+        writer->Log(this, functionBody);
 #endif
-        FunctionBody * functionBody = this->GetFunctionBody();
         Js::ArgSlot paramInfoCount = functionBody->GetProfiledInParamsCount();
         if (!writer->Write(functionBody->GetLocalFunctionId())
             || !writer->Write(paramInfoCount)
@@ -2125,6 +2137,7 @@ namespace Js
             || !writer->Write(this->thisInfo)
             || !writer->Write(this->bits)
             || !writer->Write(this->m_recursiveInlineInfo)
+            || !writer->Write((BYTE)(functionBody->GetExecutionMode() == ExecutionMode::FullJit))
             || (this->loopFlags && !writer->WriteArray(this->loopFlags->GetData(), this->loopFlags->WordCount())))
         {
             return false;
@@ -2164,6 +2177,7 @@ namespace Js
         ThisInfo thisInfo;
         Bits bits;
         uint32 recursiveInlineInfo = 0;
+        BYTE wasFullJitted = 0;
 
         try
         {
@@ -2171,13 +2185,11 @@ namespace Js
 
             if (!reader->Read(functionId))
             {
-                AssertOrFailFast(false);
                 return nullptr;
             }
 
             if (!reader->Read(&paramInfoCount))
             {
-                AssertOrFailFast(false);
                 return nullptr;
             }
 
@@ -2350,7 +2362,8 @@ namespace Js
             if (!reader->Read(&implicitCallFlags) ||
                 !reader->Read(&thisInfo) ||
                 !reader->Read(&bits) ||
-                !reader->Read(&recursiveInlineInfo))
+                !reader->Read(&recursiveInlineInfo) ||
+                !reader->Read(&wasFullJitted))
             {
                 goto Error;
             }
@@ -2388,6 +2401,7 @@ namespace Js
             dynamicProfileInfo->fldInfo = fldInfo;
             dynamicProfileInfo->slotInfo = slotInfo;
             dynamicProfileInfo->callSiteInfo = callSiteInfo;
+            dynamicProfileInfo->callSiteCallCounts = callSiteInfoCount != 0 ? RecyclerNewArrayLeafZ(recycler, uint16, callSiteInfoCount) : nullptr;
             dynamicProfileInfo->divideTypeInfo = divTypeInfo;
             dynamicProfileInfo->switchTypeInfo = switchTypeInfo;
             dynamicProfileInfo->returnTypeInfo = returnTypeInfo;
@@ -2397,6 +2411,7 @@ namespace Js
             dynamicProfileInfo->thisInfo = thisInfo;
             dynamicProfileInfo->bits = bits;
             dynamicProfileInfo->m_recursiveInlineInfo = recursiveInlineInfo;
+            dynamicProfileInfo->wasFullJitted = wasFullJitted != 0;
 
             // Fixed functions and object type data is not serialized. There is no point in trying to serialize polymorphic call site info.
             dynamicProfileInfo->ResetAllPolymorphicCallSiteInfo();
@@ -2408,15 +2423,15 @@ namespace Js
         }
 
     Error:
-        AssertOrFailFast(false);
         return nullptr;
     }
 
     // Explicit instantiations - to force the compiler to generate these - so they can be referenced from other compilation units.
     template DynamicProfileInfo * DynamicProfileInfo::Deserialize<BufferReader>(BufferReader*, Recycler*, Js::LocalFunctionId *);
-    template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(BufferSizeCounter*);
-    template bool DynamicProfileInfo::Serialize<BufferWriter>(BufferWriter*);
+    template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(BufferSizeCounter*, FunctionBody*);
+    template bool DynamicProfileInfo::Serialize<BufferWriter>(BufferWriter*, FunctionBody*);
 
+#ifdef DYNAMIC_PROFILE_STORAGE
     void DynamicProfileInfo::UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext)
     {
         // We don't clear old dynamic data here, because if a function is inlined, it will never go through the
@@ -2609,7 +2624,6 @@ IR::BailOutKind IR::EquivalentToMonoTypeCheckBailOutKind(IR::BailOutKind kind)
     }
 }
 
-#if ENABLE_DEBUG_CONFIG_OPTIONS || defined(REJIT_STATS)
 const char *const BailOutKindNames[] =
 {
 #define BAIL_OUT_KIND_LAST(n)               "" STRINGIZE(n) ""
@@ -2822,4 +2836,3 @@ const char* GetBailOutKindName(IR::BailOutKind kind)
     return name;
 }
 #endif
-#endif
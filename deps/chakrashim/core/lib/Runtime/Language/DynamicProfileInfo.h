@@ -37,10 +37,8 @@ namespace IR
     BailOutKind EquivalentToMonoTypeCheckBailOutKind(BailOutKind kind);
 }
 
-#if ENABLE_DEBUG_CONFIG_OPTIONS || defined(REJIT_STATS)
 const char *GetBailOutKindName(IR::BailOutKind kind);
 bool IsValidBailOutKindAndBits(IR::BailOutKind bailOutKind);
-#endif
 
 namespace Js
 {
@@ -467,6 +465,7 @@ namespace Js
         bool MayHaveNonBuiltinCallee(ProfileId callSiteId);
         FunctionInfo * GetCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId, bool *isConstructorCall, bool *isPolymorphicCall);
         CallSiteInfo * GetCallSiteInfo() const { return callSiteInfo; }
+        uint16 GetCallSiteCallCount(ProfileId callSiteId) const { return callSiteCallCounts ? callSiteCallCounts[callSiteId] : 0; }
         uint16 GetConstantArgInfo(ProfileId callSiteId);
         uint GetLdFldCacheIndexFromCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId);
         bool GetPolymorphicCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId, bool *isConstructorCall, __inout_ecount(functionBodyArrayLength) FunctionBody** functionBodyArray, uint functionBodyArrayLength);
@@ -510,7 +509,7 @@ namespace Js
         static FldInfoFlags FldInfoFlagsFromSlotType(SlotType slotType);
         static FldInfoFlags MergeFldInfoFlags(FldInfoFlags oldFlags, FldInfoFlags newFlags);
 
-        const static uint maxPolymorphicInliningSize = 4;
+        const static uint maxPolymorphicInliningSize = 8;
 
 #if DBG_DUMP
         static void DumpScriptContext(ScriptContext * scriptContext);
@@ -534,6 +533,7 @@ namespace Js
         Field(DynamicProfileFunctionInfo *) dynamicProfileFunctionInfo;
         Field(CallSiteInfo *) callSiteInfo;
         Field(ValueType *) returnTypeInfo; // return type of calls for non inline call sites
+        Field(uint16 *) callSiteCallCounts; // saturating number of profiled calls per call site
         Field(ValueType *) divideTypeInfo;
         Field(ValueType *) switchTypeInfo;
         Field(LdLenInfo *) ldLenInfo;
@@ -604,6 +604,7 @@ namespace Js
         Field(bool) hasFunctionBody;  // this is likely 1, try avoid 4-byte GC force reference
         Field(BYTE) currentInlinerVersion; // Used to detect when inlining profile changes
         Field(uint16) rejitCount;
+        Field(bool) wasFullJitted; // Loaded profiles only: the function had reached full JIT when the profile was saved
 #if DBG
         Field(bool) persistsAcrossScriptContexts;
 #endif
@@ -653,15 +654,15 @@ namespace Js
 #if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
         Field(FunctionBody *) functionBody; // This will only be populated if NeedProfileInfoList is true
 #endif
-#ifdef DYNAMIC_PROFILE_STORAGE
         // Used by de-serialize
         DynamicProfileInfo();
 
         template <typename T>
         static DynamicProfileInfo * Deserialize(T * reader, Recycler* allocator, Js::LocalFunctionId * functionId);
         template <typename T>
-        bool Serialize(T * writer);
+        bool Serialize(T * writer, FunctionBody * functionBody);
 
+#ifdef DYNAMIC_PROFILE_STORAGE
         static void UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext);
 #endif
         static Js::LocalFunctionId const CallSiteMixed = (Js::LocalFunctionId)-1;
@@ -909,6 +910,7 @@ namespace Js
         static bool IsCallSiteNoInfo(Js::LocalFunctionId functionId) { return functionId == CallSiteNoInfo; }
         int IncRejitCount() { return this->rejitCount++; }
         int GetRejitCount() { return this->rejitCount; }
+        bool WasFullJitted() const { return this->wasFullJitted; }
         void SetBailOutOffsetForLastRejit(uint32 offset) { this->bailOutOffsetForLastRejit = offset; }
         uint32 GetBailOutOffsetForLastRejit() { return this->bailOutOffsetForLastRejit; }
 
@@ -939,18 +941,20 @@ namespace Js
         }
     };
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+    // Reads a serialized profile. The buffer may come from a host (see JsLoadDynamicProfile), so running out of
+    // data makes the read fail rather than the process.
     class BufferReader
     {
     public:
         BufferReader(__in_ecount(length) char const * buffer, size_t length) : current(buffer), lengthLeft(length) {}
 
+        size_t GetLengthLeft() const { return lengthLeft; }
+
         template <typename T>
         bool Read(T * data)
         {
             if (lengthLeft < sizeof(T))
             {
-                AssertOrFailFast(false);
                 return false;
             }
             *data = *(T *)current;
@@ -976,7 +980,6 @@ namespace Js
             size_t size = sizeof(T) * len;
             if (lengthLeft < size)
             {
-                AssertOrFailFast(false);
                 return false;
             }
             memcpy_s(data, size, current, size);
@@ -1001,7 +1004,7 @@ namespace Js
         }
 
 #if DBG_DUMP
-        void Log(DynamicProfileInfo* info) {}
+        void Log(DynamicProfileInfo* info, FunctionBody* functionBody) {}
 #endif
 
         template <typename T>
@@ -1033,7 +1036,7 @@ namespace Js
         }
 
 #if DBG_DUMP
-        void Log(DynamicProfileInfo* info);
+        void Log(DynamicProfileInfo* info, FunctionBody* functionBody);
 #endif
         template <typename T>
         bool WriteArray(__in_ecount(len) T * data, size_t len)
@@ -1059,6 +1062,5 @@ namespace Js
         char * current;
         size_t lengthLeft;
     };
-#endif
 };
 #endif
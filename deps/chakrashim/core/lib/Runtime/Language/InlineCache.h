@@ -739,6 +739,58 @@ namespace Js
         void Set(Type * instanceType, JavascriptFunction * function, JavascriptBoolean * result);
     };
 
+    // Script context wide cache of local data property loads keyed by type and property id. Jitted code falls back
+    // to it at sites whose polymorphic inline cache is full, before calling the helper. Types are not kept alive by
+    // the cache, which is cleared before every sweep instead.
+    struct MegamorphicInlineCacheEntry
+    {
+        Type * type;                    // Tagged with InlineCacheAuxSlotTypeTag when the property is in the aux slots
+        PropertyId propertyId;
+        PropertyIndex slotIndex;
+#if !defined(TARGET_64)
+        // Pad to a power of two so that jitted code can index the cache with a shift
+        uint16 unused0;
+        uint32 unused1;
+#endif
+    };
+    CompileAssert(sizeof(MegamorphicInlineCacheEntry) == 16);
+
+    class MegamorphicInlineCache
+    {
+    public:
+        static const uint Size = 1024;
+
+    private:
+        MegamorphicInlineCacheEntry entries[Size];
+
+    public:
+        MegamorphicInlineCache()
+        {
+            Clear();
+        }
+
+        static uint GetEntryIndex(const Type * type, const PropertyId propertyId)
+        {
+            return ((((size_t)type) >> PolymorphicInlineCacheShift) ^ (size_t)propertyId) & (Size - 1);
+        }
+
+        void Cache(Type * type, const PropertyId propertyId, const PropertyIndex slotIndex, const bool isInlineSlot)
+        {
+            Assert(!TypeHasAuxSlotTag(type));
+
+            MegamorphicInlineCacheEntry * entry = &entries[GetEntryIndex(type, propertyId)];
+            entry->type = isInlineSlot ? type : TypeWithAuxSlotTag(type);
+            entry->propertyId = propertyId;
+            entry->slotIndex = slotIndex;
+        }
+
+        void Clear()
+        {
+            memset(entries, 0, sizeof(entries));
+        }
+    };
+    CompileAssert(MegamorphicInlineCache::Size > 0 && (MegamorphicInlineCache::Size & (MegamorphicInlineCache::Size - 1)) == 0);
+
     // Two-entry Type-indexed circular cache
     //   cache IsConcatSpreadable() result unless user-defined [@@isConcatSpreadable] exists
     class IsConcatSpreadableCache
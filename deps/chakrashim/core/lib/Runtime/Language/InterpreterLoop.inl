@@ -37,6 +37,34 @@
 #define PROFILEDOP(prof, unprof) unprof
 #endif
 
+// On Clang and GCC the main loop is threaded: the switch is reached only
+// once, after which every handler reads the next OpCode and jumps through a
+// table of label addresses (labels as values) to its handler. Each handler
+// then has its own indirect jump, which the branch predictor learns per
+// OpCode, instead of all of them sharing the single jump of the switch.
+// The debugging loops check the debugger before every OpCode and asm.js
+// has its own handlers, so those keep the switch.
+#if (defined(__clang__) || defined(__GNUC__)) && !DEBUGGING_LOOP && !defined(INTERPRETER_ASMJS)
+#define INTERPRETER_THREADED_DISPATCH 1
+#else
+#define INTERPRETER_THREADED_DISPATCH 0
+#endif
+
+// The prefix loops below always use the plain switch
+#define INTERPRETER_CASE(name) case INTERPRETER_OPCODE::name:
+#define INTERPRETER_NEXT() break
+
+#if ENABLE_TTD && !defined(INTERPRETER_ASMJS)
+//In case where we don't have a BP set at the final statemnt
+#define CHECK_REPLAY_DEBUGGER_ACTION(op) \
+        if(this->scriptContext->ShouldPerformReplayDebuggerAction() && op != INTERPRETER_OPCODE::Break) \
+        { \
+            this->scriptContext->GetThreadContext()->TTDExecutionInfo->ManageLastSourceInfoChecks(this->m_functionBody, false); \
+        }
+#else
+#define CHECK_REPLAY_DEBUGGER_ACTION(op)
+#endif
+
 //two layers of macros are necessary to get arguments to the invocation of the top level macro expanded.
 #define CONCAT_TOKENS_AGAIN(loopName, fnSuffix) loopName ## fnSuffix
 #define CONCAT_TOKENS(loopName, fnSuffix) CONCAT_TOKENS_AGAIN(loopName, fnSuffix)
@@ -183,22 +211,52 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
     // For checked builds this does mean we are incrementing 2 different counters to
     // track the ip.
     const byte* ip = m_reader.GetIP();
-    while (true)
-    {
-        INTERPRETER_OPCODE op = READ_OP(ip);
 
-#ifndef INTERPRETER_ASMJS
-#if ENABLE_TTD
-        //In case where we don't have a BP set at the final statemnt
-        if(this->scriptContext->ShouldPerformReplayDebuggerAction())
+#if INTERPRETER_THREADED_DISPATCH
+    // Filled on the first call from the same handler list as the switch,
+    // OpCodes that this loop does not handle go to the default case.
+    static void * const * const dispatchTable = ({
+        static void * table[(size_t)INTERPRETER_OPCODE::MaxByteSizedOpcodes + 1];
+        for (size_t i = 0; i < _countof(table); i++)
         {
-            if(op != INTERPRETER_OPCODE::Break)
-            {
-                this->scriptContext->GetThreadContext()->TTDExecutionInfo->ManageLastSourceInfoChecks(this->m_functionBody, false);
-            }
+            table[i] = &&ThreadedOp_Default;
         }
+#define DEF2(x, op, ...) table[(size_t)INTERPRETER_OPCODE::op] = &&ThreadedOp_##op;
+#define DEF3(x, op, ...) DEF2(x, op)
+#define DEF2_WMS(x, op, ...) DEF2(x, op)
+#define DEF3_WMS(x, op, ...) DEF2(x, op)
+#define DEF4_WMS(x, op, ...) DEF2(x, op)
+#include "InterpreterHandler.inl"
+        table[(size_t)INTERPRETER_OPCODE::Ret] = &&ThreadedOp_Ret;
+        table[(size_t)INTERPRETER_OPCODE::Yield] = &&ThreadedOp_Yield;
+        table[(size_t)INTERPRETER_OPCODE::Leave] = &&ThreadedOp_Leave;
+        table[(size_t)INTERPRETER_OPCODE::LeaveNull] = &&ThreadedOp_LeaveNull;
+        table[(size_t)INTERPRETER_OPCODE::ExtendedOpcodePrefix] = &&ThreadedOp_ExtendedOpcodePrefix;
+        table[(size_t)INTERPRETER_OPCODE::ExtendedMediumLayoutPrefix] = &&ThreadedOp_ExtendedMediumLayoutPrefix;
+        table[(size_t)INTERPRETER_OPCODE::ExtendedLargeLayoutPrefix] = &&ThreadedOp_ExtendedLargeLayoutPrefix;
+        table[(size_t)INTERPRETER_OPCODE::MediumLayoutPrefix] = &&ThreadedOp_MediumLayoutPrefix;
+        table[(size_t)INTERPRETER_OPCODE::LargeLayoutPrefix] = &&ThreadedOp_LargeLayoutPrefix;
+        table[(size_t)INTERPRETER_OPCODE::EndOfBlock] = &&ThreadedOp_EndOfBlock;
+        table[(size_t)INTERPRETER_OPCODE::Break] = &&ThreadedOp_Break;
+        table;
+    });
+
+#undef INTERPRETER_CASE
+#undef INTERPRETER_NEXT
+#define INTERPRETER_CASE(name) case INTERPRETER_OPCODE::name: ThreadedOp_##name:
+#define INTERPRETER_NEXT() \
+    { \
+        op = READ_OP(ip); \
+        CHECK_REPLAY_DEBUGGER_ACTION(op); \
+        goto *dispatchTable[(size_t)op]; \
+    }
 #endif
-#endif
+
+    while (true)
+    {
+        INTERPRETER_OPCODE op = READ_OP(ip);
+
+        CHECK_REPLAY_DEBUGGER_ACTION(op);
 
 #if DEBUGGING_LOOP
         if (this->scriptContext->GetThreadContext()->GetDebugManager()->stepController.IsActive() &&
@@ -285,10 +343,13 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
             }
         }
 SWAP_BP_FOR_OPCODE:
+#endif
+#if INTERPRETER_THREADED_DISPATCH
+        goto *dispatchTable[(size_t)op];
 #endif
         switch (op)
         {
-        case INTERPRETER_OPCODE::Ret:
+        INTERPRETER_CASE(Ret)
             {
                 //
                 // Return "Reg: 0" as the return-value.
@@ -305,7 +366,7 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
             }
 
 #ifndef INTERPRETER_ASMJS
-        case INTERPRETER_OPCODE::Yield:
+        INTERPRETER_CASE(Yield)
             {
                 m_reader.Reg2_Small(ip);
                 return GetReg(GetFunctionBody()->GetYieldRegister());
@@ -321,13 +382,13 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
 #include "InterpreterHandler.inl"
 
 #ifndef INTERPRETER_ASMJS
-            case INTERPRETER_OPCODE::Leave:
+            INTERPRETER_CASE(Leave)
                 // Return the continuation address to the helper.
                 // This tells the helper that control left the scope without completing the try/handler,
                 // which is particularly significant when executing a finally.
                 m_reader.Empty(ip);
                 return (Var)this->m_reader.GetCurrentOffset();
-            case INTERPRETER_OPCODE::LeaveNull:
+            INTERPRETER_CASE(LeaveNull)
                 // Return to the helper without specifying a continuation address,
                 // indicating that the handler completed without jumping, so exception processing
                 // should continue.
@@ -349,33 +410,33 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
 #endif
 
 #define ExtendedCase(opcode) \
-            case INTERPRETER_OPCODE::opcode: \
+            INTERPRETER_CASE(opcode) \
                 ip = PROCESS_OPCODE_FN_NAME(opcode)(ip); \
                 CHECK_SWITCH_PROFILE_MODE(); \
-                break;
+                INTERPRETER_NEXT();
             ExtendedCase(ExtendedOpcodePrefix)
             ExtendedCase(ExtendedMediumLayoutPrefix)
             ExtendedCase(ExtendedLargeLayoutPrefix)
 
-            case INTERPRETER_OPCODE::MediumLayoutPrefix:
+            INTERPRETER_CASE(MediumLayoutPrefix)
             {
                 Var yieldValue = nullptr;
                 ip = PROCESS_OPCODE_FN_NAME(MediumLayoutPrefix)(ip, yieldValue);
                 CHECK_YIELD_VALUE();
                 CHECK_SWITCH_PROFILE_MODE();
-                break;
+                INTERPRETER_NEXT();
             }
 
-            case INTERPRETER_OPCODE::LargeLayoutPrefix:
+            INTERPRETER_CASE(LargeLayoutPrefix)
             {
                 Var yieldValue = nullptr;
                 ip = PROCESS_OPCODE_FN_NAME(LargeLayoutPrefix)(ip, yieldValue);
                 CHECK_YIELD_VALUE();
                 CHECK_SWITCH_PROFILE_MODE();
-                break;
+                INTERPRETER_NEXT();
             }
 
-            case INTERPRETER_OPCODE::EndOfBlock:
+            INTERPRETER_CASE(EndOfBlock)
             {
                 // Note that at this time though ip was advanced by 'OpCode op = ReadByteOp<INTERPRETER_OPCODE>(ip)',
                 // we haven't advanced m_reader.m_currentLocation yet, thus m_reader.m_currentLocation still points to EndOfBLock,
@@ -401,7 +462,7 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
             }
 
 #ifndef INTERPRETER_ASMJS
-            case INTERPRETER_OPCODE::Break:
+            INTERPRETER_CASE(Break)
             {
 #if DEBUGGING_LOOP
                 // The reader has already advanced the IP:
@@ -488,10 +549,13 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
 #else
                 m_reader.Empty(ip);
 #endif
-                break;
+                INTERPRETER_NEXT();
             }
 #endif
             default:
+#if INTERPRETER_THREADED_DISPATCH
+            ThreadedOp_Default:
+#endif
                 // Help the C++ optimizer by declaring that the cases we
                 // have above are sufficient
                 AssertMsg(false, "dispatch to bad opcode");
@@ -512,3 +576,7 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
 #undef INTERPRETER_OPCODE
 #undef CHECK_SWITCH_PROFILE_MODE
 #undef CHECK_YIELD_VALUE
+#undef CHECK_REPLAY_DEBUGGER_ACTION
+#undef INTERPRETER_CASE
+#undef INTERPRETER_NEXT
+#undef INTERPRETER_THREADED_DISPATCH
@@ -692,6 +692,8 @@ namespace Js
         template <class T> inline void OP_StArrConstIndex( const unaligned T* playout );
         template <class T> inline void OP_LdArrAtomic    ( const unaligned T* playout );
         template <class T> inline void OP_StArrAtomic    ( const unaligned T* playout );
+        template <class T> inline void OP_MemoryCopy     ( const unaligned T* playout );
+        template <class T> inline void OP_MemoryFill     ( const unaligned T* playout );
         template<typename MemType> void WasmArrayBoundsCheck(uint64 index, uint32 byteLength);
         template<typename MemType> MemType* WasmAtomicsArrayBoundsCheck(byte* buffer, uint64 index, uint32 byteLength);
         inline Var OP_LdSlot(Var instance, int32 slotIndex);
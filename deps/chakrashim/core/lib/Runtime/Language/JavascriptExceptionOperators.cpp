@@ -1321,7 +1321,10 @@ namespace Js
 
                 JavascriptExceptionContext exceptionContext;
                 Var thrownObject = exceptionObject->GetThrownObject(nullptr);
-                WalkStackForExceptionContext(*scriptContext, exceptionContext, thrownObject, StackCrawlLimitOnThrow(thrownObject, *scriptContext), returnAddress, /*isThrownException=*/ true, resetStack);
+                // Errors are usually thrown with the stack trace captured when they were created. Only the throwing
+                // function is needed then, so don't crawl the rest of the stack or read Error.stackTraceLimit again.
+                uint64 stackCrawlLimit = KeepsStackTraceOnThrow(thrownObject, *scriptContext, resetStack) ? 0 : StackCrawlLimitOnThrow(thrownObject, *scriptContext);
+                WalkStackForExceptionContext(*scriptContext, exceptionContext, thrownObject, stackCrawlLimit, returnAddress, /*isThrownException=*/ true, resetStack);
                 exceptionObject->FillError(exceptionContext, scriptContext);
                 AddStackTraceToObject(thrownObject, exceptionContext.GetStackTrace(), *scriptContext, /*isThrownException=*/ true, resetStack);
             }
@@ -1471,6 +1474,25 @@ namespace Js
         return false;
     }
 
+    // Whether AddStackTraceToObject leaves the stack of the thrown object alone, which makes the stack trace of the throw
+    // only useful for WER and for dumping it.
+    bool JavascriptExceptionOperators::KeepsStackTraceOnThrow(Var thrownObject, ScriptContext& scriptContext, bool resetStack)
+    {
+        if (resetStack || !JavascriptError::Is(thrownObject) || CrawlStackForWER(scriptContext))
+        {
+            return false;
+        }
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        if (Configuration::Global.flags.Dump.IsEnabled(ExceptionStackTracePhase))
+        {
+            return false;
+        }
+#endif
+
+        return JavascriptError::FromVar(thrownObject)->HasProperty(PropertyIds::stack) != FALSE;
+    }
+
     void JavascriptExceptionOperators::AddStackTraceToObject(Var targetObject, JavascriptExceptionContext::StackTrace* stackTrace, ScriptContext& scriptContext, bool isThrownException, bool resetStack)
     {
         if (!stackTrace || !scriptContext.GetConfig()->IsErrorStackTraceEnabled())
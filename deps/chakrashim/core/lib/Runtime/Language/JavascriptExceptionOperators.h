@@ -138,6 +138,7 @@ namespace Js
         static void AppendExternalFrameToStackTrace(CompoundString* bs, LPCWSTR functionName, LPCWSTR fileName, ULONG lineNumber, LONG characterPosition);
         static void AppendLibraryFrameToStackTrace(CompoundString* bs, LPCWSTR functionName);
         static bool IsErrorInstance(Var thrownObject);
+        static bool KeepsStackTraceOnThrow(Var thrownObject, ScriptContext& scriptContext, bool resetStack);
 
         static bool CrawlStackForWER(Js::ScriptContext& scriptContext);
         static void DispatchExceptionToDebugger(Js::JavascriptExceptionObject * exceptionObject, ScriptContext* scriptContext);
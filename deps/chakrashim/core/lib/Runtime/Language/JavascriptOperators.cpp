@@ -1422,6 +1422,19 @@ using namespace Js;
             return RecyclerNew(scriptContext->GetRecycler(), SpreadArgument, aRight, true /*useDirectCall*/, scriptContext->GetLibrary()->GetSpreadArgumentType());
         }
 
+        // Arguments objects and arrays the check above rejects are still walked by the built-in values iterator,
+        // which only reads length and the elements. Read them directly unless that would call user code.
+        if (RecyclableObject::Is(aRight)
+            && function == scriptContext->GetLibrary()->EnsureArrayPrototypeValuesFunction()
+            && !JavascriptLibrary::ArrayIteratorPrototypeHasUserDefinedNext(scriptContext))
+        {
+            SpreadArgument * spreadArgument = SpreadArgument::TryNewFromArrayLike(RecyclableObject::UnsafeFromVar(aRight), scriptContext);
+            if (spreadArgument != nullptr)
+            {
+                return spreadArgument;
+            }
+        }
+
         ThreadContext *threadContext = scriptContext->GetThreadContext();
 
         Var iteratorVar =
@@ -315,6 +315,91 @@ namespace Js
         this->AddSavingItem(functionId, dynamicProfileInfo);
     }
 
+    template <typename T>
+    bool
+    SourceDynamicProfileManager::Serialize(T * writer)
+    {
+        // To simulate behavior of in memory profile cache - let's keep functions marked as executed if they were loaded
+        // to be so from the profile - this helps with ensure inlined functions are marked as executed.
+        if(!this->startupFunctions)
+        {
+            this->startupFunctions = const_cast<BVFixed*>(static_cast<const BVFixed*>(this->cachedStartupFunctions));
+        }
+        else if(cachedStartupFunctions && this->cachedStartupFunctions->Length() == this->startupFunctions->Length())
+        {
+            this->startupFunctions->Or(cachedStartupFunctions);
+        }
+
+        if(this->startupFunctions)
+        {
+#if DBG_DUMP
+             if(Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase))
+            {
+                Output::Print(_u("Saving: Startup functions bit vector:"));
+                this->startupFunctions->Dump();
+            }
+#endif
+
+            size_t bvSize = BVFixed::GetAllocSize(this->startupFunctions->Length()) ;
+            if (!writer->WriteArray((char *)static_cast<BVFixed*>(this->startupFunctions), bvSize)
+                || !writer->Write(this->dynamicProfileInfoMapSaving.Count()))
+            {
+                return false;
+            }
+        }
+
+        for (int i = 0; i < this->dynamicProfileInfoMapSaving.Count(); i++)
+        {
+            DynamicProfileInfo * dynamicProfileInfo = this->dynamicProfileInfoMapSaving.GetValueAt(i);
+            if (dynamicProfileInfo == nullptr || !dynamicProfileInfo->HasFunctionBody())
+            {
+                continue;
+            }
+
+            if (!dynamicProfileInfo->Serialize(writer, dynamicProfileInfo->GetFunctionBody()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void
+    SourceDynamicProfileManager::SaveToDynamicProfileStorage(char16 const * url)
+    {
+        Assert(DynamicProfileStorage::IsEnabled());
+        BufferSizeCounter counter;
+        if (!this->Serialize(&counter))
+        {
+            return;
+        }
+
+        if (counter.GetByteCount() > UINT_MAX)
+        {
+            // too big
+            return;
+        }
+
+        char * record = DynamicProfileStorage::AllocRecord(static_cast<DWORD>(counter.GetByteCount()));
+#if DBG_DUMP
+        if (PHASE_STATS1(DynamicProfilePhase))
+        {
+            Output::Print(_u("%-180s : %d bytes\n"), url, counter.GetByteCount());
+        }
+#endif
+
+        BufferWriter writer(DynamicProfileStorage::GetRecordBuffer(record), counter.GetByteCount());
+        if (!this->Serialize(&writer))
+        {
+            Assert(false);
+            DynamicProfileStorage::DeleteRecord(record);
+        }
+
+        DynamicProfileStorage::SaveRecord(url, record);
+    }
+
+#endif
+
     template <typename T>
     SourceDynamicProfileManager *
     SourceDynamicProfileManager::Deserialize(T * reader, Recycler* recycler)
@@ -322,7 +407,6 @@ namespace Js
         uint functionCount;
         if (!reader->Peek(&functionCount))
         {
-            Assert(false);
             return nullptr;
         }
 
@@ -330,7 +414,6 @@ namespace Js
         if (!reader->ReadArray(((char *)startupFunctions),
             BVFixed::GetAllocSize(functionCount)))
         {
-            Assert(false);
             return nullptr;
         }
 
@@ -338,7 +421,6 @@ namespace Js
 
         if (!reader->Read(&profileCount))
         {
-            Assert(false);
             return nullptr;
         }
 
@@ -362,98 +444,117 @@ namespace Js
             DynamicProfileInfo * dynamicProfileInfo = DynamicProfileInfo::Deserialize(reader, recycler, &functionId);
             if (dynamicProfileInfo == nullptr || functionId >= functionCount)
             {
-                Assert(false);
                 return nullptr;
             }
-            sourceDynamicProfileManager->dynamicProfileInfoMap.Add(functionId, dynamicProfileInfo);
+            sourceDynamicProfileManager->dynamicProfileInfoMap.Item(functionId, dynamicProfileInfo);
+#ifdef DYNAMIC_PROFILE_STORAGE
             sourceDynamicProfileManager->AddSavingItem(functionId, dynamicProfileInfo);
+#endif
         }
         return sourceDynamicProfileManager;
     }
 
     template <typename T>
     bool
-    SourceDynamicProfileManager::Serialize(T * writer)
+    SourceDynamicProfileManager::SerializeForHost(T * writer, ScriptContext * scriptContext, SourceContextInfo * info)
     {
-        // To simulate behavior of in memory profile cache - let's keep functions marked as executed if they were loaded
-        // to be so from the profile - this helps with ensure inlined functions are marked as executed.
-        if(!this->startupFunctions)
+        BVFixed * executedFunctions = this->startupFunctions;
+        if (executedFunctions == nullptr)
         {
-            this->startupFunctions = const_cast<BVFixed*>(static_cast<const BVFixed*>(this->cachedStartupFunctions));
+            // No function of the source has been created yet
+            return false;
         }
-        else if(cachedStartupFunctions && this->cachedStartupFunctions->Length() == this->startupFunctions->Length())
+
+        // As in Serialize, keep the functions the loaded profile marked as executed; inlined functions
+        // are never marked again.
+        if (cachedStartupFunctions && cachedStartupFunctions->Length() == executedFunctions->Length())
         {
-            this->startupFunctions->Or(cachedStartupFunctions);
+            executedFunctions->Or(cachedStartupFunctions);
         }
 
-        if(this->startupFunctions)
+        uint profileCount = 0;
+        scriptContext->MapFunction([&](FunctionBody * functionBody)
         {
-#if DBG_DUMP
-             if(Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase))
+            if (functionBody->GetSourceContextInfo() == info && functionBody->HasExecutionDynamicProfileInfo())
             {
-                Output::Print(_u("Saving: Startup functions bit vector:"));
-                this->startupFunctions->Dump();
+                profileCount++;
             }
-#endif
+        });
 
-            size_t bvSize = BVFixed::GetAllocSize(this->startupFunctions->Length()) ;
-            if (!writer->WriteArray((char *)static_cast<BVFixed*>(this->startupFunctions), bvSize)
-                || !writer->Write(this->dynamicProfileInfoMapSaving.Count()))
-            {
-                return false;
-            }
+        // Records from another build of the engine are rejected on load
+        DWORD majorVersion, minorVersion, buildDateHash = 0, buildTimeHash = 0;
+        AutoSystemInfo::GetJscriptFileVersion(&majorVersion, &minorVersion, &buildDateHash, &buildTimeHash);
+
+        if (!writer->Write(HostProfileMagic)
+            || !writer->Write(HostProfileVersion)
+            || !writer->Write(buildDateHash)
+            || !writer->Write(buildTimeHash)
+            || !writer->WriteArray((char *)executedFunctions, BVFixed::GetAllocSize(executedFunctions->Length()))
+            || !writer->Write(profileCount))
+        {
+            return false;
         }
 
-        for (int i = 0; i < this->dynamicProfileInfoMapSaving.Count(); i++)
+        bool success = true;
+        scriptContext->MapFunction([&](FunctionBody * functionBody)
         {
-            DynamicProfileInfo * dynamicProfileInfo = this->dynamicProfileInfoMapSaving.GetValueAt(i);
-            if (dynamicProfileInfo == nullptr || !dynamicProfileInfo->HasFunctionBody())
+            if (success && functionBody->GetSourceContextInfo() == info && functionBody->HasExecutionDynamicProfileInfo())
             {
-                continue;
+                success = functionBody->GetDynamicProfileInfo()->Serialize(writer, functionBody);
             }
+        });
+        return success;
+    }
 
-            if (!dynamicProfileInfo->Serialize(writer))
+    bool
+    SourceDynamicProfileManager::SaveToHostBuffer(ScriptContext * scriptContext, SourceContextInfo * info, char * buffer, size_t * bufferSize)
+    {
+        if (buffer == nullptr)
+        {
+            BufferSizeCounter counter;
+            if (!this->SerializeForHost(&counter, scriptContext, info))
             {
                 return false;
             }
+            *bufferSize = counter.GetByteCount();
+            return true;
         }
-        return true;
+
+        BufferWriter writer(buffer, *bufferSize);
+        return this->SerializeForHost(&writer, scriptContext, info);
     }
 
-    void
-    SourceDynamicProfileManager::SaveToDynamicProfileStorage(char16 const * url)
+    SourceDynamicProfileManager *
+    SourceDynamicProfileManager::LoadFromHostBuffer(char const * buffer, size_t length, Recycler * recycler)
     {
-        Assert(DynamicProfileStorage::IsEnabled());
-        BufferSizeCounter counter;
-        if (!this->Serialize(&counter))
-        {
-            return;
-        }
-
-        if (counter.GetByteCount() > UINT_MAX)
+        BufferReader reader(buffer, length);
+        DWORD magic, version, buildDateHash, buildTimeHash;
+        if (!reader.Read(&magic)
+            || !reader.Read(&version)
+            || !reader.Read(&buildDateHash)
+            || !reader.Read(&buildTimeHash)
+            || magic != HostProfileMagic
+            || version != HostProfileVersion)
         {
-            // too big
-            return;
+            return nullptr;
         }
 
-        char * record = DynamicProfileStorage::AllocRecord(static_cast<DWORD>(counter.GetByteCount()));
-#if DBG_DUMP
-        if (PHASE_STATS1(DynamicProfilePhase))
+        DWORD majorVersion, minorVersion, expectedBuildDateHash = 0, expectedBuildTimeHash = 0;
+        AutoSystemInfo::GetJscriptFileVersion(&majorVersion, &minorVersion, &expectedBuildDateHash, &expectedBuildTimeHash);
+        if (buildDateHash != expectedBuildDateHash || buildTimeHash != expectedBuildTimeHash)
         {
-            Output::Print(_u("%-180s : %d bytes\n"), url, counter.GetByteCount());
+            OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Host profile rejected, it was saved by another build\n"));
+            return nullptr;
         }
-#endif
 
-        BufferWriter writer(DynamicProfileStorage::GetRecordBuffer(record), counter.GetByteCount());
-        if (!this->Serialize(&writer))
+        // Don't allocate the bit vector for a function count the buffer can't hold
+        uint functionCount;
+        if (!reader.Peek(&functionCount) || BVFixed::GetAllocSize(functionCount) > reader.GetLengthLeft())
         {
-            Assert(false);
-            DynamicProfileStorage::DeleteRecord(record);
+            return nullptr;
         }
 
-        DynamicProfileStorage::SaveRecord(url, record);
+        return Deserialize(&reader, recycler);
     }
-
-#endif
 };
 #endif
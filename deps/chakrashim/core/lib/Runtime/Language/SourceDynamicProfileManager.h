@@ -44,6 +44,11 @@ namespace Js
         bool LoadFromProfileCache(SimpleDataCacheWrapper* dataCacheWrapper, LPCWSTR url);
         SimpleDataCacheWrapper* GetProfileCache() { return dataCacheWrapper; }
         uint GetStartupFunctionsLength() { return (this->startupFunctions ? this->startupFunctions->Length() : 0); }
+
+        // Profiles a host keeps across processes, see JsSerializeDynamicProfile and JsLoadDynamicProfile.
+        // With a null buffer only the size needed is computed.
+        bool SaveToHostBuffer(ScriptContext* scriptContext, SourceContextInfo* info, __out_bcount_opt(*bufferSize) char* buffer, size_t* bufferSize);
+        static SourceDynamicProfileManager * LoadFromHostBuffer(__in_bcount(length) char const* buffer, size_t length, Recycler* recycler);
 #ifdef DYNAMIC_PROFILE_STORAGE
         void ClearSavingData();
 #endif
@@ -62,10 +67,12 @@ namespace Js
         void SaveToDynamicProfileStorage(char16 const * url);
         void AddSavingItem(LocalFunctionId functionId, DynamicProfileInfo *info);
         template <typename T>
-        static SourceDynamicProfileManager * Deserialize(T * reader, Recycler* allocator);
-        template <typename T>
         bool Serialize(T * writer);
 #endif
+        template <typename T>
+        static SourceDynamicProfileManager * Deserialize(T * reader, Recycler* allocator);
+        template <typename T>
+        bool SerializeForHost(T * writer, ScriptContext* scriptContext, SourceContextInfo* info);
         uint SaveToProfileCache();
         bool ShouldSaveToProfileCache(SourceContextInfo* info) const;
 
@@ -80,6 +87,9 @@ namespace Js
         Field(DynamicProfileInfoMapType) dynamicProfileInfoMap;
 
         static const uint MAX_FUNCTION_COUNT = 10000;  // Consider data corrupt if there are more functions than this
+
+        static const DWORD HostProfileMagic = 0x50447343;   // "CsDP"
+        static const DWORD HostProfileVersion = 2;
     };
 };
 #endif  // ENABLE_PROFILE_INFO
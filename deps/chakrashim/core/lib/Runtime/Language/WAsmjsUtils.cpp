@@ -105,7 +105,12 @@ namespace WAsmJs
         }
 #endif
         const bool forceNative = CONFIG_ISENABLED(Js::ForceNativeFlag);
-        const uint minAsmJsInterpretRunCount = (uint)CONFIG_FLAG(MinAsmJsInterpreterRunCount);
+        // Wasm code is statically typed, so the interpreter gathers nothing that the backend needs and
+        // only serves as the baseline tier. Hand a function to the background JIT as soon as it has been
+        // called more than once; functions that only run once (module initialization) stay interpreted.
+        const uint minAsmJsInterpretRunCount = body->IsWasmFunction() ?
+            (uint)CONFIG_FLAG(MinWasmInterpreterRunCount) :
+            (uint)CONFIG_FLAG(MinAsmJsInterpreterRunCount);
         const uint maxAsmJsInterpretRunCount = (uint)CONFIG_FLAG(MaxAsmJsInterpreterRunCount);
         return forceNative || interpretedCount >= minAsmJsInterpretRunCount || interpretedCount >= maxAsmJsInterpretRunCount;
 #else
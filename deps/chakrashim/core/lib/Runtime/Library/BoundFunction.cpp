@@ -116,6 +116,42 @@ namespace Js
         return boundFunc;
     }
 
+    template <typename TValue>
+    void BoundFunction::SpliceBoundArgs(BoundFunction* boundFunction, Arguments& args, TValue* newValues)
+    {
+        const unsigned int argCount = args.Info.Count;
+        uint index = 0;
+
+        //
+        // For [[Construct]] use the newly created var instance
+        // For [[Call]] use the "this" to which bind bound it.
+        //
+        if (args.Info.Flags & CallFlags_New)
+        {
+            newValues[index++] = args[0];
+        }
+        else
+        {
+            newValues[index++] = boundFunction->boundThis;
+        }
+
+        for (uint i = 0; i < boundFunction->count; i++)
+        {
+            newValues[index++] = boundFunction->boundArgs[i];
+        }
+
+        // Copy the extra args
+        for (uint i=1; i<argCount; i++)
+        {
+            newValues[index++] = args[i];
+        }
+
+        if (args.HasExtraArg())
+        {
+            newValues[index++] = args.Values[argCount];
+        }
+    }
+
     Var BoundFunction::NewInstance(RecyclableObject* function, CallInfo callInfo, ...)
     {
         RUNTIME_ARGUMENTS(args, callInfo);
@@ -180,53 +216,38 @@ namespace Js
 
         Js::Arguments actualArgs = args;
 
+        // Number of spliced args we allow before allocating them in the recycler
+        const unsigned STACK_ARGS_THRESHOLD = 8;
+        Var stackArgs[STACK_ARGS_THRESHOLD];
+
         if (boundFunction->count > 0)
         {
-            // OACR thinks that this can change between here and the check in the for loop below
-            const unsigned int argCount = args.Info.Count;
-
             uint32 newArgCount = UInt32Math::Add(boundFunction->count, args.GetLargeArgCountWithExtraArgs());
             if (newArgCount > CallInfo::kMaxCountArgs)
             {
                 JavascriptError::ThrowRangeError(scriptContext, JSERR_ArgListTooLarge);
             }
 
-            Field(Var) *newValues = RecyclerNewArray(scriptContext->GetRecycler(), Field(Var), newArgCount);
-            uint index = 0;
-
-            //
-            // For [[Construct]] use the newly created var instance
-            // For [[Call]] use the "this" to which bind bound it.
-            //
-            if (callInfo.Flags & CallFlags_New)
+            // Bound functions usually only have a few args bound, and the spliced
+            // args array dies as soon as the call returns. Keep it on the stack,
+            // which the recycler scans anyway, unless it is large.
+            Var *newValues;
+            if (newArgCount > STACK_ARGS_THRESHOLD)
             {
-                newValues[index++] = args[0];
+                Field(Var) *heapValues = RecyclerNewArray(scriptContext->GetRecycler(), Field(Var), newArgCount);
+                SpliceBoundArgs(boundFunction, args, heapValues);
+                newValues = unsafe_write_barrier_cast<Var*>(heapValues);
             }
             else
             {
-                newValues[index++] = boundFunction->boundThis;
-            }
-
-            for (uint i = 0; i < boundFunction->count; i++)
-            {
-                newValues[index++] = boundFunction->boundArgs[i];
-            }
-
-            // Copy the extra args
-            for (uint i=1; i<argCount; i++)
-            {
-                newValues[index++] = args[i];
-            }
-
-            if (args.HasExtraArg())
-            {
-                newValues[index++] = args.Values[argCount];
+                SpliceBoundArgs(boundFunction, args, stackArgs);
+                newValues = stackArgs;
             }
 
-            actualArgs = Arguments(args.Info, unsafe_write_barrier_cast<Var*>(newValues));
-            actualArgs.Info.Count = boundFunction->count + argCount;
+            actualArgs = Arguments(args.Info, newValues);
+            actualArgs.Info.Count = boundFunction->count + args.Info.Count;
 
-            Assert(index == actualArgs.GetLargeArgCountWithExtraArgs());
+            Assert(newArgCount == actualArgs.GetLargeArgCountWithExtraArgs());
         }
         else
         {
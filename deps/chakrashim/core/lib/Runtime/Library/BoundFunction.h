@@ -15,6 +15,8 @@ namespace Js
     private:
         bool GetPropertyBuiltIns(Var originalInstance, PropertyId propertyId, Var* value, PropertyValueInfo* info, ScriptContext* requestContext, BOOL* result);
         bool SetPropertyBuiltIns(PropertyId propertyId, Var value, PropertyOperationFlags flags, PropertyValueInfo* info, BOOL* result);
+        template <typename TValue>
+        static void SpliceBoundArgs(BoundFunction* boundFunction, Arguments& args, TValue* newValues);
 
     protected:
         BoundFunction(DynamicType * type);
@@ -1065,6 +1065,9 @@ using namespace Js;
         buffer[totalCharLength] = _u('\0'); // GetSz() requires null termination
         Copy<CompoundString>(buffer, totalCharLength);
         Assert(buffer[totalCharLength] == _u('\0'));
+#ifdef PROFILE_STRINGS
+        StringProfiler::RecordFlatten(GetScriptContext(), totalCharLength);
+#endif
         Unreference();
         SetBuffer(buffer);
         LiteralStringWithPropertyStringPtr::ConvertString(this);
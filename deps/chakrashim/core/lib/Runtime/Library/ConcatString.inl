@@ -37,6 +37,9 @@ namespace Js
 
         Copy<ConcatStringType>(target, GetLength());
         target[GetLength()] = _u('\0');
+#ifdef PROFILE_STRINGS
+        StringProfiler::RecordFlatten(scriptContext, GetLength());
+#endif
 
         SetBuffer(target);
         return JavascriptString::GetSz();
@@ -148,6 +148,7 @@ namespace Js
 
     Var DataView::EntryGetInt8(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_GetInt8);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -166,10 +167,12 @@ namespace Js
 
         DataView* dataView = DataView::FromVar(args[0]);
         return dataView->template GetValue<int8>(args[1], _u("DataView.prototype.GetInt8"), FALSE);
+        JIT_HELPER_END(DataView_GetInt8);
     }
 
     Var DataView::EntryGetUint8(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_GetUint8);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -188,10 +191,12 @@ namespace Js
 
         DataView* dataView = DataView::FromVar(args[0]);
         return dataView->GetValue<uint8>(args[1], _u("DataView.prototype.GetUint8"), FALSE);
+        JIT_HELPER_END(DataView_GetUint8);
     }
 
     Var DataView::EntryGetInt16(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_GetInt16);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -215,10 +220,12 @@ namespace Js
 
         DataView* dataView = DataView::FromVar(args[0]);
         return dataView->GetValue<int16>(args[1], _u("DataView.prototype.GetInt16"), isLittleEndian);
+        JIT_HELPER_END(DataView_GetInt16);
     }
 
     Var DataView::EntryGetUint16(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_GetUint16);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -242,10 +249,12 @@ namespace Js
 
         DataView* dataView = DataView::FromVar(args[0]);
         return dataView->template GetValue<uint16>(args[1], _u("DataView.prototype.GetUint16"), isLittleEndian);
+        JIT_HELPER_END(DataView_GetUint16);
     }
 
     Var DataView::EntryGetUint32(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_GetUint32);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -269,10 +278,12 @@ namespace Js
 
         DataView* dataView = DataView::FromVar(args[0]);
         return dataView->GetValue<uint32>(args[1], _u("DataView.prototype.GetUint32"), isLittleEndian);
+        JIT_HELPER_END(DataView_GetUint32);
     }
 
     Var DataView::EntryGetInt32(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_GetInt32);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -296,10 +307,12 @@ namespace Js
 
         DataView* dataView = DataView::FromVar(args[0]);
         return dataView->GetValue<int32>(args[1], _u("DataView.prototype.GetInt32"), isLittleEndian);
+        JIT_HELPER_END(DataView_GetInt32);
     }
 
     Var DataView::EntryGetFloat32(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_GetFloat32);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -323,10 +336,12 @@ namespace Js
 
         DataView* dataView = DataView::FromVar(args[0]);
         return dataView->GetValueWithCheck<float>(args[1], _u("DataView.prototype.GetFloat32"), isLittleEndian);
+        JIT_HELPER_END(DataView_GetFloat32);
     }
 
     Var DataView::EntryGetFloat64(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_GetFloat64);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -350,10 +365,12 @@ namespace Js
 
         DataView* dataView = DataView::FromVar(args[0]);
        return dataView->GetValueWithCheck<double>(args[1], _u("DataView.prototype.GetFloat64"), isLittleEndian);
+        JIT_HELPER_END(DataView_GetFloat64);
     }
 
     Var DataView::EntrySetInt8(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_SetInt8);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -373,10 +390,12 @@ namespace Js
         int8 value = JavascriptConversion::ToInt8(args[2], scriptContext);
         dataView->SetValue<int8>(args[1], value, _u("DataView.prototype.SetInt8"));
         return scriptContext->GetLibrary()->GetUndefined();
+        JIT_HELPER_END(DataView_SetInt8);
     }
 
     Var DataView::EntrySetUint8(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_SetUint8);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -396,10 +415,12 @@ namespace Js
         uint8 value = JavascriptConversion::ToUInt8(args[2], scriptContext);
         dataView->SetValue<uint8>(args[1], value, _u("DataView.prototype.SetUint8"));
         return scriptContext->GetLibrary()->GetUndefined();
+        JIT_HELPER_END(DataView_SetUint8);
     }
 
     Var DataView::EntrySetInt16(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_SetInt16);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -424,10 +445,12 @@ namespace Js
         }
         dataView->SetValue<int16>(args[1], value, _u("DataView.prototype.SetInt16"), isLittleEndian);
         return scriptContext->GetLibrary()->GetUndefined();
+        JIT_HELPER_END(DataView_SetInt16);
     }
 
     Var DataView::EntrySetUint16(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_SetUint16);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -452,10 +475,12 @@ namespace Js
         }
         dataView->SetValue<uint16>(args[1], value, _u("DataView.prototype.SetUint16"), isLittleEndian);
         return scriptContext->GetLibrary()->GetUndefined();
+        JIT_HELPER_END(DataView_SetUint16);
     }
 
     Var DataView::EntrySetInt32(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_SetInt32);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -480,10 +505,12 @@ namespace Js
         }
         dataView->SetValue<int32>(args[1], value, _u("DataView.prototype.SetInt32"), isLittleEndian);
         return scriptContext->GetLibrary()->GetUndefined();
+        JIT_HELPER_END(DataView_SetInt32);
     }
 
     Var DataView::EntrySetUint32(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_SetUint32);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -508,10 +535,12 @@ namespace Js
         }
         dataView->SetValue<uint32>(args[1], value, _u("DataView.prototype.SetUint32"), isLittleEndian);
         return scriptContext->GetLibrary()->GetUndefined();
+        JIT_HELPER_END(DataView_SetUint32);
     }
 
     Var DataView::EntrySetFloat32(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_SetFloat32);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -536,10 +565,12 @@ namespace Js
         }
         dataView->SetValue<float>(args[1], value, _u("DataView.prototype.SetFloat32"), isLittleEndian);
         return scriptContext->GetLibrary()->GetUndefined();
+        JIT_HELPER_END(DataView_SetFloat32);
     }
 
     Var DataView::EntrySetFloat64(RecyclableObject* function, CallInfo callInfo, ...)
     {
+        JIT_HELPER_REENTRANT_HEADER(DataView_SetFloat64);
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
         ARGUMENTS(args, callInfo);
@@ -564,6 +595,7 @@ namespace Js
         }
         dataView->SetValue<double>(args[1], value, _u("DataView.prototype.SetFloat64"), isLittleEndian);
         return scriptContext->GetLibrary()->GetUndefined();
+        JIT_HELPER_END(DataView_SetFloat64);
     }
 
     Var DataView::EntryGetterBuffer(RecyclableObject* function, CallInfo callInfo, ...)
@@ -1451,6 +1451,95 @@ DEFINE_ISXLOCALEAVAILABLE(PR, uloc)
     }
 
 #ifdef INTL_ICU
+    // Builds the key that the thread's ICU formatter caches use to find an already configured formatter.
+    // Everything that is used to open or configure the formatter must be appended. Strings are length-prefixed
+    // so that adjacent values can't run into each other. If the key doesn't fit, the formatter isn't cached.
+    class ICUFormatterCacheKey
+    {
+    public:
+        static const int MaxLength = ThreadContext::ICUNumberFormatCache::MaxKeyLength;
+
+        ICUFormatterCacheKey() : length(0), overflow(false)
+        {
+
+        }
+
+        void Append(_In_count_(strLength) const char16 *str, _In_ charcount_t strLength)
+        {
+            Append(static_cast<int>(strLength));
+            if (overflow || strLength > static_cast<charcount_t>(MaxLength - length))
+            {
+                overflow = true;
+                return;
+            }
+
+            for (charcount_t i = 0; i < strLength; i++)
+            {
+                buffer[length++] = static_cast<UChar>(str[i]);
+            }
+        }
+
+        void Append(_In_ JavascriptString *str)
+        {
+            Append(str->GetSz(), str->GetLength());
+        }
+
+        void Append(_In_z_ const char *str)
+        {
+            size_t strLength = strlen(str);
+            Append(static_cast<int>(strLength));
+            if (overflow || strLength > static_cast<size_t>(MaxLength - length))
+            {
+                overflow = true;
+                return;
+            }
+
+            for (size_t i = 0; i < strLength; i++)
+            {
+                buffer[length++] = static_cast<UChar>(str[i]);
+            }
+        }
+
+        void Append(int value)
+        {
+            if (overflow || MaxLength - length < 2)
+            {
+                overflow = true;
+                return;
+            }
+
+            buffer[length++] = static_cast<UChar>(value & 0xFFFF);
+            buffer[length++] = static_cast<UChar>((value >> 16) & 0xFFFF);
+        }
+
+        bool IsValid() const { return !overflow; }
+        const UChar *GetBuffer() const { return buffer; }
+        int GetLength() const { return length; }
+
+    private:
+        UChar buffer[MaxLength];
+        int length;
+        bool overflow;
+    };
+
+    // Appends everything that SetUNumberFormatDigitOptions reads from the state object to the cache key
+    static void AppendUNumberFormatDigitOptions(ICUFormatterCacheKey &key, DynamicObject *state)
+    {
+        if (JavascriptOperators::HasProperty(state, PropertyIds::minimumSignificantDigits))
+        {
+            key.Append(1);
+            key.Append(AssertIntegerProperty(state, PropertyIds::minimumSignificantDigits));
+            key.Append(AssertIntegerProperty(state, PropertyIds::maximumSignificantDigits));
+        }
+        else
+        {
+            key.Append(0);
+            key.Append(AssertIntegerProperty(state, PropertyIds::minimumIntegerDigits));
+            key.Append(AssertIntegerProperty(state, PropertyIds::minimumFractionDigits));
+            key.Append(AssertIntegerProperty(state, PropertyIds::maximumFractionDigits));
+        }
+    }
+
     // This is used by both NumberFormat and PluralRules
     static void SetUNumberFormatDigitOptions(UNumberFormat *fmt, DynamicObject *state)
     {
@@ -1519,20 +1608,49 @@ DEFINE_ISXLOCALEAVAILABLE(PR, uloc)
 
         AssertOrFailFast(unumStyle != UNUM_IGNORE);
 
-        auto fmt = FinalizableUNumberFormat::New(scriptContext->GetRecycler(), unum_open(unumStyle, nullptr, 0, localeID, nullptr, &status));
-        ICU_ASSERT(status, true);
-
         bool groupingUsed = AssertBooleanProperty(state, PropertyIds::useGrouping);
-        unum_setAttribute(*fmt, UNUM_GROUPING_USED, groupingUsed);
 
-        unum_setAttribute(*fmt, UNUM_ROUNDING_MODE, UNUM_ROUND_HALFUP);
+        // Opening a UNumberFormat loads the locale's data, so clone one with the same configuration if this thread has already made one
+        ICUFormatterCacheKey key;
+        key.Append(static_cast<int>(unumStyle));
+        key.Append(localeID);
+        key.Append(groupingUsed ? 1 : 0);
+        AppendUNumberFormatDigitOptions(key, state);
+        if (currency != nullptr)
+        {
+            key.Append(currency);
+        }
 
-        SetUNumberFormatDigitOptions(*fmt, state);
+        ThreadContext::ICUNumberFormatCache *cache = scriptContext->GetThreadContext()->GetICUNumberFormatCache();
+        UNumberFormat *unf = key.IsValid() ? cache->Clone(key.GetBuffer(), key.GetLength(), &status) : nullptr;
+        ICU_ASSERT(status, true);
 
-        if (currency != nullptr)
+        FinalizableUNumberFormat *fmt = nullptr;
+        if (unf != nullptr)
         {
-            unum_setTextAttribute(*fmt, UNUM_CURRENCY_CODE, reinterpret_cast<const UChar *>(currency->GetSz()), currency->GetLength(), &status);
+            fmt = FinalizableUNumberFormat::New(scriptContext->GetRecycler(), unf);
+        }
+        else
+        {
+            fmt = FinalizableUNumberFormat::New(scriptContext->GetRecycler(), unum_open(unumStyle, nullptr, 0, localeID, nullptr, &status));
             ICU_ASSERT(status, true);
+
+            unum_setAttribute(*fmt, UNUM_GROUPING_USED, groupingUsed);
+
+            unum_setAttribute(*fmt, UNUM_ROUNDING_MODE, UNUM_ROUND_HALFUP);
+
+            SetUNumberFormatDigitOptions(*fmt, state);
+
+            if (currency != nullptr)
+            {
+                unum_setTextAttribute(*fmt, UNUM_CURRENCY_CODE, reinterpret_cast<const UChar *>(currency->GetSz()), currency->GetLength(), &status);
+                ICU_ASSERT(status, true);
+            }
+
+            if (key.IsValid())
+            {
+                cache->Add(key.GetBuffer(), key.GetLength(), *fmt);
+            }
         }
 
         state->SetInternalProperty(
@@ -2637,30 +2755,53 @@ DEFINE_ISXLOCALEAVAILABLE(PR, uloc)
             char localeID[ULOC_FULLNAME_CAPACITY] = { 0 };
             LangtagToLocaleID(langtag, localeID);
 
-            dtf = FinalizableUDateFormat::New(scriptContext->GetRecycler(), udat_open(
-                UDAT_PATTERN,
-                UDAT_PATTERN,
-                localeID,
-                reinterpret_cast<const UChar *>(timeZone->GetSz()),
-                timeZone->GetLength(),
-                reinterpret_cast<const UChar *>(pattern->GetSz()),
-                pattern->GetLength(),
-                &status
-            ));
+            // Date.prototype.toLocaleString creates a new state object on every call, so clone a UDateFormat
+            // with the same configuration if this thread has already made one rather than opening a new one
+            ICUFormatterCacheKey key;
+            key.Append(localeID);
+            key.Append(timeZone);
+            key.Append(pattern);
+
+            ThreadContext::ICUDateFormatCache *cache = scriptContext->GetThreadContext()->GetICUDateFormatCache();
+            UDateFormat *cachedDtf = key.IsValid() ? cache->Clone(key.GetBuffer(), key.GetLength(), &status) : nullptr;
             ICU_ASSERT(status, true);
+            if (cachedDtf != nullptr)
+            {
+                dtf = FinalizableUDateFormat::New(scriptContext->GetRecycler(), cachedDtf);
+                INTL_TRACE("Cloned UDateFormat (0x%x) from the thread cache", dtf);
+            }
+            else
+            {
+                dtf = FinalizableUDateFormat::New(scriptContext->GetRecycler(), udat_open(
+                    UDAT_PATTERN,
+                    UDAT_PATTERN,
+                    localeID,
+                    reinterpret_cast<const UChar *>(timeZone->GetSz()),
+                    timeZone->GetLength(),
+                    reinterpret_cast<const UChar *>(pattern->GetSz()),
+                    pattern->GetLength(),
+                    &status
+                ));
+                ICU_ASSERT(status, true);
 
-            // DateTimeFormat is expected to use the "proleptic Gregorian calendar", which means that the Julian calendar should never be used.
-            // To accomplish this, we can set the switchover date between julian/gregorian
-            // to the ECMAScript beginning of time, which is -8.64e15 according to ecma262 #sec-time-values-and-time-range
-            UCalendar *cal = const_cast<UCalendar *>(udat_getCalendar(*dtf));
-            ucal_setGregorianChange(cal, -8.64e15, &status);
+                // DateTimeFormat is expected to use the "proleptic Gregorian calendar", which means that the Julian calendar should never be used.
+                // To accomplish this, we can set the switchover date between julian/gregorian
+                // to the ECMAScript beginning of time, which is -8.64e15 according to ecma262 #sec-time-values-and-time-range
+                UCalendar *cal = const_cast<UCalendar *>(udat_getCalendar(*dtf));
+                ucal_setGregorianChange(cal, -8.64e15, &status);
 
-            // status can be U_UNSUPPORTED_ERROR if the calendar isn't gregorian, which
-            // there does not seem to be a way to check for ahead of time in the C API
-            AssertOrFailFastMsg(U_SUCCESS(status) || status == U_UNSUPPORTED_ERROR, ICU_ERRORMESSAGE(status));
+                // status can be U_UNSUPPORTED_ERROR if the calendar isn't gregorian, which
+                // there does not seem to be a way to check for ahead of time in the C API
+                AssertOrFailFastMsg(U_SUCCESS(status) || status == U_UNSUPPORTED_ERROR, ICU_ERRORMESSAGE(status));
 
-            // If we passed the previous check, we should reset the status to U_ZERO_ERROR (in case it was U_UNSUPPORTED_ERROR)
-            status = U_ZERO_ERROR;
+                // If we passed the previous check, we should reset the status to U_ZERO_ERROR (in case it was U_UNSUPPORTED_ERROR)
+                status = U_ZERO_ERROR;
+
+                if (key.IsValid())
+                {
+                    cache->Add(key.GetBuffer(), key.GetLength(), *dtf);
+                }
+            }
 
             INTL_TRACE("Caching new UDateFormat (0x%x) with langtag=%s, pattern=%s, timezone=%s", dtf, langtag->GetSz(), pattern->GetSz(), timeZone->GetSz());
 
@@ -69,7 +69,15 @@ namespace JSON
             }
             if (result == nullptr)
             {
-                result = parser.Parse(input);
+                uint lazyMinLength = CONFIG_FLAG(LazyJSONParseMinLength);
+                if (reviver == nullptr && lazyMinLength != 0 && input->GetLength() >= lazyMinLength)
+                {
+                    result = parser.ParseLazy(input);
+                }
+                else
+                {
+                    result = parser.Parse(input);
+                }
             }
 
     #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
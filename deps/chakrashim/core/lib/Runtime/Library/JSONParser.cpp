@@ -5,6 +5,7 @@
 #include "RuntimeLibraryPch.h"
 #include "JSON.h"
 #include "JSONParser.h"
+#include "Types/DeferredTypeHandler.h"
 
 
 using namespace Js;
@@ -46,6 +47,213 @@ namespace JSON
         return Parse(input->GetSz(), input->GetLength());
     }
 
+    Js::Var JSONParser::ParseLazy(Js::JavascriptString* input)
+    {
+        AssertMsg(reviver == nullptr, "The reviver walks the whole result, there is nothing to defer");
+
+        const char16* str = input->GetSz();
+        uint length = input->GetLength();
+        if (!this->arenaAllocatorObject)
+        {
+            this->arenaAllocatorObject = scriptContext->GetTemporaryGuestAllocator(_u("JSONParse"));
+            this->arenaAllocator = arenaAllocatorObject->GetAllocator();
+        }
+
+        // First pass: check the grammar of the whole text and find the objects
+        JSONLazyObjectEntryList entries(this->arenaAllocator);
+        m_scanner.Init(str, length, &m_token, scriptContext, str, this->arenaAllocator);
+        Scan();
+        IndexValue(&entries);
+        if (m_token.tk != tkEOF)
+        {
+            m_scanner.ThrowSyntaxError(JSERR_JsonSyntax);
+        }
+
+        if (entries.Count() == 0)
+        {
+            return Parse(str, length);
+        }
+
+        Recycler* recycler = scriptContext->GetRecycler();
+        JSONLazyObjectEntry* entryArray = RecyclerNewArrayLeaf(recycler, JSONLazyObjectEntry, entries.Count());
+        js_memcpy_s(entryArray, entries.Count() * sizeof(JSONLazyObjectEntry), entries.GetBuffer(), entries.Count() * sizeof(JSONLazyObjectEntry));
+        Js::DynamicType* objectType = Js::DynamicType::New(scriptContext, Js::TypeIds_Object, scriptContext->GetLibrary()->GetObjectPrototype(), nullptr,
+            Js::DeferredTypeHandler<JSONLazyObject::InitializeMembers>::GetDefaultInstance(), true, true);
+        this->lazyDocument = RecyclerNew(recycler, JSONLazyDocument, input, entryArray, entries.Count(), objectType);
+
+        // Second pass: build the top level value, with every object in it left lazy
+        this->nextLazyObject = 0;
+        m_scanner.Init(str, length, &m_token, scriptContext, str, this->arenaAllocator);
+        Scan();
+        Js::Var ret = ParseObject();
+        Assert(m_token.tk == tkEOF);
+        return ret;
+    }
+
+    void JSONParser::IndexValue(JSONLazyObjectEntryList* entries)
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+
+        switch (m_token.tk)
+        {
+        case tkFltCon:
+        case tkStrCon:
+        case tkTRUE:
+        case tkFALSE:
+        case tkNULL:
+            Scan();
+            return;
+
+        case tkSub:  // unary minus
+            if (Scan() != tkFltCon)
+            {
+                m_scanner.ThrowSyntaxError(JSERR_JsonBadNumber);
+            }
+            Scan();
+            return;
+
+        case tkLBrack:
+            Scan();
+            while (tkRBrack != m_token.tk)
+            {
+                IndexValue(entries);
+                if (tkComma != m_token.tk)
+                    break;
+                Scan();
+                if (tkRBrack == m_token.tk)
+                {
+                    m_scanner.ThrowSyntaxError(JSERR_JsonIllegalChar);
+                }
+            }
+            CheckCurrentToken(tkRBrack, JSERR_JsonNoRbrack);
+            return;
+
+        case tkLCurly:
+            {
+                JSONLazyObjectEntry entry;
+                entry.start = m_scanner.GetScanPosition() - 1;
+                entry.memberCount = 0;
+                int ordinal = entries->Add(entry);
+
+                Scan();
+                if (tkRCurly != m_token.tk)
+                {
+                    while (true)
+                    {
+                        if (tkStrCon != m_token.tk)
+                        {
+                            m_scanner.ThrowSyntaxError(JSERR_JsonIllegalChar);
+                        }
+                        if (Scan() != tkColon)
+                        {
+                            m_scanner.ThrowSyntaxError(JSERR_JsonNoColon);
+                        }
+                        Scan();
+                        IndexValue(entries);
+                        entry.memberCount++;
+
+                        if (tkComma != m_token.tk)
+                            break;
+                        Scan();
+                    }
+                }
+
+                if (tkRCurly != m_token.tk)
+                {
+                    m_scanner.ThrowSyntaxError(JSERR_JsonNoRcurly);
+                }
+                entry.end = m_scanner.GetScanPosition();
+                entry.next = entries->Count();
+                entries->Item(ordinal, entry);
+                Scan();
+                return;
+            }
+
+        default:
+            m_scanner.ThrowSyntaxError(JSERR_JsonSyntax);
+        }
+    }
+
+    Js::Var JSONParser::ParseLazyObject()
+    {
+        Assert(m_token.tk == tkLCurly);
+
+        const JSONLazyObjectEntry& entry = lazyDocument->GetEntry(nextLazyObject);
+        Assert(entry.start == m_scanner.GetScanPosition() - 1);
+        JSONLazyObject* object = RecyclerNew(scriptContext->GetRecycler(), JSONLazyObject, lazyDocument->GetObjectType(), lazyDocument, nextLazyObject);
+        JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(object));
+
+        // Skip over the members, they are only parsed when the object is used
+        nextLazyObject = entry.next;
+        m_scanner.currentChar = m_scanner.inputText + entry.end;
+        Scan();
+        return object;
+    }
+
+    void JSONParser::ParseLazyMembers(JSONLazyObject* object, JSONLazyDocument* document, uint ordinal)
+    {
+        Js::JavascriptString* source = document->GetSource();
+        const char16* str = source->GetSz();
+        const JSONLazyObjectEntry& entry = document->GetEntry(ordinal);
+
+        this->lazyDocument = document;
+        this->nextLazyObject = ordinal + 1;
+        m_scanner.Init(str, source->GetLength(), &m_token, scriptContext, str + entry.start, this->arenaAllocator);
+        Scan();
+        Assert(m_token.tk == tkLCurly);
+
+        // The text was validated on the first pass, so this is just "name" : value, ... up to the '}'
+        Scan();
+        while (tkRCurly != m_token.tk)
+        {
+            Assert(m_token.tk == tkStrCon);
+            Js::PropertyRecord const * propertyRecord;
+            scriptContext->GetOrAddPropertyRecord(m_scanner.GetCurrentString(), m_scanner.GetCurrentStringLen(), &propertyRecord);
+            CheckCurrentToken(tkStrCon, JSERR_JsonIllegalChar);
+            CheckCurrentToken(tkColon, JSERR_JsonNoColon);
+
+            Js::Var value = ParseObject();
+            object->SetProperty(propertyRecord->GetPropertyId(), value, PropertyOperation_None, nullptr);
+
+            if (tkComma != m_token.tk)
+                break;
+            Scan();
+        }
+
+        Assert(m_token.tk == tkRCurly);
+        Assert(this->nextLazyObject == entry.next);
+    }
+
+    bool JSONLazyObject::Is(Js::Var aValue)
+    {
+        return Js::RecyclableObject::Is(aValue) && VirtualTableInfo<JSONLazyObject>::HasVirtualTable(Js::RecyclableObject::FromVar(aValue));
+    }
+
+    bool JSONLazyObject::InitializeMembers(Js::DynamicObject* instance, Js::DeferredTypeHandlerBase* typeHandler, Js::DeferredInitializeMode mode)
+    {
+        AssertOrFailFast(JSONLazyObject::Is(instance));
+        JSONLazyObject* object = static_cast<JSONLazyObject*>(instance);
+        JSONLazyDocument* document = object->document;
+        Assert(document != nullptr);
+
+        typeHandler->Convert(instance, mode, document->GetEntry(object->ordinal).memberCount);
+
+        // alignment required because of the union in JSONParser::m_token
+        __declspec (align(8)) JSONParser parser(instance->GetScriptContext(), nullptr);
+        TryFinally([&]()
+        {
+            parser.ParseLazyMembers(object, document, object->ordinal);
+        },
+            [&](bool/*hasException*/)
+        {
+            parser.Finalizer();
+        });
+
+        // Let the source text go once every object in it is built
+        object->document = nullptr;
+        return true;
+    }
+
     Js::Var JSONParser::Walk(Js::JavascriptString* name, Js::PropertyId id, Js::Var holder, uint32 index)
     {
         AssertMsg(reviver, "JSON post parse walk with null reviver");
@@ -278,6 +486,10 @@ namespace JSON
 
         case tkLCurly:
             {
+                if (lazyDocument != nullptr)
+                {
+                    return ParseLazyObject();
+                }
 
                 // Parse an object, "{"name1" : ObjMember1, "name2" : ObjMember2, ...} "
                 if(IsCaching())
@@ -288,8 +500,25 @@ namespace JSON
                     }
                 }
 
+                //next token after '{'
+                Scan();
+
+                // An object starting with the same property as an earlier one most likely has the same members. Give it
+                // inline slots for all of them, so that it follows the type path the earlier object built from the
+                // same root and ends up with the same type, without growing its slots on the way.
+                JsonTypeCache* firstCache = nullptr;
+                uint16 inlineSlotCapacity = 0;
+                if(IsCaching() && tkStrCon == m_token.tk)
+                {
+                    firstCache = typeCacheList->LookupWithKey(Js::HashedCharacterBuffer<WCHAR>(m_scanner.GetCurrentString(), m_scanner.GetCurrentStringLen()), nullptr);
+                    if(firstCache)
+                    {
+                        inlineSlotCapacity = firstCache->objectInlineSlotCapacity;
+                    }
+                }
+
                 // first, create the object
-                Js::DynamicObject* object = scriptContext->GetLibrary()->CreateObject();
+                Js::DynamicObject* object = scriptContext->GetLibrary()->CreateObject(false, inlineSlotCapacity);
                 JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(object));
 #if ENABLE_DEBUG_CONFIG_OPTIONS
                 if (Js::Configuration::Global.flags.IsEnabled(Js::autoProxyFlag))
@@ -298,9 +527,6 @@ namespace JSON
                 }
 #endif
 
-                //next token after '{'
-                Scan();
-
                 //if empty object "{}" return;
                 if(tkRCurly == m_token.tk)
                 {
@@ -308,7 +534,9 @@ namespace JSON
                     return object;
                 }
                 JsonTypeCache* previousCache = nullptr;
-                JsonTypeCache* currentCache = nullptr;
+                JsonTypeCache* currentCache = firstCache;
+                JsonTypeCache* headCache = nullptr;
+                uint memberCount = 0;
                 //parse the list of members
                 while(true)
                 {
@@ -328,7 +556,7 @@ namespace JSON
                     DynamicType* typeWithoutProperty = object->GetDynamicType();
                     if(IsCaching())
                     {
-                        if(!previousCache)
+                        if(!previousCache && memberCount != 0)
                         {
                             // This is the first property in the list - see if we have an existing cache for it.
                             currentCache = typeCacheList->LookupWithKey(Js::HashedCharacterBuffer<WCHAR>(currentStr, currentStrLength), nullptr);
@@ -347,6 +575,10 @@ namespace JSON
                             DynamicType* typeWithProperty = currentCache->typeWithProperty;
                             PropertyId propertyId = currentCache->propertyRecord->GetPropertyId();
                             PropertyIndex propertyIndex = currentCache->propertyIndex;
+                            if(!previousCache)
+                            {
+                                headCache = currentCache;
+                            }
                             previousCache = currentCache;
                             currentCache = currentCache->next;
 
@@ -356,6 +588,7 @@ namespace JSON
                             object->ReplaceType(typeWithProperty);
                             Js::Var value = ParseObject();
                             object->SetSlot(SetSlotArguments(propertyId, propertyIndex, value));
+                            ++memberCount;
 
                             // if the next token is not a comma consider the list of members done.
                             if (tkComma != m_token.tk)
@@ -384,7 +617,12 @@ namespace JSON
                     {
                         PropertyIndex propertyIndex = info.GetPropertyIndex();
 
-                        if(!previousCache)
+                        if(!previousCache && currentCache)
+                        {
+                            // The first property is known but an object with another root type started with it before
+                            currentCache->Update(propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
+                        }
+                        else if(!previousCache)
                         {
                             // This is the first property in the set add it to the dictionary.
                             currentCache = JsonTypeCache::New(this->arenaAllocator, propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
@@ -400,9 +638,14 @@ namespace JSON
                             // cache miss!!
                             currentCache->Update(propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
                         }
+                        if(!previousCache)
+                        {
+                            headCache = currentCache;
+                        }
                         previousCache = currentCache;
                         currentCache = currentCache->next;
                     }
+                    ++memberCount;
 
                     // if the next token is not a comma consider the list of members done.
                     if (tkComma != m_token.tk)
@@ -412,6 +655,12 @@ namespace JSON
 
                 // check  and consume the ending '}"
                 CheckCurrentToken(tkRCurly, JSERR_JsonNoRcurly);
+
+                // Only ever grow the hint, objects of a few sizes sharing a first property then settle on one root type
+                if(headCache && headCache->objectInlineSlotCapacity < memberCount)
+                {
+                    headCache->objectInlineSlotCapacity = static_cast<uint16>(min(memberCount, static_cast<uint>(MaxPreInitializedObjectTypeInlineSlotCount)));
+                }
                 return object;
             }
 
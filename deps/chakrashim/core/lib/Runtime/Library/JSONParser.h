@@ -8,6 +8,60 @@
 namespace JSON
 {
     class JSONDeferredParserRootNode;
+    class JSONLazyObject;
+
+    // Where one object of a lazily parsed JSON text is; start is the offset of its '{' and end the offset
+    // just past its '}'. Objects are numbered in text order, so the ones nested in an object come right
+    // after it and next is the number of the first object past its end.
+    struct JSONLazyObjectEntry
+    {
+        uint start;
+        uint end;
+        uint next;
+        uint memberCount;
+    };
+
+    // Validated source text and object index, shared by all the objects of one lazy JSON.parse
+    class JSONLazyDocument
+    {
+    private:
+        Field(Js::JavascriptString*) source;
+        Field(JSONLazyObjectEntry*) entries;
+        Field(uint) entryCount;
+        Field(Js::DynamicType*) objectType;
+
+    public:
+        JSONLazyDocument(Js::JavascriptString* source, JSONLazyObjectEntry* entries, uint entryCount, Js::DynamicType* objectType) :
+            source(source), entries(entries), entryCount(entryCount), objectType(objectType) {}
+
+        Js::JavascriptString* GetSource() const { return source; }
+        Js::DynamicType* GetObjectType() const { return objectType; }
+        const JSONLazyObjectEntry& GetEntry(uint ordinal) const
+        {
+            AssertOrFailFast(ordinal < entryCount);
+            return entries[ordinal];
+        }
+    };
+
+    // Object of a lazy JSON.parse whose members haven't been built yet. It has a deferred type handler, so
+    // the members are parsed out of the document the first time anything looks at the object's properties.
+    class JSONLazyObject : public Js::DynamicObject
+    {
+    private:
+        Field(JSONLazyDocument*) document;
+        Field(uint) ordinal;
+
+    protected:
+        DEFINE_VTABLE_CTOR(JSONLazyObject, Js::DynamicObject);
+        DEFINE_MARSHAL_OBJECT_TO_SCRIPT_CONTEXT(JSONLazyObject);
+
+    public:
+        JSONLazyObject(Js::DynamicType* type, JSONLazyDocument* document, uint ordinal) :
+            Js::DynamicObject(type), document(document), ordinal(ordinal) {}
+
+        static bool Is(Js::Var aValue);
+        static bool InitializeMembers(Js::DynamicObject* instance, Js::DeferredTypeHandlerBase* typeHandler, Js::DeferredInitializeMode mode);
+    };
 
     struct JsonTypeCache
     {
@@ -16,12 +70,15 @@ namespace JSON
         Js::DynamicType* typeWithProperty;
         JsonTypeCache* next;
         Js::PropertyIndex propertyIndex;
+        // For the first property of an object: inline slots to give the next object starting with it
+        uint16 objectInlineSlotCapacity;
 
         JsonTypeCache(const Js::PropertyRecord* propertyRecord, Js::DynamicType* typeWithoutProperty, Js::DynamicType* typeWithProperty, Js::PropertyIndex propertyIndex) :
             propertyRecord(propertyRecord),
             typeWithoutProperty(typeWithoutProperty),
             typeWithProperty(typeWithProperty),
             propertyIndex(propertyIndex),
+            objectInlineSlotCapacity(0),
             next(nullptr) {}
 
         static JsonTypeCache* New(ArenaAllocator* allocator,
@@ -50,13 +107,16 @@ namespace JSON
     {
     public:
         JSONParser(Js::ScriptContext* sc, Js::RecyclableObject* rv) : scriptContext(sc),
-            reviver(rv),  arenaAllocatorObject(nullptr), arenaAllocator(nullptr), typeCacheList(nullptr)
+            reviver(rv),  arenaAllocatorObject(nullptr), arenaAllocator(nullptr), typeCacheList(nullptr),
+            lazyDocument(nullptr), nextLazyObject(0)
         {
         };
         void Finalizer();
 
         Js::Var Parse(LPCWSTR str, uint length);
         Js::Var Parse(Js::JavascriptString* input);
+        // Validates the whole input but leaves the objects in it to be built when first used
+        Js::Var ParseLazy(Js::JavascriptString* input);
         Js::Var Walk(Js::JavascriptString* name, Js::PropertyId id, Js::Var holder, uint32 index = Js::JavascriptArray::InvalidIndex);
 
     private:
@@ -67,6 +127,11 @@ namespace JSON
 
         Js::Var ParseObject();
 
+        typedef JsUtil::List<JSONLazyObjectEntry, ArenaAllocator> JSONLazyObjectEntryList;
+        void IndexValue(JSONLazyObjectEntryList* entries);
+        Js::Var ParseLazyObject();
+        void ParseLazyMembers(JSONLazyObject* object, JSONLazyDocument* document, uint ordinal);
+
         void CheckCurrentToken(int tk, int wErr)
         {
             if (m_token.tk != tk)
@@ -87,6 +152,10 @@ namespace JSON
         ArenaAllocator* arenaAllocator;
         typedef JsUtil::BaseDictionary<const Js::PropertyRecord *, JsonTypeCache*, ArenaAllocator, PowerOf2SizePolicy, Js::PropertyRecordStringHashComparer>  JsonTypeCacheList;
         JsonTypeCacheList* typeCacheList;
+        JSONLazyDocument* lazyDocument;
+        uint nextLazyObject;
         static const uint MIN_CACHE_LENGTH = 50; // Use Json type cache only if the JSON string is larger than this constant.
+
+        friend class JSONLazyObject;
     };
 } // namespace JSON
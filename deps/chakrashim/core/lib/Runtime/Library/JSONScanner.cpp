@@ -9,6 +9,23 @@ using namespace Js;
 
 namespace JSON
 {
+    // Length of a run of characters starting at str that need no attention inside a string literal, i.e. none of
+    // them is a '"', '\\' or control character. Only whole blocks are looked at, the caller handles whatever is
+    // left one character at a time.
+    static inline uint ScanPlainStringChars(const char16* str, const char16* end)
+    {
+        const CharSearch::Block quote = CharSearch::Splat('"');
+        const CharSearch::Block backslash = CharSearch::Splat('\\');
+        const CharSearch::Block maxControl = CharSearch::Splat(0x1F);
+        return CharSearch::SkipBlocks(str, 0, (charcount_t)(end - str), [&](const char16* block)
+        {
+            CharSearch::Block chars = CharSearch::Load(block);
+            return CharSearch::Or(
+                CharSearch::Or(CharSearch::Equal(chars, quote), CharSearch::Equal(chars, backslash)),
+                CharSearch::LessOrEqual(chars, maxControl));
+        });
+    }
+
     // -------- Scanner implementation ------------//
     JSONScanner::JSONScanner()
         : inputText(0), inputLen(0), pToken(0), stringBuffer(0), allocator(0), allocatorObject(0),
@@ -233,6 +250,14 @@ namespace JSON
 
         while (currentChar < inputText + inputLen)
         {
+            uint plainLength = ScanPlainStringChars(currentChar, inputText + inputLen);
+            currentChar += plainLength;
+            bulkLength += plainLength;
+            if (currentChar >= inputText + inputLen)
+            {
+                break;
+            }
+
             ch = ReadNextChar();
             int tempHex;
 
@@ -11,6 +11,20 @@ namespace Js
 void
 JSONStringBuilder::AppendCharacter(char16 character)
 {
+    if (this->isUtf8)
+    {
+        // Only the JSON punctuation and escapes are appended one character at a time
+        Assert(character < 0x80);
+        ++this->utf8Length;
+        if (this->utf8CurrentLocation != nullptr)
+        {
+            AssertOrFailFast(this->utf8CurrentLocation < this->utf8EndLocation);
+            *this->utf8CurrentLocation = static_cast<utf8char_t>(character);
+            ++this->utf8CurrentLocation;
+        }
+        return;
+    }
+
     AssertOrFailFast(this->currentLocation < endLocation);
     *this->currentLocation = character;
     ++this->currentLocation;
@@ -19,6 +33,22 @@ JSONStringBuilder::AppendCharacter(char16 character)
 void
 JSONStringBuilder::AppendBuffer(_In_ const char16* buffer, charcount_t length)
 {
+    if (this->isUtf8)
+    {
+        if (this->utf8CurrentLocation == nullptr)
+        {
+            this->utf8Length += utf8::CountTrueUtf8(buffer, length);
+            return;
+        }
+
+        size_t written = utf8::EncodeInto<utf8::Utf8EncodingKind::TrueUtf8>(this->utf8CurrentLocation,
+            this->utf8EndLocation - this->utf8CurrentLocation, buffer, length);
+        AssertOrFailFast(this->utf8CurrentLocation + written <= this->utf8EndLocation);
+        this->utf8CurrentLocation += written;
+        this->utf8Length += written;
+        return;
+    }
+
     AssertOrFailFast(this->currentLocation + length <= endLocation);
     wmemcpy_s(this->currentLocation, length, buffer, length);
     this->currentLocation += length;
@@ -38,9 +68,22 @@ JSONStringBuilder::EscapeAndAppendString(_In_ JavascriptString* str)
     // Strings should be surrounded by double quotes
     this->AppendCharacter(_u('"'));
     const char16* bufferStart = str->GetString();
+    // Characters that need no escaping are appended as runs
+    const char16* runStart = bufferStart;
     for (const char16* index = bufferStart; index < bufferStart + strLength; ++index)
     {
         char16 currentCharacter = *index;
+        if (currentCharacter >= _u(' ') && currentCharacter != _u('"') && currentCharacter != _u('\\'))
+        {
+            continue;
+        }
+
+        if (index > runStart)
+        {
+            this->AppendBuffer(runStart, static_cast<charcount_t>(index - runStart));
+        }
+        runStart = index + 1;
+
         switch (currentCharacter)
         {
         case _u('"'):
@@ -70,40 +113,38 @@ JSONStringBuilder::EscapeAndAppendString(_In_ JavascriptString* str)
             this->AppendCharacter(_u('t'));
             break;
         default:
-            if (currentCharacter < _u(' '))
             {
                 // If character is less than SPACE, it is converted into a 4 digit hex code (e.g. \u0010)
                 this->AppendCharacter(_u('\\'));
                 this->AppendCharacter(_u('u'));
+                char16 buf[5];
+                // Get hex value
+                _ltow_s(currentCharacter, buf, _countof(buf), 16);
+
+                // Append leading zeros if necessary before the hex value
+                charcount_t count = static_cast<charcount_t>(wcslen(buf));
+                switch (count)
                 {
-                    char16 buf[5];
-                    // Get hex value
-                    _ltow_s(currentCharacter, buf, _countof(buf), 16);
-
-                    // Append leading zeros if necessary before the hex value
-                    charcount_t count = static_cast<charcount_t>(wcslen(buf));
-                    switch (count)
-                    {
-                    case 1:
-                        this->AppendCharacter(_u('0'));
-                    case 2:
-                        this->AppendCharacter(_u('0'));
-                    case 3:
-                        this->AppendCharacter(_u('0'));
-                    default:
-                        this->AppendBuffer(buf, count);
-                        break;
-                    }
+                case 1:
+                    this->AppendCharacter(_u('0'));
+                case 2:
+                    this->AppendCharacter(_u('0'));
+                case 3:
+                    this->AppendCharacter(_u('0'));
+                default:
+                    this->AppendBuffer(buf, count);
+                    break;
                 }
             }
-            else
-            {
-                this->AppendCharacter(currentCharacter);
-            }
             break;
         }
     }
 
+    if (bufferStart + strLength > runStart)
+    {
+        this->AppendBuffer(runStart, static_cast<charcount_t>(bufferStart + strLength - runStart));
+    }
+
     this->AppendCharacter(_u('"'));
 }
 
@@ -153,7 +194,14 @@ JSONStringBuilder::AppendObjectString(_In_ JSONObject* valueList)
                 this->AppendGap(indentLevel);
             }
         }
-        this->EscapeAndAppendString(entry.propertyName);
+        if (entry.escapedName != nullptr)
+        {
+            this->AppendString(entry.escapedName);
+        }
+        else
+        {
+            this->EscapeAndAppendString(entry.propertyName);
+        }
         this->AppendCharacter(_u(':'));
         if (this->gap != nullptr)
         {
@@ -263,6 +311,12 @@ void
 JSONStringBuilder::Build()
 {
     this->AppendJSONPropertyString(this->jsonContent);
+    if (this->isUtf8)
+    {
+        AssertOrFailFast(this->utf8CurrentLocation == nullptr || this->utf8CurrentLocation <= this->utf8EndLocation);
+        return;
+    }
+
     // Null terminate the string
     AssertOrFailFast(this->currentLocation == endLocation);
     *this->currentLocation = _u('\0');
@@ -278,6 +332,31 @@ JSONStringBuilder::JSONStringBuilder(
         scriptContext(scriptContext),
         endLocation(buffer + bufferLength - 1),
         currentLocation(buffer),
+        utf8EndLocation(nullptr),
+        utf8CurrentLocation(nullptr),
+        utf8Length(0),
+        isUtf8(false),
+        jsonContent(jsonContent),
+        gap(gap),
+        gapLength(gapLength),
+        indentLevel(0)
+{
+}
+
+JSONStringBuilder::JSONStringBuilder(
+    _In_ ScriptContext* scriptContext,
+    _In_ JSONProperty* jsonContent,
+    _Out_writes_opt_(bufferLength) utf8char_t* buffer,
+    size_t bufferLength,
+    _In_opt_ const char16* gap,
+    charcount_t gapLength) :
+        scriptContext(scriptContext),
+        endLocation(nullptr),
+        currentLocation(nullptr),
+        utf8EndLocation(buffer + bufferLength),
+        utf8CurrentLocation(buffer),
+        utf8Length(0),
+        isUtf8(true),
         jsonContent(jsonContent),
         gap(gap),
         gapLength(gapLength),
@@ -14,6 +14,11 @@ class JSONStringBuilder
     ScriptContext* scriptContext;
     const char16* endLocation;
     char16* currentLocation;
+    // UTF-8 output, used instead of the char16 buffer when isUtf8 is set
+    const utf8char_t* utf8EndLocation;
+    utf8char_t* utf8CurrentLocation;
+    size_t utf8Length;
+    bool isUtf8;
     JSONProperty* jsonContent;
     const char16* gap;
     charcount_t gapLength;
@@ -35,7 +40,16 @@ class JSONStringBuilder
         charcount_t bufferLength,
         _In_opt_ const char16* gap,
         charcount_t gapLength);
+    // Builds UTF-8 text instead, which is not null terminated. With no buffer the bytes are only counted.
+    JSONStringBuilder(
+        _In_ ScriptContext* scriptContext,
+        _In_ JSONProperty* jsonContent,
+        _Out_writes_opt_(bufferLength) utf8char_t* buffer,
+        size_t bufferLength,
+        _In_opt_ const char16* gap,
+        charcount_t gapLength);
     void Build();
+    size_t GetUtf8Length() const { return this->utf8Length; }
 };
 
 } // namespace Js
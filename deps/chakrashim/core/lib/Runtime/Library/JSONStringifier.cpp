@@ -426,7 +426,10 @@ JSONStringifier::AppendObjectElement(
     if (prop->propertyValue.type != JSONContentType::Undefined)
     {
         // Increase length for the name of the property
-        this->totalStringLength = UInt32Math::Add(this->totalStringLength, CalculateStringElementLength(propertyName));
+        const charcount_t nameLength = prop->escapedName != nullptr
+            ? prop->escapedName->GetLength()
+            : CalculateStringElementLength(propertyName);
+        this->totalStringLength = UInt32Math::Add(this->totalStringLength, nameLength);
         // Increment length for concatenation of ":"
         UInt32Math::Inc(this->totalStringLength);
         if (this->gapLength != 0)
@@ -539,6 +542,144 @@ JSONStringifier::ReadProxy(_In_ JavascriptProxy* proxyObject, _In_ JSONObject* j
     }
 }
 
+// Escapes a property name once with the same builder that writes the final string
+JavascriptString*
+JSONStringifier::EscapePropertyName(_In_ JavascriptString* propertyName)
+{
+    JSONProperty nameProperty;
+    nameProperty.type = JSONContentType::String;
+    nameProperty.stringValue = propertyName;
+
+    const charcount_t escapedLength = CalculateStringElementLength(propertyName);
+    const charcount_t allocSize = UInt32Math::Add(escapedLength, 1);
+    Recycler* recycler = this->scriptContext->GetRecycler();
+    char16* buffer = RecyclerNewArrayLeaf(recycler, char16, allocSize);
+
+    JSONStringBuilder builder(this->scriptContext, &nameProperty, buffer, allocSize, nullptr, 0);
+    builder.Build();
+
+    return LiteralString::New(this->scriptContext->GetLibrary()->GetStringTypeStatic(), buffer, escapedLength, recycler);
+}
+
+JSONObjectShape*
+JSONStringifier::NewObjectShape(_In_ DynamicObject* obj)
+{
+    DynamicType* type = obj->GetDynamicType();
+    DynamicTypeHandler* typeHandler = type->GetTypeHandler();
+
+    // There can't be more enumerable properties than properties
+    const uint maxPropertyCount = obj->GetPropertyCount();
+    const size_t propertiesSize = AllocSizeMath::Mul(maxPropertyCount, sizeof(JSONObjectShapeProperty));
+    JSONObjectShape* shape = RecyclerNewPlusZ(this->scriptContext->GetRecycler(), propertiesSize, JSONObjectShape);
+    shape->type = type;
+    shape->isReadable = false;
+
+    JavascriptStaticEnumerator enumerator;
+    EnumeratorCache* cache = this->scriptContext->GetLibrary()->GetStringifyCache(type);
+    if (!obj->GetEnumerator(&enumerator, EnumeratorFlags::SnapShotSemantics | EnumeratorFlags::EphemeralReference | EnumeratorFlags::UseCache, this->scriptContext, cache))
+    {
+        return shape;
+    }
+
+    JavascriptString* propertyName = nullptr;
+    PropertyId nextKey = Constants::NoProperty;
+    while ((propertyName = enumerator.MoveAndGetNext(nextKey)) != nullptr)
+    {
+        PropertyString* propertyString = PropertyString::TryFromVar(propertyName);
+        if (propertyString == nullptr ||
+            enumerator.GetCurrentItemIndex() != Constants::InvalidSourceIndex ||
+            shape->propertyCount >= maxPropertyCount)
+        {
+            return shape;
+        }
+
+        PropertyRecord const* propertyRecord = nullptr;
+        propertyString->GetPropertyRecord(&propertyRecord);
+        const PropertyIndex slotIndex = typeHandler->GetPropertyIndex(propertyRecord);
+        if (slotIndex == Constants::NoSlot)
+        {
+            return shape;
+        }
+
+        JSONObjectShapeProperty* property = &shape->properties[shape->propertyCount];
+        property->propertyName = propertyString;
+        property->escapedName = this->EscapePropertyName(propertyString);
+        property->slotIndex = slotIndex;
+        ++shape->propertyCount;
+    }
+
+    // Getting the enumerator may have made the object ready with a new type
+    shape->isReadable = obj->GetDynamicType() == type;
+    return shape;
+}
+
+JSONObjectShape*
+JSONStringifier::GetObjectShape(_In_ RecyclableObject* obj)
+{
+#if ENABLE_TTD
+    if (this->scriptContext->GetThreadContext()->IsRuntimeInTTDMode())
+    {
+        return nullptr;
+    }
+#endif
+
+    // Only plain objects whose properties are all data in the slots of a shared (so unchanging) type
+    if (!VirtualTableInfo<DynamicObject>::HasVirtualTable(obj))
+    {
+        return nullptr;
+    }
+    DynamicObject* dynamicObject = DynamicObject::UnsafeFromVar(obj);
+    DynamicType* type = dynamicObject->GetDynamicType();
+    DynamicTypeHandler* typeHandler = type->GetTypeHandler();
+    if (!type->GetIsShared() ||
+        !typeHandler->IsPathTypeHandler() ||
+        !typeHandler->GetHasOnlyWritableDataProperties() ||
+        dynamicObject->HasObjectArray() ||
+        dynamicObject->GetScriptContext() != this->scriptContext)
+    {
+        return nullptr;
+    }
+
+    EnumeratorCache* cache = this->scriptContext->GetLibrary()->GetStringifyShapeCache(type);
+    if (cache->type != type)
+    {
+        JSONObjectShape* shape = this->NewObjectShape(dynamicObject);
+        cache->type = type;
+        cache->data = shape;
+    }
+
+    JSONObjectShape* shape = static_cast<JSONObjectShape*>(cache->data);
+    return shape->isReadable ? shape : nullptr;
+}
+
+void
+JSONStringifier::ReadObjectShape(
+    _In_ DynamicObject* obj,
+    _In_ JSONObjectShape* shape,
+    _In_ JSONObject* jsonObject,
+    _In_ JSONObjectStack* objectStack)
+{
+    DynamicTypeHandler* typeHandler = shape->type->GetTypeHandler();
+    for (uint i = 0; i < shape->propertyCount; ++i)
+    {
+        const JSONObjectShapeProperty* property = &shape->properties[i];
+
+        JSONObjectProperty prop;
+        prop.propertyName = property->propertyName;
+        prop.escapedName = property->escapedName;
+
+        // toJSON or the replacer may change the object while it is read. The names stay the ones
+        // enumerated up front, as the spec requires, but the values then have to be looked up.
+        Var value = obj->GetDynamicType() == shape->type
+            ? typeHandler->GetSlot(obj, property->slotIndex)
+            : this->ReadValue(property->propertyName, nullptr, obj);
+
+        this->ReadProperty(property->propertyName, obj, &prop.propertyValue, value, objectStack);
+
+        this->AppendObjectElement(property->propertyName, jsonObject, &prop);
+    }
+}
+
 JSONObject*
 JSONStringifier::ReadObject(_In_ RecyclableObject* obj, _In_ JSONObjectStack* objectStack)
 {
@@ -573,10 +714,16 @@ JSONStringifier::ReadObject(_In_ RecyclableObject* obj, _In_ JSONObjectStack* ob
     {
         // Enumerating proxies is different than normal objects, so enumerate them separately
         JavascriptProxy* proxyObject = JavascriptOperators::TryFromVar<JavascriptProxy>(obj);
+        JSONObjectShape* shape = proxyObject == nullptr ? this->GetObjectShape(obj) : nullptr;
         if (proxyObject != nullptr)
         {
             this->ReadProxy(proxyObject, jsonObject, &stack);
         }
+        else if (shape != nullptr)
+        {
+            // Objects of a shape seen before are read straight from their slots
+            this->ReadObjectShape(DynamicObject::UnsafeFromVar(obj), shape, jsonObject, &stack);
+        }
         else
         {
             JavascriptStaticEnumerator enumerator;
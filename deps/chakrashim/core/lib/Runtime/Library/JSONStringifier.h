@@ -28,6 +28,23 @@ struct JSONObjectStack
     }
 };
 
+// Enumerable properties of a plain object type, in order, with where each one is stored and its
+// name already escaped. Objects of a repeated shape are read slot by slot through it.
+struct JSONObjectShapeProperty
+{
+    Field(PropertyString*) propertyName;
+    Field(JavascriptString*) escapedName;
+    Field(PropertyIndex) slotIndex;
+};
+
+struct JSONObjectShape
+{
+    Field(DynamicType*) type;
+    // False if the type has a property that can't be read from its slot; such types are enumerated as usual
+    Field(bool) isReadable;
+    Field(uint) propertyCount;
+    Field(JSONObjectShapeProperty) properties[];
+};
 
 class JSONStringifier
 {
@@ -89,6 +106,10 @@ class JSONStringifier
         _In_ JSONObjectStack* objectStack);
 
     void CalculateStringifiedLength(uint32 propertyCount, charcount_t stepbackLength);
+    JavascriptString* EscapePropertyName(_In_ JavascriptString* propertyName);
+    JSONObjectShape* NewObjectShape(_In_ DynamicObject* obj);
+    JSONObjectShape* GetObjectShape(_In_ RecyclableObject* obj);
+    void ReadObjectShape(_In_ DynamicObject* obj, _In_ JSONObjectShape* shape, _In_ JSONObject* jsonObject, _In_ JSONObjectStack* objectStack);
     void ReadProxy(_In_ JavascriptProxy* proxyObject, _In_ JSONObject* jsonObject, _In_ JSONObjectStack* stack);
     JSONObject* ReadObject(_In_ RecyclableObject* obj, _In_ JSONObjectStack* objectStack);
     void SetNullProperty(_Out_ JSONProperty* prop);
@@ -6566,6 +6566,25 @@ using namespace Js;
                 AssertAndFailFast(newArr != nullptr);
             }
 
+            // Elements of the same type have the same bit representation, so they can be copied as bytes.
+            if (isTypedArrayEntryPoint && newTypedArray && newTypedArray->GetTypeId() == typedArrayBase->GetTypeId())
+            {
+                if (typedArrayBase->IsDetachedBuffer() || newTypedArray->IsDetachedBuffer())
+                {
+                    JavascriptError::ThrowTypeError(scriptContext, JSERR_DetachedTypedArray, _u("[TypedArray].prototype.slice"));
+                }
+
+                AssertOrFailFast(start <= typedArrayBase->GetLength() && newLen <= typedArrayBase->GetLength() - start);
+                AssertOrFailFast(newLen <= newTypedArray->GetLength());
+
+                const uint32 bytesPerElement = typedArrayBase->GetBytesPerElement();
+                memmove(newTypedArray->GetByteBuffer(),
+                        typedArrayBase->GetByteBuffer() + static_cast<size_t>(start) * bytesPerElement,
+                        static_cast<size_t>(newLen) * bytesPerElement);
+
+                return newObj;
+            }
+
             Var element;
 
             for (uint32 i = 0; i < newLen; i++)
@@ -6716,41 +6735,99 @@ using namespace Js;
         }
     }
 
-    static void hybridSort(__inout_ecount(length) Field(Var) *elements, uint32 length, CompareVarsInfo* compareInfo)
+    static void stableSort(__inout_ecount(length) Field(Var) *elements, uint32 length, CompareVarsInfo* compareInfo, Recycler* recycler)
     {
-        // The cost of memory moves starts to be more expensive than additional comparer calls (given a simple comparer)
-        // for arrays of more than 512 elements.
-        if (length > 512)
+        typedef JsUtil::MergeSort<Field(Var), decltype(&compareVars)> VarMergeSort;
+
+        // The comparer may run script and trigger a GC, so the merge buffer must keep the elements alive
+        size_t tempCount = VarMergeSort::GetTempCount(length);
+        Field(Var)* temp = tempCount != 0 ? RecyclerNewArrayZ(recycler, Field(Var), tempCount) : nullptr;
+        VarMergeSort::Sort(elements, length, temp, compareVars, compareInfo);
+    }
+
+    // Compares two int32 values the way the default sort comparer compares their string forms
+    static int compareInt32sAsStrings(int32 left, int32 right)
+    {
+        if (left == right)
         {
-            qsort_s(elements, length, compareVars, compareInfo);
-            return;
+            return 0;
         }
 
-        for (int i = 1; i < (int)length; i++)
+        // '-' sorts before any digit
+        if ((left < 0) != (right < 0))
         {
-            if (compareVars(compareInfo, elements + i, elements + i - 1) < 0) {
-                // binary search for the left-most element greater than value:
-                int first = 0;
-                int last = i - 1;
-                while (first <= last)
-                {
-                    int middle = (first + last) / 2;
-                    if (compareVars(compareInfo, elements + i, elements + middle) < 0)
-                    {
-                        last = middle - 1;
-                    }
-                    else
-                    {
-                        first = middle + 1;
-                    }
-                }
+            return left < 0 ? -1 : 1;
+        }
+
+        uint64 leftDigits = left < 0 ? (uint64)(-(int64)left) : (uint64)left;
+        uint64 rightDigits = right < 0 ? (uint64)(-(int64)right) : (uint64)right;
 
-                // insert value right before first:
-                Var value = elements[i];
-                MoveArray(elements + first + 1, elements + first, (i - first));
-                elements[first] = value;
+        // Line the digits up by scaling the shorter number to the length of the longer one
+        uint64 scaledLeft = leftDigits;
+        uint64 scaledRight = rightDigits;
+        for (uint64 bound = 10; bound <= rightDigits; bound *= 10)
+        {
+            if (leftDigits < bound)
+            {
+                scaledLeft *= 10;
+            }
+        }
+        for (uint64 bound = 10; bound <= leftDigits; bound *= 10)
+        {
+            if (rightDigits < bound)
+            {
+                scaledRight *= 10;
             }
         }
+
+        if (scaledLeft != scaledRight)
+        {
+            return scaledLeft < scaledRight ? -1 : 1;
+        }
+
+        // One string is a prefix of the other, the shorter one sorts first
+        return leftDigits < rightDigits ? -1 : 1;
+    }
+
+    int __cdecl compareTaggedIntVars(void* context, const void* aRef, const void* bRef)
+    {
+        return compareInt32sAsStrings(TaggedInt::ToInt32(*(Var*)aRef), TaggedInt::ToInt32(*(Var*)bRef));
+    }
+
+    int __cdecl compareStringVars(void* context, const void* aRef, const void* bRef)
+    {
+        return JavascriptString::strcmp(JavascriptString::UnsafeFromVar(*(Var*)aRef), JavascriptString::UnsafeFromVar(*(Var*)bRef));
+    }
+
+    int __cdecl compareInt32s(void* context, const void* aRef, const void* bRef)
+    {
+        return compareInt32sAsStrings(*(const int32*)aRef, *(const int32*)bRef);
+    }
+
+    // Without a comparer, boxing doesn't change how ints sort, so a hole free single segment int
+    // array is sorted in place instead of being converted to a var array first.
+    static bool trySortNativeIntArrayInPlace(JavascriptNativeIntArray* arr, Recycler* recycler)
+    {
+        SparseArraySegmentBase* head = arr->GetHead();
+        if (head == nullptr || head->next != nullptr || head->left != 0 || head->length != arr->GetLength())
+        {
+            return false;
+        }
+
+        SparseArraySegment<int32>* segment = SparseArraySegment<int32>::From(head);
+        for (uint32 i = 0; i < segment->length; i++)
+        {
+            if (SparseArraySegment<int32>::IsMissingItem(&segment->elements[i]))
+            {
+                return false;
+            }
+        }
+
+        typedef JsUtil::MergeSort<int32, decltype(&compareInt32s)> Int32MergeSort;
+        size_t tempCount = Int32MergeSort::GetTempCount(segment->length);
+        int32* temp = tempCount != 0 ? RecyclerNewArrayLeaf(recycler, int32, tempCount) : nullptr;
+        Int32MergeSort::Sort(segment->elements, segment->length, temp, compareInt32s, nullptr);
+        return true;
     }
 
     void JavascriptArray::Sort(RecyclableObject* compFn)
@@ -6806,7 +6883,7 @@ using namespace Js;
 #ifdef VALIDATE_ARRAY
                     ValidateSegment(startSeg);
 #endif
-                    JS_REENTRANT(jsReentLock, hybridSort(startSeg->elements, startSeg->length, &cvInfo));
+                    JS_REENTRANT(jsReentLock, stableSort(startSeg->elements, startSeg->length, &cvInfo, recycler));
                     startSeg->CheckLengthvsSize();
                 }
                 else
@@ -6839,7 +6916,7 @@ using namespace Js;
 
                 if (compFn != nullptr)
                 {
-                    JS_REENTRANT(jsReentLock, hybridSort(allElements->elements, allElements->length, &cvInfo));
+                    JS_REENTRANT(jsReentLock, stableSort(allElements->elements, allElements->length, &cvInfo, recycler));
                 }
                 else
                 {
@@ -6917,38 +6994,77 @@ using namespace Js;
     uint32 JavascriptArray::sort(__inout_ecount(*len) Field(Var) *orig, uint32 *len, ScriptContext *scriptContext)
     {
         uint32 count = 0, countUndefined = 0;
-        Element *elements = RecyclerNewArrayZ(scriptContext->GetRecycler(), Element, *len);
+        Recycler* recycler = scriptContext->GetRecycler();
         RecyclableObject *undefined = scriptContext->GetLibrary()->GetUndefined();
 
-        //
-        // Create the Elements array
-        //
-
-        for (uint32 i = 0; i < *len; ++i)
+        // Arrays of only tagged ints or only strings don't need the cached ToString values
+        bool allTaggedInts = true;
+        bool allStrings = true;
+        for (uint32 i = 0; i < *len && (allTaggedInts || allStrings); ++i)
         {
-            if (!SparseArraySegment<Var>::IsMissingItem(&orig[i]))
+            if (!SparseArraySegment<Var>::IsMissingItem(&orig[i]) && !JavascriptOperators::IsUndefinedObject(orig[i], undefined))
             {
-                if (!JavascriptOperators::IsUndefinedObject(orig[i], undefined))
-                {
-                    elements[count].Value = orig[i];
-                    elements[count].StringValue =  JavascriptConversion::ToString(orig[i], scriptContext);
+                allTaggedInts = allTaggedInts && TaggedInt::Is(orig[i]);
+                allStrings = allStrings && JavascriptString::Is(orig[i]);
+            }
+        }
 
-                    count++;
-                }
-                else
+        if (allTaggedInts || allStrings)
+        {
+            for (uint32 i = 0; i < *len; ++i)
+            {
+                if (!SparseArraySegment<Var>::IsMissingItem(&orig[i]))
                 {
-                    countUndefined++;
+                    if (!JavascriptOperators::IsUndefinedObject(orig[i], undefined))
+                    {
+                        orig[count++] = orig[i];
+                    }
+                    else
+                    {
+                        countUndefined++;
+                    }
                 }
             }
-        }
 
-        if (count > 0)
+            typedef JsUtil::MergeSort<Field(Var), decltype(&compareVars)> VarMergeSort;
+            size_t tempCount = VarMergeSort::GetTempCount(count);
+            Field(Var)* temp = tempCount != 0 ? RecyclerNewArrayZ(recycler, Field(Var), tempCount) : nullptr;
+            VarMergeSort::Sort(orig, count, temp, allTaggedInts ? compareTaggedIntVars : compareStringVars, nullptr);
+        }
+        else
         {
-            SortElements(elements, 0, count - 1);
+            Element *elements = RecyclerNewArrayZ(recycler, Element, *len);
 
-            for (uint32 i = 0; i < count; ++i)
+            //
+            // Create the Elements array
+            //
+
+            for (uint32 i = 0; i < *len; ++i)
             {
-                orig[i] = elements[i].Value;
+                if (!SparseArraySegment<Var>::IsMissingItem(&orig[i]))
+                {
+                    if (!JavascriptOperators::IsUndefinedObject(orig[i], undefined))
+                    {
+                        elements[count].Value = orig[i];
+                        elements[count].StringValue =  JavascriptConversion::ToString(orig[i], scriptContext);
+
+                        count++;
+                    }
+                    else
+                    {
+                        countUndefined++;
+                    }
+                }
+            }
+
+            if (count > 0)
+            {
+                SortElements(elements, 0, count - 1);
+
+                for (uint32 i = 0; i < count; ++i)
+                {
+                    orig[i] = elements[i].Value;
+                }
             }
         }
 
@@ -7005,8 +7121,12 @@ using namespace Js;
 
     void JavascriptArray::SortElements(Element* elements, uint32 left, uint32 right)
     {
-        // Note: use write barrier policy of Field(Var)
-        qsort_s<Element, Field(Var)>(elements, right - left + 1, CompareElements, this);
+        typedef JsUtil::MergeSort<Element, decltype(&CompareElements)> ElementMergeSort;
+
+        uint32 count = right - left + 1;
+        size_t tempCount = ElementMergeSort::GetTempCount(count);
+        Element* temp = tempCount != 0 ? RecyclerNewArrayZ(this->GetRecycler(), Element, tempCount) : nullptr;
+        ElementMergeSort::Sort(elements + left, count, temp, CompareElements, this);
     }
 
     Var JavascriptArray::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
@@ -7071,6 +7191,12 @@ using namespace Js;
                 Js::Throw::FatalInternalError();
             }
 
+            if (compFn == nullptr && JavascriptNativeIntArray::Is(arr)
+                && trySortNativeIntArrayInPlace(JavascriptNativeIntArray::UnsafeFromVar(arr), scriptContext->GetRecycler()))
+            {
+                return args[0];
+            }
+
             EnsureNonNativeArray(arr);
             JS_REENTRANT(jsReentLock, arr->Sort(compFn));
         }
@@ -9384,6 +9510,7 @@ using namespace Js;
 
         Assert(args.Info.Count > 0);
 
+        bool isTypedArrayEntryPoint = typedArrayBase != nullptr;
         JavascriptLibrary* library = scriptContext->GetLibrary();
 
         // If we came from Array.prototype.fill and source object is not a JavascriptArray, source could be a TypedArray
@@ -9403,6 +9530,13 @@ using namespace Js;
             fillValue = library->GetUndefined();
         }
 
+        // %TypedArray%.prototype.fill converts the value to a Number once, before the start and end arguments.
+        if (isTypedArrayEntryPoint && !TaggedInt::Is(fillValue) && !JavascriptNumber::Is(fillValue))
+        {
+            JS_REENTRANT_UNLOCK(jsReentLock,
+                fillValue = JavascriptNumber::ToVarWithCheck(JavascriptConversion::ToNumber(fillValue, scriptContext), scriptContext));
+        }
+
         int64 k = 0;
         int64 finalVal = length;
 
@@ -9424,6 +9558,13 @@ using namespace Js;
             }
         }
 
+        if (isTypedArrayEntryPoint)
+        {
+            // The indices are clamped to the typed array length, and storing a Number can't run script.
+            typedArrayBase->DirectFill(static_cast<uint32>(k), k < finalVal ? static_cast<uint32>(finalVal - k) : 0, fillValue);
+            return obj;
+        }
+
         if (k < MaxArrayLength)
         {
             int64 end = min<int64>(finalVal, MaxArrayLength);
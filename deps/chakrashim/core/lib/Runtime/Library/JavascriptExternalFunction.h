@@ -38,6 +38,7 @@ namespace Js
         Var GetSignature() { return signature; }
         inline void SetCallbackState(void *callbackState) { this->callbackState = callbackState; }
         void *GetCallbackState() { return callbackState; }
+        inline void SetCallbackStateOwner(RecyclableObject *owner) { this->callbackStateOwner = owner; }
 
         static const int ETW_MIN_COUNT_FOR_CALLER = 0x100; // power of 2
         class EntryInfo
@@ -66,6 +67,8 @@ namespace Js
         Field(UINT64) flags;
         Field(Var) signature;
         Field(void *) callbackState;
+        // Keeps an object that finalizes the host's callback state alive with the function
+        Field(RecyclableObject *) callbackStateOwner;
         union
         {
             FieldNoBarrier(ExternalMethod) nativeMethod;
@@ -531,6 +531,13 @@ namespace Js
             promiseType = DynamicType::New(scriptContext, TypeIds_Promise, promisePrototype, nullptr, NullTypeHandler<false>::GetDefaultInstance(), true, true);
         }
 
+        if (config->IsES7AsyncAndAwaitEnabled())
+        {
+            // The generators that drive async functions are never handed out to script, so unlike
+            // the ones of generator functions they can all share a type with a null prototype.
+            asyncFunctionGeneratorType = DynamicType::New(scriptContext, TypeIds_Generator, GetNull(), nullptr, NullTypeHandler<false>::GetDefaultInstance(), true, true);
+        }
+
         if (config->IsES6ModuleEnabled())
         {
             moduleNamespaceType = DynamicType::New(scriptContext, TypeIds_ModuleNamespace, nullValue, nullptr, &SharedNamespaceSymbolTypeHandler);
@@ -1902,23 +1909,24 @@ namespace Js
 
         ScriptContext* scriptContext = dataViewPrototype->GetScriptContext();
         JavascriptLibrary* library = dataViewPrototype->GetLibrary();
+        Field(JavascriptFunction*)* builtinFuncs = library->GetBuiltinFunctions();
         library->AddMember(dataViewPrototype, PropertyIds::constructor, library->dataViewConstructor);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setInt8, &DataView::EntryInfo::SetInt8, 2);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setUint8, &DataView::EntryInfo::SetUint8, 2);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setInt16, &DataView::EntryInfo::SetInt16, 2);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setUint16, &DataView::EntryInfo::SetUint16, 2);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setInt32, &DataView::EntryInfo::SetInt32, 2);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setUint32, &DataView::EntryInfo::SetUint32, 2);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setFloat32, &DataView::EntryInfo::SetFloat32, 2);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setFloat64, &DataView::EntryInfo::SetFloat64, 2);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getInt8, &DataView::EntryInfo::GetInt8, 1);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getUint8, &DataView::EntryInfo::GetUint8, 1);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getInt16, &DataView::EntryInfo::GetInt16, 1);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getUint16, &DataView::EntryInfo::GetUint16, 1);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getInt32, &DataView::EntryInfo::GetInt32, 1);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getUint32, &DataView::EntryInfo::GetUint32, 1);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getFloat32, &DataView::EntryInfo::GetFloat32, 1);
-        library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getFloat64, &DataView::EntryInfo::GetFloat64, 1);
+        builtinFuncs[BuiltinFunction::DataView_SetInt8] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setInt8, &DataView::EntryInfo::SetInt8, 2);
+        builtinFuncs[BuiltinFunction::DataView_SetUint8] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setUint8, &DataView::EntryInfo::SetUint8, 2);
+        builtinFuncs[BuiltinFunction::DataView_SetInt16] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setInt16, &DataView::EntryInfo::SetInt16, 2);
+        builtinFuncs[BuiltinFunction::DataView_SetUint16] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setUint16, &DataView::EntryInfo::SetUint16, 2);
+        builtinFuncs[BuiltinFunction::DataView_SetInt32] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setInt32, &DataView::EntryInfo::SetInt32, 2);
+        builtinFuncs[BuiltinFunction::DataView_SetUint32] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setUint32, &DataView::EntryInfo::SetUint32, 2);
+        builtinFuncs[BuiltinFunction::DataView_SetFloat32] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setFloat32, &DataView::EntryInfo::SetFloat32, 2);
+        builtinFuncs[BuiltinFunction::DataView_SetFloat64] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::setFloat64, &DataView::EntryInfo::SetFloat64, 2);
+        builtinFuncs[BuiltinFunction::DataView_GetInt8] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getInt8, &DataView::EntryInfo::GetInt8, 1);
+        builtinFuncs[BuiltinFunction::DataView_GetUint8] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getUint8, &DataView::EntryInfo::GetUint8, 1);
+        builtinFuncs[BuiltinFunction::DataView_GetInt16] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getInt16, &DataView::EntryInfo::GetInt16, 1);
+        builtinFuncs[BuiltinFunction::DataView_GetUint16] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getUint16, &DataView::EntryInfo::GetUint16, 1);
+        builtinFuncs[BuiltinFunction::DataView_GetInt32] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getInt32, &DataView::EntryInfo::GetInt32, 1);
+        builtinFuncs[BuiltinFunction::DataView_GetUint32] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getUint32, &DataView::EntryInfo::GetUint32, 1);
+        builtinFuncs[BuiltinFunction::DataView_GetFloat32] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getFloat32, &DataView::EntryInfo::GetFloat32, 1);
+        builtinFuncs[BuiltinFunction::DataView_GetFloat64] = library->AddFunctionToLibraryObject(dataViewPrototype, PropertyIds::getFloat64, &DataView::EntryInfo::GetFloat64, 1);
 
         library->AddAccessorsToLibraryObject(dataViewPrototype, PropertyIds::buffer, &DataView::EntryInfo::GetterBuffer, nullptr);
         library->AddAccessorsToLibraryObject(dataViewPrototype, PropertyIds::byteLength, &DataView::EntryInfo::GetterByteLength, nullptr);
@@ -3916,14 +3924,15 @@ namespace Js
         // so that the update is in sync with profiler
         ScriptContext* scriptContext = mapPrototype->GetScriptContext();
         JavascriptLibrary* library = mapPrototype->GetLibrary();
+        Field(JavascriptFunction*)* builtinFuncs = library->GetBuiltinFunctions();
         library->AddMember(mapPrototype, PropertyIds::constructor, library->mapConstructor);
 
         library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::clear, &JavascriptMap::EntryInfo::Clear, 0);
         library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::delete_, &JavascriptMap::EntryInfo::Delete, 1);
         library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::forEach, &JavascriptMap::EntryInfo::ForEach, 1);
-        library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::get, &JavascriptMap::EntryInfo::Get, 1);
-        library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::has, &JavascriptMap::EntryInfo::Has, 1);
-        library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::set, &JavascriptMap::EntryInfo::Set, 2);
+        builtinFuncs[BuiltinFunction::JavascriptMap_Get] = library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::get, &JavascriptMap::EntryInfo::Get, 1);
+        builtinFuncs[BuiltinFunction::JavascriptMap_Has] = library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::has, &JavascriptMap::EntryInfo::Has, 1);
+        builtinFuncs[BuiltinFunction::JavascriptMap_Set] = library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::set, &JavascriptMap::EntryInfo::Set, 2);
 
         library->AddAccessorsToLibraryObject(mapPrototype, PropertyIds::size, &JavascriptMap::EntryInfo::SizeGetter, nullptr);
 
@@ -3968,13 +3977,14 @@ namespace Js
         // so that the update is in sync with profiler
         ScriptContext* scriptContext = setPrototype->GetScriptContext();
         JavascriptLibrary* library = setPrototype->GetLibrary();
+        Field(JavascriptFunction*)* builtinFuncs = library->GetBuiltinFunctions();
         library->AddMember(setPrototype, PropertyIds::constructor, library->setConstructor);
 
         library->AddFunctionToLibraryObject(setPrototype, PropertyIds::add, &JavascriptSet::EntryInfo::Add, 1);
         library->AddFunctionToLibraryObject(setPrototype, PropertyIds::clear, &JavascriptSet::EntryInfo::Clear, 0);
         library->AddFunctionToLibraryObject(setPrototype, PropertyIds::delete_, &JavascriptSet::EntryInfo::Delete, 1);
         library->AddFunctionToLibraryObject(setPrototype, PropertyIds::forEach, &JavascriptSet::EntryInfo::ForEach, 1);
-        library->AddFunctionToLibraryObject(setPrototype, PropertyIds::has, &JavascriptSet::EntryInfo::Has, 1);
+        builtinFuncs[BuiltinFunction::JavascriptSet_Has] = library->AddFunctionToLibraryObject(setPrototype, PropertyIds::has, &JavascriptSet::EntryInfo::Has, 1);
 
         library->AddAccessorsToLibraryObject(setPrototype, PropertyIds::size, &JavascriptSet::EntryInfo::SizeGetter, nullptr);
 
@@ -4492,7 +4502,29 @@ namespace Js
     {
         Assert(JavascriptFunction::Is(taskVar));
 
-        if(this->nativeHostPromiseContinuationFunction)
+        ThreadContext* threadContext = this->scriptContext->GetThreadContext();
+        if (threadContext->IsPromiseJobQueueEnabled()
+#if ENABLE_TTD
+            && !this->scriptContext->ShouldPerformRecordOrReplayAction()
+#endif
+            )
+        {
+            // The host drains the jobs with JsRunPromiseJobs and only needs to hear about the first one.
+            if (threadContext->EnqueuePromiseJob(taskVar))
+            {
+                BEGIN_LEAVE_SCRIPT(scriptContext);
+                try
+                {
+                    threadContext->NotifyPromiseJobsPending();
+                }
+                catch (...)
+                {
+                    Js::Throw::FatalInternalError();
+                }
+                END_LEAVE_SCRIPT(scriptContext);
+            }
+        }
+        else if(this->nativeHostPromiseContinuationFunction)
         {
 #if ENABLE_TTD
             TTDAssert(this->scriptContext != nullptr, "We shouldn't be adding tasks if this is the case???");
@@ -5859,6 +5891,12 @@ namespace Js
         return JavascriptGenerator::New(this->GetRecycler(), generatorType, args, scriptFunction);
     }
 
+    JavascriptGenerator* JavascriptLibrary::CreateAsyncFunctionGenerator(Arguments& args, ScriptFunction* scriptFunction)
+    {
+        Assert(scriptContext->GetConfig()->IsES7AsyncAndAwaitEnabled());
+        return JavascriptGenerator::New(this->GetRecycler(), asyncFunctionGeneratorType, args, scriptFunction);
+    }
+
     JavascriptError* JavascriptLibrary::CreateError()
     {
         AssertMsg(errorType, "Where's errorType?");
@@ -6453,6 +6491,34 @@ namespace Js
         return GetEnumeratorCache<Cache::StringifyCacheSize>(type, &this->cache.stringifyCache);
     }
 
+    EnumeratorCache* JavascriptLibrary::GetStringifyShapeCache(Type* type)
+    {
+        return GetEnumeratorCache<Cache::StringifyShapeCacheSize>(type, &this->cache.stringifyShapeCache);
+    }
+
+    // Returns the cache used to look up the proxy trap of the given JavascriptProxy::NativeTrapKind on handlers, or
+    // nullptr if the trap should be looked up without one. Like the toStringTag cache, these are not resized, and a
+    // script context rarely sees more than a few handler types for any trap.
+    PolymorphicInlineCache* JavascriptLibrary::GetProxyTrapCache(uint trapKind)
+    {
+        Assert(trapKind < JavascriptProxy::NativeTrapCount);
+
+        if (PHASE_OFF1(ProxyTrapCachePhase))
+        {
+            return nullptr;
+        }
+
+        if (this->cache.proxyTrapCaches == nullptr)
+        {
+            this->cache.proxyTrapCaches = RecyclerNewArrayZ(this->recycler, Field(ScriptContextPolymorphicInlineCache*), JavascriptProxy::NativeTrapCount);
+        }
+        if (this->cache.proxyTrapCaches[trapKind] == nullptr)
+        {
+            this->cache.proxyTrapCaches[trapKind] = ScriptContextPolymorphicInlineCache::New(Cache::ProxyTrapCacheSize, this);
+        }
+        return this->cache.proxyTrapCaches[trapKind];
+    }
+
     template<uint cacheSlotCount> EnumeratorCache* JavascriptLibrary::GetEnumeratorCache(Type* type, Field(EnumeratorCache*)* cacheSlots)
     {
         // Size must be power of 2 for cache indexing to work
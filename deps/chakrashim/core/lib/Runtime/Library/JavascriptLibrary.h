@@ -73,6 +73,8 @@ namespace Js
     {
         static const uint AssignCacheSize = 16;
         static const uint StringifyCacheSize = 16;
+        static const uint StringifyShapeCacheSize = 16;
+        static const uint ProxyTrapCacheSize = 16;
 
         Field(PropertyStringMap*) propertyStrings[80];
         Field(JavascriptString *) lastNumberToStringRadix10String;
@@ -91,14 +93,16 @@ namespace Js
         Field(BuiltInLibraryFunctionMap*) builtInLibraryFunctions;
         Field(ScriptContextPolymorphicInlineCache*) toStringTagCache;
         Field(ScriptContextPolymorphicInlineCache*) toJSONCache;
+        Field(Field(ScriptContextPolymorphicInlineCache*)*) proxyTrapCaches;
         Field(EnumeratorCache*) assignCache;
         Field(EnumeratorCache*) stringifyCache;
+        Field(EnumeratorCache*) stringifyShapeCache;
 #if ENABLE_PROFILE_INFO
 #if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
         Field(DynamicProfileInfoList*) profileInfoList;
 #endif
 #endif
-        Cache() : toStringTagCache(nullptr), toJSONCache(nullptr), assignCache(nullptr), stringifyCache(nullptr) { }
+        Cache() : toStringTagCache(nullptr), toJSONCache(nullptr), proxyTrapCaches(nullptr), assignCache(nullptr), stringifyCache(nullptr), stringifyShapeCache(nullptr) { }
     };
 
     class MissingPropertyTypeHandler;
@@ -243,6 +247,7 @@ namespace Js
         static DWORD GetCharStringCacheOffset() { return offsetof(JavascriptLibrary, charStringCache); }
         static DWORD GetCharStringCacheAOffset() { return GetCharStringCacheOffset() + CharStringCache::GetCharStringCacheAOffset(); }
         PolymorphicInlineCache *GetToStringTagCache() const { return cache.toStringTagCache; }
+        PolymorphicInlineCache *GetProxyTrapCache(uint trapKind);
         const  JavascriptLibraryBase* GetLibraryBase() const { return static_cast<const JavascriptLibraryBase*>(this); }
         void SetGlobalObject(GlobalObject* globalObject) {this->globalObject = globalObject; }
         static DWORD GetRandSeed0Offset() { return offsetof(JavascriptLibrary, randSeed0); }
@@ -300,6 +305,7 @@ namespace Js
         Field(DynamicType *) setIteratorType;
         Field(DynamicType *) stringIteratorType;
         Field(DynamicType *) promiseType;
+        Field(DynamicType *) asyncFunctionGeneratorType;
         Field(DynamicType *) listIteratorType;
 
         Field(JavascriptFunction*) builtinFunctions[BuiltinFunction::Count];
@@ -902,6 +908,7 @@ namespace Js
         JavascriptSymbol* CreateSymbol(const PropertyRecord* propertyRecord);
         JavascriptPromise* CreatePromise();
         JavascriptGenerator* CreateGenerator(Arguments& args, ScriptFunction* scriptFunction, RecyclableObject* prototype);
+        JavascriptGenerator* CreateAsyncFunctionGenerator(Arguments& args, ScriptFunction* scriptFunction);
         JavascriptFunction* CreateNonProfiledFunction(FunctionInfo * functionInfo);
         template <class MethodType>
         JavascriptExternalFunction* CreateIdMappedExternalFunction(MethodType entryPoint, DynamicType *pPrototypeType);
@@ -1121,6 +1128,7 @@ namespace Js
 
         EnumeratorCache* GetObjectAssignCache(Type* type);
         EnumeratorCache* GetStringifyCache(Type* type);
+        EnumeratorCache* GetStringifyShapeCache(Type* type);
 
         bool GetArrayObjectHasUserDefinedSpecies() const { return arrayObjectHasUserDefinedSpecies; }
         void SetArrayObjectHasUserDefinedSpecies(bool val) { arrayObjectHasUserDefinedSpecies = val; }
@@ -207,6 +207,7 @@ Var JavascriptMap::EntryForEach(RecyclableObject* function, CallInfo callInfo, .
 
 Var JavascriptMap::EntryGet(RecyclableObject* function, CallInfo callInfo, ...)
 {
+    JIT_HELPER_REENTRANT_HEADER(Map_Get);
     PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
     ARGUMENTS(args, callInfo);
@@ -227,10 +228,12 @@ Var JavascriptMap::EntryGet(RecyclableObject* function, CallInfo callInfo, ...)
     }
 
     return scriptContext->GetLibrary()->GetUndefined();
+    JIT_HELPER_END(Map_Get);
 }
 
 Var JavascriptMap::EntryHas(RecyclableObject* function, CallInfo callInfo, ...)
 {
+    JIT_HELPER_REENTRANT_HEADER(Map_Has);
     PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
     ARGUMENTS(args, callInfo);
@@ -247,10 +250,12 @@ Var JavascriptMap::EntryHas(RecyclableObject* function, CallInfo callInfo, ...)
     bool hasValue = map->Has(key);
 
     return scriptContext->GetLibrary()->CreateBoolean(hasValue);
+    JIT_HELPER_END(Map_Has);
 }
 
 Var JavascriptMap::EntrySet(RecyclableObject* function, CallInfo callInfo, ...)
 {
+    JIT_HELPER_REENTRANT_HEADER(Map_Set);
     PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
     ARGUMENTS(args, callInfo);
@@ -274,6 +279,7 @@ Var JavascriptMap::EntrySet(RecyclableObject* function, CallInfo callInfo, ...)
     map->Set(key, value);
 
     return map;
+    JIT_HELPER_END(Map_Set);
 }
 
 Var JavascriptMap::EntrySizeGetter(RecyclableObject* function, CallInfo callInfo, ...)
@@ -369,15 +375,15 @@ JavascriptMap::DeleteFromVarMap(Var value)
 {
     Assert(this->kind == (isComplex ? MapKind::ComplexVarMap : MapKind::SimpleVarMap));
 
-    MapDataNode * node = nullptr;
+    uint index = 0;
     if (isComplex
-        ? !this->u.complexVarMap->TryGetValueAndRemove(value, &node)
-        : !this->u.simpleVarMap->TryGetValueAndRemove(value, &node))
+        ? !this->u.complexVarMap->TryGetValueAndRemove(value, &index)
+        : !this->u.simpleVarMap->TryGetValueAndRemove(value, &index))
     {
         return false;
     }
 
-    this->list.Remove(node);
+    this->list.Remove(index);
     return true;
 }
 
@@ -428,10 +434,10 @@ JavascriptMap::Get(Var key, Var* value)
     case MapKind::SimpleVarMap:
     {
         // First check if the key is in the map
-        MapDataNode* node = nullptr;
-        if (this->u.simpleVarMap->TryGetValue(key, &node))
+        uint index = 0;
+        if (this->u.simpleVarMap->TryGetValue(key, &index))
         {
-            *value = node->data.Value();
+            *value = this->list.Item(index).Value();
             return true;
         }
         // If the key isn't in the map, check if the canonical value is
@@ -442,21 +448,21 @@ JavascriptMap::Get(Var key, Var* value)
             return false;
         }
 
-        if (!this->u.simpleVarMap->TryGetValue(simpleVar, &node))
+        if (!this->u.simpleVarMap->TryGetValue(simpleVar, &index))
         {
             return false;
         }
-        *value = node->data.Value();
+        *value = this->list.Item(index).Value();
         return true;
     }
     case MapKind::ComplexVarMap:
     {
-        MapDataNode * node = nullptr;
-        if (!this->u.complexVarMap->TryGetValue(key, &node))
+        uint index = 0;
+        if (!this->u.complexVarMap->TryGetValue(key, &index))
         {
             return false;
         }
-        *value = node->data.Value();
+        *value = this->list.Item(index).Value();
         return true;
     }
     default:
@@ -510,17 +516,35 @@ JavascriptMap::PromoteToComplexVarMap()
     uint newMapSize = this->u.simpleVarMap->Count() + 1;
     ComplexVarDataMap* newMap = RecyclerNew(this->GetRecycler(), ComplexVarDataMap, this->GetRecycler(), newMapSize);
 
-    JavascriptMap::MapDataList::Iterator iter = this->list.GetIterator();
-    // TODO: we can use a more efficient Iterator, since we know there will be no side effects
-    while (iter.Next())
+    this->list.Map([&](uint index, const MapDataKeyValuePair& pair)
     {
-        newMap->Add(iter.Current().Key(), iter.CurrentNode());
-    }
+        newMap->Add(pair.Key(), index);
+    });
 
     this->kind = MapKind::ComplexVarMap;
     this->u.complexVarMap = newMap;
 }
 
+uint
+JavascriptMap::AppendToList(const MapDataKeyValuePair& pair)
+{
+    return this->list.Append(pair, this->GetRecycler(), [this](uint index, const MapDataKeyValuePair& movedPair)
+    {
+        // The list compacted its entries to make room; keep the keys pointing at them
+        switch (this->kind)
+        {
+        case MapKind::SimpleVarMap:
+            this->u.simpleVarMap->Item(movedPair.Key(), index);
+            return;
+        case MapKind::ComplexVarMap:
+            this->u.complexVarMap->Item(movedPair.Key(), index);
+            return;
+        default:
+            Assume(UNREACHED);
+        }
+    });
+}
+
 void
 JavascriptMap::SetOnEmptyMap(Var key, Var value)
 {
@@ -531,9 +555,9 @@ JavascriptMap::SetOnEmptyMap(Var key, Var value)
         SimpleVarDataMap* newSimpleMap = RecyclerNew(this->GetRecycler(), SimpleVarDataMap, this->GetRecycler());
         MapDataKeyValuePair simplePair(simpleVar, value);
 
-        MapDataNode* node = this->list.Append(simplePair, this->GetRecycler());
+        uint index = this->AppendToList(simplePair);
 
-        newSimpleMap->Add(simpleVar, node);
+        newSimpleMap->Add(simpleVar, index);
 
         this->u.simpleVarMap = newSimpleMap;
         this->kind = MapKind::SimpleVarMap;
@@ -543,9 +567,9 @@ JavascriptMap::SetOnEmptyMap(Var key, Var value)
     ComplexVarDataMap* newComplexSet = RecyclerNew(this->GetRecycler(), ComplexVarDataMap, this->GetRecycler());
     MapDataKeyValuePair complexPair(key, value);
 
-    MapDataNode* node = this->list.Append(complexPair, this->GetRecycler());
+    uint index = this->AppendToList(complexPair);
 
-    newComplexSet->Add(key, node);
+    newComplexSet->Add(key, index);
 
     this->u.complexVarMap = newComplexSet;
     this->kind = MapKind::ComplexVarMap;
@@ -562,16 +586,16 @@ JavascriptMap::TrySetOnSimpleVarMap(Var key, Var value)
         return false;
     }
 
-    MapDataNode* node = nullptr;
-    if (this->u.simpleVarMap->TryGetValue(simpleVar, &node))
+    uint index = 0;
+    if (this->u.simpleVarMap->TryGetValue(simpleVar, &index))
     {
-        node->data = MapDataKeyValuePair(simpleVar, value);
+        this->list.SetItem(index, MapDataKeyValuePair(simpleVar, value));
         return true;
     }
 
     MapDataKeyValuePair pair(simpleVar, value);
-    MapDataNode* newNode = this->list.Append(pair, this->GetRecycler());
-    this->u.simpleVarMap->Add(simpleVar, newNode);
+    uint newIndex = this->AppendToList(pair);
+    this->u.simpleVarMap->Add(simpleVar, newIndex);
     return true;
 }
 
@@ -580,16 +604,16 @@ JavascriptMap::SetOnComplexVarMap(Var key, Var value)
 {
     Assert(this->kind == MapKind::ComplexVarMap);
 
-    MapDataNode* node = nullptr;
-    if (this->u.complexVarMap->TryGetValue(key, &node))
+    uint index = 0;
+    if (this->u.complexVarMap->TryGetValue(key, &index))
     {
-        node->data = MapDataKeyValuePair(key, value);
+        this->list.SetItem(index, MapDataKeyValuePair(key, value));
         return;
     }
 
     MapDataKeyValuePair pair(key, value);
-    MapDataNode* newNode = this->list.Append(pair, this->GetRecycler());
-    this->u.complexVarMap->Add(key, newNode);
+    uint newIndex = this->AppendToList(pair);
+    this->u.complexVarMap->Add(key, newIndex);
 }
 
 void
@@ -10,10 +10,10 @@ namespace Js
     {
     public:
         typedef JsUtil::KeyValuePair<Field(Var), Field(Var)> MapDataKeyValuePair;
-        typedef MapOrSetDataNode<MapDataKeyValuePair> MapDataNode;
         typedef MapOrSetDataList<MapDataKeyValuePair> MapDataList;
-        typedef JsUtil::BaseDictionary<Var, MapDataNode*, Recycler> SimpleVarDataMap;
-        typedef JsUtil::BaseDictionary<Var, MapDataNode*, Recycler, PowerOf2SizePolicy, SameValueZeroComparer> ComplexVarDataMap;
+        // Keys map to the index of their entry in the list
+        typedef JsUtil::BaseDictionary<Var, uint, Recycler> SimpleVarDataMap;
+        typedef JsUtil::BaseDictionary<Var, uint, Recycler, PowerOf2SizePolicy, SameValueZeroComparer> ComplexVarDataMap;
 
     private:
         enum class MapKind : uint8
@@ -55,6 +55,8 @@ namespace Js
         void SetOnComplexVarMap(Var key, Var value);
 
         void PromoteToComplexVarMap();
+
+        uint AppendToList(const MapDataKeyValuePair& pair);
     public:
         JavascriptMap(DynamicType* type);
 
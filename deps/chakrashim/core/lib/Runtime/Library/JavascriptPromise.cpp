@@ -520,7 +520,13 @@ namespace Js
             x = scriptContext->GetLibrary()->GetUndefined();
         }
 
-        // 3. If IsPromise(x) is true,
+        return PromiseResolve(constructor, x, scriptContext);
+    }
+
+    // PromiseResolve as described in the draft ES 2019 #sec-promise-resolve
+    Var JavascriptPromise::PromiseResolve(Var constructor, Var x, ScriptContext* scriptContext)
+    {
+        // 2. If IsPromise(x) is true,
         if (JavascriptPromise::Is(x))
         {
             // a. Let xConstructor be Get(x, "constructor").
@@ -533,9 +539,9 @@ namespace Js
             }
         }
 
-        // 4. Let promiseCapability be NewPromiseCapability(C).
-        // 5. Perform ? Call(promiseCapability.[[Resolve]], undefined, << x >>).
-        // 6. Return promiseCapability.[[Promise]].
+        // 3. Let promiseCapability be NewPromiseCapability(C).
+        // 4. Perform ? Call(promiseCapability.[[Resolve]], undefined, << x >>).
+        // 5. Return promiseCapability.[[Promise]].
         return CreateResolvedPromise(x, scriptContext, constructor);
     }
 
@@ -934,7 +940,7 @@ namespace Js
         {
 
             bool isPromiseRejectionHandled = true;
-            if (scriptContext->IsScriptContextInDebugMode())
+            if (promiseCapability != nullptr && scriptContext->IsScriptContextInDebugMode())
             {
                 // only necessary to determine if false if debugger is attached.  This way we'll 
                 // correctly break on exceptions raised in promises that result in uhandled rejection
@@ -965,6 +971,12 @@ namespace Js
             }
         }
 
+        if (promiseCapability == nullptr)
+        {
+            // There is no derived promise to settle, see PerformPromiseThen.
+            return undefinedVar;
+        }
+
         if (exception != nullptr)
         {
             return TryRejectWithExceptionObject(exception, promiseCapability->GetReject(), scriptContext);
@@ -1007,6 +1019,11 @@ namespace Js
                     {
                         JavascriptPromiseReactionPair pair = it.Data();
                         JavascriptPromiseReaction* reaction = pair.rejectReaction;
+                        if (reaction->GetCapabilities() == nullptr)
+                        {
+                            // Internal reactions, like the ones of await, handle the rejection themselves.
+                            continue;
+                        }
                         Var promiseVar = reaction->GetCapabilities()->GetPromise();
 
                         if (JavascriptPromise::Is(promiseVar))
@@ -1131,6 +1148,16 @@ namespace Js
             return NewPromiseCapability(constructor, scriptContext);
         });
 
+        PerformPromiseThen(sourcePromise, promiseCapability, fulfillmentHandler, rejectionHandler, scriptContext);
+
+        return promiseCapability->GetPromise();
+    }
+
+    // PerformPromiseThen as described in the draft ES 2019 #sec-performpromisethen
+    // A null promiseCapability is only used internally, for reactions whose result
+    // nobody can observe.
+    void JavascriptPromise::PerformPromiseThen(JavascriptPromise* sourcePromise, JavascriptPromiseCapability* promiseCapability, RecyclableObject* fulfillmentHandler, RecyclableObject* rejectionHandler, ScriptContext* scriptContext)
+    {
         JavascriptPromiseReaction* resolveReaction = JavascriptPromiseReaction::New(promiseCapability, fulfillmentHandler, scriptContext);
         JavascriptPromiseReaction* rejectReaction = JavascriptPromiseReaction::New(promiseCapability, rejectionHandler, scriptContext);
 
@@ -1161,8 +1188,6 @@ namespace Js
         }
 
         sourcePromise->SetIsHandled();
-
-        return promiseCapability->GetPromise();
     }
 
     // Promise Resolve Thenable Job as described in ES 2015 Section 25.4.2.2
@@ -1462,12 +1487,23 @@ namespace Js
         JavascriptPromiseAsyncSpawnStepArgumentExecutorFunction* successFunction = library->CreatePromiseAsyncSpawnStepArgumentExecutorFunction(EntryJavascriptPromiseAsyncSpawnCallStepExecutorFunction, gen, undefinedVar, resolve, reject);
         JavascriptPromiseAsyncSpawnStepArgumentExecutorFunction* failFunction = library->CreatePromiseAsyncSpawnStepArgumentExecutorFunction(EntryJavascriptPromiseAsyncSpawnCallStepExecutorFunction, gen, undefinedVar, resolve, reject, true);
 
-        JavascriptFunction* promiseResolve = library->EnsurePromiseResolveFunction();
         value = JavascriptOperators::GetProperty(next, PropertyIds::value, scriptContext);
-        Var promiseVar = CALL_FUNCTION(scriptContext->GetThreadContext(), promiseResolve, CallInfo(CallFlags_Value, 2), library->GetPromiseConstructor(), value);
+        Var promiseVar = PromiseResolve(library->GetPromiseConstructor(), value, scriptContext);
         JavascriptPromise* promise = FromVar(promiseVar);
 
         Var promiseThen = JavascriptOperators::GetProperty(promise, PropertyIds::then, scriptContext);
+        if (promiseThen == library->EnsurePromiseThenFunction()
+#if ENABLE_TTD
+            && !scriptContext->IsTTDRecordOrReplayModeEnabled()
+#endif
+            )
+        {
+            // Nothing can observe the promise then() would return, so react to the awaited promise
+            // directly instead of building one along with its capability and resolving functions.
+            PerformPromiseThen(promise, nullptr, successFunction, failFunction, scriptContext);
+            return;
+        }
+
         if (!JavascriptConversion::IsCallable(promiseThen))
         {
             JavascriptError::ThrowTypeError(scriptContext, JSERR_NeedFunction);
@@ -114,6 +114,30 @@ namespace Js
             newProxy;
     }
 
+    JavascriptProxy* JavascriptProxy::CreateNative(ScriptContext* scriptContext, RecyclableObject* target, NativeTrap const* traps, void* callbackState)
+    {
+        Assert(!JavascriptProxy::Is(target) || !JavascriptProxy::FromVar(target)->IsRevoked());
+
+        Recycler* recycler = scriptContext->GetRecycler();
+        NativeTraps* nativeTraps = RecyclerNewStructLeaf(recycler, NativeTraps);
+        for (int i = 0; i < NativeTrapCount; i++)
+        {
+            nativeTraps->traps[i] = traps[i];
+        }
+        nativeTraps->callbackState = callbackState;
+
+        // Operations without a native trap go to the target, as they would with an empty handler.
+        RecyclableObject* handler = scriptContext->GetLibrary()->CreateObject();
+        JavascriptProxy* newProxy = RecyclerNew(recycler, JavascriptProxy, scriptContext->GetLibrary()->GetProxyType(), scriptContext, target, handler);
+        newProxy->nativeTraps = nativeTraps;
+        if (JavascriptConversion::IsCallable(target))
+        {
+            newProxy->ChangeType();
+            newProxy->GetDynamicType()->SetEntryPoint(JavascriptProxy::FunctionCallTrap);
+        }
+        return newProxy;
+    }
+
     Var JavascriptProxy::EntryRevocable(RecyclableObject* function, CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -176,7 +200,8 @@ namespace Js
     JavascriptProxy::JavascriptProxy(DynamicType * type) :
         DynamicObject(type),
         handler(nullptr),
-        target(nullptr)
+        target(nullptr),
+        nativeTraps(nullptr)
     {
         type->SetHasSpecialPrototype(true);
     }
@@ -184,7 +209,8 @@ namespace Js
     JavascriptProxy::JavascriptProxy(DynamicType * type, ScriptContext * scriptContext, RecyclableObject* target, RecyclableObject* handler) :
         DynamicObject(type),
         handler(handler),
-        target(target)
+        target(target),
+        nativeTraps(nullptr)
     {
         type->SetHasSpecialPrototype(true);
     }
@@ -223,11 +249,12 @@ namespace Js
         Assert((static_cast<DynamicType*>(GetType()))->GetTypeHandler()->GetPropertyCount() == 0 ||
             (static_cast<DynamicType*>(GetType()))->GetTypeHandler()->GetPropertyId(GetScriptContext(), 0) == InternalPropertyIds::WeakMapKeyMap);
 
-        JavascriptFunction* gOPDMethod = GetMethodHelper(PropertyIds::getOwnPropertyDescriptor, requestContext);
+        NativeTrap gOPDNativeMethod;
+        JavascriptFunction* gOPDMethod = GetMethodHelper(PropertyIds::getOwnPropertyDescriptor, NativeTrap_GetOwnPropertyDescriptor, &gOPDNativeMethod, requestContext);
 
         //7. If trap is undefined, then
         //    a.Return the result of calling the[[GetOwnProperty]] internal method of target with argument P.
-        if (nullptr == gOPDMethod || GetScriptContext()->IsHeapEnumInProgress())
+        if ((nullptr == gOPDMethod && nullptr == gOPDNativeMethod) || GetScriptContext()->IsHeapEnumInProgress())
         {
             resultDescriptor->SetFromProxy(false);
             return JavascriptOperators::GetOwnPropertyDescriptor(targetObj, propertyId, requestContext, resultDescriptor);
@@ -240,10 +267,19 @@ namespace Js
         //9. ReturnIfAbrupt(trapResultObj).
         //10. If Type(trapResultObj) is neither Object nor Undefined, then throw a TypeError exception.
 
-        Var getResult = threadContext->ExecuteImplicitCall(gOPDMethod, ImplicitCall_Accessor, [=]()->Js::Var
+        Var getResult;
+        if (nullptr != gOPDNativeMethod)
         {
-            return CALL_FUNCTION(threadContext, gOPDMethod, CallInfo(CallFlags_Value, 3), handlerObj, targetObj, propertyName);
-        });
+            Var args[] = { handlerObj, targetObj, propertyName };
+            getResult = CallNativeTrap(gOPDNativeMethod, args, _countof(args), requestContext);
+        }
+        else
+        {
+            getResult = threadContext->ExecuteImplicitCall(gOPDMethod, ImplicitCall_Accessor, [=]()->Js::Var
+            {
+                return CALL_FUNCTION(threadContext, gOPDMethod, CallInfo(CallFlags_Value, 3), handlerObj, targetObj, propertyName);
+            });
+        }
 
         TypeId getResultTypeId = JavascriptOperators::GetTypeId(getResult);
         if (StaticType::Is(getResultTypeId) && getResultTypeId != TypeIds_Undefined)
@@ -343,9 +379,10 @@ namespace Js
 
         RecyclableObject *targetObj = this->MarshalTarget(requestContext);
 
-        JavascriptFunction* getGetMethod = GetMethodHelper(PropertyIds::get, requestContext);
+        NativeTrap getGetNativeMethod;
+        JavascriptFunction* getGetMethod = GetMethodHelper(PropertyIds::get, NativeTrap_Get, &getGetNativeMethod, requestContext);
 
-        if (nullptr == getGetMethod || requestContext->IsHeapEnumInProgress())
+        if ((nullptr == getGetMethod && nullptr == getGetNativeMethod) || requestContext->IsHeapEnumInProgress())
         {
             propertyDescriptor->SetFromProxy(false);
             return fn(targetObj);
@@ -355,10 +392,19 @@ namespace Js
         propertyDescriptor->SetFromProxy(true);
         Var propertyName = GetName(requestContext, propertyId);
 
-        Var getGetResult = threadContext->ExecuteImplicitCall(getGetMethod, ImplicitCall_Accessor, [=]()->Js::Var
+        Var getGetResult;
+        if (nullptr != getGetNativeMethod)
         {
-            return CALL_FUNCTION(threadContext, getGetMethod, CallInfo(CallFlags_Value, 4), handlerObj, targetObj, propertyName, instance);
-        });
+            Var args[] = { handlerObj, targetObj, propertyName, instance };
+            getGetResult = CallNativeTrap(getGetNativeMethod, args, _countof(args), requestContext);
+        }
+        else
+        {
+            getGetResult = threadContext->ExecuteImplicitCall(getGetMethod, ImplicitCall_Accessor, [=]()->Js::Var
+            {
+                return CALL_FUNCTION(threadContext, getGetMethod, CallInfo(CallFlags_Value, 4), handlerObj, targetObj, propertyName, instance);
+            });
+        }
 
         //    9. Let targetDesc be the result of calling the[[GetOwnProperty]] internal method of target with argument P.
         //    10. ReturnIfAbrupt(targetDesc).
@@ -426,9 +472,10 @@ namespace Js
 
         Js::RecyclableObject *targetObj = this->MarshalTarget(requestContext);
 
-        JavascriptFunction* hasMethod = GetMethodHelper(PropertyIds::has, requestContext);
+        NativeTrap hasNativeMethod;
+        JavascriptFunction* hasMethod = GetMethodHelper(PropertyIds::has, NativeTrap_Has, &hasNativeMethod, requestContext);
 
-        if (nullptr == hasMethod || requestContext->IsHeapEnumInProgress())
+        if ((nullptr == hasMethod && nullptr == hasNativeMethod) || requestContext->IsHeapEnumInProgress())
         {
             return fn(targetObj);
         }
@@ -436,10 +483,19 @@ namespace Js
         PropertyId propertyId = getPropertyId();
         Var propertyName = GetName(requestContext, propertyId);
 
-        Var getHasResult = threadContext->ExecuteImplicitCall(hasMethod, ImplicitCall_Accessor, [=]()->Js::Var
+        Var getHasResult;
+        if (nullptr != hasNativeMethod)
         {
-            return CALL_FUNCTION(threadContext, hasMethod, CallInfo(CallFlags_Value, 3), handlerObj, targetObj, propertyName);
-        });
+            Var args[] = { handlerObj, targetObj, propertyName };
+            getHasResult = CallNativeTrap(hasNativeMethod, args, _countof(args), requestContext);
+        }
+        else
+        {
+            getHasResult = threadContext->ExecuteImplicitCall(hasMethod, ImplicitCall_Accessor, [=]()->Js::Var
+            {
+                return CALL_FUNCTION(threadContext, hasMethod, CallInfo(CallFlags_Value, 3), handlerObj, targetObj, propertyName);
+            });
+        }
 
         //9. Let booleanTrapResult be ToBoolean(trapResult).
         //10. ReturnIfAbrupt(booleanTrapResult).
@@ -797,12 +853,13 @@ namespace Js
         RecyclableObject * targetObj = this->MarshalTarget(requestContext);
 
         //5. Let trap be the result of GetMethod(handler, "deleteProperty").
-        JavascriptFunction* deleteMethod = GetMethodHelper(PropertyIds::deleteProperty, requestContext);
+        NativeTrap deleteNativeMethod;
+        JavascriptFunction* deleteMethod = GetMethodHelper(PropertyIds::deleteProperty, NativeTrap_DeleteProperty, &deleteNativeMethod, requestContext);
 
         //7. If trap is undefined, then
         //a.Return the result of calling the[[Delete]] internal method of target with argument P.
         Assert(!GetScriptContext()->IsHeapEnumInProgress());
-        if (nullptr == deleteMethod)
+        if (nullptr == deleteMethod && nullptr == deleteNativeMethod)
         {
             uint32 indexVal;
             if (requestContext->IsNumericPropertyId(propertyId, &indexVal))
@@ -821,10 +878,19 @@ namespace Js
 
         Var propertyName = GetName(requestContext, propertyId);
 
-        Var deletePropertyResult = threadContext->ExecuteImplicitCall(deleteMethod, ImplicitCall_Accessor, [=]()->Js::Var
+        Var deletePropertyResult;
+        if (nullptr != deleteNativeMethod)
         {
-            return CALL_FUNCTION(threadContext, deleteMethod, CallInfo(CallFlags_Value, 3), handlerObj, targetObj, propertyName);
-        });
+            Var args[] = { handlerObj, targetObj, propertyName };
+            deletePropertyResult = CallNativeTrap(deleteNativeMethod, args, _countof(args), requestContext);
+        }
+        else
+        {
+            deletePropertyResult = threadContext->ExecuteImplicitCall(deleteMethod, ImplicitCall_Accessor, [=]()->Js::Var
+            {
+                return CALL_FUNCTION(threadContext, deleteMethod, CallInfo(CallFlags_Value, 3), handlerObj, targetObj, propertyName);
+            });
+        }
 
         BOOL trapResult = JavascriptConversion::ToBoolean(deletePropertyResult, requestContext);
         if (!trapResult)
@@ -1708,10 +1774,11 @@ namespace Js
         //6. ReturnIfAbrupt(trap).
         //7. If trap is undefined, then
         //a.Return the result of calling the[[DefineOwnProperty]] internal method of target with arguments P and Desc.
-        JavascriptFunction* defineOwnPropertyMethod = proxy->GetMethodHelper(PropertyIds::defineProperty, requestContext);
+        NativeTrap defineOwnPropertyNativeMethod;
+        JavascriptFunction* defineOwnPropertyMethod = proxy->GetMethodHelper(PropertyIds::defineProperty, NativeTrap_DefineProperty, &defineOwnPropertyNativeMethod, requestContext);
 
         Assert(!requestContext->IsHeapEnumInProgress());
-        if (nullptr == defineOwnPropertyMethod)
+        if (nullptr == defineOwnPropertyMethod && nullptr == defineOwnPropertyNativeMethod)
         {
             return JavascriptOperators::DefineOwnPropertyDescriptor(targetObj, propId, descriptor, throwOnError, requestContext);
         }
@@ -1732,10 +1799,19 @@ namespace Js
 
         Var propertyName = GetName(requestContext, propId);
 
-        Var definePropertyResult = threadContext->ExecuteImplicitCall(defineOwnPropertyMethod, ImplicitCall_Accessor, [=]()->Js::Var
+        Var definePropertyResult;
+        if (nullptr != defineOwnPropertyNativeMethod)
         {
-            return CALL_FUNCTION(threadContext, defineOwnPropertyMethod, CallInfo(CallFlags_Value, 4), handlerObj, targetObj, propertyName, descVar);
-        });
+            Var args[] = { handlerObj, targetObj, propertyName, descVar };
+            definePropertyResult = proxy->CallNativeTrap(defineOwnPropertyNativeMethod, args, _countof(args), requestContext);
+        }
+        else
+        {
+            definePropertyResult = threadContext->ExecuteImplicitCall(defineOwnPropertyMethod, ImplicitCall_Accessor, [=]()->Js::Var
+            {
+                return CALL_FUNCTION(threadContext, defineOwnPropertyMethod, CallInfo(CallFlags_Value, 4), handlerObj, targetObj, propertyName, descVar);
+            });
+        }
 
         BOOL defineResult = JavascriptConversion::ToBoolean(definePropertyResult, requestContext);
         if (!defineResult)
@@ -1821,10 +1897,11 @@ namespace Js
         //6. ReturnIfAbrupt(trap).
         //7. If trap is undefined, then
         //a.Return the result of calling the[[Set]] internal method of target with arguments P, V, and Receiver.
-        JavascriptFunction* setMethod = GetMethodHelper(PropertyIds::set, requestContext);
+        NativeTrap setNativeMethod;
+        JavascriptFunction* setMethod = GetMethodHelper(PropertyIds::set, NativeTrap_Set, &setNativeMethod, requestContext);
 
         Assert(!GetScriptContext()->IsHeapEnumInProgress());
-        if (nullptr == setMethod)
+        if (nullptr == setMethod && nullptr == setNativeMethod)
         {
             PropertyValueInfo info;
             switch (setPropertyTrapKind)
@@ -1863,10 +1940,19 @@ namespace Js
 
         Var propertyName = GetName(requestContext, propertyId);
         
-        Var setPropertyResult = threadContext->ExecuteImplicitCall(setMethod, ImplicitCall_Accessor, [=]()->Js::Var
+        Var setPropertyResult;
+        if (nullptr != setNativeMethod)
         {
-            return CALL_FUNCTION(threadContext, setMethod, CallInfo(CallFlags_Value, 5), handlerObj, targetObj, propertyName, newValue, receiver);
-        });
+            Var args[] = { handlerObj, targetObj, propertyName, newValue, receiver };
+            setPropertyResult = CallNativeTrap(setNativeMethod, args, _countof(args), requestContext);
+        }
+        else
+        {
+            setPropertyResult = threadContext->ExecuteImplicitCall(setMethod, ImplicitCall_Accessor, [=]()->Js::Var
+            {
+                return CALL_FUNCTION(threadContext, setMethod, CallInfo(CallFlags_Value, 5), handlerObj, targetObj, propertyName, newValue, receiver);
+            });
+        }
         
         BOOL setResult = JavascriptConversion::ToBoolean(setPropertyResult, requestContext);
         if (!setResult)
@@ -1916,7 +2002,7 @@ namespace Js
 
     }
 
-    JavascriptFunction* JavascriptProxy::GetMethodHelper(PropertyId methodId, ScriptContext* requestContext)
+    JavascriptFunction* JavascriptProxy::GetMethodHelper(PropertyId methodId, ScriptContext* requestContext, PolymorphicInlineCache* trapCache)
     {
         //2. Let handler be the value of the[[ProxyHandler]] internal slot of O.
         //3. If handler is null, then throw a TypeError exception.
@@ -1938,7 +2024,34 @@ namespace Js
         //  3. If func is either undefined or null, return undefined.
         //  4. If IsCallable(func) is false, throw a TypeError exception.
         //  5. Return func.
-        BOOL result = JavascriptOperators::GetPropertyReference(handler, methodId, &varMethod, requestContext);
+        BOOL result;
+        if (trapCache != nullptr)
+        {
+            // Handlers are usually created the same way, so a handler with a type seen before finds the trap
+            // through the cache. Changes to the handler or its prototype chain invalidate the cache as usual.
+            PropertyValueInfo info;
+            PropertyValueInfo::SetCacheInfo(&info, trapCache, false);
+            result = CacheOperators::TryGetProperty<
+                true,                                       // CheckLocal
+                true,                                       // CheckProto
+                true,                                       // CheckAccessor
+                false,                                      // CheckMissing
+                true,                                       // CheckPolymorphicInlineCache
+                true,                                       // CheckTypePropertyCache
+                false,                                      // IsInlineCacheAvailable
+                true,                                       // IsPolymorphicInlineCacheAvailable
+                false,                                      // ReturnOperationInfo
+                false>                                      // OutputExistence
+                (handler, false, handler, methodId, &varMethod, requestContext, nullptr, &info);
+            if (!result)
+            {
+                result = JavascriptOperators::GetPropertyReference(handler, methodId, &varMethod, requestContext, &info);
+            }
+        }
+        else
+        {
+            result = JavascriptOperators::GetPropertyReference(handler, methodId, &varMethod, requestContext);
+        }
         if (!result || JavascriptOperators::IsUndefinedOrNull(varMethod))
         {
             return nullptr;
@@ -1954,6 +2067,61 @@ namespace Js
           function, function->GetScriptContext()));
     }
 
+    JavascriptFunction* JavascriptProxy::GetMethodHelper(PropertyId methodId, NativeTrapKind nativeTrapKind, NativeTrap* nativeTrap, ScriptContext* requestContext)
+    {
+        // The handler of a native proxy is an empty object script can't reach, so only the native trap matters.
+        if (this->nativeTraps != nullptr && this->handler != nullptr)
+        {
+            *nativeTrap = this->nativeTraps->traps[nativeTrapKind];
+            return nullptr;
+        }
+
+        *nativeTrap = nullptr;
+        return GetMethodHelper(methodId, requestContext, requestContext->GetLibrary()->GetProxyTrapCache(nativeTrapKind));
+    }
+
+    Var JavascriptProxy::CallNativeTrap(NativeTrap nativeTrap, Var* args, USHORT argCount, ScriptContext* requestContext)
+    {
+        Assert(this->nativeTraps != nullptr);
+
+        // The host runs in the proxy's context, just like a trap function created there would.
+        ScriptContext* scriptContext = GetScriptContext();
+        ThreadContext* threadContext = scriptContext->GetThreadContext();
+        for (USHORT i = 0; i < argCount; i++)
+        {
+            args[i] = CrossSite::MarshalVar(scriptContext, args[i]);
+        }
+
+        void* callbackState = this->nativeTraps->callbackState;
+        Var result = threadContext->ExecuteImplicitCall(this, ImplicitCall_Accessor, [=]()->Js::Var
+        {
+            Var trapResult = nullptr;
+            BEGIN_LEAVE_SCRIPT(scriptContext)
+            {
+                trapResult = nativeTrap(this, false, args, argCount, callbackState);
+            }
+            END_LEAVE_SCRIPT(scriptContext);
+
+            if (scriptContext->HasRecordedException())
+            {
+                bool considerPassingToDebugger = false;
+                JavascriptExceptionObject* recordedException = scriptContext->GetAndClearRecordedException(&considerPassingToDebugger);
+                if (recordedException != nullptr)
+                {
+                    if (recordedException == threadContext->GetPendingTerminatedErrorObject())
+                    {
+                        throw Js::ScriptAbortException();
+                    }
+                    JavascriptExceptionOperators::RethrowExceptionObject(recordedException, scriptContext, considerPassingToDebugger);
+                }
+            }
+
+            return trapResult != nullptr ? trapResult : scriptContext->GetLibrary()->GetUndefined();
+        });
+
+        return CrossSite::MarshalVar(requestContext, result);
+    }
+
     Var JavascriptProxy::GetValueFromDescriptor(Var instance, PropertyDescriptor propertyDescriptor, ScriptContext* requestContext)
     {
         if (propertyDescriptor.ValueSpecified())
@@ -2302,12 +2470,13 @@ namespace Js
         //6. ReturnIfAbrupt(trap).
         //7. If trap is undefined, then
         //      a. Return target.[[OwnPropertyKeys]]().
-        JavascriptFunction* ownKeysMethod = GetMethodHelper(PropertyIds::ownKeys, requestContext);
+        NativeTrap ownKeysNativeMethod;
+        JavascriptFunction* ownKeysMethod = GetMethodHelper(PropertyIds::ownKeys, NativeTrap_OwnKeys, &ownKeysNativeMethod, requestContext);
         Assert(!GetScriptContext()->IsHeapEnumInProgress());
 
         JavascriptArray *targetKeys;
 
-        if (nullptr == ownKeysMethod)
+        if (nullptr == ownKeysMethod && nullptr == ownKeysNativeMethod)
         {
             switch (keysTrapKind)
             {
@@ -2335,10 +2504,19 @@ namespace Js
         //13. Let targetKeys be target.[[OwnPropertyKeys]]().
         //14. ReturnIfAbrupt(targetKeys).
         
-        Var ownKeysResult = threadContext->ExecuteImplicitCall(ownKeysMethod, ImplicitCall_Accessor, [=]()->Js::Var
+        Var ownKeysResult;
+        if (nullptr != ownKeysNativeMethod)
         {
-            return CALL_FUNCTION(threadContext, ownKeysMethod, CallInfo(CallFlags_Value, 2), handlerObj, targetObj);
-        });
+            Var args[] = { handlerObj, targetObj };
+            ownKeysResult = CallNativeTrap(ownKeysNativeMethod, args, _countof(args), requestContext);
+        }
+        else
+        {
+            ownKeysResult = threadContext->ExecuteImplicitCall(ownKeysMethod, ImplicitCall_Accessor, [=]()->Js::Var
+            {
+                return CALL_FUNCTION(threadContext, ownKeysMethod, CallInfo(CallFlags_Value, 2), handlerObj, targetObj);
+            });
+        }
 
         if (!JavascriptOperators::IsObject(ownKeysResult))
         {
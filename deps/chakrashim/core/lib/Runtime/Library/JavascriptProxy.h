@@ -22,6 +22,29 @@ namespace Js
         void RevokeObject();
     public:
         static const uint32 MAX_STACK_CALL_ARGUMENT_COUNT = 20;
+
+        // Traps a host can implement natively instead of as handler methods. They are
+        // called directly with the same arguments a handler method would get, without
+        // looking anything up on the handler.
+        enum NativeTrapKind {
+            NativeTrap_GetOwnPropertyDescriptor,
+            NativeTrap_DefineProperty,
+            NativeTrap_Has,
+            NativeTrap_Get,
+            NativeTrap_Set,
+            NativeTrap_DeleteProperty,
+            NativeTrap_OwnKeys,
+            NativeTrapCount
+        };
+        typedef Var (__stdcall *NativeTrap)(Var callee, bool isConstructCall, Var *args, USHORT cargs, void *callbackState);
+        struct NativeTraps
+        {
+            FieldNoBarrier(NativeTrap) traps[NativeTrapCount];
+            FieldNoBarrier(void*) callbackState;
+        };
+    private:
+        Field(NativeTraps*) nativeTraps;
+    public:
         class EntryInfo
         {
         public:
@@ -67,6 +90,7 @@ namespace Js
 
         static Var FunctionCallTrap(RecyclableObject* function, CallInfo callInfo, ...);
         static JavascriptProxy* Create(ScriptContext* scriptContext, Arguments args);
+        static JavascriptProxy* CreateNative(ScriptContext* scriptContext, RecyclableObject* target, NativeTrap const* traps, void* callbackState);
 
         static BOOL GetOwnPropertyDescriptor(RecyclableObject* obj, PropertyId propertyId, ScriptContext* requestContext, PropertyDescriptor* propertyDescriptor);
         static BOOL DefineOwnPropertyDescriptor(RecyclableObject* obj, PropertyId propId, const PropertyDescriptor& descriptor, bool throwOnError, ScriptContext* requestContext);
@@ -202,7 +226,9 @@ namespace Js
 #endif
 
     private:
-        JavascriptFunction* GetMethodHelper(PropertyId methodId, ScriptContext* requestContext);
+        JavascriptFunction* GetMethodHelper(PropertyId methodId, ScriptContext* requestContext, PolymorphicInlineCache* trapCache = nullptr);
+        JavascriptFunction* GetMethodHelper(PropertyId methodId, NativeTrapKind nativeTrapKind, NativeTrap* nativeTrap, ScriptContext* requestContext);
+        Var CallNativeTrap(NativeTrap nativeTrap, Var* args, USHORT argCount, ScriptContext* requestContext);
         Var GetValueFromDescriptor(Var instance, PropertyDescriptor propertyDescriptor, ScriptContext* requestContext);
         static Var GetName(ScriptContext* requestContext, PropertyId propertyId);
 
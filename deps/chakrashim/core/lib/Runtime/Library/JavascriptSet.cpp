@@ -210,6 +210,7 @@ Var JavascriptSet::EntryForEach(RecyclableObject* function, CallInfo callInfo, .
 
 Var JavascriptSet::EntryHas(RecyclableObject* function, CallInfo callInfo, ...)
 {
+    JIT_HELPER_REENTRANT_HEADER(Set_Has);
     PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
     ARGUMENTS(args, callInfo);
@@ -226,6 +227,7 @@ Var JavascriptSet::EntryHas(RecyclableObject* function, CallInfo callInfo, ...)
     bool hasValue = set->Has(value);
 
     return scriptContext->GetLibrary()->CreateBoolean(hasValue);
+    JIT_HELPER_END(Set_Has);
 }
 
 Var JavascriptSet::EntrySizeGetter(RecyclableObject* function, CallInfo callInfo, ...)
@@ -293,12 +295,10 @@ JavascriptSet::CreateVarSetFromList(uint initialCapacity)
 {
     T* varSet = RecyclerNew(this->GetRecycler(), T, this->GetRecycler(), initialCapacity);
 
-    JavascriptSet::SetDataList::Iterator iter = this->list.GetIterator();
-    // TODO: we can use a more efficient Iterator, since we know there will be no side effects
-    while (iter.Next())
+    this->list.Map([&](uint index, Var value)
     {
-        varSet->Add(iter.Current(), iter.CurrentNode());
-    }
+        varSet->Add(value, index);
+    });
     return varSet;
 }
 
@@ -331,6 +331,27 @@ JavascriptSet::PromoteToComplexVarSet()
     this->u.complexVarSet = newSet;
 }
 
+uint
+JavascriptSet::AppendToList(Var value)
+{
+    return this->list.Append(value, this->GetRecycler(), [this](uint index, Var movedValue)
+    {
+        // The list compacted its entries to make room; keep the values pointing at them. Int sets never remove
+        // entries (deleting promotes them first), so they never compact.
+        switch (this->kind)
+        {
+        case SetKind::SimpleVarSet:
+            this->u.simpleVarSet->Item(movedValue, index);
+            return;
+        case SetKind::ComplexVarSet:
+            this->u.complexVarSet->Item(movedValue, index);
+            return;
+        default:
+            Assume(UNREACHED);
+        }
+    });
+}
+
 void
 JavascriptSet::AddToEmptySet(Var value)
 {
@@ -344,7 +365,7 @@ JavascriptSet::AddToEmptySet(Var value)
         BVSparse<Recycler>* newIntSet = RecyclerNew(this->GetRecycler(), BVSparse<Recycler>, this->GetRecycler());
         newIntSet->Set(intVal);
 
-        this->list.Append(taggedInt, this->GetRecycler());
+        this->AppendToList(taggedInt);
 
         this->u.intSet = newIntSet;
         this->kind = SetKind::IntSet;
@@ -355,9 +376,9 @@ JavascriptSet::AddToEmptySet(Var value)
     if (simpleVar)
     {
         SimpleVarDataSet* newSimpleSet = RecyclerNew(this->GetRecycler(), SimpleVarDataSet, this->GetRecycler());
-        SetDataNode* node = this->list.Append(simpleVar, this->GetRecycler());
+        uint index = this->AppendToList(simpleVar);
 
-        newSimpleSet->Add(simpleVar, node);
+        newSimpleSet->Add(simpleVar, index);
 
         this->u.simpleVarSet = newSimpleSet;
         this->kind = SetKind::SimpleVarSet;
@@ -365,9 +386,9 @@ JavascriptSet::AddToEmptySet(Var value)
     }
 
     ComplexVarDataSet* newComplexSet = RecyclerNew(this->GetRecycler(), ComplexVarDataSet, this->GetRecycler());
-    SetDataNode* node = this->list.Append(value, this->GetRecycler());
+    uint index = this->AppendToList(value);
 
-    newComplexSet->Add(value, node);
+    newComplexSet->Add(value, index);
 
     this->u.complexVarSet = newComplexSet;
     this->kind = SetKind::ComplexVarSet;
@@ -386,7 +407,7 @@ JavascriptSet::TryAddToIntSet(Var value)
     int32 intVal = TaggedInt::ToInt32(taggedInt);
     if (!this->u.intSet->TestAndSet(intVal))
     {
-        this->list.Append(taggedInt, this->GetRecycler());
+        this->AppendToList(taggedInt);
     }
     return true;
 }
@@ -403,8 +424,8 @@ JavascriptSet::TryAddToSimpleVarSet(Var value)
 
     if (!this->u.simpleVarSet->ContainsKey(simpleVar))
     {
-        SetDataNode* node = this->list.Append(simpleVar, this->GetRecycler());
-        this->u.simpleVarSet->Add(simpleVar, node);
+        uint index = this->AppendToList(simpleVar);
+        this->u.simpleVarSet->Add(simpleVar, index);
     }
 
     return true;
@@ -416,8 +437,8 @@ JavascriptSet::AddToComplexVarSet(Var value)
     Assert(this->kind == SetKind::ComplexVarSet);
     if (!this->u.complexVarSet->ContainsKey(value))
     {
-        SetDataNode* node = this->list.Append(value, this->GetRecycler());
-        this->u.complexVarSet->Add(value, node);
+        uint index = this->AppendToList(value);
+        this->u.complexVarSet->Add(value, index);
     }
 }
 
@@ -512,15 +533,15 @@ bool
 JavascriptSet::DeleteFromVarSet(Var value)
 {
     Assert(this->kind == (isComplex ? SetKind::ComplexVarSet : SetKind::SimpleVarSet));
-    SetDataNode * node = nullptr;
+    uint index = 0;
     if (isComplex
-        ? !this->u.complexVarSet->TryGetValueAndRemove(value, &node)
-        : !this->u.simpleVarSet->TryGetValueAndRemove(value, &node))
+        ? !this->u.complexVarSet->TryGetValueAndRemove(value, &index)
+        : !this->u.simpleVarSet->TryGetValueAndRemove(value, &index))
     {
         return false;
     }
 
-    this->list.Remove(node);
+    this->list.Remove(index);
     return true;
 }
 
@@ -550,7 +571,7 @@ bool JavascriptSet::Delete(Var value)
         {
             return false;
         }
-        // We don't have the list node pointer readily available, so deletion from int sets would require walking the list
+        // We don't have the list entry index readily available, so deletion from int sets would require walking the list
         // Because of this, let's just promote to a var set
         //
         // If this promotion becomes an issue, we can consider options to improve this, e.g. deferring until an iterator is requested
@@ -582,7 +582,7 @@ namespace Js
             return Concat_OneEmpty(pstLeft, pstRight);
         }
 
-        if(pstLeft->GetLength() != 1 || pstRight->GetLength() != 1)
+        if(pstLeft->GetLength() + pstRight->GetLength() > MaxFlatConcatLength)
         {
 #ifdef PROFILE_STRINGS
             StringProfiler::RecordConcatenation(pstLeft->GetScriptContext(), pstLeft->GetLength(), pstRight->GetLength(), ConcatType_ConcatTree);
@@ -599,7 +599,7 @@ namespace Js
             return ConcatString::New(pstLeft, pstRight);
         }
 
-        return Concat_BothOneChar(pstLeft, pstRight);
+        return Concat_BothShort(pstLeft, pstRight);
     }
 
     JavascriptString* JavascriptString::Concat_Compound(JavascriptString * pstLeft, JavascriptString * pstRight)
@@ -683,30 +683,32 @@ namespace Js
         return pstLeft;
     }
 
-    JavascriptString* JavascriptString::Concat_BothOneChar(JavascriptString * pstLeft, JavascriptString * pstRight)
+    JavascriptString* JavascriptString::Concat_BothShort(JavascriptString * pstLeft, JavascriptString * pstRight)
     {
         Assert(pstLeft);
-        Assert(pstLeft->GetLength() == 1);
         Assert(pstRight);
-        Assert(pstRight->GetLength() == 1);
+
+        const charcount_t leftLength = pstLeft->GetLength();
+        const charcount_t rightLength = pstRight->GetLength();
+        Assert(leftLength + rightLength <= MaxFlatConcatLength);
 
 #ifdef PROFILE_STRINGS
-        StringProfiler::RecordConcatenation(pstLeft->GetScriptContext(), pstLeft->GetLength(), pstRight->GetLength(), ConcatType_BufferString);
+        StringProfiler::RecordConcatenation(pstLeft->GetScriptContext(), leftLength, rightLength, ConcatType_BufferString);
 #endif
         if(PHASE_TRACE_StringConcat)
         {
             Output::Print(
-                _u("JavascriptString::Concat(\"%.8s%s\") - both sides length 1, creating BufferStringBuilder::WritableString\n"),
+                _u("JavascriptString::Concat(\"%.8s%s\") - short result, creating BufferStringBuilder::WritableString\n"),
                 pstRight->IsFinalized() ? pstRight->GetString() : _u(""),
-                !pstRight->IsFinalized() || pstRight->GetLength() > 8 ? _u("...") : _u(""));
+                !pstRight->IsFinalized() || rightLength > 8 ? _u("...") : _u(""));
             Output::Flush();
         }
 
         ScriptContext* scriptContext = pstLeft->GetScriptContext();
-        BufferStringBuilder builder(2, scriptContext);
+        BufferStringBuilder builder(leftLength + rightLength, scriptContext);
         char16 * stringBuffer = builder.DangerousGetWritableBuffer();
-        stringBuffer[0] = *pstLeft->GetString();
-        stringBuffer[1] = *pstRight->GetString();
+        js_wmemcpy_s(stringBuffer, leftLength, pstLeft->GetString(), leftLength);
+        js_wmemcpy_s(stringBuffer + leftLength, rightLength, pstRight->GetString(), rightLength);
         return builder.ToString();
     }
 
@@ -1035,6 +1037,69 @@ namespace Js
         return JavascriptNumber::ToVar(IndexOf(args, scriptContext, _u("String.prototype.indexOf"), true), scriptContext);
     }
 
+    // Index of the first c in the input at or after offset, or -1 if there is none. Blocks of eight characters are
+    // compared at once, as the regex sync instructions do, and the rest one character at a time.
+    static int FindChar(const char16* input, charcount_t length, charcount_t offset, char16 c)
+    {
+        const CharSearch::Block matchC = CharSearch::Splat(c);
+        offset = CharSearch::SkipBlocks(input, offset, length, [&](const char16* block)
+        {
+            return CharSearch::Equal(CharSearch::Load(block), matchC);
+        });
+        for (; offset < length; offset++)
+        {
+            if (input[offset] == c)
+            {
+                return (int)offset;
+            }
+        }
+        return -1;
+    }
+
+    // Index of the first occurrence of the search string in the input at or after offset, or -1 if there is none.
+    // Eight candidate positions at a time are filtered on the first and the last character of the search string,
+    // and only the positions where both match are compared in full. Unlike the Boyer-Moore jump table, this works
+    // for search strings with any characters, and it doesn't depend on the search string being long to skip ahead.
+    static int FindString(const char16* input, charcount_t length, charcount_t offset, const char16* searchStr, charcount_t searchLen)
+    {
+        Assert(searchLen >= 2);
+        if (searchLen > length)
+        {
+            return -1;
+        }
+
+        // One past the last index a match can start at
+        const charcount_t endOffset = length - searchLen + 1;
+        const char16 searchFirst = searchStr[0];
+        const char16 searchLast = searchStr[searchLen - 1];
+        const char16* const inputLast = input + searchLen - 1;
+        const CharSearch::Block matchFirst = CharSearch::Splat(searchFirst);
+        const CharSearch::Block matchLast = CharSearch::Splat(searchLast);
+        const auto candidates = [&](const char16* block)
+        {
+            return CharSearch::And(
+                CharSearch::Equal(CharSearch::Load(block), matchFirst),
+                CharSearch::Equal(CharSearch::Load(block + searchLen - 1), matchLast));
+        };
+
+        while (offset < endOffset)
+        {
+            offset = CharSearch::SkipBlocks(input, offset, endOffset, candidates);
+
+            // Look at the block with a candidate, or at the rest of the input if there is no whole block left
+            const charcount_t blockEnd = endOffset - offset > CharSearch::BlockLength ? offset + CharSearch::BlockLength : endOffset;
+            for (; offset < blockEnd; offset++)
+            {
+                if (input[offset] == searchFirst && inputLast[offset] == searchLast &&
+                    wmemcmp(input + offset + 1, searchStr + 1, searchLen - 2) == 0)
+                {
+                    return (int)offset;
+                }
+            }
+        }
+        return -1;
+    }
+
     int JavascriptString::IndexOf(ArgumentReader& args, ScriptContext* scriptContext, const char16* apiNameForErrorMsg, bool isRegExpAnAllowedArg)
     {
         // The algorithm steps in the spec are the same between String.prototype.indexOf and
@@ -1090,24 +1155,19 @@ namespace Js
             const char16* inputStr = pThis->GetString();
             if (searchLen == 1)
             {
-                int i = position;
-                for(; i < len && inputStr[i] != *searchStr ; i++);
-                if (i < len)
-                {
-                    result = i;
-                }
+                result = FindChar(inputStr, len, position, *searchStr);
             }
             else
             {
+                // Boyer-Moore skips further than the filter for long search strings, but it needs an ASCII jump table
                 JmpTable jmpTable;
-                bool fAsciiJumpTable = BuildLastCharForwardBoyerMooreTable(jmpTable, searchStr, searchLen);
-                if (!fAsciiJumpTable)
+                if (searchLen >= MinBoyerMooreSearchLength && BuildLastCharForwardBoyerMooreTable(jmpTable, searchStr, searchLen))
                 {
-                    result = JavascriptString::strstr(pThis, searchString, false, position);
+                    result = IndexOfUsingJmpTable(jmpTable, inputStr, len, searchStr, searchLen, position);
                 }
                 else
                 {
-                    result = IndexOfUsingJmpTable(jmpTable, inputStr, len, searchStr, searchLen, position);
+                    result = FindString(inputStr, len, position, searchStr, searchLen);
                 }
             }
         }
@@ -3521,11 +3581,8 @@ namespace Js
 
     uint JavascriptString::strstr(JavascriptString *string, JavascriptString *substring, bool useBoyerMoore, uint start)
     {
-        uint i;
-
         const char16 *stringOrig = string->GetString();
         uint stringLenOrig = string->GetLength();
-        const char16 *stringSz = stringOrig + start;
         const char16 *substringSz = substring->GetString();
         uint stringLen = stringLenOrig - start;
         uint substringLen = substring->GetLength();
@@ -3555,16 +3612,12 @@ namespace Js
             {
                 return 0;
             }
-            for (i = 0; i <= stringLen - substringLen; i++)
+            int result = substringLen == 1 ?
+                FindChar(stringOrig, stringLenOrig, start, substringSz[0]) :
+                FindString(stringOrig, stringLenOrig, start, substringSz, substringLen);
+            if (result != -1)
             {
-                // Quick check for first character.
-                if (stringSz[i] == substringSz[0])
-                {
-                    if (substringLen == 1 || wmemcmp(stringSz + i + 1, substringSz + 1, (substringLen - 1)) == 0)
-                    {
-                        return i + start;
-                    }
-                }
+                return (uint)result;
             }
         }
 
@@ -148,6 +148,8 @@ namespace Js
 
         template<bool toUpper, bool useInvariant>
         static JavascriptString* ToCaseCore(JavascriptString* pThis);
+        // Shorter search strings are found faster by filtering on their first and last characters
+        static const int MinBoyerMooreSearchLength = 16;
         static int IndexOfUsingJmpTable(JmpTable jmpTable, const char16* inputStr, charcount_t len, const char16* searchStr, int searchLen, int position);
         static int LastIndexOfUsingJmpTable(JmpTable jmpTable, const char16* inputStr, charcount_t len, const char16* searchStr, charcount_t searchLen, charcount_t position);
 
@@ -201,7 +203,11 @@ namespace Js
         static JavascriptString* Concat_Compound(JavascriptString * pstLeft, JavascriptString * pstRight);
         static JavascriptString* Concat_ConcatToCompound(JavascriptString * pstLeft, JavascriptString * pstRight);
         static JavascriptString* Concat_OneEmpty(JavascriptString * pstLeft, JavascriptString * pstRight);
-        static JavascriptString* Concat_BothOneChar(JavascriptString * pstLeft, JavascriptString * pstRight);
+        static JavascriptString* Concat_BothShort(JavascriptString * pstLeft, JavascriptString * pstRight);
+
+        // Concatenations no longer than this are copied into a flat buffer; a tree node would be about as large, and
+        // would have to be flattened later anyway
+        static const charcount_t MaxFlatConcatLength = 16;
 
     public:
         static uint32 GetOffsetOfpszValue()
@@ -12,7 +12,8 @@ LazyJSONString::LazyJSONString(_In_ JSONProperty* jsonContent, charcount_t lengt
     JavascriptString(type),
     jsonContent(jsonContent),
     gap(gap),
-    gapLength(gapLength)
+    gapLength(gapLength),
+    utf8Length(0)
 {
     // Use SetLength to ensure length is valid
     SetLength(length);
@@ -160,6 +161,53 @@ LazyJSONString::GetSz()
     return target;
 }
 
+bool
+LazyJSONString::TryCopyUtf8(_Out_writes_opt_(bufferSize) char* buffer, size_t bufferSize, _Out_ size_t* written)
+{
+    *written = 0;
+
+    // Gap characters are encoded one gap at a time, which is only the same as encoding the whole
+    // text if no surrogate pair can form across two of them
+    if (this->IsFinalized() || this->jsonContent == nullptr || this->HasComplexGap())
+    {
+        return false;
+    }
+
+    if (this->utf8Length == 0)
+    {
+        JSONStringBuilder counter(
+            this->GetScriptContext(),
+            this->jsonContent,
+            static_cast<utf8char_t*>(nullptr),
+            static_cast<size_t>(0),
+            this->gap,
+            this->gapLength);
+        counter.Build();
+        this->utf8Length = counter.GetUtf8Length();
+    }
+
+    if (buffer != nullptr)
+    {
+        if (bufferSize < this->utf8Length)
+        {
+            return false;
+        }
+
+        JSONStringBuilder builder(
+            this->GetScriptContext(),
+            this->jsonContent,
+            reinterpret_cast<utf8char_t*>(buffer),
+            this->utf8Length,
+            this->gap,
+            this->gapLength);
+        builder.Build();
+        AssertOrFailFast(builder.GetUtf8Length() == this->utf8Length);
+    }
+
+    *written = this->utf8Length;
+    return true;
+}
+
 // static
 bool
 LazyJSONString::Is(Var var)
@@ -59,13 +59,16 @@ struct JSONProperty
 struct JSONObjectProperty
 {
     Field(JavascriptString*) propertyName;
+    // Quoted and escaped name shared by objects of the same shape, or null to escape propertyName when building
+    Field(JavascriptString*) escapedName;
     Field(JSONProperty) propertyValue;
 
-    JSONObjectProperty() : propertyName(nullptr), propertyValue()
+    JSONObjectProperty() : propertyName(nullptr), escapedName(nullptr), propertyValue()
     {
     }
     JSONObjectProperty(const JSONObjectProperty& other) :
         propertyName(other.propertyName),
+        escapedName(other.escapedName),
         propertyValue(other.propertyValue)
     {
     }
@@ -83,6 +86,7 @@ class LazyJSONString : JavascriptString
     Field(charcount_t) gapLength;
     Field(JSONProperty*) jsonContent;
     Field(const char16*) gap;
+    Field(size_t) utf8Length; // 0 until the UTF-8 length has been counted
 
     DynamicObject* ReconstructObject(_In_ JSONObject* valueList) const;
     JavascriptArray* ReconstructArray(_In_ JSONArray* valueArray) const;
@@ -100,6 +104,11 @@ class LazyJSONString : JavascriptString
 
     const char16* GetSz() override sealed;
 
+    // Encodes the JSON text as UTF-8 straight from the stringify data, without building the char16 string.
+    // With no buffer only the length is returned. Fails if the string has already been flattened, the
+    // buffer is too small or the gap isn't plain whitespace.
+    bool TryCopyUtf8(_Out_writes_opt_(bufferSize) char* buffer, size_t bufferSize, _Out_ size_t* written);
+
     static bool Is(Var var);
 
     static LazyJSONString* TryFromVar(Var var);
@@ -4,16 +4,19 @@
 //-------------------------------------------------------------------------------------------------------
 #pragma once
 
-// This is a special use doubly linked list whose iterators are always valid
-// no matter what modifications are made to the list during iteration. The
-// iterators rely on deleted nodes still having valid next and prev references
-// to the nodes they used to be next to before being removed. They also rely
-// on nodes being recycler allocated so that active iterators do not need to
-// be tracked by the list and updated when deletes occur. Finally, well
-// defined iteration order is maintained by only allowing new items to be
-// appended to the end of the list. This allows an iterator to validate
-// itself by seeking backwards until it finds a node whose previous's next
-// still points to it.
+// This is a special use insertion-ordered list whose iterators are always
+// valid no matter what modifications are made to the list during iteration.
+//
+// Entries are stored by value in a recycler allocated block, in the order
+// they were appended. Removing an entry only clears it, leaving a hole, so
+// the index of every other entry is unchanged; the index is what the Map
+// and Set dictionaries store for each key. When the block is full, the
+// live entries are copied to a new block, which removes the holes. The old
+// block is never modified again, except to record that the list has moved
+// on, so an iterator still on it can find its place in the new block by
+// counting the live entries it has passed. Clearing the list just marks
+// the block as cleared, which sends iterators to the start of whatever
+// block the list uses next.
 //
 // The intended use of this list is to track insertion order for items added
 // to ES6 Map and Set objects. If a more general use if found for this data
@@ -22,170 +25,195 @@
 namespace Js
 {
     template <typename TData>
-    class MapOrSetDataNode
+    class MapOrSetDataList
     {
+    public:
+        static const uint MinCapacity = 4;
+
     private:
-        template <typename TData>
-        friend class MapOrSetDataList;
+        class Block
+        {
+        public:
+            Field(Block*) successor;    // where the entries went when this block filled up
+            Field(bool) wasCleared;
+            Field(uint) capacity;
+            Field(uint) count;          // entries appended to this block, including holes
+            Field(uint) removedCount;   // holes
+            Field(TData) entries[];     // actual entries will follow this determined by capacity
 
-        Field(MapOrSetDataNode<TData>*) next;
-        Field(MapOrSetDataNode<TData>*) prev;
+            Block(uint capacity) : successor(nullptr), wasCleared(false), capacity(capacity), count(0), removedCount(0) { }
 
-        MapOrSetDataNode(TData& data) : data(data), next(nullptr), prev(nullptr) { }
+            uint LiveCount() const
+            {
+                return count - removedCount;
+            }
 
-    public:
-        Field(TData) data;
-    };
+            // Index in the successor of the first live entry at or after index
+            uint LiveCountBefore(uint index) const
+            {
+                Assert(index <= count);
+                uint liveCount = 0;
+                for (uint i = 0; i < index; i++)
+                {
+                    if (!IsRemoved(entries[i]))
+                    {
+                        liveCount++;
+                    }
+                }
+                return liveCount;
+            }
+        };
 
-    template <typename TData>
-    class MapOrSetDataList
-    {
-    private:
-        Field(MapOrSetDataNode<TData>*) first;
-        Field(MapOrSetDataNode<TData>*) last;
+        Field(Block*) block;
+
+        static bool IsRemoved(Var data)
+        {
+            return data == nullptr;
+        }
+
+        template <typename TKey, typename TValue>
+        static bool IsRemoved(const JsUtil::KeyValuePair<TKey, TValue>& data)
+        {
+            return data.Key() == nullptr;
+        }
+
+        static Var RemovedEntry(Var*)
+        {
+            return nullptr;
+        }
+
+        template <typename TKey, typename TValue>
+        static JsUtil::KeyValuePair<TKey, TValue> RemovedEntry(JsUtil::KeyValuePair<TKey, TValue>*)
+        {
+            return JsUtil::KeyValuePair<TKey, TValue>(nullptr, nullptr);
+        }
 
     public:
         MapOrSetDataList(VirtualTableInfoCtorEnum) {};
-        MapOrSetDataList() : first(nullptr), last(nullptr) { }
+        MapOrSetDataList() : block(nullptr) { }
 
         class Iterator
         {
             Field(MapOrSetDataList<TData>*) list;
-            Field(MapOrSetDataNode<TData>*) current;
+            Field(Block*) block;
+            Field(uint) nextIndex;
+            Field(uint) currentIndex;
         public:
-            Iterator() : list(nullptr), current(nullptr) { }
-            Iterator(MapOrSetDataList<TData>* list) : list(list), current(nullptr) { }
+            Iterator() : list(nullptr), block(nullptr), nextIndex(0), currentIndex(0) { }
+            Iterator(MapOrSetDataList<TData>* list) : list(list), block(list->block), nextIndex(0), currentIndex(0) { }
 
             bool Next()
             {
-                // Nodes can be deleted while iterating so validate current
-                // and if it is not valid find last valid node by following
-                // previous toward first.
-                // Note: clear will simply null out first and last, but
-                // not invalidated nodes, so we must also check to see that
-                // first is not null
-
-                if (list == nullptr || list->first == nullptr)
+                if (list == nullptr)
                 {
-                    // list is empty or was cleared during enumeration
-                    list = nullptr;
-                    current = nullptr;
+                    // already finished
                     return false;
                 }
 
-                if (current)
+                // Catch up with any moves or clears since the last call
+                while (block != list->block)
                 {
-                    while (current->prev && current->prev->next != current)
+                    if (block == nullptr || block->wasCleared)
                     {
-                        current = current->prev;
+                        block = list->block;
+                        nextIndex = 0;
+                        break;
                     }
 
-                    if (current->prev == nullptr && current != list->first)
-                    {
-                        current = list->first;
-
-                        if (current != nullptr)
-                        {
-                            return true;
-                        }
-
-                        list = nullptr;
-                        current = nullptr;
-                        return false;
-                    }
-
-                    if (current->next == nullptr && current != list->last)
-                    {
-                        Assert(list->last == nullptr);
-                        current = nullptr;
-                    }
+                    nextIndex = block->LiveCountBefore(nextIndex);
+                    block = block->successor;
                 }
 
-                if (current != list->last)
+                if (block != nullptr)
                 {
-                    if (current == nullptr)
+                    while (nextIndex < block->count)
                     {
-                        Assert(list->first != nullptr);
-                        current = list->first;
-                    }
-                    else
-                    {
-                        current = current->next;
+                        uint index = nextIndex++;
+                        if (!IsRemoved(block->entries[index]))
+                        {
+                            currentIndex = index;
+                            return true;
+                        }
                     }
-                    return true;
                 }
 
                 list = nullptr;
-                current = nullptr;
+                block = nullptr;
                 return false;
             }
 
-            const TData& Current() const
+            TData Current() const
             {
-                return current->data;
-            }
-
-            Field(MapOrSetDataNode<TData>*) CurrentNode() const
-            {
-                return current;
+                return block->entries[currentIndex];
             }
         };
 
         void Clear()
         {
-            first = nullptr;
-            last = nullptr;
+            if (block != nullptr)
+            {
+                block->wasCleared = true;
+                block = nullptr;
+            }
         }
 
-        MapOrSetDataNode<TData>* Append(TData& data, Recycler* recycler)
+        // Returns the index of the new entry. If the entries were compacted to make room, fn(index, data) is
+        // called first for each entry whose index changed.
+        template <class Fn>
+        uint Append(const TData& data, Recycler* recycler, Fn fn)
         {
-            // Must allocate with the recycler so that iterators can continue
-            // to point to removed nodes.  That is, cannot delete nodes when
-            // they are removed.  Reference counting would also work.
-            MapOrSetDataNode<TData>* newNode = RecyclerNew(recycler, MapOrSetDataNode<TData>, data);
+            Assert(!IsRemoved(data));
 
-            if (last == nullptr)
+            if (block == nullptr)
             {
-                Assert(first == nullptr);
-                first = newNode;
-                last = newNode;
+                block = NewBlock(MinCapacity, recycler);
             }
-            else
+            else if (block->count == block->capacity)
             {
-                newNode->prev = last;
-                last->next = newNode;
-                last = newNode;
+                Grow(recycler, fn);
             }
 
-            return newNode;
+            uint index = block->count++;
+            block->entries[index] = data;
+            return index;
         }
 
-        void Remove(MapOrSetDataNode<TData>* node)
+        TData Item(uint index) const
         {
-            // Cannot delete the node itself, nor change its next and prev pointers!
-            // Otherwise active iterators may break. Iterators depend on nodes existing
-            // until garbage collector picks them up.
-            auto next = node->next;
-            auto prev = node->prev;
+            Assert(index < block->count && !IsRemoved(block->entries[index]));
+            return block->entries[index];
+        }
 
-            if (next)
-            {
-                next->prev = prev;
-            }
-            else
-            {
-                Assert(last == node);
-                last = prev;
-            }
+        void SetItem(uint index, const TData& data)
+        {
+            Assert(index < block->count && !IsRemoved(block->entries[index]) && !IsRemoved(data));
+            block->entries[index] = data;
+        }
+
+        void Remove(uint index)
+        {
+            Assert(index < block->count && !IsRemoved(block->entries[index]));
+
+            // Leave a hole so that no other entry moves; this also lets the removed key and value be collected
+            block->entries[index] = RemovedEntry((TData*)nullptr);
+            block->removedCount++;
+        }
 
-            if (prev)
+        // Visits the live entries in order; fn must not modify the list
+        template <class Fn>
+        void Map(Fn fn) const
+        {
+            if (block == nullptr)
             {
-                prev->next = next;
+                return;
             }
-            else
+
+            for (uint i = 0; i < block->count; i++)
             {
-                Assert(first == node);
-                first = next;
+                if (!IsRemoved(block->entries[i]))
+                {
+                    fn(i, block->entries[i]);
+                }
             }
         }
 
@@ -193,13 +221,44 @@ namespace Js
         {
             return Iterator(this);
         }
-    };
 
+    private:
+        static Block* NewBlock(uint capacity, Recycler* recycler)
+        {
+            return RecyclerNewWithBarrierPlusZ(recycler, AllocSizeMath::Mul(capacity, sizeof(TData)), Block, capacity);
+        }
 
-    template <typename TData>
-    class DelayedDeleteMapOrSetDataList : MapOrSetDataList<TData>
-    {
-        Field(SList<TData>*) deletedList;
+        template <class Fn>
+        void Grow(Recycler* recycler, Fn fn)
+        {
+            Block* oldBlock = block;
+            uint liveCount = oldBlock->LiveCount();
 
+            // Double the live entries, so that the cost of copying is spread across at least as many appends
+            Block* newBlock = NewBlock(max(MinCapacity, UInt32Math::Mul(liveCount, 2)), recycler);
+
+            bool isCompacting = oldBlock->removedCount != 0;
+            uint newIndex = 0;
+            for (uint i = 0; i < oldBlock->count; i++)
+            {
+                if (IsRemoved(oldBlock->entries[i]))
+                {
+                    continue;
+                }
+
+                newBlock->entries[newIndex] = oldBlock->entries[i];
+                if (isCompacting && newIndex != i)
+                {
+                    fn(newIndex, newBlock->entries[newIndex]);
+                }
+                newIndex++;
+            }
+            Assert(newIndex == liveCount);
+            newBlock->count = liveCount;
+
+            // The old block keeps its entries and holes, so that iterators still on it can find their place
+            oldBlock->successor = newBlock;
+            block = newBlock;
+        }
     };
 }
@@ -0,0 +1,101 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLibraryPch.h"
+
+namespace Js
+{
+    OneByteString::OneByteString(const char * oneByteContent, charcount_t length, bool isAscii, StaticType * type) :
+        JavascriptString(type),
+        oneByteContent(oneByteContent),
+        isAscii(isAscii)
+    {
+        // Use SetLength to ensure length is valid
+        SetLength(length);
+    }
+
+    OneByteString * OneByteString::TryNew(const char * content, charcount_t length, bool asciiOnly, ScriptContext * scriptContext)
+    {
+        Assert(content != nullptr);
+
+        bool isAscii = true;
+        for (charcount_t i = 0; i < length; i++)
+        {
+            if ((unsigned char)content[i] >= 0x80)
+            {
+                if (asciiOnly)
+                {
+                    return nullptr;
+                }
+                isAscii = false;
+            }
+        }
+
+        Recycler * recycler = scriptContext->GetRecycler();
+        char * oneByteContent = RecyclerNewArrayLeaf(recycler, char, length);
+        js_memcpy_s(oneByteContent, length, content, length);
+
+        return RecyclerNew(recycler, OneByteString, oneByteContent, length, isAscii, scriptContext->GetLibrary()->GetStringTypeStatic());
+    }
+
+    bool OneByteString::Is(Var var)
+    {
+        return RecyclableObject::Is(var) && VirtualTableInfo<OneByteString>::HasVirtualTable(RecyclableObject::FromVar(var));
+    }
+
+    OneByteString * OneByteString::FromVar(Var var)
+    {
+        AssertOrFailFast(OneByteString::Is(var));
+        return static_cast<OneByteString *>(var);
+    }
+
+    const char16* OneByteString::GetSz()
+    {
+        if (this->IsFinalized())
+        {
+            return this->UnsafeGetBuffer();
+        }
+
+        Recycler * recycler = GetScriptContext()->GetRecycler();
+        char16 * buffer = RecyclerNewArrayLeaf(recycler, char16, this->SafeSzSize());
+        this->Widen(buffer);
+        buffer[this->GetLength()] = _u('\0');
+
+        this->SetBuffer(buffer);
+
+        // The char16 buffer is what everything reads from now on, let the bytes go
+        this->oneByteContent = nullptr;
+
+        return buffer;
+    }
+
+    void OneByteString::CopyVirtual(
+        _Out_writes_(m_charLength) char16 *const buffer,
+        StringCopyInfoStack &nestedStringTreeCopyInfos,
+        const byte recursionDepth)
+    {
+        Assert(buffer);
+        Assert(!this->IsFinalized());   // CopyVirtual should only be called for unfinalized buffers
+
+        // Widen straight into the destination, this string stays one byte
+        this->Widen(buffer);
+    }
+
+    size_t OneByteString::GetAllocatedByteCount() const
+    {
+        return this->oneByteContent != nullptr ? this->GetLength() : __super::GetAllocatedByteCount();
+    }
+
+    void OneByteString::Widen(_Out_writes_(m_charLength) char16 *const buffer) const
+    {
+        Assert(this->oneByteContent != nullptr);
+
+        const unsigned char * content = (const unsigned char *)this->oneByteContent;
+        const charcount_t length = this->GetLength();
+        for (charcount_t i = 0; i < length; i++)
+        {
+            buffer[i] = content[i];
+        }
+    }
+}
@@ -0,0 +1,45 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // String whose characters are all Latin-1, stored one byte per character. The char16 buffer is
+    // only built (and the bytes dropped) the first time the string is asked for its sz, so strings
+    // that are just handed back to the host, or copied into a concat, never take twice the space.
+    class OneByteString sealed : public JavascriptString
+    {
+    private:
+        Field(const char *) oneByteContent;
+        Field(bool) isAscii;
+
+        OneByteString(const char * oneByteContent, charcount_t length, bool isAscii, StaticType * type);
+
+    protected:
+        DEFINE_VTABLE_CTOR(OneByteString, JavascriptString);
+
+    public:
+        // Strings shorter than this are usually flattened right away (property names, numbers), so
+        // they aren't worth the extra copy.
+        static const charcount_t MinLength = 64;
+
+        // Copies the content; returns nullptr if it isn't all Latin-1 (or ASCII if asciiOnly)
+        static OneByteString * TryNew(const char * content, charcount_t length, bool asciiOnly, ScriptContext * scriptContext);
+        static bool Is(Var var);
+        static OneByteString * FromVar(Var var);
+
+        // The one byte content, or nullptr once the string has been widened
+        const char * GetOneByteContent() const { return this->oneByteContent; }
+        // Whether the one byte content is also valid UTF-8
+        bool IsAscii() const { return this->isAscii; }
+
+        virtual const char16* GetSz() override sealed;
+        virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override sealed;
+        virtual size_t GetAllocatedByteCount() const override;
+
+    private:
+        void Widen(_Out_writes_(m_charLength) char16 *const buffer) const;
+    };
+}
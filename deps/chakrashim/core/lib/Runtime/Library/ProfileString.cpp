@@ -24,6 +24,9 @@ namespace Js
         embeddedNULStrings(0),
         emptyStrings(0),
         singleCharStrings(0),
+        flattenCount(0),
+        flattenedChars(0),
+        maxFlattenLength(0),
         stringConcatMetrics(&allocator, 43)
     {
     }
@@ -273,6 +276,20 @@ namespace Js
             Output::Print(_u("-------------------------------------------------------\n"));
             Output::Print(_u("Total %6u %6u %6u %6u %6u\n"), totalConcatenations, totalCompoundString, totalConcatTree, totalBufString, totalOther);
         }
+        Output::Print(_u("\n"));
+
+        if(flattenCount == 0)
+        {
+            Output::Print(_u("No concatenated strings were flattened\n"));
+        }
+        else
+        {
+            Output::Print(_u("Flattened %u concatenated strings, copying %llu chars (%.1f chars per flatten, longest %u chars)\n"),
+                flattenCount,
+                flattenedChars,
+                (double)flattenedChars/(double)flattenCount,
+                maxFlattenLength);
+        }
 
         Output::Flush();
     }
@@ -299,6 +316,18 @@ namespace Js
         }
     }
 
+    void StringProfiler::RecordFlatten( uint length )
+    {
+        if( IsOnWrongThread() )
+        {
+            return;
+        }
+
+        flattenCount++;
+        flattenedChars += length;
+        maxFlattenLength = max( maxFlattenLength, length );
+    }
+
     /*static*/ void StringProfiler::RecordNewString( ScriptContext* scriptContext, const char16* sz, uint length )
     {
         StringProfiler* stringProfiler = scriptContext->GetStringProfiler();
@@ -335,6 +364,15 @@ namespace Js
         }
     }
 
+    /*static*/ void StringProfiler::RecordFlatten( ScriptContext* scriptContext, uint length )
+    {
+        StringProfiler* stringProfiler = scriptContext->GetStringProfiler();
+        if( stringProfiler )
+        {
+            stringProfiler->RecordFlatten(length);
+        }
+    }
+
 
 } // namespace Js
 
@@ -119,6 +119,10 @@ namespace Js
         uint emptyStrings;      // # of requests for zero-length strings (literals or BufferStrings)
         uint singleCharStrings; // # of requests for single-char strings (literals of BufferStrings)
 
+        uint flattenCount;      // # of concat trees and compound strings copied into a flat buffer by GetSz
+        uint64 flattenedChars;  // Total number of chars copied by those flattens
+        uint maxFlattenLength;  // Longest string that was flattened
+
         JsUtil::BaseDictionary<uint, StringMetrics, ArenaAllocator> stringLengthMetrics;
 
         struct UintUintPair
@@ -169,6 +173,7 @@ namespace Js
 
         void RecordNewString( const char16* sz, uint length );
         void RecordConcatenation( uint lenLeft, uint lenRight, ConcatType type);
+        void RecordFlatten( uint length );
 
         static const uint k_MaxConcatLength = 20; // Strings longer than this are just "large"
 
@@ -181,6 +186,7 @@ namespace Js
         static void RecordConcatenation( ScriptContext* scriptContext, uint lenLeft, uint lenRight, ConcatType type = ConcatType_Unknown);
         static void RecordEmptyStringRequest( ScriptContext* scriptContext );
         static void RecordSingleCharStringRequest( ScriptContext* scriptContext );
+        static void RecordFlatten( ScriptContext* scriptContext, uint length );
     };
 } // namespace Js
 
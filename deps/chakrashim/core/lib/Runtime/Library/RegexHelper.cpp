@@ -622,10 +622,23 @@ namespace Js
         JavascriptArray* result = CreateExecResult(stackAllocationPointer, scriptContext, numGroups, input, match);
         Var nonMatchValue = NonMatchValue(scriptContext, false);
         Field(Var) *elements = ((SparseArraySegment<Var>*)result->GetHead())->elements;
+        UnifiedRegex::GroupInfo previousGroup; // initially undefined
         for (uint groupId = 0; groupId < (uint)numGroups; groupId++)
         {
             Assert(groupId < result->GetHead()->left + result->GetHead()->length);
-            elements[groupId] = GetGroup(scriptContext, pattern, input, nonMatchValue, groupId);
+            const UnifiedRegex::GroupInfo group = pattern->GetGroup(groupId);
+
+            // Patterns such as /(\w+)/ bind a group to the same span as the one before it; share its string rather
+            // than allocating another substring for the same characters
+            if (groupId > 0 && !group.IsUndefined() && group.offset == previousGroup.offset && group.length == previousGroup.length)
+            {
+                elements[groupId] = elements[groupId - 1];
+            }
+            else
+            {
+                elements[groupId] = GetString(scriptContext, input, nonMatchValue, group);
+            }
+            previousGroup = group;
         }
         return result;
     }
@@ -1975,6 +1988,9 @@ namespace Js
             // fall-through for default
         }
         default:
+            // Strings are immutable, so a group spanning the whole input needs no substring of its own
+            if (group.offset == 0 && group.length == input->GetLength())
+                return input;
             return SubString::New(input, group.offset, group.length);
         }
     }
@@ -724,11 +724,11 @@ namespace Js
 
     bool _Requires_lock_held_(csForAccess.cs) WaiterList::AddAndSuspendWaiter(DWORD_PTR waiter, uint32 timeout)
     {
-#ifdef _WIN32
         Assert(m_waiters != nullptr);
         Assert(waiter != NULL);
         Assert(!Contains(waiter));
 
+#ifdef _WIN32
         AgentOfBuffer agent(waiter, CreateEvent(NULL, TRUE, FALSE, NULL));
         m_waiters->Add(agent);
 
@@ -737,28 +737,51 @@ namespace Js
         csForAccess.Enter();
         return result == WAIT_OBJECT_0;
 #else
-        // TODO for xplat
-        return false;
+        // The flag lives on this stack frame. It stays valid after a notifier removes the agent,
+        // because this function can't return until it takes csForAccess back from the notifier.
+        volatile int32 wakeFlag = 0;
+        AgentOfBuffer agent(waiter, &wakeFlag);
+        m_waiters->Add(agent);
+
+        csForAccess.Leave();
+        ULONGLONG start = GetTickCount64();
+        while (wakeFlag == 0)
+        {
+            uint32 remaining = INFINITE;
+            if (timeout != INFINITE)
+            {
+                ULONGLONG elapsed = GetTickCount64() - start;
+                if (elapsed >= timeout)
+                {
+                    break;
+                }
+                remaining = timeout - (uint32)elapsed;
+            }
+            PlatformAgnostic::Thread::WaitOnAddress(&wakeFlag, 0, remaining);
+        }
+        csForAccess.Enter();
+
+        // A notifier may have removed and woken this agent after the timeout but before the lock was taken
+        return wakeFlag != 0;
 #endif
     }
 
     void WaiterList::RemoveWaiter(DWORD_PTR waiter)
     {
-#ifdef _WIN32
         Assert(m_waiters != nullptr);
         for (int i = m_waiters->Count() - 1; i >= 0; i--)
         {
             if (m_waiters->Item(i).identity == waiter)
             {
+#ifdef _WIN32
                 CloseHandle(m_waiters->Item(i).event);
+#endif
                 m_waiters->RemoveAt(i);
                 return;
             }
         }
 
         Assert(false);
-#endif
-        // TODO for xplat
     }
 
     uint32 WaiterList::RemoveAndWakeWaiters(int32 count)
@@ -766,16 +789,19 @@ namespace Js
         Assert(m_waiters != nullptr);
         Assert(count >= 0);
         uint32 removed = 0;
-#ifdef _WIN32
         while (count > 0 && m_waiters->Count() > 0)
         {
             AgentOfBuffer agent = m_waiters->Item(0);
             m_waiters->RemoveAt(0);
             count--; removed++;
+#ifdef _WIN32
             SetEvent(agent.event);
             // This agent will be closed when their respective call to wait has returned
-        }
+#else
+            *agent.wakeFlag = 1;
+            PlatformAgnostic::Thread::WakeAddress(agent.wakeFlag);
 #endif
+        }
         return removed;
     }
 
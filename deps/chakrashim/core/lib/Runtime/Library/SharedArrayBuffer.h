@@ -166,12 +166,22 @@ namespace Js
     struct AgentOfBuffer
     {
     public:
+#ifdef _WIN32
         AgentOfBuffer() :identity(NULL), event(NULL) {}
         AgentOfBuffer(DWORD_PTR agent, HANDLE e) :identity(agent), event(e) {}
+#else
+        AgentOfBuffer() :identity(NULL), wakeFlag(nullptr) {}
+        AgentOfBuffer(DWORD_PTR agent, volatile int32 *w) :identity(agent), wakeFlag(w) {}
+#endif
         static bool AgentCanSuspend(ScriptContext *scriptContext);
 
         DWORD_PTR identity;
+#ifdef _WIN32
         HANDLE event;
+#else
+        // Set to 1 by the notifying agent; the waiting agent waits on its address
+        volatile int32 *wakeFlag;
+#endif
     };
 
     typedef JsUtil::List<AgentOfBuffer, HeapAllocator> Waiters;
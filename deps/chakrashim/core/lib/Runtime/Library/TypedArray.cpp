@@ -1208,6 +1208,218 @@ namespace Js
         }
     }
 
+    // The value has already been converted to a Number by the caller, so storing it can't call back into script.
+    void TypedArrayBase::DirectFill(uint32 start, uint32 length, Var numberValue)
+    {
+        Assert(TaggedInt::Is(numberValue) || JavascriptNumber::Is_NoTaggedIntCheck(numberValue));
+
+        if (IsDetachedBuffer())
+        {
+            JavascriptError::ThrowTypeError(GetScriptContext(), JSERR_DetachedTypedArray);
+        }
+
+        AssertOrFailFast(start <= GetLength() && length <= GetLength() - start);
+
+        for (uint32 i = 0; i < length; i++)
+        {
+            DirectSetItemNoDetachCheck(start + i, numberValue);
+        }
+    }
+
+    template <typename TypeName, bool clamped, bool virtualAllocated>
+    void TypedArray<TypeName, clamped, virtualAllocated>::DirectFill(uint32 start, uint32 length, Var numberValue)
+    {
+        Assert(TaggedInt::Is(numberValue) || JavascriptNumber::Is_NoTaggedIntCheck(numberValue));
+
+        if (IsDetachedBuffer())
+        {
+            JavascriptError::ThrowTypeError(GetScriptContext(), JSERR_DetachedTypedArray);
+        }
+
+        AssertOrFailFast(start <= GetLength() && length <= GetLength() - start);
+
+        if (length == 0)
+        {
+            return;
+        }
+
+        // Let the first store do the conversion to the element type, then replicate its bits.
+        DirectSetItemNoDetachCheck(start, numberValue);
+        TypeName* typedBuffer = (TypeName*)buffer;
+        const TypeName typedValue = typedBuffer[start];
+
+        if (sizeof(TypeName) == 1)
+        {
+            memset(typedBuffer + start, *(const uint8*)&typedValue, length);
+        }
+        else
+        {
+            for (uint32 i = 1; i < length; i++)
+            {
+                typedBuffer[start + i] = typedValue;
+            }
+        }
+    }
+
+    // Maps the bits of a typed array element to an unsigned key that orders like the default sort comparer,
+    // for types that can be radix sorted.
+    template <typename T>
+    struct TypedArraySortKey
+    {
+        static const bool IsSupported = false;
+        typedef T Key;
+        static bool IsNan(Key bits) { return false; }
+        static Key ToKey(Key bits) { return bits; }
+        static Key FromKey(Key key) { return key; }
+    };
+
+    template <typename TKey>
+    struct TypedArrayUnsignedSortKey
+    {
+        static const bool IsSupported = true;
+        typedef TKey Key;
+        static bool IsNan(Key bits) { return false; }
+        static Key ToKey(Key bits) { return bits; }
+        static Key FromKey(Key key) { return key; }
+    };
+
+    template <typename TKey>
+    struct TypedArraySignedSortKey
+    {
+        static const bool IsSupported = true;
+        typedef TKey Key;
+        static const Key SignBit = (Key)((Key)1 << (sizeof(Key) * 8 - 1));
+        static bool IsNan(Key bits) { return false; }
+        static Key ToKey(Key bits) { return (Key)(bits ^ SignBit); }
+        static Key FromKey(Key key) { return (Key)(key ^ SignBit); }
+    };
+
+    // Negative values have all their bits flipped so that larger magnitudes sort first, and -0 comes before +0
+    template <typename TKey, TKey InfinityBits>
+    struct TypedArrayFloatSortKey
+    {
+        static const bool IsSupported = true;
+        typedef TKey Key;
+        static const Key SignBit = (Key)((Key)1 << (sizeof(Key) * 8 - 1));
+        static bool IsNan(Key bits) { return (bits & ~SignBit) > InfinityBits; }
+        static Key ToKey(Key bits) { return (Key)((bits & SignBit) ? ~bits : (bits ^ SignBit)); }
+        static Key FromKey(Key key) { return (Key)((key & SignBit) ? (key ^ SignBit) : ~key); }
+    };
+
+    template <> struct TypedArraySortKey<int8> : TypedArraySignedSortKey<uint8> {};
+    template <> struct TypedArraySortKey<uint8> : TypedArrayUnsignedSortKey<uint8> {};
+    template <> struct TypedArraySortKey<int16> : TypedArraySignedSortKey<uint16> {};
+    template <> struct TypedArraySortKey<uint16> : TypedArrayUnsignedSortKey<uint16> {};
+    template <> struct TypedArraySortKey<int32> : TypedArraySignedSortKey<uint32> {};
+    template <> struct TypedArraySortKey<uint32> : TypedArrayUnsignedSortKey<uint32> {};
+    template <> struct TypedArraySortKey<float> : TypedArrayFloatSortKey<uint32, 0x7F800000> {};
+    template <> struct TypedArraySortKey<double> : TypedArrayFloatSortKey<uint64, 0x7FF0000000000000ull> {};
+
+    // Stable LSD radix sort on the element bits, one byte per pass. The result is the order the default
+    // comparer gives: -0 before +0, and NaNs last in their original order with their payloads untouched.
+    template <typename T>
+    static bool TypedArrayRadixSort(T* elements, uint32 length)
+    {
+        typedef TypedArraySortKey<T> SortKey;
+        typedef typename SortKey::Key Key;
+        CompileAssert(sizeof(Key) == sizeof(T));
+
+        if (!SortKey::IsSupported)
+        {
+            return false;
+        }
+
+        Key* scratch = HeapNewNoThrowArray(Key, length);
+        if (scratch == nullptr)
+        {
+            return false;
+        }
+
+        // Turn the elements into keys in place, compacting them to the front, and count every digit in the
+        // same pass. NaNs are parked at the end of the scratch buffer, which the passes below don't reach.
+        Key* bits = reinterpret_cast<Key*>(elements);
+        uint32 counts[sizeof(Key)][256];
+        memset(counts, 0, sizeof(counts));
+        uint32 keyCount = 0;
+        uint32 nanCount = 0;
+        for (uint32 i = 0; i < length; i++)
+        {
+            Key value = bits[i];
+            if (SortKey::IsNan(value))
+            {
+                scratch[length - ++nanCount] = value;
+                continue;
+            }
+
+            Key key = SortKey::ToKey(value);
+            bits[keyCount++] = key;
+            for (uint32 digit = 0; digit < sizeof(Key); digit++)
+            {
+                counts[digit][(key >> (digit * 8)) & 0xFF]++;
+            }
+        }
+
+        Key* source = bits;
+        Key* dest = scratch;
+        for (uint32 digit = 0; digit < sizeof(Key) && keyCount != 0; digit++)
+        {
+            const uint32 shift = digit * 8;
+            uint32* offsets = counts[digit];
+
+            // Nothing to do if all the keys have the same digit
+            if (offsets[(source[0] >> shift) & 0xFF] == keyCount)
+            {
+                continue;
+            }
+
+            uint32 offset = 0;
+            for (uint32 i = 0; i < 256; i++)
+            {
+                uint32 count = offsets[i];
+                offsets[i] = offset;
+                offset += count;
+            }
+
+            for (uint32 i = 0; i < keyCount; i++)
+            {
+                Key key = source[i];
+                dest[offsets[(key >> shift) & 0xFF]++] = key;
+            }
+
+            Key* swap = source;
+            source = dest;
+            dest = swap;
+        }
+
+        for (uint32 i = 0; i < keyCount; i++)
+        {
+            bits[i] = SortKey::FromKey(source[i]);
+        }
+
+        for (uint32 i = 0; i < nanCount; i++)
+        {
+            bits[keyCount + i] = scratch[length - 1 - i];
+        }
+
+        HeapDeleteArray(length, scratch);
+        return true;
+    }
+
+    template <typename TypeName, bool clamped, bool virtualAllocated>
+    bool TypedArray<TypeName, clamped, virtualAllocated>::DirectSort()
+    {
+        Assert(!IsDetachedBuffer());
+
+        // Below this the comparison sort is about as fast
+        const uint32 minRadixSortLength = 256;
+        if (GetLength() < minRadixSortLength)
+        {
+            return false;
+        }
+
+        return TypedArrayRadixSort((TypeName*)buffer, GetLength());
+    }
+
     uint32 TypedArrayBase::GetSourceLength(RecyclableObject* arraySource, uint32 targetLength, uint32 offset)
     {
         ScriptContext* scriptContext = GetScriptContext();
@@ -2496,6 +2708,13 @@ namespace Js
             {
                 return 1;
             }
+            else if (x == 0)
+            {
+                // -0 sorts before +0
+                bool isNegZeroX = !!JavascriptNumber::IsNegZero((double)x);
+                bool isNegZeroY = !!JavascriptNumber::IsNegZero((double)y);
+                return isNegZeroX == isNegZeroY ? 0 : (isNegZeroX ? -1 : 1);
+            }
 
             return 0;
         }
@@ -2541,6 +2760,12 @@ namespace Js
         // Cast compare to the correct function type
         int(__cdecl*elementCompareFunc)(void*, const void*, const void*) = (int(__cdecl*)(void*, const void*, const void*))elementCompare;
 
+        // Without a comparer nothing can observe the sort, so let the typed array sort its elements directly
+        if (compareFn == nullptr && typedArrayBase->DirectSort())
+        {
+            return typedArrayBase;
+        }
+
         void * contextToPass[] = { typedArrayBase, compareFn };
 
         // We can always call qsort_s with the same arguments. If user compareFn is non-null, the callback will use it to do the comparison.
@@ -146,6 +146,8 @@ namespace Js
         virtual Var  DirectGetItem(__in uint32 index) = 0;
         virtual BOOL DirectSetItemNoDetachCheck(__in uint32 index, __in Js::Var value) = 0;
         virtual Var  DirectGetItemNoDetachCheck(__in uint32 index) = 0;
+        virtual void DirectFill(__in uint32 start, __in uint32 length, __in Var numberValue);
+        virtual bool DirectSort() { return false; }
 
         virtual Var TypedAdd(__in uint32 index, __in Var second) = 0;
         virtual Var TypedAnd(__in uint32 index, __in Var second) = 0;
@@ -494,6 +496,8 @@ namespace Js
         virtual Var  DirectGetItem(__in uint32 index) override sealed;
         virtual BOOL DirectSetItemNoDetachCheck(__in uint32 index, __in Js::Var value) override sealed;
         virtual Var  DirectGetItemNoDetachCheck(__in uint32 index) override sealed;
+        virtual void DirectFill(__in uint32 start, __in uint32 length, __in Var numberValue) override;
+        virtual bool DirectSort() override;
         virtual Var TypedAdd(__in uint32 index, __in Var second) override;
         virtual Var TypedAnd(__in uint32 index, __in Var second) override;
         virtual Var TypedLoad(__in uint32 index) override;
@@ -224,6 +224,48 @@ WebAssemblyMemory::GrowHelper(WebAssemblyMemory * mem, uint32 deltaPages)
     JIT_HELPER_END(Op_GrowWasmMemory);
 }
 
+void
+WebAssemblyMemory::Copy(uint32 dstIndex, uint32 srcIndex, uint32 count)
+{
+    // The whole range is checked up front, so an out of bounds copy traps without writing anything
+    const uint32 byteLength = m_buffer->GetByteLength();
+    if ((uint64)dstIndex + count > byteLength || (uint64)srcIndex + count > byteLength)
+    {
+        JavascriptError::ThrowWebAssemblyRuntimeError(GetScriptContext(), WASMERR_ArrayIndexOutOfRange);
+    }
+
+    BYTE* buffer = m_buffer->GetBuffer();
+    memmove(buffer + dstIndex, buffer + srcIndex, count);
+}
+
+void
+WebAssemblyMemory::Fill(uint32 dstIndex, int32 value, uint32 count)
+{
+    const uint32 byteLength = m_buffer->GetByteLength();
+    if ((uint64)dstIndex + count > byteLength)
+    {
+        JavascriptError::ThrowWebAssemblyRuntimeError(GetScriptContext(), WASMERR_ArrayIndexOutOfRange);
+    }
+
+    memset(m_buffer->GetBuffer() + dstIndex, (uint8)value, count);
+}
+
+void
+WebAssemblyMemory::CopyHelper(WebAssemblyMemory * mem, uint32 dstIndex, uint32 srcIndex, uint32 count)
+{
+    JIT_HELPER_NOT_REENTRANT_NOLOCK_HEADER(Op_CopyWasmMemory);
+    mem->Copy(dstIndex, srcIndex, count);
+    JIT_HELPER_END(Op_CopyWasmMemory);
+}
+
+void
+WebAssemblyMemory::FillHelper(WebAssemblyMemory * mem, uint32 dstIndex, int32 value, uint32 count)
+{
+    JIT_HELPER_NOT_REENTRANT_NOLOCK_HEADER(Op_FillWasmMemory);
+    mem->Fill(dstIndex, value, count);
+    JIT_HELPER_END(Op_FillWasmMemory);
+}
+
 #if DBG
 void WebAssemblyMemory::TraceMemWrite(WebAssemblyMemory* mem, uint32 index, uint32 offset, Js::ArrayBufferView::ViewType viewType, uint32 bytecodeOffset, ScriptContext* context)
 {
@@ -48,6 +48,11 @@ namespace Js
         int32 GrowInternal(uint32 deltaPages);
         static int32 GrowHelper(Js::WebAssemblyMemory * memory, uint32 deltaPages);
 
+        void Copy(uint32 dstIndex, uint32 srcIndex, uint32 count);
+        void Fill(uint32 dstIndex, int32 value, uint32 count);
+        static void CopyHelper(Js::WebAssemblyMemory * memory, uint32 dstIndex, uint32 srcIndex, uint32 count);
+        static void FillHelper(Js::WebAssemblyMemory * memory, uint32 dstIndex, int32 value, uint32 count);
+
         static int GetOffsetOfArrayBuffer() { return offsetof(WebAssemblyMemory, m_buffer); }
 #if DBG
         static void TraceMemWrite(WebAssemblyMemory* mem, uint32 index, uint32 offset, Js::ArrayBufferView::ViewType viewType, uint32 bytecodeOffset, ScriptContext* context);
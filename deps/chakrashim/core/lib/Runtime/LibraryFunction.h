@@ -78,5 +78,25 @@ LIBRARY_FUNCTION(Math,          Fround,             1,    BIF_TypeSpecUnaryToFlo
 LIBRARY_FUNCTION(JavascriptString,        PadStart,           2,    BIF_UseSrc0 | BIF_VariableArgsNumber                  , JavascriptString::EntryInfo::PadStart)
 LIBRARY_FUNCTION(JavascriptString,        PadEnd,             2,    BIF_UseSrc0 | BIF_VariableArgsNumber                  , JavascriptString::EntryInfo::PadEnd)
 LIBRARY_FUNCTION(JavascriptObject,        HasOwnProperty,     2,    BIF_UseSrc0                                           , JavascriptObject::EntryInfo::HasOwnProperty)
+LIBRARY_FUNCTION(JavascriptMap,           Get,                2,    BIF_UseSrc0                                           , JavascriptMap::EntryInfo::Get)
+LIBRARY_FUNCTION(JavascriptMap,           Has,                2,    BIF_UseSrc0                                           , JavascriptMap::EntryInfo::Has)
+LIBRARY_FUNCTION(JavascriptMap,           Set,                3,    BIF_UseSrc0 | BIF_IgnoreDst                           , JavascriptMap::EntryInfo::Set)
+LIBRARY_FUNCTION(JavascriptSet,           Has,                2,    BIF_UseSrc0                                           , JavascriptSet::EntryInfo::Has)
+LIBRARY_FUNCTION(DataView,                GetInt8,            3,    BIF_UseSrc0 | BIF_VariableArgsNumber                  , DataView::EntryInfo::GetInt8)
+LIBRARY_FUNCTION(DataView,                GetUint8,           3,    BIF_UseSrc0 | BIF_VariableArgsNumber                  , DataView::EntryInfo::GetUint8)
+LIBRARY_FUNCTION(DataView,                GetInt16,           3,    BIF_UseSrc0 | BIF_VariableArgsNumber                  , DataView::EntryInfo::GetInt16)
+LIBRARY_FUNCTION(DataView,                GetUint16,          3,    BIF_UseSrc0 | BIF_VariableArgsNumber                  , DataView::EntryInfo::GetUint16)
+LIBRARY_FUNCTION(DataView,                GetInt32,           3,    BIF_UseSrc0 | BIF_VariableArgsNumber                  , DataView::EntryInfo::GetInt32)
+LIBRARY_FUNCTION(DataView,                GetUint32,          3,    BIF_UseSrc0 | BIF_VariableArgsNumber                  , DataView::EntryInfo::GetUint32)
+LIBRARY_FUNCTION(DataView,                GetFloat32,         3,    BIF_UseSrc0 | BIF_VariableArgsNumber                  , DataView::EntryInfo::GetFloat32)
+LIBRARY_FUNCTION(DataView,                GetFloat64,         3,    BIF_UseSrc0 | BIF_VariableArgsNumber                  , DataView::EntryInfo::GetFloat64)
+LIBRARY_FUNCTION(DataView,                SetInt8,            4,    BIF_UseSrc0 | BIF_VariableArgsNumber | BIF_IgnoreDst  , DataView::EntryInfo::SetInt8)
+LIBRARY_FUNCTION(DataView,                SetUint8,           4,    BIF_UseSrc0 | BIF_VariableArgsNumber | BIF_IgnoreDst  , DataView::EntryInfo::SetUint8)
+LIBRARY_FUNCTION(DataView,                SetInt16,           4,    BIF_UseSrc0 | BIF_VariableArgsNumber | BIF_IgnoreDst  , DataView::EntryInfo::SetInt16)
+LIBRARY_FUNCTION(DataView,                SetUint16,          4,    BIF_UseSrc0 | BIF_VariableArgsNumber | BIF_IgnoreDst  , DataView::EntryInfo::SetUint16)
+LIBRARY_FUNCTION(DataView,                SetInt32,           4,    BIF_UseSrc0 | BIF_VariableArgsNumber | BIF_IgnoreDst  , DataView::EntryInfo::SetInt32)
+LIBRARY_FUNCTION(DataView,                SetUint32,          4,    BIF_UseSrc0 | BIF_VariableArgsNumber | BIF_IgnoreDst  , DataView::EntryInfo::SetUint32)
+LIBRARY_FUNCTION(DataView,                SetFloat32,         4,    BIF_UseSrc0 | BIF_VariableArgsNumber | BIF_IgnoreDst  , DataView::EntryInfo::SetFloat32)
+LIBRARY_FUNCTION(DataView,                SetFloat64,         4,    BIF_UseSrc0 | BIF_VariableArgsNumber | BIF_IgnoreDst  , DataView::EntryInfo::SetFloat64)
 
 // Note: 1st column is currently used only for debug tracing.
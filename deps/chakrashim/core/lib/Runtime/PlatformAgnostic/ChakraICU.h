@@ -79,6 +79,104 @@ namespace PlatformAgnostic
         typedef ScopedICUObject<UDateTimePatternGenerator *, udatpg_close> ScopedUDateTimePatternGenerator;
         typedef ScopedICUObject<UFieldPositionIterator *, ufieldpositer_close> ScopedUFieldPositionIterator;
 
+        // A small least recently used cache of configured ICU objects, keyed by a string that
+        // identifies everything used to open and configure them (locale and resolved options).
+        // Opening a formatter loads and parses locale data, which costs much more than cloning
+        // one that is already set up, so callers take a clone of the cached object instead.
+        // ICU objects must not be shared between threads; each cache belongs to one thread.
+        template<typename TObject,
+            TObject *(__cdecl * CloneFunction)(const TObject *, UErrorCode *),
+            void(__cdecl * CloseFunction)(TObject *),
+            int MaxEntries = 16>
+        class ICUObjectCache
+        {
+        public:
+            static const int MaxKeyLength = 256;
+
+            ICUObjectCache() : useCount(0), entryCount(0)
+            {
+
+            }
+            ICUObjectCache(const ICUObjectCache &other) = delete;
+            ICUObjectCache &operator=(const ICUObjectCache &other) = delete;
+            ~ICUObjectCache()
+            {
+                for (int i = 0; i < entryCount; i++)
+                {
+                    CloseFunction(entries[i].object);
+                }
+            }
+
+            // Returns a clone of the object cached for the key, which the caller owns, or nullptr
+            TObject *Clone(const UChar *key, int keyLength, UErrorCode *status)
+            {
+                for (int i = 0; i < entryCount; i++)
+                {
+                    Entry &entry = entries[i];
+                    if (entry.keyLength == keyLength && memcmp(entry.key, key, keyLength * sizeof(UChar)) == 0)
+                    {
+                        entry.lastUse = ++useCount;
+                        return CloneFunction(entry.object, status);
+                    }
+                }
+                return nullptr;
+            }
+
+            // Caches a clone of the object for the key, evicting the least recently used one if the
+            // cache is full. The caller keeps ownership of the object.
+            void Add(const UChar *key, int keyLength, const TObject *object)
+            {
+                if (keyLength > MaxKeyLength)
+                {
+                    return;
+                }
+
+                UErrorCode status = U_ZERO_ERROR;
+                TObject *clone = CloneFunction(object, &status);
+                if (U_FAILURE(status) || clone == nullptr)
+                {
+                    return;
+                }
+
+                int index = entryCount;
+                if (entryCount == MaxEntries)
+                {
+                    index = 0;
+                    for (int i = 1; i < entryCount; i++)
+                    {
+                        if (entries[i].lastUse < entries[index].lastUse)
+                        {
+                            index = i;
+                        }
+                    }
+                    CloseFunction(entries[index].object);
+                }
+                else
+                {
+                    entryCount++;
+                }
+
+                Entry &entry = entries[index];
+                entry.object = clone;
+                entry.lastUse = ++useCount;
+                entry.keyLength = keyLength;
+                memcpy(entry.key, key, keyLength * sizeof(UChar));
+            }
+
+        private:
+            struct Entry
+            {
+                TObject *object;
+                uint64 lastUse;
+                int keyLength;
+                UChar key[MaxKeyLength];
+            };
+
+            uint64 useCount;
+            int entryCount;
+            Entry entries[MaxEntries];
+        };
+
         inline int GetICUMajorVersion()
         {
             UVersionInfo version = { 0 };
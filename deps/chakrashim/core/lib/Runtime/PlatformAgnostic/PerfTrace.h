@@ -14,6 +14,13 @@
 //
 
 
+namespace Js
+{
+    class FunctionBody;
+    class FunctionEntryPointInfo;
+    class LoopEntryPointInfo;
+};
+
 namespace PlatformAgnostic
 {
 
@@ -23,11 +30,36 @@ namespace PlatformAgnostic
 class PerfTrace
 {
 public:
+    enum Mode
+    {
+        // Nothing is written until the perf map signal arrives
+        ModeNone = 0,
+        // Append each method to /tmp/perf-<pid>.map as native code is installed
+        ModePerfMap = 1 << 0,
+        // Write code bytes and line info to /tmp/jit-<pid>.dump for perf inject
+        ModeJitDump = 1 << 1,
+    };
+
     static void Register();
 
+    static bool Enable(int mode);
+    static bool IsJitDumpEnabled() { return jitDumpFd != -1; }
+
+    static void LogMethodNativeLoadEvent(Js::FunctionBody* body, Js::FunctionEntryPointInfo* entryPoint);
+    static void LogLoopBodyLoadEvent(Js::FunctionBody* body, Js::LoopEntryPointInfo* entryPoint, uint16 loopNumber);
+
     static void WritePerfMap();
 
     static volatile sig_atomic_t mapsRequested;
+
+private:
+    static void LogCodeLoad(Js::FunctionBody* body, const char* suffix,
+        DWORD_PTR address, size_t size, Js::FunctionEntryPointInfo* entryPoint);
+
+    static FILE* perfMapFile;
+    static int jitDumpFd;
+    static void* jitDumpMarker;
+    static uint64 codeIndex;
 };
 
 };
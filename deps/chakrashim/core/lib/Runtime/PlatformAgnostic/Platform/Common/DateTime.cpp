@@ -75,21 +75,161 @@ namespace DateTime
         return GetStandardName(nameLength, ymd);
     }
 
-    static void YMDLocalToUtc(double localtv, YMD *utc)
+    #define updatePeriod 1000
+
+    // Local time offsets are assumed not to change more than once within this many seconds,
+    // so a cached interval can be extended over a gap this large with just one more lookup
+    #define maxOffsetChangeGapSeconds (19 * 24 * 60 * 60)
+
+    static bool IsSameOffset(const DaylightTimeHelperPlatformData::OffsetInterval &interval, int offset, bool isDaylightSavings)
+    {
+        return interval.offset == offset && interval.isDaylightSavings == isDaylightSavings;
+    }
+
+    static void GetOffsetUncached(int64 seconds, int *offset, bool *isDaylightSavings)
+    {
+        GetTZ(DateTimeTicks_PerSecond * seconds, nullptr, isDaylightSavings, offset);
+    }
+
+    // Finds the second nearest to fromSeconds at which the offset of the interval no longer holds, given that
+    // it holds at fromSeconds and doesn't hold at toSeconds. toSeconds can be before or after fromSeconds.
+    static int64 FindOffsetChange(const DaylightTimeHelperPlatformData::OffsetInterval &interval, int64 fromSeconds, int64 toSeconds)
+    {
+        while (toSeconds - fromSeconds > 1 || fromSeconds - toSeconds > 1)
+        {
+            int64 midSeconds = fromSeconds + (toSeconds - fromSeconds) / 2;
+            int offset;
+            bool isDaylightSavings;
+            GetOffsetUncached(midSeconds, &offset, &isDaylightSavings);
+            if (IsSameOffset(interval, offset, isDaylightSavings))
+            {
+                fromSeconds = midSeconds;
+            }
+            else
+            {
+                toSeconds = midSeconds;
+            }
+        }
+        return toSeconds;
+    }
+
+    void DaylightTimeHelperPlatformData::GetOffset(int64 seconds, int *offset, bool *isDaylightSavings)
+    {
+        // Like the Windows time zone cache, pick up time zone changes at most updatePeriod ms late
+        uint32 tickCount = GetTickCount();
+        if (tickCount - lastUpdateTickCount > updatePeriod)
+        {
+            tzset();
+            intervalCount = 0;
+            lastUpdateTickCount = tickCount;
+        }
+
+        for (int i = 0; i < intervalCount; i++)
+        {
+            OffsetInterval &interval = intervals[i];
+            if (seconds >= interval.startSeconds && seconds <= interval.endSeconds)
+            {
+                interval.lastUse = ++useCount;
+                *offset = interval.offset;
+                *isDaylightSavings = interval.isDaylightSavings;
+                return;
+            }
+        }
+
+        GetOffsetUncached(seconds, offset, isDaylightSavings);
+
+        // Grow the interval that ends (or starts) closest to the time, if it is near enough that the
+        // offset can have changed at most once in between. Otherwise start a new interval.
+        OffsetInterval *nearest = nullptr;
+        int64 nearestGap = maxOffsetChangeGapSeconds + 1;
+        for (int i = 0; i < intervalCount; i++)
+        {
+            OffsetInterval &interval = intervals[i];
+            int64 gap = seconds > interval.endSeconds ? seconds - interval.endSeconds : interval.startSeconds - seconds;
+            if (gap < nearestGap)
+            {
+                nearest = &interval;
+                nearestGap = gap;
+            }
+        }
+
+        int64 startSeconds = seconds;
+        int64 endSeconds = seconds;
+        if (nearest != nullptr)
+        {
+            nearest->lastUse = ++useCount;
+            if (IsSameOffset(*nearest, *offset, *isDaylightSavings))
+            {
+                if (seconds > nearest->endSeconds)
+                {
+                    nearest->endSeconds = seconds;
+                }
+                else
+                {
+                    nearest->startSeconds = seconds;
+                }
+                return;
+            }
+
+            // The offset changes between the interval and the time; split the gap at the change
+            if (seconds > nearest->endSeconds)
+            {
+                startSeconds = FindOffsetChange(*nearest, nearest->endSeconds, seconds);
+                nearest->endSeconds = startSeconds - 1;
+            }
+            else
+            {
+                endSeconds = FindOffsetChange(*nearest, nearest->startSeconds, seconds);
+                nearest->startSeconds = endSeconds + 1;
+            }
+        }
+
+        int index = intervalCount;
+        if (intervalCount == IntervalCount)
+        {
+            index = 0;
+            for (int i = 1; i < intervalCount; i++)
+            {
+                if (intervals[i].lastUse < intervals[index].lastUse)
+                {
+                    index = i;
+                }
+            }
+        }
+        else
+        {
+            intervalCount++;
+        }
+
+        OffsetInterval &interval = intervals[index];
+        interval.startSeconds = startSeconds;
+        interval.endSeconds = endSeconds;
+        interval.offset = *offset;
+        interval.isDaylightSavings = *isDaylightSavings;
+        interval.lastUse = ++useCount;
+    }
+
+    // GetTZ looks up the offset for the time truncated to whole seconds
+    static void GetOffset(DaylightTimeHelperPlatformData &data, double tv, int *offset, bool *isDaylightSavings)
+    {
+        data.GetOffset((int64)(tv / 1000 /* drop ms */), offset, isDaylightSavings);
+    }
+
+    static void YMDLocalToUtc(DaylightTimeHelperPlatformData &data, double localtv, YMD *utc)
     {
         int mOffset = 0;
         bool isDST;
-        GetTZ(localtv, nullptr, &isDST, &mOffset);
+        GetOffset(data, localtv, &mOffset, &isDST);
         localtv -= DateTimeTicks_PerSecond * mOffset;
         Js::DateUtilities::GetYmdFromTv(localtv, utc);
     }
 
-    static void YMDUtcToLocal(double utctv, YMD *local,
+    static void YMDUtcToLocal(DaylightTimeHelperPlatformData &data, double utctv, YMD *local,
                           int &bias, int &offset, bool &isDaylightSavings)
     {
         int mOffset = 0;
         bool isDST;
-        GetTZ(utctv, nullptr, &isDST, &mOffset);
+        GetOffset(data, utctv, &mOffset, &isDST);
         utctv += DateTimeTicks_PerSecond * mOffset;
         Js::DateUtilities::GetYmdFromTv(utctv, local);
         isDaylightSavings = isDST;
@@ -102,7 +242,7 @@ namespace DateTime
                                           int &offset, bool &isDaylightSavings)
     {
         YMD local;
-        YMDUtcToLocal(utcTime, &local, bias, offset, isDaylightSavings);
+        YMDUtcToLocal(data, utcTime, &local, bias, offset, isDaylightSavings);
 
         return Js::DateUtilities::TvFromDate(local.year, local.mon, local.mday, local.time);
     }
@@ -110,7 +250,7 @@ namespace DateTime
     double DaylightTimeHelper::LocalToUtc(double localTime)
     {
         YMD utc;
-        YMDLocalToUtc(localTime, &utc);
+        YMDLocalToUtc(data, localTime, &utc);
 
         return Js::DateUtilities::TvFromDate(utc.year, utc.mon, utc.mday, utc.time);
     }
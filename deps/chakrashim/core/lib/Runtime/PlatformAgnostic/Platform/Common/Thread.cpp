@@ -7,6 +7,17 @@
 #include "CommonPal.h"
 
 #include <stdint.h>
+#if defined(__linux__)
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#else
+#include <pthread.h>
+#include <sys/time.h>
+#endif
 
 namespace PlatformAgnostic
 {
@@ -35,4 +46,150 @@ namespace PlatformAgnostic
 
         return reinterpret_cast<ThreadHandle>(CreateThread(0, stack_size, start_address, arg_list, flag, 0));
     }
+
+    unsigned int Thread::GetCurrentNumaNode()
+    {
+#if defined(__linux__) && defined(SYS_getcpu)
+        unsigned int cpu, node;
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+        {
+            return node;
+        }
+#endif
+        return InvalidNumaNode;
+    }
+
+    bool Thread::SetCurrentThreadNumaNode(unsigned int node)
+    {
+#if defined(__linux__)
+        if (node == InvalidNumaNode)
+        {
+            return false;
+        }
+
+        const size_t CPULIST_FILENAME_MAX_LENGTH = 64;
+        char filename[CPULIST_FILENAME_MAX_LENGTH];
+        snprintf(filename, CPULIST_FILENAME_MAX_LENGTH, "/sys/devices/system/node/node%u/cpulist", node);
+
+        int fd = open(filename, O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
+        {
+            return false;
+        }
+
+        // The list is a comma separated set of processor ranges, e.g. "0-11,24-35"
+        char cpuList[1024];
+        ssize_t length = read(fd, cpuList, sizeof(cpuList) - 1);
+        close(fd);
+        if (length <= 0)
+        {
+            return false;
+        }
+        cpuList[length] = '\0';
+
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        bool hasCpu = false;
+        char * current = cpuList;
+        while (*current >= '0' && *current <= '9')
+        {
+            unsigned long first = strtoul(current, &current, 10);
+            unsigned long last = first;
+            if (*current == '-')
+            {
+                last = strtoul(current + 1, &current, 10);
+            }
+            for (unsigned long cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++)
+            {
+                CPU_SET(cpu, &cpuSet);
+                hasCpu = true;
+            }
+            if (*current == ',')
+            {
+                current++;
+            }
+        }
+
+        return hasCpu && sched_setaffinity(0, sizeof(cpuSet), &cpuSet) == 0;
+#else
+        return false;
+#endif
+    }
+
+#if defined(__linux__)
+    void Thread::WaitOnAddress(volatile int32 *address, int32 expected, uint32 timeout)
+    {
+        struct timespec relative;
+        relative.tv_sec = timeout / 1000;
+        relative.tv_nsec = (timeout % 1000) * 1000000;
+
+        // Returns immediately if *address != expected, so a wake between the caller's check and the wait isn't lost
+        syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, expected, timeout == INFINITE ? nullptr : &relative, nullptr, 0);
+    }
+
+    void Thread::WakeAddress(volatile int32 *address)
+    {
+        syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+    }
+#else
+    // Without futexes, waiters park on a condition variable picked by hashing the address.
+    // Waking broadcasts to the bucket, which can wake waiters on other addresses spuriously.
+    struct AddressWaitBucket
+    {
+        pthread_mutex_t mutex;
+        pthread_cond_t condition;
+    };
+
+    static const size_t AddressWaitBucketCount = 64;
+    static AddressWaitBucket addressWaitBuckets[AddressWaitBucketCount];
+    static pthread_once_t addressWaitBucketsOnce = PTHREAD_ONCE_INIT;
+
+    static void InitAddressWaitBuckets()
+    {
+        for (size_t i = 0; i < AddressWaitBucketCount; i++)
+        {
+            pthread_mutex_init(&addressWaitBuckets[i].mutex, nullptr);
+            pthread_cond_init(&addressWaitBuckets[i].condition, nullptr);
+        }
+    }
+
+    static AddressWaitBucket &GetAddressWaitBucket(volatile int32 *address)
+    {
+        pthread_once(&addressWaitBucketsOnce, InitAddressWaitBuckets);
+        return addressWaitBuckets[(reinterpret_cast<uintptr_t>(address) >> 2) % AddressWaitBucketCount];
+    }
+
+    void Thread::WaitOnAddress(volatile int32 *address, int32 expected, uint32 timeout)
+    {
+        AddressWaitBucket &bucket = GetAddressWaitBucket(address);
+        pthread_mutex_lock(&bucket.mutex);
+        if (*address == expected)
+        {
+            if (timeout == INFINITE)
+            {
+                pthread_cond_wait(&bucket.condition, &bucket.mutex);
+            }
+            else
+            {
+                struct timeval now;
+                gettimeofday(&now, nullptr);
+                uint64 nanoseconds = (uint64)now.tv_usec * 1000 + (uint64)(timeout % 1000) * 1000000;
+
+                struct timespec deadline;
+                deadline.tv_sec = now.tv_sec + timeout / 1000 + (time_t)(nanoseconds / 1000000000);
+                deadline.tv_nsec = (long)(nanoseconds % 1000000000);
+                pthread_cond_timedwait(&bucket.condition, &bucket.mutex, &deadline);
+            }
+        }
+        pthread_mutex_unlock(&bucket.mutex);
+    }
+
+    void Thread::WakeAddress(volatile int32 *address)
+    {
+        AddressWaitBucket &bucket = GetAddressWaitBucket(address);
+        pthread_mutex_lock(&bucket.mutex);
+        pthread_cond_broadcast(&bucket.condition);
+        pthread_mutex_unlock(&bucket.mutex);
+    }
+#endif
 } // namespace PlatformAgnostic
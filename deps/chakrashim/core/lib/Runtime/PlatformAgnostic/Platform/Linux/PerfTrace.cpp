@@ -8,8 +8,17 @@
 
 #include <signal.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <elf.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
 #include <unistd.h>
 
+#ifdef VTUNE_PROFILING
+#include "Base/jitprofiling.h"
+#endif
+
 using namespace Js;
 
 #if PERFMAP_TRACE_ENABLED
@@ -26,12 +35,122 @@ namespace PlatformAgnostic
 {
 
 volatile sig_atomic_t PerfTrace::mapsRequested = 0;
+FILE* PerfTrace::perfMapFile = nullptr;
+int PerfTrace::jitDumpFd = -1;
+void* PerfTrace::jitDumpMarker = nullptr;
+uint64 PerfTrace::codeIndex = 0;
+
+// Serializes writers from the threads of different runtimes
+static CriticalSection perfTraceLock;
+
+//
+// jitdump records, as described in tools/perf/Documentation/jitdump-specification.txt
+// of the Linux sources.
+//
+static const uint32 JitDumpMagic = 0x4A695444;
+static const uint32 JitDumpVersion = 1;
+
+struct JitDumpHeader
+{
+    uint32 magic;
+    uint32 version;
+    uint32 totalSize;
+    uint32 elfMach;
+    uint32 pad1;
+    uint32 pid;
+    uint64 timestamp;
+    uint64 flags;
+};
+
+enum JitDumpRecordType : uint32
+{
+    JitCodeLoad = 0,
+    JitCodeDebugInfo = 2,
+};
+
+struct JitDumpRecordHeader
+{
+    uint32 id;
+    uint32 totalSize;
+    uint64 timestamp;
+};
+
+struct JitDumpCodeLoad
+{
+    JitDumpRecordHeader header;
+    uint32 pid;
+    uint32 tid;
+    uint64 vma;
+    uint64 codeAddress;
+    uint64 codeSize;
+    uint64 codeIndex;
+    // Followed by the null terminated name and the code bytes
+};
+
+struct JitDumpDebugInfo
+{
+    JitDumpRecordHeader header;
+    uint64 codeAddress;
+    uint64 entryCount;
+    // Followed by the entries
+};
+
+struct JitDumpDebugEntry
+{
+    uint64 address;
+    int32 line;
+    int32 discriminator;
+    // Followed by the null terminated file name
+};
+
+// perf matches these with `perf record -k mono`
+static uint64 GetJitDumpTimestamp()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+static uint32 GetElfMachine()
+{
+#if defined(_M_X64)
+    return EM_X86_64;
+#elif defined(_M_IX86)
+    return EM_386;
+#elif defined(_M_ARM64)
+    return EM_AARCH64;
+#elif defined(_M_ARM)
+    return EM_ARM;
+#else
+    return EM_NONE;
+#endif
+}
+
+static void WriteFully(int fd, const void* data, size_t size)
+{
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0)
+    {
+        ssize_t written = write(fd, bytes, size);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return;
+        }
+        bytes += written;
+        size -= written;
+    }
+}
 
 //
 // Registers a signal handler for SIGUSR2
 //
 void PerfTrace::Register()
 {
+#if PERFMAP_SIGNAL
     struct sigaction newAction = {0};
     newAction.sa_flags = SA_RESTART;
     newAction.sa_handler = handle_signal;
@@ -43,26 +162,239 @@ void PerfTrace::Register()
     {
         AssertMsg(errno, "PerfTrace::Register: sigaction() call failed\n");
     }
+#endif
+}
+
+//
+// Starts writing code load events as native code is installed. Files that are
+// already open stay open, so this can be called again to add a mode.
+//
+bool PerfTrace::Enable(int mode)
+{
+#if ENABLE_NATIVE_CODEGEN
+    AutoCriticalSection autoPerfTraceCs(&perfTraceLock);
+    pid_t processId = getpid();
+
+    const size_t PERF_FILENAME_MAX_LENGTH = 30;
+    char filename[PERF_FILENAME_MAX_LENGTH];
+
+    if ((mode & ModePerfMap) && perfMapFile == nullptr)
+    {
+        snprintf(filename, PERF_FILENAME_MAX_LENGTH, "/tmp/perf-%d.map", processId);
+        perfMapFile = fopen(filename, "a");
+        if (perfMapFile == nullptr)
+        {
+            return false;
+        }
+    }
+
+    if ((mode & ModeJitDump) && jitDumpFd == -1)
+    {
+        snprintf(filename, PERF_FILENAME_MAX_LENGTH, "/tmp/jit-%d.dump", processId);
+        int fd = open(filename, O_CREAT | O_TRUNC | O_RDWR | O_CLOEXEC, 0666);
+        if (fd == -1)
+        {
+            return false;
+        }
+
+        // perf finds the file through this executable mapping in its mmap events
+        long pageSize = sysconf(_SC_PAGESIZE);
+        void* marker = mmap(nullptr, pageSize, PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, 0);
+        if (marker == MAP_FAILED)
+        {
+            close(fd);
+            return false;
+        }
+
+        JitDumpHeader header = {0};
+        header.magic = JitDumpMagic;
+        header.version = JitDumpVersion;
+        header.totalSize = sizeof(header);
+        header.elfMach = GetElfMachine();
+        header.pid = processId;
+        header.timestamp = GetJitDumpTimestamp();
+        WriteFully(fd, &header, sizeof(header));
+
+        jitDumpFd = fd;
+        jitDumpMarker = marker;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+//
+// A heap allocated UTF-8 copy of a function name or url
+//
+class Utf8Name
+{
+public:
+    explicit Utf8Name(const char16* name) : buffer(nullptr), bufferLength(0)
+    {
+        if (name == nullptr)
+        {
+            return;
+        }
+        charcount_t length = static_cast<charcount_t>(min(wcslen(name), (size_t)(INT_MAX / 3 - 1)));
+        bufferLength = UInt32Math::MulAdd<3, 1>(length);
+        buffer = HeapNewNoThrowArray(utf8char_t, bufferLength);
+        if (buffer != nullptr)
+        {
+            utf8::EncodeIntoAndNullTerminate<utf8::Utf8EncodingKind::Cesu8>(buffer, bufferLength, name, length);
+        }
+    }
+
+    ~Utf8Name()
+    {
+        if (buffer != nullptr)
+        {
+            HeapDeleteArray(bufferLength, buffer);
+        }
+    }
+
+    const char* Get() const { return reinterpret_cast<const char*>(buffer); }
+
+private:
+    utf8char_t* buffer;
+    size_t bufferLength;
+};
+
+void PerfTrace::LogCodeLoad(FunctionBody* body, const char* suffix,
+    DWORD_PTR address, size_t size, FunctionEntryPointInfo* entryPoint)
+{
+#if ENABLE_NATIVE_CODEGEN
+    Utf8Name functionName(body->GetExternalDisplayName());
+    SourceContextInfo* sourceContextInfo = body->GetSourceContextInfo();
+    Utf8Name url(sourceContextInfo->IsDynamic() ? nullptr : sourceContextInfo->url);
+    if (functionName.Get() == nullptr)
+    {
+        return;
+    }
+    const char* fileName = url.Get() != nullptr ? url.Get() : "[eval]";
+
+    // Same names as WritePerfMap, plus where the function starts
+    char name[512];
+    snprintf(name, sizeof(name), "%s %s:%u(%s)", functionName.Get(), fileName,
+        static_cast<uint>(body->GetLineNumber()), suffix);
+
+    AutoCriticalSection autoPerfTraceCs(&perfTraceLock);
+
+    if (perfMapFile != nullptr)
+    {
+        fprintf(perfMapFile, "%llX %llX %s\n",
+            static_cast<unsigned long long>(address), static_cast<unsigned long long>(size), name);
+        fflush(perfMapFile);
+    }
+
+    if (jitDumpFd != -1)
+    {
+        uint64 timestamp = GetJitDumpTimestamp();
+
+#ifdef VTUNE_PROFILING
+        // Line info is only recorded for functions, not for loop bodies
+        if (entryPoint != nullptr)
+        {
+            uint lineCount = entryPoint->GetNativeOffsetMapCount() * 2 + 1;
+            LineNumberInfo* lineInfo = HeapNewNoThrowArray(LineNumberInfo, lineCount);
+            if (lineInfo != nullptr)
+            {
+                uint entryCount = entryPoint->PopulateLineInfo(lineInfo, body);
+                size_t fileNameSize = strlen(fileName) + 1;
+
+                JitDumpDebugInfo debugInfo;
+                debugInfo.header.id = JitCodeDebugInfo;
+                debugInfo.header.totalSize = static_cast<uint32>(sizeof(debugInfo) +
+                    entryCount * (sizeof(JitDumpDebugEntry) + fileNameSize));
+                debugInfo.header.timestamp = timestamp;
+                debugInfo.codeAddress = address;
+                debugInfo.entryCount = entryCount;
+                WriteFully(jitDumpFd, &debugInfo, sizeof(debugInfo));
+
+                for (uint i = 0; i < entryCount; i++)
+                {
+                    JitDumpDebugEntry entry;
+                    entry.address = address + lineInfo[i].Offset;
+                    entry.line = static_cast<int32>(lineInfo[i].LineNumber);
+                    entry.discriminator = 0;
+                    WriteFully(jitDumpFd, &entry, sizeof(entry));
+                    WriteFully(jitDumpFd, fileName, fileNameSize);
+                }
+                HeapDeleteArray(lineCount, lineInfo);
+            }
+        }
+#endif
+
+        size_t nameSize = strlen(name) + 1;
+        JitDumpCodeLoad codeLoad;
+        codeLoad.header.id = JitCodeLoad;
+        codeLoad.header.totalSize = static_cast<uint32>(sizeof(codeLoad) + nameSize + size);
+        codeLoad.header.timestamp = timestamp;
+        codeLoad.pid = getpid();
+        codeLoad.tid = static_cast<uint32>(syscall(SYS_gettid));
+        codeLoad.vma = address;
+        codeLoad.codeAddress = address;
+        codeLoad.codeSize = size;
+        codeLoad.codeIndex = codeIndex++;
+        WriteFully(jitDumpFd, &codeLoad, sizeof(codeLoad));
+        WriteFully(jitDumpFd, name, nameSize);
+        WriteFully(jitDumpFd, reinterpret_cast<const void*>(address), size);
+    }
+#endif
+}
+
+void PerfTrace::LogMethodNativeLoadEvent(FunctionBody* body, FunctionEntryPointInfo* entryPoint)
+{
+#if ENABLE_NATIVE_CODEGEN
+    if (perfMapFile == nullptr && jitDumpFd == -1)
+    {
+        return;
+    }
+
+    LogCodeLoad(body, entryPoint->GetJitMode() == ExecutionMode::SimpleJit ? "SimpleJIT" : "FullJIT",
+        entryPoint->GetNativeAddress(), entryPoint->GetCodeSize(), entryPoint);
+#endif
+}
+
+void PerfTrace::LogLoopBodyLoadEvent(FunctionBody* body, LoopEntryPointInfo* entryPoint, uint16 loopNumber)
+{
+#if ENABLE_NATIVE_CODEGEN
+    if (perfMapFile == nullptr && jitDumpFd == -1)
+    {
+        return;
+    }
+
+    char suffix[16];
+    snprintf(suffix, sizeof(suffix), "Loop%u", loopNumber + 1);
+    LogCodeLoad(body, suffix, entryPoint->GetNativeAddress(), entryPoint->GetCodeSize(), nullptr);
+#endif
 }
 
 void  PerfTrace::WritePerfMap()
 {
 #if ENABLE_NATIVE_CODEGEN
+    if (perfMapFile != nullptr)
+    {
+        // The map is already written as code is installed
+        PerfTrace::mapsRequested = 0;
+        return;
+    }
+
     // Lock threadContext list during etw rundown
     AutoCriticalSection autoThreadContextCs(ThreadContext::GetCriticalSection());
 
     ThreadContext * threadContext = ThreadContext::GetThreadContextList();
 
-    FILE * perfMapFile;
+    FILE * mapFile;
 
     {
         const size_t PERFMAP_FILENAME_MAX_LENGTH = 30;
-        char perfMapFilename[PERFMAP_FILENAME_MAX_LENGTH];
+        char mapFilename[PERFMAP_FILENAME_MAX_LENGTH];
         pid_t processId = getpid();
-        snprintf(perfMapFilename, PERFMAP_FILENAME_MAX_LENGTH, "/tmp/perf-%d.map", processId);
+        snprintf(mapFilename, PERFMAP_FILENAME_MAX_LENGTH, "/tmp/perf-%d.map", processId);
 
-        perfMapFile = fopen(perfMapFilename, "w");
-        if (perfMapFile == NULL) {
+        mapFile = fopen(mapFilename, "w");
+        if (mapFile == NULL) {
             return;
         }
     }
@@ -87,7 +419,7 @@ void  PerfTrace::WritePerfMap()
                 if(body->HasInterpreterThunkGenerated())
                 {
                     const char16* functionName = body->GetExternalDisplayName();
-                    fwprintf(perfMapFile, _u("%llX %llX %s(Interpreted)\n"),
+                    fwprintf(mapFile, _u("%llX %llX %s(Interpreted)\n"),
                         body->GetDynamicInterpreterEntryPoint(),
                         body->GetDynamicInterpreterThunkSize(),
                         functionName);
@@ -102,14 +434,14 @@ void  PerfTrace::WritePerfMap()
                         const ExecutionMode jitMode = entryPoint->GetJitMode();
                         if (jitMode == ExecutionMode::SimpleJit)
                         {
-                            fwprintf(perfMapFile, _u("%llX %llX %s(SimpleJIT)\n"),
+                            fwprintf(mapFile, _u("%llX %llX %s(SimpleJIT)\n"),
                                 entryPoint->GetNativeAddress(),
                                 entryPoint->GetCodeSize(),
                                 body->GetExternalDisplayName());
                         }
                         else
                         {
-                            fwprintf(perfMapFile, _u("%llX %llX %s(FullJIT)\n"),
+                            fwprintf(mapFile, _u("%llX %llX %s(FullJIT)\n"),
                                 entryPoint->GetNativeAddress(),
                                 entryPoint->GetCodeSize(),
                                 body->GetExternalDisplayName());
@@ -124,7 +456,7 @@ void  PerfTrace::WritePerfMap()
                         if(entryPoint->IsCodeGenDone())
                         {
                             const uint16 loopNumber = ((uint16)body->GetLoopNumberWithLock(header));
-                            fwprintf(perfMapFile, _u("%llX %llX %s(Loop%u)\n"),
+                            fwprintf(mapFile, _u("%llX %llX %s(Loop%u)\n"),
                                 entryPoint->GetNativeAddress(),
                                 entryPoint->GetCodeSize(),
                                 body->GetExternalDisplayName(),
@@ -141,8 +473,8 @@ void  PerfTrace::WritePerfMap()
         threadContext = threadContext->Next();
     }
 
-    fflush(perfMapFile);
-    fclose(perfMapFile);
+    fflush(mapFile);
+    fclose(mapFile);
 #endif
     PerfTrace::mapsRequested = 0;
 }
@@ -13,16 +13,35 @@ using namespace Js;
 namespace PlatformAgnostic
 {
 
+// The perf map and jitdump files are only read by Linux perf. On Windows, profilers find JIT code through the
+// ETW method load events (see EtwTrace) instead, so nothing is written here and JsSetPerfMapFlags reports
+// JsErrorNotImplemented for anything but JsPerfMapNone.
+
 volatile sig_atomic_t PerfTrace::mapsRequested = 0;
+FILE* PerfTrace::perfMapFile = nullptr;
+int PerfTrace::jitDumpFd = -1;
+void* PerfTrace::jitDumpMarker = nullptr;
+uint64 PerfTrace::codeIndex = 0;
 
 void PerfTrace::Register()
 {
-    // TODO: Implement this on Windows?
+}
+
+bool PerfTrace::Enable(int mode)
+{
+    return mode == ModeNone;
+}
+
+void PerfTrace::LogMethodNativeLoadEvent(FunctionBody* body, FunctionEntryPointInfo* entryPoint)
+{
+}
+
+void PerfTrace::LogLoopBodyLoadEvent(FunctionBody* body, LoopEntryPointInfo* entryPoint, uint16 loopNumber)
+{
 }
 
 void  PerfTrace::WritePerfMap()
 {
-    // TODO: Implement this on Windows?
 }
 
 }
@@ -46,4 +46,26 @@ namespace PlatformAgnostic
 
         return handle;
     }
+
+    unsigned int Thread::GetCurrentNumaNode()
+    {
+        PROCESSOR_NUMBER processorNumber;
+        USHORT node;
+        GetCurrentProcessorNumberEx(&processorNumber);
+        if (!GetNumaProcessorNodeEx(&processorNumber, &node) || node == MAXUSHORT)
+        {
+            return InvalidNumaNode;
+        }
+        return node;
+    }
+
+    bool Thread::SetCurrentThreadNumaNode(unsigned int node)
+    {
+        GROUP_AFFINITY affinity;
+        if (node == InvalidNumaNode || !GetNumaNodeProcessorMaskEx((USHORT)node, &affinity))
+        {
+            return false;
+        }
+        return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) != FALSE;
+    }
 } // namespace PlatformAgnostic
@@ -414,6 +414,7 @@ enum tagDEBUG_EVENT_INFO_TYPE
 #include "Language/JavascriptExceptionContext.h"
 #include "Language/JavascriptExceptionObject.h"
 #include "Base/PerfHint.h"
+#include "Base/JitStatistics.h"
 
 #include "ByteCode/ByteBlock.h"
 
@@ -499,6 +500,7 @@ enum tagDEBUG_EVENT_INFO_TYPE
 #include "Library/PropertyRecordUsageCache.h"
 #include "Library/PropertyString.h"
 #include "Library/SingleCharString.h"
+#include "Library/OneByteString.h"
 
 #include "Library/JavascriptTypedNumber.h"
 #include "Library/SparseArraySegment.h"
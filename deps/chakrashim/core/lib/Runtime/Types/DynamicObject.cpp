@@ -922,7 +922,7 @@ namespace Js
         }
 #endif
 
-        if (!PHASE_ON1(ObjectCopyPhase))
+        if (PHASE_OFF1(ObjectCopyPhase))
         {
             return false;
         }
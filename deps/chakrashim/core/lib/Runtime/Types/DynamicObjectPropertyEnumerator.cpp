@@ -73,7 +73,7 @@ namespace Js
             Assert(data != nullptr);
             Assert(data->scriptContext == this->scriptContext); // The cache data script context should be the same as request context
 
-            if (data->enumNonEnumerable == GetEnumNonEnumerable())
+            if (IsCompatibleCachedData(data))
             {
                 Initialize(type, data, data->propertyCount);
                 return true;
@@ -81,8 +81,12 @@ namespace Js
         }
 
         data = (CachedData *)requestContext->GetThreadContext()->GetDynamicObjectEnumeratorCache(type);
+        while (data != nullptr && !IsCompatibleCachedData(data))
+        {
+            data = data->next;
+        }
 
-        if (data != nullptr && data->scriptContext == this->scriptContext && data->enumNonEnumerable == GetEnumNonEnumerable() && data->enumSymbols == GetEnumSymbols())
+        if (data != nullptr)
         {
             Initialize(type, data, data->propertyCount);
 
@@ -119,6 +123,8 @@ namespace Js
         data->completed = false;
         data->enumNonEnumerable = GetEnumNonEnumerable();
         data->enumSymbols = GetEnumSymbols();
+        // EnsureObjectReady may have changed the type, so look its list up again
+        data->next = (CachedData *)requestContext->GetThreadContext()->GetDynamicObjectEnumeratorCache(type);
         requestContext->GetThreadContext()->AddDynamicObjectEnumeratorCache(type, data);
         Initialize(type, data, propertyCount);
 
@@ -130,6 +136,13 @@ namespace Js
         return true;
     }
 
+    bool DynamicObjectPropertyEnumerator::IsCompatibleCachedData(CachedData * data) const
+    {
+        return data->scriptContext == this->scriptContext
+            && data->enumNonEnumerable == GetEnumNonEnumerable()
+            && data->enumSymbols == GetEnumSymbols();
+    }
+
     bool DynamicObjectPropertyEnumerator::IsNullEnumerator() const
     {
         return this->object == nullptr;
@@ -29,6 +29,10 @@ namespace Js
             Field(bool) completed;
             Field(bool) enumNonEnumerable;
             Field(bool) enumSymbols;
+            // The same type can be enumerated with different flags, e.g. for-in over an object whose
+            // prototype has enumerable properties, and Object.keys over it. The thread context keeps
+            // one list of them per type, so that they don't keep evicting each other.
+            Field(CachedData *) next;
         };
         Field(CachedData *) cachedData;
 
@@ -37,6 +41,7 @@ namespace Js
         JavascriptString * MoveAndGetNextNoCache(PropertyId& propertyId, PropertyAttributes * attributes);
 
         void Initialize(DynamicType * type, CachedData * data, Js::BigPropertyIndex initialPropertyCount);
+        bool IsCompatibleCachedData(CachedData * data) const;
         BigPropertyIndex PropertyIndexToPropertyEnumeration(BigPropertyIndex index) const { return object->GetTypeHandler()->PropertyIndexToPropertyEnumeration(index); }
     public:
         DynamicObject * GetObject() const { return object; }
@@ -956,6 +956,12 @@ namespace Js
 
 #ifdef PROFILE_TYPES
         instance->GetScriptContext()->convertPathToDictionaryDeletedCount++;
+#endif
+#ifdef PERF_HINT
+        if (PHASE_TRACE1(Js::PerfHintPhase))
+        {
+            WritePerfHintForCaller(PerfHints::ObjectDictionaryModeOnDelete, instance->GetScriptContext());
+        }
 #endif
         BOOL deleteResult = TryConvertToSimpleDictionaryType(instance, pathLength)->DeleteProperty(instance, propertyId, flags);
 
@@ -2161,6 +2167,17 @@ namespace Js
 #ifdef PROFILE_TYPES
             scriptContext->promoteCount++;
 #endif
+#ifdef TYPE_TRANSITION_STATS
+            if (PHASE_STATS1(Js::TypeTransitionPhase))
+            {
+                DynamicType * rootType = predecessorType;
+                while (PathTypeHandlerBase::FromTypeHandler(rootType->GetTypeHandler())->GetPredecessorType() != nullptr)
+                {
+                    rootType = PathTypeHandlerBase::FromTypeHandler(rootType->GetTypeHandler())->GetPredecessorType();
+                }
+                scriptContext->LogTypeTransition(rootType, nextPath->GetPathLength(), branching);
+            }
+#endif
 #ifdef PROFILE_OBJECT_LITERALS
             if (isObjectLiteral)
             {
@@ -2360,6 +2377,12 @@ namespace Js
         {
 #ifdef PROFILE_TYPES
             scriptContext->convertPathToDictionaryExceededLengthCount++;
+#endif
+#ifdef PERF_HINT
+            if (PHASE_TRACE1(Js::PerfHintPhase))
+            {
+                WritePerfHintForCaller(PerfHints::ObjectDictionaryModeTooManyProperties, scriptContext);
+            }
 #endif
             return TryConvertToSimpleDictionaryType(instance, GetPathLength() + 1)->SetPropertyWithAttributes(instance, propertyId, value, ObjectSlotAttributesToPropertyAttributes(attr), info, PropertyOperation_None, possibleSideEffects);
         }
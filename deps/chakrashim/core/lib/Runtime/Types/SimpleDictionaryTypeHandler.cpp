@@ -259,7 +259,8 @@ namespace Js
         _gc_tag(true),
         isUnordered(false),
         hasNamelessPropertyId(false),
-        numDeletedProperties(0)
+        numDeletedProperties(0),
+        stableAccessCount(0)
     {
         SetIsInlineSlotCapacityLocked();
         propertyMap = RecyclerNew(recycler, SimplePropertyDescriptorMap, recycler, this->GetSlotCapacity());
@@ -274,7 +275,8 @@ namespace Js
         _gc_tag(true),
         isUnordered(false),
         hasNamelessPropertyId(false),
-        numDeletedProperties(0)
+        numDeletedProperties(0),
+        stableAccessCount(0)
     {
         SetIsInlineSlotCapacityLocked();
         Assert(slotCapacity <= MaxPropertyIndexSize);
@@ -295,7 +297,8 @@ namespace Js
         _gc_tag(true),
         isUnordered(false),
         hasNamelessPropertyId(false),
-        numDeletedProperties(0)
+        numDeletedProperties(0),
+        stableAccessCount(0)
     {
         SetIsInlineSlotCapacityLocked();
         Assert(slotCapacity <= MaxPropertyIndexSize);
@@ -311,7 +314,8 @@ namespace Js
         _gc_tag(true),
         isUnordered(false),
         hasNamelessPropertyId(false),
-        numDeletedProperties(0)
+        numDeletedProperties(0),
+        stableAccessCount(0)
     {
         SetIsInlineSlotCapacityLocked();
         Assert(slotCapacity <= MaxPropertyIndexSize);
@@ -327,7 +331,8 @@ namespace Js
         _gc_tag(typeHandler->_gc_tag),
         isUnordered(typeHandler->isUnordered),
         hasNamelessPropertyId(typeHandler->hasNamelessPropertyId),
-        numDeletedProperties(typeHandler->numDeletedProperties)
+        numDeletedProperties(typeHandler->numDeletedProperties),
+        stableAccessCount(0)
     {
         Assert(this->GetIsInlineSlotCapacityLocked() == typeHandler->GetIsInlineSlotCapacityLocked());
         Assert(this->GetSlotCapacity() <= MaxPropertyIndexSize);
@@ -554,6 +559,125 @@ namespace Js
         return newTypeHandler;
     }
 
+    // Counts a slow path access to an existing property. An object that went to dictionary mode, typically because a
+    // property was deleted, and whose properties then stay the same for enough accesses is turned back into a path type
+    // so that it can use the inline caches again. The threshold grows with the number of properties to pay for rebuilding.
+    template <typename TPropertyIndex, typename TMapKey, bool IsNotExtensibleSupported>
+    bool SimpleDictionaryTypeHandlerBase<TPropertyIndex, TMapKey, IsNotExtensibleSupported>::CountStableAccess(SimpleDictionaryPropertyDescriptor<TPropertyIndex>* descriptor)
+    {
+        if ((descriptor->Attributes & PropertyDeleted) || this->stableAccessCount == NoPathTypeConversion)
+        {
+            return false;
+        }
+
+        ++this->stableAccessCount;
+        return this->stableAccessCount >= (uint)CONFIG_FLAG(DictionaryToPathTypeThreshold) + 2 * (uint)propertyMap->Count();
+    }
+
+    template <typename TPropertyIndex, typename TMapKey, bool IsNotExtensibleSupported>
+    PathTypeHandlerBase* SimpleDictionaryTypeHandlerBase<TPropertyIndex, TMapKey, IsNotExtensibleSupported>::TryConvertToPathType(DynamicObject* instance)
+    {
+        // Don't look at this handler again until a property is added or deleted
+        this->stableAccessCount = NoPathTypeConversion;
+
+        if (PHASE_OFF1(Js::DictionaryToPathTypePhase))
+        {
+            return nullptr;
+        }
+
+        // Only plain, extensible, non-prototype objects whose handler isn't shared or being enumerated
+        if (GetIsLocked() || GetIsShared() || hasNamelessPropertyId ||
+            (this->GetFlags() & (IsPrototypeFlag | IsExtensibleFlag | IsSealedOnceFlag | IsFrozenOnceFlag)) != IsExtensibleFlag)
+        {
+            return nullptr;
+        }
+
+        ScriptContext* scriptContext = instance->GetScriptContext();
+        JavascriptLibrary* library = scriptContext->GetLibrary();
+        if (instance->GetTypeId() != TypeIds_Object ||
+            !VirtualTableInfo<DynamicObject>::HasVirtualTable(instance) ||
+            instance->GetPrototype() != library->GetObjectPrototype() ||
+            instance->IsExternal() ||
+            CrossSite::IsThunk(instance->GetType()->GetEntryPoint()) ||
+            !DynamicTypeHandler::CanBeSingletonInstance(instance) ||
+            (uint)GetSlotCapacity() > TypePath::MaxPathTypeHandlerLength)
+        {
+            return nullptr;
+        }
+
+        DynamicType* rootType = library->GetObjectLiteralType(GetInlineSlotCapacity());
+        DynamicTypeHandler* rootTypeHandler = rootType->GetTypeHandler();
+        if (rootTypeHandler->GetInlineSlotCapacity() != GetInlineSlotCapacity() ||
+            rootTypeHandler->GetOffsetOfInlineSlots() != GetOffsetOfInlineSlots())
+        {
+            return nullptr;
+        }
+
+        // Only writable, enumerable, configurable data properties have an equivalent path type
+        PropertyId propertyIds[TypePath::MaxPathTypeHandlerLength];
+        Var values[TypePath::MaxPathTypeHandlerLength];
+        uint propertyCount = 0;
+        for (int i = 0; i < propertyMap->Count(); i++)
+        {
+            SimpleDictionaryPropertyDescriptor<TPropertyIndex>* descriptor = propertyMap->GetReferenceAt(i);
+            if (descriptor->Attributes & PropertyDeleted)
+            {
+                continue;
+            }
+
+            if (descriptor->Attributes != PropertyDynamicTypeDefaults || descriptor->propertyIndex == NoSlots
+#if ENABLE_FIXED_FIELDS
+                || !descriptor->isInitialized
+#endif
+                )
+            {
+                return nullptr;
+            }
+
+            PropertyRecord const* propertyRecord = TMapKey_ConvertKey<const PropertyRecord*>(scriptContext, propertyMap->GetKeyAt(i));
+            Var value = instance->GetSlot(descriptor->propertyIndex);
+            if (propertyRecord->IsNumeric() || value == nullptr || propertyCount == TypePath::MaxPathTypeHandlerLength)
+            {
+                return nullptr;
+            }
+
+            propertyIds[propertyCount] = propertyRecord->GetPropertyId();
+            values[propertyCount] = value;
+            propertyCount++;
+        }
+
+#if ENABLE_FIXED_FIELDS
+        // The object gets a new type, but code that hard-coded one of its fixed fields may not check the type
+        for (int i = 0; i < propertyMap->Count(); i++)
+        {
+            SimpleDictionaryPropertyDescriptor<TPropertyIndex>* descriptor = propertyMap->GetReferenceAt(i);
+            if (!(descriptor->Attributes & PropertyDeleted))
+            {
+                InvalidateFixedField(propertyMap->GetKeyAt(i), descriptor, scriptContext);
+            }
+        }
+        if (this->singletonInstance != nullptr)
+        {
+            ClearSingletonInstance();
+        }
+#endif
+
+        // Rebuild the type from the root so that equally shaped objects end up with the same type
+        instance->ReplaceType(rootType);
+        for (uint i = 0; i < propertyCount; i++)
+        {
+            instance->GetTypeHandler()->SetProperty(instance, propertyIds[i], values[i], PropertyOperation_None, nullptr);
+        }
+
+#ifdef PROFILE_TYPES
+        scriptContext->convertSimpleDictionaryToPathCount++;
+#endif
+        PHASE_PRINT_TESTTRACE1(Js::DictionaryToPathTypePhase, _u("Converted SimpleDictionaryTypeHandler with %u properties to PathTypeHandler\n"), propertyCount);
+
+        Assert(instance->GetTypeHandler()->IsPathTypeHandler());
+        return PathTypeHandlerBase::FromTypeHandler(instance->GetTypeHandler());
+    }
+
     template <typename TPropertyIndex, typename TMapKey, bool IsNotExtensibleSupported>
     template <typename NewTPropertyIndex, typename NewTMapKey, bool NewIsNotExtensibleSupported>
     SimpleDictionaryUnorderedTypeHandler<NewTPropertyIndex, NewTMapKey, NewIsNotExtensibleSupported>* SimpleDictionaryTypeHandlerBase<TPropertyIndex, TMapKey, IsNotExtensibleSupported>::ConvertToSimpleDictionaryUnorderedTypeHandler(DynamicObject* instance)
@@ -1162,6 +1286,14 @@ namespace Js
         PropertyRecord const* propertyRecord = instance->GetScriptContext()->GetPropertyName(propertyId);
         if (propertyMap->TryGetReference(propertyRecord, &descriptor))
         {
+            if (!allowLetConstGlobal && info != nullptr && CountStableAccess(descriptor))
+            {
+                PathTypeHandlerBase* pathTypeHandler = TryConvertToPathType(instance);
+                if (pathTypeHandler != nullptr)
+                {
+                    return pathTypeHandler->GetProperty(instance, originalInstance, propertyId, value, info, requestContext);
+                }
+            }
             return GetPropertyFromDescriptor<allowLetConstGlobal>(instance, descriptor, value, info);
         }
 
@@ -1277,6 +1409,14 @@ namespace Js
         if (!(TMapKey_IsJavascriptString<TMapKey>() && propertyRecord->IsSymbol())
             && propertyMap->TryGetReference(propertyRecord, &descriptor))
         {
+            if (!allowLetConstGlobal && info != nullptr && CountStableAccess(descriptor))
+            {
+                PathTypeHandlerBase* pathTypeHandler = TryConvertToPathType(instance);
+                if (pathTypeHandler != nullptr)
+                {
+                    return pathTypeHandler->SetProperty(instance, propertyId, value, flags, info);
+                }
+            }
             return SetPropertyFromDescriptor<allowLetConstGlobal>(instance, propertyId, propertyId, descriptor, value, flags, info);
         }
 
@@ -1371,6 +1511,7 @@ namespace Js
             {
                 --numDeletedProperties;
             }
+            this->stableAccessCount = 0;
             descriptor->Attributes = PropertyDynamicTypeDefaults;
             instance->SetHasNoEnumerableProperties(false);
             propertyId = TPropertyKey_GetOptionalPropertyId(instance->GetScriptContext(), propertyKey);
@@ -1652,6 +1793,7 @@ namespace Js
                     }
                 }
                 descriptor->Attributes = PropertyDeletedDefaults;
+                this->stableAccessCount = 0;
 
                 // Change the type so as we can invalidate the cache in fast path jit
                 if (instance->GetType()->HasBeenCached())
@@ -1786,6 +1928,7 @@ namespace Js
                     }
                 }
                 descriptor->Attributes = PropertyDeletedDefaults;
+                this->stableAccessCount = 0;
 
                 // Change the type so as we can invalidate the cache in fast path jit
                 if (instance->GetType()->HasBeenCached())
@@ -2741,6 +2884,7 @@ namespace Js
             index = nextPropertyIndex;
             typeHandler->Add(propertyKey, attributes, markAsInitialized, markAsFixed, false, scriptContext);
         }
+        typeHandler->stableAccessCount = 0;
 
         if (attributes & PropertyEnumerable)
         {
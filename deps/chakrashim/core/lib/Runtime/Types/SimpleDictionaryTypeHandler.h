@@ -77,8 +77,13 @@ namespace Js
     private:
         // Number of deleted properties in the property map
         Field(byte) numDeletedProperties;
+        // Number of slow path accesses to existing properties since a property was last added or deleted
+        Field(uint16) stableAccessCount;
         Field(TPropertyIndex) nextPropertyIndex;
 
+        // Set when a conversion to a path type was rejected, until the next property add or delete
+        static const uint16 NoPathTypeConversion = UINT16_MAX;
+
     public:
         DEFINE_GETCPPNAME();
 
@@ -263,6 +268,8 @@ namespace Js
         DictionaryTypeHandlerBase<TPropertyIndex>* ConvertToDictionaryType(DynamicObject* instance);
         ES5ArrayTypeHandlerBase<TPropertyIndex>* ConvertToES5ArrayType(DynamicObject* instance);
         SimpleDictionaryTypeHandlerBase* ConvertToNonSharedSimpleDictionaryType(DynamicObject* instance);
+        bool CountStableAccess(SimpleDictionaryPropertyDescriptor<TPropertyIndex>* descriptor);
+        PathTypeHandlerBase* TryConvertToPathType(DynamicObject* instance);
         template <typename NewTPropertyIndex, typename NewTMapKey, bool NewIsNotExtensibleSupported> SimpleDictionaryUnorderedTypeHandler<NewTPropertyIndex, NewTMapKey, NewIsNotExtensibleSupported>* ConvertToSimpleDictionaryUnorderedTypeHandler(DynamicObject* instance);
         BOOL SetAttribute(DynamicObject* instance, SimpleDictionaryPropertyDescriptor<TPropertyIndex>* descriptor, PropertyAttributes attribute);
         BOOL ClearAttribute(DynamicObject* instance, SimpleDictionaryPropertyDescriptor<TPropertyIndex>* descriptor, PropertyAttributes attribute);
@@ -43,13 +43,32 @@ namespace Js
                 uint32 length = array->GetLength();
                 if (length > 0)
                 {
+                    // The caller made sure the head segment holds every element, so read it directly.
+                    Assert(array->GetHead()->left == 0 && array->GetHead()->length == length && array->GetHead()->next == nullptr);
                     iteratorIndices = RecyclerNew(scriptContext->GetRecycler(), VarList, scriptContext->GetRecycler());
-                    for (uint32 j = 0; j < length; j++)
+                    iteratorIndices->EnsureArray(length);
+                    if (JavascriptNativeIntArray::Is(array))
+                    {
+                        SparseArraySegment<int32> * head = SparseArraySegment<int32>::From(array->GetHead());
+                        for (uint32 j = 0; j < length; j++)
+                        {
+                            iteratorIndices->Add(JavascriptNumber::ToVar(head->elements[j], scriptContext));
+                        }
+                    }
+                    else if (JavascriptNativeFloatArray::Is(array))
                     {
-                        Var element = nullptr;
-                        if (array->DirectGetItemAtFull(j, &element))
+                        SparseArraySegment<double> * head = SparseArraySegment<double>::From(array->GetHead());
+                        for (uint32 j = 0; j < length; j++)
                         {
-                            iteratorIndices->Add(element);
+                            iteratorIndices->Add(JavascriptNumber::ToVarWithCheck(head->elements[j], scriptContext));
+                        }
+                    }
+                    else
+                    {
+                        SparseArraySegment<Var> * head = SparseArraySegment<Var>::From(array->GetHead());
+                        for (uint32 j = 0; j < length; j++)
+                        {
+                            iteratorIndices->Add(head->elements[j]);
                         }
                     }
                     // Array length shouldn't have changed as we determined that there is no missing values.
@@ -102,4 +121,51 @@ namespace Js
             Assert(false);
         }
     }
+
+    SpreadArgument::SpreadArgument(VarList * items, DynamicType * type)
+        : DynamicObject(type), iteratorIndices(items)
+    {
+    }
+
+    // Reads the elements of an array-like that is iterated by the built-in Array.prototype.values, for instance an
+    // arguments object or an array with holes, the way the iterator would but without creating it. Returns nullptr
+    // if reading the length or any element would call user code, so the caller can fall back to the iterator.
+    SpreadArgument * SpreadArgument::TryNewFromArrayLike(RecyclableObject * arrayLike, ScriptContext * scriptContext)
+    {
+        Recycler * recycler = scriptContext->GetRecycler();
+        VarList * items = nullptr;
+        bool read = false;
+
+        ImplicitCallFlags flags = scriptContext->GetThreadContext()->TryWithDisabledImplicitCall([&]()
+        {
+            Var lengthVar = JavascriptOperators::OP_GetLength(arrayLike, scriptContext);
+            if (!TaggedInt::Is(lengthVar) || TaggedInt::ToInt32(lengthVar) > Constants::MaxAllowedArgs)
+            {
+                return;
+            }
+
+            int32 length = TaggedInt::ToInt32(lengthVar);
+            if (length > 0)
+            {
+                items = RecyclerNew(recycler, VarList, recycler);
+                items->EnsureArray(length);
+                for (int32 j = 0; j < length; j++)
+                {
+                    Var element = nullptr;
+                    if (!JavascriptOperators::GetItem(arrayLike, (uint32)j, &element, scriptContext))
+                    {
+                        element = scriptContext->GetLibrary()->GetUndefined();
+                    }
+                    items->Add(element);
+                }
+            }
+            read = true;
+        });
+
+        if (!read || flags != ImplicitCall_None)
+        {
+            return nullptr;
+        }
+        return RecyclerNew(recycler, SpreadArgument, items, scriptContext->GetLibrary()->GetSpreadArgumentType());
+    }
 } // namespace Js
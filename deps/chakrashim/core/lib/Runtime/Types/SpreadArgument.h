@@ -13,6 +13,7 @@ namespace Js
         Field(VarList*) iteratorIndices;
 
         void AssertAndFailFast() { AssertMsg(false, "This function should not be invoked"); Js::Throw::InternalError();}
+        SpreadArgument(VarList * items, DynamicType * type);
     protected:
         DEFINE_VTABLE_CTOR(SpreadArgument, DynamicObject);
         DEFINE_MARSHAL_OBJECT_TO_SCRIPT_CONTEXT(SpreadArgument);
@@ -22,6 +23,7 @@ namespace Js
         static SpreadArgument* FromVar(Var value);
         static SpreadArgument* UnsafeFromVar(Var value);
         SpreadArgument(Var iterator, bool useDirectCall, DynamicType * type);
+        static SpreadArgument * TryNewFromArrayLike(RecyclableObject * arrayLike, ScriptContext * scriptContext);
         const Var* GetArgumentSpread() const { return iteratorIndices ? iteratorIndices->GetBuffer() : nullptr; }
         uint GetArgumentSpreadCount()  const { return iteratorIndices ? iteratorIndices->Count() : 0; }
 
@@ -451,6 +451,10 @@ WasmOp WasmBinaryReader::ReadExpr()
         }
         break;
     }
+    case wbMemoryCopy:
+    case wbMemoryFill:
+        BulkMemoryNode();
+        break;
 #ifdef ENABLE_WASM_SIMD
     case wbV8X16Shuffle:
         ShuffleNode();
@@ -647,6 +651,25 @@ void WasmBinaryReader::MemNode()
     m_funcState.count += len;
 }
 
+void WasmBinaryReader::BulkMemoryNode()
+{
+    // memory.copy names a destination and a source memory, memory.fill only the destination.
+    // Both are reserved for multiple memories and must be 0
+    const uint32 memoryCount = m_currentNode.op == wbMemoryCopy ? 2 : 1;
+    for (uint32 i = 0; i < memoryCount; ++i)
+    {
+        uint8 reserved = ReadConst<uint8>();
+        ++m_funcState.count;
+        if (reserved != 0)
+        {
+            ThrowDecodingError(m_currentNode.op == wbMemoryCopy
+                ? _u("memory.copy reserved value must be 0")
+                : _u("memory.fill reserved value must be 0")
+            );
+        }
+    }
+}
+
 // Locals/Globals
 void WasmBinaryReader::VarNode()
 {
@@ -75,6 +75,7 @@ namespace Wasm
         void BrNode();
         void BrTableNode();
         void MemNode();
+        void BulkMemoryNode();
         void LaneNode();
         void ShuffleNode();
         void VarNode();
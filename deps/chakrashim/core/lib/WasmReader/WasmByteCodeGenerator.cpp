@@ -786,6 +786,12 @@ void WasmBytecodeGenerator::EmitExpr(WasmOp op)
         info = EmitGrowMemory();
         break;
     }
+    case wbMemoryCopy:
+        info = EmitBulkMemory(Js::OpCodeAsmJs::MemoryCopy);
+        break;
+    case wbMemoryFill:
+        info = EmitBulkMemory(Js::OpCodeAsmJs::MemoryFill);
+        break;
     case wbUnreachable:
         m_writer->EmptyAsm(Js::OpCodeAsmJs::Unreachable_Void);
         SetUnreachableState(true);
@@ -1459,6 +1465,23 @@ EmitInfo WasmBytecodeGenerator::EmitGrowMemory()
     return info;
 }
 
+EmitInfo WasmBytecodeGenerator::EmitBulkMemory(Js::OpCodeAsmJs op)
+{
+    SetUsesMemory(0);
+
+    // memory.copy(dst, src, count) and memory.fill(dst, value, count)
+    EmitInfo countInfo = PopEvalStack(WasmTypes::I32, _u("Invalid type for bulk memory count"));
+    EmitInfo srcInfo = PopEvalStack(WasmTypes::I32, op == Js::OpCodeAsmJs::MemoryCopy ? _u("Invalid type for memory.copy source") : _u("Invalid type for memory.fill value"));
+    EmitInfo dstInfo = PopEvalStack(WasmTypes::I32, _u("Invalid type for bulk memory destination"));
+
+    m_writer->AsmReg3(op, dstInfo.location, srcInfo.location, countInfo.location);
+
+    ReleaseLocation(&countInfo);
+    ReleaseLocation(&srcInfo);
+    ReleaseLocation(&dstInfo);
+    return EmitInfo();
+}
+
 EmitInfo WasmBytecodeGenerator::EmitDrop()
 {
     EmitInfo info = PopValuePolymorphic();
@@ -218,6 +218,7 @@ namespace Wasm
         void EmitBrTable();
         EmitInfo EmitDrop();
         EmitInfo EmitGrowMemory();
+        EmitInfo EmitBulkMemory(Js::OpCodeAsmJs op);
         EmitInfo EmitGetLocal();
         EmitInfo EmitGetGlobal();
         EmitInfo EmitSetGlobal();
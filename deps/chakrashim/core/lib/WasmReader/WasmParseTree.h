@@ -31,6 +31,11 @@ namespace Wasm
         bool IsEnabled();
     };
 
+    namespace BulkMemory
+    {
+        bool IsEnabled();
+    };
+
     namespace WasmTypes
     {
         enum WasmType
@@ -0,0 +1,139 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Array.prototype.sort is stable, and the default comparer fast paths for arrays of only ints or
+// only strings order elements the same way as comparing their string values.
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+function checkStable(arr, msg) {
+    for (var i = 1; i < arr.length; i++) {
+        var prev = arr[i - 1], cur = arr[i];
+        assert.isTrue(prev.key < cur.key || (prev.key === cur.key && prev.index < cur.index), msg + ": elements " + (i - 1) + " and " + i);
+    }
+}
+
+function makeRecords(length, keyOf) {
+    var arr = [];
+    for (var i = 0; i < length; i++) {
+        arr.push({ key: keyOf(i), index: i });
+    }
+    return arr;
+}
+
+function byKey(a, b) {
+    return a.key - b.key;
+}
+
+// Reference order for the default comparer
+function byString(a, b) {
+    a = String(a);
+    b = String(b);
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+var seed = 1;
+function random(limit) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed % limit;
+}
+
+var tests = [
+    {
+        name: "Sorting with a comparer keeps equal elements in their original order",
+        body: function () {
+            [0, 1, 2, 7, 31, 32, 33, 100, 513, 1000, 5000].forEach(function (length) {
+                var arr = makeRecords(length, function () { return random(10); });
+                checkStable(arr.sort(byKey), "random keys, length " + length);
+            });
+        }
+    },
+    {
+        name: "Presorted and reverse sorted runs",
+        body: function () {
+            var length = 3000;
+            checkStable(makeRecords(length, function (i) { return i; }).sort(byKey), "ascending");
+            checkStable(makeRecords(length, function (i) { return length - i; }).sort(byKey), "descending");
+            checkStable(makeRecords(length, function (i) { return Math.floor(i / 100); }).sort(byKey), "ascending with ties");
+            checkStable(makeRecords(length, function (i) { return -Math.floor(i / 100); }).sort(byKey), "descending with ties");
+            checkStable(makeRecords(length, function (i) { return i % 250; }).sort(byKey), "sawtooth");
+            checkStable(makeRecords(length, function (i) { return i % 97 === 0 ? random(length) : i; }).sort(byKey), "mostly sorted");
+
+            var calls = 0;
+            var sorted = [];
+            for (var i = 0; i < length; i++) {
+                sorted.push(i);
+            }
+            sorted.sort(function (a, b) { calls++; return a - b; });
+            assert.areEqual(length - 1, calls, "A sorted array needs one comparison per adjacent pair");
+        }
+    },
+    {
+        name: "Default comparer on an array of ints",
+        body: function () {
+            var values = [0, 1, -1, 9, 10, 11, 99, 100, -10, -9, 5, 50, 500, 123, 1239, 12, 2147483647, -2147483648, 1073741823, -1073741824];
+            for (var i = 0; i < 2000; i++) {
+                values.push(random(100000) - 50000);
+            }
+
+            var expected = values.slice().sort(byString);
+            assert.areEqual(expected, values.slice().sort(), "int array");
+
+            var withHoles = values.slice();
+            withHoles.length += 10;
+            withHoles.push(undefined, 3);
+            delete withHoles[1];
+            var result = withHoles.slice().sort();
+            var expectedWithHoles = values.slice(0, 1).concat(values.slice(2), [3]).sort(byString);
+            expectedWithHoles.push(undefined);
+            assert.areEqual(expectedWithHoles, result.slice(0, expectedWithHoles.length), "int array with holes and undefined: values");
+            assert.areEqual(withHoles.length, result.length, "int array with holes and undefined: length");
+            assert.isFalse(expectedWithHoles.length in result, "int array with holes and undefined: holes at the end");
+        }
+    },
+    {
+        name: "Default comparer on an array of strings",
+        body: function () {
+            var values = ["b", "a", "", "ab", "aa", "B", "é", "e", "a\u0000", "a", "zz", "z"];
+            for (var i = 0; i < 1000; i++) {
+                values.push("s" + random(500));
+            }
+            assert.areEqual(values.slice().sort(byString), values.slice().sort(), "string array");
+        }
+    },
+    {
+        name: "Default comparer on mixed arrays still compares string values",
+        body: function () {
+            var values = [10, "9", 1.5, -0.5, true, null, "10", 2, { toString: function () { return "1"; } }];
+            var result = values.slice().sort();
+            assert.areEqual(values.slice().sort(byString).map(String), result.map(String), "mixed array");
+        }
+    },
+    {
+        name: "Exceptions from the comparer leave the elements in the array",
+        body: function () {
+            var arr = [];
+            for (var i = 0; i < 1000; i++) {
+                arr.push(random(1000));
+            }
+            var expected = arr.slice().sort(function (a, b) { return a - b; });
+
+            var calls = 0;
+            assert.throws(function () {
+                arr.sort(function (a, b) {
+                    if (++calls === 3000) {
+                        throw new Error("stop");
+                    }
+                    return a - b;
+                });
+            }, Error, "Comparer exception is propagated", "stop");
+            assert.areEqual(expected, arr.sort(function (a, b) { return a - b; }), "No element is lost or duplicated");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,57 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// test the local time offset cache on xplat: offsets must not depend on the order in which times are converted
+var hour = 60 * 60 * 1000;
+var times = [];
+for (var t = Date.UTC(1965, 0, 1); t < Date.UTC(1975, 0, 1); t += hour) {
+    times.push(t);
+}
+for (var t = Date.UTC(2010, 0, 1); t < Date.UTC(2030, 0, 1); t += 7 * hour + 123457) {
+    times.push(t);
+}
+
+function offsetAt(t) {
+    return new Date(t).getTimezoneOffset();
+}
+
+var expected = times.map(offsetAt);
+
+// backwards
+for (var i = times.length - 1; i >= 0; i--) {
+    if (offsetAt(times[i]) !== expected[i]) {
+        throw new Error("Offset at " + times[i] + " differs when walking backwards");
+    }
+}
+
+// random order
+var seed = 1;
+for (var i = 0; i < times.length; i++) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    var index = seed % times.length;
+    if (offsetAt(times[index]) !== expected[index]) {
+        throw new Error("Offset at " + times[index] + " differs when converting in random order");
+    }
+}
+
+for (var i = 0; i < times.length; i++) {
+    var d = new Date(times[i]);
+
+    // local fields agree with the offset
+    var local = Date.UTC(d.getFullYear(), d.getMonth(), d.getDate(), d.getHours(), d.getMinutes(), d.getSeconds(), d.getMilliseconds());
+    if (local - times[i] !== -expected[i] * 60 * 1000) {
+        throw new Error("Local fields of " + times[i] + " don't match its offset");
+    }
+
+    // and convert back, away from offset changes where local times can be skipped or repeated
+    if (i > 0 && i < times.length - 1 && expected[i - 1] === expected[i] && expected[i + 1] === expected[i]) {
+        var utc = new Date(d.getFullYear(), d.getMonth(), d.getDate(), d.getHours(), d.getMinutes(), d.getSeconds(), d.getMilliseconds()).getTime();
+        if (utc !== times[i]) {
+            throw new Error("Local fields of " + times[i] + " convert back to " + utc);
+        }
+    }
+}
+
+print("PASS");
@@ -0,0 +1,60 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Values live across a try are spilled on entry and may be re-allocated to registers afterwards.
+// Make sure the catch, the finally and the code following them see the right values.
+
+function assert(actual, expected) {
+    if (actual !== expected) {
+        throw new Error("Expected " + expected + " but got " + actual);
+    }
+}
+
+function sumAfterForOf(arr, n) {
+    var a = 1, b = 2, c = 3, d = 4, e = 5, f = 6, g = 7, h = 8;
+    var total = 0;
+    for (var x of arr) {
+        total += x;
+    }
+    for (var i = 0; i < n; i++) {
+        a += b; b += c; c += d; d += e; e += f; f += g; g += h; h += i;
+        total += a ^ h;
+    }
+    return total + a + b + c + d + e + f + g + h;
+}
+
+function updateInTry(n, throwAt) {
+    var a = 0, b = 0, c = 0;
+    try {
+        for (var i = 0; i < n; i++) {
+            a += i; b += a; c += b;
+            if (i === throwAt) {
+                throw new Error("stop");
+            }
+        }
+    } catch (ex) {
+        return "catch:" + a + "," + b + "," + c;
+    } finally {
+        a++;
+    }
+    for (var j = 0; j < n; j++) {
+        c += a + b;
+    }
+    return "done:" + a + "," + b + "," + c;
+}
+
+var expectedSum = sumAfterForOf([1, 2, 3], 50);
+var expectedNoThrow = updateInTry(30, -1);
+var expectedThrow = updateInTry(30, 17);
+assert(expectedNoThrow, "done:436,4495,183890");
+assert(expectedThrow, "catch:153,969,4845");
+
+for (var k = 0; k < 200; k++) {
+    assert(sumAfterForOf([1, 2, 3], 50), expectedSum);
+    assert(updateInTry(30, -1), expectedNoThrow);
+    assert(updateInTry(30, 17), expectedThrow);
+}
+
+WScript.Echo("PASSED");
@@ -0,0 +1,89 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Errors keep the stack trace captured when they were created, limited by the Error.stackTraceLimit of
+// that time, however often and from wherever they are thrown afterwards.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function create() {
+    return new Error("created");
+}
+
+function rethrow(e) {
+    throw e;
+}
+
+function frames(e) {
+    return e.stack.split("\n").length - 1;
+}
+
+var tests = [
+    {
+        name: "Throwing keeps the stack of the construction",
+        body: function () {
+            var error = create();
+            var stack = error.stack;
+            assert.isTrue(stack.indexOf("at create") !== -1, "stack is captured when the error is created");
+            for (var i = 0; i < 3; i++) {
+                try {
+                    rethrow(error);
+                } catch (e) {
+                    assert.areEqual(error, e, "the same error is caught");
+                    assert.areEqual(stack, e.stack, "rethrowing keeps the stack");
+                    assert.isTrue(e.stack.indexOf("at rethrow") === -1, "the throw site is not added");
+                }
+            }
+        }
+    },
+    {
+        name: "Error.stackTraceLimit applies when the error is created",
+        body: function () {
+            var limit = Error.stackTraceLimit;
+            try {
+                Error.stackTraceLimit = 1;
+                var error = create();
+                Error.stackTraceLimit = limit;
+                assert.areEqual(1, frames(error), "one frame is captured");
+                try {
+                    rethrow(error);
+                } catch (e) {
+                    assert.areEqual(1, frames(e), "throwing does not capture more frames");
+                }
+
+                Error.stackTraceLimit = 0;
+                try {
+                    rethrow(create());
+                } catch (e) {
+                    assert.areEqual(0, frames(e), "no frame is captured");
+                }
+            } finally {
+                Error.stackTraceLimit = limit;
+            }
+        }
+    },
+    {
+        name: "Errors without a stack get the one of the throw",
+        body: function () {
+            var error = create();
+            delete error.stack;
+            try {
+                rethrow(error);
+            } catch (e) {
+                assert.isTrue(e.stack.indexOf("at rethrow") !== -1, "the stack of the throw is captured");
+            }
+
+            error = create();
+            error.stack = "replaced";
+            try {
+                rethrow(error);
+            } catch (e) {
+                assert.areEqual("replaced", e.stack, "an assigned stack is kept");
+            }
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,90 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Bound args are spliced in front of the call args on the stack when there are
+// few of them, and in a recycler allocation otherwise.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function collect() {
+    return [this].concat(Array.prototype.slice.call(arguments));
+}
+
+function range(start, end) {
+    var result = [];
+    for (var i = start; i < end; i++) {
+        result.push(i);
+    }
+    return result;
+}
+
+var tests = [
+    {
+        name: "Bound this and args come before the call args",
+        body: function () {
+            var thisArg = {};
+            var bound = collect.bind(thisArg, 1, 2);
+            for (var i = 0; i < 100; i++) {
+                var result = bound(3, 4);
+                assert.areEqual(5, result.length, "length");
+                assert.isTrue(result[0] === thisArg, "this");
+                assert.areEqual([1, 2, 3, 4], result.slice(1), "args");
+            }
+        }
+    },
+    {
+        name: "Spliced args on either side of the stack threshold",
+        body: function () {
+            for (var bound = 1; bound < 12; bound++) {
+                for (var passed = 0; passed < 12; passed++) {
+                    var f = collect.bind.apply(collect, [null].concat(range(0, bound)));
+                    var result = f.apply(null, range(bound, bound + passed));
+                    assert.areEqual(range(0, bound + passed), result.slice(1), bound + " bound, " + passed + " passed");
+                }
+            }
+        }
+    },
+    {
+        name: "Spliced args survive a collection during the call",
+        body: function () {
+            function gcAndCollect() {
+                CollectGarbage();
+                return Array.prototype.slice.call(arguments);
+            }
+            var small = gcAndCollect.bind(null, {a: 1}, "b" + Math.random());
+            var large = gcAndCollect.bind.apply(gcAndCollect, [null].concat(range(0, 10).map(function (i) { return {i: i}; })));
+            var result = small({c: 3});
+            assert.areEqual(1, result[0].a);
+            assert.areEqual(3, result[2].c);
+            result = large({i: 10});
+            assert.areEqual(range(0, 11), result.map(function (o) { return o.i; }));
+        }
+    },
+    {
+        name: "new on a bound function uses the new object and keeps new.target",
+        body: function () {
+            function Point(x, y) {
+                this.x = x;
+                this.y = y;
+                this.target = new.target;
+            }
+            var BoundPoint = Point.bind({ ignored: true }, 1);
+            var p = new BoundPoint(2);
+            assert.isTrue(p instanceof Point, "instanceof");
+            assert.areEqual(1, p.x);
+            assert.areEqual(2, p.y);
+            assert.isTrue(p.target === Point, "new.target");
+
+            class Other {}
+            var q = Reflect.construct(BoundPoint, [3], Other);
+            assert.isTrue(Object.getPrototypeOf(q) === Other.prototype, "prototype from new.target");
+            assert.areEqual(1, q.x);
+            assert.areEqual(3, q.y);
+            assert.isTrue(q.target === Other, "overridden new.target");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,69 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Formatters that are created with the same locale and options share underlying ICU formatters.
+// Formatters that differ in any option must still format according to their own options.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+const numberCases = [
+    ["en-US", undefined, 1234.5678, "1,234.568"],
+    ["en-US", { useGrouping: false }, 1234.5678, "1234.568"],
+    ["en-US", { minimumFractionDigits: 2, maximumFractionDigits: 2 }, 1234.5678, "1,234.57"],
+    ["en-US", { minimumIntegerDigits: 6 }, 1234.5678, "001,234.568"],
+    ["en-US", { maximumSignificantDigits: 2 }, 1234.5678, "1,200"],
+    ["en-US", { minimumSignificantDigits: 6 }, 1234.5, "1,234.50"],
+    ["en-US", { style: "percent" }, 0.256, "26%"],
+    ["en-US", { style: "currency", currency: "USD" }, 1234.5, "$1,234.50"],
+    ["en-US", { style: "currency", currency: "EUR" }, 1234.5, "\u20ac1,234.50"],
+    ["en-US", { style: "currency", currency: "USD", currencyDisplay: "code" }, 1, "USD\u00a01.00"],
+    ["de-DE", undefined, 1234.5678, "1.234,568"],
+    ["de-DE", { style: "currency", currency: "EUR" }, 1234.5, "1.234,50\u00a0\u20ac"],
+];
+
+function checkNumberCases(message) {
+    numberCases.forEach(([locale, options, value, expected]) => {
+        assert.areEqual(expected, new Intl.NumberFormat(locale, options).format(value), `${message}: ${locale} ${JSON.stringify(options)}`);
+        assert.areEqual(expected, value.toLocaleString(locale, options), `${message}: ${locale} ${JSON.stringify(options)} with toLocaleString`);
+    });
+}
+
+testRunner.runTests([
+    {
+        name: "NumberFormats that differ in one option format differently",
+        body() {
+            checkNumberCases("First use");
+            checkNumberCases("Second use");
+        }
+    },
+    {
+        name: "NumberFormats still format correctly once many configurations have been used",
+        body() {
+            for (let i = 0; i <= 20; i++) {
+                const expected = (1).toFixed(i);
+                assert.areEqual(expected, (1).toLocaleString("en-US", { minimumFractionDigits: i }), `minimumFractionDigits: ${i}`);
+            }
+            checkNumberCases("After many configurations");
+        }
+    },
+    {
+        name: "DateTimeFormats that differ in time zone or pattern format differently",
+        body() {
+            const date = new Date(Date.UTC(2018, 0, 2, 3, 4, 5));
+
+            // Newer versions of ICU put a narrow no-break space before the day period
+            const toLocaleString = (locale, options) => date.toLocaleString(locale, options).replace(/\u202f/g, " ");
+            const toLocaleTimeString = (locale, options) => date.toLocaleTimeString(locale, options).replace(/\u202f/g, " ");
+            for (let i = 0; i < 2; i++) {
+                assert.areEqual("1/2/2018, 3:04:05 AM", toLocaleString("en-US", { timeZone: "UTC" }), "en-US in UTC");
+                assert.areEqual("1/1/2018, 7:04:05 PM", toLocaleString("en-US", { timeZone: "America/Los_Angeles" }), "en-US in Los Angeles");
+                assert.areEqual("1/2/2018", date.toLocaleDateString("en-US", { timeZone: "UTC" }), "en-US date in UTC");
+                assert.areEqual("3:04:05 AM", toLocaleTimeString("en-US", { timeZone: "UTC" }), "en-US time in UTC");
+                assert.areEqual("2.1.2018", date.toLocaleDateString("de-DE", { timeZone: "UTC" }), "de-DE date in UTC");
+                assert.areEqual("January 2, 2018", new Intl.DateTimeFormat("en-US", { timeZone: "UTC", year: "numeric", month: "long", day: "numeric" }).format(date), "en-US long date in UTC");
+            }
+        }
+    },
+], { verbose: false });
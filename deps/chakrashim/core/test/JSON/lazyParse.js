@@ -0,0 +1,89 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Run with -LazyJSONParseMinLength:1 so that objects are only built when first used; everything
+// must look the same as with a regular parse.
+
+var TEST = function(a, b) {
+  if (a !== b) {
+    throw new Error(a + " !== " + b);
+  }
+}
+
+var text = JSON.stringify({
+  name: "root\t\"quoted\"",
+  count: 3,
+  negative: -1.5e3,
+  flags: [true, false, null],
+  items: [
+    { id: 1, tags: ["a", "b"], owner: { name: "x", nested: { deep: [1, { deeper: "yes" }] } } },
+    { id: 2, tags: [], owner: null },
+    { id: 3, tags: ["c"], owner: { name: "z" } }
+  ],
+  empty: {},
+  "12": "numeric key",
+  "last": { "\u00e9": "\u20ac" }
+});
+
+// Touching objects in a different order than they appear in the text
+var o = JSON.parse(text);
+TEST(o.items[2].owner.name, "z");
+TEST(o.items[0].owner.nested.deep[1].deeper, "yes");
+TEST(o.items[0].tags.join(), "a,b");
+TEST(o.items[1].owner, null);
+TEST(o.last["\u00e9"], "\u20ac");
+TEST(o.name, "root\t\"quoted\"");
+TEST(o.negative, -1500);
+TEST(o[12], "numeric key");
+TEST(Object.keys(o.empty).length, 0);
+
+// Enumeration order and round trip
+TEST(JSON.stringify(JSON.parse(text)), text);
+TEST(Object.keys(JSON.parse(text)).join(), "12,name,count,negative,flags,items,empty,last");
+var keys = [];
+for (var k in JSON.parse(text).items[0]) {
+  keys.push(k);
+}
+TEST(keys.join(), "id,tags,owner");
+
+// Objects that are written to, frozen or used as prototypes before being read
+var p = JSON.parse(text);
+p.items[0].added = 1;
+TEST(p.items[0].added, 1);
+TEST(p.items[0].id, 1);
+TEST(Object.isFrozen(Object.freeze(p.items[1])), true);
+TEST(p.items[1].id, 2);
+var derived = Object.create(p.items[2]);
+TEST(derived.id, 3);
+p.items[2].id = 4;
+TEST(derived.id, 4);
+TEST(delete p.count, true);
+TEST("count" in p, false);
+TEST(p.hasOwnProperty("flags"), true);
+
+// Duplicate keys and __proto__ behave as with a regular parse
+var d = JSON.parse('{"a": {"x": 1}, "a": {"y": 2}, "__proto__": {"z": 3}}');
+TEST(d.a.x, undefined);
+TEST(d.a.y, 2);
+TEST(Object.getPrototypeOf(d), Object.prototype);
+TEST(d.__proto__.z, 3);
+
+// Errors anywhere in the text are reported by JSON.parse itself
+var bad = ['{"a": {"b": [1, 2,]}}', '{"a": {"b": {"c": }}}', '[{"a": 1}, {"a": 2,}]', '{"a": 1} x', '{"a": {"b": 1}'];
+for (var i = 0; i < bad.length; i++) {
+  var threw = false;
+  try {
+    JSON.parse(bad[i]);
+  } catch (e) {
+    threw = e instanceof SyntaxError;
+  }
+  TEST(threw, true);
+}
+
+// Texts without objects and revivers take the regular path
+TEST(JSON.parse("[1, \"two\", [3]]")[2][0], 3);
+TEST(JSON.parse('{"a": {"b": 1}}', function (k, v) { return k === "b" ? v + 1 : v; }).a.b, 2);
+
+console.log("PASS");
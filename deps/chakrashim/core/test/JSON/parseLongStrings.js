@@ -0,0 +1,53 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Strings are scanned several characters at a time; put the interesting characters at every offset
+// of a block and check the result against a plain character by character build.
+
+var TEST = function(a, b) {
+  if (a !== b) {
+    throw new Error(JSON.stringify(a) + " !== " + JSON.stringify(b));
+  }
+}
+
+var plain = "abcdefghijklmnopqrstuvwxyz\u00e9\u4e2d\ud83d\ude00ABCDEFGHIJ";
+var escapes = [
+  ["\\n", "\n"], ["\\\"", "\""], ["\\\\", "\\"], ["\\/", "/"], ["\\u0041", "A"], ["\\ud83d\\ude00", "\ud83d\ude00"]
+];
+
+for (var length = 0; length < 40; length++) {
+  var prefix = plain.substr(0, length);
+  TEST(JSON.parse("\"" + prefix + "\""), prefix);
+
+  for (var i = 0; i < escapes.length; i++) {
+    TEST(JSON.parse("\"" + prefix + escapes[i][0] + prefix + "\""), prefix + escapes[i][1] + prefix);
+  }
+
+  // Unescaped control characters anywhere in the string are an error
+  var threw = false;
+  try {
+    JSON.parse("\"" + prefix + "\u0001" + prefix + "\"");
+  } catch (e) {
+    threw = e instanceof SyntaxError;
+  }
+  TEST(threw, true);
+
+  // So is a string that runs to the end of the input
+  threw = false;
+  try {
+    JSON.parse("\"" + prefix + prefix);
+  } catch (e) {
+    threw = e instanceof SyntaxError;
+  }
+  TEST(threw, true);
+}
+
+var arr = [];
+for (var i = 0; i < 100; i++) {
+  arr.push({ key: plain + i, value: plain.substr(i % plain.length) + "\t\"" + i });
+}
+TEST(JSON.stringify(JSON.parse(JSON.stringify(arr))), JSON.stringify(arr));
+
+console.log("PASS");
@@ -0,0 +1,63 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Objects that start with the same property reuse the type path of earlier ones; members must not change.
+
+var TEST = function(a, b) {
+  if (a !== b) {
+    throw new Error(a + " !== " + b);
+  }
+}
+
+function keysAndValues(o) {
+  return Object.keys(o).map(function(k) { return k + "=" + JSON.stringify(o[k]); }).join(";");
+}
+
+// Homogeneous records, long enough for the parser's type cache
+var records = [];
+for (var i = 0; i < 50; i++) {
+  records.push({ id: i, name: "n" + i, score: i / 2, tags: ["a", i], nested: { id: -i, ok: i % 3 == 0 } });
+}
+var parsed = JSON.parse(JSON.stringify(records));
+TEST(parsed.length, 50);
+for (var i = 0; i < parsed.length; i++) {
+  TEST(keysAndValues(parsed[i]), keysAndValues(records[i]));
+  TEST(keysAndValues(parsed[i].nested), keysAndValues(records[i].nested));
+}
+
+// Same first property with growing, shrinking and diverging member lists
+var mixed = '[' +
+  '{"id":1},' +
+  '{"id":2,"a":1,"b":2,"c":3,"d":4,"e":5,"f":6,"g":7,"h":8,"i":9,"j":10,"k":11,"l":12,"m":13,"n":14,"o":15,"p":16,"q":17,"r":18},' +
+  '{"id":3,"a":1},' +
+  '{"id":4,"b":1,"a":2},' +
+  '{"id":5,"a":1,"b":2,"c":3},' +
+  '{"id":6,"0":"zero","a":1},' +
+  '{"id":7,"a":1,"a":2},' +
+  '{"id":8,"a":1,"b":2,"c":3}' +
+  ']';
+var expected = [
+  'id=1',
+  'id=2;a=1;b=2;c=3;d=4;e=5;f=6;g=7;h=8;i=9;j=10;k=11;l=12;m=13;n=14;o=15;p=16;q=17;r=18',
+  'id=3;a=1',
+  'id=4;b=1;a=2',
+  'id=5;a=1;b=2;c=3',
+  '0="zero";id=6;a=1',
+  'id=7;a=2',
+  'id=8;a=1;b=2;c=3'
+];
+for (var repeat = 0; repeat < 3; repeat++) {
+  var result = JSON.parse(mixed);
+  for (var i = 0; i < expected.length; i++) {
+    TEST(keysAndValues(result[i]), expected[i]);
+  }
+  // Objects are ordinary and extensible afterwards
+  result[2].z = 26;
+  delete result[4].b;
+  TEST(keysAndValues(result[2]), 'id=3;a=1;z=26');
+  TEST(keysAndValues(result[4]), 'id=5;a=1;c=3');
+}
+
+console.log("PASS");
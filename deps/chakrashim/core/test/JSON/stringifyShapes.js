@@ -0,0 +1,66 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Objects of the same shape are stringified from a per type layout; the output must not change.
+
+var TEST = function(a, b) {
+  if (a !== b) {
+    throw new Error(a + " !== " + b);
+  }
+}
+
+function make(i) {
+  return { id: i, "needs \"escaping\"\n": "v" + i, "\u00e9\u20ac": i % 2 == 0, nested: { x: i } };
+}
+
+var expected = [];
+var objects = [];
+for (var i = 0; i < 5; i++) {
+  objects.push(make(i));
+  expected.push('{"id":' + i + ',"needs \\"escaping\\"\\n":"v' + i + '","\u00e9\u20ac":' + (i % 2 == 0) + ',"nested":{"x":' + i + '}}');
+}
+for (var i = 0; i < 3; i++) {
+  TEST(JSON.stringify(objects), "[" + expected.join(",") + "]");
+}
+
+TEST(JSON.stringify(objects[1], null, 1),
+  '{\n "id": 1,\n "needs \\"escaping\\"\\n": "v1",\n "\u00e9\u20ac": false,\n "nested": {\n  "x": 1\n }\n}');
+
+// Undefined and function values are still dropped
+var sparse = [{ a: 1, b: undefined, c: 3 }, { a: 1, b: function() {}, c: 3 }];
+TEST(JSON.stringify(sparse), '[{"a":1,"c":3},{"a":1,"c":3}]');
+
+// toJSON reshaping the holder: later names come from the original enumeration, values are current
+function reshaping() {
+  var o = { first: { toJSON: function() { delete o.second; o.third = "changed"; o.added = 1; return "f"; } }, second: 2, third: 3 };
+  return o;
+}
+reshaping();
+TEST(JSON.stringify(reshaping()), '{"first":"f","third":"changed"}');
+TEST(JSON.stringify(reshaping()), '{"first":"f","third":"changed"}');
+
+// toJSON changing a value without changing the shape
+function revaluing() {
+  var o = { first: { toJSON: function() { o.second = "new"; return 1; } }, second: "old" };
+  return o;
+}
+TEST(JSON.stringify(revaluing()), '{"first":1,"second":"new"}');
+TEST(JSON.stringify(revaluing()), '{"first":1,"second":"new"}');
+
+// Accessors, non-enumerable properties and indexed properties take the regular path
+var withGetter = { a: 1 };
+Object.defineProperty(withGetter, "b", { get: function() { return 2; }, enumerable: true });
+TEST(JSON.stringify([withGetter, withGetter]), '[{"a":1,"b":2},{"a":1,"b":2}]');
+var hidden = { a: 1 };
+Object.defineProperty(hidden, "b", { value: 2, enumerable: false });
+TEST(JSON.stringify([hidden, hidden]), '[{"a":1},{"a":1}]');
+TEST(JSON.stringify([{ 1: "one", a: "a" }, { 1: "one", a: "a" }]), '[{"1":"one","a":"a"},{"1":"one","a":"a"}]');
+
+// Replacers see the same keys and holders
+var keys = [];
+JSON.stringify([{ p: 1, q: 2 }, { p: 3, q: 4 }], function(k, v) { keys.push(k); return v; });
+TEST(keys.join(), ",0,p,q,1,p,q");
+
+console.log("PASS");
@@ -0,0 +1,174 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// Each body runs its callers enough times for them to be jitted.
+var iterations = 20;
+
+var tests = [
+    {
+        name: "forEach visits present elements in order and ignores its return value",
+        body: function () {
+            function sum(a) {
+                var total = 0;
+                var result = a.forEach(function (v, k, o) { total += v * k; return o; });
+                assert.areEqual(undefined, result, "forEach returns undefined");
+                return total;
+            }
+            for (var i = 0; i < iterations; i++) {
+                assert.areEqual(0 + 2 + 6, sum([1, 2, 3]), "forEach over a dense array");
+                assert.areEqual(0 + 6, sum([1, , 3]), "forEach skips holes");
+            }
+        }
+    },
+    {
+        name: "map creates an array of the same length, keeping holes",
+        body: function () {
+            function double(a) {
+                return a.map(function (v) { return v * 2; });
+            }
+            for (var i = 0; i < iterations; i++) {
+                assert.areEqual([2, 4, 6], double([1, 2, 3]), "map over a dense array");
+                var sparse = double([1, , 3]);
+                assert.areEqual(3, sparse.length, "map keeps the length");
+                assert.isFalse(1 in sparse, "map keeps holes");
+                assert.areEqual(6, sparse[2], "map maps the elements after a hole");
+            }
+        }
+    },
+    {
+        name: "map honors Symbol.species",
+        body: function () {
+            class MyArray extends Array {}
+            function identity(a) {
+                return a.map(function (v) { return v; });
+            }
+            for (var i = 0; i < iterations; i++) {
+                var a = MyArray.from([1, 2]);
+                assert.isTrue(identity(a) instanceof MyArray, "map creates the species of its receiver");
+            }
+        }
+    },
+    {
+        name: "some and every stop at the first deciding element",
+        body: function () {
+            function countSome(a, limit) {
+                var calls = 0;
+                var result = a.some(function (v) { calls++; return v > limit; });
+                return [result, calls];
+            }
+            function countEvery(a, limit) {
+                var calls = 0;
+                var result = a.every(function (v) { calls++; return v <= limit; });
+                return [result, calls];
+            }
+            for (var i = 0; i < iterations; i++) {
+                assert.areEqual([true, 2], countSome([1, 5, 9], 2), "some stops at the first truthy result");
+                assert.areEqual([false, 3], countSome([1, 2, 2], 2), "some visits every element otherwise");
+                assert.areEqual([false, 2], countEvery([1, 5, 9], 2), "every stops at the first falsy result");
+                assert.areEqual([true, 3], countEvery([1, 2, 2], 2), "every visits every element otherwise");
+                assert.areEqual([false, 0], countSome([], 0), "some of an empty array");
+                assert.areEqual([true, 0], countEvery([], 0), "every of an empty array");
+            }
+        }
+    },
+    {
+        name: "reduce with and without an initial value",
+        body: function () {
+            function sum(a) {
+                return a.reduce(function (acc, v) { return acc + v; });
+            }
+            function sumFrom(a, initialValue) {
+                return a.reduce(function (acc, v) { return acc + v; }, initialValue);
+            }
+            for (var i = 0; i < iterations; i++) {
+                assert.areEqual(6, sum([1, 2, 3]), "reduce starts from the first element");
+                assert.areEqual(8, sum([, , 3, 5]), "reduce starts from the first present element");
+                assert.areEqual(16, sumFrom([1, 2, 3], 10), "reduce starts from initialValue");
+                assert.areEqual(undefined, sumFrom([], undefined), "an undefined initialValue is still present");
+                assert.throws(function () { sum([]); }, TypeError, "reduce of an empty array needs an initialValue");
+                assert.throws(function () { sum([, ,]); }, TypeError, "reduce of an array of holes needs an initialValue");
+            }
+        }
+    },
+    {
+        name: "Changes to the array made by the callback are observed",
+        body: function () {
+            for (var i = 0; i < iterations; i++) {
+                var visited = [];
+                [1, 2, 3].forEach(function (v, k, o) {
+                    visited.push(v);
+                    if (k === 0) {
+                        o.pop();        // The length is read once, but removed elements are skipped
+                        o.push("a");    // and so are the ones added past the original length
+                        o.push("b");
+                        o[1] = "x";     // while those changed in place are seen with their new value
+                    }
+                });
+                assert.areEqual([1, "x", "a"], visited, "forEach sees the array as the callback leaves it");
+
+                var mapped = [1, 2, 3, 4].map(function (v, k, o) {
+                    if (k === 0) {
+                        o.length = 2;
+                    }
+                    return v;
+                });
+                assert.areEqual(4, mapped.length, "map keeps the original length");
+                assert.isFalse(2 in mapped, "map skips elements removed by the callback");
+
+                var a = [1, 2, 3];
+                var total = a.reduce(function (acc, v, k, o) {
+                    if (k === 1) {
+                        o[2] = 1.5;     // Changes the kind of array in the middle of the loop
+                    }
+                    return acc + v;
+                });
+                assert.areEqual(4.5, total, "reduce sees an element converted to a float");
+            }
+        }
+    },
+    {
+        name: "thisArg, array-likes and the callback arguments",
+        body: function () {
+            var arrayLike = { length: 3, 0: "a", 2: "c" };
+            for (var i = 0; i < iterations; i++) {
+                var self = { seen: [] };
+                Array.prototype.forEach.call(arrayLike, function (v, k, o) {
+                    assert.areEqual(arrayLike, o, "the object is passed to the callback");
+                    this.seen.push(k + v);
+                }, self);
+                assert.areEqual(["0a", "2c"], self.seen, "forEach uses thisArg and skips missing indices");
+
+                var upper = Array.prototype.map.call("ab", function (c) { return c.toUpperCase(); });
+                assert.areEqual(["A", "B"], upper, "map converts its receiver to an object");
+
+                assert.isTrue(Array.prototype.some.call(arrayLike, function (v) { return v === this.value; }, { value: "c" }),
+                    "some uses thisArg");
+            }
+        }
+    },
+    {
+        name: "Errors are reported before any element is visited",
+        body: function () {
+            ["forEach", "map", "some", "every", "reduce"].forEach(function (name) {
+                var method = Array.prototype[name];
+                assert.areEqual(1, method.length, name + " has a length of 1");
+                assert.areEqual(name, method.name, name + " has its name");
+                assert.throws(function () { method.call(null, function () {}); }, TypeError, name + " needs a this");
+                assert.throws(function () { method.call(undefined, function () {}); }, TypeError, name + " needs a this");
+                assert.throws(function () { method.call([1], undefined); }, TypeError, name + " needs a callback");
+                assert.throws(function () { method.call([1], {}); }, TypeError, name + " needs a callable callback");
+
+                var getterCalls = 0;
+                var o = { get length() { getterCalls++; return 0; } };
+                assert.throws(function () { method.call(o, 42); }, TypeError, name + " checks the callback after the length");
+                assert.areEqual(1, getterCalls, name + " reads the length once");
+            });
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
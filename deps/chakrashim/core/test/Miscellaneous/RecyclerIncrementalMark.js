@@ -0,0 +1,58 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Allocation heavy script run with the mark done in slices on the script thread. Between the slices the
+// script keeps moving survivors around the object graph, so anything it hides from the part of the graph
+// already marked has to be found again by the rescan for the survivors to stay intact.
+
+function assert(condition, message) {
+    if (!condition) {
+        throw new Error("Assertion failed: " + message);
+    }
+}
+
+var slots = [];
+for (var i = 0; i < 64; i++) {
+    slots.push({ survivors: [] });
+}
+
+var count = 0;
+for (var i = 0; i < 2000; i++) {
+    var garbage = [];
+    for (var j = 0; j < 100; j++) {
+        garbage.push({ index: j, name: "garbage" + j, values: [j, j + 1, j + 2] });
+    }
+
+    if (i % 10 === 0) {
+        slots[count % slots.length].survivors.push({ index: count, name: "survivor" + count, values: garbage.slice(0, 5) });
+        count++;
+    }
+
+    // Move the survivors of one slot into another one
+    var from = slots[i % slots.length];
+    var to = slots[(i * 7 + 3) % slots.length];
+    if (from !== to) {
+        to.survivors = to.survivors.concat(from.survivors);
+        from.survivors = [];
+    }
+}
+
+var seen = [];
+for (var i = 0; i < slots.length; i++) {
+    var survivors = slots[i].survivors;
+    for (var j = 0; j < survivors.length; j++) {
+        var survivor = survivors[j];
+        assert(survivor.name === "survivor" + survivor.index, "survivor name");
+        assert(survivor.values.length === 5 && survivor.values[4].values[2] === 6, "survivor values");
+        assert(!seen[survivor.index], "survivor seen once");
+        seen[survivor.index] = true;
+    }
+}
+
+for (var i = 0; i < count; i++) {
+    assert(seen[i], "survivor " + i + " kept");
+}
+
+WScript.Echo("PASSED");
@@ -0,0 +1,34 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Allocation heavy script with a mix of short lived garbage and a growing set of survivors, run with the
+// pause budget collection heuristics. Survivors must still be intact once all the collections are done.
+
+function assert(condition, message) {
+    if (!condition) {
+        throw new Error("Assertion failed: " + message);
+    }
+}
+
+var survivors = [];
+for (var i = 0; i < 2000; i++) {
+    var garbage = [];
+    for (var j = 0; j < 100; j++) {
+        garbage.push({ index: j, name: "garbage" + j, values: [j, j + 1, j + 2] });
+    }
+
+    if (i % 10 === 0) {
+        survivors.push({ index: i, name: "survivor" + i, values: garbage.slice(0, 5) });
+    }
+}
+
+for (var i = 0; i < survivors.length; i++) {
+    var survivor = survivors[i];
+    assert(survivor.index === i * 10, "survivor index");
+    assert(survivor.name === "survivor" + survivor.index, "survivor name");
+    assert(survivor.values.length === 5 && survivor.values[4].values[2] === 6, "survivor values");
+}
+
+WScript.Echo("PASSED");
@@ -0,0 +1,96 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// String to number conversions that go through the fast path for up to 19 significant digits, and
+// values next to its limits: ties, the largest and smallest normal doubles, and denormals.
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+var f64 = new Float64Array(1);
+var u32 = new Uint32Array(f64.buffer);
+
+function assertBits(hi, lo, value, msg) {
+    f64[0] = value;
+    assert.areEqual(hi, u32[1], msg + ": high bits");
+    assert.areEqual(lo, u32[0], msg + ": low bits");
+}
+
+// [string, high bits, low bits] of the double nearest to the string
+var cases = [
+    ["0.1", 0x3FB99999, 0x9999999A],
+    ["0.30000000000000004", 0x3FD33333, 0x33333334],
+    ["9007199254740993", 0x43400000, 0x0],
+    ["9007199254740995", 0x43400000, 0x2],
+    ["18014398509481993", 0x43500000, 0x2],
+    ["2.2250738585072014e-308", 0x100000, 0x0],
+    ["2.2250738585072011e-308", 0xFFFFF, 0xFFFFFFFF],
+    ["1.7976931348623157e308", 0x7FEFFFFF, 0xFFFFFFFF],
+    ["1.7976931348623158e308", 0x7FEFFFFF, 0xFFFFFFFF],
+    ["1.7976931348623159e308", 0x7FF00000, 0x0],
+    ["4.9e-324", 0x0, 0x1],
+    ["123456789012345678e-5", 0x4271F71F, 0xB04CB74F],
+    ["7.2057594037927933e16", 0x43700000, 0x0],
+    ["1e23", 0x44B52D02, 0xC7E14AF6],
+    ["8.98846567431158e307", 0x7FE00000, 0x0],
+    ["3.14159265358979323", 0x400921FB, 0x54442D18],
+    ["1234567890123456789", 0x43B12210, 0xF47DE981],
+    ["9999999999999999999", 0x43E158E4, 0x60913D00],
+    ["0.000001234567890123456789", 0x3EB4B66D, 0xC01EC6FB],
+    ["1.00000000000000011102230246251565404236316680908203125", 0x3FF00000, 0x0],
+    ["1.00000000000000011102230246251565404236316680908203124", 0x3FF00000, 0x0],
+    ["2.5e-5", 0x3EFA36E2, 0xEB1C432D],
+    ["6.02214076e23", 0x44DFE185, 0xCA57C517],
+    ["1.602176634e-19", 0x3C07A4DA, 0x290C1653],
+    ["5e-310", 0x5C0A, 0xB9347ED7],
+    ["1448997445238699", 0x4314976C, 0x803FEAC],
+    ["1e-300", 0x1A56E1F, 0xC2F8F359],
+    ["-0.1", 0xBFB99999, 0x9999999A],
+    ["33554433.000000001", 0x41800000, 0x8000000],
+    ["4.35679856e-325", 0x0, 0x0],
+];
+
+var tests = [
+    {
+        name: "Number() gives the nearest double",
+        body: function () {
+            cases.forEach(function (c) {
+                assertBits(c[1], c[2], Number(c[0]), "Number(\"" + c[0] + "\")");
+            });
+        }
+    },
+    {
+        name: "parseFloat gives the nearest double",
+        body: function () {
+            cases.forEach(function (c) {
+                assertBits(c[1], c[2], parseFloat(c[0] + "px"), "parseFloat(\"" + c[0] + "px\")");
+            });
+        }
+    },
+    {
+        name: "JSON.parse gives the nearest double",
+        body: function () {
+            var values = JSON.parse("[" + cases.map(function (c) { return c[0]; }).join(",") + "]");
+            cases.forEach(function (c, i) {
+                assertBits(c[1], c[2], values[i], "JSON.parse(\"" + c[0] + "\")");
+            });
+        }
+    },
+    {
+        name: "Numbers round trip through their string",
+        body: function () {
+            var seed = 5;
+            for (var i = 0; i < 5000; i++) {
+                seed = (seed * 1103515245 + 12345) % 2147483648;
+                var value = (seed / 2147483648 - 0.5) * Math.pow(10, (seed % 617) - 308);
+                assert.areEqual(value, Number(String(value)), "Number(\"" + value + "\")");
+                assert.areEqual(value, JSON.parse(JSON.stringify([value]))[0], "JSON.parse(\"" + value + "\")");
+            }
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
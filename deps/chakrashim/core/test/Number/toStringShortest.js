@@ -0,0 +1,99 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Number to string gives the shortest digits that convert back to the same double
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+var seed = 3;
+function random() {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed / 2147483648;
+}
+
+// Number of significant digits in the result of Number.prototype.toString
+function significantDigits(str) {
+    var mantissa = str.replace(/^-/, "").replace(/e.*$/, "").replace(".", "");
+    return mantissa.replace(/^0+/, "").replace(/0+$/, "").length;
+}
+
+function assertShortest(value, msg) {
+    var str = String(value);
+    assert.areEqual(value, Number(str), msg + ": " + str + " converts back");
+    var digits = significantDigits(str);
+    if (digits > 1) {
+        assert.areNotEqual(value, Number(value.toPrecision(digits - 1)), msg + ": " + str + " is the shortest");
+    }
+}
+
+var tests = [
+    {
+        name: "Known values",
+        body: function () {
+            var cases = [
+                [0.1, "0.1"],
+                [0.1 + 0.2, "0.30000000000000004"],
+                [1 / 3, "0.3333333333333333"],
+                [123.456, "123.456"],
+                [-0.000001, "-0.000001"],
+                [1e-7, "1e-7"],
+                [1e21, "1e+21"],
+                [1e23, "1e+23"],
+                [123e18, "123000000000000000000"],
+                [5e-324, "5e-324"],
+                [2.2250738585072014e-308, "2.2250738585072014e-308"],
+                [2.225073858507201e-308, "2.225073858507201e-308"],
+                [1.7976931348623157e308, "1.7976931348623157e+308"],
+                [9007199254740991, "9007199254740991"],
+                [9007199254740992, "9007199254740992"],
+                [9007199254740994, "9007199254740994"],
+                [4294967296, "4294967296"],
+                [1e15, "1000000000000000"],
+                [1.5, "1.5"],
+                [-100, "-100"],
+            ];
+            cases.forEach(function (c) {
+                assert.areEqual(c[1], String(c[0]), "String(" + c[1] + ")");
+            });
+        }
+    },
+    {
+        name: "Random doubles convert back with the fewest digits",
+        body: function () {
+            for (var i = 0; i < 5000; i++) {
+                var value = (random() - 0.5) * Math.pow(10, Math.floor(random() * 600) - 300);
+                assertShortest(value, "random double");
+            }
+        }
+    },
+    {
+        name: "Powers of two, where the lower neighbor is closer",
+        body: function () {
+            for (var e = -1074; e <= 1023; e += 7) {
+                assertShortest(Math.pow(2, e), "2^" + e);
+            }
+        }
+    },
+    {
+        name: "Integral values",
+        body: function () {
+            var value = 1;
+            for (var i = 0; i < 53; i++) {
+                assert.areEqual(value.toString(), String(value), "2^" + i);
+                assertShortest(value, "2^" + i);
+                value = value * 2 + (i & 1);
+            }
+            for (var i = 0; i < 1000; i++) {
+                var n = Math.floor(random() * 1e15);
+                assert.areEqual(n, parseInt(String(n), 10), "integral " + n);
+                assert.isTrue(/^[1-9][0-9]*$|^0$/.test(String(n)), "integral " + n + " has no fraction or exponent");
+            }
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
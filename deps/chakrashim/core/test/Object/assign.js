@@ -150,6 +150,26 @@ var tests = [
             assert.areEqual(newObj[0], orig[0]);
             assert.areEqual(newObj[1], undefined);
         }
+    },
+    {
+        name: "copy shares the type but not the properties",
+        body: function ()
+        {
+            let orig = {};
+            orig.p = 1;
+            orig.q = "asdf";
+            let newObj = Object.assign({}, orig);
+            newObj.p = 2;
+            newObj.r = 3;
+            orig.s = 4;
+            assert.areEqual(1, orig.p);
+            assert.areEqual(undefined, orig.r);
+            assert.areEqual(2, newObj.p);
+            assert.areEqual("asdf", newObj.q);
+            assert.areEqual(undefined, newObj.s);
+            assert.areEqual(["p", "q", "r"], Object.keys(newObj));
+            assert.areEqual(["p", "q", "s"], Object.keys(orig));
+        }
     }
 ];
 
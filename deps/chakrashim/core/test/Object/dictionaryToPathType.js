@@ -0,0 +1,81 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// An object that went to dictionary mode because of a delete is turned back into a path type once its
+// properties stay the same for a while. Objects that can't be described by a path type stay as they are.
+
+// Each reader is a new function, so that its inline caches are empty and every read takes the slow path
+var readerCount = 0;
+function read(obj, names) {
+    var body = "// reader " + (readerCount++) + "\nreturn [" + names.map(function (name) { return "o." + name; }).join(", ") + "];";
+    return new Function("o", body)(obj);
+}
+
+function readMany(obj, names, count) {
+    var result;
+    for (var i = 0; i < count; i++) {
+        result = read(obj, names);
+    }
+    return result;
+}
+
+function keys(obj) {
+    var result = [];
+    for (var key in obj) {
+        result.push(key);
+    }
+    return result.join();
+}
+
+function test(name, obj, names) {
+    WScript.Echo(name + ": " + readMany(obj, names, 20).join() + " [" + keys(obj) + "]");
+}
+
+// Converted: the remaining properties keep their values and order
+var obj = { a: 1, b: 2, c: 3, d: 4 };
+delete obj.b;
+test("deleted b", obj, ["a", "c", "d"]);
+
+// The converted object keeps working as a normal object
+obj.e = 5;
+obj.c = 30;
+test("added e", obj, ["a", "c", "d", "e"]);
+delete obj.a;
+test("deleted a", obj, ["c", "d", "e"]);
+
+// A property that was deleted and then added again
+var readded = { a: 1, b: 2, c: 3 };
+delete readded.a;
+readded.a = 10;
+WScript.Echo("re-added a: " + readMany(readded, ["a", "b", "c"], 20).join());
+
+// Not converted: a property that isn't writable, enumerable and configurable
+var readOnly = { a: 1, b: 2, c: 3 };
+delete readOnly.b;
+Object.defineProperty(readOnly, "c", { writable: false });
+test("read-only c", readOnly, ["a", "c"]);
+
+// Not converted: a symbol property
+var withSymbol = { a: 1, b: 2, c: 3 };
+withSymbol[Symbol.iterator] = null;
+delete withSymbol.b;
+test("symbol", withSymbol, ["a", "c"]);
+
+// Not converted: not extensible
+var sealed = { a: 1, b: 2, c: 3 };
+delete sealed.b;
+Object.preventExtensions(sealed);
+test("not extensible", sealed, ["a", "c"]);
+sealed.d = 4;
+WScript.Echo("not extensible: " + ("d" in sealed));
+
+// Not converted: a prototype that isn't Object.prototype
+var proto = { p: 0 };
+var derived = Object.create(proto);
+derived.a = 1;
+derived.b = 2;
+derived.c = 3;
+delete derived.b;
+test("derived", derived, ["a", "c", "p"]);
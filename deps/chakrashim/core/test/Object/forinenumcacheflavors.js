@@ -0,0 +1,88 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The enumerator cache of a type is shared by for...in with and without enumerable properties on the
+// prototype chain, Object.keys and Object.getOwnPropertyNames. Check that interleaving them keeps each
+// of them correct.
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+function forInKeysToArray(obj) {
+    var s = [];
+    for (var key in obj) {
+        s.push(key);
+    }
+    return s;
+}
+
+function makeShaped(proto) {
+    var o = Object.create(proto);
+    o.a = 1;
+    o.b = 2;
+    Object.defineProperty(o, 'hidden', { value: 3, enumerable: false, writable: true, configurable: true });
+    o.c = 4;
+    return o;
+}
+
+var tests = [
+    {
+        name: "for...in and Object.keys over the same type",
+        body: function () {
+            function Base() {}
+            Base.prototype.inherited = function () {};
+            for (var i = 0; i < 50; i++) {
+                var o = makeShaped(Base.prototype);
+                assert.areEqual(["a", "b", "c", "inherited"], forInKeysToArray(o), "for...in");
+                assert.areEqual(["a", "b", "c"], Object.keys(o), "Object.keys");
+                assert.areEqual(["a", "b", "hidden", "c"], Object.getOwnPropertyNames(o), "Object.getOwnPropertyNames");
+            }
+        }
+    },
+    {
+        name: "Prototype shadowed by a non-enumerable own property",
+        body: function () {
+            var proto = { hidden: "proto", visible: "proto" };
+            for (var i = 0; i < 50; i++) {
+                var o = makeShaped(proto);
+                assert.areEqual(["a", "b", "c", "visible"], forInKeysToArray(o), "for...in");
+                assert.areEqual(["a", "b", "c"], Object.keys(o), "Object.keys");
+            }
+        }
+    },
+    {
+        name: "Prototype gaining and losing enumerable properties between loops",
+        body: function () {
+            var proto = {};
+            for (var i = 0; i < 50; i++) {
+                var o = makeShaped(proto);
+                if (i % 2) {
+                    proto.extra = i;
+                    assert.areEqual(["a", "b", "c", "extra"], forInKeysToArray(o), "with extra, iteration " + i);
+                    delete proto.extra;
+                } else {
+                    assert.areEqual(["a", "b", "c"], forInKeysToArray(o), "without extra, iteration " + i);
+                }
+                assert.areEqual(["a", "b", "c"], Object.keys(o), "Object.keys, iteration " + i);
+            }
+        }
+    },
+    {
+        name: "Objects of the same type as prototype and as leaf",
+        body: function () {
+            var leaf = { x: 1, y: 2 };
+            var proto = { x: 10, y: 20 };
+            var child = Object.create(proto);
+            child.z = 3;
+            for (var i = 0; i < 50; i++) {
+                assert.areEqual(["x", "y"], forInKeysToArray(leaf), "leaf");
+                assert.areEqual(["z", "x", "y"], forInKeysToArray(child), "child");
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,68 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+function assert(actual, expected)
+{
+    if (actual !== expected)
+    {
+        throw new Error("failed test Actual: " + actual + " Expected: " + expected);
+    }
+}
+
+// Result objects that are only read back are never needed once their fields are copy propped
+function sumPairs(n)
+{
+    var sum = 0;
+    for (var i = 0; i < n; i++)
+    {
+        var r = { value: i, done: i === n - 1 };
+        sum += r.value;
+        if (r.done)
+        {
+            sum += 1000;
+        }
+    }
+    return sum;
+}
+
+// The object is still live at the bailout on the string value and has to be materialized
+function bailOutWithObject(a)
+{
+    var sum = 0;
+    for (var i = 0; i < a.length; i++)
+    {
+        var o = { x: a[i], y: 1 };
+        sum += o.x + o.y;
+    }
+    return sum;
+}
+
+// Aliased and escaping objects keep their initialization
+var saved;
+function escape(n)
+{
+    var last;
+    for (var i = 0; i < n; i++)
+    {
+        var o = { x: i };
+        var p = o;
+        last = p.x;
+        saved = p;
+    }
+    return last;
+}
+
+for (var j = 0; j < 20; j++)
+{
+    assert(sumPairs(10), 1045);
+    assert(bailOutWithObject([1, 2, 3]), 9);
+    assert(escape(5), 4);
+    assert(saved.x, 4);
+}
+
+assert(bailOutWithObject([1, 2, "3"]), "531");
+assert(bailOutWithObject([1, "a", 3]), "2a14");
+
+WScript.Echo("PASSED");
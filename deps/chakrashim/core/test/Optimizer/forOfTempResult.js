@@ -0,0 +1,84 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+function assert(actual, expected)
+{
+    if (actual !== expected)
+    {
+        throw new Error("failed test Actual: " + actual + " Expected: " + expected);
+    }
+}
+
+function sum(a)
+{
+    var s = 0;
+    for (var x of a)
+    {
+        s += x;
+    }
+    return s;
+}
+
+function sumUntil(a, stop)
+{
+    var s = 0;
+    for (var x of a)
+    {
+        if (x === stop)
+        {
+            break;
+        }
+        s += x;
+    }
+    return s;
+}
+
+function lastBeforeThrow(a)
+{
+    var last;
+    try
+    {
+        for (var x of a)
+        {
+            last = x;
+            if (x > 2)
+            {
+                throw new Error("stop");
+            }
+        }
+    }
+    catch (e)
+    {
+        return last;
+    }
+    return -1;
+}
+
+var arr = [1, 2, 3, 4];
+for (var j = 0; j < 20; j++)
+{
+    assert(sum(arr), 10);
+    assert(sumUntil(arr, 3), 3);
+    assert(lastBeforeThrow(arr), 3);
+}
+
+// Replacing the iterator protocol must still be observed by the optimized loops
+var arrayIteratorPrototype = Object.getPrototypeOf([][Symbol.iterator]());
+var originalNext = arrayIteratorPrototype.next;
+arrayIteratorPrototype.next = function ()
+{
+    var result = originalNext.call(this);
+    if (!result.done)
+    {
+        result.value *= 10;
+    }
+    return result;
+};
+assert(sum(arr), 100);
+assert(sumUntil(arr, 30), 30);
+arrayIteratorPrototype.next = originalNext;
+assert(sum(arr), 10);
+
+WScript.Echo("PASSED");
@@ -0,0 +1,23 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// jshost -trace:perfhint -perfhintlevel:2 dictionaryMode.js
+
+function removeMiddle(obj) {
+    delete obj.b;
+    return obj;
+}
+
+function addMany(obj, count) {
+    for (var i = 0; i < count; i++) {
+        obj["p" + i] = i;
+    }
+    return obj;
+}
+
+removeMiddle({ a: 1, b: 2, c: 3 });
+addMany({}, 200);
+
+WScript.Echo("pass");
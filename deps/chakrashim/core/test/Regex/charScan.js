@@ -0,0 +1,94 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// The sync instructions search blocks of eight characters at a time; put the match at every position around the
+// block boundaries and in the tail left over after the last whole block.
+function forEachPosition(callback)
+{
+    for (let length = 0; length <= 40; length++)
+    {
+        for (let index = 0; index < length; index++)
+        {
+            callback(length, index);
+        }
+    }
+}
+
+function inputWith(length, index, c)
+{
+    return "-".repeat(index) + c + "-".repeat(length - index - 1);
+}
+
+var tests = [
+    {
+        name : "Single char",
+        body : function ()
+        {
+            forEachPosition(function (length, index)
+            {
+                const input = inputWith(length, index, "x");
+                assert.areEqual(index, input.search(/x/), input);
+                assert.areEqual(input.replace("x", "y"), input.replace(/x/g, "y"), input);
+            });
+            assert.areEqual(-1, "-".repeat(33).search(/x/));
+        }
+    },
+    {
+        name : "Leading char",
+        body : function ()
+        {
+            forEachPosition(function (length, index)
+            {
+                const input = inputWith(length, index, "x") + "y";
+                assert.areEqual(index, input.search(/x-*y/), input);
+                assert.areEqual(index, input.search(/x-*y|z/), input);
+            });
+            assert.areEqual(-1, "-".repeat(33).search(/x-*y/));
+        }
+    },
+    {
+        name : "Leading pair of chars",
+        body : function ()
+        {
+            forEachPosition(function (length, index)
+            {
+                const input = inputWith(length, index, index % 2 ? "a" : "b") + "!";
+                assert.areEqual(index, input.search(/[ab]-*!/), input);
+            });
+            assert.areEqual(-1, "-".repeat(33).search(/[ab]-*!/));
+        }
+    },
+    {
+        name : "Char after a skipped prefix",
+        body : function ()
+        {
+            forEachPosition(function (length, index)
+            {
+                const input = inputWith(length, index, "x");
+                const match = /-*x/.exec(input);
+                assert.areEqual(0, match.index, input);
+                assert.areEqual(index + 1, match[0].length, input);
+            });
+        }
+    },
+    {
+        name : "Non-ASCII chars",
+        body : function ()
+        {
+            forEachPosition(function (length, index)
+            {
+                const input = "\u4e00".repeat(index) + "\u4e01" + "\u4e00".repeat(length - index - 1);
+                assert.areEqual(index, input.search(/\u4e01/), input);
+                assert.areEqual(-1, input.search(/\u0001/), input);
+            });
+        }
+    },
+];
+
+testRunner.runTests(tests, {
+    verbose : WScript.Arguments[0] != "summary"
+});
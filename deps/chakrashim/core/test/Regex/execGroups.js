@@ -0,0 +1,35 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var tests = [
+    {
+        name : "Groups spanning the whole input or the same span as the previous group",
+        body : function ()
+        {
+            const input = "hello world";
+            let match = /^(.*)$/.exec(input);
+            assert.areEqual(input, match[0]);
+            assert.areEqual(input, match[1]);
+
+            match = /((\w+))/.exec("  abc  ");
+            assert.areEqual(["abc", "abc", "abc"], Array.from(match));
+            assert.areEqual(2, match.index);
+
+            match = /(a)?(a)?b/.exec("ab");
+            assert.areEqual(["ab", "a", undefined], Array.from(match));
+
+            match = /()()x/.exec("x");
+            assert.areEqual(["x", "", ""], Array.from(match));
+
+            match = /(abc)(c)?/.exec("abcabc");
+            assert.areEqual(["abc", "abc", undefined], Array.from(match));
+            assert.areEqual("abcd", match[1] + "d");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose : WScript.Arguments[0] != "summary" });
@@ -0,0 +1,86 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// Run both with the default flags and with -RegexLinear; the results must not depend on which matcher ran.
+function exec(re, input)
+{
+    const match = re.exec(input);
+    return match === null ? null : { index : match.index, groups : Array.from(match, g => g === undefined ? null : g) };
+}
+
+var tests = [
+    {
+        name : "Matches and captures agree with the backtracking semantics",
+        body : function ()
+        {
+            const cases = [
+        [/a|ab/, "xab", {"index":1,"groups":["a"]}],
+        [/(a|ab)(c|bcd)(d*)/, "abcd", {"index":0,"groups":["abcd","a","bcd",""]}],
+        [/((a)|b)+/, "ab", {"index":0,"groups":["ab","b",null]}],
+        [/(z)((a+)?(b+)?(c))*/, "zaacbbbcac", {"index":0,"groups":["zaacbbbcac","z","ac","a",null,"c"]}],
+        [/(a+)+b/, "aaaaaaaaaaaab", {"index":0,"groups":["aaaaaaaaaaaab","aaaaaaaaaaaa"]}],
+        [/(a*?)b/, "aaab", {"index":0,"groups":["aaab","aaa"]}],
+        [/a+?/, "aaa", {"index":0,"groups":["a"]}],
+        [/a{2,3}?c/, "aaaac", {"index":1,"groups":["aaac"]}],
+        [/(?:ab){2}(c)?/, "xxababd", {"index":2,"groups":["abab",null]}],
+        [/x{0}y/, "y", {"index":0,"groups":["y"]}],
+        [/^abc$/m, "x\nabc\ny", {"index":2,"groups":["abc"]}],
+        [/^abc$/, "x\nabc\ny", null],
+        [/\bfoo\b/, "afoo foo", {"index":5,"groups":["foo"]}],
+        [/\Bo\B/, "foo", {"index":1,"groups":["o"]}],
+        [/[a-c]+[^x]/, "xxabcx abcd", {"index":2,"groups":["abc"]}],
+        [/hello/i, "say HeLLo", {"index":4,"groups":["HeLLo"]}],
+        [/(\d+)-(\d+)?/, "12-x 3-4", {"index":0,"groups":["12-","12",null]}],
+        [/(a)|(b)/, "b", {"index":0,"groups":["b",null,"b"]}],
+        [/(?:(a)|b)+/, "ab", {"index":0,"groups":["ab",null]}],
+        [/(?:(a)|(b))+/, "ab", {"index":0,"groups":["ab",null,"b"]}],
+        [/(.)+/, "xyz", {"index":0,"groups":["xyz","z"]}],
+        [/((a)|(b))*c/, "abac", {"index":0,"groups":["abac","a","a",null]}],
+        [/q{2,}/, "qqqqq", {"index":0,"groups":["qqqqq"]}],
+        [/z$/, "zz", {"index":1,"groups":["z"]}],
+        [/a.c/, "a\nc abc", {"index":4,"groups":["abc"]}],
+        [/(ab|a)(bc|c)/, "abc", {"index":0,"groups":["abc","ab","c"]}],
+        [/(a|b)*?c/, "abbc", {"index":0,"groups":["abbc","b"]}],
+        [/\W\w\d\s\S/, "!a1 x", {"index":0,"groups":["!a1 x"]}]
+            ];
+            for (const [re, input, expected] of cases)
+            {
+                assert.areEqual(JSON.stringify(expected), JSON.stringify(exec(re, input)), re + " on " + JSON.stringify(input));
+            }
+        }
+    },
+    {
+        name : "Global and sticky searches",
+        body : function ()
+        {
+            assert.areEqual("x-x-x", "ab-aab-abb".replace(/(a|b)+b/g, "x"));
+            assert.areEqual("[ab],[ab],[aa]", "ababaaab".match(/(?:ab|aa)+?/g).map(m => "[" + m + "]").slice(0, 3).join());
+
+            const sticky = /(a|b)+c/y;
+            sticky.lastIndex = 1;
+            assert.areEqual("bac", sticky.exec("xbacab")[0]);
+            assert.areEqual(4, sticky.lastIndex);
+            assert.areEqual(null, sticky.exec("xbacab"));
+        }
+    },
+    {
+        name : "Nested quantifiers finish in linear time",
+        body : function ()
+        {
+            const input = "a".repeat(5000);
+            assert.areEqual(null, /(a+)+b/.exec(input));
+            assert.areEqual(null, /(a|aa)+$/.exec(input + "!"));
+            assert.areEqual(null, /^(\w+\s?)+$/.exec("foo bar baz ".repeat(1000) + "!"));
+
+            const match = /(a+)+b/.exec(input + "b");
+            assert.areEqual(0, match.index);
+            assert.areEqual(5000, match[1].length);
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,93 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// The scanner skips runs of plain ASCII in identifiers, strings, comments and whitespace in blocks.
+// Put the character that ends the run at every offset around the block boundaries.
+const maxRun = 40;
+
+function run(length, ch) {
+    return (ch || 'x').repeat(length);
+}
+
+var tests = [
+    {
+        name: "Identifiers",
+        body: function () {
+            for (let i = 1; i < maxRun; i++) {
+                const id = run(i, 'a');
+                assert.areEqual(i, eval(`(function () { var ${id} = ${i}; return ${id}; })()`), id);
+                assert.areEqual(i, eval(`(function () { var ${id}Z_$9 = ${i}; return ${id}Z_$9; })()`), id + "Z_$9");
+                assert.areEqual(i, eval(`(function () { var ${id}\u00e9b = ${i}; return ${id}\u00e9b; })()`), id + "\u00e9b");
+                assert.areEqual(i, eval(`(function () { var ${id}\\u0062c = ${i}; return ${id}bc; })()`), id + "\\u0062c");
+                assert.areEqual(i, eval(`(function () { var ${id} = ${i}; return ${id}+0; })()`), id + "+0");
+            }
+        }
+    },
+    {
+        name: "String literals",
+        body: function () {
+            for (let i = 0; i < maxRun; i++) {
+                const s = run(i);
+                assert.areEqual(s, eval(`"${s}"`));
+                assert.areEqual(s, eval(`'${s}'`));
+                assert.areEqual(s + "'y", eval(`"${s}'y"`));
+                assert.areEqual(s + '"y', eval(`'${s}"y'`));
+                assert.areEqual(s + "\ny", eval(`"${s}\\ny"`));
+                assert.areEqual(s + "\ty", eval(`"${s}\ty"`));
+                assert.areEqual(s + "\u00e9y", eval(`"${s}\u00e9y"`));
+                assert.areEqual(s + "$`y", eval(`"${s}$\`y"`));
+                assert.throws(() => eval(`"${s}\ny"`), SyntaxError);
+            }
+        }
+    },
+    {
+        name: "Template literals",
+        body: function () {
+            for (let i = 0; i < maxRun; i++) {
+                const s = run(i);
+                const value = 1;
+                assert.areEqual(s, eval(`\`${s}\``));
+                assert.areEqual(s + "1" + s, eval(`\`${s}\${value}${s}\``));
+                assert.areEqual(s + "$y", eval(`\`${s}$y\``));
+                assert.areEqual(s + "\ny", eval(`\`${s}\r\ny\``));
+                assert.areEqual(s + "\\ny", eval(`String.raw\`${s}\\ny\``));
+            }
+        }
+    },
+    {
+        name: "Comments",
+        body: function () {
+            for (let i = 0; i < maxRun; i++) {
+                const s = run(i);
+                assert.areEqual(i, eval(`/*${s}*/ ${i}`));
+                assert.areEqual(i, eval(`/*${s}* /*${s}**/ ${i}`));
+                assert.areEqual(i, eval(`/*${s}\u00e9\t${s}*/ ${i}`));
+                assert.areEqual(i, eval(`//${s}\n${i}`));
+                assert.areEqual(i, eval(`//${s}\r\n${i}`));
+                assert.areEqual(i, eval(`//${s}\u2028${i}`));
+                assert.areEqual(i, eval(`//${s}\u00e9\t${s}\n${i}`));
+                // A line break in a comment still ends the return statement
+                assert.areEqual(undefined, eval(`(function () { return /*${s}\n${s}*/ ${i}; })()`));
+                assert.areEqual(undefined, eval(`(function () { return //${s}\n${i}; })()`));
+            }
+        }
+    },
+    {
+        name: "Whitespace",
+        body: function () {
+            for (let i = 0; i < maxRun; i++) {
+                assert.areEqual(i, eval(`${run(i, ' ')}${i}`));
+                assert.areEqual(i, eval(`${run(i, ' ')}\t${run(i, '\t')}${i}`));
+                assert.areEqual(i, eval(`${run(i, ' ')}\v\f${i}`));
+                assert.areEqual(undefined, eval(`(function () { return${run(i, ' ')}\n${i}; })()`));
+                assert.areEqual(undefined, eval(`(function () { return${run(i, '\t')}\u2029${i}; })()`));
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
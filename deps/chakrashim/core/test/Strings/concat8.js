@@ -0,0 +1,74 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Short concatenations are copied into a flat string; check the results around the cutoff, with flat, tree and
+// compound operands on either side.
+
+function check(actual, expected, message)
+{
+    if (actual !== expected)
+    {
+        throw new Error(message + ": expected \"" + expected + "\", got \"" + actual + "\"");
+    }
+}
+
+var chars = "abcdefghijklmnopqrstuvwxyz0123456789";
+
+function flat(n)
+{
+    return chars.substring(0, n);
+}
+
+function tree(n)
+{
+    // Not finalized until it is read
+    var half = n >> 1;
+    return flat(half) + chars.substring(half, n);
+}
+
+function compound(n)
+{
+    var s = "";
+    for (var i = 0; i < n; i++)
+    {
+        s += chars[i];
+    }
+    return s;
+}
+
+var makers = [flat, tree, compound];
+for (var leftLength = 0; leftLength <= 20; leftLength++)
+{
+    for (var rightLength = 0; rightLength <= 20; rightLength++)
+    {
+        for (var l = 0; l < makers.length; l++)
+        {
+            for (var r = 0; r < makers.length; r++)
+            {
+                var left = makers[l](leftLength);
+                var right = makers[r](rightLength);
+                var expected = flat(leftLength) + flat(rightLength);
+                var result = left + right;
+                check(result.length, leftLength + rightLength, "length " + leftLength + "+" + rightLength);
+                check(result, expected, "value " + leftLength + "+" + rightLength);
+
+                // Keep appending to the result, so that it becomes a tree or compound string again
+                result += right;
+                check(result, expected + flat(rightLength), "append " + leftLength + "+" + rightLength);
+            }
+        }
+    }
+}
+
+var s = "";
+for (var i = 0; i < 1000; i++)
+{
+    s += String.fromCharCode(0x41 + (i % 26));
+}
+check(s.length, 1000, "loop length");
+check(s.substring(0, 28), "ABCDEFGHIJKLMNOPQRSTUVWXYZAB", "loop prefix");
+check(s[999], String.fromCharCode(0x41 + (999 % 26)), "loop last char");
+
+WScript.Echo("Passed");
@@ -0,0 +1,103 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// indexOf, includes and split search eight characters at a time. Matches near block boundaries, at the end
+// of the string and with non-ASCII characters must all be found.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var seed = 11;
+function random(n) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return Math.floor(seed / 2147483648 * n);
+}
+
+function randomString(length, alphabet) {
+    var result = "";
+    for (var i = 0; i < length; i++) {
+        result += alphabet[random(alphabet.length)];
+    }
+    return result;
+}
+
+function naiveIndexOf(input, search, position) {
+    for (var i = position; i + search.length <= input.length; i++) {
+        var j = 0;
+        while (j < search.length && input.charCodeAt(i + j) === search.charCodeAt(j)) {
+            j++;
+        }
+        if (j === search.length) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+var alphabets = ["ab", "abc,", "aĀbā", "😀x"];
+
+var tests = [
+    {
+        name: "indexOf matches a naive search",
+        body: function () {
+            alphabets.forEach(function (alphabet) {
+                for (var n = 0; n < 2000; n++) {
+                    var input = randomString(random(70), alphabet);
+                    var search = randomString(1 + random(20), alphabet);
+                    var position = random(input.length + 1);
+                    assert.areEqual(naiveIndexOf(input, search, position), input.indexOf(search, position),
+                        JSON.stringify(input) + ".indexOf(" + JSON.stringify(search) + ", " + position + ")");
+                }
+            });
+        }
+    },
+    {
+        name: "Matches at every offset of a long string",
+        body: function () {
+            var filler = "-".repeat(100);
+            ["x", "xy", "xĀ", "xyz", "ĀāĂ", "abcdefghijklmnopq"].forEach(function (search) {
+                for (var i = 0; i + search.length <= filler.length; i++) {
+                    var input = filler.substring(0, i) + search + filler.substring(i + search.length);
+                    assert.areEqual(i, input.indexOf(search), search + " at " + i);
+                    assert.isTrue(input.includes(search), search + " included at " + i);
+                    assert.areEqual(-1, input.indexOf(search, i + 1), search + " after " + i);
+                }
+            });
+        }
+    },
+    {
+        name: "First and last characters match without a full match",
+        body: function () {
+            var input = "axxb".repeat(40) + "axyb";
+            assert.areEqual(160, input.indexOf("axyb"), "last candidate matches");
+            assert.areEqual(-1, input.indexOf("ayyb"), "no candidate matches");
+            assert.isFalse(input.includes("aĀb"), "no candidate matches with a non-ASCII character");
+        }
+    },
+    {
+        name: "split with string separators",
+        body: function () {
+            alphabets.forEach(function (alphabet) {
+                for (var n = 0; n < 500; n++) {
+                    var input = randomString(random(100), alphabet);
+                    var separator = randomString(1 + random(3), alphabet);
+                    var expected = [];
+                    var start = 0;
+                    var index;
+                    while ((index = naiveIndexOf(input, separator, start)) !== -1) {
+                        expected.push(input.substring(start, index));
+                        start = index + separator.length;
+                    }
+                    expected.push(input.substring(start));
+                    assert.areEqual(expected, input.split(separator),
+                        JSON.stringify(input) + ".split(" + JSON.stringify(separator) + ")");
+                }
+            });
+            assert.areEqual(["a", "b", "c", ""], "a,b,c,".split(","), "separator at the end");
+            assert.areEqual(["", "x"], "Āāx".split("Āā"), "non-ASCII separator at the start");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -819,6 +819,50 @@ var tests = [
             assert.areEqual("test", map.get(key), "1.0 should be equal to the key 1 and map to 'test'");
         }
     },
+
+    {
+        name: "Lookups and live iterators stay correct when deleted entries are compacted away",
+        body: function() {
+            var map = new Map();
+            var i;
+
+            for (i = 0; i < 100; i++) {
+                map.set("k" + i, i);
+            }
+
+            var iter = map.entries();
+            assert.areEqual(["k0", 0], iter.next().value, "first entry");
+            assert.areEqual(["k1", 1], iter.next().value, "second entry");
+
+            // Remove most entries, then add enough new ones that the map has to make room
+            for (i = 0; i < 90; i++) {
+                map.delete("k" + i);
+            }
+            for (i = 100; i < 300; i++) {
+                map.set("k" + i, i);
+            }
+
+            assert.areEqual(210, map.size, "size after deletes and adds");
+            assert.areEqual(95, map.get("k95"), "old key still maps to its value");
+            assert.areEqual(250, map.get("k250"), "new key maps to its value");
+            assert.isFalse(map.has("k5"), "deleted key is gone");
+
+            map.set("k95", "updated");
+            assert.areEqual("updated", map.get("k95"), "update after compaction");
+
+            var expected = 90;
+            var result;
+            while (!(result = iter.next()).done) {
+                assert.areEqual("k" + expected, result.value[0], "iterator resumes at the next live entry in order");
+                expected++;
+            }
+            assert.areEqual(300, expected, "iterator visited every remaining entry");
+
+            map.clear();
+            map.set(1, 1);
+            assert.isTrue(iter.next().done, "finished iterator stays finished");
+        }
+    },
 ];
 
 testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,125 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Proxy traps are looked up on the handler through a cache. Changes to handlers must still be seen.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function readMany(proxy, count) {
+    var result = [];
+    for (var i = 0; i < count; i++) {
+        result.push(proxy.x);
+    }
+    return result.join();
+}
+
+var tests = [
+    {
+        name: "Handlers with the same type find their own traps",
+        body() {
+            function makeHandler(value) {
+                return { get() { return value; } };
+            }
+            var proxies = [1, 2, 3].map(function (value) { return new Proxy({}, makeHandler(value)); });
+            proxies.forEach(function (proxy, i) {
+                assert.areEqual("" + (i + 1) + "," + (i + 1), readMany(proxy, 2), "trap of handler " + i);
+            });
+        }
+    },
+    {
+        name: "Changing a trap on the handler",
+        body() {
+            var handler = { get() { return "a"; } };
+            var proxy = new Proxy({ x: "target" }, handler);
+            assert.areEqual("a,a,a", readMany(proxy, 3), "original trap");
+            handler.get = function () { return "b"; };
+            assert.areEqual("b,b,b", readMany(proxy, 3), "replaced trap");
+            delete handler.get;
+            assert.areEqual("target,target", readMany(proxy, 2), "deleted trap");
+            handler.get = function () { return "c"; };
+            assert.areEqual("c,c", readMany(proxy, 2), "re-added trap");
+            handler.get = undefined;
+            assert.areEqual("target", readMany(proxy, 1), "undefined trap");
+        }
+    },
+    {
+        name: "Changing a trap on the handler's prototype",
+        body() {
+            class Handler {
+                get(target, name) { return "proto " + name; }
+            }
+            var first = new Proxy({}, new Handler());
+            var second = new Proxy({}, new Handler());
+            assert.areEqual("proto x,proto x", readMany(first, 2), "first proxy");
+            assert.areEqual("proto x,proto x", readMany(second, 2), "second proxy");
+
+            Handler.prototype.get = function () { return "changed"; };
+            assert.areEqual("changed,changed", readMany(first, 2), "changed prototype trap");
+
+            var shadowing = new Handler();
+            shadowing.get = function () { return "own"; };
+            assert.areEqual("own", readMany(new Proxy({}, shadowing), 1), "own trap shadows the prototype");
+            assert.areEqual("changed", readMany(second, 1), "other handlers still use the prototype");
+
+            Object.setPrototypeOf(Handler.prototype, { get() { return "grandparent"; } });
+            delete Handler.prototype.get;
+            assert.areEqual("grandparent,grandparent", readMany(first, 2), "trap from further up the chain");
+        }
+    },
+    {
+        name: "Getter traps are called each time",
+        body() {
+            var calls = 0;
+            var handler = {
+                get get() {
+                    calls++;
+                    return function () { return calls; };
+                }
+            };
+            var proxy = new Proxy({}, handler);
+            assert.areEqual("1,2,3", readMany(proxy, 3), "getter returning the trap");
+        }
+    },
+    {
+        name: "Set and has traps",
+        body() {
+            var log = [];
+            var handler = {
+                set(target, name, value) { log.push(name + "=" + value); return true; },
+                has(target, name) { return name === "yes"; }
+            };
+            var proxy = new Proxy({}, handler);
+            for (var i = 0; i < 3; i++) {
+                proxy.p = i;
+            }
+            assert.areEqual("p=0,p=1,p=2", log.join(), "set trap");
+            assert.isTrue("yes" in proxy, "has trap");
+            assert.isFalse("no" in proxy, "has trap");
+            handler.has = function () { return true; };
+            assert.isTrue("no" in proxy, "replaced has trap");
+        }
+    },
+    {
+        name: "A trap that becomes a non-function throws",
+        body() {
+            var handler = { get() { return 1; } };
+            var proxy = new Proxy({}, handler);
+            assert.areEqual("1,1", readMany(proxy, 2), "function trap");
+            handler.get = 42;
+            assert.throws(function () { return proxy.x; }, TypeError, "non-function trap");
+        }
+    },
+    {
+        name: "Revoked proxies throw",
+        body() {
+            var revocable = Proxy.revocable({}, { get() { return 1; } });
+            assert.areEqual("1,1", readMany(revocable.proxy, 2), "before revoking");
+            revocable.revoke();
+            assert.throws(function () { return revocable.proxy.x; }, TypeError, "after revoking");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
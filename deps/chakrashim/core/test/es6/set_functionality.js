@@ -742,6 +742,47 @@ var tests = [
             assert.isTrue(set.has(value), "1.0 should be equal to the value 1 and set has it");
         }
     },
+
+    {
+        name: "Live iterators follow deletes with compaction, and clear followed by adds",
+        body: function() {
+            var set = new Set();
+            var i;
+
+            for (i = 0; i < 64; i++) {
+                set.add("v" + i);
+            }
+
+            var seen = [];
+            set.forEach(function (value) {
+                seen.push(value);
+                if (value === "v10") {
+                    // Delete everything after this one and add enough to force the set to make room
+                    for (i = 11; i < 64; i++) {
+                        set.delete("v" + i);
+                    }
+                    for (i = 64; i < 128; i++) {
+                        set.add("v" + i);
+                    }
+                }
+            });
+            assert.areEqual(75, seen.length, "v0..v10 and then v64..v127 are visited");
+            assert.areEqual("v10", seen[10], "entries before the compaction keep their order");
+            assert.areEqual("v64", seen[11], "enumeration resumes at the first entry added after the deletes");
+            assert.areEqual("v127", seen[74], "enumeration reaches the last entry");
+            assert.areEqual(75, set.size, "size after deletes and adds");
+            assert.isTrue(set.has("v100") && !set.has("v20"), "lookups after compaction");
+
+            var iter = set.values();
+            assert.areEqual("v0", iter.next().value, "first value");
+            set.clear();
+            set.add("a");
+            set.add("b");
+            assert.areEqual("a", iter.next().value, "iterator continues with values added after clear");
+            assert.areEqual("b", iter.next().value, "iterator continues with values added after clear");
+            assert.isTrue(iter.next().done, "iterator is done");
+        }
+    },
 ];
 
 testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,91 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function collect() { return Array.prototype.slice.call(arguments); }
+function forward() { return collect(...arguments); }
+
+var tests = [
+    {
+        name: "Spread of an arguments object",
+        body: function () {
+            for (var i = 0; i < 100; i++) {
+                assert.areEqual([1, "b", 3.5], forward(1, "b", 3.5));
+                assert.areEqual([], forward());
+            }
+        }
+    },
+    {
+        name: "Spread of arguments with an accessor element falls back to the iterator",
+        body: function () {
+            var reads = 0;
+            function f() {
+                Object.defineProperty(arguments, 1, { get: function () { reads++; return "x"; } });
+                return collect(...arguments);
+            }
+            assert.areEqual([1, "x", 3], f(1, 2, 3));
+            assert.areEqual(1, reads);
+        }
+    },
+    {
+        name: "Spread of arrays with holes reads through the prototype",
+        body: function () {
+            var holey = [1, , 3];
+            assert.areEqual([1, undefined, 3], collect(...holey));
+            Array.prototype[1] = "proto";
+            try {
+                assert.areEqual([1, "proto", 3], collect(...holey));
+            } finally {
+                delete Array.prototype[1];
+            }
+            var sparse = [];
+            sparse[5] = 5;
+            assert.areEqual([undefined, undefined, undefined, undefined, undefined, 5], collect(...sparse));
+        }
+    },
+    {
+        name: "Spread of native int and float arrays",
+        body: function () {
+            for (var i = 0; i < 100; i++) {
+                assert.areEqual([1, 2, 3], collect(...[1, 2, 3]));
+                assert.areEqual([1.5, -0.5, NaN], collect(...[1.5, -0.5, NaN]));
+                assert.areEqual(3, Math.max(...[1, 3, 2]));
+            }
+        }
+    },
+    {
+        name: "Spread honours a user defined ArrayIterator next",
+        body: function () {
+            var arrayIteratorPrototype = Object.getPrototypeOf([][Symbol.iterator]());
+            var originalNext = arrayIteratorPrototype.next;
+            var calls = 0;
+            arrayIteratorPrototype.next = function () { calls++; return originalNext.call(this); };
+            try {
+                assert.areEqual([1, 2], forward(1, 2));
+                assert.areEqual([1, undefined], collect(...[1, ,]));
+                assert.areEqual(6, calls);
+            } finally {
+                arrayIteratorPrototype.next = originalNext;
+            }
+        }
+    },
+    {
+        name: "Spread of an array-like with the built-in values iterator",
+        body: function () {
+            var arrayLike = { length: 3, 0: "a", 2: "c" };
+            arrayLike[Symbol.iterator] = Array.prototype.values;
+            assert.areEqual(["a", undefined, "c"], collect(...arrayLike));
+
+            var lengthReads = 0;
+            var withGetter = { get length() { lengthReads++; return 2; }, 0: 0, 1: 1 };
+            withGetter[Symbol.iterator] = Array.prototype[Symbol.iterator];
+            assert.areEqual([0, 1], collect(...withGetter));
+            assert.isTrue(lengthReads > 0);
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
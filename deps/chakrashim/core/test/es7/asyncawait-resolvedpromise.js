@@ -0,0 +1,135 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// ES6 Async Await tests -- verifies awaiting native promises, which react to the awaited promise directly
+
+function echo(str) {
+    WScript.Echo(str);
+}
+
+var tests = [
+    {
+        name: "Awaiting a resolved promise resumes with its value",
+        body: function (index) {
+            async function af() {
+                var a = await Promise.resolve(1);
+                var b = await Promise.resolve(a + 1);
+                return a + b;
+            }
+
+            af().then(result => {
+                echo(`Test #${index} - Success awaited values add up to '${result}'`);
+            }, err => {
+                echo(`Test #${index} - Error awaiting resolved promises called with err = ${err}`);
+            });
+        }
+    },
+    {
+        name: "Awaiting a rejected promise throws its reason",
+        body: function (index) {
+            async function af() {
+                try {
+                    await Promise.reject("rejected");
+                } catch (e) {
+                    return e;
+                }
+            }
+
+            af().then(result => {
+                echo(`Test #${index} - Success caught the reason '${result}'`);
+            }, err => {
+                echo(`Test #${index} - Error awaiting a rejected promise called with err = ${err}`);
+            });
+        }
+    },
+    {
+        name: "An uncaught rejection rejects the async function's promise",
+        body: function (index) {
+            async function af() {
+                await Promise.reject("rejected");
+                echo(`Test #${index} - Error resumed after awaiting a rejected promise`);
+            }
+
+            af().then(result => {
+                echo(`Test #${index} - Error async function resolved with result = '${result}'`);
+            }, err => {
+                echo(`Test #${index} - Success async function has been rejected with err = '${err}'`);
+            });
+        }
+    },
+    {
+        name: "Awaiting resolves in the same order as reactions added by then",
+        body: function (index) {
+            var log = [];
+            var p = Promise.resolve();
+
+            async function af() {
+                log.push("before");
+                await p;
+                log.push("await 1");
+                await p;
+                log.push("await 2");
+            }
+
+            p.then(() => log.push("then 1")).then(() => log.push("then 2")).then(() => log.push("then 3"));
+            af().then(() => {
+                echo(`Test #${index} - Order is ${log.join(", ")}`);
+            });
+        }
+    },
+    {
+        name: "Awaiting a pending promise resumes once it is settled",
+        body: function (index) {
+            var resolve;
+            var p = new Promise(r => resolve = r);
+
+            async function af() {
+                return await p;
+            }
+
+            af().then(result => {
+                echo(`Test #${index} - Success resumed with result = '${result}'`);
+            });
+            resolve("settled");
+        }
+    },
+    {
+        name: "Awaiting a promise of a subclass goes through its then",
+        body: function (index) {
+            class SubPromise extends Promise { }
+            var calls = 0;
+            SubPromise.prototype.then = function (onFulfilled, onRejected) {
+                calls++;
+                return Promise.prototype.then.call(this, onFulfilled, onRejected);
+            };
+
+            async function af() {
+                return await SubPromise.resolve("sub");
+            }
+
+            af().then(result => {
+                echo(`Test #${index} - Success resumed with result = '${result}' after ${calls} call(s) to then`);
+            });
+        }
+    },
+];
+
+var index = 1;
+
+function runTest(test) {
+    echo('Executing test #' + index + ' - ' + test.name);
+
+    try {
+        test.body(index);
+    } catch(e) {
+        echo('Caught exception: ' + e);
+    }
+
+    index++;
+}
+
+tests.forEach(runTest);
+
+echo('\nCompletion Results:');
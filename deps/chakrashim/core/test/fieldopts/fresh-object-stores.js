@@ -0,0 +1,63 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Stores into objects that were just allocated skip the write barrier in the JIT. Keep the
+// garbage collector busy while the stored values are only reachable through such objects,
+// and check that none of them got collected.
+
+var old = [];
+for (var i = 0; i < 64; i++)
+{
+    old.push({ value: "old" + i });
+}
+
+function makeEmpty(i)
+{
+    var o = {};
+    o.a = old[i & 63];
+    o.b = "b" + i;
+    o.c = { value: i };
+    return o;
+}
+
+function makeLiteral(i)
+{
+    var o = { a: null, b: null, c: null };
+    o.a = old[i & 63];
+    o.b = "b" + i;
+    o.c = { value: i };
+    return o;
+}
+
+function check(o, i)
+{
+    return o.a.value === "old" + (i & 63) && o.b === "b" + i && o.c.value === i;
+}
+
+var kept = [];
+var passed = true;
+for (var i = 0; i < 100000; i++)
+{
+    var o = (i & 1) ? makeEmpty(i) : makeLiteral(i);
+    kept[i % 1000] = o;
+    if (i % 1000 === 999)
+    {
+        for (var j = 0; j < 1000; j++)
+        {
+            passed = passed && check(kept[j], i - 999 + j);
+        }
+    }
+    // Replace the old objects now and then, so that the only references left to them are
+    // the ones stored in the fresh objects.
+    if (i % 4096 === 0)
+    {
+        for (var k = 0; k < 64; k++)
+        {
+            old[k] = { value: "old" + k };
+        }
+    }
+}
+
+WScript.Echo(passed ? "pass" : "fail");
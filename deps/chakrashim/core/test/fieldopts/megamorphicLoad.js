@@ -0,0 +1,68 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// A load site that sees more types than its polymorphic inline cache holds.
+
+function assert(actual, expected, message) {
+    if (actual !== expected) {
+        throw new Error(message + ": expected " + expected + " but got " + actual);
+    }
+}
+
+function makeObjects(global) {
+    var objects = [];
+    for (var i = 0; i < 80; i++) {
+        var o = new global.Object();
+        // Give each object a different shape, and put x in the aux slots for half of them
+        for (var j = 0; j < (i % 40); j++) {
+            o["p" + i + "_" + j] = j;
+        }
+        o.x = i;
+        objects.push(o);
+    }
+    return objects;
+}
+
+function loadX(o) {
+    return o.x;
+}
+
+function sumX(objects) {
+    var sum = 0;
+    for (var i = 0; i < objects.length; i++) {
+        sum += loadX(objects[i]);
+    }
+    return sum;
+}
+
+var objects = makeObjects(this);
+var expected = 79 * 80 / 2;
+for (var k = 0; k < 100; k++) {
+    assert(sumX(objects), expected, "sum");
+}
+
+// Redefining x as an accessor on a single object must not be missed
+Object.defineProperty(objects[3], "x", { get: function () { return 1003; } });
+assert(sumX(objects), expected + 1000, "accessor");
+
+// Deleting and re-adding x moves it to another slot
+delete objects[5].x;
+objects[5].y = "y";
+objects[5].x = 1005;
+assert(sumX(objects), expected + 1000 + 1000, "delete");
+
+// Objects from another script context are loaded through the helper
+var other = WScript.LoadScript("", "samethread");
+var otherObjects = makeObjects(other);
+for (var k = 0; k < 10; k++) {
+    assert(sumX(otherObjects), expected, "cross context");
+    assert(sumX(objects), expected + 2000, "after cross context");
+}
+
+// Entries are dropped on GC
+CollectGarbage();
+assert(sumX(makeObjects(this)), expected, "after GC");
+
+WScript.Echo("PASSED");
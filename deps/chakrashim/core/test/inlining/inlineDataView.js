@@ -0,0 +1,102 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+function assert(actual, expected)
+{
+    if (actual !== expected)
+    {
+        throw new Error("failed test Actual: " + actual + " Expected: " + expected);
+    }
+}
+
+function encode(view, n)
+{
+    var offset = 0;
+    for (var i = 0; i < n; i++)
+    {
+        view.setUint8(offset, i & 0xff);
+        view.setInt16(offset + 1, -i, true);
+        view.setUint32(offset + 3, i * 0x10001);
+        view.setFloat64(offset + 7, i + 0.5, true);
+        offset += 15;
+    }
+}
+
+function decode(view, n)
+{
+    var sum = 0;
+    var offset = 0;
+    for (var i = 0; i < n; i++)
+    {
+        sum += view.getUint8(offset);
+        sum += view.getInt16(offset + 1, true);
+        sum += view.getUint32(offset + 3) - i * 0x10001;
+        sum += view.getFloat64(offset + 7, true);
+        offset += 15;
+    }
+    return sum;
+}
+
+function expectedSum(n)
+{
+    var sum = 0;
+    for (var i = 0; i < n; i++)
+    {
+        sum += (i & 0xff) - i + i + 0.5;
+    }
+    return sum;
+}
+
+var view = new DataView(new ArrayBuffer(15 * 100));
+for (var j = 0; j < 20; j++)
+{
+    encode(view, 100);
+    assert(decode(view, 100), expectedSum(100));
+}
+
+// Big endian is the default
+view.setUint32(0, 0x01020304);
+assert(view.getUint8(0), 1);
+assert(view.getUint32(0, true), 0x04030201);
+
+function readInt32(view, offset)
+{
+    return view.getInt32(offset);
+}
+
+for (var j = 0; j < 20; j++)
+{
+    assert(readInt32(view, 0), 0x01020304);
+}
+
+// Out of range offsets must still throw from the inlined call
+var threw = false;
+try
+{
+    readInt32(view, view.byteLength - 2);
+}
+catch (e)
+{
+    threw = e instanceof RangeError;
+}
+assert(threw, true);
+
+// A receiver that is not a DataView must still throw from the inlined call
+threw = false;
+try
+{
+    readInt32({ getInt32: DataView.prototype.getInt32 }, 0);
+}
+catch (e)
+{
+    threw = e instanceof TypeError;
+}
+assert(threw, true);
+
+// Replacing the built-in must be observed by code that inlined it
+DataView.prototype.getInt32 = function (offset) { return "replaced " + offset; };
+assert(readInt32(view, 4), "replaced 4");
+
+WScript.Echo("PASSED");
@@ -0,0 +1,72 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+function assert(actual, expected)
+{
+    if (actual !== expected)
+    {
+        throw new Error("failed test Actual: " + actual + " Expected: " + expected);
+    }
+}
+
+function lookups(map, set, n)
+{
+    var hits = 0;
+    for (var i = 0; i < n; i++)
+    {
+        map.set(i, i * 2);
+        if (map.has(i) && set.has(i & 7))
+        {
+            hits += map.get(i);
+        }
+    }
+    return hits;
+}
+
+function expectedHits(n)
+{
+    var hits = 0;
+    for (var i = 0; i < n; i++)
+    {
+        hits += (i & 7) < 4 ? i * 2 : 0;
+    }
+    return hits;
+}
+
+var set = new Set([0, 1, 2, 3]);
+for (var j = 0; j < 20; j++)
+{
+    assert(lookups(new Map(), set, 100), expectedHits(100));
+}
+
+function getOrThrow(map, key)
+{
+    return map.get(key);
+}
+
+var map = new Map([["a", 1]]);
+for (var j = 0; j < 20; j++)
+{
+    assert(getOrThrow(map, "a"), 1);
+    assert(getOrThrow(map, "b"), undefined);
+}
+
+// A receiver that is not a Map must still throw from the inlined call
+var threw = false;
+try
+{
+    getOrThrow({ get: Map.prototype.get }, "a");
+}
+catch (e)
+{
+    threw = e instanceof TypeError;
+}
+assert(threw, true);
+
+// Replacing the built-in must be observed by code that inlined it
+Map.prototype.get = function (key) { return "replaced " + key; };
+assert(getOrThrow(map, "a"), "replaced a");
+
+WScript.Echo("PASSED");
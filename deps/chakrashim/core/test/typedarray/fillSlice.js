@@ -0,0 +1,93 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Verifies %TypedArray%.prototype.fill and slice, which fill and copy the elements directly
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+var TypedArrayCtors = [
+    Int8Array,
+    Uint8Array,
+    Uint8ClampedArray,
+    Int16Array,
+    Uint16Array,
+    Int32Array,
+    Uint32Array,
+    Float32Array,
+    Float64Array
+];
+
+var tests = [
+    {
+        name: "fill converts the value to the element type",
+        body: function () {
+            for (var ctor of TypedArrayCtors) {
+                var ta = new ctor(8);
+                var expected = new ctor(1);
+                expected[0] = 300.7;
+                ta.fill(300.7, 2, 6);
+                for (var i = 0; i < ta.length; i++) {
+                    assert.areEqual(i >= 2 && i < 6 ? expected[0] : 0, ta[i], ctor.name + " element " + i);
+                }
+            }
+
+            var f64 = new Float64Array(4).fill(-0);
+            assert.areEqual(-Infinity, 1 / f64[3], "fill keeps negative zero");
+            assert.isTrue(isNaN(new Float32Array(3).fill("abc")[2]), "fill with a non-numeric string stores NaN");
+        }
+    },
+    {
+        name: "fill converts the value once, before the indices",
+        body: function () {
+            var log = [];
+            var value = { valueOf: function () { log.push("value"); return 7; } };
+            var start = { valueOf: function () { log.push("start"); return 1; } };
+            var ta = new Int16Array(5).fill(value, start);
+            assert.areEqual("value,start", log.join(), "conversion order");
+            assert.areEqual("0,7,7,7,7", ta.join(), "filled elements");
+        }
+    },
+    {
+        name: "fill throws when the buffer is detached by the indices",
+        body: function () {
+            var ta = new Uint8Array(16);
+            var start = { valueOf: function () { ArrayBuffer.detach(ta.buffer); return 0; } };
+            assert.throws(function () { ta.fill(1, start); }, TypeError, "detached buffer");
+        }
+    },
+    {
+        name: "slice copies elements of the same type",
+        body: function () {
+            for (var ctor of TypedArrayCtors) {
+                var ta = new ctor([1, 2, 3, 4, 5, 6]);
+                var sliced = ta.slice(1, -1);
+                assert.areEqual(ctor, sliced.constructor, ctor.name + " constructor");
+                assert.areEqual("2,3,4,5", sliced.join(), ctor.name + " slice");
+                sliced[0] = 42;
+                assert.areEqual(2, ta[1], ctor.name + " slice doesn't share the buffer");
+            }
+        }
+    },
+    {
+        name: "slice through a species constructor",
+        body: function () {
+            var ta = new Float64Array([1.5, 2.5, 3.5]);
+            ta.constructor = {};
+            ta.constructor[Symbol.species] = Int8Array;
+            assert.areEqual("1,2", ta.slice(0, 2).join(), "elements are converted to the species type");
+
+            ta.constructor[Symbol.species] = function (length) {
+                var view = new Float64Array(ta.buffer);
+                return view;
+            };
+            var sliced = ta.slice(1);
+            assert.areEqual("2.5,3.5,3.5", sliced.join(), "slice into the same buffer");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
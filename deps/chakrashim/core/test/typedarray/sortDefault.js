@@ -0,0 +1,148 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Verifies %TypedArray%.prototype.sort without a comparer, which sorts large arrays directly on the element bits
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+var TypedArrayCtors = [
+    Int8Array,
+    Uint8Array,
+    Uint8ClampedArray,
+    Int16Array,
+    Uint16Array,
+    Int32Array,
+    Uint32Array,
+    Float32Array,
+    Float64Array
+];
+
+// Small enough for the comparison sort, and large enough for the direct sort
+var lengths = [0, 1, 2, 10, 255, 256, 257, 5000];
+
+var seed = 7;
+function random() {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed / 2147483648;
+}
+
+// The default order: numeric, -0 before +0, NaN last
+function defaultCompare(x, y) {
+    if (x !== x) {
+        return y !== y ? 0 : 1;
+    }
+    if (y !== y) {
+        return -1;
+    }
+    if (x < y) {
+        return -1;
+    }
+    if (x > y) {
+        return 1;
+    }
+    if (x === 0 && y === 0) {
+        return (1 / x < 0 ? -1 : 0) - (1 / y < 0 ? -1 : 0);
+    }
+    return 0;
+}
+
+function fillRandom(ta, isFloat) {
+    for (var i = 0; i < ta.length; i++) {
+        var r = random();
+        if (!isFloat) {
+            ta[i] = (r - 0.5) * 4294967296;
+        } else if (r < 0.05) {
+            ta[i] = NaN;
+        } else if (r < 0.1) {
+            ta[i] = -0;
+        } else if (r < 0.15) {
+            ta[i] = 0;
+        } else if (r < 0.2) {
+            ta[i] = r < 0.175 ? Infinity : -Infinity;
+        } else {
+            ta[i] = (r - 0.6) * 1e6;
+        }
+    }
+}
+
+function assertSameElements(expected, actual, msg) {
+    assert.areEqual(expected.length, actual.length, msg + ": length");
+    for (var i = 0; i < expected.length; i++) {
+        if (!Object.is(expected[i], actual[i])) {
+            assert.fail(msg + ": element " + i + " is " + actual[i] + ", expected " + expected[i]);
+        }
+    }
+}
+
+var tests = [
+    {
+        name: "Sorting without a comparer matches the default order",
+        body: function () {
+            TypedArrayCtors.forEach(function (TypedArray) {
+                var isFloat = TypedArray === Float32Array || TypedArray === Float64Array;
+                lengths.forEach(function (length) {
+                    var ta = new TypedArray(length);
+                    fillRandom(ta, isFloat);
+                    var expected = Array.prototype.slice.call(ta).sort(defaultCompare);
+                    assert.areEqual(ta, ta.sort(), "sort returns the typed array");
+                    assertSameElements(expected, ta, TypedArray.name + " of length " + length);
+                });
+            });
+        }
+    },
+    {
+        name: "Sorting already sorted, reversed and constant arrays",
+        body: function () {
+            TypedArrayCtors.forEach(function (TypedArray) {
+                var ta = new TypedArray(1000);
+                for (var i = 0; i < ta.length; i++) {
+                    ta[i] = i - 500;
+                }
+                var expected = Array.prototype.slice.call(ta).sort(defaultCompare);
+                assertSameElements(expected, ta.slice().sort(), TypedArray.name + " sorted");
+                assertSameElements(expected, ta.slice().reverse().sort(), TypedArray.name + " reversed");
+
+                ta.fill(3);
+                assertSameElements(Array.prototype.slice.call(ta), ta.sort(), TypedArray.name + " constant");
+            });
+        }
+    },
+    {
+        name: "Sorting a subarray only moves the elements of the view",
+        body: function () {
+            var buffer = new Float64Array(1000);
+            for (var i = 0; i < buffer.length; i++) {
+                buffer[i] = buffer.length - i;
+            }
+            var view = buffer.subarray(100, 900);
+            var expected = Array.prototype.slice.call(view).sort(defaultCompare);
+            view.sort();
+            assertSameElements(expected, view, "subarray");
+            assert.areEqual(1000, buffer[0], "before the view");
+            assert.areEqual(1, buffer[999], "after the view");
+        }
+    },
+    {
+        name: "NaN payloads are kept",
+        body: function () {
+            var f64 = new Float64Array(600);
+            var bits = new Uint32Array(f64.buffer);
+            for (var i = 0; i < f64.length; i++) {
+                f64[i] = 600 - i;
+            }
+            // A negative quiet NaN with a payload
+            bits[2 * 10] = 0x1234;
+            bits[2 * 10 + 1] = 0xFFF80000;
+            f64.sort();
+            assert.areEqual(1, f64[0], "smallest first");
+            assert.areEqual(0x1234, bits[2 * 599], "low bits of the NaN");
+            assert.areEqual(0xFFF80000 | 0, bits[2 * 599 + 1] | 0, "high bits of the NaN");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
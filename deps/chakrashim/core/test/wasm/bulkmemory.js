@@ -0,0 +1,139 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+/* global assert,testRunner */ // eslint rule
+WScript.Flag("-WasmBulkMemory");
+WScript.LoadScriptFile("../UnitTestFramework/UnitTestFramework.js");
+
+// The wast to wasm converter doesn't know the bulk memory operators yet, so the module is encoded by hand
+// (module
+//   (memory (export "mem") 1)
+//   (func (export "copy") (param i32 i32 i32) (memory.copy (get_local 0) (get_local 1) (get_local 2)))
+//   (func (export "fill") (param i32 i32 i32) (memory.fill (get_local 0) (get_local 1) (get_local 2)))
+// )
+function section(id, bytes) {
+  return [id, bytes.length, ...bytes];
+}
+
+function exportName(name) {
+  return [name.length, ...Array.from(name, c => c.charCodeAt(0))];
+}
+
+function body(bytes) {
+  return [bytes.length + 1, 0 /* no locals */, ...bytes];
+}
+
+const getArgs = [0x20, 0, 0x20, 1, 0x20, 2];
+const moduleBytes = new Uint8Array([
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+  ...section(1, [1, 0x60, 3, 0x7f, 0x7f, 0x7f, 0]),
+  ...section(3, [2, 0, 0]),
+  ...section(5, [1, 0, 1]),
+  ...section(7, [3,
+    ...exportName("mem"), 2, 0,
+    ...exportName("copy"), 0, 0,
+    ...exportName("fill"), 0, 1]),
+  ...section(10, [2,
+    ...body([...getArgs, 0xfc, 0x0a, 0, 0, 0x0b]),
+    ...body([...getArgs, 0xfc, 0x0b, 0, 0x0b])]),
+]);
+
+const {exports: {mem, copy, fill}} = new WebAssembly.Instance(new WebAssembly.Module(moduleBytes));
+const view = new Uint8Array(mem.buffer);
+const memSize = view.length;
+
+function reset() {
+  for (let i = 0; i < 32; ++i) {
+    view[i] = i;
+  }
+  view.fill(0, 32, 64);
+}
+
+function assertRange(start, expected, msg) {
+  for (let i = 0; i < expected.length; ++i) {
+    assert.areEqual(expected[i], view[start + i], `${msg}: mem[${start + i}]`);
+  }
+}
+
+function assertTraps(fn, msg) {
+  assert.throws(fn, WebAssembly.RuntimeError, msg);
+}
+
+// Run each operation enough times for the function to be jitted
+const iterations = 50;
+
+const tests = [
+  {
+    name: "memory.fill",
+    body() {
+      for (let i = 0; i < iterations; ++i) {
+        reset();
+        fill(4, 0xAB, 8);
+        assertRange(0, [0, 1, 2, 3, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 12], "fill");
+        // Only the low byte of the value is used
+        fill(40, 0x1234, 2);
+        assertRange(39, [0, 0x34, 0x34, 0], "fill value truncated");
+        fill(memSize - 1, 7, 1);
+        assert.areEqual(7, view[memSize - 1], "fill last byte");
+        fill(memSize, 7, 0);
+      }
+    }
+  },
+  {
+    name: "memory.copy",
+    body() {
+      for (let i = 0; i < iterations; ++i) {
+        reset();
+        copy(32, 0, 8);
+        assertRange(32, [0, 1, 2, 3, 4, 5, 6, 7, 0], "copy");
+        // Overlapping ranges behave like memmove
+        copy(2, 0, 6);
+        assertRange(0, [0, 1, 0, 1, 2, 3, 4, 5, 8], "overlapping copy forward");
+        reset();
+        copy(0, 2, 6);
+        assertRange(0, [2, 3, 4, 5, 6, 7, 6, 7], "overlapping copy backward");
+        copy(memSize - 4, 0, 4);
+        assertRange(memSize - 4, [2, 3, 4, 5], "copy to the end of memory");
+        copy(memSize, memSize, 0);
+      }
+    }
+  },
+  {
+    name: "out of bounds traps without writing",
+    body() {
+      for (let i = 0; i < iterations; ++i) {
+        reset();
+        assertTraps(() => fill(memSize - 2, 0xFF, 4), "fill past the end");
+        assert.areEqual(0, view[memSize - 2], "partial fill");
+        assertTraps(() => fill(memSize + 1, 0xFF, 0), "empty fill past the end");
+        assertTraps(() => fill(-1, 0xFF, 1), "fill at 4GB");
+
+        assertTraps(() => copy(0, memSize - 2, 4), "copy from past the end");
+        assert.areEqual(0, view[0], "partial copy in");
+        view[memSize - 4] = 0;
+        assertTraps(() => copy(memSize - 4, 0, 8), "copy to past the end");
+        assert.areEqual(0, view[memSize - 4], "partial copy out");
+        assertTraps(() => copy(0, memSize + 1, 0), "empty copy from past the end");
+        assertTraps(() => copy(-1, 0, 2), "copy wrapping around");
+      }
+    }
+  },
+];
+
+WScript.LoadScriptFile("../UnitTestFramework/yargs.js");
+const argv = yargsParse(WScript.Arguments, {
+  boolean: ["verbose"],
+  number: ["start", "end"],
+  default: {
+    verbose: true,
+    start: 0,
+    end: tests.length
+  }
+}).argv;
+
+const todoTests = tests
+  .slice(argv.start, argv.end);
+
+testRunner.run(todoTests, {verbose: argv.verbose});
@@ -137,6 +137,13 @@ class Platform {
   virtual std::shared_ptr<v8::TaskRunner> GetForegroundTaskRunner(
       Isolate* isolate) = 0;
   virtual void CallOnWorkerThread(std::unique_ptr<Task> task) = 0;
+  // Embedders may run these ahead of, or after, other worker thread tasks.
+  virtual void CallBlockingTaskOnWorkerThread(std::unique_ptr<Task> task) {
+    CallOnWorkerThread(std::move(task));
+  }
+  virtual void CallLowPriorityTaskOnWorkerThread(std::unique_ptr<Task> task) {
+    CallOnWorkerThread(std::move(task));
+  }
   virtual void CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                          double delay_in_seconds) = 0;
   virtual void CallOnForegroundThread(Isolate* isolate, Task* task) = 0;
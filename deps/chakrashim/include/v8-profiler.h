@@ -27,22 +27,213 @@
 
 #pragma once
 #include <v8.h>
+#include <vector>
 
 namespace v8 {
 
 struct HeapStatsUpdate;
 
-// NOT IMPLEMENTED
+/**
+ * CpuProfileNode represents a node in a call graph.
+ */
+class V8_EXPORT CpuProfileNode {
+ public:
+  struct LineTick {
+    /** The 1-based number of the source line where the function originates. */
+    int line;
+
+    /** The count of samples associated with the source line. */
+    unsigned int hit_count;
+  };
+
+  /** Returns function name (empty string for anonymous functions.) */
+  Local<String> GetFunctionName() const;
+
+  /**
+   * Returns function name (empty string for anonymous functions.)
+   * The string ownership is *not* passed to the caller. It stays valid until
+   * profile is deleted.
+   */
+  const char* GetFunctionNameStr() const;
+
+  /** Returns id of the script where function is located. */
+  int GetScriptId() const;
+
+  /** Returns resource name for script from where the function originates. */
+  Local<String> GetScriptResourceName() const;
+
+  /**
+   * Returns resource name for script from where the function originates.
+   * The string ownership is *not* passed to the caller. It stays valid until
+   * profile is deleted.
+   */
+  const char* GetScriptResourceNameStr() const;
+
+  /**
+   * Returns the number, 1-based, of the line where the function originates.
+   * kNoLineNumberInfo if no line number information is available.
+   */
+  int GetLineNumber() const;
+
+  /**
+   * Returns 1-based number of the column where the function originates.
+   * kNoColumnNumberInfo if no column number information is available.
+   */
+  int GetColumnNumber() const;
+
+  /**
+   * Returns the number of the function's source lines that collect the samples.
+   */
+  unsigned int GetHitLineCount() const;
+
+  /** Returns the set of source lines that collect the samples.
+   *  The caller allocates buffer and responsible for releasing it.
+   *  True if all available entries are copied, otherwise false.
+   *  The function copies nothing if buffer is not large enough.
+   */
+  bool GetLineTicks(LineTick* entries, unsigned int length) const;
+
+  /** Chakra doesn't report why a function wasn't optimized; always "". */
+  const char* GetBailoutReason() const;
+
+  /**
+    * Returns the count of samples where the function was currently executing.
+    */
+  unsigned GetHitCount() const;
+
+  /** Returns id of the node. The id is unique within the tree */
+  unsigned GetNodeId() const;
+
+  /** Returns child nodes count of the node. */
+  int GetChildrenCount() const;
+
+  /** Retrieves a child node by index. */
+  const CpuProfileNode* GetChild(int index) const;
+
+  static const int kNoLineNumberInfo = Message::kNoLineNumberInfo;
+  static const int kNoColumnNumberInfo = Message::kNoColumnInfo;
+};
+
+/**
+ * CpuProfile contains a CPU profile in a form of top-down call tree
+ * (from main() down to functions that do all the work).
+ */
+class V8_EXPORT CpuProfile {
+ public:
+  /** Returns CPU profile title. */
+  Local<String> GetTitle() const;
+
+  /** Returns the root node of the top down call tree. */
+  const CpuProfileNode* GetTopDownRoot() const;
+
+  /**
+   * Returns number of samples recorded. The samples are not recorded unless
+   * |record_samples| parameter of CpuProfiler::StartCpuProfiling is true.
+   */
+  int GetSamplesCount() const;
+
+  /**
+   * Returns profile node corresponding to the top frame the sample at
+   * the given index.
+   */
+  const CpuProfileNode* GetSample(int index) const;
+
+  /**
+   * Returns the timestamp of the sample, in microseconds on the uv_hrtime()
+   * clock.
+   */
+  int64_t GetSampleTimestamp(int index) const;
+
+  /** Returns time when the profile recording was started (in microseconds). */
+  int64_t GetStartTime() const;
+
+  /** Returns time when the profile recording was stopped (in microseconds). */
+  int64_t GetEndTime() const;
+
+  /**
+   * Deletes the profile. All pointers to nodes previously returned become
+   * invalid.
+   */
+  void Delete();
+};
+
+enum CpuProfilingMode {
+  // In the resulting CpuProfile tree, intermediate nodes in a stack trace
+  // (from the root to a leaf) will have line numbers that point to the start
+  // line of the function, rather than the line of the callsite of the child.
+  kLeafNodeLineNumbers,
+  // In the resulting CpuProfile tree, nodes are separated based on the line
+  // number of their callsite in their parent.
+  kCallerLineNumbers,
+};
+
+/**
+ * Interface for controlling CPU profiling.
+ *
+ * Chakra can't interrupt a running thread to walk its stack, so a timer
+ * thread requests a sample every sampling interval and the engine takes it
+ * the next time script enters a function or calls into the host. Ticks where
+ * script didn't reach such a point are attributed to "(program)", or to
+ * "(idle)" while the embedder reported itself idle.
+ */
 class V8_EXPORT CpuProfiler {
  public:
-  // void SetSamplingInterval(int us);
-  // void StartProfiling(Handle<String> title, bool record_samples = false);
-  // CpuProfile* StopProfiling(Handle<String> title);
-  void SetIdle(bool is_idle) {}
-  static CpuProfiler* New(Isolate* isolate) { return nullptr; };
-  void Dispose() {}
+  /**
+   * Creates a new CPU profiler for the |isolate|. The profiler object must be
+   * disposed after use by calling |Dispose| method. Only one profiler per
+   * isolate can be recording at a time.
+   */
+  static CpuProfiler* New(Isolate* isolate);
+
+  /**
+   * Requests a sample in the profiler of the |isolate| that is recording.
+   * The sample is taken at the next safe point of the running script.
+   */
+  static void CollectSample(Isolate* isolate);
+
+  /**
+   * Disposes the CPU profiler object.
+   */
+  void Dispose();
+
+  /**
+   * Changes default CPU profiler sampling interval to the specified number
+   * of microseconds. Default interval is 1000us. This method must be called
+   * when there are no profiles being recorded.
+   */
+  void SetSamplingInterval(int us);
+
+  /**
+   * Starts collecting CPU profile. Title may be an empty string. It
+   * is allowed to have several profiles being collected at
+   * once. Attempts to start collecting several profiles with the same
+   * title are silently ignored.
+   *
+   * |record_samples| parameter controls whether individual samples should
+   * be recorded in addition to the aggregated tree.
+   */
+  void StartProfiling(Local<String> title, CpuProfilingMode mode,
+                      bool record_samples = false);
+  void StartProfiling(Local<String> title, bool record_samples = false);
+
+  /**
+   * Stops collecting CPU profile with a given title and returns it.
+   * If the title given is empty, finishes the last profile started.
+   */
+  CpuProfile* StopProfiling(Local<String> title);
+
+  /**
+   * Tells the profiler whether the embedder is idle.
+   */
+  void SetIdle(bool is_idle);
 
   static void UseDetailedSourcePositionsForProfiling(Isolate* isolate) {}
+
+ private:
+  CpuProfiler();
+  ~CpuProfiler();
+  CpuProfiler(const CpuProfiler&);
+  CpuProfiler& operator=(const CpuProfiler&);
 };
 
 class V8_EXPORT OutputStream {  // NOLINT
@@ -60,7 +251,8 @@ class V8_EXPORT OutputStream {  // NOLINT
   }
 };
 
-// NOT IMPLEMENTED
+// Only serialization is implemented. The heap is walked when the snapshot is
+// serialized, see JsTakeRuntimeHeapSnapshot.
 class V8_EXPORT HeapSnapshot {
  public:
   enum SerializationFormat {
@@ -69,7 +261,13 @@ class V8_EXPORT HeapSnapshot {
 
   void Delete() { delete this; }
   void Serialize(OutputStream* stream,
-                 SerializationFormat format = kJSON) const {}
+                 SerializationFormat format = kJSON) const;
+
+ private:
+  friend class HeapProfiler;
+  explicit HeapSnapshot(Isolate* isolate) : isolate_(isolate) {}
+
+  Isolate* isolate_;
 };
 
 class V8_EXPORT ActivityControl {  // NOLINT
@@ -108,9 +306,96 @@ class V8_EXPORT EmbedderGraph {
   virtual ~EmbedderGraph() = default;
 };
 
-// NOT IMPLEMENTED
+/**
+ * Represents the sampled allocations that are still live, as a call tree.
+ */
+class V8_EXPORT AllocationProfile {
+ public:
+  struct Allocation {
+    /**
+     * Size of the sampled allocation object.
+     */
+    size_t size;
+
+    /**
+     * The number of objects of such size that were sampled.
+     */
+    unsigned int count;
+  };
+
+  /**
+   * Represents a node in the call-graph.
+   */
+  struct Node {
+    /**
+     * Name of the function. May be empty for anonymous functions.
+     */
+    Local<String> name;
+
+    /**
+     * Name of the script containing the function. May be empty if the script
+     * name is not available.
+     */
+    Local<String> script_name;
+
+    /**
+     * id of the script where the function is located. May be equal to
+     * v8::UnboundScript::kNoScriptId for the root node.
+     */
+    int script_id;
+
+    /**
+     * Start position of the function in the script. Not reported by
+     * ChakraCore, always 0.
+     */
+    int start_position;
+
+    /**
+     * 1-indexed line number where the function starts. May be
+     * kNoLineNumberInfo if no line number information is available.
+     */
+    int line_number;
+
+    /**
+     * 1-indexed column number where the function starts. May be
+     * kNoColumnNumberInfo if no line number information is available.
+     */
+    int column_number;
+
+    /**
+     * List of callees called from this node for which we have sampled
+     * allocations. The lifetime of the children is scoped to the containing
+     * AllocationProfile.
+     */
+    std::vector<Node*> children;
+
+    /**
+     * List of self allocations done by this node in the call-graph.
+     */
+    std::vector<Allocation> allocations;
+  };
+
+  /**
+   * Returns the root node of the call-graph. The root node corresponds to an
+   * empty JS call-stack. The lifetime of the returned Node* is scoped to the
+   * containing AllocationProfile.
+   */
+  virtual Node* GetRootNode() = 0;
+
+  virtual ~AllocationProfile() {}
+
+  static const int kNoLineNumberInfo = Message::kNoLineNumberInfo;
+  static const int kNoColumnNumberInfo = Message::kNoColumnInfo;
+};
+
+// Heap snapshots and the sampling heap profiler are implemented
 class V8_EXPORT HeapProfiler {
  public:
+  enum SamplingFlags {
+    kSamplingNoFlags = 0,
+    kSamplingForceGC = 1 << 0,
+  };
+
   typedef RetainedObjectInfo *(*WrapperInfoCallback)(
     uint16_t class_id, Handle<Value> wrapper);
 
@@ -124,14 +409,37 @@ class V8_EXPORT HeapProfiler {
 
   const HeapSnapshot* TakeHeapSnapshot(
       ActivityControl* control = NULL,
-      ObjectNameResolver* global_object_name_resolver = NULL) {
-    return new HeapSnapshot();
-  }
+      ObjectNameResolver* global_object_name_resolver = NULL);
 
   void SetWrapperClassInfoProvider(
     uint16_t class_id, WrapperInfoCallback callback) {}
   void StartTrackingHeapObjects(bool track_allocations = false) {}
 
+  /**
+   * Starts gathering a sampling heap profile. Allocations are sampled using a
+   * randomized Poisson process, on average one allocation every
+   * |sample_interval| bytes allocated. At most |stack_depth| of the innermost
+   * frames are kept for each sample.
+   *
+   * Returns false if a sampling heap profiler is already running.
+   */
+  bool StartSamplingHeapProfiler(uint64_t sample_interval = 512 * 1024,
+                                 int stack_depth = 16,
+                                 SamplingFlags flags = kSamplingNoFlags);
+
+  /**
+   * Stops the sampling heap profile and discards the current profile.
+   */
+  void StopSamplingHeapProfiler();
+
+  /**
+   * Returns the sampled profile of allocations allocated (and still live) since
+   * StartSamplingHeapProfiler was called. The ownership of the pointer is
+   * transferred to the caller. Returns nullptr if sampling heap profiler is not
+   * active.
+   */
+  AllocationProfile* GetAllocationProfile();
+
   typedef void (*BuildEmbedderGraphCallback)(v8::Isolate* isolate,
                                              v8::EmbedderGraph* graph,
                                              void* data);
@@ -99,7 +99,9 @@ class PropertyDescriptor;
 }
 
 namespace jsrt {
+class HandleStack;
 class IsolateShim;
+class ScriptStreamingData;
 
 JsErrorCode CreateV8PropertyDescriptor(JsValueRef descriptor,
   v8::PropertyDescriptor* result);
@@ -363,6 +365,7 @@ class Local {
   friend class RegExp;
   friend class Promise;
   friend class Set;
+  friend class SharedArrayBuffer;
   friend class Signature;
   friend class Script;
   friend class StackFrame;
@@ -376,6 +379,8 @@ class Local {
   friend class TryCatch;
   friend class UnboundScript;
   friend class Value;
+  friend class ValueDeserializer;
+  friend class ValueSerializer;
   friend class JSON;
   friend class uvimpl::Work;
   friend JsErrorCode jsrt::CreateV8PropertyDescriptor(
@@ -536,6 +541,36 @@ V8_EXPORT void SetObjectWeakReferenceCallback(
 // A helper method for turning off the WeakReferenceCallback that was set using
 // the previous method
 V8_EXPORT void ClearObjectWeakReferenceCallback(JsValueRef object, bool revive);
+
+// Turns ChakraCore's per function loop body JIT, bailout and rejit statistics
+// of the isolate on or off, see JsSetRuntimeJitStatisticsEnabled. While they
+// are on, their events are also recorded as "v8" trace events.
+V8_EXPORT bool SetJitStatisticsEnabled(Isolate* isolate, bool enabled);
+// Calls the callback with the statistics of each function. Returns false if
+// the statistics are off.
+V8_EXPORT bool GetJitStatistics(Isolate* isolate,
+                                JsJitStatisticsCallback callback,
+                                void* callbackState,
+                                bool reset);
+// Calls the callback with each of the last bailouts, oldest first, and sets
+// |deoptCount| to the number of bailouts since the log was last reset. Returns
+// false if the statistics are off.
+V8_EXPORT bool GetDeoptLog(Isolate* isolate,
+                           JsJitDeoptLogCallback callback,
+                           void* callbackState,
+                           bool reset,
+                           unsigned int* deoptCount);
+// Releases the bytecode of the functions that did not run since the previous
+// check after a full collection, see JsRedeferRuntimeInactiveFunctions. Sets
+// |functionCount| and |freedBytes| when the call succeeds.
+V8_EXPORT bool RedeferInactiveFunctions(Isolate* isolate,
+                                        unsigned int* functionCount,
+                                        size_t* freedBytes);
+// Does idle GC work until |deadline_in_seconds|, on the same clock as
+// Isolate::IdleNotificationDeadline. Returns the milliseconds until more idle
+// work is worth doing, or -1 when there is nothing left to do until script
+// runs again.
+V8_EXPORT int IdleCollectGarbage(Isolate* isolate, double deadline_in_seconds);
 }  // namespace chakrashim
 
 enum class WeakCallbackType { kParameter, kInternalFields };
@@ -827,10 +862,14 @@ class V8_EXPORT HandleScope {
 
   HandleScope* _prev;
 
-  // Save some refs on stack. 1st element on stack
-  // is the JavascriptArray where other refs go.
-  JsValueRef _locals[kOnStackLocals + 1];
+  // Save some refs on stack. The others go to the isolate's handle stack,
+  // from _handleStackMark up.
+  JsValueRef _locals[kOnStackLocals];
   int _count;
+  jsrt::HandleStack* _handleStack;
+  JsValueRef* _handleStackMark;
+  // A value escaped to _prev, which gets it once this scope is gone
+  JsValueRef _escapedValue;
   JsContextRef _contextRef;
   struct AddRefRecord {
     JsRef _ref;
@@ -977,6 +1016,7 @@ class V8_EXPORT ScriptCompiler {
           rejected(false),
           buffer_policy(buffer_policy) {
     }
+    ~CachedData();
   };
 
   class Source {
@@ -1005,6 +1045,40 @@ class V8_EXPORT ScriptCompiler {
     CachedData* cached_data;
   };
 
+  class V8_EXPORT ExternalSourceStream {
+   public:
+    virtual ~ExternalSourceStream() {}
+
+    // Called on the streaming thread until it returns 0. The caller takes
+    // ownership of the data, which has to be allocated with new[].
+    virtual size_t GetMoreData(const uint8_t** src) = 0;
+
+    virtual bool SetBookmark() { return false; }
+    virtual void ResetToBookmark() {}
+  };
+
+  class V8_EXPORT StreamedSource {
+   public:
+    enum Encoding { ONE_BYTE, TWO_BYTE, UTF8 };
+
+    StreamedSource(ExternalSourceStream* source_stream, Encoding encoding);
+    ~StreamedSource();
+
+    jsrt::ScriptStreamingData* impl() const { return impl_.get(); }
+
+   private:
+    StreamedSource(const StreamedSource&) = delete;
+    StreamedSource& operator=(const StreamedSource&) = delete;
+
+    std::unique_ptr<jsrt::ScriptStreamingData> impl_;
+  };
+
+  class V8_EXPORT ScriptStreamingTask {
+   public:
+    virtual ~ScriptStreamingTask() {}
+    virtual void Run() = 0;
+  };
+
   enum CompileOptions {
     kNoCompileOptions = 0,
     kProduceParserCache,
@@ -1049,6 +1123,16 @@ class V8_EXPORT ScriptCompiler {
     Local<Context> context, Source* source,
     CompileOptions options = kNoCompileOptions);
 
+  // The returned task parses the script on whichever thread runs it, the
+  // embedder then calls Compile with the full source on the isolate's thread
+  static ScriptStreamingTask* StartStreamingScript(
+    Isolate* isolate, StreamedSource* source,
+    CompileOptions options = kNoCompileOptions);
+
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Script> Compile(
+    Local<Context> context, StreamedSource* source,
+    Local<String> full_source_string, const ScriptOrigin& origin);
+
   static uint32_t CachedDataVersionTag();
 
   static V8_WARN_UNUSED_RESULT MaybeLocal<Module> CompileModule(
@@ -1075,15 +1159,11 @@ class V8_EXPORT ScriptCompiler {
   static CachedData* CreateCodeCache(Local<UnboundScript> unbound_script,
                                      Local<String> source);
 
-  static CachedData* CreateCodeCacheForFunction(Local<Function> function) {
-    return nullptr;
-  }
+  static CachedData* CreateCodeCacheForFunction(Local<Function> function);
 
   V8_DEPRECATED("Source string is no longer required",
                 static CachedData* CreateCodeCacheForFunction(
-                    Local<Function> function, Local<String> source)) {
-    return nullptr;
-  }
+                    Local<Function> function, Local<String> source));
 };
 
 class V8_EXPORT Message {
@@ -1353,8 +1433,8 @@ class V8_EXPORT String : public Name {
                                   int options = NO_OPTIONS) const);
 
   static Local<String> Empty(Isolate* isolate);
-  bool IsExternal() const { return false; }
-  bool IsExternalOneByte() const { return false; }
+  bool IsExternal() const;
+  bool IsExternalOneByte() const;
 
   class V8_EXPORT ExternalOneByteStringResource {
    public:
@@ -1372,11 +1452,9 @@ class V8_EXPORT String : public Name {
     virtual void Dispose() { delete this; }
   };
 
-  ExternalStringResource* GetExternalStringResource() const { return nullptr; }
+  ExternalStringResource* GetExternalStringResource() const;
   const ExternalOneByteStringResource*
-    GetExternalOneByteStringResource() const {
-    return nullptr;
-  }
+    GetExternalOneByteStringResource() const;
 
   static String* Cast(v8::Value* obj);
 
@@ -2245,8 +2323,14 @@ class V8_EXPORT SharedArrayBuffer : public Object {
       Isolate* isolate, void* data, size_t byte_length,
       ArrayBufferCreationMode mode = ArrayBufferCreationMode::kExternalized);
   static SharedArrayBuffer* Cast(Value* obj);
+  bool IsExternal() const;
   Contents Externalize();
 
+  // CHAKRA: Chakra keeps ownership of the memory of a SharedArrayBuffer.
+  // Externalize() takes a reference on it, which the embedder gives back with
+  // ReleaseExternalized() instead of freeing the data.
+  static void ReleaseExternalized(void* data);
+
  private:
   SharedArrayBuffer();
 };
@@ -2363,7 +2447,7 @@ class V8_EXPORT JSON {
     Local<Context> context, Local<String> json_string);
 
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
-    Local<Context> context, Local<Object> json_object,
+    Local<Context> context, Local<Value> json_object,
     Local<String> gap = Local<String>());
 };
 
@@ -2401,6 +2485,9 @@ class V8_EXPORT ValueSerializer {
  private:
   ValueSerializer(const ValueSerializer&) = delete;
   void operator=(const ValueSerializer&) = delete;
+
+  struct PrivateData;
+  PrivateData* private_;
 };
 
 class V8_EXPORT ValueDeserializer {
@@ -2434,6 +2521,9 @@ class V8_EXPORT ValueDeserializer {
  private:
   ValueDeserializer(const ValueDeserializer&) = delete;
   void operator=(const ValueDeserializer&) = delete;
+
+  struct PrivateData;
+  PrivateData* private_;
 };
 
 enum AccessType {
@@ -2868,12 +2958,12 @@ class V8_EXPORT HeapStatistics {
 
 class V8_EXPORT HeapSpaceStatistics {
  public:
-  HeapSpaceStatistics() {}
-  const char* space_name() { return ""; }
-  size_t space_size() { return 0; }
-  size_t space_used_size() { return 0; }
-  size_t space_available_size() { return 0; }
-  size_t physical_space_size() { return 0; }
+  HeapSpaceStatistics();
+  const char* space_name() { return space_name_; }
+  size_t space_size() { return space_size_; }
+  size_t space_used_size() { return space_used_size_; }
+  size_t space_available_size() { return space_available_size_; }
+  size_t physical_space_size() { return physical_space_size_; }
 
  private:
   const char* space_name_;
@@ -2893,6 +2983,8 @@ typedef void* (*CreateHistogramCallback)(
 typedef void (*AddHistogramSampleCallback)(void* histogram, int sample);
 
 typedef void (*InterruptCallback)(Isolate* isolate, void* data);
+typedef size_t (*NearHeapLimitCallback)(void* data, size_t current_heap_limit,
+                                        size_t initial_heap_limit);
 
 class V8_EXPORT Isolate {
  public:
@@ -3050,6 +3142,10 @@ class V8_EXPORT Isolate {
     GCCallbackWithData callback, void* data = nullptr);
   void RemoveGCEpilogueCallback(GCCallback callback);
 
+  void AddNearHeapLimitCallback(NearHeapLimitCallback callback, void* data);
+  void RemoveNearHeapLimitCallback(NearHeapLimitCallback callback,
+                                   size_t heap_limit);
+
   void CancelTerminateExecution();
   void RequestInterrupt(InterruptCallback callback, void* data);
   void TerminateExecution();
@@ -3110,10 +3206,10 @@ class V8_EXPORT V8 {
   static bool IsExeuctionDisabled(Isolate* isolate = nullptr);
   static void CancelTerminateExecution(Isolate* isolate);
   static bool Dispose();
-  static void InitializePlatform(Platform* platform) {}
+  static void InitializePlatform(Platform* platform);
   static void FromJustIsNothing();
   static void ToLocalEmpty();
-  static void ShutdownPlatform() {}
+  static void ShutdownPlatform();
 };
 
 template <class T>
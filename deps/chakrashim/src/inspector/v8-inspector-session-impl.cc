@@ -11,7 +11,9 @@
 #include "src/inspector/v8-console-agent-impl.h"
 #include "src/inspector/v8-debugger-agent-impl.h"
 #include "src/inspector/v8-debugger.h"
+#include "src/inspector/v8-heap-profiler-agent-impl.h"
 #include "src/inspector/v8-inspector-impl.h"
+#include "src/inspector/v8-profiler-agent-impl.h"
 #include "src/inspector/v8-runtime-agent-impl.h"
 #include "src/inspector/v8-schema-agent-impl.h"
 #include "src/inspector/v8-timetravel-agent-impl.h"
@@ -30,6 +32,10 @@ bool V8InspectorSession::canDispatchMethod(const StringView& method) {
                               protocol::Console::Metainfo::commandPrefix) ||
          stringViewStartsWith(method,
                               protocol::Schema::Metainfo::commandPrefix) ||
+         stringViewStartsWith(method,
+                              protocol::HeapProfiler::Metainfo::commandPrefix) ||
+         stringViewStartsWith(method,
+                              protocol::Profiler::Metainfo::commandPrefix) ||
          stringViewStartsWith(method,
                               protocol::TimeTravel::Metainfo::commandPrefix);
 }
@@ -53,7 +59,9 @@ V8InspectorSessionImpl::V8InspectorSessionImpl(V8InspectorImpl* inspector,
       m_runtimeAgent(nullptr),
       m_debuggerAgent(nullptr),
       m_consoleAgent(nullptr),
-      m_schemaAgent(nullptr) {
+      m_schemaAgent(nullptr),
+      m_heapProfilerAgent(nullptr),
+      m_profilerAgent(nullptr) {
   if (savedState.length()) {
     std::unique_ptr<protocol::Value> state =
         protocol::parseJSON(toString16(savedState));
@@ -79,6 +87,15 @@ V8InspectorSessionImpl::V8InspectorSessionImpl(V8InspectorImpl* inspector,
       this, this, agentState(protocol::Schema::Metainfo::domainName)));
   protocol::Schema::Dispatcher::wire(&m_dispatcher, m_schemaAgent.get());
 
+  m_heapProfilerAgent = wrapUnique(new V8HeapProfilerAgentImpl(
+      this, this, agentState(protocol::HeapProfiler::Metainfo::domainName)));
+  protocol::HeapProfiler::Dispatcher::wire(&m_dispatcher,
+                                           m_heapProfilerAgent.get());
+
+  m_profilerAgent = wrapUnique(new V8ProfilerAgentImpl(
+      this, this, agentState(protocol::Profiler::Metainfo::domainName)));
+  protocol::Profiler::Dispatcher::wire(&m_dispatcher, m_profilerAgent.get());
+
   m_timeTravelAgent = wrapUnique(new V8TimeTravelAgentImpl(
       this, this, agentState(protocol::TimeTravel::Metainfo::domainName)));
   protocol::TimeTravel::Dispatcher::wire(&m_dispatcher,
@@ -88,11 +105,15 @@ V8InspectorSessionImpl::V8InspectorSessionImpl(V8InspectorImpl* inspector,
     m_runtimeAgent->restore();
     m_debuggerAgent->restore();
     m_consoleAgent->restore();
+    m_heapProfilerAgent->restore();
+    m_profilerAgent->restore();
   }
 }
 
 V8InspectorSessionImpl::~V8InspectorSessionImpl() {
   ErrorString errorString;
+  m_profilerAgent->disable(&errorString);
+  m_heapProfilerAgent->disable(&errorString);
   m_consoleAgent->disable(&errorString);
   m_debuggerAgent->disable(&errorString);
   m_runtimeAgent->disable(&errorString);
@@ -178,6 +199,14 @@ V8InspectorSessionImpl::supportedDomainsImpl() {
                        .setName(protocol::Schema::Metainfo::domainName)
                        .setVersion(protocol::Schema::Metainfo::version)
                        .build());
+  result.push_back(protocol::Schema::Domain::create()
+                       .setName(protocol::HeapProfiler::Metainfo::domainName)
+                       .setVersion(protocol::HeapProfiler::Metainfo::version)
+                       .build());
+  result.push_back(protocol::Schema::Domain::create()
+                       .setName(protocol::Profiler::Metainfo::domainName)
+                       .setVersion(protocol::Profiler::Metainfo::version)
+                       .build());
 
   if (m_timeTravelAgent->enabled()) {
     result.push_back(protocol::Schema::Domain::create()
@@ -19,7 +19,9 @@ namespace v8_inspector {
 class RemoteObjectIdBase;
 class V8ConsoleAgentImpl;
 class V8DebuggerAgentImpl;
+class V8HeapProfilerAgentImpl;
 class V8InspectorImpl;
+class V8ProfilerAgentImpl;
 class V8RuntimeAgentImpl;
 class V8SchemaAgentImpl;
 class V8TimeTravelAgentImpl;
@@ -37,6 +39,9 @@ class V8InspectorSessionImpl : public V8InspectorSession,
   V8InspectorImpl* inspector() const { return m_inspector; }
   V8ConsoleAgentImpl* consoleAgent() { return m_consoleAgent.get(); }
   V8DebuggerAgentImpl* debuggerAgent() { return m_debuggerAgent.get(); }
+  V8HeapProfilerAgentImpl* heapProfilerAgent() {
+    return m_heapProfilerAgent.get();
+  }
   V8SchemaAgentImpl* schemaAgent() { return m_schemaAgent.get(); }
   V8RuntimeAgentImpl* runtimeAgent() { return m_runtimeAgent.get(); }
   V8TimeTravelAgentImpl* timeTravelAgent() { return m_timeTravelAgent.get(); }
@@ -86,6 +91,8 @@ class V8InspectorSessionImpl : public V8InspectorSession,
   std::unique_ptr<V8DebuggerAgentImpl> m_debuggerAgent;
   std::unique_ptr<V8ConsoleAgentImpl> m_consoleAgent;
   std::unique_ptr<V8SchemaAgentImpl> m_schemaAgent;
+  std::unique_ptr<V8HeapProfilerAgentImpl> m_heapProfilerAgent;
+  std::unique_ptr<V8ProfilerAgentImpl> m_profilerAgent;
   std::unique_ptr<V8TimeTravelAgentImpl> m_timeTravelAgent;
 
   DISALLOW_COPY_AND_ASSIGN(V8InspectorSessionImpl);
@@ -0,0 +1,102 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "v8chakra.h"
+#include "jsrtbackgroundwork.h"
+#include <stdio.h>
+
+namespace v8 {
+extern unsigned int g_backgroundThreadCount;
+}
+
+namespace jsrt {
+
+BackgroundWorkPool* BackgroundWorkPool::s_pool = nullptr;
+
+BackgroundWorkPool::BackgroundWorkPool(unsigned int threadCount) {
+  uv_mutex_init(&mutex);
+  uv_cond_init(&workAvailable);
+
+  threads.reserve(threadCount);
+  for (unsigned int i = 0; i < threadCount; i++) {
+    uv_thread_t thread;
+    if (uv_thread_create(&thread, ThreadProc, this) != 0) {
+      break;
+    }
+    threads.push_back(thread);
+  }
+}
+
+/* static */
+void BackgroundWorkPool::Initialize() {
+  BackgroundWorkPool* pool =
+    new BackgroundWorkPool(v8::g_backgroundThreadCount);
+  if (pool->threads.empty()) {
+    // Runtimes fall back to threads of their own
+    fprintf(stderr, "Warning: Could not start background threads\n");
+    return;
+  }
+  s_pool = pool;
+}
+
+/* static */
+JsThreadServiceCallback BackgroundWorkPool::GetThreadService() {
+  if (v8::g_backgroundThreadCount == 0) {
+    return nullptr;
+  }
+
+  static uv_once_t initialized = UV_ONCE_INIT;
+  uv_once(&initialized, Initialize);
+  return s_pool != nullptr ? Submit : nullptr;
+}
+
+/* static */
+bool CHAKRA_CALLBACK BackgroundWorkPool::Submit(
+    JsBackgroundWorkItemCallback callback, void* callbackState) {
+  BackgroundWorkPool* pool = s_pool;
+  uv_mutex_lock(&pool->mutex);
+  pool->queue.push_back({ callback, callbackState });
+  uv_cond_signal(&pool->workAvailable);
+  uv_mutex_unlock(&pool->mutex);
+  return true;
+}
+
+/* static */
+void BackgroundWorkPool::ThreadProc(void* arg) {
+  BackgroundWorkPool* pool = static_cast<BackgroundWorkPool*>(arg);
+
+  uv_mutex_lock(&pool->mutex);
+  for (;;) {
+    while (pool->queue.empty()) {
+      uv_cond_wait(&pool->workAvailable, &pool->mutex);
+    }
+
+    WorkItem item = pool->queue.front();
+    pool->queue.pop_front();
+    uv_mutex_unlock(&pool->mutex);
+
+    // Runs until the runtime has no more work of this kind queued
+    item.callback(item.callbackState);
+
+    uv_mutex_lock(&pool->mutex);
+  }
+}
+
+}  // namespace jsrt
@@ -0,0 +1,64 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef DEPS_CHAKRASHIM_SRC_JSRTBACKGROUNDWORK_H_
+#define DEPS_CHAKRASHIM_SRC_JSRTBACKGROUNDWORK_H_
+
+#include "uv.h"
+#include <deque>
+#include <vector>
+
+namespace jsrt {
+
+// Runs the background work of all isolates of the process, their JIT and the
+// concurrent parts of their collections, on one pool of threads
+// (--chakra-background-threads) instead of threads started by every runtime.
+// Workers then share a bounded number of cores for it. The pool lives as long
+// as the process.
+class BackgroundWorkPool {
+ public:
+  // Returns the thread service callback to create runtimes with, nullptr when
+  // runtimes are to start threads of their own.
+  static JsThreadServiceCallback GetThreadService();
+
+ private:
+  struct WorkItem {
+    JsBackgroundWorkItemCallback callback;
+    void* callbackState;
+  };
+
+  explicit BackgroundWorkPool(unsigned int threadCount);
+
+  static void Initialize();
+  static bool CHAKRA_CALLBACK Submit(JsBackgroundWorkItemCallback callback,
+                                     void* callbackState);
+  static void ThreadProc(void* arg);
+
+  uv_mutex_t mutex;
+  uv_cond_t workAvailable;
+  std::deque<WorkItem> queue;
+  std::vector<uv_thread_t> threads;
+
+  static BackgroundWorkPool* s_pool;
+};
+
+}  // namespace jsrt
+
+#endif  // DEPS_CHAKRASHIM_SRC_JSRTBACKGROUNDWORK_H_
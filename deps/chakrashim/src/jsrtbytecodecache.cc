@@ -0,0 +1,201 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#include "v8chakra.h"
+#include "jsrtbytecodecache.h"
+#include <limits.h>
+#include <stdio.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace jsrt {
+
+namespace {
+
+// A cache file mapped read-only, so processes running the same scripts share
+// its pages. The engine reads functions from it lazily, so it stays mapped
+// until the runtime lets go of the buffer. Files are only ever replaced by
+// rename, never rewritten in place.
+class MappedFile {
+ public:
+  static MappedFile* Open(const std::string& path);
+  static void CHAKRA_CALLBACK Close(void* state);
+
+  void* GetData() const { return data; }
+  size_t GetLength() const { return length; }
+
+ private:
+  MappedFile() : data(nullptr), length(0) {}
+
+  void* data;
+  size_t length;
+#ifdef _WIN32
+  HANDLE mapping;
+#endif
+};
+
+#ifdef _WIN32
+MappedFile* MappedFile::Open(const std::string& path) {
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return nullptr;
+  }
+
+  LARGE_INTEGER size;
+  HANDLE mapping = nullptr;
+  if (GetFileSizeEx(file, &size) && size.QuadPart > 0 &&
+      size.QuadPart <= UINT_MAX) {
+    mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  }
+  // The mapping keeps the file open
+  CloseHandle(file);
+  if (mapping == nullptr) {
+    return nullptr;
+  }
+
+  void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (data == nullptr) {
+    CloseHandle(mapping);
+    return nullptr;
+  }
+
+  MappedFile* mappedFile = new MappedFile();
+  mappedFile->data = data;
+  mappedFile->length = static_cast<size_t>(size.QuadPart);
+  mappedFile->mapping = mapping;
+  return mappedFile;
+}
+
+void CHAKRA_CALLBACK MappedFile::Close(void* state) {
+  MappedFile* mappedFile = static_cast<MappedFile*>(state);
+  UnmapViewOfFile(mappedFile->data);
+  CloseHandle(mappedFile->mapping);
+  delete mappedFile;
+}
+#else
+MappedFile* MappedFile::Open(const std::string& path) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return nullptr;
+  }
+
+  struct stat st;
+  void* data = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size > 0 && st.st_size <= UINT_MAX) {
+    data = mmap(nullptr, static_cast<size_t>(st.st_size),
+                PROT_READ, MAP_SHARED, fd, 0);
+  }
+  close(fd);
+  if (data == MAP_FAILED) {
+    return nullptr;
+  }
+
+  MappedFile* mappedFile = new MappedFile();
+  mappedFile->data = data;
+  mappedFile->length = static_cast<size_t>(st.st_size);
+  return mappedFile;
+}
+
+void CHAKRA_CALLBACK MappedFile::Close(void* state) {
+  MappedFile* mappedFile = static_cast<MappedFile*>(state);
+  munmap(mappedFile->data, mappedFile->length);
+  delete mappedFile;
+}
+#endif
+
+}  // namespace
+
+ByteCodeCache::ByteCodeCache(const std::string& directory)
+    : directory(directory) {
+  // The engine rejects byte code of other builds as well; hashing the
+  // version keeps the files of different versions side by side
+  const char* version = v8::V8::GetVersion();
+  versionHash = HashBytes(version, strlen(version));
+}
+
+JsErrorCode ByteCodeCache::ParseScript(JsValueRef sourceRef,
+                                       const char* source,
+                                       size_t sourceLength,
+                                       JsSourceContext sourceContext,
+                                       JsValueRef sourceUrl,
+                                       JsValueRef* result) {
+  std::string path = GetPath(HashBytes(source, sourceLength, versionHash));
+
+  MappedFile* mappedFile = MappedFile::Open(path);
+  if (mappedFile != nullptr) {
+    JsValueRef bufferRef;
+    if (JsCreateExternalArrayBuffer(
+          mappedFile->GetData(),
+          static_cast<unsigned int>(mappedFile->GetLength()),
+          MappedFile::Close, mappedFile, &bufferRef) != JsNoError) {
+      MappedFile::Close(mappedFile);
+    } else {
+      IsolateShim::GetCurrent()->SetCodeCacheSource(sourceContext, sourceRef);
+      EngineTraceScope traceScope("ChakraCore.DeserializeCode");
+      if (JsParseSerializedWithUnloadCallback(
+            bufferRef, IsolateShim::LoadCodeCacheSource,
+            IsolateShim::UnloadCodeCacheSource, sourceContext, sourceUrl,
+            result) == JsNoError) {
+        return JsNoError;
+      }
+      // Corrupt or from another build, replaced below
+      IsolateShim::GetCurrent()->ReleaseCodeCacheSource(sourceContext);
+    }
+  }
+
+  JsErrorCode error;
+  {
+    EngineTraceScope traceScope("ChakraCore.Compile");
+    error = JsParse(sourceRef, sourceContext, sourceUrl,
+                    JsParseScriptAttributeNone, result);
+  }
+  if (error != JsNoError) {
+    return error;
+  }
+
+  EngineTraceScope traceScope("ChakraCore.SerializeCode");
+
+  JsValueRef bufferRef;
+  uint8_t* buffer;
+  unsigned int bufferLength;
+  if (JsSerialize(sourceRef, &bufferRef,
+                  JsParseScriptAttributeNone) == JsNoError &&
+      GetArrayBufferStorage(bufferRef, &buffer, &bufferLength) == JsNoError) {
+    WriteFileAtomically(path, buffer, bufferLength);
+  }
+
+  return JsNoError;
+}
+
+std::string ByteCodeCache::GetPath(uint64_t hash) const {
+  char name[32];
+  snprintf(name, sizeof(name), "%016llx.jsbc",
+           static_cast<unsigned long long>(hash));  // NOLINT(runtime/int)
+  return directory + "/" + name;
+}
+
+}  // namespace jsrt
@@ -0,0 +1,54 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#ifndef DEPS_CHAKRASHIM_SRC_JSRTBYTECODECACHE_H_
+#define DEPS_CHAKRASHIM_SRC_JSRTBYTECODECACHE_H_
+
+#include <stdint.h>
+#include <string>
+
+namespace jsrt {
+
+// Keeps the byte code of compiled scripts on disk (--chakra-bytecode-cache),
+// one file per script named after a hash of the engine version and the
+// source. A later process maps the file and runs the byte code without
+// parsing the source.
+class ByteCodeCache {
+ public:
+  explicit ByteCodeCache(const std::string& directory);
+
+  // Parses |sourceRef|, whose UTF-8 form is |source|, like JsParse. Uses the
+  // cached byte code when there is some, otherwise parses the source and
+  // stores its byte code for later runs.
+  JsErrorCode ParseScript(JsValueRef sourceRef, const char* source,
+                          size_t sourceLength, JsSourceContext sourceContext,
+                          JsValueRef sourceUrl, JsValueRef* result);
+
+ private:
+  std::string GetPath(uint64_t hash) const;
+
+  std::string directory;
+  uint64_t versionHash;
+};
+
+}  // namespace jsrt
+
+#endif  // DEPS_CHAKRASHIM_SRC_JSRTBYTECODECACHE_H_
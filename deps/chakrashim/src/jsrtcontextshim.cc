@@ -447,11 +447,8 @@ bool ContextShim::ExecuteChakraShimJS() {
   JsValueRef getInitFunction;
   JsValueRef url;
   jsrt::CreateString("chakra_shim.js", &url);
-  if (JsParse(GetIsolateShim()->GetChakraShimJsArrayBuffer(),
-                    v8::currentContext++,
-                    url,
-                    JsParseScriptAttributeNone,
-                    &getInitFunction) != JsNoError) {
+  if (GetIsolateShim()->ParseChakraShimJs(v8::currentContext++, url,
+                                          &getInitFunction) != JsNoError) {
     return false;
   }
   JsValueRef initFunction;
@@ -593,9 +590,6 @@ DECLARE_GETOBJECT(StringConcatFunction,
 DECLARE_GETOBJECT(ArrayFromFunction,
                   globalPrototypeFunction[GlobalPrototypeFunction
                     ::Array_from])
-DECLARE_GETOBJECT(ArrayPushFunction,
-                  globalPrototypeFunction[GlobalPrototypeFunction
-                    ::Array_push])
 DECLARE_GETOBJECT(MapGetFunction,
                   globalPrototypeFunction[GlobalPrototypeFunction
                     ::Map_get])
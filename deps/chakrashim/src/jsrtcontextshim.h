@@ -92,7 +92,6 @@ class ContextShim {
   JsValueRef GetValueOfFunction();
   JsValueRef GetStringConcatFunction();
   JsValueRef GetArrayFromFunction();
-  JsValueRef GetArrayPushFunction();
   JsValueRef GetGlobalPrototypeFunction(GlobalPrototypeFunction index);
   JsValueRef GetProxyOfGlobal();
   JsValueRef GetMapGetFunction();
@@ -0,0 +1,322 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "v8chakra.h"
+#include "jsrtcpuprofiler.h"
+
+namespace jsrt {
+
+static const int kDefaultSamplingInterval = 1000;
+
+// The engine reports names as null-terminated UTF-16; v8's profile API hands
+// out UTF-8
+static std::string ToUtf8(const uint16_t* str) {
+  std::string result;
+  if (str == nullptr) {
+    return result;
+  }
+
+  for (; *str != 0; str++) {
+    uint32_t c = *str;
+    if (c >= 0xD800 && c <= 0xDBFF && str[1] >= 0xDC00 && str[1] <= 0xDFFF) {
+      c = 0x10000 + ((c - 0xD800) << 10) + (str[1] - 0xDC00);
+      str++;
+    }
+
+    if (c < 0x80) {
+      result += static_cast<char>(c);
+    } else if (c < 0x800) {
+      result += static_cast<char>(0xC0 | (c >> 6));
+      result += static_cast<char>(0x80 | (c & 0x3F));
+    } else if (c < 0x10000) {
+      result += static_cast<char>(0xE0 | (c >> 12));
+      result += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+      result += static_cast<char>(0x80 | (c & 0x3F));
+    } else {
+      result += static_cast<char>(0xF0 | (c >> 18));
+      result += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+      result += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+      result += static_cast<char>(0x80 | (c & 0x3F));
+    }
+  }
+
+  return result;
+}
+
+CpuProfileNodeShim::CpuProfileNodeShim(unsigned id, const char* name)
+    : id(id),
+      functionName(name),
+      isSynthetic(true),
+      scriptId(0),
+      functionId(0),
+      lineNumber(v8::CpuProfileNode::kNoLineNumberInfo),
+      columnNumber(v8::CpuProfileNode::kNoColumnNumberInfo),
+      hitCount(0) {
+}
+
+CpuProfileNodeShim::CpuProfileNodeShim(unsigned id, const JsSampleFrame& frame,
+                                       int line)
+    : id(id),
+      functionName(ToUtf8(frame.functionName)),
+      url(ToUtf8(frame.url)),
+      isSynthetic(false),
+      scriptId(static_cast<int>(frame.scriptId)),
+      functionId(frame.functionId),
+      lineNumber(line),
+      columnNumber(static_cast<int>(frame.functionColumn) + 1),
+      hitCount(0) {
+}
+
+CpuProfileNodeShim* CpuProfileNodeShim::FindOrAddChild(
+    const JsSampleFrame& frame, int line, unsigned* nextNodeId) {
+  for (auto& child : children) {
+    if (!child->isSynthetic &&
+        child->scriptId == static_cast<int>(frame.scriptId) &&
+        child->functionId == frame.functionId &&
+        child->lineNumber == line) {
+      return child.get();
+    }
+  }
+
+  children.emplace_back(new CpuProfileNodeShim((*nextNodeId)++, frame, line));
+  return children.back().get();
+}
+
+CpuProfileNodeShim* CpuProfileNodeShim::FindOrAddChild(const char* name,
+                                                       unsigned* nextNodeId) {
+  for (auto& child : children) {
+    if (child->isSynthetic && child->functionName == name) {
+      return child.get();
+    }
+  }
+
+  children.emplace_back(new CpuProfileNodeShim((*nextNodeId)++, name));
+  return children.back().get();
+}
+
+void CpuProfileNodeShim::AddTick(int line) {
+  hitCount++;
+  if (line != v8::CpuProfileNode::kNoLineNumberInfo) {
+    lineTicks[line]++;
+  }
+}
+
+CpuProfileShim::CpuProfileShim(const std::string& title,
+                               v8::CpuProfilingMode mode, bool recordSamples)
+    : title(title),
+      mode(mode),
+      recordSamples(recordSamples),
+      nextNodeId(1),
+      startTime(CpuProfilerShim::Now()) {
+  root.reset(new CpuProfileNodeShim(nextNodeId++, "(root)"));
+  endTime = startTime;
+}
+
+void CpuProfileShim::AddSample(const JsSampleFrame* frames,
+                               unsigned int frameCount, int64_t timestamp) {
+  if (frameCount == 0) {
+    // Only host or library code was on the stack
+    AddSyntheticSample("(program)", timestamp);
+    return;
+  }
+
+  // Frames are reported innermost first; the tree grows from the outermost
+  CpuProfileNodeShim* node = root.get();
+  for (unsigned int i = frameCount; i > 0; i--) {
+    const JsSampleFrame& frame = frames[i - 1];
+    int line = (mode == v8::kCallerLineNumbers && i > 1) ?
+      static_cast<int>(frame.line) + 1 :
+      static_cast<int>(frame.functionLine) + 1;
+    node = node->FindOrAddChild(frame, line, &nextNodeId);
+  }
+
+  node->AddTick(static_cast<int>(frames[0].line) + 1);
+  RecordSample(node, timestamp);
+}
+
+void CpuProfileShim::AddSyntheticSample(const char* name, int64_t timestamp) {
+  CpuProfileNodeShim* node = root->FindOrAddChild(name, &nextNodeId);
+  node->AddTick(v8::CpuProfileNode::kNoLineNumberInfo);
+  RecordSample(node, timestamp);
+}
+
+void CpuProfileShim::RecordSample(const CpuProfileNodeShim* node,
+                                  int64_t timestamp) {
+  if (recordSamples) {
+    samples.push_back(node);
+    timestamps.push_back(timestamp);
+  }
+}
+
+CpuProfilerShim::CpuProfilerShim(IsolateShim* isolateShim)
+    : isolateShim(isolateShim),
+      samplingInterval(kDefaultSamplingInterval),
+      isSampling(false),
+      stopRequested(false),
+      isSamplePending(false),
+      isIdle(false) {
+  uv_mutex_init(&mutex);
+  uv_cond_init(&stopCondition);
+}
+
+CpuProfilerShim::~CpuProfilerShim() {
+  StopSampler();
+  uv_cond_destroy(&stopCondition);
+  uv_mutex_destroy(&mutex);
+}
+
+void CpuProfilerShim::SetIdle(bool isIdle) {
+  uv_mutex_lock(&mutex);
+  this->isIdle = isIdle;
+  uv_mutex_unlock(&mutex);
+}
+
+void CpuProfilerShim::StartProfiling(const std::string& title,
+                                     v8::CpuProfilingMode mode,
+                                     bool recordSamples) {
+  // Only this thread changes activeProfiles, so it can be read unlocked here
+  for (auto& profile : activeProfiles) {
+    if (profile->GetTitle() == title) {
+      return;
+    }
+  }
+
+  if (!isSampling && !StartSampler()) {
+    return;
+  }
+
+  uv_mutex_lock(&mutex);
+  activeProfiles.emplace_back(new CpuProfileShim(title, mode, recordSamples));
+  uv_mutex_unlock(&mutex);
+}
+
+CpuProfileShim* CpuProfilerShim::StopProfiling(const std::string& title) {
+  std::unique_ptr<CpuProfileShim> profile;
+
+  uv_mutex_lock(&mutex);
+  for (auto i = activeProfiles.rbegin(); i != activeProfiles.rend(); i++) {
+    if (title.empty() || (*i)->GetTitle() == title) {
+      profile = std::move(*i);
+      activeProfiles.erase(std::next(i).base());
+      break;
+    }
+  }
+  bool isLastProfile = activeProfiles.empty();
+  uv_mutex_unlock(&mutex);
+
+  if (profile == nullptr) {
+    return nullptr;
+  }
+
+  profile->Finish(Now());
+  if (isLastProfile) {
+    StopSampler();
+  }
+
+  return profile.release();
+}
+
+void CpuProfilerShim::CollectSample() {
+  if (isSampling) {
+    JsRequestRuntimeSample(isolateShim->GetRuntimeHandle());
+  }
+}
+
+bool CpuProfilerShim::StartSampler() {
+  // The runtime has a single sample callback
+  if (isolateShim->GetSamplingCpuProfiler() != nullptr) {
+    return false;
+  }
+
+  JsRuntimeHandle runtime = isolateShim->GetRuntimeHandle();
+  if (JsSetRuntimeSampleCallback(runtime, this, SampleCallback) != JsNoError) {
+    return false;
+  }
+
+  stopRequested = false;
+  isSamplePending = false;
+  if (uv_thread_create(&samplerThread, SamplerThreadProc, this) != 0) {
+    JsSetRuntimeSampleCallback(runtime, nullptr, nullptr);
+    return false;
+  }
+
+  isSampling = true;
+  isolateShim->SetSamplingCpuProfiler(this);
+  return true;
+}
+
+void CpuProfilerShim::StopSampler() {
+  if (!isSampling) {
+    return;
+  }
+
+  uv_mutex_lock(&mutex);
+  stopRequested = true;
+  uv_cond_signal(&stopCondition);
+  uv_mutex_unlock(&mutex);
+  uv_thread_join(&samplerThread);
+
+  JsSetRuntimeSampleCallback(isolateShim->GetRuntimeHandle(), nullptr, nullptr);
+  isSampling = false;
+  isolateShim->SetSamplingCpuProfiler(nullptr);
+}
+
+void CpuProfilerShim::SamplerThreadProc(void* arg) {
+  CpuProfilerShim* profiler = static_cast<CpuProfilerShim*>(arg);
+  JsRuntimeHandle runtime = profiler->isolateShim->GetRuntimeHandle();
+  uint64_t intervalNs = static_cast<uint64_t>(profiler->samplingInterval) * 1000;
+
+  uv_mutex_lock(&profiler->mutex);
+  while (!profiler->stopRequested) {
+    uv_cond_timedwait(&profiler->stopCondition, &profiler->mutex, intervalNs);
+    if (profiler->stopRequested) {
+      break;
+    }
+
+    if (profiler->isSamplePending) {
+      // Script didn't reach a safe point during the whole interval
+      const char* name = profiler->isIdle ? "(idle)" : "(program)";
+      int64_t now = Now();
+      for (auto& profile : profiler->activeProfiles) {
+        profile->AddSyntheticSample(name, now);
+      }
+    } else {
+      profiler->isSamplePending = true;
+      JsRequestRuntimeSample(runtime);
+    }
+  }
+  uv_mutex_unlock(&profiler->mutex);
+}
+
+void CHAKRA_CALLBACK CpuProfilerShim::SampleCallback(
+    const JsSampleFrame* frames, unsigned int frameCount,
+    void* callbackState) {
+  CpuProfilerShim* profiler = static_cast<CpuProfilerShim*>(callbackState);
+  int64_t now = Now();
+
+  uv_mutex_lock(&profiler->mutex);
+  profiler->isSamplePending = false;
+  for (auto& profile : profiler->activeProfiles) {
+    profile->AddSample(frames, frameCount, now);
+  }
+  uv_mutex_unlock(&profiler->mutex);
+}
+
+}  // namespace jsrt
@@ -0,0 +1,176 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef DEPS_CHAKRASHIM_SRC_JSRTCPUPROFILER_H_
+#define DEPS_CHAKRASHIM_SRC_JSRTCPUPROFILER_H_
+
+#include "v8-profiler.h"
+#include "uv.h"
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace jsrt {
+
+class IsolateShim;
+
+// Backs v8::CpuProfileNode
+class CpuProfileNodeShim {
+ public:
+  // Synthetic node such as "(root)" or "(program)"
+  CpuProfileNodeShim(unsigned id, const char* name);
+  // Node of the function running in |frame|, |line| is 1-based
+  CpuProfileNodeShim(unsigned id, const JsSampleFrame& frame, int line);
+
+  CpuProfileNodeShim* FindOrAddChild(const JsSampleFrame& frame, int line,
+                                     unsigned* nextNodeId);
+  CpuProfileNodeShim* FindOrAddChild(const char* name, unsigned* nextNodeId);
+
+  void AddTick(int line);
+
+  const std::string& GetFunctionName() const { return functionName; }
+  const std::string& GetUrl() const { return url; }
+  int GetScriptId() const { return scriptId; }
+  int GetLineNumber() const { return lineNumber; }
+  int GetColumnNumber() const { return columnNumber; }
+  unsigned GetHitCount() const { return hitCount; }
+  unsigned GetNodeId() const { return id; }
+  const std::map<int, unsigned>& GetLineTicks() const { return lineTicks; }
+  const std::vector<std::unique_ptr<CpuProfileNodeShim>>& GetChildren() const {
+    return children;
+  }
+
+  static CpuProfileNodeShim* FromNode(const v8::CpuProfileNode* node) {
+    return reinterpret_cast<CpuProfileNodeShim*>(
+      const_cast<v8::CpuProfileNode*>(node));
+  }
+  const v8::CpuProfileNode* ToNode() const {
+    return reinterpret_cast<const v8::CpuProfileNode*>(this);
+  }
+
+ private:
+  unsigned id;
+  std::string functionName;
+  std::string url;
+  bool isSynthetic;
+  int scriptId;
+  unsigned int functionId;
+  int lineNumber;
+  int columnNumber;
+  unsigned hitCount;
+  std::map<int, unsigned> lineTicks;
+  std::vector<std::unique_ptr<CpuProfileNodeShim>> children;
+};
+
+// Backs v8::CpuProfile
+class CpuProfileShim {
+ public:
+  CpuProfileShim(const std::string& title, v8::CpuProfilingMode mode,
+                 bool recordSamples);
+
+  void AddSample(const JsSampleFrame* frames, unsigned int frameCount,
+                 int64_t timestamp);
+  // Tick where script couldn't be sampled, attributed to |name|
+  void AddSyntheticSample(const char* name, int64_t timestamp);
+  void Finish(int64_t timestamp) { endTime = timestamp; }
+
+  const std::string& GetTitle() const { return title; }
+  const CpuProfileNodeShim* GetRoot() const { return root.get(); }
+  const std::vector<const CpuProfileNodeShim*>& GetSamples() const {
+    return samples;
+  }
+  const std::vector<int64_t>& GetTimestamps() const { return timestamps; }
+  int64_t GetStartTime() const { return startTime; }
+  int64_t GetEndTime() const { return endTime; }
+
+  static CpuProfileShim* FromProfile(const v8::CpuProfile* profile) {
+    return reinterpret_cast<CpuProfileShim*>(
+      const_cast<v8::CpuProfile*>(profile));
+  }
+  v8::CpuProfile* ToProfile() {
+    return reinterpret_cast<v8::CpuProfile*>(this);
+  }
+
+ private:
+  void RecordSample(const CpuProfileNodeShim* node, int64_t timestamp);
+
+  std::string title;
+  v8::CpuProfilingMode mode;
+  bool recordSamples;
+  unsigned nextNodeId;
+  std::unique_ptr<CpuProfileNodeShim> root;
+  std::vector<const CpuProfileNodeShim*> samples;
+  std::vector<int64_t> timestamps;
+  int64_t startTime;
+  int64_t endTime;
+};
+
+// Backs v8::CpuProfiler. While a profile is being recorded a sampler thread
+// requests a sample from the runtime every sampling interval; the engine
+// reports the stack from the script thread at its next safe point.
+class CpuProfilerShim {
+ public:
+  explicit CpuProfilerShim(IsolateShim* isolateShim);
+  ~CpuProfilerShim();
+
+  void SetSamplingInterval(int us) { samplingInterval = us; }
+  void SetIdle(bool isIdle);
+  void StartProfiling(const std::string& title, v8::CpuProfilingMode mode,
+                      bool recordSamples);
+  CpuProfileShim* StopProfiling(const std::string& title);
+  void CollectSample();
+  // Stops the sampler thread; called before the runtime goes away
+  void StopSampler();
+
+  static CpuProfilerShim* FromProfiler(v8::CpuProfiler* profiler) {
+    return reinterpret_cast<CpuProfilerShim*>(profiler);
+  }
+  v8::CpuProfiler* ToProfiler() {
+    return reinterpret_cast<v8::CpuProfiler*>(this);
+  }
+
+  // Microseconds on the uv_hrtime() clock
+  static int64_t Now() { return static_cast<int64_t>(uv_hrtime() / 1000); }
+
+ private:
+  static void CHAKRA_CALLBACK SampleCallback(const JsSampleFrame* frames,
+                                             unsigned int frameCount,
+                                             void* callbackState);
+  static void SamplerThreadProc(void* arg);
+  bool StartSampler();
+
+  IsolateShim* isolateShim;
+  int samplingInterval;
+
+  // Guards everything below, shared with the sampler thread
+  uv_mutex_t mutex;
+  std::vector<std::unique_ptr<CpuProfileShim>> activeProfiles;
+  uv_cond_t stopCondition;
+  uv_thread_t samplerThread;
+  bool isSampling;
+  bool stopRequested;
+  bool isSamplePending;
+  bool isIdle;
+};
+
+}  // namespace jsrt
+
+#endif  // DEPS_CHAKRASHIM_SRC_JSRTCPUPROFILER_H_
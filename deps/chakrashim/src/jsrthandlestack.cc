@@ -0,0 +1,87 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "jsrtutils.h"
+#include <new>
+
+namespace jsrt {
+
+HandleStack::HandleStack() {
+  chunk = new Chunk;
+  chunk->prev = nullptr;
+  chunk->next = nullptr;
+  top = chunk->refs;
+  limit = chunk->refs + kChunkSize;
+}
+
+HandleStack::~HandleStack() {
+  delete chunk->next;
+  while (chunk != nullptr) {
+    Chunk* prev = chunk->prev;
+    delete chunk;
+    chunk = prev;
+  }
+}
+
+bool HandleStack::Register(JsRuntimeHandle runtime) {
+  return JsSetRuntimeExternalRootsCallback(runtime, this, ScanRoots) ==
+    JsNoError;
+}
+
+void HandleStack::PopTo(JsValueRef* mark) {
+  while (mark < chunk->refs || mark > chunk->refs + kChunkSize) {
+    delete chunk->next;
+    chunk->next = nullptr;
+    chunk = chunk->prev;
+    CHAKRA_ASSERT(chunk != nullptr);
+  }
+  top = mark;
+  limit = chunk->refs + kChunkSize;
+}
+
+bool HandleStack::Grow() {
+  Chunk* next = chunk->next;
+  if (next == nullptr) {
+    next = new (std::nothrow) Chunk;
+    if (next == nullptr) {
+      return false;
+    }
+    next->prev = chunk;
+    next->next = nullptr;
+    chunk->next = next;
+  }
+  chunk = next;
+  top = next->refs;
+  limit = next->refs + kChunkSize;
+  return true;
+}
+
+void CHAKRA_CALLBACK HandleStack::ScanRoots(void* callbackState,
+                                            JsScanRootsCallback scan,
+                                            void* scanState) {
+  HandleStack* stack = static_cast<HandleStack*>(callbackState);
+  Chunk* chunk = stack->chunk;
+  scan(scanState, chunk->refs, stack->top - chunk->refs);
+  for (chunk = chunk->prev; chunk != nullptr; chunk = chunk->prev) {
+    scan(scanState, chunk->refs, kChunkSize);
+  }
+}
+
+}  // namespace jsrt
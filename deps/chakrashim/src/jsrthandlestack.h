@@ -0,0 +1,78 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef DEPS_CHAKRASHIM_SRC_JSRTHANDLESTACK_H_
+#define DEPS_CHAKRASHIM_SRC_JSRTHANDLESTACK_H_
+
+#include <stddef.h>
+
+namespace jsrt {
+
+// Holds the refs of HandleScopes that don't fit in the scope itself. The
+// recycler scans the used part of the stack when it looks for roots, like it
+// scans the native stack, so adding a ref is a store and a pointer bump.
+// Scopes pop what they pushed in LIFO order.
+class HandleStack {
+ public:
+  HandleStack();
+  ~HandleStack();
+
+  // Makes the recycler of |runtime| scan the stack, once per runtime
+  bool Register(JsRuntimeHandle runtime);
+
+  JsValueRef* Top() const {
+    return top;
+  }
+
+  bool Push(JsValueRef value) {
+    if (top == limit && !Grow()) {
+      return false;
+    }
+    *top++ = value;
+    return true;
+  }
+
+  // Drops the refs pushed since Top() returned |mark|
+  void PopTo(JsValueRef* mark);
+
+ private:
+  // A chunk is 8KB on 64-bit
+  static const size_t kChunkSize = 1022;
+
+  struct Chunk {
+    Chunk* prev;
+    Chunk* next;
+    JsValueRef refs[kChunkSize];
+  };
+
+  bool Grow();
+  static void CHAKRA_CALLBACK ScanRoots(void* callbackState,
+                                        JsScanRootsCallback scan,
+                                        void* scanState);
+
+  // The chunk |top| is in. At most one chunk is kept after it, for reuse
+  Chunk* chunk;
+  JsValueRef* top;
+  JsValueRef* limit;
+};
+
+}  // namespace jsrt
+
+#endif  // DEPS_CHAKRASHIM_SRC_JSRTHANDLESTACK_H_
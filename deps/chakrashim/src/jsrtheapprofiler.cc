@@ -0,0 +1,236 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "v8chakra.h"
+#include "jsrtheapprofiler.h"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+
+namespace jsrt {
+
+// The engine reports names as null-terminated UTF-16
+static std::u16string ToString16(const uint16_t* str) {
+  if (str == nullptr) {
+    return std::u16string();
+  }
+
+  return std::u16string(reinterpret_cast<const char16_t*>(str));
+}
+
+static v8::Local<v8::String> NewString(v8::Isolate* isolate,
+                                       const std::u16string& str) {
+  return v8::String::NewFromTwoByte(
+    isolate, reinterpret_cast<const uint16_t*>(str.data()),
+    v8::NewStringType::kNormal,
+    static_cast<int>(str.length())).ToLocalChecked();
+}
+
+// Backs the profile returned by GetAllocationProfile. The nodes hold handles,
+// so it is only usable in the HandleScope it was created in. The root is the
+// first node, a deque keeps the children pointers stable as nodes are added.
+class SamplingHeapProfilerShim::AllocationProfileShim
+    : public v8::AllocationProfile {
+ public:
+  v8::AllocationProfile::Node* GetRootNode() override {
+    return &nodes.front();
+  }
+
+  std::deque<v8::AllocationProfile::Node> nodes;
+};
+
+SamplingHeapProfilerShim::Node::Node(const JsSampleFrame& frame)
+    : isRoot(false),
+      scriptId(frame.scriptId),
+      functionId(frame.functionId),
+      functionName(ToString16(frame.functionName)),
+      url(ToString16(frame.url)),
+      line(static_cast<int>(frame.functionLine) + 1),
+      column(static_cast<int>(frame.functionColumn) + 1) {
+}
+
+SamplingHeapProfilerShim::Node* SamplingHeapProfilerShim::Node::FindOrAddChild(
+    const JsSampleFrame& frame) {
+  for (auto& child : children) {
+    if (child->scriptId == frame.scriptId &&
+        child->functionId == frame.functionId) {
+      return child.get();
+    }
+  }
+
+  children.emplace_back(new Node(frame));
+  return children.back().get();
+}
+
+SamplingHeapProfilerShim::SamplingHeapProfilerShim(IsolateShim* isolateShim)
+    : isolateShim(isolateShim),
+      isSampling(false),
+      sampleInterval(0),
+      stackDepth(0),
+      flags(v8::HeapProfiler::kSamplingNoFlags) {
+}
+
+SamplingHeapProfilerShim::~SamplingHeapProfilerShim() {
+  StopSampling();
+}
+
+bool SamplingHeapProfilerShim::StartSampling(
+    uint64_t sampleInterval, int stackDepth,
+    v8::HeapProfiler::SamplingFlags flags) {
+  if (isSampling) {
+    return false;
+  }
+
+  this->sampleInterval = std::max(sampleInterval, static_cast<uint64_t>(1));
+  this->stackDepth = std::max(stackDepth, 0);
+  this->flags = flags;
+  root.reset(new Node());
+
+  if (JsSetRuntimeAllocationSampling(isolateShim->GetRuntimeHandle(),
+                                     static_cast<size_t>(this->sampleInterval),
+                                     this, SampleCallback,
+                                     FreeCallback) != JsNoError) {
+    root.reset();
+    return false;
+  }
+
+  isSampling = true;
+  return true;
+}
+
+void SamplingHeapProfilerShim::StopSampling() {
+  if (!isSampling) {
+    return;
+  }
+
+  JsSetRuntimeAllocationSampling(isolateShim->GetRuntimeHandle(), 0, nullptr,
+                                 nullptr, nullptr);
+  isSampling = false;
+  samples.clear();
+  root.reset();
+}
+
+v8::AllocationProfile* SamplingHeapProfilerShim::GetAllocationProfile() {
+  if (!isSampling) {
+    return nullptr;
+  }
+
+  if (flags & v8::HeapProfiler::kSamplingForceGC) {
+    // Drop the samples of the objects that are already garbage
+    JsCollectGarbage(isolateShim->GetRuntimeHandle());
+  }
+
+  AllocationProfileShim* profile = new AllocationProfileShim();
+  TranslateNode(root.get(), profile);
+  return profile;
+}
+
+v8::AllocationProfile::Node* SamplingHeapProfilerShim::TranslateNode(
+    const Node* node, AllocationProfileShim* profile) {
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+
+  profile->nodes.emplace_back();
+  v8::AllocationProfile::Node* result = &profile->nodes.back();
+  for (auto& allocation : node->allocations) {
+    result->allocations.push_back(
+      { allocation.first, ScaleCount(allocation.first, allocation.second) });
+  }
+
+  for (auto& child : node->children) {
+    v8::AllocationProfile::Node* translatedChild =
+      TranslateNode(child.get(), profile);
+    if (translatedChild != nullptr) {
+      result->children.push_back(translatedChild);
+    }
+  }
+
+  if (node->isRoot) {
+    result->name = v8::String::NewFromUtf8(isolate, "(root)",
+                                           v8::NewStringType::kNormal)
+                     .ToLocalChecked();
+    result->script_name = v8::String::Empty(isolate);
+    result->script_id = v8::UnboundScript::kNoScriptId;
+    result->line_number = v8::AllocationProfile::kNoLineNumberInfo;
+    result->column_number = v8::AllocationProfile::kNoColumnNumberInfo;
+  } else if (result->allocations.empty() && result->children.empty()) {
+    // Nothing allocated here or below is alive anymore; the children
+    // dropped themselves, so this is the last node
+    profile->nodes.pop_back();
+    return nullptr;
+  } else {
+    result->name = NewString(isolate, node->functionName);
+    result->script_name = NewString(isolate, node->url);
+    result->script_id = static_cast<int>(node->scriptId);
+    result->line_number = node->line;
+    result->column_number = node->column;
+  }
+
+  result->start_position = 0;
+  return result;
+}
+
+// A sample of |size| bytes stands for 1 / (1 - exp(-size / interval))
+// allocations, the chance of one of its bytes being picked is the inverse
+unsigned int SamplingHeapProfilerShim::ScaleCount(size_t size,
+                                                  unsigned int count) const {
+  double scale = 1.0 / (1.0 - std::exp(-static_cast<double>(size) /
+                                       static_cast<double>(sampleInterval)));
+  return static_cast<unsigned int>(count * scale + 0.5);
+}
+
+void CHAKRA_CALLBACK SamplingHeapProfilerShim::SampleCallback(
+    unsigned int sampleId, size_t size, const JsSampleFrame* frames,
+    unsigned int frameCount, void* callbackState) {
+  SamplingHeapProfilerShim* profiler =
+    static_cast<SamplingHeapProfilerShim*>(callbackState);
+
+  // Frames are reported innermost first; the innermost ones are kept and the
+  // tree grows from the outermost of those
+  unsigned int depth =
+    std::min(frameCount, static_cast<unsigned int>(profiler->stackDepth));
+  Node* node = profiler->root.get();
+  for (unsigned int i = depth; i > 0; i--) {
+    node = node->FindOrAddChild(frames[i - 1]);
+  }
+
+  node->allocations[size]++;
+  profiler->samples[sampleId] = { node, size };
+}
+
+void CHAKRA_CALLBACK SamplingHeapProfilerShim::FreeCallback(
+    unsigned int sampleId, void* callbackState) {
+  SamplingHeapProfilerShim* profiler =
+    static_cast<SamplingHeapProfilerShim*>(callbackState);
+
+  auto sample = profiler->samples.find(sampleId);
+  if (sample == profiler->samples.end()) {
+    return;
+  }
+
+  std::map<size_t, unsigned int>& allocations =
+    sample->second.node->allocations;
+  auto allocation = allocations.find(sample->second.size);
+  if (--allocation->second == 0) {
+    allocations.erase(allocation);
+  }
+  profiler->samples.erase(sample);
+}
+
+}  // namespace jsrt
@@ -0,0 +1,99 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef DEPS_CHAKRASHIM_SRC_JSRTHEAPPROFILER_H_
+#define DEPS_CHAKRASHIM_SRC_JSRTHEAPPROFILER_H_
+
+#include "v8-profiler.h"
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace jsrt {
+
+class IsolateShim;
+
+// Backs the sampling heap profiler of v8::HeapProfiler. The engine samples
+// recycler allocations and reports when a sampled object is collected, the
+// samples still alive make up the profile.
+class SamplingHeapProfilerShim {
+ public:
+  explicit SamplingHeapProfilerShim(IsolateShim* isolateShim);
+  ~SamplingHeapProfilerShim();
+
+  bool StartSampling(uint64_t sampleInterval, int stackDepth,
+                     v8::HeapProfiler::SamplingFlags flags);
+  void StopSampling();
+  v8::AllocationProfile* GetAllocationProfile();
+
+ private:
+  // A node of the call tree, the allocations are the live samples by size
+  struct Node {
+    Node() : isRoot(true), scriptId(0), functionId(0), line(0), column(0) {}
+    explicit Node(const JsSampleFrame& frame);
+
+    Node* FindOrAddChild(const JsSampleFrame& frame);
+
+    bool isRoot;
+    unsigned int scriptId;
+    unsigned int functionId;
+    std::u16string functionName;
+    std::u16string url;
+    int line;
+    int column;
+    std::map<size_t, unsigned int> allocations;
+    std::vector<std::unique_ptr<Node>> children;
+  };
+
+  struct Sample {
+    Node* node;
+    size_t size;
+  };
+
+  class AllocationProfileShim;
+
+  static void CHAKRA_CALLBACK SampleCallback(unsigned int sampleId,
+                                             size_t size,
+                                             const JsSampleFrame* frames,
+                                             unsigned int frameCount,
+                                             void* callbackState);
+  static void CHAKRA_CALLBACK FreeCallback(unsigned int sampleId,
+                                           void* callbackState);
+
+  // Adds |node| and the subtree below it to |profile|, unless none of it has
+  // live samples
+  v8::AllocationProfile::Node* TranslateNode(const Node* node,
+                                             AllocationProfileShim* profile);
+  unsigned int ScaleCount(size_t size, unsigned int count) const;
+
+  IsolateShim* isolateShim;
+  bool isSampling;
+  uint64_t sampleInterval;
+  int stackDepth;
+  v8::HeapProfiler::SamplingFlags flags;
+  std::unique_ptr<Node> root;
+  std::unordered_map<unsigned int, Sample> samples;
+};
+
+}  // namespace jsrt
+
+#endif  // DEPS_CHAKRASHIM_SRC_JSRTHEAPPROFILER_H_
@@ -22,10 +22,17 @@
 #include "jsrtutils.h"
 #include "chakra_natives.h"
 #include <assert.h>
+#include <limits.h>  // UINT_MAX
 #include <vector>
 #include <algorithm>
 #include "v8-debug.h"
 #include "jsrtinspector.h"
+#include "jsrtcpuprofiler.h"
+#include "jsrtheapprofiler.h"
+#include "jsrtbytecodecache.h"
+#include "jsrtbackgroundwork.h"
+#include "jsrtprofilecache.h"
+#include "v8-platform.h"
 
 /////////////////////////////////////////////////
 
@@ -212,6 +219,13 @@ void CALLBACK TTFlushAndCloseStreamCallback(JsTTDStreamHandle handle,
 
 namespace v8 {
 extern bool g_disableIdleGc;
+extern unsigned int g_jitThreadCount;
+extern size_t g_maxOldSpaceSize;
+extern bool g_jitStatistics;
+extern int g_perfMapFlags;
+extern std::string g_profileCacheDir;
+extern std::string g_byteCodeCacheDir;
+extern Platform* g_platform;
 }
 namespace jsrt {
 
@@ -226,7 +240,9 @@ IsolateShim::IsolateShim(JsRuntimeHandle runtime)
       runtime(runtime),
       symbolPropertyIdRefs(),
       cachedPropertyIdRefs(),
+      propertyCaches(),
       isDisposing(false),
+      heapSpaceStatistics(),
       contextScopeStack(nullptr),
       tryCatchStackTop(nullptr),
       embeddedData(),
@@ -268,10 +284,22 @@ IsolateShim::~IsolateShim() {
       (disableIdleGc ? JsRuntimeAttributeNone :
                         JsRuntimeAttributeEnableIdleProcessing));
 
+  if (v8::g_perfMapFlags != JsPerfMapNone) {
+    // The files are process wide, so only the first isolate opens them
+    if (JsSetPerfMapFlags(static_cast<JsPerfMapFlags>(v8::g_perfMapFlags)) !=
+        JsNoError) {
+      fprintf(stderr, "Warning: Could not write perf map files\n");
+    }
+    v8::g_perfMapFlags = JsPerfMapNone;
+  }
+
   JsRuntimeHandle runtime;
   JsErrorCode error;
   if (!(doRecord || doReplay)) {
-      error = JsCreateRuntime(attributes, nullptr, &runtime);
+      // Workers share the background threads when there is a pool
+      error = JsCreateRuntime(attributes,
+                              BackgroundWorkPool::GetThreadService(),
+                              &runtime);
   } else {
     if (doRecord) {
       error = JsTTDCreateRecordRuntime(attributes, doDebug, snapInterval,
@@ -294,6 +322,17 @@ IsolateShim::~IsolateShim() {
     return nullptr;
   }
 
+  if (v8::g_jitThreadCount != 0) {
+    // Must happen before the first context starts the JIT threads
+    JsSetRuntimeMaxJitThreadCount(runtime, v8::g_jitThreadCount);
+  }
+
+  if (v8::g_maxOldSpaceSize != 0) {
+    // Page allocations past the limit fail, the recycler collects and retries
+    // them and only throws out of memory to script when that doesn't help
+    JsSetRuntimeMemoryLimit(runtime, v8::g_maxOldSpaceSize);
+  }
+
   if (Inspector::IsInspectorEnabled()) {
     // If JavaScript debugging APIs need to be exposed then
     // runtime should be in debugging mode from start
@@ -301,6 +340,8 @@ IsolateShim::~IsolateShim() {
   }
 
   IsolateShim* newIsolateshim = new IsolateShim(runtime);
+  // Values only referenced by a HandleScope are collected without it
+  CHAKRA_VERIFY(newIsolateshim->handleStack.Register(runtime));
   if (!disableIdleGc) {
     uv_prepare_init(uv_default_loop(), newIsolateshim->idleGc_prepare_handle());
     uv_unref(reinterpret_cast<uv_handle_t*>(
@@ -309,6 +350,24 @@ IsolateShim::~IsolateShim() {
     uv_unref(reinterpret_cast<uv_handle_t*>(
       newIsolateshim->idleGc_timer_handle()));
   }
+
+  // Loaded profiles would change what a replay executes
+  if (!v8::g_profileCacheDir.empty() && !(doRecord || doReplay)) {
+    newIsolateshim->profileCache =
+      new DynamicProfileCache(v8::g_profileCacheDir);
+  }
+  if (!v8::g_byteCodeCacheDir.empty() && !(doRecord || doReplay)) {
+    newIsolateshim->byteCodeCache =
+      new ByteCodeCache(v8::g_byteCodeCacheDir);
+  }
+  newIsolateshim->shareChakraShimByteCode = !(doRecord || doReplay);
+  // Collections are traced whether or not anyone adds a GC callback
+  if (IsTracingAvailable()) {
+    newIsolateshim->EnsureCollectEventCallback();
+  }
+  if (v8::g_jitStatistics) {
+    newIsolateshim->SetJitStatisticsEnabled(true);
+  }
   return ToIsolate(newIsolateshim);
 }
 
@@ -352,6 +411,27 @@ JsRuntimeHandle IsolateShim::GetRuntimeHandle() {
 
 bool IsolateShim::Dispose() {
   isDisposing = true;
+
+  // Sampler threads must be gone before the runtime is
+  if (samplingCpuProfiler != nullptr) {
+    samplingCpuProfiler->StopSampler();
+  }
+  delete cpuProfiler;
+  cpuProfiler = nullptr;
+  // Stops the allocation sampling, whose callbacks the collections made while
+  // disposing the runtime would otherwise still call
+  delete samplingHeapProfiler;
+  samplingHeapProfiler = nullptr;
+
+  if (profileCache != nullptr) {
+    // Profiles are serialized from the contexts, which go away with the runtime
+    profileCache->Save();
+    delete profileCache;
+    profileCache = nullptr;
+  }
+  delete byteCodeCache;
+  byteCodeCache = nullptr;
+
   {
     // Disposing the runtime may cause finalize call back to run
     // Set the current IsolateShim scope
@@ -377,6 +457,92 @@ bool IsolateShim::Dispose() {
   return true;
 }
 
+CpuProfilerShim* IsolateShim::GetCpuProfiler() {
+  if (cpuProfiler == nullptr) {
+    cpuProfiler = new CpuProfilerShim(this);
+  }
+  return cpuProfiler;
+}
+
+SamplingHeapProfilerShim* IsolateShim::GetSamplingHeapProfiler() {
+  if (samplingHeapProfiler == nullptr) {
+    samplingHeapProfiler = new SamplingHeapProfilerShim(this);
+  }
+  return samplingHeapProfiler;
+}
+
+void IsolateShim::SetCodeCacheSource(JsSourceContext sourceContext,
+                                     JsValueRef source) {
+  ReleaseUnloadedCodeCacheSources();
+  JsAddRef(source, nullptr);
+  codeCacheSources[sourceContext] = source;
+}
+
+JsValueRef IsolateShim::GetCodeCacheSource(JsSourceContext sourceContext) {
+  auto it = codeCacheSources.find(sourceContext);
+  return it != codeCacheSources.end() ? it->second : JS_INVALID_REFERENCE;
+}
+
+void IsolateShim::ReleaseCodeCacheSource(JsSourceContext sourceContext) {
+  auto it = codeCacheSources.find(sourceContext);
+  if (it != codeCacheSources.end()) {
+    JsRelease(it->second, nullptr);
+    codeCacheSources.erase(it);
+  }
+}
+
+void IsolateShim::ReleaseUnloadedCodeCacheSources() {
+  for (JsSourceContext sourceContext : unloadedCodeCacheSources) {
+    ReleaseCodeCacheSource(sourceContext);
+  }
+  unloadedCodeCacheSources.clear();
+}
+
+/* static */ bool CHAKRA_CALLBACK IsolateShim::LoadCodeCacheSource(
+    JsSourceContext sourceContext, JsValueRef* value,
+    JsParseScriptAttributes* parseAttributes) {
+  IsolateShim* isolateShim = GetCurrent();
+  *value = isolateShim->GetCodeCacheSource(sourceContext);
+  *parseAttributes = JsParseScriptAttributeNone;
+  // The engine keeps the source alive from here on, and doesn't ask again
+  isolateShim->ReleaseCodeCacheSource(sourceContext);
+  return *value != JS_INVALID_REFERENCE;
+}
+
+/* static */ void CHAKRA_CALLBACK IsolateShim::UnloadCodeCacheSource(
+    JsSourceContext sourceContext) {
+  // Called from the finalizer of the script, where the runtime can't be
+  // called into; the runtime frees everything when it is disposed
+  IsolateShim* isolateShim = GetCurrent();
+  if (isolateShim != nullptr && !isolateShim->IsDisposing() &&
+      isolateShim->codeCacheSources.count(sourceContext) != 0) {
+    isolateShim->unloadedCodeCacheSources.push_back(sourceContext);
+  }
+}
+
+void IsolateShim::SetEagerCompileSource(JsValueRef function,
+                                        JsValueRef source) {
+  ReleaseEagerCompileSource();
+  JsAddRef(function, nullptr);
+  JsAddRef(source, nullptr);
+  eagerCompileFunction = function;
+  eagerCompileSource = source;
+}
+
+JsValueRef IsolateShim::GetEagerCompileSource(JsValueRef function) {
+  return function == eagerCompileFunction ? eagerCompileSource :
+                                            JS_INVALID_REFERENCE;
+}
+
+void IsolateShim::ReleaseEagerCompileSource() {
+  if (eagerCompileFunction != JS_INVALID_REFERENCE) {
+    JsRelease(eagerCompileFunction, nullptr);
+    JsRelease(eagerCompileSource, nullptr);
+    eagerCompileFunction = JS_INVALID_REFERENCE;
+    eagerCompileSource = JS_INVALID_REFERENCE;
+  }
+}
+
 bool IsolateShim::IsDisposing() {
   return isDisposing;
 }
@@ -386,6 +552,15 @@ bool IsolateShim::IsDisposing() {
 void CHAKRA_CALLBACK IsolateShim::JsContextBeforeCollectCallback(
     JsRef contextRef, void* data) {
   IsolateShim * isolateShim = reinterpret_cast<IsolateShim *>(data);
+  DynamicProfileCache * profileCache = isolateShim->GetProfileCache();
+  if (profileCache != nullptr && profileCache->OnContextCollect(contextRef)) {
+    // Revived until the profiles of its scripts are saved, after which it is
+    // collected and this is called again
+    JsSetObjectBeforeCollectCallback(contextRef, isolateShim,
+                                     JsContextBeforeCollectCallback);
+    return;
+  }
+
   ContextShim * contextShim = isolateShim->GetContextShim(contextRef);
 
   // TTD_NODE
@@ -433,10 +608,100 @@ bool IsolateShim::GetMemoryUsage(size_t * memoryUsage) {
   return (JsGetRuntimeMemoryUsage(runtime, memoryUsage) == JsNoError);
 }
 
+bool IsolateShim::GetMemoryLimit(size_t * memoryLimit) {
+  return (JsGetRuntimeMemoryLimit(runtime, memoryLimit) == JsNoError);
+}
+
+bool IsolateShim::GetHeapSpaceStatistics(JsHeapSpaceStatistics * statistics) {
+  return (JsGetRuntimeHeapSpaceStatistics(runtime, statistics) == JsNoError);
+}
+
+bool IsolateShim::GetHeapSpaceStatistics(size_t index,
+                                         JsHeapSpaceStatistics * statistics) {
+  assert(index < JsHeapSpaceCount);
+  if (index == 0 || !hasHeapSpaceStatistics) {
+    hasHeapSpaceStatistics = GetHeapSpaceStatistics(heapSpaceStatistics);
+    if (!hasHeapSpaceStatistics) {
+      return false;
+    }
+  }
+
+  *statistics = heapSpaceStatistics[index];
+  return true;
+}
+
+int64_t IsolateShim::AdjustExternalMemory(int64_t changeInBytes) {
+  externalMemory += changeInBytes;
+  if (externalMemory < 0) {
+    externalMemory = 0;
+  }
+  // Frees need no report, the recycler's count starts over every collection.
+  // Finalizers free memory while the runtime is being disposed, so don't call
+  // into it then.
+  if (changeInBytes > 0 && !isDisposing) {
+    JsAddRuntimeExternalMemoryPressure(runtime,
+                                       static_cast<size_t>(changeInBytes));
+  }
+  return externalMemory;
+}
+
+bool IsolateShim::SetJitStatisticsEnabled(bool enabled) {
+  return JsSetRuntimeJitStatisticsEnabled(
+      runtime, enabled, enabled ? IsolateShim::JitEventCallback : nullptr,
+      this) == JsNoError;
+}
+
+bool IsolateShim::EnumerateJitStatistics(JsJitStatisticsCallback callback,
+                                         void* callbackState, bool reset) {
+  return JsEnumerateRuntimeJitStatistics(runtime, callback, callbackState,
+                                         reset) == JsNoError;
+}
+
+bool IsolateShim::EnumerateDeoptLog(JsJitDeoptLogCallback callback,
+                                    void* callbackState, bool reset,
+                                    unsigned int* deoptCount) {
+  return JsEnumerateRuntimeDeoptLog(runtime, callback, callbackState, reset,
+                                    deoptCount) == JsNoError;
+}
+
+bool IsolateShim::RedeferInactiveFunctions(unsigned int* functionCount,
+                                           size_t* freedBytes) {
+  return JsRedeferRuntimeInactiveFunctions(runtime, functionCount,
+                                           freedBytes) == JsNoError;
+}
+
 void IsolateShim::CollectGarbage() {
   JsCollectGarbage(runtime);
 }
 
+int IsolateShim::IdleNotification(unsigned int idleTimeInMs) {
+  isIdleNotificationEnabled = true;
+
+  if (profileCache != nullptr) {
+    profileCache->SaveCollected();
+  }
+  ReleaseUnloadedCodeCacheSources();
+
+  if (!IsIdleGcEnabled() || !IsJsScriptExecuted()) {
+    return -1;
+  }
+
+  unsigned int nextIdleTimeInMs = UINT_MAX;
+  if (JsIdleCollectGarbage(runtime, idleTimeInMs, &nextIdleTimeInMs) !=
+      JsNoError) {
+    // Retrying won't help, e.g. a heap enumeration is in progress; try again
+    // after script has run
+    ResetScriptExecuted();
+    return -1;
+  }
+
+  if (nextIdleTimeInMs == UINT_MAX) {
+    ResetScriptExecuted();
+    return -1;
+  }
+  return static_cast<int>(nextIdleTimeInMs);
+}
+
 void IsolateShim::DisposeAll() {
   // CHAKRA-TODO: multithread locking for s_isolateList?
   IsolateShim * curr = s_isolateList;
@@ -545,6 +810,29 @@ JsPropertyIdRef IsolateShim::GetCachedPropertyIdRef(
   });
 }
 
+JsPropertyCacheRef IsolateShim::GetPropertyCache(
+    JsPropertyIdRef propertyIdRef) {
+  // Property ids are recycler allocations, so the low bits are always zero
+  PropertyCacheEntry& entry = propertyCaches[
+    (reinterpret_cast<uintptr_t>(propertyIdRef) >> 4) % kPropertyCacheCount];
+  if (entry.propertyIdRef == propertyIdRef) {
+    // The cache keeps the property id alive, so it can't have been reused
+    return entry.propertyCache;
+  }
+
+  JsPropertyCacheRef propertyCache;
+  if (JsCreatePropertyCache(propertyIdRef, &propertyCache) != JsNoError ||
+      JsAddRef(propertyCache, nullptr) != JsNoError) {
+    return JS_INVALID_REFERENCE;
+  }
+  if (entry.propertyCache != JS_INVALID_REFERENCE) {
+    JsRelease(entry.propertyCache, nullptr);
+  }
+  entry.propertyIdRef = propertyIdRef;
+  entry.propertyCache = propertyCache;
+  return propertyCache;
+}
+
 JsPropertyIdRef IsolateShim::GetToStringTagSymbolPropertyIdRef() {
   return GetCachedPropertyId(cachedPropertyIdRefs,
                 CachedPropertyIdRef::Symbol_toStringTag,
@@ -640,6 +928,59 @@ JsValueRef IsolateShim::GetChakraShimJsArrayBuffer() {
   return chakraShimArrayBuffer;
 }
 
+JsErrorCode IsolateShim::ParseChakraShimJs(JsSourceContext sourceContext,
+                                           JsValueRef url,
+                                           JsValueRef* result) {
+  JsValueRef sourceRef = GetChakraShimJsArrayBuffer();
+  if (byteCodeCache != nullptr) {
+    return byteCodeCache->ParseScript(
+      sourceRef, reinterpret_cast<const char*>(raw_chakra_shim_raw),
+      sizeof(raw_chakra_shim_raw), sourceContext, url, result);
+  }
+
+  // Most processes only ever create the main context, which isn't worth
+  // the serialization. vm contexts after it are.
+  if (chakraShimParsed && shareChakraShimByteCode &&
+      chakraShimByteCode.empty()) {
+    JsValueRef bufferRef;
+    uint8_t* buffer;
+    unsigned int bufferLength;
+    if (JsSerialize(sourceRef, &bufferRef,
+                    JsParseScriptAttributeNone) == JsNoError &&
+        GetArrayBufferStorage(bufferRef, &buffer,
+                              &bufferLength) == JsNoError) {
+      chakraShimByteCode.assign(buffer, buffer + bufferLength);
+    } else {
+      shareChakraShimByteCode = false;
+    }
+  }
+  chakraShimParsed = true;
+
+  if (!chakraShimByteCode.empty()) {
+    // The engine reads the functions lazily, the vector outlives the runtime
+    JsValueRef bufferRef;
+    if (JsCreateExternalArrayBuffer(
+          chakraShimByteCode.data(),
+          static_cast<unsigned int>(chakraShimByteCode.size()),
+          nullptr, nullptr, &bufferRef) == JsNoError &&
+        JsParseSerialized(bufferRef, LoadChakraShimSource, sourceContext, url,
+                          result) == JsNoError) {
+      return JsNoError;
+    }
+  }
+
+  return JsParse(sourceRef, sourceContext, url, JsParseScriptAttributeNone,
+                 result);
+}
+
+/* static */ bool CHAKRA_CALLBACK IsolateShim::LoadChakraShimSource(
+    JsSourceContext sourceContext, JsValueRef* value,
+    JsParseScriptAttributes* parseAttributes) {
+  *value = GetCurrent()->GetChakraShimJsArrayBuffer();
+  *parseAttributes = JsParseScriptAttributeNone;
+  return true;
+}
+
 JsValueRef IsolateShim::GetChakraInspectorShimJsArrayBuffer() {
   JsValueRef chakraInspectorShimArrayBuffer = JS_INVALID_REFERENCE;
   CHAKRA_VERIFY_NOERROR(JsCreateExternalArrayBuffer(
@@ -671,7 +1012,247 @@ void IsolateShim::SetPromiseRejectCallback(v8::PromiseRejectCallback callback) {
                                    reinterpret_cast<void*>(callback));
 }
 
+static bool IsSameGCCallback(const IsolateShim::GCCallbackEntry& a,
+                             const IsolateShim::GCCallbackEntry& b) {
+  return a.callback == b.callback &&
+         a.callbackWithData == b.callbackWithData &&
+         a.data == b.data;
+}
+
+static void RemoveGCCallback(
+    std::vector<IsolateShim::GCCallbackEntry>* callbacks,
+    const IsolateShim::GCCallbackEntry& entry) {
+  for (auto i = callbacks->begin(); i != callbacks->end(); i++) {
+    if (IsSameGCCallback(*i, entry)) {
+      callbacks->erase(i);
+      return;
+    }
+  }
+}
+
+void IsolateShim::AddGCPrologueCallback(const GCCallbackEntry& entry) {
+  EnsureCollectEventCallback();
+  gcPrologueCallbacks.push_back(entry);
+}
+
+void IsolateShim::RemoveGCPrologueCallback(const GCCallbackEntry& entry) {
+  RemoveGCCallback(&gcPrologueCallbacks, entry);
+}
+
+void IsolateShim::AddGCEpilogueCallback(const GCCallbackEntry& entry) {
+  EnsureCollectEventCallback();
+  gcEpilogueCallbacks.push_back(entry);
+}
+
+void IsolateShim::RemoveGCEpilogueCallback(const GCCallbackEntry& entry) {
+  RemoveGCCallback(&gcEpilogueCallbacks, entry);
+}
+
+void IsolateShim::AddNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
+                                           void* data) {
+  if (!hasMemoryAllocationCallback) {
+    CHAKRA_VERIFY_NOERROR(JsSetRuntimeMemoryAllocationCallback(
+        this->GetRuntimeHandle(), this, IsolateShim::MemoryAllocationCallback));
+    CHAKRA_VERIFY_NOERROR(JsGetRuntimeMemoryLimit(this->GetRuntimeHandle(),
+                                                  &initialHeapLimit));
+    hasMemoryAllocationCallback = true;
+  }
+  nearHeapLimitCallbacks.push_back({ callback, data });
+}
+
+void IsolateShim::RemoveNearHeapLimitCallback(
+    v8::NearHeapLimitCallback callback, size_t heapLimit) {
+  for (auto i = nearHeapLimitCallbacks.begin();
+       i != nearHeapLimitCallbacks.end(); i++) {
+    if (i->callback == callback) {
+      nearHeapLimitCallbacks.erase(i);
+      // Like V8, a non zero limit restores the limit the callbacks raised
+      if (heapLimit != 0) {
+        JsSetRuntimeMemoryLimit(this->GetRuntimeHandle(), heapLimit);
+      }
+      return;
+    }
+  }
+}
+
+bool CHAKRA_CALLBACK IsolateShim::MemoryAllocationCallback(
+    void* callbackState, JsMemoryEventType allocationEvent,
+    size_t allocationSize) {
+  IsolateShim* isolateShim = static_cast<IsolateShim*>(callbackState);
+
+  // Page allocations also fail on the JIT and GC background threads, the
+  // embedder callbacks only run on the thread of the isolate. The callback
+  // may allocate itself, which must not call it again.
+  if (allocationEvent != JsMemoryFailure ||
+      isolateShim->nearHeapLimitCallbacks.empty() ||
+      isolateShim->inNearHeapLimitCallback ||
+      IsolateShim::GetCurrent() != isolateShim) {
+    return true;
+  }
+
+  size_t currentHeapLimit;
+  if (!isolateShim->GetMemoryLimit(&currentHeapLimit) ||
+      currentHeapLimit == static_cast<size_t>(-1)) {
+    return true;
+  }
+
+  const NearHeapLimitCallbackEntry& entry =
+    isolateShim->nearHeapLimitCallbacks.back();
+  isolateShim->inNearHeapLimitCallback = true;
+  size_t newHeapLimit = entry.callback(entry.data, currentHeapLimit,
+                                       isolateShim->initialHeapLimit);
+  isolateShim->inNearHeapLimitCallback = false;
+
+  if (newHeapLimit > currentHeapLimit) {
+    JsSetRuntimeMemoryLimit(isolateShim->GetRuntimeHandle(), newHeapLimit);
+  }
+  return true;
+}
+
+void IsolateShim::EnsureCollectEventCallback() {
+  // Registered once and left in place; with no callbacks registered the
+  // notification is a cheap no-op.
+  if (!hasCollectEventCallback) {
+    CHAKRA_VERIFY_NOERROR(JsSetRuntimeCollectEventCallback(
+        this->GetRuntimeHandle(), this, IsolateShim::JsCollectEventCallback));
+    hasCollectEventCallback = true;
+  }
+}
+
+void CHAKRA_CALLBACK IsolateShim::JitEventCallback(const JsJitEvent* event,
+                                                   void* callbackState) {
+  if (!IsEngineTraceCategoryEnabled()) {
+    return;
+  }
+
+  const JsJitFunctionStatistics* function = event->function;
+  std::string location = function->name != nullptr ? function->name : "";
+  location += " ";
+  location += function->url != nullptr ? function->url : "";
+  location += ":" + std::to_string(function->line + 1) +
+              ":" + std::to_string(function->column + 1);
+
+  if (event->type == JsJitEventLoopBodyJitted) {
+    AddEngineTraceEvent("ChakraCore.LoopBodyJitted", "function",
+                        location.c_str(), "queueTime", event->queueTime);
+  } else {
+    AddEngineTraceEvent(event->fromLoopBody ? "ChakraCore.LoopBodyBailOut" :
+                                              "ChakraCore.BailOut",
+                        "function", location.c_str(),
+                        "kind", event->bailOutKind);
+    if (event->rejitReason != nullptr) {
+      AddEngineTraceEvent("ChakraCore.Rejit", "function", location.c_str(),
+                          "reason", event->rejitReason);
+    }
+  }
+}
+
+void CHAKRA_CALLBACK IsolateShim::JsCollectEventCallback(
+    JsCollectEventType eventType, JsCollectKind collectKind,
+    void* callbackState) {
+  IsolateShim* isolateShim = static_cast<IsolateShim*>(callbackState);
+
+  // A partial collection only visits recently allocated objects, which is
+  // the closest thing chakra has to a scavenge. A full concurrent collection
+  // marks in the background like v8's incremental marking.
+  v8::GCType type;
+  const char* traceName;
+  if (collectKind & JsCollectKindPartial) {
+    type = v8::kGCTypeScavenge;
+    traceName = "ChakraCore.GCScavenge";
+  } else if (collectKind & JsCollectKindConcurrent) {
+    type = v8::kGCTypeIncrementalMarking;
+    traceName = "ChakraCore.GCIncrementalMarking";
+  } else {
+    type = v8::kGCTypeMarkSweepCompact;
+    traceName = "ChakraCore.GCMarkSweepCompact";
+  }
+
+  AddEngineTraceEvent(eventType == JsCollectEventBegin ? 'B' : 'E',
+                      traceName);
+
+  isolateShim->InvokeGCCallbacks(eventType == JsCollectEventBegin ?
+                                     isolateShim->gcPrologueCallbacks :
+                                     isolateShim->gcEpilogueCallbacks,
+                                 type);
+}
+
+void IsolateShim::InvokeGCCallbacks(
+    const std::vector<GCCallbackEntry>& liveCallbacks, v8::GCType type) {
+  // The recycler is collecting; callbacks must not touch the JS heap. They
+  // may add or remove GC callbacks though, so walk a copy of the list.
+  const std::vector<GCCallbackEntry> callbacks(liveCallbacks);
+  v8::Isolate* isolate = ToIsolate(this);
+  for (size_t i = 0; i < callbacks.size(); i++) {
+    const GCCallbackEntry& entry = callbacks[i];
+    if ((entry.gcTypeFilter & type) == 0) {
+      continue;
+    }
+
+    if (entry.callbackWithData != nullptr) {
+      entry.callbackWithData(isolate, type, v8::kNoGCCallbackFlags,
+                             entry.data);
+    } else {
+      entry.callback(isolate, type, v8::kNoGCCallbackFlags);
+    }
+  }
+}
+
+class SecondPassWeakCallbacksTask : public v8::Task {
+ public:
+  explicit SecondPassWeakCallbacksTask(IsolateShim* isolateShim)
+      : isolateShim(isolateShim) {}
+
+  void Run() override { isolateShim->RunSecondPassWeakCallbacks(); }
+
+ private:
+  IsolateShim* isolateShim;
+};
+
+void IsolateShim::QueueSecondPassWeakCallback(
+    v8::WeakCallbackInfo<void>::Callback callback, void* parameter) {
+  // Without a platform there's nowhere to run them once the collection is
+  // over; they were never run before either.
+  if (v8::g_platform == nullptr) {
+    return;
+  }
+
+  if (secondPassWeakCallbacks.empty()) {
+    v8::g_platform->CallOnForegroundThread(
+        ToIsolate(this), new SecondPassWeakCallbacksTask(this));
+  }
+  secondPassWeakCallbacks.push_back({ callback, parameter });
+}
+
+void IsolateShim::RunSecondPassWeakCallbacks() {
+  // The callbacks may make other handles weak and a collection may queue
+  // more, which then go to a new task
+  std::vector<SecondPassWeakCallback> callbacks;
+  callbacks.swap(secondPassWeakCallbacks);
+
+  v8::Isolate* isolate = ToIsolate(this);
+  void* fields[v8::kInternalFieldsInWeakCallback] = {};
+  for (const SecondPassWeakCallback& entry : callbacks) {
+    v8::WeakCallbackInfo<void> info(isolate, entry.parameter, fields,
+                                    nullptr);
+    entry.callback(info);
+  }
+}
+
 void IsolateShim::RunMicrotasks() {
+  if (this->hasPromiseJobQueue) {
+    if (this->hasPendingPromiseJobs) {
+      // ChakraCore runs all of them, including the ones they queue, without
+      // leaving script in between, and only tells us about the next one.
+      this->hasPendingPromiseJobs = false;
+      if (JsRunPromiseJobs() != JsNoError) {
+        // The remaining tasks are still queued.
+        this->hasPendingPromiseJobs = true;
+      }
+    }
+    return;
+  }
+
   // Loop until we've handled all the tasks, including the ones
   // added by these tasks
   while (!this->microtaskQueue.empty()) {
@@ -688,9 +1269,30 @@ void IsolateShim::RunMicrotasks() {
 }
 
 void IsolateShim::QueueMicrotask(JsValueRef task) {
+  if (this->hasPromiseJobQueue) {
+    JsEnqueuePromiseJob(task);
+    return;
+  }
+
   this->microtaskQueue.emplace_back(task);
 }
 
+void IsolateShim::EnablePromiseJobQueue() {
+  // Not supported while TTD records or replays, the tasks go through the
+  // promise continuation callback then.
+  if (!this->hasPromiseJobQueue &&
+      JsSetPromiseJobsPendingCallback(PromiseJobsPendingCallback,
+                                      this) == JsNoError) {
+    this->hasPromiseJobQueue = true;
+  }
+}
+
+/*static*/
+void CHAKRA_CALLBACK IsolateShim::PromiseJobsPendingCallback(
+    void* callbackState) {
+  static_cast<IsolateShim*>(callbackState)->hasPendingPromiseJobs = true;
+}
+
 /*static*/
 bool IsolateShim::RunSingleStepOfReverseMoveLoop(v8::Isolate* isolate,
                                                  uint64_t* moveMode,
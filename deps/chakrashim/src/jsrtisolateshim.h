@@ -22,6 +22,7 @@
 #define DEPS_CHAKRASHIM_SRC_JSRTISOLATESHIM_H_
 
 #include "uv.h"
+#include "jsrthandlestack.h"
 #include <vector>
 
 // CHAKRA-TODO : now that node is using libc++ for C++11 support can we remove
@@ -44,6 +45,11 @@ extern bool g_disableIdleGc;
 
 namespace jsrt {
 
+class CpuProfilerShim;
+class SamplingHeapProfilerShim;
+class ByteCodeCache;
+class DynamicProfileCache;
+
 enum CachedPropertyIdRef : int {
 #define DEF(x, ...) x,
 #include "jsrtcachedpropertyidref.inc"
@@ -62,7 +68,32 @@ class IsolateShim {
   bool NewContext(JsContextRef * context, bool exposeGC, bool useGlobalTTState,
                                JsValueRef globalObjectTemplateInstance);
   bool GetMemoryUsage(size_t * memoryUsage);
+  bool GetMemoryLimit(size_t * memoryLimit);
+  bool GetHeapSpaceStatistics(JsHeapSpaceStatistics * statistics);
+  // Reading the statistics walks the whole heap, so callers that go through
+  // the spaces one at a time get them from one snapshot of all spaces. It is
+  // taken again for space 0, or after InvalidateHeapSpaceStatistics().
+  bool GetHeapSpaceStatistics(size_t index, JsHeapSpaceStatistics * statistics);
+  void InvalidateHeapSpaceStatistics() { hasHeapSpaceStatistics = false; }
+  // Bytes the embedder allocated for script objects; growth is reported to
+  // the recycler so that it counts towards the next collection
+  int64_t AdjustExternalMemory(int64_t changeInBytes);
+  int64_t GetExternalMemory() const { return externalMemory; }
+  // Per function loop body JIT, bailout and rejit counters, whose events also
+  // go to the trace log, and the log of the last bailouts
+  bool SetJitStatisticsEnabled(bool enabled);
+  bool EnumerateJitStatistics(JsJitStatisticsCallback callback,
+                              void* callbackState, bool reset);
+  bool EnumerateDeoptLog(JsJitDeoptLogCallback callback, void* callbackState,
+                         bool reset, unsigned int* deoptCount);
+  // Drops the bytecode of inactive functions, they are parsed again on use
+  bool RedeferInactiveFunctions(unsigned int* functionCount,
+                                size_t* freedBytes);
   void CollectGarbage();
+  // Does idle GC work for at most |idleTimeInMs|. Returns the milliseconds
+  // until more idle work is worth doing, or -1 when there is nothing left to
+  // do until script runs again.
+  int IdleNotification(unsigned int idleTimeInMs);
   bool Dispose();
   bool IsDisposing();
 
@@ -105,6 +136,10 @@ class IsolateShim {
   JsPropertyIdRef GetCachedPropertyIdRef(
     CachedPropertyIdRef cachedPropertyIdRef);
 
+  // Property cache for gets and sets of the property from native code, or
+  // JS_INVALID_REFERENCE if one could not be made
+  JsPropertyCacheRef GetPropertyCache(JsPropertyIdRef propertyIdRef);
+
   void RequestInterrupt(v8::InterruptCallback callback, void* data);
   void DisableExecution();
   bool IsExeuctionDisabled();
@@ -122,11 +157,26 @@ class IsolateShim {
     }
   }
 
+  // Weak callbacks run while the recycler is collecting. The second pass
+  // callbacks they ask for are queued and run together from one foreground
+  // task once the collection is over, when they may use the heap again.
+  bool IsInWeakCallback() const { return inWeakCallback; }
+  void SetInWeakCallback(bool value) { inWeakCallback = value; }
+  void QueueSecondPassWeakCallback(
+      v8::WeakCallbackInfo<void>::Callback callback, void* parameter);
+  void RunSecondPassWeakCallbacks();
+
   void RunMicrotasks();
   void QueueMicrotask(JsValueRef task);
+  void EnablePromiseJobQueue();
 
   JsValueRef GetChakraShimJsArrayBuffer();
   JsValueRef GetChakraInspectorShimJsArrayBuffer();
+  // Parses chakra_shim.js for a new context like JsParse. The byte code is
+  // kept once a second context needs it, and later contexts deserialize it
+  // instead of parsing the source again.
+  JsErrorCode ParseChakraShimJs(JsSourceContext sourceContext,
+                                JsValueRef url, JsValueRef* result);
 
   void SetData(unsigned int slot, void* data);
   void* GetData(unsigned int slot);
@@ -164,8 +214,79 @@ class IsolateShim {
     return isIdleGcScheduled;
   }
 
+  // Set once the embedder drives idle GC through idle notifications, the
+  // timer based idle GC is not used after that
+  inline bool IsIdleNotificationEnabled() {
+    return isIdleNotificationEnabled;
+  }
+
   void SetPromiseRejectCallback(v8::PromiseRejectCallback callback);
 
+  // Only one of callback/callbackWithData is set on a registration
+  struct GCCallbackEntry {
+    v8::Isolate::GCCallback callback;
+    v8::Isolate::GCCallbackWithData callbackWithData;
+    void* data;
+    v8::GCType gcTypeFilter;
+  };
+
+  void AddGCPrologueCallback(const GCCallbackEntry& entry);
+  void RemoveGCPrologueCallback(const GCCallbackEntry& entry);
+  void AddGCEpilogueCallback(const GCCallbackEntry& entry);
+  void RemoveGCEpilogueCallback(const GCCallbackEntry& entry);
+
+  // Called when an allocation fails at the runtime memory limit, the most
+  // recently added callback may raise the limit before the engine retries
+  void AddNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
+                                void* data);
+  void RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
+                                   size_t heapLimit);
+
+  // The profiler returned by Isolate::GetCpuProfiler, created on first use
+  CpuProfilerShim* GetCpuProfiler();
+  // The profiler currently receiving the runtime's samples, if any
+  CpuProfilerShim* GetSamplingCpuProfiler() {
+    return samplingCpuProfiler;
+  }
+  void SetSamplingCpuProfiler(CpuProfilerShim* profiler) {
+    samplingCpuProfiler = profiler;
+  }
+  // Backs the sampling heap profiler of v8::HeapProfiler, created on first use
+  SamplingHeapProfilerShim* GetSamplingHeapProfiler();
+  // Set when profiles are kept across runs (--profile-cache-dir)
+  DynamicProfileCache* GetProfileCache() {
+    return profileCache;
+  }
+
+  // Sources of functions run from a code cache, the engine asks for them when
+  // it first needs the text of a function. Each is held until the engine has
+  // taken it or is done with the script, or until ReleaseCodeCacheSource when
+  // the code cache was rejected.
+  void SetCodeCacheSource(JsSourceContext sourceContext, JsValueRef source);
+  JsValueRef GetCodeCacheSource(JsSourceContext sourceContext);
+  void ReleaseCodeCacheSource(JsSourceContext sourceContext);
+  // JsSerializedLoadScriptCallback and JsSerializedScriptUnloadCallback for
+  // the above
+  static bool CHAKRA_CALLBACK LoadCodeCacheSource(
+    JsSourceContext sourceContext, JsValueRef* value,
+    JsParseScriptAttributes* parseAttributes);
+  static void CHAKRA_CALLBACK UnloadCodeCacheSource(
+    JsSourceContext sourceContext);
+  // Wrapper source of the function CompileFunctionInContext last compiled
+  // with kEagerCompile, for CreateCodeCacheForFunction. Only the latest one
+  // is held, callers ask for the code cache right after compiling.
+  void SetEagerCompileSource(JsValueRef function, JsValueRef source);
+  JsValueRef GetEagerCompileSource(JsValueRef function);
+  void ReleaseEagerCompileSource();
+  // Set when script byte code is kept across runs (--chakra-bytecode-cache)
+  ByteCodeCache* GetByteCodeCache() {
+    return byteCodeCache;
+  }
+  // Where HandleScopes keep the refs that don't fit on the native stack
+  HandleStack* GetHandleStack() {
+    return &handleStack;
+  }
+
  private:
   struct MicroTask {
     explicit MicroTask(JsValueRef task) : task(task) {
@@ -194,13 +315,50 @@ class IsolateShim {
   static v8::Isolate * ToIsolate(IsolateShim * isolate);
   static void CHAKRA_CALLBACK JsContextBeforeCollectCallback(JsRef contextRef,
                                                              void* data);
+  static void CHAKRA_CALLBACK PromiseJobsPendingCallback(void* callbackState);
   static void CHAKRA_CALLBACK PromiseRejectionCallback(
       JsValueRef promise, JsValueRef reason, bool handled, void* callbackState);
+  static void CHAKRA_CALLBACK JsCollectEventCallback(
+      JsCollectEventType eventType, JsCollectKind collectKind,
+      void* callbackState);
+  void EnsureCollectEventCallback();
+  static void CHAKRA_CALLBACK JitEventCallback(const JsJitEvent* event,
+                                              void* callbackState);
+  void InvokeGCCallbacks(const std::vector<GCCallbackEntry>& callbacks,
+                         v8::GCType type);
+  // JsSerializedLoadScriptCallback for the byte code of chakra_shim.js
+  static bool CHAKRA_CALLBACK LoadChakraShimSource(
+    JsSourceContext sourceContext, JsValueRef* value,
+    JsParseScriptAttributes* parseAttributes);
+  static bool CHAKRA_CALLBACK MemoryAllocationCallback(
+      void* callbackState, JsMemoryEventType allocationEvent,
+      size_t allocationSize);
+
+  struct NearHeapLimitCallbackEntry {
+    v8::NearHeapLimitCallback callback;
+    void* data;
+  };
 
   JsRuntimeHandle runtime;
   JsPropertyIdRef symbolPropertyIdRefs[CachedSymbolPropertyIdRef::SymbolCount];
   JsPropertyIdRef cachedPropertyIdRefs[CachedPropertyIdRef::Count];
+
+  // Native code reads and writes the same few properties (callbacks such as
+  // oncomplete, fields of options objects) from objects of the same few
+  // shapes over and over, so each property gets its own inline caches. The
+  // table is indexed by property id; a property that collides with another
+  // replaces its cache. The caches don't keep the contexts they were used
+  // from alive, see JsCreatePropertyCache.
+  static const size_t kPropertyCacheCount = 256;
+  struct PropertyCacheEntry {
+    JsPropertyIdRef propertyIdRef;
+    JsPropertyCacheRef propertyCache;
+  };
+  PropertyCacheEntry propertyCaches[kPropertyCacheCount];
   bool isDisposing;
+  int64_t externalMemory = 0;
+  JsHeapSpaceStatistics heapSpaceStatistics[JsHeapSpaceCount];
+  bool hasHeapSpaceStatistics = false;
 
   ContextShim::Scope * contextScopeStack;
   IsolateShim ** prevnext;
@@ -224,7 +382,43 @@ class IsolateShim {
   uv_timer_t idleGc_timer_handle_;
   bool jsScriptExecuted = false;
   bool isIdleGcScheduled = false;
+  bool isIdleNotificationEnabled = false;
   std::vector<MicroTask> microtaskQueue;
+  // Set when ChakraCore queues the microtasks itself, microtaskQueue is
+  // unused then.
+  bool hasPromiseJobQueue = false;
+  bool hasPendingPromiseJobs = false;
+  std::vector<GCCallbackEntry> gcPrologueCallbacks;
+  std::vector<GCCallbackEntry> gcEpilogueCallbacks;
+  bool hasCollectEventCallback = false;
+  std::vector<NearHeapLimitCallbackEntry> nearHeapLimitCallbacks;
+  size_t initialHeapLimit = 0;
+  bool hasMemoryAllocationCallback = false;
+  bool inNearHeapLimitCallback = false;
+  struct SecondPassWeakCallback {
+    v8::WeakCallbackInfo<void>::Callback callback;
+    void* parameter;
+  };
+  bool inWeakCallback = false;
+  std::vector<SecondPassWeakCallback> secondPassWeakCallbacks;
+  CpuProfilerShim* cpuProfiler = nullptr;
+  CpuProfilerShim* samplingCpuProfiler = nullptr;
+  SamplingHeapProfilerShim* samplingHeapProfiler = nullptr;
+  DynamicProfileCache* profileCache = nullptr;
+  ByteCodeCache* byteCodeCache = nullptr;
+  std::unordered_map<JsSourceContext, JsValueRef> codeCacheSources;
+  // Unloaded while the recycler was collecting, released at the next call to
+  // SetCodeCacheSource or IdleNotification
+  std::vector<JsSourceContext> unloadedCodeCacheSources;
+  void ReleaseUnloadedCodeCacheSources();
+  JsValueRef eagerCompileFunction = JS_INVALID_REFERENCE;
+  JsValueRef eagerCompileSource = JS_INVALID_REFERENCE;
+  // Byte code of chakra_shim.js shared by the contexts of the runtime, not
+  // used when recording or replaying
+  std::vector<uint8_t> chakraShimByteCode;
+  bool chakraShimParsed = false;
+  bool shareChakraShimByteCode = false;
+  HandleStack handleStack;
 };
 }  // namespace jsrt
 
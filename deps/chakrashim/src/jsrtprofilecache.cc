@@ -0,0 +1,179 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#include "v8chakra.h"
+#include "jsrtprofilecache.h"
+#include <stdio.h>
+#include <algorithm>
+
+namespace jsrt {
+
+DynamicProfileCache::DynamicProfileCache(const std::string& directory)
+    : directory(directory) {
+}
+
+DynamicProfileCache::~DynamicProfileCache() {
+  for (JsContextRef context : collectedContexts) {
+    JsRelease(context, nullptr);
+  }
+}
+
+void DynamicProfileCache::OnCompile(JsSourceContext sourceContext,
+                                    JsValueRef url, const void* source,
+                                    size_t sourceLength) {
+  StringUtf8 urlUtf8;
+  if (urlUtf8.From(url) != JsNoError || urlUtf8.length() == 0) {
+    // Anonymous scripts (eval, REPL input) are not worth keeping
+    return;
+  }
+
+  JsContextRef context;
+  if (JsGetCurrentContext(&context) != JsNoError) {
+    return;
+  }
+
+  uint64_t urlHash = HashBytes(*urlUtf8, urlUtf8.length());
+  uint64_t hash = HashBytes(source, sourceLength, urlHash);
+  auto it = std::find_if(entries.begin(), entries.end(),
+                         [&](const Entry& entry) {
+    return entry.context == context && entry.urlHash == urlHash;
+  });
+  if (it != entries.end()) {
+    // E.g. a vm script run again; it starts from the profile of the last run
+    SaveEntry(*it);
+    it->sourceContext = sourceContext;
+    it->hash = hash;
+  } else {
+    entries.push_back({ context, sourceContext, urlHash, hash });
+  }
+
+  std::vector<char> data;
+  if (ReadFile(GetPath(hash), &data) && !data.empty()) {
+    // A profile from another engine build is rejected and rewritten on Save
+    JsLoadDynamicProfile(sourceContext, url,
+                         reinterpret_cast<const BYTE*>(data.data()),
+                         static_cast<unsigned int>(data.size()));
+  }
+}
+
+bool DynamicProfileCache::OnContextCollect(JsContextRef context) {
+  bool hasEntries = std::any_of(entries.begin(), entries.end(),
+                                [&](const Entry& entry) {
+    return entry.context == context;
+  });
+  if (!hasEntries || JsAddRef(context, nullptr) != JsNoError) {
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [&](const Entry& entry) {
+      return entry.context == context;
+    }), entries.end());
+    return false;
+  }
+
+  collectedContexts.push_back(context);
+  return true;
+}
+
+void DynamicProfileCache::SaveCollected() {
+  if (collectedContexts.empty()) {
+    return;
+  }
+
+  JsContextRef current;
+  if (JsGetCurrentContext(&current) != JsNoError) {
+    return;
+  }
+
+  std::vector<JsContextRef> contexts;
+  contexts.swap(collectedContexts);
+  for (JsContextRef context : contexts) {
+    if (JsSetCurrentContext(context) == JsNoError) {
+      for (const Entry& entry : entries) {
+        if (entry.context == context) {
+          SaveEntry(entry);
+        }
+      }
+    }
+
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [&](const Entry& entry) {
+      return entry.context == context;
+    }), entries.end());
+  }
+
+  JsSetCurrentContext(current);
+  for (JsContextRef context : contexts) {
+    JsRelease(context, nullptr);
+  }
+}
+
+void DynamicProfileCache::Save() {
+  JsContextRef current;
+  if (JsGetCurrentContext(&current) != JsNoError) {
+    return;
+  }
+
+  for (auto& entry : entries) {
+    if (JsSetCurrentContext(entry.context) == JsNoError) {
+      SaveEntry(entry);
+    }
+  }
+
+  JsSetCurrentContext(current);
+}
+
+void DynamicProfileCache::SaveEntry(const Entry& entry) const {
+  JsValueRef buffer;
+  BYTE* data;
+  unsigned int length;
+  if (JsSerializeDynamicProfile(entry.sourceContext, &buffer) == JsNoError &&
+      JsGetArrayBufferStorage(buffer, &data, &length) == JsNoError) {
+    WriteFileAtomically(GetPath(entry.hash), data, length);
+  }
+}
+
+std::string DynamicProfileCache::GetPath(uint64_t hash) const {
+  char name[32];
+  snprintf(name, sizeof(name), "%016llx.jsprof",
+           static_cast<unsigned long long>(hash));  // NOLINT(runtime/int)
+  return directory + "/" + name;
+}
+
+bool DynamicProfileCache::ReadFile(const std::string& path,
+                                   std::vector<char>* data) const {
+  FILE* file = fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    return false;
+  }
+
+  bool success = false;
+  if (fseek(file, 0, SEEK_END) == 0) {
+    long size = ftell(file);  // NOLINT(runtime/int)
+    if (size >= 0 && fseek(file, 0, SEEK_SET) == 0) {
+      data->resize(static_cast<size_t>(size));
+      success = fread(data->data(), 1, data->size(), file) == data->size();
+    }
+  }
+
+  fclose(file);
+  return success;
+}
+
+}  // namespace jsrt
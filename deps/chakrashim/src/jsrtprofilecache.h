@@ -0,0 +1,82 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#ifndef DEPS_CHAKRASHIM_SRC_JSRTPROFILECACHE_H_
+#define DEPS_CHAKRASHIM_SRC_JSRTPROFILECACHE_H_
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace jsrt {
+
+// Keeps the engine's dynamic profiles of compiled scripts on disk, so that a
+// later process starts with the type feedback and executed-function set of
+// the previous run. Profiles are stored in |directory| as one file per script,
+// named after a hash of the script url and source.
+class DynamicProfileCache {
+ public:
+  explicit DynamicProfileCache(const std::string& directory);
+  ~DynamicProfileCache();
+
+  // Called in the current context before the script is parsed with
+  // |sourceContext|; loads the stored profile if there is one and remembers
+  // the script for Save. A script compiled again under the same url in the
+  // same context replaces the one before, whose profile is saved first.
+  void OnCompile(JsSourceContext sourceContext, JsValueRef url,
+                 const void* source, size_t sourceLength);
+
+  // Called from the before collect callback of |context|. Remembered scripts
+  // don't keep their context alive; if it has any, this keeps it alive until
+  // SaveCollected() has saved them, and returns true.
+  bool OnContextCollect(JsContextRef context);
+
+  // Writes the profiles of the scripts of the contexts passed to
+  // OnContextCollect, forgets them and lets those contexts go; called when no
+  // script is running
+  void SaveCollected();
+
+  // Writes the profiles of all remembered scripts; called before the runtime
+  // goes away
+  void Save();
+
+ private:
+  struct Entry {
+    JsContextRef context;
+    JsSourceContext sourceContext;
+    uint64_t urlHash;
+    uint64_t hash;
+  };
+
+  // Needs |entry.context| to be the current context
+  void SaveEntry(const Entry& entry) const;
+  std::string GetPath(uint64_t hash) const;
+  bool ReadFile(const std::string& path, std::vector<char>* data) const;
+
+  std::string directory;
+  std::vector<Entry> entries;
+  // Kept alive with JsAddRef until SaveCollected
+  std::vector<JsContextRef> collectedContexts;
+};
+
+}  // namespace jsrt
+
+#endif  // DEPS_CHAKRASHIM_SRC_JSRTPROFILECACHE_H_
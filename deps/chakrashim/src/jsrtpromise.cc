@@ -29,6 +29,7 @@ static void CHAKRA_CALLBACK PromiseContinuationCallback(JsValueRef task,
 }
 
 JsErrorCode InitializePromise() {
+  jsrt::IsolateShim::GetCurrent()->EnablePromiseJobQueue();
   return JsSetPromiseContinuationCallback(
     PromiseContinuationCallback, /*callbackState*/nullptr);
 }
@@ -93,11 +93,53 @@ JsErrorCode CreateProxyTrapConfig(
   return JsNoError;
 }
 
+// The traps the engine can call natively, in JsNativeProxyTrap order
+static const ProxyTraps
+s_nativeProxyTraps[JsNativeProxyTrapCount] = {
+  ProxyTraps::GetOwnPropertyDescriptorTrap,
+  ProxyTraps::DefinePropertyTrap,
+  ProxyTraps::HasTrap,
+  ProxyTraps::GetTrap,
+  ProxyTraps::SetTrap,
+  ProxyTraps::DeletePropertyTrap,
+  ProxyTraps::OwnKeysTrap
+};
+
+// Creates a proxy that calls the given traps directly instead of through a
+// handler object of functions. Returns JsErrorNotImplemented if some trap
+// has no native counterpart or the engine can't create one right now (e.g.
+// while recording or replaying).
+static JsErrorCode CreateNativeProxy(
+    JsValueRef target,
+    const JsNativeFunction config[ProxyTraps::TrapCount],
+    JsValueRef* result) {
+  JsNativeFunction nativeTraps[JsNativeProxyTrapCount];
+  bool hasNativeTrap[ProxyTraps::TrapCount] = {};
+  for (int i = 0; i < JsNativeProxyTrapCount; i++) {
+    nativeTraps[i] = config[s_nativeProxyTraps[i]];
+    hasNativeTrap[s_nativeProxyTraps[i]] = true;
+  }
+
+  // The enumerate trap is not called by the engine anymore
+  hasNativeTrap[ProxyTraps::EnumerateTrap] = true;
+
+  for (int i = 0; i < ProxyTraps::TrapCount; i++) {
+    if (config[i] != nullptr && !hasNativeTrap[i]) {
+      return JsErrorNotImplemented;
+    }
+  }
+
+  return JsCreateNativeProxy(target, nativeTraps, nullptr, result);
+}
+
 JsErrorCode CreateProxy(
     JsValueRef target,
     const JsNativeFunction config[ProxyTraps::TrapCount],
     JsValueRef* result) {
-  JsErrorCode error;
+  JsErrorCode error = CreateNativeProxy(target, config, result);
+  if (error != JsErrorNotImplemented) {
+    return error;
+  }
 
   JsValueRef proxyConfigObj;
   error = CreateProxyTrapConfig(config, &proxyConfigObj);
@@ -0,0 +1,168 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#include "v8chakra.h"
+#include "jsrtscriptstreaming.h"
+#include <vector>
+
+namespace jsrt {
+
+static void CHAKRA_CALLBACK FreeByteCode(void* data) {
+  delete[] static_cast<uint8_t*>(data);
+}
+
+ScriptStreamingData::ScriptStreamingData(
+    v8::ScriptCompiler::ExternalSourceStream* sourceStream,
+    v8::ScriptCompiler::StreamedSource::Encoding encoding)
+    : sourceStream(sourceStream),
+      encoding(encoding),
+      byteCodeLength(0),
+      sourceLength(0) {
+}
+
+void ScriptStreamingData::Parse() {
+  // Nothing runs in this runtime, so it needs no background threads; the
+  // parser has to see the same language features as the isolate's runtime
+  JsRuntimeHandle runtime;
+  if (JsCreateRuntime(static_cast<JsRuntimeAttributes>(
+                        JsRuntimeAttributeDisableBackgroundWork |
+                        JsRuntimeAttributeEnableExperimentalFeatures),
+                      nullptr, &runtime) != JsNoError) {
+    return;
+  }
+
+  JsContextRef context;
+  if (JsCreateContext(runtime, &context) == JsNoError &&
+      JsSetCurrentContext(context) == JsNoError) {
+    if (SerializeSource() != JsNoError) {
+      // Syntax errors are reported when the isolate parses the source
+      byteCode.reset();
+      byteCodeLength = 0;
+    }
+    JsSetCurrentContext(JS_INVALID_REFERENCE);
+  }
+
+  JsDisposeRuntime(runtime);
+}
+
+JsErrorCode ScriptStreamingData::ParseScript(JsValueRef sourceRef,
+                                             JsSourceContext sourceContext,
+                                             JsValueRef sourceUrl,
+                                             JsValueRef* result) {
+  if (byteCode == nullptr) {
+    return JsErrorInvalidArgument;
+  }
+
+  int length;
+  JsErrorCode error = JsGetStringLength(sourceRef, &length);
+  if (error != JsNoError) {
+    return error;
+  }
+  if (length != sourceLength) {
+    // Not the source that was streamed
+    return JsErrorInvalidArgument;
+  }
+
+  // The engine reads functions from the byte code as they are first called,
+  // so the runtime takes the buffer over
+  JsValueRef bufferRef;
+  error = JsCreateExternalArrayBuffer(byteCode.get(), byteCodeLength,
+                                      FreeByteCode, byteCode.get(),
+                                      &bufferRef);
+  if (error != JsNoError) {
+    return error;
+  }
+  byteCode.release();
+
+  IsolateShim::GetCurrent()->SetCodeCacheSource(sourceContext, sourceRef);
+  error = JsParseSerializedWithUnloadCallback(
+    bufferRef, IsolateShim::LoadCodeCacheSource,
+    IsolateShim::UnloadCodeCacheSource, sourceContext, sourceUrl, result);
+  if (error != JsNoError) {
+    IsolateShim::GetCurrent()->ReleaseCodeCacheSource(sourceContext);
+  }
+  return error;
+}
+
+JsErrorCode ScriptStreamingData::CreateSourceString(JsValueRef* result) {
+  // The stream hands over each chunk, allocated with new[]
+  std::vector<uint8_t> source;
+  const uint8_t* chunk = nullptr;
+  size_t chunkLength;
+  while ((chunkLength = sourceStream->GetMoreData(&chunk)) != 0) {
+    source.insert(source.end(), chunk, chunk + chunkLength);
+    delete[] chunk;
+    chunk = nullptr;
+  }
+
+  if (source.empty()) {
+    return JsErrorInvalidArgument;
+  }
+
+  switch (encoding) {
+    case v8::ScriptCompiler::StreamedSource::UTF8:
+      return JsCreateString(reinterpret_cast<const char*>(source.data()),
+                            source.size(), result);
+    case v8::ScriptCompiler::StreamedSource::TWO_BYTE:
+      return JsCreateStringUtf16(
+        reinterpret_cast<const uint16_t*>(source.data()),
+        source.size() / sizeof(uint16_t), result);
+    default: {
+      std::vector<uint16_t> wide(source.begin(), source.end());
+      return JsCreateStringUtf16(wide.data(), wide.size(), result);
+    }
+  }
+}
+
+JsErrorCode ScriptStreamingData::SerializeSource() {
+  JsValueRef sourceRef;
+  JsErrorCode error = CreateSourceString(&sourceRef);
+  if (error != JsNoError) {
+    return error;
+  }
+
+  error = JsGetStringLength(sourceRef, &sourceLength);
+  if (error != JsNoError) {
+    return error;
+  }
+
+  // Parses every function, not only the global code
+  JsValueRef bufferRef;
+  error = JsSerialize(sourceRef, &bufferRef, JsParseScriptAttributeNone);
+  if (error != JsNoError) {
+    return error;
+  }
+
+  uint8_t* buffer;
+  unsigned int bufferLength;
+  error = GetArrayBufferStorage(bufferRef, &buffer, &bufferLength);
+  if (error != JsNoError) {
+    return error;
+  }
+
+  // The buffer goes away with this runtime
+  byteCode.reset(new uint8_t[bufferLength]);
+  memcpy(byteCode.get(), buffer, bufferLength);
+  byteCodeLength = bufferLength;
+  return JsNoError;
+}
+
+}  // namespace jsrt
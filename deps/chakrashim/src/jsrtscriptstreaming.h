@@ -0,0 +1,61 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#ifndef DEPS_CHAKRASHIM_SRC_JSRTSCRIPTSTREAMING_H_
+#define DEPS_CHAKRASHIM_SRC_JSRTSCRIPTSTREAMING_H_
+
+#include <stdint.h>
+#include <memory>
+
+namespace jsrt {
+
+// Backs v8::ScriptCompiler::StreamedSource. The streaming task reads the
+// whole source and compiles it to byte code in a runtime of its own, on the
+// thread running the task; the isolate's thread then only deserializes the
+// byte code, function by function as they are first called.
+class ScriptStreamingData {
+ public:
+  ScriptStreamingData(v8::ScriptCompiler::ExternalSourceStream* sourceStream,
+                      v8::ScriptCompiler::StreamedSource::Encoding encoding);
+
+  // Runs on the streaming thread
+  void Parse();
+
+  // Parses |sourceRef| like JsParse, from the byte code of the streamed
+  // source when there is some and |sourceRef| is the same length
+  JsErrorCode ParseScript(JsValueRef sourceRef, JsSourceContext sourceContext,
+                          JsValueRef sourceUrl, JsValueRef* result);
+
+ private:
+  JsErrorCode CreateSourceString(JsValueRef* result);
+  JsErrorCode SerializeSource();
+
+  v8::ScriptCompiler::ExternalSourceStream* sourceStream;
+  v8::ScriptCompiler::StreamedSource::Encoding encoding;
+  std::unique_ptr<uint8_t[]> byteCode;
+  unsigned int byteCodeLength;
+  // In UTF-16 code units, like JsGetStringLength
+  int sourceLength;
+};
+
+}  // namespace jsrt
+
+#endif  // DEPS_CHAKRASHIM_SRC_JSRTSCRIPTSTREAMING_H_
@@ -0,0 +1,96 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef DEPS_CHAKRASHIM_SRC_JSRTSERIALIZATIONTAG_H_
+#define DEPS_CHAKRASHIM_SRC_JSRTSERIALIZATIONTAG_H_
+
+#include <stdint.h>
+
+namespace jsrt {
+
+// ValueSerializer/ValueDeserializer speak the same wire format as v8 so that
+// data written by node running on one engine can be read back by the other.
+static const uint32_t kSerializerLatestVersion = 13;
+
+enum class SerializationTag : uint8_t {
+  kVersion = 0xFF,
+  kPadding = '\0',
+  kVerifyObjectCount = '?',
+  kTheHole = '-',
+  kUndefined = '_',
+  kNull = '0',
+  kTrue = 'T',
+  kFalse = 'F',
+  kInt32 = 'I',
+  kUint32 = 'U',
+  kDouble = 'N',
+  kUtf8String = 'S',
+  kOneByteString = '"',
+  kTwoByteString = 'c',
+  kObjectReference = '^',
+  kBeginJSObject = 'o',
+  kEndJSObject = '{',
+  kBeginSparseJSArray = 'a',
+  kEndSparseJSArray = '@',
+  kBeginDenseJSArray = 'A',
+  kEndDenseJSArray = '$',
+  kDate = 'D',
+  kTrueObject = 'y',
+  kFalseObject = 'x',
+  kNumberObject = 'n',
+  kStringObject = 's',
+  kRegExp = 'R',
+  kBeginJSMap = ';',
+  kEndJSMap = ':',
+  kBeginJSSet = '\'',
+  kEndJSSet = ',',
+  kArrayBuffer = 'B',
+  kArrayBufferTransfer = 't',
+  kArrayBufferView = 'V',
+  kSharedArrayBuffer = 'u',
+  kHostObject = '\\',
+};
+
+enum class ArrayBufferViewTag : uint8_t {
+  kInt8Array = 'b',
+  kUint8Array = 'B',
+  kUint8ClampedArray = 'C',
+  kInt16Array = 'w',
+  kUint16Array = 'W',
+  kInt32Array = 'd',
+  kUint32Array = 'D',
+  kFloat32Array = 'f',
+  kFloat64Array = 'F',
+  kDataView = '?',
+};
+
+// Bit values of RegExp flags on the wire
+enum RegExpFlag : uint32_t {
+  kRegExpGlobal = 1 << 0,
+  kRegExpIgnoreCase = 1 << 1,
+  kRegExpMultiline = 1 << 2,
+  kRegExpSticky = 1 << 3,
+  kRegExpUnicode = 1 << 4,
+  kRegExpDotAll = 1 << 5,
+};
+
+}  // namespace jsrt
+
+#endif  // DEPS_CHAKRASHIM_SRC_JSRTSERIALIZATIONTAG_H_
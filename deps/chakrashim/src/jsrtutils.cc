@@ -19,6 +19,7 @@
 // IN THE SOFTWARE.
 
 #include <stdarg.h>
+#include <stdio.h>
 #include "jsrtutils.h"
 #include <string>
 #if !defined(_WIN32) && !defined(__APPLE__)
@@ -66,6 +67,30 @@ JsErrorCode GetProperty(JsValueRef ref,
   return JsGetProperty(ref, idRef, result);
 }
 
+JsErrorCode GetPropertyCached(JsValueRef ref,
+                              JsPropertyIdRef propId,
+                              JsValueRef* result) {
+  JsPropertyCacheRef propertyCache =
+    IsolateShim::GetCurrent()->GetPropertyCache(propId);
+  if (propertyCache == JS_INVALID_REFERENCE) {
+    return JsGetProperty(ref, propId, result);
+  }
+
+  return JsGetPropertyCached(ref, propertyCache, result);
+}
+
+JsErrorCode SetPropertyCached(JsValueRef ref,
+                              JsPropertyIdRef propId,
+                              JsValueRef propValue) {
+  JsPropertyCacheRef propertyCache =
+    IsolateShim::GetCurrent()->GetPropertyCache(propId);
+  if (propertyCache == JS_INVALID_REFERENCE) {
+    return JsSetProperty(ref, propId, propValue, false);
+  }
+
+  return JsSetPropertyCached(ref, propertyCache, propValue, false);
+}
+
 JsErrorCode GetProperty(JsValueRef ref,
                         JsPropertyIdRef propId,
                         bool* boolValue) {
@@ -690,19 +715,14 @@ JsErrorCode DefineProperty(JsValueRef object,
 
 JsErrorCode GetPropertyIdFromName(JsValueRef nameRef,
                                   JsPropertyIdRef* idRef) {
-  StringUtf8 str;
-
-  // Expect the name be either a String or a Symbol.
-  JsErrorCode error = str.From(nameRef);
-  if (error != JsNoError) {
-    if (error == JsErrorInvalidArgument) {
-      error = JsGetPropertyIdFromSymbol(nameRef, idRef);
-      if (error == JsErrorPropertyNotSymbol) {
-        error = JsErrorInvalidArgument;  // Neither String nor Symbol
-      }
+  // Expect the name be either a String or a Symbol. Strings remember their
+  // property id, so the lookup is only done once per string.
+  JsErrorCode error = JsGetPropertyIdFromString(nameRef, idRef);
+  if (error == JsErrorInvalidArgument) {
+    error = JsGetPropertyIdFromSymbol(nameRef, idRef);
+    if (error == JsErrorPropertyNotSymbol) {
+      error = JsErrorInvalidArgument;  // Neither String nor Symbol
     }
-  } else {
-    error = JsCreatePropertyId(str, str.length(), idRef);
   }
 
   return error;
@@ -794,6 +814,8 @@ JsErrorCode ParseScript(StringUtf8* script,
                         JsValueRef sourceUrl,
                         bool isStrictMode,
                         JsValueRef* result) {
+  // Parsing also generates the byte code of the top level function
+  EngineTraceScope traceScope("ChakraCore.Compile");
   if (isStrictMode) {
     // do not append new line so the line numbers on error stack are correct
     std::string useStrictTag("'use strict'; ");
@@ -862,6 +884,38 @@ JsErrorCode GetArrayBufferStorage(JsValueRef instance,
   return JsGetArrayBufferStorage(instance, (BYTE**)buffer, bufferLength);
 }
 
+uint64_t HashBytes(const void* data, size_t length, uint64_t hash) {
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < length; i++) {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+bool WriteFileAtomically(const std::string& path, const void* data,
+                         size_t length) {
+  std::string tempPath = path + ".tmp" + std::to_string(uv_os_getpid());
+  FILE* file = fopen(tempPath.c_str(), "wb");
+  if (file == nullptr) {
+    return false;
+  }
+
+  bool success = fwrite(data, 1, length, file) == length;
+  success = (fclose(file) == 0) && success;
+  if (success) {
+    // Unlike rename(), replaces an existing file on Windows as well
+    uv_fs_t req;
+    success = uv_fs_rename(uv_default_loop(), &req, tempPath.c_str(),
+                           path.c_str(), nullptr) == 0;
+    uv_fs_req_cleanup(&req);
+  }
+  if (!success) {
+    remove(tempPath.c_str());
+  }
+  return success;
+}
+
 JsErrorCode GetHiddenValuesTable(JsValueRef object,
                                 JsPropertyIdRef* hiddenValueIdRef,
                                 JsValueRef* hiddenValuesTable,
@@ -1080,6 +1134,11 @@ void IdleGC(uv_timer_t* timerHandler) {
 }
 
 void PrepareIdleGC(uv_prepare_t* prepareHandler) {
+  // The embedder is driving idle GC itself
+  if (IsolateShim::GetCurrent()->IsIdleNotificationEnabled()) {
+    return;
+  }
+
   // If there were no scripts executed, return
   if (!IsolateShim::GetCurrent()->IsJsScriptExecuted()) {
     return;
@@ -25,6 +25,7 @@
 #include <functional>
 #include <stdint.h>
 #include <string.h>
+#include <string>
 #include "v8.h"
 #include "uv.h"
 
@@ -137,6 +138,16 @@ JsErrorCode GetProperty(JsValueRef ref,
                         CachedPropertyIdRef cachedIdRef,
                         JsValueRef* result);
 
+// Gets and sets a property through the isolate's cache for the property id,
+// for properties native code uses over and over
+JsErrorCode GetPropertyCached(JsValueRef ref,
+                              JsPropertyIdRef propId,
+                              JsValueRef* result);
+
+JsErrorCode SetPropertyCached(JsValueRef ref,
+                              JsPropertyIdRef propId,
+                              JsValueRef propValue);
+
 JsErrorCode GetProperty(JsValueRef ref,
                         JsPropertyIdRef propId,
                         bool* boolValue);
@@ -420,6 +431,16 @@ JsErrorCode GetArrayBufferStorage(JsValueRef instance,
                                   uint8_t** buffer,
                                   unsigned int* bufferLength);
 
+// 64-bit FNV-1a, stable across processes and platforms; pass the previous
+// result as |hash| to continue hashing
+uint64_t HashBytes(const void* data, size_t length,
+                   uint64_t hash = 0xcbf29ce484222325ULL);
+
+// Writes next to |path| and renames, so that a process starting concurrently
+// never reads a partial file
+bool WriteFileAtomically(const std::string& path, const void* data,
+                         size_t length);
+
 JsErrorCode GetHiddenValuesTable(JsValueRef object,
                                 JsPropertyIdRef* hiddenValueIdRef,
                                 JsValueRef* hiddenValuesTable,
@@ -445,6 +466,33 @@ void PrepareIdleGC(uv_prepare_t* prepareHandler);
 
 void IdleGC(uv_timer_t* timerHandler);
 
+// Engine trace events, recorded through the platform's tracing controller in
+// the "v8" category. All of these are no-ops while the category is disabled.
+bool IsTracingAvailable();
+bool IsEngineTraceCategoryEnabled();
+
+void AddEngineTraceEvent(char phase, const char* name);
+
+// Instant events with two arguments. The strings are copied.
+void AddEngineTraceEvent(const char* name,
+                         const char* argName1, const char* argValue1,
+                         const char* argName2, const char* argValue2);
+void AddEngineTraceEvent(const char* name,
+                         const char* argName1, const char* argValue1,
+                         const char* argName2, double argValue2);
+
+// Records a complete ('X') event spanning the lifetime of the scope
+class EngineTraceScope {
+ public:
+  explicit EngineTraceScope(const char* name);
+  ~EngineTraceScope();
+
+ private:
+  const char* name;
+  const uint8_t* category;
+  uint64_t handle;
+};
+
 // Arguments buffer for JsCallFunction
 template <int STATIC_COUNT = 4>
 class JsArguments {
@@ -18,6 +18,7 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <string.h>
 #include "v8chakra.h"
 #include "jsrtutils.h"
 
@@ -36,12 +37,13 @@ Local<ArrayBuffer> ArrayBuffer::New(Isolate* isolate, size_t byte_length) {
 }
 
 struct ArrayBufferFinalizeInfo {
-  ArrayBuffer::Allocator* allocator;
+  IsolateShim* isolateShim;
   void* data;
   size_t length;
 
   void Free() {
-    allocator->Free(data, length);
+    isolateShim->arrayBufferAllocator->Free(data, length);
+    isolateShim->AdjustExternalMemory(-static_cast<int64_t>(length));
     delete this;
   }
 };
@@ -62,9 +64,7 @@ Local<ArrayBuffer> ArrayBuffer::New(Isolate* isolate,
 
   if (mode == ArrayBufferCreationMode::kInternalized) {
       ArrayBufferFinalizeInfo info = {
-          jsrt::IsolateShim::FromIsolate(isolate)->arrayBufferAllocator,
-                                       data,
-                                       byte_length };
+          IsolateShim::FromIsolate(isolate), data, byte_length };
       finalizeCallback = ExternalArrayBufferFinalizeCallback;
       callbackState = new ArrayBufferFinalizeInfo(info);
   }
@@ -80,6 +80,11 @@ Local<ArrayBuffer> ArrayBuffer::New(Isolate* isolate,
     }
     return Local<ArrayBuffer>();
   }
+  if (callbackState != nullptr) {
+    // The backing store is now the buffer's, like in v8 it counts as
+    // external memory until the buffer is collected
+    callbackState->isolateShim->AdjustExternalMemory(byte_length);
+  }
   return Local<ArrayBuffer>::New(result);
 }
 
@@ -94,18 +99,16 @@ size_t ArrayBuffer::ByteLength() const {
 }
 
 bool ArrayBuffer::IsExternal() const {
-  CHAKRA_UNIMPLEMENTED();
+  // Chakra keeps ownership of every backing store, see Externalize()
   return false;
 }
 
 bool ArrayBuffer::IsNeuterable() const {
-  CHAKRA_UNIMPLEMENTED();
-  return false;
+  return true;
 }
 
 void ArrayBuffer::Neuter() {
-  CHAKRA_UNIMPLEMENTED();
-  // Chakra: not supported, ignore
+  JsDetachArrayBuffer(this);
 }
 
 ArrayBuffer::Contents ArrayBuffer::GetContents() {
@@ -132,8 +135,19 @@ ArrayBuffer::Contents ArrayBuffer::GetContents() {
 }
 
 ArrayBuffer::Contents ArrayBuffer::Externalize() {
-  CHAKRA_UNIMPLEMENTED();
-  return Contents();
+  // Chakra can't give up the memory of an ArrayBuffer that stays alive, so
+  // hand out a copy owned by the embedder's allocator instead. Callers follow
+  // up with Neuter(), which releases the original.
+  Contents contents = GetContents();
+  void* data = IsolateShim::GetCurrent()->arrayBufferAllocator->
+      AllocateUninitialized(contents.byte_length_);
+  if (data == nullptr) {
+    return Contents();
+  }
+
+  memcpy(data, contents.data_, contents.byte_length_);
+  contents.data_ = data;
+  return contents;
 }
 
 // ENABLE_TTD
@@ -175,11 +175,13 @@ class ObjectData: public ExternalData {
 
   Persistent<ObjectTemplate> objectTemplate;  // Original ObjectTemplate
   SetterGetterInterceptor * setterGetterInterceptor;
+  // Internal fields kept here when the object can't store them itself
   int internalFieldCount;
   FieldValue* internalFields;
 
   ObjectData(ObjectTemplate* objectTemplate, ObjectTemplateData* templateData);
   ~ObjectData();
+  void AllocateInternalFields(int count);
   static void CHAKRA_CALLBACK FinalizeCallback(void* data);
 
   static FieldValue* GetInternalField(Object* object, int index);
@@ -0,0 +1,186 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "v8chakra.h"
+#include "jsrtcpuprofiler.h"
+
+namespace v8 {
+
+using jsrt::IsolateShim;
+using jsrt::CpuProfileNodeShim;
+using jsrt::CpuProfileShim;
+using jsrt::CpuProfilerShim;
+
+static Local<String> NewStringFromUtf8(const std::string& str) {
+  return String::NewFromUtf8(Isolate::GetCurrent(), str.c_str(),
+                             NewStringType::kNormal,
+                             static_cast<int>(str.length())).ToLocalChecked();
+}
+
+Local<String> CpuProfileNode::GetFunctionName() const {
+  return NewStringFromUtf8(CpuProfileNodeShim::FromNode(this)->GetFunctionName());
+}
+
+const char* CpuProfileNode::GetFunctionNameStr() const {
+  return CpuProfileNodeShim::FromNode(this)->GetFunctionName().c_str();
+}
+
+int CpuProfileNode::GetScriptId() const {
+  return CpuProfileNodeShim::FromNode(this)->GetScriptId();
+}
+
+Local<String> CpuProfileNode::GetScriptResourceName() const {
+  return NewStringFromUtf8(CpuProfileNodeShim::FromNode(this)->GetUrl());
+}
+
+const char* CpuProfileNode::GetScriptResourceNameStr() const {
+  return CpuProfileNodeShim::FromNode(this)->GetUrl().c_str();
+}
+
+int CpuProfileNode::GetLineNumber() const {
+  return CpuProfileNodeShim::FromNode(this)->GetLineNumber();
+}
+
+int CpuProfileNode::GetColumnNumber() const {
+  return CpuProfileNodeShim::FromNode(this)->GetColumnNumber();
+}
+
+unsigned int CpuProfileNode::GetHitLineCount() const {
+  return static_cast<unsigned int>(
+    CpuProfileNodeShim::FromNode(this)->GetLineTicks().size());
+}
+
+bool CpuProfileNode::GetLineTicks(LineTick* entries,
+                                  unsigned int length) const {
+  const std::map<int, unsigned>& lineTicks =
+    CpuProfileNodeShim::FromNode(this)->GetLineTicks();
+  if (entries == nullptr || length < lineTicks.size()) {
+    return false;
+  }
+
+  for (auto& lineTick : lineTicks) {
+    entries->line = lineTick.first;
+    entries->hit_count = lineTick.second;
+    entries++;
+  }
+  return true;
+}
+
+const char* CpuProfileNode::GetBailoutReason() const {
+  return "";
+}
+
+unsigned CpuProfileNode::GetHitCount() const {
+  return CpuProfileNodeShim::FromNode(this)->GetHitCount();
+}
+
+unsigned CpuProfileNode::GetNodeId() const {
+  return CpuProfileNodeShim::FromNode(this)->GetNodeId();
+}
+
+int CpuProfileNode::GetChildrenCount() const {
+  return static_cast<int>(
+    CpuProfileNodeShim::FromNode(this)->GetChildren().size());
+}
+
+const CpuProfileNode* CpuProfileNode::GetChild(int index) const {
+  return CpuProfileNodeShim::FromNode(this)->GetChildren()[index]->ToNode();
+}
+
+Local<String> CpuProfile::GetTitle() const {
+  return NewStringFromUtf8(CpuProfileShim::FromProfile(this)->GetTitle());
+}
+
+const CpuProfileNode* CpuProfile::GetTopDownRoot() const {
+  return CpuProfileShim::FromProfile(this)->GetRoot()->ToNode();
+}
+
+int CpuProfile::GetSamplesCount() const {
+  return static_cast<int>(
+    CpuProfileShim::FromProfile(this)->GetSamples().size());
+}
+
+const CpuProfileNode* CpuProfile::GetSample(int index) const {
+  return CpuProfileShim::FromProfile(this)->GetSamples()[index]->ToNode();
+}
+
+int64_t CpuProfile::GetSampleTimestamp(int index) const {
+  return CpuProfileShim::FromProfile(this)->GetTimestamps()[index];
+}
+
+int64_t CpuProfile::GetStartTime() const {
+  return CpuProfileShim::FromProfile(this)->GetStartTime();
+}
+
+int64_t CpuProfile::GetEndTime() const {
+  return CpuProfileShim::FromProfile(this)->GetEndTime();
+}
+
+void CpuProfile::Delete() {
+  delete CpuProfileShim::FromProfile(this);
+}
+
+CpuProfiler* CpuProfiler::New(Isolate* isolate) {
+  return (new CpuProfilerShim(IsolateShim::FromIsolate(isolate)))->ToProfiler();
+}
+
+void CpuProfiler::CollectSample(Isolate* isolate) {
+  CpuProfilerShim* profiler =
+    IsolateShim::FromIsolate(isolate)->GetSamplingCpuProfiler();
+  if (profiler != nullptr) {
+    profiler->CollectSample();
+  }
+}
+
+void CpuProfiler::Dispose() {
+  delete CpuProfilerShim::FromProfiler(this);
+}
+
+void CpuProfiler::SetSamplingInterval(int us) {
+  CpuProfilerShim::FromProfiler(this)->SetSamplingInterval(us);
+}
+
+void CpuProfiler::StartProfiling(Local<String> title, CpuProfilingMode mode,
+                                 bool record_samples) {
+  String::Utf8Value titleUtf8(Isolate::GetCurrent(), title);
+  std::string titleStr(*titleUtf8 != nullptr ? *titleUtf8 : "",
+                       titleUtf8.length());
+  CpuProfilerShim::FromProfiler(this)->StartProfiling(titleStr, mode,
+                                                      record_samples);
+}
+
+void CpuProfiler::StartProfiling(Local<String> title, bool record_samples) {
+  StartProfiling(title, kLeafNodeLineNumbers, record_samples);
+}
+
+CpuProfile* CpuProfiler::StopProfiling(Local<String> title) {
+  String::Utf8Value titleUtf8(Isolate::GetCurrent(), title);
+  std::string titleStr(*titleUtf8 != nullptr ? *titleUtf8 : "",
+                       titleUtf8.length());
+  CpuProfileShim* profile =
+    CpuProfilerShim::FromProfiler(this)->StopProfiling(titleStr);
+  return profile != nullptr ? profile->ToProfile() : nullptr;
+}
+
+void CpuProfiler::SetIdle(bool is_idle) {
+  CpuProfilerShim::FromProfiler(this)->SetIdle(is_idle);
+}
+
+}  // namespace v8
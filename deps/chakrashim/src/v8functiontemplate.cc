@@ -38,6 +38,8 @@ class FunctionCallbackData : public ExternalData {
 
   Persistent<ObjectTemplate> instanceTemplate;
   Persistent<Object> prototype;
+  // The context the function is created in, which it is called in
+  ContextShim* contextShim;
 
  public:
   FunctionCallbackData(FunctionCallback callback,
@@ -48,7 +50,8 @@ class FunctionCallbackData : public ExternalData {
         callback(callback),
         data(nullptr, data),
         signature(nullptr, signature),
-        instanceTemplate(nullptr, instanceTemplate) {
+        instanceTemplate(nullptr, instanceTemplate),
+        contextShim(ContextShim::GetCurrent()) {
   }
 
   ~FunctionCallbackData() {
@@ -97,17 +100,28 @@ class FunctionCallbackData : public ExternalData {
       void* callbackState) {
     CHAKRA_VERIFY(argumentCount >= 1);
 
-    // Script engine could have switched context. Make sure to invoke the
-    // CHAKRA_CALLBACK in the current callee context.
-    ContextShim* contextShim = IsolateShim::GetContextShimOfObject(callee);
-    ContextShim::Scope contextScope(contextShim);
-    HandleScope scope(Isolate::GetCurrent());
+    // The function owns its FunctionCallbackData
+    FunctionCallbackData* callbackData =
+      static_cast<FunctionCallbackData*>(callbackState);
+    CHAKRA_ASSERT(ExternalData::Is(callbackData));
 
-    FunctionCallbackData* callbackData = nullptr;
-    if (!ExternalData::TryGet(JsValueRef(callbackState), &callbackData)) {
-      CHAKRA_ASSERT(false);  // This should never happen
-      return JS_INVALID_REFERENCE;
+    // Script engine could have switched context. Make sure to invoke the
+    // CHAKRA_CALLBACK in the callee context, which is usually current already.
+    ContextShim* contextShim = callbackData->contextShim;
+    if (contextShim->GetIsolateShim()->GetCurrentContextShim() != contextShim) {
+      ContextShim::Scope contextScope(contextShim);
+      return Invoke(callbackData, callee, arguments, argumentCount, info);
     }
+    return Invoke(callbackData, callee, arguments, argumentCount, info);
+  }
+
+ private:
+  static JsValueRef Invoke(FunctionCallbackData* callbackData,
+                           JsValueRef callee,
+                           JsValueRef* arguments,
+                           unsigned short argumentCount,  // NOLINT(runtime/int)
+                           JsNativeFunctionInfo* info) {
+    HandleScope scope(Isolate::GetCurrent());
 
     Local<Object> thisPointer;
     Local<Function> newTargetPointer = info->newTargetArg;
@@ -235,25 +249,17 @@ class FunctionTemplateData : public TemplateData {
       FunctionCallbackData* callbackData =
         new FunctionCallbackData(callback, data, signature, instanceTemplate);
 
-      JsValueRef funcCallbackObjectRef;
-      JsErrorCode error = JsCreateExternalObject(
-        callbackData,
-        FunctionCallbackData::FinalizeCallback,
-        &funcCallbackObjectRef);
-      if (error != JsNoError) {
-        delete callbackData;
-        return nullptr;
-      }
-
       JsValueRef function = nullptr;
       {
-        error = JsCreateEnhancedFunction(
+        JsErrorCode error = JsCreateEnhancedFunctionWithFinalizer(
           FunctionCallbackData::FunctionInvoked,
           this->className.IsEmpty() ? JS_INVALID_REFERENCE : *this->className,
-          funcCallbackObjectRef,
+          callbackData,
+          FunctionCallbackData::FinalizeCallback,
           &function);
 
         if (error != JsNoError) {
+          delete callbackData;
           return nullptr;
         }
       }
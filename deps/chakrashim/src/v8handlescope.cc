@@ -29,16 +29,28 @@ HandleScope::HandleScope(Isolate* isolate)
     : _prev(current),
       _locals(),
       _count(0),
+      _handleStack(nullptr),
+      _handleStackMark(nullptr),
+      _escapedValue(JS_INVALID_REFERENCE),
       _contextRef(JS_INVALID_REFERENCE),
       _addRefRecordHead(nullptr) {
   CHAKRA_ASSERT(isolate == Isolate::GetCurrent());
-  _locals[0] = JS_INVALID_REFERENCE;
   current = this;
 }
 
 HandleScope::~HandleScope() {
   current = _prev;
 
+  if (_handleStack != nullptr) {
+    _handleStack->PopTo(_handleStackMark);
+  }
+
+  if (_escapedValue != JS_INVALID_REFERENCE) {
+    bool added = _prev->AddLocal(_escapedValue);
+    CHAKRA_ASSERT(added);
+    UNUSED(added);
+  }
+
   AddRefRecord * currRecord = this->_addRefRecordHead;
   while (currRecord != nullptr) {
     AddRefRecord * nextRecord = currRecord->_next;
@@ -61,25 +73,33 @@ Isolate* HandleScope::GetIsolate() const {
 
 
 bool HandleScope::AddLocal(JsValueRef value) {
-  // _locals is full, save them in _locals[0]
-  if (_count == kOnStackLocals) {
-    if (_locals[0] == JS_INVALID_REFERENCE) {
-      if (JsCreateArray(0, &_locals[0]) != JsNoError) {
-        return AddLocalAddRef(value);
-      }
-    }
-
-    JsValueRef arrayPushFunction =
-        jsrt::ContextShim::GetCurrent()->GetArrayPushFunction();
+  if (_count < kOnStackLocals) {
+    _locals[_count++] = value;
+    return true;
+  }
 
-    JsValueRef result;
-    if (JsCallFunction(arrayPushFunction, _locals,
-                       _countof(_locals), &result) != JsNoError) {
+  if (current != this) {
+    // Close() of the scope above this one. Until that scope is gone, its refs
+    // may be above ours on the handle stack, so the value waits in it.
+    if (current->_prev != this ||
+        current->_escapedValue != JS_INVALID_REFERENCE) {
       return AddLocalAddRef(value);
     }
-    _count = 0;
+    if (current->_handleStack != nullptr) {
+      current->_escapedValue = value;
+      return true;
+    }
+  }
+
+  // The refs of scopes above this one are popped by now, so the top is where
+  // this scope's refs start
+  if (_handleStack == nullptr) {
+    _handleStack = jsrt::IsolateShim::GetCurrent()->GetHandleStack();
+    _handleStackMark = _handleStack->Top();
+  }
+  if (!_handleStack->Push(value)) {
+    return AddLocalAddRef(value);
   }
-  _locals[1 + _count++] = value;
   return true;
 }
 
@@ -0,0 +1,97 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "v8chakra.h"
+#include "jsrtheapprofiler.h"
+#include <algorithm>
+
+namespace v8 {
+
+using jsrt::IsolateShim;
+
+namespace {
+
+struct SerializeState {
+  OutputStream* stream;
+  bool aborted;
+};
+
+// The runtime writes up to 64KB at a time, hand it to the stream in pieces of
+// the chunk size it asked for
+bool CHAKRA_CALLBACK WriteSnapshotChunk(const char* chunk, size_t length,
+                                        void* callbackState) {
+  SerializeState* state = static_cast<SerializeState*>(callbackState);
+  const size_t chunkSize =
+    static_cast<size_t>(std::max(state->stream->GetChunkSize(), 1));
+
+  while (length > 0) {
+    int size = static_cast<int>(std::min(length, chunkSize));
+    if (state->stream->WriteAsciiChunk(const_cast<char*>(chunk), size) ==
+        OutputStream::kAbort) {
+      state->aborted = true;
+      return false;
+    }
+    chunk += size;
+    length -= size;
+  }
+
+  return true;
+}
+
+}  // namespace
+
+const HeapSnapshot* HeapProfiler::TakeHeapSnapshot(
+    ActivityControl* control,
+    ObjectNameResolver* global_object_name_resolver) {
+  return new HeapSnapshot(Isolate::GetCurrent());
+}
+
+bool HeapProfiler::StartSamplingHeapProfiler(uint64_t sample_interval,
+                                             int stack_depth,
+                                             SamplingFlags flags) {
+  return IsolateShim::GetCurrent()->GetSamplingHeapProfiler()->StartSampling(
+    sample_interval, stack_depth, flags);
+}
+
+void HeapProfiler::StopSamplingHeapProfiler() {
+  IsolateShim::GetCurrent()->GetSamplingHeapProfiler()->StopSampling();
+}
+
+AllocationProfile* HeapProfiler::GetAllocationProfile() {
+  return IsolateShim::GetCurrent()->GetSamplingHeapProfiler()
+    ->GetAllocationProfile();
+}
+
+void HeapSnapshot::Serialize(OutputStream* stream,
+                             SerializationFormat format) const {
+  CHAKRA_ASSERT(format == kJSON);
+
+  SerializeState state = { stream, false };
+  JsErrorCode error = JsTakeRuntimeHeapSnapshot(
+    IsolateShim::FromIsolate(isolate_)->GetRuntimeHandle(),
+    WriteSnapshotChunk, &state);
+
+  // Like V8, the stream is not ended when it aborted the snapshot
+  if (error == JsNoError && !state.aborted) {
+    stream->EndOfStream();
+  }
+}
+
+}  // namespace v8
@@ -21,11 +21,11 @@
 #include "v8.h"
 #include "v8-profiler.h"
 #include "jsrtutils.h"
+#include "jsrtcpuprofiler.h"
 
 namespace v8 {
 
 HeapProfiler dummyHeapProfiler;
-CpuProfiler dummyCpuProfiler;
 
 Isolate* Isolate::Allocate() {
   return AllocateWithTTDSupport(0, nullptr, false, false, false, UINT32_MAX,
@@ -104,9 +104,8 @@ void Isolate::Dispose() {
 
 int64_t Isolate::AdjustAmountOfExternalAllocatedMemory(
     int64_t change_in_bytes) {
-  // CHAKRA-TODO: We don't support adding external memory pressure at the
-  // moment.
-  return 0;
+  return jsrt::IsolateShim::FromIsolate(this)->AdjustExternalMemory(
+      change_in_bytes);
 }
 
 void Isolate::SetData(uint32_t slot, void* data) {
@@ -209,37 +208,65 @@ HeapProfiler* Isolate::GetHeapProfiler() {
 }
 
 CpuProfiler* Isolate::GetCpuProfiler() {
-  return &dummyCpuProfiler;
+  return jsrt::IsolateShim::FromIsolate(this)->GetCpuProfiler()->ToProfiler();
+}
+
+void Isolate::AddNearHeapLimitCallback(NearHeapLimitCallback callback,
+                                       void* data) {
+  jsrt::IsolateShim::FromIsolate(this)->AddNearHeapLimitCallback(callback,
+                                                                 data);
+}
+
+void Isolate::RemoveNearHeapLimitCallback(NearHeapLimitCallback callback,
+                                          size_t heap_limit) {
+  jsrt::IsolateShim::FromIsolate(this)->RemoveNearHeapLimitCallback(
+    callback, heap_limit);
 }
 
 void Isolate::AddGCPrologueCallback(
   GCCallbackWithData callback, void* data, GCType gc_type_filter) {
+  jsrt::IsolateShim::FromIsolate(this)->AddGCPrologueCallback(
+    { nullptr, callback, data, gc_type_filter });
 }
 
 void Isolate::AddGCPrologueCallback(
   GCCallback callback, GCType gc_type_filter) {
+  jsrt::IsolateShim::FromIsolate(this)->AddGCPrologueCallback(
+    { callback, nullptr, nullptr, gc_type_filter });
 }
 
 void Isolate::RemoveGCPrologueCallback(
   GCCallbackWithData callback, void* data) {
+  jsrt::IsolateShim::FromIsolate(this)->RemoveGCPrologueCallback(
+    { nullptr, callback, data, kGCTypeAll });
 }
 
 void Isolate::RemoveGCPrologueCallback(GCCallback callback) {
+  jsrt::IsolateShim::FromIsolate(this)->RemoveGCPrologueCallback(
+    { callback, nullptr, nullptr, kGCTypeAll });
 }
 
 void Isolate::AddGCEpilogueCallback(
   GCCallbackWithData callback, void* data, GCType gc_type_filter) {
+  jsrt::IsolateShim::FromIsolate(this)->AddGCEpilogueCallback(
+    { nullptr, callback, data, gc_type_filter });
 }
 
 void Isolate::AddGCEpilogueCallback(
   GCCallback callback, GCType gc_type_filter) {
+  jsrt::IsolateShim::FromIsolate(this)->AddGCEpilogueCallback(
+    { callback, nullptr, nullptr, gc_type_filter });
 }
 
 void Isolate::RemoveGCEpilogueCallback(
   GCCallbackWithData callback, void* data) {
+  jsrt::IsolateShim::FromIsolate(this)->RemoveGCEpilogueCallback(
+    { nullptr, callback, data, kGCTypeAll });
 }
 
 void Isolate::RemoveGCEpilogueCallback(GCCallback callback) {
+  jsrt::IsolateShim::FromIsolate(this)->RemoveGCEpilogueCallback(
+    { callback, nullptr, nullptr, kGCTypeAll });
 }
 
 void Isolate::CancelTerminateExecution() {
@@ -271,13 +298,16 @@ void Isolate::SetAddHistogramSampleFunction(AddHistogramSampleCallback) {
 }
 
 bool Isolate::IdleNotificationDeadline(double deadline_in_seconds) {
-  CHAKRA_UNIMPLEMENTED();
-  return false;
+  return chakrashim::IdleCollectGarbage(this, deadline_in_seconds) < 0;
 }
 
 bool Isolate::IdleNotification(int idle_time_in_ms) {
-  CHAKRA_UNIMPLEMENTED();
-  return false;
+  if (idle_time_in_ms <= 0) {
+    return false;
+  }
+
+  return jsrt::IsolateShim::FromIsolate(this)->IdleNotification(
+    static_cast<unsigned int>(idle_time_in_ms)) < 0;
 }
 
 void Isolate::LowMemoryNotification() {
@@ -289,23 +319,73 @@ int Isolate::ContextDisposedNotification() {
   return 0;
 }
 
+// Indexed by JsHeapSpace
+static const char* const kHeapSpaceNames[] = {
+  "small_normal_space",
+  "small_leaf_space",
+  "small_finalizable_space",
+  "medium_space",
+  "large_object_space",
+};
+static_assert(sizeof(kHeapSpaceNames) / sizeof(kHeapSpaceNames[0]) ==
+              JsHeapSpaceCount,
+              "kHeapSpaceNames must name every JsHeapSpace");
+
 void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
+  jsrt::IsolateShim* isolateShim = jsrt::IsolateShim::FromIsolate(this);
   size_t memoryUsage;
-  if (!jsrt::IsolateShim::FromIsolate(this)->GetMemoryUsage(&memoryUsage)) {
+  if (!isolateShim->GetMemoryUsage(&memoryUsage)) {
     return;
   }
-  // CONSIDER: V8 distinguishes between "total" size and "used" size
-  heap_statistics->set_heap_size(memoryUsage);
+  heap_statistics->total_heap_size_ = memoryUsage;
+  heap_statistics->total_physical_size_ = memoryUsage;
+  heap_statistics->external_memory_ =
+    static_cast<size_t>(isolateShim->GetExternalMemory());
+
+  JsHeapSpaceStatistics spaces[JsHeapSpaceCount];
+  if (isolateShim->GetHeapSpaceStatistics(spaces)) {
+    size_t used = 0;
+    for (size_t i = 0; i < JsHeapSpaceCount; i++) {
+      used += spaces[i].usedSize;
+    }
+    heap_statistics->used_heap_size_ = used;
+  }
+
+  // An unlimited runtime reports (size_t)-1; leave the limit at 0 then
+  size_t memoryLimit;
+  if (isolateShim->GetMemoryLimit(&memoryLimit) &&
+      memoryLimit != static_cast<size_t>(-1)) {
+    heap_statistics->heap_size_limit_ = memoryLimit;
+    heap_statistics->total_available_size_ =
+      memoryLimit > memoryUsage ? memoryLimit - memoryUsage : 0;
+  }
 }
 
 size_t Isolate::NumberOfHeapSpaces() {
-  // Chakra doesn't expose HEAP space stats
-  return 0;
+  // Callers ask before going through the spaces, which should then see the
+  // heap as it is now
+  jsrt::IsolateShim::FromIsolate(this)->InvalidateHeapSpaceStatistics();
+  return JsHeapSpaceCount;
 }
 
 bool Isolate::GetHeapSpaceStatistics(HeapSpaceStatistics* space_statistics,
                                      size_t index) {
-  // Chakra doesn't expose HEAP space stats
+  if (index >= JsHeapSpaceCount) {
+    return false;
+  }
+
+  JsHeapSpaceStatistics space;
+  if (!jsrt::IsolateShim::FromIsolate(this)->GetHeapSpaceStatistics(index,
+                                                                     &space)) {
+    return false;
+  }
+
+  space_statistics->space_name_ = kHeapSpaceNames[index];
+  space_statistics->space_size_ = space.committedSize;
+  space_statistics->space_used_size_ = space.usedSize;
+  space_statistics->space_available_size_ =
+    space.committedSize - space.usedSize;
+  space_statistics->physical_space_size_ = space.committedSize;
   return true;
 }
 
@@ -314,9 +394,12 @@ void Isolate::SetAllowWasmCodeGenerationCallback(
   // CHAKRA-TODO: Figure out what to do here
 }
 
-// this is used with the --prof argument for V8 profiling
 void Isolate::SetIdle(bool is_idle) {
-  CHAKRA_UNIMPLEMENTED();
+  jsrt::CpuProfilerShim* profiler =
+    jsrt::IsolateShim::FromIsolate(this)->GetSamplingCpuProfiler();
+  if (profiler != nullptr) {
+    profiler->SetIdle(is_idle);
+  }
 }
 
 Isolate::DisallowJavascriptExecutionScope::DisallowJavascriptExecutionScope(
@@ -329,4 +412,44 @@ Isolate::DisallowJavascriptExecutionScope::~DisallowJavascriptExecutionScope() {
   // CHAKRA-TODO: Figure out what to do here
 }
 
+namespace chakrashim {
+
+bool SetJitStatisticsEnabled(Isolate* isolate, bool enabled) {
+  return jsrt::IsolateShim::FromIsolate(isolate)->SetJitStatisticsEnabled(
+      enabled);
+}
+
+bool GetJitStatistics(Isolate* isolate, JsJitStatisticsCallback callback,
+                      void* callbackState, bool reset) {
+  return jsrt::IsolateShim::FromIsolate(isolate)->EnumerateJitStatistics(
+      callback, callbackState, reset);
+}
+
+bool GetDeoptLog(Isolate* isolate, JsJitDeoptLogCallback callback,
+                 void* callbackState, bool reset, unsigned int* deoptCount) {
+  return jsrt::IsolateShim::FromIsolate(isolate)->EnumerateDeoptLog(
+      callback, callbackState, reset, deoptCount);
+}
+
+bool RedeferInactiveFunctions(Isolate* isolate, unsigned int* functionCount,
+                              size_t* freedBytes) {
+  return jsrt::IsolateShim::FromIsolate(isolate)->RedeferInactiveFunctions(
+      functionCount, freedBytes);
+}
+
+int IdleCollectGarbage(Isolate* isolate, double deadline_in_seconds) {
+  // The deadline is on the platform's monotonic clock, which node bases on
+  // uv_hrtime()
+  double idle_time_in_ms = (deadline_in_seconds - uv_hrtime() / 1e9) * 1000;
+  if (idle_time_in_ms <= 0) {
+    // No time this round, ask again at the next idle period
+    return 0;
+  }
+
+  return jsrt::IsolateShim::FromIsolate(isolate)->IdleNotification(
+      static_cast<unsigned int>(idle_time_in_ms));
+}
+
+}  // namespace chakrashim
+
 }  // namespace v8
@@ -49,7 +49,7 @@ namespace v8 {
   }
 
   MaybeLocal<String> JSON::Stringify(Local<Context> context,
-                                     Local<Object> json_object,
+                                     Local<Value> json_object,
                                      Local<String> gap) {
     jsrt::ContextShim* contextShim = jsrt::IsolateShim::GetContextShim(
         (JsContextRef)*context);
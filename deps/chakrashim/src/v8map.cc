@@ -90,6 +90,55 @@ Maybe<bool> Map::Has(Local<Context> context, Local<Value> key) {
   return Just(hasResult);
 }
 
+Local<Array> Map::AsArray() const {
+  JsValueRef arrayConstructor =
+      ContextShim::GetCurrent()->GetArrayConstructor();
+
+  JsValueRef arrayFromFunction;
+  if (jsrt::GetProperty(arrayConstructor, jsrt::CachedPropertyIdRef::from,
+                        &arrayFromFunction) != JsNoError) {
+    CHAKRA_ASSERT(false);
+    return Local<Array>();
+  }
+
+  JsValueRef entries;
+  if (jsrt::CallFunction(arrayFromFunction, (JsValueRef)this,
+                         &entries) != JsNoError) {
+    CHAKRA_ASSERT(false);
+    return Local<Array>();
+  }
+
+  // Array.from() gives [[key, value], ...]; v8 flattens the pairs into a
+  // single [key, value, key, value, ...] array.
+  unsigned int length;
+  if (jsrt::GetArrayLength(entries, &length) != JsNoError) {
+    CHAKRA_ASSERT(false);
+    return Local<Array>();
+  }
+
+  JsValueRef result;
+  if (JsCreateArray(length * 2, &result) != JsNoError) {
+    CHAKRA_ASSERT(false);
+    return Local<Array>();
+  }
+
+  for (unsigned int i = 0; i < length; i++) {
+    JsValueRef entry;
+    JsValueRef key;
+    JsValueRef value;
+    if (jsrt::GetIndexedProperty(entries, i, &entry) != JsNoError ||
+        jsrt::GetIndexedProperty(entry, 0, &key) != JsNoError ||
+        jsrt::GetIndexedProperty(entry, 1, &value) != JsNoError ||
+        jsrt::SetIndexedProperty(result, i * 2, key) != JsNoError ||
+        jsrt::SetIndexedProperty(result, i * 2 + 1, value) != JsNoError) {
+      CHAKRA_ASSERT(false);
+      return Local<Array>();
+    }
+  }
+
+  return Local<Array>::New(result);
+}
+
 Map* Map::Cast(Value* obj) {
   CHAKRA_ASSERT(obj->IsMap());
   return static_cast<Map*>(obj);
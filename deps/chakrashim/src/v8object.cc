@@ -74,8 +74,8 @@ Maybe<bool> Object::Set(Handle<Value> key, Handle<Value> value,
 
   // Do it faster if there are no property attributes
   if (!force && attribs == None) {
-    if (JsSetProperty((JsValueRef)this,
-                      idRef, (JsValueRef)*value, false) != JsNoError) {
+    if (jsrt::SetPropertyCached((JsValueRef)this,
+                                idRef, (JsValueRef)*value) != JsNoError) {
       return Nothing<bool>();
     }
   } else {  // we have attributes just use it
@@ -216,7 +216,8 @@ MaybeLocal<Value> Object::Get(Local<Context> context, Local<Value> key) {
   }
 
   JsValueRef valueRef;
-  if (JsGetProperty((JsValueRef)this, idRef, &valueRef) != JsNoError) {
+  if (jsrt::GetPropertyCached((JsValueRef)this, idRef,
+                              &valueRef) != JsNoError) {
     return Local<Value>();
   }
 
@@ -721,6 +722,20 @@ ObjectTemplate* Object::GetObjectTemplate() {
     *objectData->objectTemplate : nullptr;
 }
 
+// Instances of ObjectTemplates with interceptors are proxies, their
+// ObjectData and internal fields are on the external object they wrap.
+static JsValueRef GetTemplateInstance(Object* object) {
+  bool isProxy = false;
+  JsValueRef target = JS_INVALID_REFERENCE;
+  ObjectData* objectData;
+  if (JsGetProxyProperties(object, &isProxy, &target, nullptr) == JsNoError &&
+      isProxy && target != JS_INVALID_REFERENCE &&
+      ExternalData::TryGet(target, &objectData)) {
+    return target;
+  }
+  return object;
+}
+
 JsErrorCode Utils::GetObjectData(Object* object, ObjectData** objectData) {
   *objectData = nullptr;
 
@@ -728,30 +743,17 @@ JsErrorCode Utils::GetObjectData(Object* object, ObjectData** objectData) {
     return JsNoError;
   }
 
-  JsErrorCode error;
-  JsValueRef self = object;
-  {
-    JsPropertyIdRef selfSymbolIdRef =
-      jsrt::IsolateShim::GetCurrent()->GetSelfSymbolPropertyIdRef();
-    bool hasSelf = false;
-    if (JsHasProperty(object, selfSymbolIdRef, &hasSelf) != JsNoError &&
-        hasSelf == true) {
-      JsValueRef result;
-      error = JsGetProperty(object, selfSymbolIdRef, &result);
-      if (error != JsNoError) {
-        return error;
-      }
-
-      if (!Local<Value>(result)->IsUndefined()) {
-        self = result;
-      }
-    }
-  }
-
-  return ExternalData::GetExternalData(self, objectData);
+  return ExternalData::GetExternalData(GetTemplateInstance(object),
+                                       objectData);
 }
 
 int Object::InternalFieldCount() {
+  unsigned int count;
+  if (JsGetInternalFieldCount(GetTemplateInstance(this), &count) ==
+        JsNoError && count > 0) {
+    return count;
+  }
+
   ObjectData* objectData;
   if (Utils::GetObjectData(this, &objectData) != JsNoError || !objectData) {
     return 0;
@@ -760,12 +762,25 @@ int Object::InternalFieldCount() {
   return objectData->internalFieldCount;
 }
 
+// Fields stored in the object itself are tried first, only objects created
+// without them keep their fields in ObjectData.
 Local<Value> Object::GetInternalField(int index) {
+  JsValueRef value;
+  if (JsGetInternalField(GetTemplateInstance(this), index, &value) ==
+        JsNoError) {
+    return value;
+  }
+
   ObjectData::FieldValue* field = ObjectData::GetInternalField(this, index);
   return field ? field->GetRef() : nullptr;
 }
 
 void Object::SetInternalField(int index, Handle<Value> value) {
+  if (JsSetInternalField(GetTemplateInstance(this), index, *value) ==
+        JsNoError) {
+    return;
+  }
+
   ObjectData::FieldValue* field = ObjectData::GetInternalField(this, index);
   if (field) {
     field->SetRef(*value);
@@ -773,11 +788,22 @@ void Object::SetInternalField(int index, Handle<Value> value) {
 }
 
 void* Object::GetAlignedPointerFromInternalField(int index) {
+  JsValueRef value;
+  if (JsGetInternalField(GetTemplateInstance(this), index, &value) ==
+        JsNoError) {
+    return value;
+  }
+
   ObjectData::FieldValue* field = ObjectData::GetInternalField(this, index);
   return field ? field->GetPointer() : nullptr;
 }
 
 void Object::SetAlignedPointerInInternalField(int index, void* value) {
+  if (JsSetInternalField(GetTemplateInstance(this), index, value) ==
+        JsNoError) {
+    return;
+  }
+
   ObjectData::FieldValue* field = ObjectData::GetInternalField(this, index);
   if (field) {
     field->SetPointer(value);
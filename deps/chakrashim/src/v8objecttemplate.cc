@@ -138,11 +138,8 @@ ObjectData::ObjectData(ObjectTemplate* objectTemplate,
                        ObjectTemplateData* templateData)
     : ExternalData(ExternalDataType),
       objectTemplate(nullptr, Utils::ToLocal(objectTemplate)),
-      internalFieldCount(templateData->internalFieldCount) {
-  if (internalFieldCount > 0) {
-    internalFields = new FieldValue[internalFieldCount];
-  }
-
+      internalFieldCount(0),
+      internalFields(nullptr) {
   if (templateData->setterGetterInterceptor != nullptr) {
     setterGetterInterceptor = new
         SetterGetterInterceptor(templateData->setterGetterInterceptor);
@@ -164,6 +161,14 @@ ObjectData::~ObjectData() {
   }
 }
 
+void ObjectData::AllocateInternalFields(int count) {
+  CHAKRA_ASSERT(internalFieldCount == 0);
+  if (count > 0) {
+    internalFields = new FieldValue[count];
+    internalFieldCount = count;
+  }
+}
+
 void CHAKRA_CALLBACK ObjectData::FinalizeCallback(void* data) {
   if (data != nullptr) {
     ObjectData* objectData = reinterpret_cast<ObjectData*>(data);
@@ -881,10 +886,19 @@ Local<Object> ObjectTemplate::NewInstance(Handle<Function> constructor) {
 
   ObjectData* objectData = new ObjectData(this, objectTemplateData);
   JsValueRef newInstanceRef = JS_INVALID_REFERENCE;
-  if (JsCreateExternalObjectWithPrototype(objectData,
-                                          ObjectData::FinalizeCallback,
-                                          prototype,
-                                          &newInstanceRef) != JsNoError) {
+  JsErrorCode error = JsCreateExternalObjectWithInternalFields(
+      objectData, ObjectData::FinalizeCallback, prototype,
+      objectTemplateData->internalFieldCount, &newInstanceRef);
+  if (error == JsErrorNotImplemented) {
+    // The engine can't keep the fields in the object right now (e.g. while
+    // recording or replaying), keep them on the side instead.
+    objectData->AllocateInternalFields(objectTemplateData->internalFieldCount);
+    error = JsCreateExternalObjectWithPrototype(objectData,
+                                                ObjectData::FinalizeCallback,
+                                                prototype,
+                                                &newInstanceRef);
+  }
+  if (error != JsNoError) {
     delete objectData;
     return Local<Object>();
   }
@@ -948,7 +962,7 @@ Local<Object> ObjectTemplate::NewInstance(Handle<Function> constructor) {
           Utils::DefinePropertyCallback;
     }
 
-    JsErrorCode error =
+    error =
         jsrt::CreateProxy(newInstanceTargetRef, proxyConf, &newInstanceRef);
 
     if (error != JsNoError) {
@@ -24,25 +24,32 @@ namespace v8 {
 
 void CHAKRA_CALLBACK Utils::WeakReferenceCallbackWrapperCallback(JsRef ref,
                                                                  void* data) {
-  if (jsrt::IsolateShim::GetCurrent()->IsDisposing()) {
+  jsrt::IsolateShim* isolateShim = jsrt::IsolateShim::GetCurrent();
+  if (isolateShim->IsDisposing()) {
     return;
   }
 
   const chakrashim::WeakReferenceCallbackWrapper* callbackWrapper =
     reinterpret_cast<const chakrashim::WeakReferenceCallbackWrapper*>(data);
+  isolateShim->SetInWeakCallback(true);
   if (callbackWrapper->isWeakCallbackInfo) {
-    WeakCallbackInfo<void>::Callback callback;
+    // The wrapper usually goes away with the handle reset by the callback
+    void* parameters = callbackWrapper->parameters;
+    WeakCallbackInfo<void>::Callback callback = nullptr;
     void* fields[kInternalFieldsInWeakCallback] = {};
-    WeakCallbackInfo<void> info(Isolate::GetCurrent(),
-                                callbackWrapper->parameters,
+    WeakCallbackInfo<void> info(Isolate::GetCurrent(), parameters,
                                 fields, &callback);
     callbackWrapper->infoCallback(info);
+    if (callback != nullptr) {
+      isolateShim->QueueSecondPassWeakCallback(callback, parameters);
+    }
   } else {
     WeakCallbackData<Value, void> data(Isolate::GetCurrent(),
                                        callbackWrapper->parameters,
                                        static_cast<Value*>(ref));
     callbackWrapper->dataCallback(data);
   }
+  isolateShim->SetInWeakCallback(false);
 }
 
 namespace chakrashim {
@@ -53,10 +60,16 @@ static void CHAKRA_CALLBACK DummyObjectBeforeCollectCallback(JsRef ref,
 }
 
 void ClearObjectWeakReferenceCallback(JsValueRef object, bool revive) {
-  if (jsrt::IsolateShim::GetCurrent()->IsDisposing()) {
+  jsrt::IsolateShim* isolateShim = jsrt::IsolateShim::GetCurrent();
+  if (isolateShim->IsDisposing()) {
     return;
   }
 
+  // Only an object that may be dead needs reviving, outside of the weak
+  // callbacks the strong reference taken next keeps it alive. Leaving the
+  // dummy callback registered would keep the object in the recycler's table
+  // of callbacks for the rest of its life.
+  revive = revive && isolateShim->IsInWeakCallback();
   JsSetObjectBeforeCollectCallback(
     object, nullptr, revive ? DummyObjectBeforeCollectCallback : nullptr);
 }
@@ -19,6 +19,9 @@
 // IN THE SOFTWARE.
 
 #include "v8chakra.h"
+#include "jsrtbytecodecache.h"
+#include "jsrtprofilecache.h"
+#include "jsrtscriptstreaming.h"
 #include <memory>
 #include <string>
 
@@ -130,12 +133,28 @@ MaybeLocal<Script> Script::Compile(Local<Context> context,
     jsrt::StringUtf8 script;
     error = jsrt::ToString(*source, &sourceRef, &script);
     if (error == JsNoError) {
+      JsSourceContext sourceContext = currentContext++;
+      jsrt::DynamicProfileCache* profileCache =
+        jsrt::IsolateShim::GetCurrent()->GetProfileCache();
+      if (profileCache != nullptr) {
+        profileCache->OnCompile(sourceContext, filenameRef, *script,
+                                script.length());
+      }
+
       JsValueRef scriptFunction;
-      error = jsrt::ParseScript(&script,
-                                currentContext++,
-                                filenameRef,
-                                g_useStrict,
-                                &scriptFunction);
+      jsrt::ByteCodeCache* byteCodeCache =
+        jsrt::IsolateShim::GetCurrent()->GetByteCodeCache();
+      if (byteCodeCache != nullptr && !g_useStrict) {
+        error = byteCodeCache->ParseScript(sourceRef, *script, script.length(),
+                                           sourceContext, filenameRef,
+                                           &scriptFunction);
+      } else {
+        error = jsrt::ParseScript(&script,
+                                  sourceContext,
+                                  filenameRef,
+                                  g_useStrict,
+                                  &scriptFunction);
+      }
       if (error == JsNoError) {
         JsValueRef scriptObject;
         error = CreateScriptObject(sourceRef, filenameRef, scriptFunction,
@@ -377,6 +396,62 @@ Local<Script> ScriptCompiler::Compile(Isolate* isolate,
   return FromMaybe(Compile(Local<Context>(), source, options));
 }
 
+namespace {
+
+class StreamingTask : public ScriptCompiler::ScriptStreamingTask {
+ public:
+  explicit StreamingTask(jsrt::ScriptStreamingData* data) : data(data) {}
+
+  void Run() override { data->Parse(); }
+
+ private:
+  jsrt::ScriptStreamingData* data;
+};
+
+}  // namespace
+
+ScriptCompiler::StreamedSource::StreamedSource(
+    ExternalSourceStream* source_stream, Encoding encoding)
+    : impl_(new jsrt::ScriptStreamingData(source_stream, encoding)) {
+}
+
+ScriptCompiler::StreamedSource::~StreamedSource() {
+}
+
+ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(
+    Isolate* isolate, StreamedSource* source, CompileOptions options) {
+  return new StreamingTask(source->impl());
+}
+
+MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
+                                           StreamedSource* source,
+                                           Local<String> full_source_string,
+                                           const ScriptOrigin& origin) {
+  JsValueRef filenameRef = *origin.ResourceName();
+  if (filenameRef == nullptr &&
+      JsCreateString("", 0, &filenameRef) != JsNoError) {
+    return Local<Script>();
+  }
+
+  // The streamed byte code is of the source as is, without 'use strict'
+  JsValueRef scriptFunction;
+  if (g_useStrict ||
+      source->impl()->ParseScript(*full_source_string, currentContext++,
+                                  filenameRef,
+                                  &scriptFunction) != JsNoError) {
+    ScriptOrigin scriptOrigin(origin);
+    return Script::Compile(context, full_source_string, &scriptOrigin);
+  }
+
+  JsValueRef scriptObject;
+  if (CreateScriptObject(*full_source_string, filenameRef, scriptFunction,
+                         &scriptObject) != JsNoError) {
+    return Local<Script>();
+  }
+
+  return Utils::ToLocal<Script>(scriptObject);
+}
+
 uint32_t ScriptCompiler::CachedDataVersionTag() {
   return 0;
 }
@@ -387,6 +462,44 @@ MaybeLocal<Module> ScriptCompiler::CompileModule(
   return Local<Module>();
   }
 
+static void CHAKRA_CALLBACK FreeCodeCacheCopy(void* data) {
+  delete[] static_cast<uint8_t*>(data);
+}
+
+// Runs the byte code CreateCodeCacheForFunction produced for |sourceRef|. The
+// engine deserializes functions and reads the source lazily, so both have to
+// outlive the caller's cached data.
+static JsErrorCode RunCodeCache(JsValueRef sourceRef,
+                                const ScriptCompiler::CachedData* cachedData,
+                                JsValueRef sourceUrl, JsValueRef* result) {
+  uint8_t* copy = new uint8_t[cachedData->length];
+  memcpy(copy, cachedData->data, cachedData->length);
+
+  JsValueRef bufferRef;
+  JsErrorCode error = JsCreateExternalArrayBuffer(copy, cachedData->length,
+                                                  FreeCodeCacheCopy, copy,
+                                                  &bufferRef);
+  if (error != JsNoError) {
+    delete[] copy;
+    return error;
+  }
+
+  JsSourceContext sourceContext = currentContext++;
+  jsrt::IsolateShim::GetCurrent()->SetCodeCacheSource(sourceContext,
+                                                      sourceRef);
+  jsrt::EngineTraceScope traceScope("ChakraCore.DeserializeCode");
+  error = JsRunSerializedWithUnloadCallback(
+    bufferRef, jsrt::IsolateShim::LoadCodeCacheSource,
+    jsrt::IsolateShim::UnloadCodeCacheSource, sourceContext, sourceUrl,
+    result);
+  if (error != JsNoError && error != JsErrorScriptException &&
+      error != JsErrorScriptTerminated) {
+    // Rejected before the script ran, nothing will ask for the source
+    jsrt::IsolateShim::GetCurrent()->ReleaseCodeCacheSource(sourceContext);
+  }
+  return error;
+}
+
 MaybeLocal<Function> ScriptCompiler::CompileFunctionInContext(
   Local<Context> context, Source* source, size_t arguments_count,
   Local<String> arguments[], size_t context_extension_count,
@@ -436,9 +549,35 @@ MaybeLocal<Function> ScriptCompiler::CompileFunctionInContext(
   if (JsCreateStringUtf16((uint16_t*)gen.c_str(), gen.length(), &genStr) != JsNoError) {
     return MaybeLocal<Function>();
   }
-  JsValueRef genFunc;
-  if (JsRun(genStr, currentContext++, *source->resource_name, JsParseScriptAttributeNone, &genFunc) != JsNoError) {
-    return MaybeLocal<Function>();
+  JsValueRef genFunc = JS_INVALID_REFERENCE;
+  if (options == kConsumeCodeCache && source->cached_data != nullptr) {
+    JsErrorCode error = RunCodeCache(genStr, source->cached_data,
+                                     *source->resource_name, &genFunc);
+    if (error == JsErrorScriptException || error == JsErrorScriptTerminated) {
+      // The cache was accepted and the wrapper threw, leave the exception
+      // pending for the caller instead of running the source again
+      return MaybeLocal<Function>();
+    }
+    if (error != JsNoError) {
+      // Built by another engine version, fall back to parsing the source
+      source->cached_data->rejected = true;
+      genFunc = JS_INVALID_REFERENCE;
+    }
+  }
+
+  if (genFunc == JS_INVALID_REFERENCE) {
+    JsSourceContext sourceContext = currentContext++;
+    jsrt::DynamicProfileCache* profileCache =
+      jsrt::IsolateShim::GetCurrent()->GetProfileCache();
+    if (profileCache != nullptr && !source->resource_name.IsEmpty()) {
+      profileCache->OnCompile(sourceContext, *source->resource_name,
+                              gen.c_str(), gen.length() * sizeof(wchar_t));
+    }
+
+    jsrt::EngineTraceScope traceScope("ChakraCore.Compile");
+    if (JsRun(genStr, sourceContext, *source->resource_name, JsParseScriptAttributeNone, &genFunc) != JsNoError) {
+      return MaybeLocal<Function>();
+    }
   }
 
   JsValueRef* args;
@@ -460,7 +599,53 @@ MaybeLocal<Function> ScriptCompiler::CompileFunctionInContext(
     return MaybeLocal<Function>();
   }
 
+  if (options == kEagerCompile) {
+    // Keep the wrapper source around for CreateCodeCacheForFunction
+    jsrt::IsolateShim::GetCurrent()->SetEagerCompileSource(retFunc, genStr);
+  }
+
   return Utils::ToLocal<Function>(retFunc);
 }
 
+ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheForFunction(
+    Local<Function> function) {
+  jsrt::IsolateShim* isolateShim = jsrt::IsolateShim::GetCurrent();
+  JsValueRef sourceRef = isolateShim->GetEagerCompileSource(*function);
+  if (sourceRef == JS_INVALID_REFERENCE) {
+    // Not the function last compiled by CompileFunctionInContext with
+    // kEagerCompile
+    return nullptr;
+  }
+
+  // Full byte code of the wrapper, functions included, rather than the
+  // parser state CreateCodeCache produces for scripts
+  JsValueRef bufferRef;
+  uint8_t* buffer = nullptr;
+  unsigned int bufferLength = 0;
+  JsErrorCode error = JsSerialize(sourceRef, &bufferRef,
+                                  JsParseScriptAttributeNone);
+  isolateShim->ReleaseEagerCompileSource();
+  if (error != JsNoError ||
+      jsrt::GetArrayBufferStorage(bufferRef, &buffer, &bufferLength) !=
+        JsNoError) {
+    return nullptr;
+  }
+
+  uint8_t* data = new uint8_t[bufferLength];
+  memcpy(data, buffer, bufferLength);
+  return new CachedData(data, static_cast<int>(bufferLength),
+                        CachedData::BufferOwned);
+}
+
+ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheForFunction(
+    Local<Function> function, Local<String> source) {
+  return CreateCodeCacheForFunction(function);
+}
+
+ScriptCompiler::CachedData::~CachedData() {
+  if (buffer_policy == BufferOwned) {
+    delete[] data;
+  }
+}
+
 }  // namespace v8
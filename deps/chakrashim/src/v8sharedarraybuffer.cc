@@ -19,25 +19,137 @@
 // IN THE SOFTWARE.
 
 #include "v8chakra.h"
+#include <mutex>
+#include <unordered_map>
 
 namespace v8 {
 
+namespace {
+
+// The storage of a SharedArrayBuffer is a reference counted Chakra object.
+// Every Externalize() keeps one reference on it, recorded here under the data
+// pointer handed out, so that New() in another isolate wraps the same storage
+// and ReleaseExternalized() knows which reference to give back.
+struct ExternalizedStorage {
+  JsSharedArrayBufferContentHandle handle;
+  size_t count;
+};
+
+std::mutex externalizedMutex;
+std::unordered_map<void*, ExternalizedStorage> externalizedStorage;
+
+// An empty buffer has no memory, its storage object stands in for the data
+bool GetStorage(JsSharedArrayBufferContentHandle handle,
+                void** data, size_t* byteLength) {
+  BYTE* buffer;
+  unsigned int bufferLength;
+  if (JsGetSharedArrayBufferContentStorage(handle, &buffer,
+                                           &bufferLength) != JsNoError) {
+    return false;
+  }
+
+  *data = buffer != nullptr ? buffer : handle;
+  *byteLength = bufferLength;
+  return true;
+}
+
+}  // namespace
+
 Local<SharedArrayBuffer> SharedArrayBuffer::New(
     Isolate* isolate, void* data, size_t byte_length,
     ArrayBufferCreationMode mode) {
-  CHAKRA_UNIMPLEMENTED();
-  return Local<SharedArrayBuffer>();
+  JsSharedArrayBufferContentHandle handle = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(externalizedMutex);
+    auto entry = externalizedStorage.find(data);
+    if (entry != externalizedStorage.end()) {
+      handle = entry->second.handle;
+    }
+  }
+
+  if (handle == nullptr) {
+    // Memory that didn't come from Externalize() can't back a Chakra
+    // SharedArrayBuffer
+    CHAKRA_UNIMPLEMENTED();
+    return Local<SharedArrayBuffer>();
+  }
+
+  JsValueRef result;
+  if (JsCreateSharedArrayBufferWithSharedContent(handle,
+                                                 &result) != JsNoError) {
+    return Local<SharedArrayBuffer>();
+  }
+
+  if (mode == ArrayBufferCreationMode::kInternalized) {
+    // The new buffer holds its own reference on the storage
+    ReleaseExternalized(data);
+  }
+  return Local<SharedArrayBuffer>::New(result);
 }
 
 SharedArrayBuffer* SharedArrayBuffer::Cast(Value* obj) {
-  CHAKRA_UNIMPLEMENTED();
-  return nullptr;
+  CHAKRA_ASSERT(obj->IsSharedArrayBuffer());
+  return static_cast<SharedArrayBuffer*>(obj);
+}
+
+bool SharedArrayBuffer::IsExternal() const {
+  JsSharedArrayBufferContentHandle handle;
+  if (JsGetSharedArrayBufferContent(const_cast<SharedArrayBuffer*>(this),
+                                    &handle) != JsNoError) {
+    return false;
+  }
+
+  void* data;
+  size_t byteLength;
+  bool isExternal = false;
+  if (GetStorage(handle, &data, &byteLength)) {
+    std::lock_guard<std::mutex> lock(externalizedMutex);
+    isExternal = externalizedStorage.count(data) != 0;
+  }
+
+  JsReleaseSharedArrayBufferContentHandle(handle);
+  return isExternal;
 }
 
-// CHAKRA-TODO: Enable SharedArrayBuffer/Workers for Node
 SharedArrayBuffer::Contents SharedArrayBuffer::Externalize() {
-  CHAKRA_UNIMPLEMENTED();
-  return SharedArrayBuffer::Contents();
+  JsSharedArrayBufferContentHandle handle;
+  if (JsGetSharedArrayBufferContent(this, &handle) != JsNoError) {
+    return Contents();
+  }
+
+  Contents contents;
+  if (!GetStorage(handle, &contents.data_, &contents.byte_length_)) {
+    JsReleaseSharedArrayBufferContentHandle(handle);
+    return Contents();
+  }
+  contents.allocation_base_ = contents.data_;
+  contents.allocation_length_ = contents.byte_length_;
+
+  std::lock_guard<std::mutex> lock(externalizedMutex);
+  ExternalizedStorage& storage = externalizedStorage[contents.data_];
+  storage.handle = handle;
+  storage.count++;
+  return contents;
+}
+
+void SharedArrayBuffer::ReleaseExternalized(void* data) {
+  JsSharedArrayBufferContentHandle handle;
+  {
+    std::lock_guard<std::mutex> lock(externalizedMutex);
+    auto entry = externalizedStorage.find(data);
+    CHAKRA_ASSERT(entry != externalizedStorage.end());
+    if (entry == externalizedStorage.end()) {
+      return;
+    }
+
+    handle = entry->second.handle;
+    if (--entry->second.count == 0) {
+      externalizedStorage.erase(entry);
+    }
+  }
+
+  // Frees the memory if no SharedArrayBuffer uses it anymore
+  JsReleaseSharedArrayBufferContentHandle(handle);
 }
 
 }  // namespace v8
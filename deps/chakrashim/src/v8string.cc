@@ -360,19 +360,36 @@ Local<String> String::Concat(Handle<String> left, Handle<String> right) {
   return Local<String>::New(result);
 }
 
+template <class Resource>
+static void CHAKRA_CALLBACK DisposeExternalStringResource(void* data) {
+  static_cast<Resource*>(data)->Dispose();
+}
+
 MaybeLocal<String> String::NewExternalTwoByte(
     Isolate* isolate, ExternalStringResource* resource) {
-  if (resource->data() != nullptr) {
-    auto newStr = NewFromTwoByte(nullptr, resource->data(),
-                                 v8::NewStringType::kNormal,
-                                 static_cast<int>(resource->length()));
+  if (resource->data() == nullptr || resource->length() == 0) {
+    // the resource is empty just delete it and return an empty string
+    resource->Dispose();
+    return Empty(nullptr);
+  }
+
+  if (resource->length() > static_cast<size_t>(kMaxLength)) {
+    resource->Dispose();
+    return Local<String>();
+  }
+
+  // The string refers to the resource's characters until it is collected
+  JsValueRef strRef;
+  if (JsCreateExternalStringUtf16(
+        resource->data(), resource->length(),
+        DisposeExternalStringResource<ExternalStringResource>, resource,
+        &strRef) != JsNoError) {
+    // No string took ownership of the resource
     resource->Dispose();
-    return newStr;
+    return Local<String>();
   }
 
-  // otherwise the resource is empty just delete it and return an empty string
-  resource->Dispose();
-  return Empty(nullptr);
+  return Local<String>::New(strRef);
 }
 
 Local<String> String::NewExternal(Isolate* isolate,
@@ -382,20 +399,29 @@ Local<String> String::NewExternal(Isolate* isolate,
 
 MaybeLocal<String> String::NewExternalOneByte(
     Isolate* isolate, ExternalOneByteStringResource* resource) {
-  if (resource->data() != nullptr) {
-    auto newStr = NewFromOneByte(
-      nullptr,
-      reinterpret_cast<const uint8_t*>(resource->data()),
-      v8::NewStringType::kNormal,
-      static_cast<int>(resource->length()));
+  if (resource->data() == nullptr || resource->length() == 0) {
+    // the resource is empty just delete it and return an empty string
+    resource->Dispose();
+    return Empty(nullptr);
+  }
+
+  if (resource->length() > static_cast<size_t>(kMaxLength)) {
+    resource->Dispose();
+    return Local<String>();
+  }
 
+  // The string refers to the resource's characters until it is collected
+  JsValueRef strRef;
+  if (JsCreateExternalStringLatin1(
+        resource->data(), resource->length(),
+        DisposeExternalStringResource<ExternalOneByteStringResource>,
+        resource, &strRef) != JsNoError) {
+    // No string took ownership of the resource
     resource->Dispose();
-    return newStr;
+    return Local<String>();
   }
 
-  // otherwise the resource is empty just delete it and return an empty string
-  resource->Dispose();
-  return Empty(nullptr);
+  return Local<String>::New(strRef);
 }
 
 Local<String> String::NewExternal(Isolate* isolate,
@@ -403,5 +429,38 @@ Local<String> String::NewExternal(Isolate* isolate,
   return FromMaybe(NewExternalOneByte(isolate, resource));
 }
 
+// The strings created above pass their resource as the callback state
+static void* GetExternalResource(const String* string, bool isOneByte) {
+  const void* content;
+  size_t length;
+  bool contentIsOneByte;
+  void* resource;
+  if (JsGetExternalStringContent((JsValueRef)string, &content, &length,
+                                 &contentIsOneByte, &resource) != JsNoError ||
+      contentIsOneByte != isOneByte) {
+    return nullptr;
+  }
+  return resource;
+}
+
+bool String::IsExternal() const {
+  return GetExternalResource(this, false) != nullptr;
+}
+
+bool String::IsExternalOneByte() const {
+  return GetExternalResource(this, true) != nullptr;
+}
+
+String::ExternalStringResource* String::GetExternalStringResource() const {
+  return static_cast<ExternalStringResource*>(
+    GetExternalResource(this, false));
+}
+
+const String::ExternalOneByteStringResource*
+String::GetExternalOneByteStringResource() const {
+  return static_cast<const ExternalOneByteStringResource*>(
+    GetExternalResource(this, true));
+}
+
 }  // namespace v8
 
@@ -0,0 +1,749 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Trace event recording, ported from v8's libplatform tracing
+// (tracing-controller.cc, trace-object.cc, trace-config.cc, trace-writer.cc)
+// so that node's tracing agent records events on chakra as well.
+
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include "v8chakra.h"
+#include "jsrtutils.h"
+#include "libplatform/v8-tracing.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+// Must be in sync with src/tracing/trace_event_common.h
+#define TRACE_EVENT_PHASE_COMPLETE ('X')
+#define TRACE_EVENT_PHASE_INSTANT ('I')
+#define TRACE_EVENT_FLAG_NONE (static_cast<unsigned int>(0))
+#define TRACE_EVENT_FLAG_COPY (static_cast<unsigned int>(1 << 0))
+#define TRACE_EVENT_FLAG_HAS_ID (static_cast<unsigned int>(1 << 1))
+#define TRACE_VALUE_TYPE_BOOL (static_cast<unsigned char>(1))
+#define TRACE_VALUE_TYPE_UINT (static_cast<unsigned char>(2))
+#define TRACE_VALUE_TYPE_INT (static_cast<unsigned char>(3))
+#define TRACE_VALUE_TYPE_DOUBLE (static_cast<unsigned char>(4))
+#define TRACE_VALUE_TYPE_POINTER (static_cast<unsigned char>(5))
+#define TRACE_VALUE_TYPE_STRING (static_cast<unsigned char>(6))
+#define TRACE_VALUE_TYPE_COPY_STRING (static_cast<unsigned char>(7))
+#define TRACE_VALUE_TYPE_CONVERTABLE (static_cast<unsigned char>(8))
+
+namespace v8 {
+
+extern Platform* g_platform;
+
+namespace platform {
+namespace tracing {
+
+#define MAX_CATEGORY_GROUPS 200
+
+// Parallel arrays g_category_groups and g_category_group_enabled are separate
+// so that a pointer to a member of g_category_group_enabled can be easily
+// converted to an index into g_category_groups.
+static const char* g_category_groups[MAX_CATEGORY_GROUPS] = {
+    "toplevel",
+    "tracing categories exhausted; must increase MAX_CATEGORY_GROUPS",
+    "__metadata"};
+
+// The enabled flag is char instead of bool so that the API can be used from C.
+static std::atomic<uint8_t> g_category_group_enabled[MAX_CATEGORY_GROUPS];
+// Indexes here have to match the g_category_groups array indexes above.
+static const size_t g_category_categories_exhausted = 1;
+static const size_t g_num_builtin_categories = 3;
+
+// Skip default categories.
+static std::atomic<size_t> g_category_index(g_num_builtin_categories);
+
+static const uint8_t* EnabledFlagAt(size_t index) {
+  return reinterpret_cast<const uint8_t*>(&g_category_group_enabled[index]);
+}
+
+TracingController::TracingController() {}
+
+TracingController::~TracingController() {
+  StopTracing();
+
+  // Free memory for category group names allocated via strdup.
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t i = g_category_index - 1; i >= g_num_builtin_categories; --i) {
+    const char* group = g_category_groups[i];
+    g_category_groups[i] = nullptr;
+    free(const_cast<char*>(group));
+  }
+  g_category_index = g_num_builtin_categories;
+}
+
+void TracingController::Initialize(TraceBuffer* trace_buffer) {
+  trace_buffer_.reset(trace_buffer);
+}
+
+int64_t TracingController::CurrentTimestampMicroseconds() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int64_t TracingController::CurrentCpuTimestampMicroseconds() {
+#ifdef _WIN32
+  FILETIME creation, exit, kernel, user;
+  if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) {
+    return 0;
+  }
+  // Both are in 100ns units.
+  uint64_t kernel_time =
+      (static_cast<uint64_t>(kernel.dwHighDateTime) << 32) |
+      kernel.dwLowDateTime;
+  uint64_t user_time =
+      (static_cast<uint64_t>(user.dwHighDateTime) << 32) | user.dwLowDateTime;
+  return static_cast<int64_t>((kernel_time + user_time) / 10);
+#else
+  struct timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+    return 0;
+  }
+  return static_cast<int64_t>(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+uint64_t TracingController::AddTraceEvent(
+    char phase, const uint8_t* category_enabled_flag, const char* name,
+    const char* scope, uint64_t id, uint64_t bind_id, int num_args,
+    const char** arg_names, const uint8_t* arg_types,
+    const uint64_t* arg_values,
+    std::unique_ptr<v8::ConvertableToTraceFormat>* arg_convertables,
+    unsigned int flags) {
+  return AddTraceEventWithTimestamp(phase, category_enabled_flag, name, scope,
+                                    id, bind_id, num_args, arg_names,
+                                    arg_types, arg_values, arg_convertables,
+                                    flags, CurrentTimestampMicroseconds());
+}
+
+uint64_t TracingController::AddTraceEventWithTimestamp(
+    char phase, const uint8_t* category_enabled_flag, const char* name,
+    const char* scope, uint64_t id, uint64_t bind_id, int num_args,
+    const char** arg_names, const uint8_t* arg_types,
+    const uint64_t* arg_values,
+    std::unique_ptr<v8::ConvertableToTraceFormat>* arg_convertables,
+    unsigned int flags, int64_t timestamp) {
+  uint64_t handle = 0;
+  if (mode_ != DISABLED) {
+    TraceObject* trace_object = trace_buffer_->AddTraceEvent(&handle);
+    if (trace_object) {
+      trace_object->Initialize(phase, category_enabled_flag, name, scope, id,
+                               bind_id, num_args, arg_names, arg_types,
+                               arg_values, arg_convertables, flags, timestamp,
+                               CurrentCpuTimestampMicroseconds());
+    }
+  }
+  return handle;
+}
+
+void TracingController::UpdateTraceEventDuration(
+    const uint8_t* category_enabled_flag, const char* name, uint64_t handle) {
+  TraceObject* trace_object = trace_buffer_->GetEventByHandle(handle);
+  if (!trace_object) return;
+  trace_object->UpdateDuration(CurrentTimestampMicroseconds(),
+                               CurrentCpuTimestampMicroseconds());
+}
+
+const uint8_t* TracingController::GetCategoryGroupEnabled(
+    const char* category_group) {
+  return GetCategoryGroupEnabledInternal(category_group);
+}
+
+const char* TracingController::GetCategoryGroupName(
+    const uint8_t* category_group_enabled) {
+  uintptr_t category_begin = reinterpret_cast<uintptr_t>(EnabledFlagAt(0));
+  uintptr_t category_ptr = reinterpret_cast<uintptr_t>(category_group_enabled);
+  CHAKRA_ASSERT(category_ptr >= category_begin &&
+                category_ptr < reinterpret_cast<uintptr_t>(
+                    EnabledFlagAt(MAX_CATEGORY_GROUPS)));
+  uintptr_t category_index =
+      (category_ptr - category_begin) / sizeof(g_category_group_enabled[0]);
+  return g_category_groups[category_index];
+}
+
+void TracingController::StartTracing(TraceConfig* trace_config) {
+  trace_config_.reset(trace_config);
+  std::unordered_set<v8::TracingController::TraceStateObserver*> observers_copy;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    mode_ = RECORDING_MODE;
+    UpdateCategoryGroupEnabledFlags();
+    observers_copy = observers_;
+  }
+  for (auto o : observers_copy) {
+    o->OnTraceEnabled();
+  }
+}
+
+void TracingController::StopTracing() {
+  if (mode_ == DISABLED) {
+    return;
+  }
+  CHAKRA_ASSERT(trace_buffer_);
+  mode_ = DISABLED;
+  UpdateCategoryGroupEnabledFlags();
+  std::unordered_set<v8::TracingController::TraceStateObserver*> observers_copy;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    observers_copy = observers_;
+  }
+  for (auto o : observers_copy) {
+    o->OnTraceDisabled();
+  }
+  trace_buffer_->Flush();
+}
+
+void TracingController::UpdateCategoryGroupEnabledFlag(size_t category_index) {
+  uint8_t enabled_flag = 0;
+  const char* category_group = g_category_groups[category_index];
+  if (mode_ == RECORDING_MODE &&
+      trace_config_->IsCategoryGroupEnabled(category_group)) {
+    enabled_flag |= ENABLED_FOR_RECORDING;
+  }
+
+  // Metadata events are always added, even if the category filter is "-*".
+  if (mode_ == RECORDING_MODE && !strcmp(category_group, "__metadata")) {
+    enabled_flag |= ENABLED_FOR_RECORDING;
+  }
+
+  g_category_group_enabled[category_index].store(enabled_flag,
+                                                 std::memory_order_relaxed);
+}
+
+void TracingController::UpdateCategoryGroupEnabledFlags() {
+  size_t category_index = g_category_index.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < category_index; i++) UpdateCategoryGroupEnabledFlag(i);
+}
+
+const uint8_t* TracingController::GetCategoryGroupEnabledInternal(
+    const char* category_group) {
+  // Check that category groups does not contain double quote
+  CHAKRA_ASSERT(!strchr(category_group, '"'));
+
+  // The g_category_groups is append only, avoid using a lock for the fast path.
+  size_t category_index = g_category_index.load(std::memory_order_acquire);
+
+  // Search for pre-existing category group.
+  for (size_t i = 0; i < category_index; ++i) {
+    if (strcmp(g_category_groups[i], category_group) == 0) {
+      return EnabledFlagAt(i);
+    }
+  }
+
+  // Slow path. Grab the lock.
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Check the list again with lock in hand.
+  category_index = g_category_index.load(std::memory_order_acquire);
+  for (size_t i = 0; i < category_index; ++i) {
+    if (strcmp(g_category_groups[i], category_group) == 0) {
+      return EnabledFlagAt(i);
+    }
+  }
+
+  // Create a new category group.
+  if (category_index >= MAX_CATEGORY_GROUPS) {
+    return EnabledFlagAt(g_category_categories_exhausted);
+  }
+
+  // Don't hold on to the category_group pointer, so that we can create
+  // category groups with strings not known at compile time.
+  g_category_groups[category_index] = strdup(category_group);
+  // Note that if both included and excluded patterns in the TraceConfig are
+  // empty, we exclude nothing, thereby enabling this category group.
+  UpdateCategoryGroupEnabledFlag(category_index);
+  // Update the max index now.
+  g_category_index.store(category_index + 1, std::memory_order_release);
+  return EnabledFlagAt(category_index);
+}
+
+void TracingController::AddTraceStateObserver(
+    v8::TracingController::TraceStateObserver* observer) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    observers_.insert(observer);
+    if (mode_ != RECORDING_MODE) return;
+  }
+  // Fire the observer if recording is already in progress.
+  observer->OnTraceEnabled();
+}
+
+void TracingController::RemoveTraceStateObserver(
+    v8::TracingController::TraceStateObserver* observer) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  CHAKRA_ASSERT(observers_.find(observer) != observers_.end());
+  observers_.erase(observer);
+}
+
+// We perform checks for nullptr strings since it is possible that a string arg
+// value is nullptr.
+static size_t GetAllocLength(const char* str) {
+  return str ? strlen(str) + 1 : 0;
+}
+
+// Copies |*member| into |*buffer|, sets |*member| to point to this new
+// location, and then advances |*buffer| by the amount written.
+static void CopyTraceObjectParameter(char** buffer, const char** member) {
+  if (*member) {
+    size_t length = strlen(*member) + 1;
+    memcpy(*buffer, *member, length);
+    *member = *buffer;
+    *buffer += length;
+  }
+}
+
+static int GetCurrentProcessIdForTrace() {
+#ifdef _WIN32
+  return static_cast<int>(GetCurrentProcessId());
+#else
+  return static_cast<int>(getpid());
+#endif
+}
+
+static int GetCurrentThreadIdForTrace() {
+#if defined(_WIN32)
+  return static_cast<int>(GetCurrentThreadId());
+#elif defined(__linux__)
+  return static_cast<int>(syscall(SYS_gettid));
+#else
+  return static_cast<int>(reinterpret_cast<intptr_t>(pthread_self()));
+#endif
+}
+
+void TraceObject::Initialize(
+    char phase, const uint8_t* category_enabled_flag, const char* name,
+    const char* scope, uint64_t id, uint64_t bind_id, int num_args,
+    const char** arg_names, const uint8_t* arg_types,
+    const uint64_t* arg_values,
+    std::unique_ptr<v8::ConvertableToTraceFormat>* arg_convertables,
+    unsigned int flags, int64_t timestamp, int64_t cpu_timestamp) {
+  pid_ = GetCurrentProcessIdForTrace();
+  tid_ = GetCurrentThreadIdForTrace();
+  phase_ = phase;
+  category_enabled_flag_ = category_enabled_flag;
+  name_ = name;
+  scope_ = scope;
+  id_ = id;
+  bind_id_ = bind_id;
+  flags_ = flags;
+  ts_ = timestamp;
+  tts_ = cpu_timestamp;
+  duration_ = 0;
+  cpu_duration_ = 0;
+
+  // Clamp num_args since it may have been set by a third-party library.
+  num_args_ = (num_args > kTraceMaxNumArgs) ? kTraceMaxNumArgs : num_args;
+  // Convertables are stringified now rather than kept alive until the event
+  // is written, so that they are copied along with the other strings.
+  std::string convertables[kTraceMaxNumArgs];
+  for (int i = 0; i < num_args_; ++i) {
+    arg_names_[i] = arg_names[i];
+    arg_values_[i].as_uint = arg_values[i];
+    arg_types_[i] = arg_types[i];
+    if (arg_types[i] == TRACE_VALUE_TYPE_CONVERTABLE) {
+      arg_convertables[i]->AppendAsTraceFormat(&convertables[i]);
+      arg_values_[i].as_string = convertables[i].c_str();
+    }
+  }
+
+  bool copy = !!(flags & TRACE_EVENT_FLAG_COPY);
+  // Allocate a long string to fit all string copies.
+  size_t alloc_size = 0;
+  if (copy) {
+    alloc_size += GetAllocLength(name) + GetAllocLength(scope);
+    for (int i = 0; i < num_args_; ++i) {
+      alloc_size += GetAllocLength(arg_names_[i]);
+      if (arg_types_[i] == TRACE_VALUE_TYPE_STRING)
+        arg_types_[i] = TRACE_VALUE_TYPE_COPY_STRING;
+    }
+  }
+
+  bool arg_is_copy[kTraceMaxNumArgs];
+  for (int i = 0; i < num_args_; ++i) {
+    // We only take a copy of arg_vals if they are of type COPY_STRING.
+    arg_is_copy[i] = (arg_types_[i] == TRACE_VALUE_TYPE_COPY_STRING ||
+                      arg_types_[i] == TRACE_VALUE_TYPE_CONVERTABLE);
+    if (arg_is_copy[i]) alloc_size += GetAllocLength(arg_values_[i].as_string);
+  }
+
+  if (alloc_size) {
+    // Since TraceObject can be initialized multiple times, we might need
+    // to free old memory.
+    delete[] parameter_copy_storage_;
+    char* ptr = parameter_copy_storage_ = new char[alloc_size];
+    if (copy) {
+      CopyTraceObjectParameter(&ptr, &name_);
+      CopyTraceObjectParameter(&ptr, &scope_);
+      for (int i = 0; i < num_args_; ++i) {
+        CopyTraceObjectParameter(&ptr, &arg_names_[i]);
+      }
+    }
+    for (int i = 0; i < num_args_; ++i) {
+      if (arg_is_copy[i]) {
+        CopyTraceObjectParameter(&ptr, &arg_values_[i].as_string);
+      }
+    }
+  }
+}
+
+TraceObject::~TraceObject() { delete[] parameter_copy_storage_; }
+
+void TraceObject::UpdateDuration(int64_t timestamp, int64_t cpu_timestamp) {
+  duration_ = timestamp - ts_;
+  cpu_duration_ = cpu_timestamp - tts_;
+}
+
+void TraceObject::InitializeForTesting(
+    char phase, const uint8_t* category_enabled_flag, const char* name,
+    const char* scope, uint64_t id, uint64_t bind_id, int num_args,
+    const char** arg_names, const uint8_t* arg_types,
+    const uint64_t* arg_values, unsigned int flags, int pid, int tid,
+    int64_t ts, int64_t tts, uint64_t duration, uint64_t cpu_duration) {
+  pid_ = pid;
+  tid_ = tid;
+  phase_ = phase;
+  category_enabled_flag_ = category_enabled_flag;
+  name_ = name;
+  scope_ = scope;
+  id_ = id;
+  bind_id_ = bind_id;
+  num_args_ = num_args;
+  flags_ = flags;
+  ts_ = ts;
+  tts_ = tts;
+  duration_ = duration;
+  cpu_duration_ = cpu_duration;
+}
+
+TraceBufferChunk::TraceBufferChunk(uint32_t seq) : seq_(seq) {}
+
+void TraceBufferChunk::Reset(uint32_t new_seq) {
+  next_free_ = 0;
+  seq_ = new_seq;
+}
+
+TraceObject* TraceBufferChunk::AddTraceEvent(size_t* event_index) {
+  *event_index = next_free_++;
+  return &chunk_[*event_index];
+}
+
+TraceConfig* TraceConfig::CreateDefaultTraceConfig() {
+  TraceConfig* trace_config = new TraceConfig();
+  trace_config->included_categories_.push_back("v8");
+  return trace_config;
+}
+
+bool TraceConfig::IsCategoryGroupEnabled(const char* category_group) const {
+  std::stringstream category_stream(category_group);
+  while (category_stream.good()) {
+    std::string category;
+    getline(category_stream, category, ',');
+    for (const auto& included_category : included_categories_) {
+      if (category == included_category) return true;
+    }
+  }
+  return false;
+}
+
+void TraceConfig::AddIncludedCategory(const char* included_category) {
+  CHAKRA_ASSERT(included_category != nullptr &&
+                strlen(included_category) > 0);
+  included_categories_.push_back(included_category);
+}
+
+void TraceConfig::AddExcludedCategory(const char* excluded_category) {
+  CHAKRA_ASSERT(excluded_category != nullptr &&
+                strlen(excluded_category) > 0);
+  excluded_categories_.push_back(excluded_category);
+}
+
+class JSONTraceWriter : public TraceWriter {
+ public:
+  JSONTraceWriter(std::ostream& stream, const std::string& tag)
+      : stream_(stream) {
+    stream_ << "{\"" << tag << "\":[";
+  }
+  ~JSONTraceWriter() override { stream_ << "]}"; }
+
+  void AppendTraceEvent(TraceObject* trace_event) override;
+  void Flush() override {}
+
+ private:
+  void AppendArgValue(uint8_t type, TraceObject::ArgValue value);
+
+  std::ostream& stream_;
+  bool append_comma_ = false;
+};
+
+// Writes the given string to a stream, taking care to escape characters
+// when necessary.
+static void WriteJSONStringToStream(const char* str, std::ostream& stream) {
+  size_t len = strlen(str);
+  stream << "\"";
+  for (size_t i = 0; i < len; ++i) {
+    switch (str[i]) {
+      case '\b':
+        stream << "\\b";
+        break;
+      case '\f':
+        stream << "\\f";
+        break;
+      case '\n':
+        stream << "\\n";
+        break;
+      case '\r':
+        stream << "\\r";
+        break;
+      case '\t':
+        stream << "\\t";
+        break;
+      case '\"':
+        stream << "\\\"";
+        break;
+      case '\\':
+        stream << "\\\\";
+        break;
+      // Note that because we use double quotes for JSON strings,
+      // we don't need to escape single quotes.
+      default:
+        stream << str[i];
+        break;
+    }
+  }
+  stream << "\"";
+}
+
+void JSONTraceWriter::AppendArgValue(uint8_t type,
+                                     TraceObject::ArgValue value) {
+  switch (type) {
+    case TRACE_VALUE_TYPE_BOOL:
+      stream_ << (value.as_bool ? "true" : "false");
+      break;
+    case TRACE_VALUE_TYPE_UINT:
+      stream_ << value.as_uint;
+      break;
+    case TRACE_VALUE_TYPE_INT:
+      stream_ << value.as_int;
+      break;
+    case TRACE_VALUE_TYPE_DOUBLE: {
+      std::string real;
+      double val = value.as_double;
+      if (std::isfinite(val)) {
+        std::ostringstream convert_stream;
+        convert_stream << val;
+        real = convert_stream.str();
+        // Ensure that the number has a .0 if there's no decimal or 'e'.  This
+        // makes sure that when we read the JSON back, it's interpreted as a
+        // real rather than an int.
+        if (real.find('.') == std::string::npos &&
+            real.find('e') == std::string::npos &&
+            real.find('E') == std::string::npos) {
+          real += ".0";
+        }
+      } else if (std::isnan(val)) {
+        // The JSON spec doesn't allow NaN and Infinity (since these are
+        // objects in EcmaScript).  Use strings instead.
+        real = "\"NaN\"";
+      } else if (val < 0) {
+        real = "\"-Infinity\"";
+      } else {
+        real = "\"Infinity\"";
+      }
+      stream_ << real;
+      break;
+    }
+    case TRACE_VALUE_TYPE_POINTER:
+      // JSON only supports double and int numbers.
+      // So as not to lose bits from a 64-bit pointer, output as a hex string.
+      stream_ << "\"" << value.as_pointer << "\"";
+      break;
+    case TRACE_VALUE_TYPE_STRING:
+    case TRACE_VALUE_TYPE_COPY_STRING:
+      if (value.as_string == nullptr) {
+        stream_ << "\"nullptr\"";
+      } else {
+        WriteJSONStringToStream(value.as_string, stream_);
+      }
+      break;
+    case TRACE_VALUE_TYPE_CONVERTABLE:
+      // Already JSON.
+      stream_ << value.as_string;
+      break;
+    default:
+      CHAKRA_ASSERT(false);
+      break;
+  }
+}
+
+void JSONTraceWriter::AppendTraceEvent(TraceObject* trace_event) {
+  if (append_comma_) stream_ << ",";
+  append_comma_ = true;
+  stream_ << "{\"pid\":" << trace_event->pid()
+          << ",\"tid\":" << trace_event->tid()
+          << ",\"ts\":" << trace_event->ts()
+          << ",\"tts\":" << trace_event->tts() << ",\"ph\":\""
+          << trace_event->phase() << "\",\"cat\":\""
+          << TracingController::GetCategoryGroupName(
+                 trace_event->category_enabled_flag())
+          << "\",\"name\":\"" << trace_event->name()
+          << "\",\"dur\":" << trace_event->duration()
+          << ",\"tdur\":" << trace_event->cpu_duration();
+  if (trace_event->flags() & TRACE_EVENT_FLAG_HAS_ID) {
+    if (trace_event->scope() != nullptr) {
+      stream_ << ",\"scope\":\"" << trace_event->scope() << "\"";
+    }
+    // So as not to lose bits from a 64-bit integer, output as a hex string.
+    stream_ << ",\"id\":\"0x" << std::hex << trace_event->id() << "\""
+            << std::dec;
+  }
+  stream_ << ",\"args\":{";
+  const char** arg_names = trace_event->arg_names();
+  const uint8_t* arg_types = trace_event->arg_types();
+  TraceObject::ArgValue* arg_values = trace_event->arg_values();
+  for (int i = 0; i < trace_event->num_args(); ++i) {
+    if (i > 0) stream_ << ",";
+    stream_ << "\"" << arg_names[i] << "\":";
+    AppendArgValue(arg_types[i], arg_values[i]);
+  }
+  stream_ << "}}";
+}
+
+TraceWriter* TraceWriter::CreateJSONTraceWriter(std::ostream& stream) {
+  return new JSONTraceWriter(stream, "traceEvents");
+}
+
+TraceWriter* TraceWriter::CreateJSONTraceWriter(std::ostream& stream,
+                                                const std::string& tag) {
+  return new JSONTraceWriter(stream, tag);
+}
+
+}  // namespace tracing
+}  // namespace platform
+}  // namespace v8
+
+namespace jsrt {
+
+// Engine events share v8's category so that the default node categories pick
+// them up and existing trace tooling finds them where it looks for v8's.
+static const char kEngineCategory[] = "v8";
+
+static v8::TracingController* GetTracingController() {
+  return v8::g_platform != nullptr ?
+      v8::g_platform->GetTracingController() : nullptr;
+}
+
+static const uint8_t* GetEngineCategoryEnabled(
+    v8::TracingController* controller) {
+  // The category flag never moves, so look it up once.
+  static const uint8_t* enabled =
+      controller->GetCategoryGroupEnabled(kEngineCategory);
+  return enabled;
+}
+
+bool IsTracingAvailable() {
+  return GetTracingController() != nullptr;
+}
+
+bool IsEngineTraceCategoryEnabled() {
+  v8::TracingController* controller = GetTracingController();
+  return controller != nullptr && *GetEngineCategoryEnabled(controller) != 0;
+}
+
+void AddEngineTraceEvent(char phase, const char* name) {
+  v8::TracingController* controller = GetTracingController();
+  if (controller == nullptr ||
+      *GetEngineCategoryEnabled(controller) == 0) {
+    return;
+  }
+  controller->AddTraceEvent(phase, GetEngineCategoryEnabled(controller), name,
+                            nullptr, 0, 0, 0, nullptr, nullptr, nullptr,
+                            nullptr, TRACE_EVENT_FLAG_NONE);
+}
+
+static void AddEngineInstantEvent(const char* name, const char** argNames,
+                                  const uint8_t* argTypes,
+                                  const uint64_t* argValues) {
+  v8::TracingController* controller = GetTracingController();
+  if (controller == nullptr ||
+      *GetEngineCategoryEnabled(controller) == 0) {
+    return;
+  }
+  controller->AddTraceEvent(TRACE_EVENT_PHASE_INSTANT,
+                            GetEngineCategoryEnabled(controller), name,
+                            nullptr, 0, 0, 2, argNames, argTypes, argValues,
+                            nullptr, TRACE_EVENT_FLAG_NONE);
+}
+
+void AddEngineTraceEvent(const char* name,
+                         const char* argName1, const char* argValue1,
+                         const char* argName2, const char* argValue2) {
+  const char* argNames[] = { argName1, argName2 };
+  const uint8_t argTypes[] = { TRACE_VALUE_TYPE_COPY_STRING,
+                               TRACE_VALUE_TYPE_COPY_STRING };
+  const uint64_t argValues[] = { reinterpret_cast<uintptr_t>(argValue1),
+                                 reinterpret_cast<uintptr_t>(argValue2) };
+  AddEngineInstantEvent(name, argNames, argTypes, argValues);
+}
+
+void AddEngineTraceEvent(const char* name,
+                         const char* argName1, const char* argValue1,
+                         const char* argName2, double argValue2) {
+  const char* argNames[] = { argName1, argName2 };
+  const uint8_t argTypes[] = { TRACE_VALUE_TYPE_COPY_STRING,
+                               TRACE_VALUE_TYPE_DOUBLE };
+  uint64_t argValues[] = { reinterpret_cast<uintptr_t>(argValue1), 0 };
+  memcpy(&argValues[1], &argValue2, sizeof(argValue2));
+  AddEngineInstantEvent(name, argNames, argTypes, argValues);
+}
+
+EngineTraceScope::EngineTraceScope(const char* name)
+    : name(name), category(nullptr), handle(0) {
+  v8::TracingController* controller = GetTracingController();
+  if (controller == nullptr ||
+      *GetEngineCategoryEnabled(controller) == 0) {
+    return;
+  }
+  category = GetEngineCategoryEnabled(controller);
+  handle = controller->AddTraceEvent(
+      TRACE_EVENT_PHASE_COMPLETE, category, name, nullptr, 0, 0, 0, nullptr,
+      nullptr, nullptr, nullptr, TRACE_EVENT_FLAG_NONE);
+}
+
+EngineTraceScope::~EngineTraceScope() {
+  if (category != nullptr) {
+    GetTracingController()->UpdateTraceEventDuration(category, name, handle);
+  }
+}
+
+}  // namespace jsrt
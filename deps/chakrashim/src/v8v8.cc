@@ -19,6 +19,7 @@
 // IN THE SOFTWARE.
 
 #include <algorithm>
+#include <string>
 #include "v8.h"
 #include "v8chakra.h"
 #include "jsrtutils.h"
@@ -38,7 +39,15 @@ bool g_disposed = false;
 bool g_exposeGC = false;
 bool g_useStrict = false;
 bool g_disableIdleGc = false;
+unsigned int g_jitThreadCount = 0;
+unsigned int g_backgroundThreadCount = 0;
+size_t g_maxOldSpaceSize = 0;
+bool g_jitStatistics = false;
+int g_perfMapFlags = JsPerfMapNone;
+std::string g_profileCacheDir;
+std::string g_byteCodeCacheDir;
 bool g_trace_debug_json = false;
+Platform* g_platform = nullptr;
 
 HeapStatistics::HeapStatistics()
     : total_heap_size_(0),
@@ -51,6 +60,13 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(0) {}
 
+HeapSpaceStatistics::HeapSpaceStatistics()
+    : space_name_(""),
+      space_size_(0),
+      space_used_size_(0),
+      space_available_size_(0),
+      physical_space_size_(0) {}
+
 const char* V8::GetVersion() {
   static char versionStr[kMaxVersionLength] = {};
 
@@ -140,6 +156,59 @@ void V8::SetFlagsFromCommandLine(int* argc, char** argv, bool remove_flags) {
       if (remove_flags) {
         argv[i] = nullptr;
       }
+    } else if (startsWith(arg, "--jit-threads=") ||
+               startsWith(arg, "--jit_threads=")) {
+      g_jitThreadCount = static_cast<unsigned int>(
+        strtoul(arg + sizeof("--jit-threads=") - 1, nullptr, 10));
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
+    } else if (startsWith(arg, "--chakra-background-threads=") ||
+               startsWith(arg, "--chakra_background_threads=")) {
+      g_backgroundThreadCount = static_cast<unsigned int>(
+        strtoul(arg + sizeof("--chakra-background-threads=") - 1, nullptr,
+                10));
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
+    } else if (startsWith(arg, "--max-old-space-size=") ||
+               startsWith(arg, "--max_old_space_size=")) {
+      // In MB like V8, applied as the runtime memory limit
+      g_maxOldSpaceSize = static_cast<size_t>(
+        strtoull(arg + sizeof("--max-old-space-size=") - 1, nullptr, 10))
+        * 1024 * 1024;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
+    } else if (equals("--perf-basic-prof", arg) ||
+               equals("--perf_basic_prof", arg)) {
+      g_perfMapFlags |= JsPerfMapBasic;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
+    } else if (equals("--chakra-jit-statistics", arg) ||
+               equals("--chakra_jit_statistics", arg)) {
+      g_jitStatistics = true;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
+    } else if (equals("--perf-prof", arg) || equals("--perf_prof", arg)) {
+      g_perfMapFlags |= JsPerfMapJitDump;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
+    } else if (startsWith(arg, "--profile-cache-dir=") ||
+               startsWith(arg, "--profile_cache_dir=")) {
+      g_profileCacheDir = arg + sizeof("--profile-cache-dir=") - 1;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
+    } else if (startsWith(arg, "--chakra-bytecode-cache=") ||
+               startsWith(arg, "--chakra_bytecode_cache=")) {
+      g_byteCodeCacheDir = arg + sizeof("--chakra-bytecode-cache=") - 1;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
     } else if (equals("--trace-debug-json", arg) ||
                equals("--trace_debug_json", arg)) {
       g_trace_debug_json = true;
@@ -148,7 +217,6 @@ void V8::SetFlagsFromCommandLine(int* argc, char** argv, bool remove_flags) {
       }
     } else if (startsWith(arg, "--debug") ||
                startsWith(arg, "--harmony") ||
-               startsWith(arg, "--max-old-space-size=") ||
                startsWith(arg, "--nolazy") ||
                startsWith(arg, "--stack-size=")) {
       // Ignore some flags to reduce compatibility issues. These flags don't
@@ -167,6 +235,23 @@ void V8::SetFlagsFromCommandLine(int* argc, char** argv, bool remove_flags) {
           " --expose_gc (expose gc extension)\n"
           "     type: bool  default: false\n"
           " --off_idlegc (turn off idle GC)\n"
+          " --jit_threads (number of background JIT threads)\n"
+          "     type: int  default: 0 (chosen by the engine)\n"
+          " --max_old_space_size (limit of the engine's memory in MB, "
+          "GC runs more often as it gets close)\n"
+          "     type: int  default: 0 (no limit)\n"
+          " --perf_basic_prof (write /tmp/perf-<pid>.map for JIT code, "
+          "Linux only)\n"
+          "     type: bool  default: false\n"
+          " --perf_prof (write /tmp/jit-<pid>.dump for perf inject, "
+          "Linux only)\n"
+          "     type: bool  default: false\n"
+          " --profile_cache_dir (directory keeping JIT profiles of scripts "
+          "across runs)\n"
+          "     type: string  default: none\n"
+          " --chakra_bytecode_cache (directory keeping byte code of scripts "
+          "across runs)\n"
+          "     type: string  default: none\n"
           " --harmony_simd (enable \"harmony simd\" (in progress))\n"
           " --harmony (Other flags are ignored in node running with "
           "chakracore)\n"
@@ -218,6 +303,14 @@ void V8::CancelTerminateExecution(Isolate* isolate) {
   isolate->CancelTerminateExecution();
 }
 
+void V8::InitializePlatform(Platform* platform) {
+  g_platform = platform;
+}
+
+void V8::ShutdownPlatform() {
+  g_platform = nullptr;
+}
+
 void V8::FromJustIsNothing() {
   jsrt::Fatal("v8::FromJust: %s", "Maybe value is Nothing.");
 }
@@ -233,94 +326,4 @@ namespace platform {
   }
 }  // namespace platform
 
-namespace platform {
-namespace tracing {
-  void TracingController::StopTracing() {
-  }
-
-  void TracingController::StartTracing(TraceConfig*) {
-  }
-
-  void TracingController::Initialize(TraceBuffer*) {
-  }
-
-  const uint8_t* TracingController::GetCategoryGroupEnabled(
-      const char* category_group) {
-    static uint8_t no = 0;
-    return &no;
-  }
-
-  uint64_t TracingController::AddTraceEvent(
-      char phase, const uint8_t* category_enabled_flag, const char* name,
-      const char* scope, uint64_t id, uint64_t bind_id, int32_t num_args,
-      const char** arg_names, const uint8_t* arg_types,
-      const uint64_t* arg_values,
-      std::unique_ptr<v8::ConvertableToTraceFormat>* arg_convertables,
-      unsigned int flags) {
-    return 0;
-  }
-
-  void TracingController::UpdateTraceEventDuration(
-      const uint8_t* category_enabled_flag, const char* name, uint64_t handle) {
-  }
-
-  int64_t TracingController::CurrentTimestampMicroseconds() {
-    return 0;
-  }
-
-  int64_t TracingController::CurrentCpuTimestampMicroseconds() {
-    return 0;
-  }
-
-  void TraceConfig::AddIncludedCategory(char const*) {
-    jsrt::Unimplemented("TraceConfig");
-  }
-
-  TraceObject* TraceBufferChunk::AddTraceEvent(size_t*) {
-    jsrt::Unimplemented("TraceBufferChunk");
-    return 0;
-  }
-
-  void TraceBufferChunk::Reset(uint32_t) {
-    jsrt::Unimplemented("TraceBufferChunk");
-  }
-
-  TraceBufferChunk::TraceBufferChunk(uint32_t) {
-    jsrt::Unimplemented("TraceBufferChunk");
-  }
-
-  TraceObject::~TraceObject() {
-    // Intentionally left empty to suppress warning C4722.
-  }
-
-  void TraceObject::Initialize(
-    char phase,
-    const uint8_t* category_enabled_flag,
-    const char* name,
-    const char* scope,
-    uint64_t id,
-    uint64_t bind_id,
-    int num_args,
-    const char** arg_names,
-    const uint8_t* arg_types,
-    const uint64_t* arg_values,
-    std::unique_ptr<v8::ConvertableToTraceFormat>* arg_convertables,
-    unsigned int flags,
-    int64_t timestamp,
-    int64_t cpu_timestamp) {
-    // Unimplemented
-  }
-
-  TraceWriter* TraceWriter::CreateJSONTraceWriter(std::ostream&) {
-    jsrt::Unimplemented("TraceWriter");
-    return 0;
-  }
-
-  TraceWriter* TraceWriter::CreateJSONTraceWriter(std::ostream&,
-                                                  const std::string&) {
-    jsrt::Unimplemented("TraceWriter");
-    return 0;
-  }
-}  // namespace tracing
-}  // namespace platform
 }  // namespace v8
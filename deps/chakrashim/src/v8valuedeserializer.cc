@@ -18,76 +18,836 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <string.h>
+#include <vector>
 #include "v8chakra.h"
+#include "jsrtutils.h"
+#include "jsrtserializationtag.h"
 
 namespace v8 {
 
+using jsrt::IsolateShim;
+using jsrt::ContextShim;
+using jsrt::SerializationTag;
+using jsrt::ArrayBufferViewTag;
+
+struct ValueDeserializer::PrivateData {
+  PrivateData(Isolate* isolate, const uint8_t* data, size_t size,
+              Delegate* delegate)
+      : isolate(isolate),
+        delegate(delegate),
+        position(data),
+        end(data + size),
+        version(0),
+        nextId(0),
+        idMap(JS_INVALID_REFERENCE),
+        arrayBufferTransferMap(JS_INVALID_REFERENCE) {
+  }
+
+  ~PrivateData() {
+    if (idMap != JS_INVALID_REFERENCE) {
+      JsRelease(idMap, nullptr);
+    }
+
+    if (arrayBufferTransferMap != JS_INVALID_REFERENCE) {
+      JsRelease(arrayBufferTransferMap, nullptr);
+    }
+  }
+
+  bool PeekTag(SerializationTag* tag) const;
+  bool ReadTag(SerializationTag* tag);
+  void ConsumeTag(SerializationTag expectedTag);
+
+  template <typename T>
+  bool ReadVarint(T* value);
+  bool ReadZigZag(int32_t* value);
+  bool ReadDouble(double* value);
+  bool ReadRawBytes(size_t length, const uint8_t** data);
+
+  JsErrorCode SetInMap(JsValueRef* map, uint32_t id, JsValueRef value);
+  bool AddObjectWithId(uint32_t id, JsValueRef object);
+  void ThrowDeserializationError();
+
+  bool ReadObject(JsValueRef* result);
+  bool ReadObjectInternal(JsValueRef* result);
+  bool ReadString(JsValueRef* result);
+  bool ReadUtf8String(JsValueRef* result);
+  bool ReadOneByteString(JsValueRef* result);
+  bool ReadTwoByteString(JsValueRef* result);
+  bool ReadObjectReference(JsValueRef* result);
+  bool ReadProperties(JsValueRef object, SerializationTag endTag,
+                      uint32_t* propertiesRead);
+  bool ReadPlainObject(JsValueRef* result);
+  bool ReadDenseArray(JsValueRef* result);
+  bool ReadSparseArray(JsValueRef* result);
+  bool ReadWrapperObject(SerializationTag tag, JsValueRef* result);
+  bool ReadRegExp(JsValueRef* result);
+  bool ReadCollection(SerializationTag endTag, JsValueRef* result);
+  bool ReadArrayBuffer(JsValueRef* result);
+  bool ReadTransferredArrayBuffer(JsValueRef* result);
+  bool ReadSharedArrayBuffer(JsValueRef* result);
+  bool ReadArrayBufferView(JsValueRef arrayBuffer, JsValueRef* result);
+  bool ReadHostObject(JsValueRef* result);
+
+  Isolate* isolate;
+  Delegate* delegate;
+  const uint8_t* position;
+  const uint8_t* const end;
+  uint32_t version;
+  uint32_t nextId;
+
+  // Both maps are sparse arrays indexed by id, rooted for the lifetime of
+  // the deserializer.
+  JsValueRef idMap;
+  JsValueRef arrayBufferTransferMap;
+};
+
+bool ValueDeserializer::PrivateData::PeekTag(SerializationTag* tag) const {
+  const uint8_t* peekPosition = position;
+  do {
+    if (peekPosition >= end) {
+      return false;
+    }
+    *tag = static_cast<SerializationTag>(*peekPosition);
+    peekPosition++;
+  } while (*tag == SerializationTag::kPadding);
+  return true;
+}
+
+bool ValueDeserializer::PrivateData::ReadTag(SerializationTag* tag) {
+  do {
+    if (position >= end) {
+      return false;
+    }
+    *tag = static_cast<SerializationTag>(*position);
+    position++;
+  } while (*tag == SerializationTag::kPadding);
+  return true;
+}
+
+void ValueDeserializer::PrivateData::ConsumeTag(
+    SerializationTag expectedTag) {
+  SerializationTag actualTag;
+  bool result = ReadTag(&actualTag);
+  CHAKRA_ASSERT(result && actualTag == expectedTag);
+  (void)result;
+}
+
+template <typename T>
+bool ValueDeserializer::PrivateData::ReadVarint(T* value) {
+  // Seven bits of the value per byte, least significant first. Bits that
+  // don't fit into T are dropped.
+  T result = 0;
+  unsigned int shift = 0;
+  bool hasAnotherByte;
+  do {
+    if (position >= end) {
+      return false;
+    }
+    uint8_t byte = *position;
+    if (shift < sizeof(T) * 8) {
+      result |= static_cast<T>(byte & 0x7F) << shift;
+      shift += 7;
+    }
+    hasAnotherByte = (byte & 0x80) != 0;
+    position++;
+  } while (hasAnotherByte);
+
+  *value = result;
+  return true;
+}
+
+bool ValueDeserializer::PrivateData::ReadZigZag(int32_t* value) {
+  uint32_t unsignedValue;
+  if (!ReadVarint(&unsignedValue)) {
+    return false;
+  }
+  *value = static_cast<int32_t>((unsignedValue >> 1) ^ -(unsignedValue & 1));
+  return true;
+}
+
+bool ValueDeserializer::PrivateData::ReadDouble(double* value) {
+  const uint8_t* data;
+  if (!ReadRawBytes(sizeof(*value), &data)) {
+    return false;
+  }
+  memcpy(value, data, sizeof(*value));
+  return true;
+}
+
+bool ValueDeserializer::PrivateData::ReadRawBytes(size_t length,
+                                                  const uint8_t** data) {
+  if (length > static_cast<size_t>(end - position)) {
+    return false;
+  }
+  *data = position;
+  position += length;
+  return true;
+}
+
+JsErrorCode ValueDeserializer::PrivateData::SetInMap(JsValueRef* map,
+                                                     uint32_t id,
+                                                     JsValueRef value) {
+  if (*map == JS_INVALID_REFERENCE) {
+    IfJsErrorRet(JsCreateArray(0, map));
+    IfJsErrorRet(JsAddRef(*map, nullptr));
+  }
+
+  return jsrt::SetIndexedProperty(*map, id, value);
+}
+
+bool ValueDeserializer::PrivateData::AddObjectWithId(uint32_t id,
+                                                     JsValueRef object) {
+  return SetInMap(&idMap, id, object) == JsNoError;
+}
+
+void ValueDeserializer::PrivateData::ThrowDeserializationError() {
+  bool hasException = false;
+  if (JsHasException(&hasException) == JsNoError && hasException) {
+    return;
+  }
+
+  isolate->ThrowException(Exception::Error(
+      String::NewFromUtf8(isolate, "Unable to deserialize cloned data.",
+                          NewStringType::kNormal).ToLocalChecked()));
+}
+
+bool ValueDeserializer::PrivateData::ReadObject(JsValueRef* result) {
+  if (!ReadObjectInternal(result)) {
+    return false;
+  }
+
+  // A view is written right after the buffer it is backed by
+  SerializationTag tag;
+  if (PeekTag(&tag) && tag == SerializationTag::kArrayBufferView) {
+    JsValueType type;
+    if (JsGetValueType(*result, &type) != JsNoError) {
+      return false;
+    }
+    if (type == JsArrayBuffer ||
+        (type == JsObject &&
+         static_cast<Value*>(*result)->IsSharedArrayBuffer())) {
+      ConsumeTag(SerializationTag::kArrayBufferView);
+      return ReadArrayBufferView(*result, result);
+    }
+  }
+
+  return true;
+}
+
+bool ValueDeserializer::PrivateData::ReadObjectInternal(JsValueRef* result) {
+  SerializationTag tag;
+  if (!ReadTag(&tag)) {
+    return false;
+  }
+
+  switch (tag) {
+    case SerializationTag::kVerifyObjectCount: {
+      // Read the count and ignore it
+      uint32_t count;
+      return ReadVarint(&count) && ReadObject(result);
+    }
+    case SerializationTag::kUndefined:
+      *result = jsrt::GetUndefined();
+      return true;
+    case SerializationTag::kNull:
+      *result = jsrt::GetNull();
+      return true;
+    case SerializationTag::kTrue:
+      *result = jsrt::GetTrue();
+      return true;
+    case SerializationTag::kFalse:
+      *result = jsrt::GetFalse();
+      return true;
+    case SerializationTag::kInt32: {
+      int32_t value;
+      return ReadZigZag(&value) && JsIntToNumber(value, result) == JsNoError;
+    }
+    case SerializationTag::kUint32: {
+      uint32_t value;
+      return ReadVarint(&value) &&
+             JsDoubleToNumber(value, result) == JsNoError;
+    }
+    case SerializationTag::kDouble: {
+      double value;
+      return ReadDouble(&value) &&
+             JsDoubleToNumber(value, result) == JsNoError;
+    }
+    case SerializationTag::kUtf8String:
+      return ReadUtf8String(result);
+    case SerializationTag::kOneByteString:
+      return ReadOneByteString(result);
+    case SerializationTag::kTwoByteString:
+      return ReadTwoByteString(result);
+    case SerializationTag::kObjectReference:
+      return ReadObjectReference(result);
+    case SerializationTag::kBeginJSObject:
+      return ReadPlainObject(result);
+    case SerializationTag::kBeginSparseJSArray:
+      return ReadSparseArray(result);
+    case SerializationTag::kBeginDenseJSArray:
+      return ReadDenseArray(result);
+    case SerializationTag::kDate:
+    case SerializationTag::kTrueObject:
+    case SerializationTag::kFalseObject:
+    case SerializationTag::kNumberObject:
+    case SerializationTag::kStringObject:
+      return ReadWrapperObject(tag, result);
+    case SerializationTag::kRegExp:
+      return ReadRegExp(result);
+    case SerializationTag::kBeginJSMap:
+      return ReadCollection(SerializationTag::kEndJSMap, result);
+    case SerializationTag::kBeginJSSet:
+      return ReadCollection(SerializationTag::kEndJSSet, result);
+    case SerializationTag::kArrayBuffer:
+      return ReadArrayBuffer(result);
+    case SerializationTag::kArrayBufferTransfer:
+      return ReadTransferredArrayBuffer(result);
+    case SerializationTag::kSharedArrayBuffer:
+      return ReadSharedArrayBuffer(result);
+    case SerializationTag::kHostObject:
+      return ReadHostObject(result);
+    default:
+      return false;
+  }
+}
+
+bool ValueDeserializer::PrivateData::ReadString(JsValueRef* result) {
+  JsValueType type;
+  return ReadObjectInternal(result) &&
+         JsGetValueType(*result, &type) == JsNoError && type == JsString;
+}
+
+bool ValueDeserializer::PrivateData::ReadUtf8String(JsValueRef* result) {
+  uint32_t length;
+  const uint8_t* data;
+  return ReadVarint(&length) && ReadRawBytes(length, &data) &&
+         JsCreateString(reinterpret_cast<const char*>(data), length,
+                        result) == JsNoError;
+}
+
+bool ValueDeserializer::PrivateData::ReadOneByteString(JsValueRef* result) {
+  uint32_t length;
+  const uint8_t* data;
+  if (!ReadVarint(&length) || !ReadRawBytes(length, &data)) {
+    return false;
+  }
+
+  // Latin-1 maps directly onto the first 256 UTF-16 code units
+  std::vector<uint16_t> chars(data, data + length);
+  return JsCreateStringUtf16(chars.data(), length, result) == JsNoError;
+}
+
+bool ValueDeserializer::PrivateData::ReadTwoByteString(JsValueRef* result) {
+  uint32_t byteLength;
+  const uint8_t* data;
+  if (!ReadVarint(&byteLength) || byteLength % sizeof(uint16_t) != 0 ||
+      !ReadRawBytes(byteLength, &data)) {
+    return false;
+  }
+
+  // The payload may not be aligned within the buffer we were handed
+  std::vector<uint16_t> chars(byteLength / sizeof(uint16_t));
+  if (byteLength > 0) {
+    memcpy(chars.data(), data, byteLength);
+  }
+  return JsCreateStringUtf16(chars.data(), chars.size(), result) == JsNoError;
+}
+
+bool ValueDeserializer::PrivateData::ReadObjectReference(JsValueRef* result) {
+  uint32_t id;
+  if (!ReadVarint(&id) || id >= nextId || idMap == JS_INVALID_REFERENCE) {
+    return false;
+  }
+
+  return jsrt::GetIndexedProperty(idMap, id, result) == JsNoError;
+}
+
+bool ValueDeserializer::PrivateData::ReadProperties(
+    JsValueRef object, SerializationTag endTag, uint32_t* propertiesRead) {
+  uint32_t count = 0;
+  for (;;) {
+    SerializationTag tag;
+    if (!PeekTag(&tag)) {
+      return false;
+    }
+    if (tag == endTag) {
+      ConsumeTag(endTag);
+      break;
+    }
+
+    JsValueRef key;
+    JsValueRef value;
+    JsValueType keyType;
+    if (!ReadObject(&key) ||
+        JsGetValueType(key, &keyType) != JsNoError ||
+        !ReadObject(&value)) {
+      return false;
+    }
+
+    JsErrorCode error;
+    if (keyType == JsNumber) {
+      error = JsSetIndexedProperty(object, key, value);
+    } else if (keyType == JsString) {
+      error = JsObjectSetProperty(object, key, value, true);
+    } else {
+      return false;
+    }
+    if (error != JsNoError) {
+      return false;
+    }
+
+    count++;
+  }
+
+  *propertiesRead = count;
+  return true;
+}
+
+bool ValueDeserializer::PrivateData::ReadPlainObject(JsValueRef* result) {
+  uint32_t id = nextId++;
+  JsValueRef object;
+  if (JsCreateObject(&object) != JsNoError || !AddObjectWithId(id, object)) {
+    return false;
+  }
+
+  uint32_t propertiesRead;
+  uint32_t expectedProperties;
+  if (!ReadProperties(object, SerializationTag::kEndJSObject,
+                      &propertiesRead) ||
+      !ReadVarint(&expectedProperties) ||
+      propertiesRead != expectedProperties) {
+    return false;
+  }
+
+  *result = object;
+  return true;
+}
+
+bool ValueDeserializer::PrivateData::ReadDenseArray(JsValueRef* result) {
+  uint32_t length;
+  if (!ReadVarint(&length) ||
+      length > static_cast<size_t>(end - position)) {
+    // Every element takes at least one byte
+    return false;
+  }
+
+  uint32_t id = nextId++;
+  JsValueRef array;
+  if (JsCreateArray(length, &array) != JsNoError ||
+      !AddObjectWithId(id, array)) {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < length; i++) {
+    SerializationTag tag;
+    if (!PeekTag(&tag)) {
+      return false;
+    }
+    if (tag == SerializationTag::kTheHole) {
+      ConsumeTag(SerializationTag::kTheHole);
+      continue;
+    }
+
+    JsValueRef element;
+    if (!ReadObject(&element) ||
+        jsrt::SetIndexedProperty(array, i, element) != JsNoError) {
+      return false;
+    }
+  }
+
+  uint32_t propertiesRead;
+  uint32_t expectedProperties;
+  uint32_t expectedLength;
+  if (!ReadProperties(array, SerializationTag::kEndDenseJSArray,
+                      &propertiesRead) ||
+      !ReadVarint(&expectedProperties) || !ReadVarint(&expectedLength) ||
+      propertiesRead != expectedProperties || length != expectedLength) {
+    return false;
+  }
+
+  *result = array;
+  return true;
+}
+
+bool ValueDeserializer::PrivateData::ReadSparseArray(JsValueRef* result) {
+  uint32_t length;
+  if (!ReadVarint(&length)) {
+    return false;
+  }
+
+  uint32_t id = nextId++;
+  JsValueRef array;
+  if (JsCreateArray(length, &array) != JsNoError ||
+      !AddObjectWithId(id, array)) {
+    return false;
+  }
+
+  uint32_t propertiesRead;
+  uint32_t expectedProperties;
+  uint32_t expectedLength;
+  if (!ReadProperties(array, SerializationTag::kEndSparseJSArray,
+                      &propertiesRead) ||
+      !ReadVarint(&expectedProperties) || !ReadVarint(&expectedLength) ||
+      propertiesRead != expectedProperties || length != expectedLength) {
+    return false;
+  }
+
+  *result = array;
+  return true;
+}
+
+bool ValueDeserializer::PrivateData::ReadWrapperObject(SerializationTag tag,
+                                                       JsValueRef* result) {
+  uint32_t id = nextId++;
+  ContextShim* contextShim = ContextShim::GetCurrent();
+  JsValueRef constructor;
+  JsValueRef value;
+
+  switch (tag) {
+    case SerializationTag::kDate:
+    case SerializationTag::kNumberObject: {
+      double number;
+      if (!ReadDouble(&number) ||
+          JsDoubleToNumber(number, &value) != JsNoError) {
+        return false;
+      }
+      constructor = tag == SerializationTag::kDate ?
+          contextShim->GetDateConstructor() :
+          contextShim->GetNumberObjectConstructor();
+      break;
+    }
+    case SerializationTag::kTrueObject:
+    case SerializationTag::kFalseObject:
+      value = tag == SerializationTag::kTrueObject ?
+          contextShim->GetTrue() : contextShim->GetFalse();
+      constructor = contextShim->GetBooleanObjectConstructor();
+      break;
+    case SerializationTag::kStringObject:
+      if (!ReadString(&value)) {
+        return false;
+      }
+      constructor = contextShim->GetStringObjectConstructor();
+      break;
+    default:
+      CHAKRA_ASSERT(false);
+      return false;
+  }
+
+  return jsrt::ConstructObject(constructor, value, result) == JsNoError &&
+         AddObjectWithId(id, *result);
+}
+
+bool ValueDeserializer::PrivateData::ReadRegExp(JsValueRef* result) {
+  uint32_t id = nextId++;
+  JsValueRef pattern;
+  uint32_t flags;
+  if (!ReadString(&pattern) || !ReadVarint(&flags)) {
+    return false;
+  }
+
+  static const struct {
+    uint32_t bit;
+    char flag;
+  } kFlags[] = {
+    { jsrt::kRegExpGlobal, 'g' },
+    { jsrt::kRegExpIgnoreCase, 'i' },
+    { jsrt::kRegExpMultiline, 'm' },
+    { jsrt::kRegExpSticky, 'y' },
+    { jsrt::kRegExpUnicode, 'u' },
+    { jsrt::kRegExpDotAll, 's' },
+  };
+
+  char flagsString[_countof(kFlags)];
+  size_t flagsCount = 0;
+  uint32_t knownFlags = 0;
+  for (size_t i = 0; i < _countof(kFlags); i++) {
+    knownFlags |= kFlags[i].bit;
+    if (flags & kFlags[i].bit) {
+      flagsString[flagsCount++] = kFlags[i].flag;
+    }
+  }
+  if (flags & ~knownFlags) {
+    return false;
+  }
+
+  JsValueRef flagsValue;
+  return JsCreateString(flagsString, flagsCount, &flagsValue) == JsNoError &&
+         jsrt::ConstructObject(ContextShim::GetCurrent()->GetRegExpConstructor(),
+                               pattern, flagsValue, result) == JsNoError &&
+         AddObjectWithId(id, *result);
+}
+
+bool ValueDeserializer::PrivateData::ReadCollection(SerializationTag endTag,
+                                                    JsValueRef* result) {
+  uint32_t id = nextId++;
+  bool isMap = endTag == SerializationTag::kEndJSMap;
+  ContextShim* contextShim = ContextShim::GetCurrent();
+
+  JsValueRef collection;
+  if (jsrt::ConstructObject(isMap ? contextShim->GetMapConstructor() :
+                                    contextShim->GetSetConstructor(),
+                            &collection) != JsNoError ||
+      !AddObjectWithId(id, collection)) {
+    return false;
+  }
+
+  JsValueRef addFunction = isMap ? contextShim->GetMapSetFunction() :
+                                   contextShim->GetSetAddFunction();
+  uint32_t length = 0;
+  for (;;) {
+    SerializationTag tag;
+    if (!PeekTag(&tag)) {
+      return false;
+    }
+    if (tag == endTag) {
+      ConsumeTag(endTag);
+      break;
+    }
+
+    JsValueRef args[] = { collection, JS_INVALID_REFERENCE,
+                          JS_INVALID_REFERENCE };
+    unsigned short argCount = isMap ? 3 : 2;  // NOLINT(runtime/int)
+    for (unsigned short i = 1; i < argCount; i++) {  // NOLINT(runtime/int)
+      if (!ReadObject(&args[i])) {
+        return false;
+      }
+    }
+
+    JsValueRef ignored;
+    if (JsCallFunction(addFunction, args, argCount, &ignored) != JsNoError) {
+      return false;
+    }
+    length += argCount - 1;
+  }
+
+  uint32_t expectedLength;
+  if (!ReadVarint(&expectedLength) || length != expectedLength) {
+    return false;
+  }
+
+  *result = collection;
+  return true;
+}
+
+bool ValueDeserializer::PrivateData::ReadArrayBuffer(JsValueRef* result) {
+  uint32_t id = nextId++;
+  uint32_t byteLength;
+  const uint8_t* data;
+  if (!ReadVarint(&byteLength) || !ReadRawBytes(byteLength, &data)) {
+    return false;
+  }
+
+  JsValueRef arrayBuffer;
+  BYTE* buffer;
+  unsigned int bufferLength;
+  if (JsCreateArrayBuffer(byteLength, &arrayBuffer) != JsNoError ||
+      JsGetArrayBufferStorage(arrayBuffer, &buffer,
+                              &bufferLength) != JsNoError) {
+    return false;
+  }
+
+  CHAKRA_ASSERT(bufferLength == byteLength);
+  if (byteLength > 0) {
+    memcpy(buffer, data, byteLength);
+  }
+
+  *result = arrayBuffer;
+  return AddObjectWithId(id, arrayBuffer);
+}
+
+bool ValueDeserializer::PrivateData::ReadTransferredArrayBuffer(
+    JsValueRef* result) {
+  uint32_t id = nextId++;
+  uint32_t transferId;
+  bool hasTransfer = false;
+  JsValueRef transferIdRef;
+  if (!ReadVarint(&transferId) ||
+      arrayBufferTransferMap == JS_INVALID_REFERENCE ||
+      jsrt::UintToValue(transferId, &transferIdRef) != JsNoError ||
+      JsHasIndexedProperty(arrayBufferTransferMap, transferIdRef,
+                           &hasTransfer) != JsNoError ||
+      !hasTransfer) {
+    return false;
+  }
+
+  return JsGetIndexedProperty(arrayBufferTransferMap, transferIdRef,
+                              result) == JsNoError &&
+         AddObjectWithId(id, *result);
+}
+
+bool ValueDeserializer::PrivateData::ReadSharedArrayBuffer(
+    JsValueRef* result) {
+  uint32_t id = nextId++;
+  uint32_t cloneId;
+  if (!ReadVarint(&cloneId) || delegate == nullptr) {
+    return false;
+  }
+
+  Local<SharedArrayBuffer> sharedArrayBuffer;
+  if (!delegate->GetSharedArrayBufferFromId(isolate, cloneId)
+          .ToLocal(&sharedArrayBuffer)) {
+    return false;
+  }
+
+  *result = *sharedArrayBuffer;
+  return AddObjectWithId(id, *result);
+}
+
+bool ValueDeserializer::PrivateData::ReadArrayBufferView(
+    JsValueRef arrayBuffer, JsValueRef* result) {
+  uint8_t tag;
+  const uint8_t* tagData;
+  uint32_t byteOffset;
+  uint32_t byteLength;
+  if (!ReadRawBytes(sizeof(tag), &tagData) || !ReadVarint(&byteOffset) ||
+      !ReadVarint(&byteLength)) {
+    return false;
+  }
+  tag = *tagData;
+
+  uint32_t id = nextId++;
+  if (static_cast<ArrayBufferViewTag>(tag) == ArrayBufferViewTag::kDataView) {
+    return JsCreateDataView(arrayBuffer, byteOffset, byteLength,
+                            result) == JsNoError &&
+           AddObjectWithId(id, *result);
+  }
+
+  JsTypedArrayType arrayType;
+  uint32_t elementSize;
+  switch (static_cast<ArrayBufferViewTag>(tag)) {
+#define TYPED_ARRAY_CASE(Type, type) \
+    case ArrayBufferViewTag::k##Type##Array: \
+      arrayType = JsArrayType##Type; \
+      elementSize = sizeof(type); \
+      break;
+    TYPED_ARRAY_CASE(Int8, int8_t)
+    TYPED_ARRAY_CASE(Uint8, uint8_t)
+    TYPED_ARRAY_CASE(Uint8Clamped, uint8_t)
+    TYPED_ARRAY_CASE(Int16, int16_t)
+    TYPED_ARRAY_CASE(Uint16, uint16_t)
+    TYPED_ARRAY_CASE(Int32, int32_t)
+    TYPED_ARRAY_CASE(Uint32, uint32_t)
+    TYPED_ARRAY_CASE(Float32, float)
+    TYPED_ARRAY_CASE(Float64, double)
+#undef TYPED_ARRAY_CASE
+    default:
+      return false;
+  }
+
+  // Range checks against the buffer are left to the typed array constructor
+  if (byteOffset % elementSize != 0 || byteLength % elementSize != 0) {
+    return false;
+  }
+
+  return JsCreateTypedArray(arrayType, arrayBuffer, byteOffset,
+                            byteLength / elementSize, result) == JsNoError &&
+         AddObjectWithId(id, *result);
+}
+
+bool ValueDeserializer::PrivateData::ReadHostObject(JsValueRef* result) {
+  if (delegate == nullptr) {
+    return false;
+  }
+
+  uint32_t id = nextId++;
+  Local<Object> object;
+  if (!delegate->ReadHostObject(isolate).ToLocal(&object)) {
+    return false;
+  }
+
+  *result = *object;
+  return AddObjectWithId(id, *result);
+}
+
 MaybeLocal<Object> ValueDeserializer::Delegate::ReadHostObject(
     Isolate* isolate) {
-  CHAKRA_UNIMPLEMENTED();
-  return Local<Object>();
+  isolate->ThrowException(Exception::Error(
+      String::NewFromUtf8(isolate, "Unable to deserialize cloned data.",
+                          NewStringType::kNormal).ToLocalChecked()));
+  return MaybeLocal<Object>();
 }
 
 MaybeLocal<SharedArrayBuffer>
 ValueDeserializer::Delegate::GetSharedArrayBufferFromId(Isolate* isolate,
                                                         uint32_t clone_id) {
-  CHAKRA_UNIMPLEMENTED();
-  return Local<SharedArrayBuffer>();
+  isolate->ThrowException(Exception::Error(
+      String::NewFromUtf8(isolate, "Unable to deserialize cloned data.",
+                          NewStringType::kNormal).ToLocalChecked()));
+  return MaybeLocal<SharedArrayBuffer>();
 }
 
 ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
-                                     size_t size, Delegate* delegate) {
-  CHAKRA_UNIMPLEMENTED();
+                                     size_t size, Delegate* delegate)
+    : private_(new PrivateData(isolate, data, size, delegate)) {
 }
 
 ValueDeserializer::~ValueDeserializer() {
-  // Intentionally left empty to suppress warning C4722.
+  delete private_;
 }
 
 Maybe<bool> ValueDeserializer::ReadHeader(Local<Context> context) {
-  CHAKRA_UNIMPLEMENTED();
-  return Nothing<bool>();
+  if (private_->position < private_->end &&
+      *private_->position ==
+          static_cast<uint8_t>(SerializationTag::kVersion)) {
+    private_->ConsumeTag(SerializationTag::kVersion);
+    if (!private_->ReadVarint(&private_->version) ||
+        private_->version > jsrt::kSerializerLatestVersion) {
+      private_->isolate->ThrowException(Exception::Error(
+          String::NewFromUtf8(private_->isolate,
+                              "Unable to deserialize cloned data due to "
+                              "invalid or unsupported version.",
+                              NewStringType::kNormal).ToLocalChecked()));
+      return Nothing<bool>();
+    }
+  }
+  return Just(true);
 }
 
 MaybeLocal<Value> ValueDeserializer::ReadValue(Local<Context> context) {
-  CHAKRA_UNIMPLEMENTED();
-  return Local<Value>();
+  JsValueRef result;
+  if (!private_->ReadObject(&result)) {
+    private_->ThrowDeserializationError();
+    return Local<Value>();
+  }
+  return Local<Value>::New(result);
 }
 
-
 void ValueDeserializer::TransferArrayBuffer(uint32_t transfer_id,
                                             Local<ArrayBuffer> array_buffer) {
-  CHAKRA_UNIMPLEMENTED();
+  private_->SetInMap(&private_->arrayBufferTransferMap, transfer_id,
+                     *array_buffer);
 }
 
 void ValueDeserializer::TransferSharedArrayBuffer(
     uint32_t id, Local<SharedArrayBuffer> shared_array_buffer) {
-  CHAKRA_UNIMPLEMENTED();
+  private_->SetInMap(&private_->arrayBufferTransferMap, id,
+                     *shared_array_buffer);
 }
 
 uint32_t ValueDeserializer::GetWireFormatVersion() const {
-  CHAKRA_UNIMPLEMENTED();
-  return 0;
+  return private_->version;
 }
 
 bool ValueDeserializer::ReadUint32(uint32_t* value) {
-  CHAKRA_UNIMPLEMENTED();
-  return false;
+  return private_->ReadVarint(value);
 }
 
 bool ValueDeserializer::ReadUint64(uint64_t* value) {
-  CHAKRA_UNIMPLEMENTED();
-  return false;
+  return private_->ReadVarint(value);
 }
 
 bool ValueDeserializer::ReadDouble(double* value) {
-  CHAKRA_UNIMPLEMENTED();
-  return false;
+  return private_->ReadDouble(value);
 }
 
 bool ValueDeserializer::ReadRawBytes(size_t length, const void** data) {
-  CHAKRA_UNIMPLEMENTED();
-  return false;
+  const uint8_t* bytes;
+  if (!private_->ReadRawBytes(length, &bytes)) {
+    return false;
+  }
+  *data = bytes;
+  return true;
 }
 
 }  // namespace v8
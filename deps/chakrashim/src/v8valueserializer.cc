@@ -18,83 +18,831 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <stdlib.h>
+#include <string.h>
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include "v8chakra.h"
+#include "jsrtutils.h"
+#include "jsrtserializationtag.h"
 
 namespace v8 {
 
+using jsrt::IsolateShim;
+using jsrt::ContextShim;
+using jsrt::CachedPropertyIdRef;
+using jsrt::SerializationTag;
+using jsrt::ArrayBufferViewTag;
+
+struct ValueSerializer::PrivateData {
+  PrivateData(Isolate* isolate, Delegate* delegate)
+      : isolate(isolate),
+        delegate(delegate),
+        buffer(nullptr),
+        bufferSize(0),
+        bufferCapacity(0),
+        outOfMemory(false),
+        treatArrayBufferViewsAsHostObjects(false),
+        nextId(0),
+        keepAlive(JS_INVALID_REFERENCE),
+        keepAliveCount(0),
+        objectPrototype(JS_INVALID_REFERENCE) {
+  }
+
+  ~PrivateData() {
+    if (buffer != nullptr) {
+      if (delegate != nullptr) {
+        delegate->FreeBufferMemory(buffer);
+      } else {
+        free(buffer);
+      }
+    }
+
+    if (keepAlive != JS_INVALID_REFERENCE) {
+      JsRelease(keepAlive, nullptr);
+    }
+  }
+
+  bool ExpandBuffer(size_t requiredCapacity);
+  uint8_t* ReserveRawBytes(size_t bytes);
+  void WriteRawBytes(const void* source, size_t length);
+  void WriteTag(SerializationTag tag);
+
+  template <typename T>
+  void WriteVarint(T value);
+  void WriteZigZag(int32_t value);
+  void WriteDouble(double value);
+
+  JsErrorCode KeepAlive(JsValueRef value);
+  void ThrowDataCloneError(JsValueRef value);
+
+  Maybe<bool> WriteObject(JsValueRef value);
+  void WriteNumber(double value);
+  Maybe<bool> WriteString(JsValueRef value);
+  Maybe<bool> WriteReceiver(JsValueRef object, JsValueType type);
+  Maybe<bool> WriteProperties(JsValueRef object, JsValueRef keys,
+                              bool keysAreIndices, uint32_t* written);
+  Maybe<bool> WritePlainObject(JsValueRef object);
+  Maybe<bool> WriteArray(JsValueRef array);
+  Maybe<bool> WriteTaggedObject(JsValueRef object, const char* className);
+  Maybe<bool> WriteRegExp(JsValueRef regExp);
+  Maybe<bool> WriteCollection(JsValueRef collection,
+                              SerializationTag beginTag,
+                              SerializationTag endTag);
+  Maybe<bool> WriteArrayBuffer(JsValueRef arrayBuffer);
+  Maybe<bool> WriteSharedArrayBuffer(JsValueRef sharedArrayBuffer);
+  Maybe<bool> WriteArrayBufferView(JsValueRef view, JsValueType type);
+  Maybe<bool> WriteHostObject(JsValueRef object);
+
+  Isolate* isolate;
+  Delegate* delegate;
+
+  uint8_t* buffer;
+  size_t bufferSize;
+  size_t bufferCapacity;
+  bool outOfMemory;
+  bool treatArrayBufferViewsAsHostObjects;
+
+  // Objects are identified by their address. Chakra does not move objects,
+  // but every object in the map is referenced from keepAlive so that its
+  // address can't be recycled between two WriteValue() calls.
+  std::unordered_map<JsValueRef, uint32_t> idMap;
+  std::unordered_map<JsValueRef, uint32_t> arrayBufferTransferMap;
+  uint32_t nextId;
+  JsValueRef keepAlive;
+  unsigned int keepAliveCount;
+  JsValueRef objectPrototype;
+};
+
+bool ValueSerializer::PrivateData::ExpandBuffer(size_t requiredCapacity) {
+  CHAKRA_ASSERT(requiredCapacity > bufferCapacity);
+  size_t requestedCapacity =
+      requiredCapacity > bufferCapacity * 2 ? requiredCapacity
+                                            : bufferCapacity * 2;
+  requestedCapacity = requestedCapacity < 64 ? 64 : requestedCapacity;
+
+  size_t providedCapacity = 0;
+  void* newBuffer = nullptr;
+  if (delegate != nullptr) {
+    newBuffer = delegate->ReallocateBufferMemory(buffer, requestedCapacity,
+                                                 &providedCapacity);
+  } else {
+    newBuffer = realloc(buffer, requestedCapacity);
+    providedCapacity = requestedCapacity;
+  }
+
+  if (newBuffer == nullptr) {
+    outOfMemory = true;
+    return false;
+  }
+
+  CHAKRA_ASSERT(providedCapacity >= requiredCapacity);
+  buffer = static_cast<uint8_t*>(newBuffer);
+  bufferCapacity = providedCapacity;
+  return true;
+}
+
+uint8_t* ValueSerializer::PrivateData::ReserveRawBytes(size_t bytes) {
+  size_t oldSize = bufferSize;
+  size_t newSize = oldSize + bytes;
+  if (newSize > bufferCapacity && !ExpandBuffer(newSize)) {
+    return nullptr;
+  }
+  bufferSize = newSize;
+  return buffer + oldSize;
+}
+
+void ValueSerializer::PrivateData::WriteRawBytes(const void* source,
+                                                 size_t length) {
+  uint8_t* dest = ReserveRawBytes(length);
+  if (dest != nullptr && length > 0) {
+    memcpy(dest, source, length);
+  }
+}
+
+void ValueSerializer::PrivateData::WriteTag(SerializationTag tag) {
+  uint8_t rawTag = static_cast<uint8_t>(tag);
+  WriteRawBytes(&rawTag, sizeof(rawTag));
+}
+
+template <typename T>
+void ValueSerializer::PrivateData::WriteVarint(T value) {
+  // Seven bits of the value per byte, least significant first, with the high
+  // bit set on every byte except the last one.
+  uint8_t stackBuffer[sizeof(T) * 8 / 7 + 1];
+  uint8_t* next = stackBuffer;
+  do {
+    *next = (value & 0x7F) | 0x80;
+    next++;
+    value >>= 7;
+  } while (value);
+  *(next - 1) &= 0x7F;
+  WriteRawBytes(stackBuffer, next - stackBuffer);
+}
+
+void ValueSerializer::PrivateData::WriteZigZag(int32_t value) {
+  WriteVarint((static_cast<uint32_t>(value) << 1) ^
+              static_cast<uint32_t>(value >> 31));
+}
+
+void ValueSerializer::PrivateData::WriteDouble(double value) {
+  WriteRawBytes(&value, sizeof(value));
+}
+
+JsErrorCode ValueSerializer::PrivateData::KeepAlive(JsValueRef value) {
+  if (keepAlive == JS_INVALID_REFERENCE) {
+    IfJsErrorRet(JsCreateArray(0, &keepAlive));
+    IfJsErrorRet(JsAddRef(keepAlive, nullptr));
+  }
+
+  return jsrt::SetIndexedProperty(keepAlive, keepAliveCount++, value);
+}
+
+void ValueSerializer::PrivateData::ThrowDataCloneError(JsValueRef value) {
+  bool hasException = false;
+  if (JsHasException(&hasException) == JsNoError && hasException) {
+    return;
+  }
+
+  JsValueRef description = JS_INVALID_REFERENCE;
+  JsValueType type;
+  if (JsGetValueType(value, &type) == JsNoError && type == JsSymbol) {
+    // Symbols refuse implicit string conversion; use Symbol.prototype.toString
+    JsValueRef symbolObject;
+    if (JsConvertValueToObject(value, &symbolObject) != JsNoError ||
+        jsrt::CallGetter(symbolObject, CachedPropertyIdRef::toString,
+                         &description) != JsNoError) {
+      return;
+    }
+  } else if (JsConvertValueToString(value, &description) != JsNoError) {
+    return;
+  }
+
+  jsrt::StringUtf8 str;
+  if (str.From(description) != JsNoError) {
+    return;
+  }
+
+  std::string message(*str, str.length());
+  message.append(" could not be cloned.");
+
+  Local<String> messageString;
+  if (!String::NewFromUtf8(isolate, message.c_str(), NewStringType::kNormal,
+                           static_cast<int>(message.length()))
+          .ToLocal(&messageString)) {
+    return;
+  }
+
+  if (delegate != nullptr) {
+    delegate->ThrowDataCloneError(messageString);
+  } else {
+    isolate->ThrowException(Exception::Error(messageString));
+  }
+}
+
+Maybe<bool> ValueSerializer::PrivateData::WriteObject(JsValueRef value) {
+  JsValueType type;
+  if (JsGetValueType(value, &type) != JsNoError) {
+    return Nothing<bool>();
+  }
+
+  switch (type) {
+    case JsUndefined:
+      WriteTag(SerializationTag::kUndefined);
+      return Just(true);
+    case JsNull:
+      WriteTag(SerializationTag::kNull);
+      return Just(true);
+    case JsBoolean: {
+      bool boolValue;
+      if (JsBooleanToBool(value, &boolValue) != JsNoError) {
+        return Nothing<bool>();
+      }
+      WriteTag(boolValue ? SerializationTag::kTrue : SerializationTag::kFalse);
+      return Just(true);
+    }
+    case JsNumber: {
+      double numberValue;
+      if (JsNumberToDouble(value, &numberValue) != JsNoError) {
+        return Nothing<bool>();
+      }
+      WriteNumber(numberValue);
+      return Just(true);
+    }
+    case JsString:
+      return WriteString(value);
+    case JsSymbol:
+      ThrowDataCloneError(value);
+      return Nothing<bool>();
+    case JsTypedArray:
+    case JsDataView:
+      // Views are preceded by their buffer, which the deserializer needs to
+      // have at hand when recreating the view itself.
+      if (!treatArrayBufferViewsAsHostObjects &&
+          idMap.find(value) == idMap.end()) {
+        JsValueRef arrayBuffer;
+        JsValueType arrayBufferType;
+        JsErrorCode error = type == JsTypedArray ?
+            JsGetTypedArrayInfo(value, nullptr, &arrayBuffer, nullptr, nullptr) :
+            JsGetDataViewInfo(value, &arrayBuffer, nullptr, nullptr);
+        if (error != JsNoError ||
+            JsGetValueType(arrayBuffer, &arrayBufferType) != JsNoError ||
+            WriteReceiver(arrayBuffer, arrayBufferType).IsNothing()) {
+          return Nothing<bool>();
+        }
+      }
+      return WriteReceiver(value, type);
+    default:
+      return WriteReceiver(value, type);
+  }
+}
+
+void ValueSerializer::PrivateData::WriteNumber(double value) {
+  int32_t intValue = static_cast<int32_t>(value);
+  if (value >= INT32_MIN && value <= INT32_MAX && intValue == value &&
+      !(intValue == 0 && std::signbit(value))) {
+    WriteTag(SerializationTag::kInt32);
+    WriteZigZag(intValue);
+  } else {
+    WriteTag(SerializationTag::kDouble);
+    WriteDouble(value);
+  }
+}
+
+Maybe<bool> ValueSerializer::PrivateData::WriteString(JsValueRef value) {
+  int length;
+  if (JsGetStringLength(value, &length) != JsNoError) {
+    return Nothing<bool>();
+  }
+
+  std::vector<uint16_t> chars(length);
+  size_t written = 0;
+  if (length > 0 &&
+      JsCopyStringUtf16(value, 0, length, chars.data(), &written) !=
+          JsNoError) {
+    return Nothing<bool>();
+  }
+  CHAKRA_ASSERT(written == static_cast<size_t>(length));
+
+  bool isOneByte = true;
+  for (int i = 0; i < length; i++) {
+    if (chars[i] > 0xFF) {
+      isOneByte = false;
+      break;
+    }
+  }
+
+  if (isOneByte) {
+    WriteTag(SerializationTag::kOneByteString);
+    WriteVarint<uint32_t>(length);
+    uint8_t* dest = ReserveRawBytes(length);
+    if (dest != nullptr) {
+      for (int i = 0; i < length; i++) {
+        dest[i] = static_cast<uint8_t>(chars[i]);
+      }
+    }
+  } else {
+    uint32_t byteLength = length * sizeof(uint16_t);
+
+    // The two-byte payload must start at an even offset so that it can be
+    // read in place; account for the tag and the varint length first.
+    size_t varintLength = 1;
+    for (uint32_t v = byteLength >> 7; v != 0; v >>= 7) {
+      varintLength++;
+    }
+    if ((bufferSize + 1 + varintLength) & 1) {
+      WriteTag(SerializationTag::kPadding);
+    }
+
+    WriteTag(SerializationTag::kTwoByteString);
+    WriteVarint(byteLength);
+    WriteRawBytes(chars.data(), byteLength);
+  }
+
+  return Just(true);
+}
+
+Maybe<bool> ValueSerializer::PrivateData::WriteReceiver(JsValueRef object,
+                                                        JsValueType type) {
+  auto entry = idMap.find(object);
+  if (entry != idMap.end()) {
+    WriteTag(SerializationTag::kObjectReference);
+    WriteVarint(entry->second);
+    return Just(true);
+  }
+
+  // Otherwise, allocate an id for it
+  if (KeepAlive(object) != JsNoError) {
+    return Nothing<bool>();
+  }
+  idMap.emplace(object, nextId++);
+
+  switch (type) {
+    case JsArray:
+      return WriteArray(object);
+    case JsArrayBuffer:
+      return WriteArrayBuffer(object);
+    case JsTypedArray:
+    case JsDataView:
+      if (treatArrayBufferViewsAsHostObjects) {
+        return WriteHostObject(object);
+      }
+      return WriteArrayBufferView(object, type);
+    case JsObject:
+      break;
+    default:
+      // Functions and errors
+      ThrowDataCloneError(object);
+      return Nothing<bool>();
+  }
+
+  // Proxies would answer the checks below through their traps
+  bool isProxy = false;
+  if (JsGetProxyProperties(object, &isProxy, nullptr, nullptr) != JsNoError) {
+    return Nothing<bool>();
+  }
+  if (isProxy) {
+    ThrowDataCloneError(object);
+    return Nothing<bool>();
+  }
+
+  if (static_cast<Object*>(object)->InternalFieldCount() > 0) {
+    return WriteHostObject(object);
+  }
+
+  // Fast path for object literals, by far the most common case
+  JsValueRef prototype;
+  if (JsGetPrototype(object, &prototype) != JsNoError) {
+    return Nothing<bool>();
+  }
+  if (objectPrototype == JS_INVALID_REFERENCE &&
+      jsrt::GetProperty(ContextShim::GetCurrent()->GetObjectConstructor(),
+                        CachedPropertyIdRef::prototype,
+                        &objectPrototype) != JsNoError) {
+    return Nothing<bool>();
+  }
+  if (prototype == objectPrototype) {
+    return WritePlainObject(object);
+  }
+
+  JsValueRef className;
+  JsValueRef args[] = { object };
+  if (JsCallFunction(ContextShim::GetCurrent()->GetToStringFunction(),
+                     args, _countof(args), &className) != JsNoError) {
+    return Nothing<bool>();
+  }
+
+  jsrt::StringUtf8 str;
+  if (str.From(className) != JsNoError) {
+    return Nothing<bool>();
+  }
+  return WriteTaggedObject(object, str);
+}
+
+Maybe<bool> ValueSerializer::PrivateData::WriteProperties(
+    JsValueRef object, JsValueRef keys, bool keysAreIndices,
+    uint32_t* written) {
+  unsigned int length;
+  if (jsrt::GetArrayLength(keys, &length) != JsNoError) {
+    return Nothing<bool>();
+  }
+
+  for (unsigned int i = 0; i < length; i++) {
+    JsValueRef key;
+    JsValueRef value;
+    if (jsrt::GetIndexedProperty(keys, i, &key) != JsNoError ||
+        JsObjectGetProperty(object, key, &value) != JsNoError) {
+      return Nothing<bool>();
+    }
+
+    if (keysAreIndices) {
+      // Index keys are written as numbers, like v8 does
+      double index;
+      if (JsConvertValueToNumber(key, &key) != JsNoError ||
+          JsNumberToDouble(key, &index) != JsNoError) {
+        return Nothing<bool>();
+      }
+      WriteNumber(index);
+    } else if (WriteString(key).IsNothing()) {
+      return Nothing<bool>();
+    }
+
+    if (WriteObject(value).IsNothing()) {
+      return Nothing<bool>();
+    }
+  }
+
+  *written += length;
+  return Just(true);
+}
+
+Maybe<bool> ValueSerializer::PrivateData::WritePlainObject(JsValueRef object) {
+  JsValueRef indexedKeys;
+  JsValueRef namedKeys;
+  if (jsrt::GetIndexedOwnKeys(object, &indexedKeys) != JsNoError ||
+      jsrt::GetNamedOwnKeys(object, &namedKeys) != JsNoError) {
+    return Nothing<bool>();
+  }
+
+  uint32_t propertiesWritten = 0;
+  WriteTag(SerializationTag::kBeginJSObject);
+  if (WriteProperties(object, indexedKeys, true,
+                      &propertiesWritten).IsNothing() ||
+      WriteProperties(object, namedKeys, false,
+                      &propertiesWritten).IsNothing()) {
+    return Nothing<bool>();
+  }
+  WriteTag(SerializationTag::kEndJSObject);
+  WriteVarint(propertiesWritten);
+  return Just(true);
+}
+
+Maybe<bool> ValueSerializer::PrivateData::WriteArray(JsValueRef array) {
+  unsigned int length;
+  JsValueRef indexedKeys;
+  JsValueRef namedKeys;
+  unsigned int indexedKeyCount;
+  if (jsrt::GetArrayLength(array, &length) != JsNoError ||
+      jsrt::GetIndexedOwnKeys(array, &indexedKeys) != JsNoError ||
+      jsrt::GetNamedOwnKeys(array, &namedKeys) != JsNoError ||
+      jsrt::GetArrayLength(indexedKeys, &indexedKeyCount) != JsNoError) {
+    return Nothing<bool>();
+  }
+
+  uint32_t propertiesWritten = 0;
+
+  // Arrays without holes are written densely, everything else as a list of
+  // properties.
+  if (indexedKeyCount == length) {
+    WriteTag(SerializationTag::kBeginDenseJSArray);
+    WriteVarint<uint32_t>(length);
+    for (unsigned int i = 0; i < length; i++) {
+      JsValueRef element;
+      if (jsrt::GetIndexedProperty(array, i, &element) != JsNoError ||
+          WriteObject(element).IsNothing()) {
+        return Nothing<bool>();
+      }
+    }
+
+    if (WriteProperties(array, namedKeys, false,
+                        &propertiesWritten).IsNothing()) {
+      return Nothing<bool>();
+    }
+    WriteTag(SerializationTag::kEndDenseJSArray);
+  } else {
+    WriteTag(SerializationTag::kBeginSparseJSArray);
+    WriteVarint<uint32_t>(length);
+    if (WriteProperties(array, indexedKeys, true,
+                        &propertiesWritten).IsNothing() ||
+        WriteProperties(array, namedKeys, false,
+                        &propertiesWritten).IsNothing()) {
+      return Nothing<bool>();
+    }
+    WriteTag(SerializationTag::kEndSparseJSArray);
+  }
+
+  WriteVarint(propertiesWritten);
+  WriteVarint<uint32_t>(length);
+  return Just(true);
+}
+
+Maybe<bool> ValueSerializer::PrivateData::WriteTaggedObject(
+    JsValueRef object, const char* className) {
+  Object* obj = static_cast<Object*>(object);
+
+  if (strcmp(className, "[object Date]") == 0) {
+    WriteTag(SerializationTag::kDate);
+    WriteDouble(static_cast<Date*>(obj)->ValueOf());
+  } else if (strcmp(className, "[object RegExp]") == 0) {
+    return WriteRegExp(object);
+  } else if (strcmp(className, "[object Map]") == 0) {
+    return WriteCollection(object, SerializationTag::kBeginJSMap,
+                           SerializationTag::kEndJSMap);
+  } else if (strcmp(className, "[object Set]") == 0) {
+    return WriteCollection(object, SerializationTag::kBeginJSSet,
+                           SerializationTag::kEndJSSet);
+  } else if (strcmp(className, "[object Boolean]") == 0) {
+    WriteTag(static_cast<BooleanObject*>(obj)->ValueOf() ?
+             SerializationTag::kTrueObject : SerializationTag::kFalseObject);
+  } else if (strcmp(className, "[object Number]") == 0) {
+    WriteTag(SerializationTag::kNumberObject);
+    WriteDouble(static_cast<NumberObject*>(obj)->ValueOf());
+  } else if (strcmp(className, "[object String]") == 0) {
+    Local<String> value = static_cast<StringObject*>(obj)->ValueOf();
+    if (value.IsEmpty()) {
+      return Nothing<bool>();
+    }
+    WriteTag(SerializationTag::kStringObject);
+    return WriteString(*value);
+  } else if (strcmp(className, "[object SharedArrayBuffer]") == 0) {
+    return WriteSharedArrayBuffer(object);
+  } else if (strcmp(className, "[object Object]") == 0 ||
+             strcmp(className, "[object Arguments]") == 0) {
+    return WritePlainObject(object);
+  } else {
+    // Promises, weak collections, iterators, generators, wrapped symbols...
+    ThrowDataCloneError(object);
+    return Nothing<bool>();
+  }
+
+  return Just(true);
+}
+
+Maybe<bool> ValueSerializer::PrivateData::WriteRegExp(JsValueRef regExp) {
+  JsValueRef source;
+  JsValueRef flagsValue;
+  if (jsrt::GetProperty(regExp, CachedPropertyIdRef::source,
+                        &source) != JsNoError ||
+      jsrt::GetProperty(regExp, CachedPropertyIdRef::flags,
+                        &flagsValue) != JsNoError) {
+    return Nothing<bool>();
+  }
+
+  jsrt::StringUtf8 flagsString;
+  if (flagsString.From(flagsValue) != JsNoError) {
+    return Nothing<bool>();
+  }
+
+  uint32_t flags = 0;
+  for (const char* flag = flagsString; *flag != '\0'; flag++) {
+    switch (*flag) {
+      case 'g': flags |= jsrt::kRegExpGlobal; break;
+      case 'i': flags |= jsrt::kRegExpIgnoreCase; break;
+      case 'm': flags |= jsrt::kRegExpMultiline; break;
+      case 'y': flags |= jsrt::kRegExpSticky; break;
+      case 'u': flags |= jsrt::kRegExpUnicode; break;
+      case 's': flags |= jsrt::kRegExpDotAll; break;
+    }
+  }
+
+  WriteTag(SerializationTag::kRegExp);
+  if (WriteString(source).IsNothing()) {
+    return Nothing<bool>();
+  }
+  WriteVarint(flags);
+  return Just(true);
+}
+
+Maybe<bool> ValueSerializer::PrivateData::WriteCollection(
+    JsValueRef collection, SerializationTag beginTag,
+    SerializationTag endTag) {
+  // Snapshot the entries first; writing them may run user code that changes
+  // the collection.
+  Local<Array> entries = beginTag == SerializationTag::kBeginJSMap ?
+      static_cast<Map*>(collection)->AsArray() :
+      static_cast<Set*>(collection)->AsArray();
+  if (entries.IsEmpty()) {
+    return Nothing<bool>();
+  }
+
+  unsigned int length;
+  if (jsrt::GetArrayLength(*entries, &length) != JsNoError) {
+    return Nothing<bool>();
+  }
+
+  WriteTag(beginTag);
+  for (unsigned int i = 0; i < length; i++) {
+    JsValueRef entry;
+    if (jsrt::GetIndexedProperty(*entries, i, &entry) != JsNoError ||
+        WriteObject(entry).IsNothing()) {
+      return Nothing<bool>();
+    }
+  }
+  WriteTag(endTag);
+  WriteVarint<uint32_t>(length);
+  return Just(true);
+}
+
+Maybe<bool> ValueSerializer::PrivateData::WriteArrayBuffer(
+    JsValueRef arrayBuffer) {
+  auto transfer = arrayBufferTransferMap.find(arrayBuffer);
+  if (transfer != arrayBufferTransferMap.end()) {
+    WriteTag(SerializationTag::kArrayBufferTransfer);
+    WriteVarint(transfer->second);
+    return Just(true);
+  }
+
+  BYTE* data;
+  unsigned int length;
+  if (JsGetArrayBufferStorage(arrayBuffer, &data, &length) != JsNoError) {
+    return Nothing<bool>();
+  }
+
+  WriteTag(SerializationTag::kArrayBuffer);
+  WriteVarint(length);
+  WriteRawBytes(data, length);
+  return Just(true);
+}
+
+Maybe<bool> ValueSerializer::PrivateData::WriteSharedArrayBuffer(
+    JsValueRef sharedArrayBuffer) {
+  if (delegate == nullptr) {
+    ThrowDataCloneError(sharedArrayBuffer);
+    return Nothing<bool>();
+  }
+
+  uint32_t id;
+  if (!delegate->GetSharedArrayBufferId(
+          isolate,
+          Local<SharedArrayBuffer>::New(sharedArrayBuffer)).To(&id)) {
+    return Nothing<bool>();
+  }
+
+  WriteTag(SerializationTag::kSharedArrayBuffer);
+  WriteVarint(id);
+  return Just(true);
+}
+
+Maybe<bool> ValueSerializer::PrivateData::WriteArrayBufferView(
+    JsValueRef view, JsValueType type) {
+  ArrayBufferViewTag tag = ArrayBufferViewTag::kDataView;
+  unsigned int byteOffset;
+  unsigned int byteLength;
+
+  if (type == JsTypedArray) {
+    JsTypedArrayType arrayType;
+    if (JsGetTypedArrayInfo(view, &arrayType, nullptr, &byteOffset,
+                            &byteLength) != JsNoError) {
+      return Nothing<bool>();
+    }
+
+    switch (arrayType) {
+#define TYPED_ARRAY_TAG(Type) \
+      case JsArrayType##Type: tag = ArrayBufferViewTag::k##Type##Array; break;
+      TYPED_ARRAY_TAG(Int8)
+      TYPED_ARRAY_TAG(Uint8)
+      TYPED_ARRAY_TAG(Uint8Clamped)
+      TYPED_ARRAY_TAG(Int16)
+      TYPED_ARRAY_TAG(Uint16)
+      TYPED_ARRAY_TAG(Int32)
+      TYPED_ARRAY_TAG(Uint32)
+      TYPED_ARRAY_TAG(Float32)
+      TYPED_ARRAY_TAG(Float64)
+#undef TYPED_ARRAY_TAG
+      default:
+        ThrowDataCloneError(view);
+        return Nothing<bool>();
+    }
+  } else if (JsGetDataViewInfo(view, nullptr, &byteOffset,
+                               &byteLength) != JsNoError) {
+    return Nothing<bool>();
+  }
+
+  WriteTag(SerializationTag::kArrayBufferView);
+  WriteRawBytes(&tag, sizeof(tag));
+  WriteVarint(byteOffset);
+  WriteVarint(byteLength);
+  return Just(true);
+}
+
+Maybe<bool> ValueSerializer::PrivateData::WriteHostObject(JsValueRef object) {
+  WriteTag(SerializationTag::kHostObject);
+  if (delegate == nullptr) {
+    ThrowDataCloneError(object);
+    return Nothing<bool>();
+  }
+
+  return delegate->WriteHostObject(isolate, Local<Object>::New(object));
+}
+
 Maybe<bool> ValueSerializer::Delegate::WriteHostObject(Isolate* isolate,
                                                        Local<Object> object) {
-  CHAKRA_UNIMPLEMENTED();
+  isolate->ThrowException(Exception::Error(
+      String::NewFromUtf8(isolate, "Host object could not be cloned.",
+                          NewStringType::kNormal).ToLocalChecked()));
   return Nothing<bool>();
 }
 
 Maybe<uint32_t> ValueSerializer::Delegate::GetSharedArrayBufferId(
     Isolate* isolate, Local<SharedArrayBuffer> shared_array_buffer) {
-  CHAKRA_UNIMPLEMENTED();
-  return Nothing<unsigned int>();
+  isolate->ThrowException(Exception::Error(
+      String::NewFromUtf8(isolate,
+                          "SharedArrayBuffer could not be cloned.",
+                          NewStringType::kNormal).ToLocalChecked()));
+  return Nothing<uint32_t>();
 }
 
 void* ValueSerializer::Delegate::ReallocateBufferMemory(void* old_buffer,
                                                         size_t size,
                                                         size_t* actual_size) {
-  CHAKRA_UNIMPLEMENTED();
-  return nullptr;
+  *actual_size = size;
+  return realloc(old_buffer, size);
 }
 
 void ValueSerializer::Delegate::FreeBufferMemory(void* buffer) {
-  CHAKRA_UNIMPLEMENTED();
+  free(buffer);
 }
 
-ValueSerializer::ValueSerializer(Isolate* isolate) {
-  CHAKRA_UNIMPLEMENTED();
+ValueSerializer::ValueSerializer(Isolate* isolate)
+    : ValueSerializer(isolate, nullptr) {
 }
 
-ValueSerializer::ValueSerializer(Isolate* isolate, Delegate* delegate) {
-  CHAKRA_UNIMPLEMENTED();
+ValueSerializer::ValueSerializer(Isolate* isolate, Delegate* delegate)
+    : private_(new PrivateData(isolate, delegate)) {
 }
 
 ValueSerializer::~ValueSerializer() {
-  // Intentionally left empty to suppress warning C4722.
+  delete private_;
 }
 
 void ValueSerializer::WriteHeader() {
-  CHAKRA_UNIMPLEMENTED();
+  private_->WriteTag(SerializationTag::kVersion);
+  private_->WriteVarint(jsrt::kSerializerLatestVersion);
 }
 
 Maybe<bool> ValueSerializer::WriteValue(Local<Context> context,
                                         Local<Value> value) {
-  CHAKRA_UNIMPLEMENTED();
-  return Nothing<bool>();
+  Maybe<bool> result = private_->WriteObject(*value);
+  if (private_->outOfMemory) {
+    private_->outOfMemory = false;
+    private_->isolate->ThrowException(Exception::RangeError(
+        String::NewFromUtf8(private_->isolate,
+                            "Out of memory while serializing",
+                            NewStringType::kNormal).ToLocalChecked()));
+    return Nothing<bool>();
+  }
+  return result;
 }
 
 std::pair<uint8_t*, size_t> ValueSerializer::Release() {
-  CHAKRA_UNIMPLEMENTED();
-  return std::pair<uint8_t*, size_t>();
+  std::pair<uint8_t*, size_t> result(private_->buffer, private_->bufferSize);
+  private_->buffer = nullptr;
+  private_->bufferSize = 0;
+  private_->bufferCapacity = 0;
+  return result;
 }
 
 void ValueSerializer::TransferArrayBuffer(uint32_t transfer_id,
                                           Local<ArrayBuffer> array_buffer) {
-  CHAKRA_UNIMPLEMENTED();
+  JsValueRef arrayBuffer = *array_buffer;
+  CHAKRA_ASSERT(private_->arrayBufferTransferMap.find(arrayBuffer) ==
+                private_->arrayBufferTransferMap.end());
+  if (private_->KeepAlive(arrayBuffer) != JsNoError) {
+    return;
+  }
+  private_->arrayBufferTransferMap.emplace(arrayBuffer, transfer_id);
 }
 
 void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
-  CHAKRA_UNIMPLEMENTED();
+  private_->treatArrayBufferViewsAsHostObjects = mode;
 }
 
 void ValueSerializer::WriteUint32(uint32_t value) {
-  CHAKRA_UNIMPLEMENTED();
+  private_->WriteVarint(value);
 }
 
 void ValueSerializer::WriteUint64(uint64_t value) {
-  CHAKRA_UNIMPLEMENTED();
+  private_->WriteVarint(value);
 }
 
 void ValueSerializer::WriteDouble(double value) {
-  CHAKRA_UNIMPLEMENTED();
+  private_->WriteDouble(value);
 }
 
 void ValueSerializer::WriteRawBytes(const void* source, size_t length) {
-  CHAKRA_UNIMPLEMENTED();
+  private_->WriteRawBytes(source, length);
 }
 
 }  // namespace v8
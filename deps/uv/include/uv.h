@@ -543,7 +543,12 @@ UV_EXTERN int uv_tcp_simultaneous_accepts(uv_tcp_t* handle, int enable);
 
 enum uv_tcp_flags {
   /* Used with uv_tcp_bind, when an IPv6 address is used. */
-  UV_TCP_IPV6ONLY = 1
+  UV_TCP_IPV6ONLY = 1,
+  /*
+   * Used with uv_tcp_bind. Lets several sockets bind the same address and
+   * port, with the kernel spreading incoming connections across them.
+   */
+  UV_TCP_REUSEPORT = 2
 };
 
 UV_EXTERN int uv_tcp_bind(uv_tcp_t* handle,
@@ -589,7 +594,23 @@ enum uv_udp_flags {
    * (provided they all set the flag) but only the last one to bind will receive
    * any traffic, in effect "stealing" the port from the previous listener.
    */
-  UV_UDP_REUSEADDR = 4
+  UV_UDP_REUSEADDR = 4,
+  /*
+   * Indicates that the message was received by recvmmsg, so the buffer provided
+   * must not be freed by the recv_cb callback.
+   */
+  UV_UDP_MMSG_CHUNK = 8,
+  /*
+   * Indicates that the buffer provided has been fully utilized by recvmmsg and
+   * that it should now be freed by the recv_cb callback. When this flag is set
+   * in uv_udp_recv_cb, nread will always be 0 and addr will always be NULL.
+   */
+  UV_UDP_MMSG_FREE = 16,
+  /*
+   * Indicates that recvmmsg should be used, if available. Used in
+   * uv_udp_init_ex.
+   */
+  UV_UDP_RECVMMSG = 256
 };
 
 typedef void (*uv_udp_send_cb)(uv_udp_send_t* req, int status);
@@ -657,6 +678,9 @@ UV_EXTERN int uv_udp_recv_start(uv_udp_t* handle,
                                 uv_alloc_cb alloc_cb,
                                 uv_udp_recv_cb recv_cb);
 UV_EXTERN int uv_udp_recv_stop(uv_udp_t* handle);
+UV_EXTERN int uv_udp_using_recvmmsg(const uv_udp_t* handle);
+UV_EXTERN int uv_udp_cork(uv_udp_t* handle);
+UV_EXTERN int uv_udp_uncork(uv_udp_t* handle);
 UV_EXTERN size_t uv_udp_get_send_queue_size(const uv_udp_t* handle);
 UV_EXTERN size_t uv_udp_get_send_queue_count(const uv_udp_t* handle);
 
@@ -1015,6 +1039,28 @@ UV_EXTERN int uv_queue_work(uv_loop_t* loop,
                             uv_work_cb work_cb,
                             uv_after_work_cb after_work_cb);
 
+typedef enum {
+  UV_THREADPOOL_CPU,  /* uv_queue_work() */
+  UV_THREADPOOL_FS,
+  UV_THREADPOOL_DNS   /* uv_getaddrinfo() and uv_getnameinfo() */
+} uv_threadpool_queue_t;
+
+typedef struct {
+  unsigned int threads;
+  unsigned int idle_threads;
+  unsigned int size;
+  unsigned int running;
+  unsigned int pending;
+  uint64_t completed;
+  uint64_t wait_time;       /* Total nanoseconds spent waiting for a thread. */
+  uint64_t max_wait_time;
+  uint64_t run_time;        /* Total nanoseconds spent running work. */
+  uint64_t max_run_time;
+} uv_threadpool_stats_t;
+
+UV_EXTERN int uv_threadpool_get_stats(uv_threadpool_queue_t queue,
+                                      uv_threadpool_stats_t* stats);
+
 UV_EXTERN int uv_cancel(uv_req_t* req);
 
 
@@ -1584,9 +1630,11 @@ struct uv_loop_s {
   unsigned int active_handles;
   void* handle_queue[2];
   union {
-    void* unused[2];
+    void* unused;
     unsigned int count;
   } active_reqs;
+  /* Internal storage for future extensions. */
+  void* internal_fields;
   /* Internal flag to signal loop stop. */
   unsigned int stop_flag;
   UV_LOOP_PRIVATE_FIELDS
@@ -29,38 +29,168 @@
 
 #define MAX_THREADPOOL_SIZE 128
 
+/* The time a request was submitted at. struct uv__work is part of the public
+ * request types, so this is kept on the side, in submission order.
+ */
+struct uv__work_stamp {
+  struct uv__work* w;
+  uint64_t queued_at;
+};
+
+struct uv__work_stamps {
+  struct uv__work_stamp* items;
+  unsigned int head;
+  unsigned int len;
+  unsigned int cap;
+};
+
+/* By default all work shares the CPU queue and its UV_THREADPOOL_SIZE
+ * threads, and slow I/O (getaddrinfo and getnameinfo) may only use half of
+ * them. A file system or DNS queue given a size of its own gets threads of
+ * its own, so that slow DNS lookups or long CPU jobs do not hold up file
+ * system requests. Threads are started when work is queued and no thread is
+ * idle, up to the size of the queue. With UV_THREADPOOL_AUTOSCALE set to a
+ * number of milliseconds, a queue whose work waited longer than that for a
+ * thread may grow past its size, up to MAX_THREADPOOL_SIZE. Threads are never
+ * stopped.
+ */
+struct uv__threadpool_queue {
+  QUEUE wq;
+  QUEUE exit_message;
+  QUEUE run_slow_work_message;
+  QUEUE slow_io_pending_wq;
+  uv_cond_t cond;
+  unsigned int idle_threads;
+  unsigned int slow_io_work_running;
+  unsigned int running;
+  unsigned int nthreads;
+  unsigned int size;
+  uint64_t completed;
+  uint64_t wait_time;
+  uint64_t max_wait_time;
+  uint64_t run_time;
+  uint64_t max_run_time;
+  struct uv__work_stamps stamps;
+  struct uv__work_stamps slow_io_stamps;
+  uv_thread_t threads[MAX_THREADPOOL_SIZE];
+};
+
 static uv_once_t once = UV_ONCE_INIT;
-static uv_cond_t cond;
 static uv_mutex_t mutex;
-static unsigned int idle_threads;
-static unsigned int slow_io_work_running;
-static unsigned int nthreads;
-static uv_thread_t* threads;
-static uv_thread_t default_threads[4];
-static QUEUE exit_message;
-static QUEUE wq;
-static QUEUE run_slow_work_message;
-static QUEUE slow_io_pending_wq;
-
-static unsigned int slow_work_thread_threshold(void) {
-  return (nthreads + 1) / 2;
+static uint64_t autoscale_threshold;  /* Nanoseconds, 0 if off. */
+static struct uv__threadpool_queue queues[3];
+/* Maps a uv__work_kind to its queue; kinds with a size of 0 share the CPU
+ * queue.
+ */
+static struct uv__threadpool_queue* kind_queues[ARRAY_SIZE(queues)];
+
+static unsigned int slow_work_thread_threshold(struct uv__threadpool_queue* tq) {
+  return (tq->size + 1) / 2;
 }
 
+
+/* `mutex` must be held. The request goes without a stamp if memory runs
+ * out; it then simply isn't counted in the wait statistics.
+ */
+static void stamps_push(struct uv__work_stamps* s,
+                        struct uv__work* w,
+                        uint64_t queued_at) {
+  struct uv__work_stamp* items;
+  unsigned int cap;
+  unsigned int i;
+
+  if (s->len == s->cap) {
+    cap = s->cap == 0 ? 16 : s->cap * 2;
+    items = uv__malloc(cap * sizeof(*items));
+    if (items == NULL)
+      return;
+
+    for (i = 0; i < s->len; i++)
+      items[i] = s->items[(s->head + i) % s->cap];
+
+    uv__free(s->items);
+    s->items = items;
+    s->head = 0;
+    s->cap = cap;
+  }
+
+  s->items[(s->head + s->len) % s->cap].w = w;
+  s->items[(s->head + s->len) % s->cap].queued_at = queued_at;
+  s->len++;
+}
+
+
+/* `mutex` must be held. `w` is the oldest request of the queue, so its stamp,
+ * if it has one, is the oldest too.
+ */
+static int stamps_pop(struct uv__work_stamps* s,
+                      struct uv__work* w,
+                      uint64_t* queued_at) {
+  if (s->len == 0 || s->items[s->head].w != w)
+    return 0;
+
+  *queued_at = s->items[s->head].queued_at;
+  s->head = (s->head + 1) % s->cap;
+  s->len--;
+  return 1;
+}
+
+
+/* `mutex` must be held. For cancelled requests, which leave the queue out of
+ * order.
+ */
+static void stamps_remove(struct uv__work_stamps* s, struct uv__work* w) {
+  unsigned int i;
+
+  for (i = 0; i < s->len; i++)
+    if (s->items[(s->head + i) % s->cap].w == w)
+      break;
+
+  if (i == s->len)
+    return;
+
+  for (; i + 1 < s->len; i++)
+    s->items[(s->head + i) % s->cap] = s->items[(s->head + i + 1) % s->cap];
+
+  s->len--;
+}
+
+
 static void uv__cancelled(struct uv__work* w) {
   abort();
 }
 
 
+static void worker(void* arg);
+
+
+/* `mutex` must be held. */
+static void start_thread(struct uv__threadpool_queue* tq) {
+  if (tq->nthreads == ARRAY_SIZE(tq->threads))
+    return;
+
+  if (uv_thread_create(tq->threads + tq->nthreads, worker, tq) == 0)
+    tq->nthreads++;
+  else if (tq->nthreads == 0)
+    abort();  /* Nothing would ever run the work. */
+}
+
+
 /* To avoid deadlock with uv_cancel() it's crucial that the worker
  * never holds the global mutex and the loop-local mutex at the same time.
  */
 static void worker(void* arg) {
+  struct uv__threadpool_queue* tq;
+  struct uv__work_stamps* stamps;
   struct uv__work* w;
-  QUEUE* q;
+  uint64_t queued_at;
+  uint64_t wait_time;
+  uint64_t run_time;
+  uint64_t start;
   int is_slow_work;
+  QUEUE* q;
 
-  uv_sem_post((uv_sem_t*) arg);
-  arg = NULL;
+  tq = arg;
 
   uv_mutex_lock(&mutex);
   for (;;) {
@@ -68,18 +198,18 @@ static void worker(void* arg) {
 
     /* Keep waiting while either no work is present or only slow I/O
        and we're at the threshold for that. */
-    while (QUEUE_EMPTY(&wq) ||
-           (QUEUE_HEAD(&wq) == &run_slow_work_message &&
-            QUEUE_NEXT(&run_slow_work_message) == &wq &&
-            slow_io_work_running >= slow_work_thread_threshold())) {
-      idle_threads += 1;
-      uv_cond_wait(&cond, &mutex);
-      idle_threads -= 1;
+    while (QUEUE_EMPTY(&tq->wq) ||
+           (QUEUE_HEAD(&tq->wq) == &tq->run_slow_work_message &&
+            QUEUE_NEXT(&tq->run_slow_work_message) == &tq->wq &&
+            tq->slow_io_work_running >= slow_work_thread_threshold(tq))) {
+      tq->idle_threads += 1;
+      uv_cond_wait(&tq->cond, &mutex);
+      tq->idle_threads -= 1;
     }
 
-    q = QUEUE_HEAD(&wq);
-    if (q == &exit_message) {
-      uv_cond_signal(&cond);
+    q = QUEUE_HEAD(&tq->wq);
+    if (q == &tq->exit_message) {
+      uv_cond_signal(&tq->cond);
       uv_mutex_unlock(&mutex);
       break;
     }
@@ -88,38 +218,58 @@ static void worker(void* arg) {
     QUEUE_INIT(q);  /* Signal uv_cancel() that the work req is executing. */
 
     is_slow_work = 0;
-    if (q == &run_slow_work_message) {
+    stamps = &tq->stamps;
+    if (q == &tq->run_slow_work_message) {
       /* If we're at the slow I/O threshold, re-schedule until after all
          other work in the queue is done. */
-      if (slow_io_work_running >= slow_work_thread_threshold()) {
-        QUEUE_INSERT_TAIL(&wq, q);
+      if (tq->slow_io_work_running >= slow_work_thread_threshold(tq)) {
+        QUEUE_INSERT_TAIL(&tq->wq, q);
         continue;
       }
 
       /* If we encountered a request to run slow I/O work but there is none
          to run, that means it's cancelled => Start over. */
-      if (QUEUE_EMPTY(&slow_io_pending_wq))
+      if (QUEUE_EMPTY(&tq->slow_io_pending_wq))
         continue;
 
       is_slow_work = 1;
-      slow_io_work_running++;
+      tq->slow_io_work_running++;
 
-      q = QUEUE_HEAD(&slow_io_pending_wq);
+      q = QUEUE_HEAD(&tq->slow_io_pending_wq);
       QUEUE_REMOVE(q);
       QUEUE_INIT(q);
+      stamps = &tq->slow_io_stamps;
 
       /* If there is more slow I/O work, schedule it to be run as well. */
-      if (!QUEUE_EMPTY(&slow_io_pending_wq)) {
-        QUEUE_INSERT_TAIL(&wq, &run_slow_work_message);
-        if (idle_threads > 0)
-          uv_cond_signal(&cond);
+      if (!QUEUE_EMPTY(&tq->slow_io_pending_wq)) {
+        QUEUE_INSERT_TAIL(&tq->wq, &tq->run_slow_work_message);
+        if (tq->idle_threads > 0)
+          uv_cond_signal(&tq->cond);
+      }
+    }
+
+    w = QUEUE_DATA(q, struct uv__work, wq);
+    if (stamps_pop(stamps, w, &queued_at)) {
+      wait_time = uv_hrtime() - queued_at;
+      tq->wait_time += wait_time;
+      if (wait_time > tq->max_wait_time)
+        tq->max_wait_time = wait_time;
+
+      /* Every thread is busy and work is piling up, add one. */
+      if (autoscale_threshold != 0 &&
+          wait_time > autoscale_threshold &&
+          tq->idle_threads == 0 &&
+          !QUEUE_EMPTY(&tq->wq)) {
+        start_thread(tq);
       }
     }
+    tq->running++;
 
     uv_mutex_unlock(&mutex);
 
-    w = QUEUE_DATA(q, struct uv__work, wq);
+    start = uv_hrtime();
     w->work(w);
+    run_time = uv_hrtime() - start;
 
     uv_mutex_lock(&w->loop->wq_mutex);
     w->work = NULL;  /* Signal uv_cancel() that the work req is done
@@ -133,102 +283,136 @@ static void worker(void* arg) {
     uv_mutex_lock(&mutex);
     if (is_slow_work) {
       /* `slow_io_work_running` is protected by `mutex`. */
-      slow_io_work_running--;
+      tq->slow_io_work_running--;
     }
+    tq->running--;
+    tq->completed++;
+    tq->run_time += run_time;
+    if (run_time > tq->max_run_time)
+      tq->max_run_time = run_time;
   }
 }
 
 
 static void post(QUEUE* q, enum uv__work_kind kind) {
+  struct uv__threadpool_queue* tq;
+  struct uv__work* w;
+  uint64_t queued_at;
+
+  tq = kind_queues[kind];
+  w = QUEUE_DATA(q, struct uv__work, wq);
+  queued_at = uv_hrtime();
+
   uv_mutex_lock(&mutex);
-  if (kind == UV__WORK_SLOW_IO) {
+  if (kind == UV__WORK_SLOW_IO && tq != queues + UV__WORK_SLOW_IO) {
     /* Insert into a separate queue. */
-    QUEUE_INSERT_TAIL(&slow_io_pending_wq, q);
-    if (!QUEUE_EMPTY(&run_slow_work_message)) {
+    QUEUE_INSERT_TAIL(&tq->slow_io_pending_wq, q);
+    stamps_push(&tq->slow_io_stamps, w, queued_at);
+    if (!QUEUE_EMPTY(&tq->run_slow_work_message)) {
       /* Running slow I/O tasks is already scheduled => Nothing to do here.
          The worker that runs said other task will schedule this one as well. */
       uv_mutex_unlock(&mutex);
       return;
     }
-    q = &run_slow_work_message;
+    q = &tq->run_slow_work_message;
+  } else {
+    stamps_push(&tq->stamps, w, queued_at);
   }
 
-  QUEUE_INSERT_TAIL(&wq, q);
-  if (idle_threads > 0)
-    uv_cond_signal(&cond);
+  QUEUE_INSERT_TAIL(&tq->wq, q);
+  if (tq->idle_threads > 0)
+    uv_cond_signal(&tq->cond);
+  else if (tq->nthreads < tq->size)
+    start_thread(tq);
   uv_mutex_unlock(&mutex);
 }
 
 
 #ifndef _WIN32
 UV_DESTRUCTOR(static void cleanup(void)) {
+  struct uv__threadpool_queue* tq;
+  unsigned int started;
   unsigned int i;
 
-  if (nthreads == 0)
+  started = 0;
+  for (tq = queues; tq < queues + ARRAY_SIZE(queues); tq++)
+    started += tq->nthreads;
+
+  if (started == 0)
     return;
 
-  post(&exit_message, UV__WORK_CPU);
+  uv_mutex_lock(&mutex);
+  for (tq = queues; tq < queues + ARRAY_SIZE(queues); tq++) {
+    QUEUE_INSERT_TAIL(&tq->wq, &tq->exit_message);
+    uv_cond_signal(&tq->cond);
+  }
+  uv_mutex_unlock(&mutex);
 
-  for (i = 0; i < nthreads; i++)
-    if (uv_thread_join(threads + i))
-      abort();
+  for (tq = queues; tq < queues + ARRAY_SIZE(queues); tq++) {
+    for (i = 0; i < tq->nthreads; i++)
+      if (uv_thread_join(tq->threads + i))
+        abort();
 
-  if (threads != default_threads)
-    uv__free(threads);
+    uv_cond_destroy(&tq->cond);
+    uv__free(tq->stamps.items);
+    uv__free(tq->slow_io_stamps.items);
+    tq->nthreads = 0;
+  }
 
   uv_mutex_destroy(&mutex);
-  uv_cond_destroy(&cond);
-
-  threads = NULL;
-  nthreads = 0;
 }
 #endif
 
 
-static void init_threads(void) {
-  unsigned int i;
+static unsigned int queue_size(const char* name, unsigned int size) {
   const char* val;
-  uv_sem_t sem;
 
-  nthreads = ARRAY_SIZE(default_threads);
-  val = getenv("UV_THREADPOOL_SIZE");
+  val = getenv(name);
   if (val != NULL)
-    nthreads = atoi(val);
-  if (nthreads == 0)
-    nthreads = 1;
-  if (nthreads > MAX_THREADPOOL_SIZE)
-    nthreads = MAX_THREADPOOL_SIZE;
-
-  threads = default_threads;
-  if (nthreads > ARRAY_SIZE(default_threads)) {
-    threads = uv__malloc(nthreads * sizeof(threads[0]));
-    if (threads == NULL) {
-      nthreads = ARRAY_SIZE(default_threads);
-      threads = default_threads;
-    }
-  }
-
-  if (uv_cond_init(&cond))
-    abort();
-
-  if (uv_mutex_init(&mutex))
-    abort();
+    size = atoi(val);
+  if (size > MAX_THREADPOOL_SIZE)
+    size = MAX_THREADPOOL_SIZE;
 
-  QUEUE_INIT(&wq);
-  QUEUE_INIT(&slow_io_pending_wq);
-  QUEUE_INIT(&run_slow_work_message);
+  return size;
+}
 
-  if (uv_sem_init(&sem, 0))
-    abort();
 
-  for (i = 0; i < nthreads; i++)
-    if (uv_thread_create(threads + i, worker, &sem))
+static void init_threads(void) {
+  struct uv__threadpool_queue* tq;
+  unsigned int size;
+  const char* val;
+  size_t i;
+
+  size = queue_size("UV_THREADPOOL_SIZE", 4);
+  if (size == 0)
+    size = 1;
+
+  memset(queues, 0, sizeof(queues));
+  queues[UV__WORK_CPU].size = queue_size("UV_THREADPOOL_CPU_SIZE", size);
+  queues[UV__WORK_FAST_IO].size = queue_size("UV_THREADPOOL_FS_SIZE", 0);
+  queues[UV__WORK_SLOW_IO].size = queue_size("UV_THREADPOOL_DNS_SIZE", 0);
+  if (queues[UV__WORK_CPU].size == 0)
+    queues[UV__WORK_CPU].size = 1;
+
+  for (i = 0; i < ARRAY_SIZE(queues); i++) {
+    tq = queues + i;
+    kind_queues[i] = tq->size == 0 ? queues + UV__WORK_CPU : tq;
+
+    QUEUE_INIT(&tq->wq);
+    QUEUE_INIT(&tq->exit_message);
+    QUEUE_INIT(&tq->run_slow_work_message);
+    QUEUE_INIT(&tq->slow_io_pending_wq);
+    if (uv_cond_init(&tq->cond))
       abort();
+  }
 
-  for (i = 0; i < nthreads; i++)
-    uv_sem_wait(&sem);
+  autoscale_threshold = 0;
+  val = getenv("UV_THREADPOOL_AUTOSCALE");
+  if (val != NULL && atoi(val) > 0)
+    autoscale_threshold = (uint64_t) atoi(val) * 1000000;
 
-  uv_sem_destroy(&sem);
+  if (uv_mutex_init(&mutex))
+    abort();
 }
 
 
@@ -243,8 +427,8 @@ static void reset_once(void) {
 static void init_once(void) {
 #ifndef _WIN32
   /* Re-initialize the threadpool after fork.
-   * Note that this discards the global mutex and condition as well
-   * as the work queue.
+   * Note that this discards the global mutex and condition variables as
+   * well as the work queues.
    */
   if (pthread_atfork(NULL, NULL, &reset_once))
     abort();
@@ -266,15 +450,68 @@ void uv__work_submit(uv_loop_t* loop,
 }
 
 
+int uv_threadpool_get_stats(uv_threadpool_queue_t queue,
+                            uv_threadpool_stats_t* stats) {
+  struct uv__threadpool_queue* tq;
+  QUEUE* q;
+
+  if (stats == NULL)
+    return UV_EINVAL;
+
+  uv_once(&once, init_once);
+
+  switch (queue) {
+  case UV_THREADPOOL_CPU:
+    tq = kind_queues[UV__WORK_CPU];
+    break;
+  case UV_THREADPOOL_FS:
+    tq = kind_queues[UV__WORK_FAST_IO];
+    break;
+  case UV_THREADPOOL_DNS:
+    tq = kind_queues[UV__WORK_SLOW_IO];
+    break;
+  default:
+    return UV_EINVAL;
+  }
+
+  uv_mutex_lock(&mutex);
+
+  stats->threads = tq->nthreads;
+  stats->idle_threads = tq->idle_threads;
+  stats->size = tq->size;
+  stats->running = tq->running;
+  stats->pending = 0;
+  QUEUE_FOREACH(q, &tq->wq)
+    if (q != &tq->run_slow_work_message)
+      stats->pending++;
+  QUEUE_FOREACH(q, &tq->slow_io_pending_wq)
+    stats->pending++;
+  stats->completed = tq->completed;
+  stats->wait_time = tq->wait_time;
+  stats->max_wait_time = tq->max_wait_time;
+  stats->run_time = tq->run_time;
+  stats->max_run_time = tq->max_run_time;
+
+  uv_mutex_unlock(&mutex);
+  return 0;
+}
+
+
 static int uv__work_cancel(uv_loop_t* loop, uv_req_t* req, struct uv__work* w) {
+  struct uv__threadpool_queue* tq;
   int cancelled;
 
   uv_mutex_lock(&mutex);
   uv_mutex_lock(&w->loop->wq_mutex);
 
   cancelled = !QUEUE_EMPTY(&w->wq) && w->work != NULL;
-  if (cancelled)
+  if (cancelled) {
     QUEUE_REMOVE(&w->wq);
+    for (tq = queues; tq < queues + ARRAY_SIZE(queues); tq++) {
+      stamps_remove(&tq->stamps, w);
+      stamps_remove(&tq->slow_io_stamps, w);
+    }
+  }
 
   uv_mutex_unlock(&w->loop->wq_mutex);
   uv_mutex_unlock(&mutex);
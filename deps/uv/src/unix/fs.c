@@ -119,10 +119,18 @@
   }                                                                           \
   while (0)
 
+#if defined(__linux__)
+# define UV__FS_IOU_SUBMIT(loop, req) uv__iou_fs_submit((loop), (req))
+#else
+# define UV__FS_IOU_SUBMIT(loop, req) 0
+#endif
+
 #define POST                                                                  \
   do {                                                                        \
     if (cb != NULL) {                                                         \
       uv__req_register(loop, req);                                            \
+      if (UV__FS_IOU_SUBMIT(loop, req))                                       \
+        return 0;                                                             \
       uv__work_submit(loop,                                                   \
                       &req->work_req,                                         \
                       UV__WORK_FAST_IO,                                       \
@@ -322,6 +322,9 @@ UV_UNUSED(static char* uv__basename_r(const char* path)) {
 
 #if defined(__linux__)
 int uv__inotify_fork(uv_loop_t* loop, void* old_watchers);
+int uv__iou_fs_submit(uv_loop_t* loop, uv_fs_t* req);
+void uv__iou_flush(uv_loop_t* loop);
+void uv__iou_delete(uv_loop_t* loop);
 #endif
 
 #endif /* UV_UNIX_INTERNAL_H_ */
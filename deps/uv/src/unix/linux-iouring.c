@@ -0,0 +1,534 @@
+/* Copyright libuv project contributors. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/* File system requests through io_uring. Asynchronous uv_fs_read(),
+ * uv_fs_write(), uv_fs_open(), uv_fs_close(), uv_fs_stat() and friends and
+ * uv_fs_fsync() and uv_fs_fdatasync() are queued on a ring owned by the loop
+ * instead of the thread pool. The queued requests are submitted together
+ * with a single system call before the loop polls for I/O, and their
+ * completions are reaped when the ring's file descriptor becomes readable.
+ *
+ * The ring is created when the loop makes its first file system request.
+ * Requests that the ring cannot take, because the kernel is too old, the
+ * ring is full or the request is one that io_uring does not handle, go to
+ * the thread pool as before. Setting UV_USE_IO_URING=0 in the environment
+ * turns the ring off.
+ */
+
+#include "uv.h"
+#include "internal.h"
+#include "linux-syscalls.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sys/mman.h>
+#include <sys/sysmacros.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#define UV__IOU_ENTRIES 64
+
+struct uv__iou {
+  uint32_t* sqhead;
+  uint32_t* sqtail;
+  uint32_t* sqarray;
+  uint32_t sqmask;
+  uint32_t sqentries;
+  uint32_t* cqhead;
+  uint32_t* cqtail;
+  uint32_t cqmask;
+  uint32_t cqentries;
+  struct uv__io_uring_sqe* sqe;
+  struct uv__io_uring_cqe* cqe;
+  void* ring;
+  size_t ringlen;
+  size_t sqelen;
+  unsigned int pending;    /* Queued but not yet submitted. */
+  unsigned int in_flight;  /* Submitted or queued, not yet reaped. */
+  int ringfd;
+  uv__io_t watcher;
+  QUEUE write_retries;     /* Short writes waiting for a free entry. */
+};
+
+
+static void uv__iou_on_readable(uv_loop_t* loop, uv__io_t* w, unsigned int e);
+
+
+static struct uv__iou* uv__iou_init(uv_loop_t* loop) {
+  struct uv__io_uring_params params;
+  struct uv__iou* iou;
+  const char* val;
+  size_t sqlen;
+  size_t cqlen;
+  uint32_t i;
+  char* sq;
+  int ringfd;
+
+  iou = uv__calloc(1, sizeof(*iou));
+  if (iou == NULL)
+    return NULL;
+
+  iou->ringfd = -1;
+  QUEUE_INIT(&iou->write_retries);
+  loop->internal_fields = iou;
+
+#if defined(__ANDROID__)
+  /* Android's seccomp policy kills processes that call io_uring_setup(). */
+  return iou;
+#endif
+
+  val = getenv("UV_USE_IO_URING");
+  if (val != NULL && atoi(val) == 0)
+    return iou;
+
+  memset(&params, 0, sizeof(params));
+  ringfd = uv__io_uring_setup(UV__IOU_ENTRIES, &params);
+  if (ringfd == -1)
+    return iou;
+
+  /* The kernels before 5.13 that have every opcode used here still have
+   * io_uring bugs that later stable releases fixed, so use IORING_FEAT_*
+   * flags as a proxy for a recent enough kernel.
+   */
+  if (!(params.features & UV__IORING_FEAT_SINGLE_MMAP) ||
+      !(params.features & UV__IORING_FEAT_NODROP) ||
+      !(params.features & UV__IORING_FEAT_RW_CUR_POS) ||
+      !(params.features & UV__IORING_FEAT_RSRC_TAGS)) {
+    uv__close(ringfd);
+    return iou;
+  }
+
+  sqlen = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  cqlen = params.cq_off.cqes +
+          params.cq_entries * sizeof(struct uv__io_uring_cqe);
+  iou->ringlen = sqlen > cqlen ? sqlen : cqlen;
+  iou->sqelen = params.sq_entries * sizeof(struct uv__io_uring_sqe);
+
+  iou->ring = mmap(NULL,
+                   iou->ringlen,
+                   PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE,
+                   ringfd,
+                   UV__IORING_OFF_SQ_RING);
+  if (iou->ring == MAP_FAILED) {
+    uv__close(ringfd);
+    return iou;
+  }
+
+  iou->sqe = mmap(NULL,
+                  iou->sqelen,
+                  PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_POPULATE,
+                  ringfd,
+                  UV__IORING_OFF_SQES);
+  if (iou->sqe == MAP_FAILED) {
+    munmap(iou->ring, iou->ringlen);
+    uv__close(ringfd);
+    return iou;
+  }
+
+  sq = iou->ring;
+  iou->sqhead = (uint32_t*) (sq + params.sq_off.head);
+  iou->sqtail = (uint32_t*) (sq + params.sq_off.tail);
+  iou->sqarray = (uint32_t*) (sq + params.sq_off.array);
+  iou->sqmask = *(uint32_t*) (sq + params.sq_off.ring_mask);
+  iou->sqentries = params.sq_entries;
+  iou->cqhead = (uint32_t*) (sq + params.cq_off.head);
+  iou->cqtail = (uint32_t*) (sq + params.cq_off.tail);
+  iou->cqe = (struct uv__io_uring_cqe*) (sq + params.cq_off.cqes);
+  iou->cqmask = *(uint32_t*) (sq + params.cq_off.ring_mask);
+  iou->cqentries = params.cq_entries;
+
+  /* Submission queue entry i always lives in slot i. */
+  for (i = 0; i <= iou->sqmask; i++)
+    iou->sqarray[i] = i;
+
+  iou->ringfd = ringfd;
+  uv__io_init(&iou->watcher, uv__iou_on_readable, ringfd);
+  uv__io_start(loop, &iou->watcher, POLLIN);
+
+  return iou;
+}
+
+
+void uv__iou_delete(uv_loop_t* loop) {
+  struct uv__iou* iou;
+
+  iou = loop->internal_fields;
+  if (iou == NULL)
+    return;
+
+  if (iou->ringfd != -1) {
+    uv__io_stop(loop, &iou->watcher, POLLIN);
+    munmap(iou->sqe, iou->sqelen);
+    munmap(iou->ring, iou->ringlen);
+    uv__close(iou->ringfd);
+  }
+
+  uv__free(iou);
+  loop->internal_fields = NULL;
+}
+
+
+static int uv__iou_queue_rw(uv_loop_t* loop, uv_fs_t* req);
+
+
+static void uv__iou_enter(struct uv__iou* iou) {
+  int rc;
+
+  if (iou->pending == 0)
+    return;
+
+  do
+    rc = uv__io_uring_enter(iou->ringfd, iou->pending, 0, 0);
+  while (rc == -1 && errno == EINTR);
+
+  if (rc == -1) {
+    /* Out of kernel memory, the entries are submitted on the next flush. */
+    if (errno == EAGAIN || errno == EBUSY)
+      return;
+    abort();
+  }
+
+  assert((unsigned int) rc <= iou->pending);
+  iou->pending -= rc;
+}
+
+
+void uv__iou_flush(uv_loop_t* loop) {
+  struct uv__iou* iou;
+  uv_fs_t* req;
+  QUEUE* q;
+
+  iou = loop->internal_fields;
+  if (iou == NULL)
+    return;
+
+  /* Resubmit the rest of the short writes that found the ring full. */
+  while (!QUEUE_EMPTY(&iou->write_retries)) {
+    q = QUEUE_HEAD(&iou->write_retries);
+    QUEUE_REMOVE(q);
+    req = container_of(q, uv_fs_t, work_req.wq);
+    if (!uv__iou_queue_rw(loop, req)) {
+      QUEUE_INSERT_HEAD(&iou->write_retries, q);
+      break;
+    }
+  }
+
+  uv__iou_enter(iou);
+}
+
+
+static struct uv__io_uring_sqe* uv__iou_get_sqe(uv_loop_t* loop,
+                                                uv_fs_t* req) {
+  struct uv__io_uring_sqe* sqe;
+  struct uv__iou* iou;
+  uint32_t head;
+  uint32_t tail;
+
+  iou = loop->internal_fields;
+  if (iou == NULL)
+    iou = uv__iou_init(loop);
+
+  if (iou == NULL || iou->ringfd == -1)
+    return NULL;
+
+  /* Never have more requests out than the completion queue holds. */
+  if (iou->in_flight >= iou->cqentries)
+    return NULL;
+
+  tail = *iou->sqtail;
+  head = __atomic_load_n(iou->sqhead, __ATOMIC_ACQUIRE);
+  if (tail - head >= iou->sqentries) {
+    uv__iou_enter(iou);
+    head = __atomic_load_n(iou->sqhead, __ATOMIC_ACQUIRE);
+    if (tail - head >= iou->sqentries)
+      return NULL;
+  }
+
+  sqe = &iou->sqe[tail & iou->sqmask];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->user_data = (uintptr_t) req;
+
+  /* Requests on the ring cannot be cancelled, see uv__work_cancel(). */
+  req->work_req.loop = loop;
+  req->work_req.work = NULL;
+  req->work_req.done = NULL;
+  QUEUE_INIT(&req->work_req.wq);
+
+  return sqe;
+}
+
+
+static void uv__iou_submit(uv_loop_t* loop) {
+  struct uv__iou* iou;
+
+  iou = loop->internal_fields;
+  __atomic_store_n(iou->sqtail, *iou->sqtail + 1, __ATOMIC_RELEASE);
+  iou->pending++;
+  iou->in_flight++;
+}
+
+
+static int uv__iou_queue_rw(uv_loop_t* loop, uv_fs_t* req) {
+  struct uv__io_uring_sqe* sqe;
+
+  sqe = uv__iou_get_sqe(loop, req);
+  if (sqe == NULL)
+    return 0;
+
+  sqe->opcode = req->fs_type == UV_FS_READ ? UV__IORING_OP_READV
+                                           : UV__IORING_OP_WRITEV;
+  sqe->fd = req->file;
+  sqe->addr = (uintptr_t) req->bufs;
+  sqe->len = req->nbufs;
+  /* An offset of -1 reads or writes at the file position. */
+  sqe->off = req->off < 0 ? (uint64_t) -1 : (uint64_t) req->off;
+
+  uv__iou_submit(loop);
+  return 1;
+}
+
+
+/* Returns 1 if the request was queued on the ring, 0 if it should go to the
+ * thread pool.
+ */
+int uv__iou_fs_submit(uv_loop_t* loop, uv_fs_t* req) {
+  struct uv__io_uring_sqe* sqe;
+  struct uv__statx* statxbuf;
+
+  switch (req->fs_type) {
+  case UV_FS_READ:
+  case UV_FS_WRITE:
+    /* uv__fs_read() and uv__fs_write_all() split longer vectors. */
+    if (req->nbufs > (unsigned int) uv__getiovmax())
+      return 0;
+    /* uv__iou_write_rest() adds up the bytes of short writes here. */
+    req->result = 0;
+    return uv__iou_queue_rw(loop, req);
+
+  case UV_FS_FSYNC:
+  case UV_FS_FDATASYNC:
+    sqe = uv__iou_get_sqe(loop, req);
+    if (sqe == NULL)
+      return 0;
+    sqe->opcode = UV__IORING_OP_FSYNC;
+    sqe->fd = req->file;
+    if (req->fs_type == UV_FS_FDATASYNC)
+      sqe->fsync_flags = UV__IORING_FSYNC_DATASYNC;
+    break;
+
+  case UV_FS_OPEN:
+    sqe = uv__iou_get_sqe(loop, req);
+    if (sqe == NULL)
+      return 0;
+    sqe->opcode = UV__IORING_OP_OPENAT;
+    sqe->fd = AT_FDCWD;
+    sqe->addr = (uintptr_t) req->path;
+    sqe->len = req->mode;
+    sqe->open_flags = req->flags | O_CLOEXEC;
+    break;
+
+  case UV_FS_CLOSE:
+    sqe = uv__iou_get_sqe(loop, req);
+    if (sqe == NULL)
+      return 0;
+    sqe->opcode = UV__IORING_OP_CLOSE;
+    sqe->fd = req->file;
+    break;
+
+  case UV_FS_STAT:
+  case UV_FS_LSTAT:
+  case UV_FS_FSTAT:
+    statxbuf = uv__malloc(sizeof(*statxbuf));
+    if (statxbuf == NULL)
+      return 0;
+    sqe = uv__iou_get_sqe(loop, req);
+    if (sqe == NULL) {
+      uv__free(statxbuf);
+      return 0;
+    }
+    sqe->opcode = UV__IORING_OP_STATX;
+    sqe->len = UV__STATX_BASIC_STATS;
+    sqe->off = (uintptr_t) statxbuf;
+    if (req->fs_type == UV_FS_FSTAT) {
+      sqe->fd = req->file;
+      sqe->addr = (uintptr_t) "";
+      sqe->statx_flags = AT_EMPTY_PATH;
+    } else {
+      sqe->fd = AT_FDCWD;
+      sqe->addr = (uintptr_t) req->path;
+      if (req->fs_type == UV_FS_LSTAT)
+        sqe->statx_flags = AT_SYMLINK_NOFOLLOW;
+    }
+    req->ptr = statxbuf;
+    break;
+
+  default:
+    return 0;
+  }
+
+  uv__iou_submit(loop);
+  return 1;
+}
+
+
+static void uv__statx_to_stat(const struct uv__statx* src, uv_stat_t* dst) {
+  dst->st_dev = makedev(src->stx_dev_major, src->stx_dev_minor);
+  dst->st_mode = src->stx_mode;
+  dst->st_nlink = src->stx_nlink;
+  dst->st_uid = src->stx_uid;
+  dst->st_gid = src->stx_gid;
+  dst->st_rdev = makedev(src->stx_rdev_major, src->stx_rdev_minor);
+  dst->st_ino = src->stx_ino;
+  dst->st_size = src->stx_size;
+  dst->st_blksize = src->stx_blksize;
+  dst->st_blocks = src->stx_blocks;
+  dst->st_atim.tv_sec = src->stx_atime.tv_sec;
+  dst->st_atim.tv_nsec = src->stx_atime.tv_nsec;
+  dst->st_mtim.tv_sec = src->stx_mtime.tv_sec;
+  dst->st_mtim.tv_nsec = src->stx_mtime.tv_nsec;
+  dst->st_ctim.tv_sec = src->stx_ctime.tv_sec;
+  dst->st_ctim.tv_nsec = src->stx_ctime.tv_nsec;
+  /* Match uv__to_stat(), which has no birth time on Linux. */
+  dst->st_birthtim.tv_sec = src->stx_ctime.tv_sec;
+  dst->st_birthtim.tv_nsec = src->stx_ctime.tv_nsec;
+  dst->st_flags = 0;
+  dst->st_gen = 0;
+}
+
+
+/* Like uv__fs_write_all(), a write that the kernel cut short goes on with the
+ * rest of the buffers. Returns 1 if the rest was queued, 0 if the request is
+ * finished, with the total written or the error in *res.
+ */
+static int uv__iou_write_rest(uv_loop_t* loop, uv_fs_t* req, int* res) {
+  struct uv__iou* iou;
+  unsigned int n;
+  size_t size;
+
+  if (*res <= 0) {
+    /* Report what made it out before the error or the end of the space. */
+    if (req->result > 0)
+      *res = req->result;
+    return 0;
+  }
+
+  req->result += *res;
+  if (req->off >= 0)
+    req->off += *res;
+
+  size = *res;
+  for (n = 0; n < req->nbufs && size >= req->bufs[n].len; n++)
+    size -= req->bufs[n].len;
+
+  if (n == req->nbufs) {
+    *res = req->result;
+    return 0;
+  }
+
+  /* The buffers are libuv's copy, see uv_fs_write(). */
+  req->bufs[n].base += size;
+  req->bufs[n].len -= size;
+  memmove(req->bufs, req->bufs + n, (req->nbufs - n) * sizeof(req->bufs[0]));
+  req->nbufs -= n;
+
+  if (!uv__iou_queue_rw(loop, req)) {
+    iou = loop->internal_fields;
+    QUEUE_INSERT_TAIL(&iou->write_retries, &req->work_req.wq);
+  }
+
+  return 1;
+}
+
+
+static void uv__iou_fs_done(uv_fs_t* req, int res) {
+  req->result = res;
+
+  switch (req->fs_type) {
+  case UV_FS_READ:
+  case UV_FS_WRITE:
+    if (req->bufs != req->bufsml)
+      uv__free(req->bufs);
+    req->bufs = NULL;
+    req->nbufs = 0;
+    break;
+
+  case UV_FS_STAT:
+  case UV_FS_LSTAT:
+  case UV_FS_FSTAT:
+    if (res == 0)
+      uv__statx_to_stat(req->ptr, &req->statbuf);
+    uv__free(req->ptr);
+    req->ptr = res == 0 ? &req->statbuf : NULL;
+    break;
+
+  default:
+    break;
+  }
+
+  uv__req_unregister(req->loop, req);
+  req->cb(req);
+}
+
+
+static void uv__iou_on_readable(uv_loop_t* loop, uv__io_t* w, unsigned int e) {
+  struct uv__io_uring_cqe* cqe;
+  struct uv__iou* iou;
+  uv_fs_t* req;
+  uint32_t head;
+  uint32_t tail;
+  int res;
+
+  iou = container_of(w, struct uv__iou, watcher);
+
+  head = *iou->cqhead;
+  tail = __atomic_load_n(iou->cqtail, __ATOMIC_ACQUIRE);
+
+  while (head != tail) {
+    cqe = &iou->cqe[head & iou->cqmask];
+    req = (uv_fs_t*) (uintptr_t) cqe->user_data;
+    res = cqe->res;
+
+    /* Hand the slot back before the callback queues more requests. */
+    head++;
+    __atomic_store_n(iou->cqhead, head, __ATOMIC_RELEASE);
+    iou->in_flight--;
+
+    if (req->fs_type == UV_FS_WRITE && uv__iou_write_rest(loop, req, &res))
+      continue;
+
+    uv__iou_fs_done(req, res);
+
+    if (loop->internal_fields != iou)
+      return;  /* The callback forked and the child dropped the ring. */
+
+    tail = __atomic_load_n(iou->cqtail, __ATOMIC_ACQUIRE);
+  }
+
+  /* Send what the callbacks queued without waiting for the next poll. */
+  uv__iou_flush(loop);
+}
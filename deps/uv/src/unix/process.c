@@ -24,6 +24,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include <errno.h>
 
@@ -44,6 +45,21 @@ extern char **environ;
 # include <grp.h>
 #endif
 
+/* posix_spawn() doesn't copy the page tables of the parent on macOS, or with
+ * glibc 2.24 and later, which spawn the child with clone(CLONE_VM|CLONE_VFORK)
+ * and report the errors from exec(). Earlier versions of glibc fork instead
+ * and let the child exit with status 127 when exec() fails.
+ */
+#if (defined(__APPLE__) && !TARGET_OS_IPHONE) || \
+    (defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 24))
+# define UV__POSIX_SPAWN 1
+# include <spawn.h>
+#endif
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 29)
+# define UV__POSIX_SPAWN_CHDIR 1
+#endif
+
 
 static void uv__chld(uv_signal_t* handle, int signum) {
   uv_process_t* process;
@@ -408,6 +424,167 @@ static void uv__process_child_init(const uv_process_options_t* options,
 #endif
 
 
+#ifdef UV__POSIX_SPAWN
+/* Spawns the child with posix_spawnp(), so that the time it takes doesn't
+ * grow with the size of the parent. Does what uv__process_child_init() does,
+ * and returns UV_ENOSYS without spawning anything when the options need
+ * something that only the forked child can do. Otherwise returns zero or the
+ * error from exec(), which the parent reaps itself.
+ */
+static int uv__process_posix_spawn(const uv_process_options_t* options,
+                                   int stdio_count,
+                                   int (*pipes)[2],
+                                   pid_t* pid) {
+  posix_spawn_file_actions_t actions;
+  posix_spawnattr_t attr;
+  sigset_t set;
+  const char* path;
+  char** env;
+  int use_fd;
+  int err;
+  int fd;
+  int i;
+  int n;
+
+  if (options->flags & (UV_PROCESS_DETACHED |
+                        UV_PROCESS_SETUID |
+                        UV_PROCESS_SETGID))
+    return UV_ENOSYS;
+
+#ifndef UV__POSIX_SPAWN_CHDIR
+  if (options->cwd != NULL)
+    return UV_ENOSYS;
+#endif
+
+  /* execvp() searches the PATH of the new environment, posix_spawnp() that
+   * of the parent.
+   */
+  env = options->env != NULL ? options->env : environ;
+  if (env != environ && strchr(options->file, '/') == NULL) {
+    path = getenv("PATH");
+    for (i = 0; env[i] != NULL; i++)
+      if (strncmp(env[i], "PATH=", 5) == 0)
+        break;
+
+    if (env[i] == NULL ? path != NULL :
+        path == NULL || strcmp(env[i] + 5, path) != 0)
+      return UV_ENOSYS;
+  }
+
+  for (fd = 0; fd < stdio_count; fd++) {
+    use_fd = pipes[fd][1];
+
+    /* Low numbered fds that would be replaced before they're duplicated have
+     * to be moved out of the way first, see uv__process_child_init().
+     */
+    if (use_fd >= 0 && use_fd < fd)
+      return UV_ENOSYS;
+
+    /* dup2() onto the same fd doesn't clear FD_CLOEXEC everywhere. */
+    if (use_fd == fd) {
+      n = fcntl(fd, F_GETFD);
+      if (n == -1 || (n & FD_CLOEXEC))
+        return UV_ENOSYS;
+    }
+  }
+
+  err = posix_spawn_file_actions_init(&actions);
+  if (err != 0)
+    return UV__ERR(err);
+
+  err = posix_spawnattr_init(&attr);
+  if (err != 0) {
+    posix_spawn_file_actions_destroy(&actions);
+    return UV__ERR(err);
+  }
+
+  for (fd = 0; fd < stdio_count && err == 0; fd++) {
+    use_fd = pipes[fd][1];
+
+    if (use_fd < 0) {
+      if (fd < 3)
+        err = posix_spawn_file_actions_addopen(&actions,
+                                               fd,
+                                               "/dev/null",
+                                               fd == 0 ? O_RDONLY : O_RDWR,
+                                               0);
+    } else if (use_fd != fd) {
+      err = posix_spawn_file_actions_adddup2(&actions, use_fd, fd);
+    }
+  }
+
+  /* The parent's ends of the pipes are close-on-exec. Inherited fds may not
+   * be, so close each of them once they're duplicated.
+   */
+  for (fd = 0; fd < stdio_count && err == 0; fd++) {
+    use_fd = pipes[fd][1];
+    if (use_fd < stdio_count)
+      continue;
+
+    for (i = 0; i < fd; i++)
+      if (pipes[i][1] == use_fd)
+        break;
+
+    if (i == fd)
+      err = posix_spawn_file_actions_addclose(&actions, use_fd);
+  }
+
+#ifdef UV__POSIX_SPAWN_CHDIR
+  if (options->cwd != NULL && err == 0)
+    err = posix_spawn_file_actions_addchdir_np(&actions, options->cwd);
+#endif
+
+  /* Reset signal disposition and mask, with the same limit as
+   * uv__process_child_init().
+   */
+  if (err == 0) {
+    sigemptyset(&set);
+    for (n = 1; n < 32; n += 1)
+      if (n != SIGKILL && n != SIGSTOP)
+        sigaddset(&set, n);
+    err = posix_spawnattr_setsigdefault(&attr, &set);
+  }
+
+  if (err == 0) {
+    sigemptyset(&set);
+    err = posix_spawnattr_setsigmask(&attr, &set);
+  }
+
+  if (err == 0)
+    err = posix_spawnattr_setflags(&attr,
+                                   POSIX_SPAWN_SETSIGDEF |
+                                   POSIX_SPAWN_SETSIGMASK);
+
+  if (err == 0) {
+    /* The descriptions of stdin, stdout and stderr are shared with the
+     * parent, so they can be made blocking from here.
+     */
+    for (fd = 0; fd < 3 && fd < stdio_count; fd++)
+      if (pipes[fd][1] >= 0)
+        uv__nonblock_fcntl(pipes[fd][1], 0);
+
+    err = posix_spawnp(pid,
+                       options->file,
+                       &actions,
+                       &attr,
+                       options->args,
+                       env);
+  }
+
+  posix_spawnattr_destroy(&attr);
+  posix_spawn_file_actions_destroy(&actions);
+
+  /* execvp() runs files without a shebang line with /bin/sh, so leave those
+   * to the forked child.
+   */
+  if (err == ENOEXEC)
+    return UV_ENOSYS;
+
+  return UV__ERR(err);
+}
+#endif
+
+
 int uv_spawn(uv_loop_t* loop,
              uv_process_t* process,
              const uv_process_options_t* options) {
@@ -459,6 +636,22 @@ int uv_spawn(uv_loop_t* loop,
       goto error;
   }
 
+  uv_signal_start(&loop->child_watcher, uv__chld, SIGCHLD);
+
+#ifdef UV__POSIX_SPAWN
+  /* Acquire write lock to prevent opening new fds in worker threads */
+  uv_rwlock_wrlock(&loop->cloexec_lock);
+  exec_errorno = uv__process_posix_spawn(options, stdio_count, pipes, &pid);
+  uv_rwlock_wrunlock(&loop->cloexec_lock);
+
+  if (exec_errorno != UV_ENOSYS) {
+    if (exec_errorno != 0)
+      pid = 0;
+    process->status = 0;
+    goto spawned;
+  }
+#endif
+
   /* This pipe is used by the parent to wait until
    * the child has called `execve()`. We need this
    * to avoid the following race condition:
@@ -483,8 +676,6 @@ int uv_spawn(uv_loop_t* loop,
   if (err)
     goto error;
 
-  uv_signal_start(&loop->child_watcher, uv__chld, SIGCHLD);
-
   /* Acquire write lock to prevent opening new fds in worker threads */
   uv_rwlock_wrlock(&loop->cloexec_lock);
   pid = fork();
@@ -529,6 +720,9 @@ int uv_spawn(uv_loop_t* loop,
 
   uv__close_nocheckstdio(signal_pipe[0]);
 
+#ifdef UV__POSIX_SPAWN
+spawned:
+#endif
   for (i = 0; i < options->stdio_count; i++) {
     err = uv__process_open_stream(options->stdio + i, pipes[i]);
     if (err == 0)
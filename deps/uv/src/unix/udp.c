@@ -39,6 +39,21 @@
 # define IPV6_DROP_MEMBERSHIP IPV6_LEAVE_GROUP
 #endif
 
+#if defined(__linux__)
+# define HAVE_MMSG 1
+#endif
+
+#define UV__UDP_DGRAM_MAXSIZE (64 * 1024)
+
+#if HAVE_MMSG
+/* Number of datagrams read or written by one recvmmsg or sendmmsg call. */
+# define UV__MMSG_MAXWIDTH 20
+
+static uv_once_t once = UV_ONCE_INIT;
+static int uv__recvmmsg_avail;
+static int uv__sendmmsg_avail;
+#endif
+
 
 static void uv__udp_run_completed(uv_udp_t* handle);
 static void uv__udp_io(uv_loop_t* loop, uv__io_t* w, unsigned int revents);
@@ -49,6 +64,30 @@ static int uv__udp_maybe_deferred_bind(uv_udp_t* handle,
                                        unsigned int flags);
 
 
+#if HAVE_MMSG
+static void uv__udp_mmsg_init(void) {
+  int ret;
+  int s;
+
+  s = uv__socket(AF_INET, SOCK_DGRAM, 0);
+  if (s < 0)
+    return;
+
+  ret = uv__sendmmsg(s, NULL, 0, 0);
+  if (ret == 0 || errno != ENOSYS) {
+    uv__sendmmsg_avail = 1;
+    uv__recvmmsg_avail = 1;
+  } else {
+    ret = uv__recvmmsg(s, NULL, 0, MSG_DONTWAIT, NULL);
+    if (ret == 0 || errno != ENOSYS)
+      uv__recvmmsg_avail = 1;
+  }
+
+  uv__close(s);
+}
+#endif
+
+
 void uv__udp_close(uv_udp_t* handle) {
   uv__io_close(handle->loop, &handle->io_watcher);
   uv__handle_stop(handle);
@@ -148,6 +187,64 @@ static void uv__udp_io(uv_loop_t* loop, uv__io_t* w, unsigned int revents) {
 }
 
 
+#if HAVE_MMSG
+static int uv__udp_recvmmsg(uv_udp_t* handle, uv_buf_t* buf) {
+  struct sockaddr_in6 peers[UV__MMSG_MAXWIDTH];
+  struct iovec iov[UV__MMSG_MAXWIDTH];
+  struct uv__mmsghdr msgs[UV__MMSG_MAXWIDTH];
+  ssize_t nread;
+  uv_buf_t chunk_buf;
+  size_t chunks;
+  int flags;
+  size_t k;
+
+  /* prepare structures for recvmmsg */
+  chunks = buf->len / UV__UDP_DGRAM_MAXSIZE;
+  if (chunks > ARRAY_SIZE(iov))
+    chunks = ARRAY_SIZE(iov);
+  for (k = 0; k < chunks; ++k) {
+    iov[k].iov_base = buf->base + k * UV__UDP_DGRAM_MAXSIZE;
+    iov[k].iov_len = UV__UDP_DGRAM_MAXSIZE;
+    memset(&msgs[k].msg_hdr, 0, sizeof(msgs[k].msg_hdr));
+    msgs[k].msg_hdr.msg_iov = iov + k;
+    msgs[k].msg_hdr.msg_iovlen = 1;
+    msgs[k].msg_hdr.msg_name = peers + k;
+    msgs[k].msg_hdr.msg_namelen = sizeof(peers[0]);
+  }
+
+  do
+    nread = uv__recvmmsg(handle->io_watcher.fd, msgs, chunks, 0, NULL);
+  while (nread == -1 && errno == EINTR);
+
+  if (nread < 1) {
+    if (nread == 0 || errno == EAGAIN || errno == EWOULDBLOCK)
+      handle->recv_cb(handle, 0, buf, NULL, 0);
+    else
+      handle->recv_cb(handle, UV__ERR(errno), buf, NULL, 0);
+  } else {
+    /* pass each chunk to the application */
+    for (k = 0; k < (size_t) nread && handle->recv_cb != NULL; k++) {
+      flags = UV_UDP_MMSG_CHUNK;
+      if (msgs[k].msg_hdr.msg_flags & MSG_TRUNC)
+        flags |= UV_UDP_PARTIAL;
+
+      chunk_buf = uv_buf_init(iov[k].iov_base, iov[k].iov_len);
+      handle->recv_cb(handle,
+                      msgs[k].msg_len,
+                      &chunk_buf,
+                      msgs[k].msg_hdr.msg_name,
+                      flags);
+    }
+
+    /* one last callback so the original buffer is freed */
+    if (handle->recv_cb != NULL)
+      handle->recv_cb(handle, 0, buf, NULL, UV_UDP_MMSG_FREE);
+  }
+  return nread;
+}
+#endif
+
+
 static void uv__udp_recvmsg(uv_udp_t* handle) {
   struct sockaddr_storage peer;
   struct msghdr h;
@@ -169,13 +266,29 @@ static void uv__udp_recvmsg(uv_udp_t* handle) {
 
   do {
     buf = uv_buf_init(NULL, 0);
-    handle->alloc_cb((uv_handle_t*) handle, 64 * 1024, &buf);
+#if HAVE_MMSG
+    if (uv_udp_using_recvmmsg(handle))
+      handle->alloc_cb((uv_handle_t*) handle,
+                       UV__UDP_DGRAM_MAXSIZE * UV__MMSG_MAXWIDTH,
+                       &buf);
+    else
+#endif
+    handle->alloc_cb((uv_handle_t*) handle, UV__UDP_DGRAM_MAXSIZE, &buf);
     if (buf.base == NULL || buf.len == 0) {
       handle->recv_cb(handle, UV_ENOBUFS, &buf, NULL, 0);
       return;
     }
     assert(buf.base != NULL);
 
+#if HAVE_MMSG
+    if (uv_udp_using_recvmmsg(handle) && buf.len >= UV__UDP_DGRAM_MAXSIZE) {
+      nread = uv__udp_recvmmsg(handle, &buf);
+      if (nread > 0)
+        count -= nread;
+      continue;
+    }
+#endif
+
     h.msg_namelen = sizeof(peer);
     h.msg_iov = (void*) &buf;
     h.msg_iovlen = 1;
@@ -213,12 +326,88 @@ static void uv__udp_recvmsg(uv_udp_t* handle) {
 }
 
 
+#if HAVE_MMSG
+static void uv__udp_sendmmsg(uv_udp_t* handle) {
+  uv_udp_send_t* req;
+  struct uv__mmsghdr h[UV__MMSG_MAXWIDTH];
+  struct uv__mmsghdr *p;
+  QUEUE* q;
+  ssize_t npkts;
+  size_t pkts;
+  size_t i;
+
+  while (!QUEUE_EMPTY(&handle->write_queue)) {
+    for (pkts = 0, q = QUEUE_HEAD(&handle->write_queue);
+         pkts < UV__MMSG_MAXWIDTH && q != &handle->write_queue;
+         ++pkts, q = QUEUE_NEXT(q)) {
+      req = QUEUE_DATA(q, uv_udp_send_t, queue);
+      assert(req != NULL);
+
+      p = &h[pkts];
+      memset(p, 0, sizeof(*p));
+      p->msg_hdr.msg_name = &req->addr;
+      p->msg_hdr.msg_namelen = (req->addr.ss_family == AF_INET6 ?
+        sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in));
+      p->msg_hdr.msg_iov = (struct iovec*) req->bufs;
+      p->msg_hdr.msg_iovlen = req->nbufs;
+    }
+
+    do
+      npkts = uv__sendmmsg(handle->io_watcher.fd, h, pkts, 0);
+    while (npkts == -1 && errno == EINTR);
+
+    if (npkts < 1) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS)
+        return;
+
+      /* sendmmsg only fails if the first datagram does; complete just that
+       * one with the error, as sendmsg would, and carry on with the rest.
+       */
+      npkts = 1;
+      q = QUEUE_HEAD(&handle->write_queue);
+      req = QUEUE_DATA(q, uv_udp_send_t, queue);
+      req->status = UV__ERR(errno);
+      QUEUE_REMOVE(&req->queue);
+      QUEUE_INSERT_TAIL(&handle->write_completed_queue, &req->queue);
+    } else {
+      /* Sending a datagram is an atomic operation: either all data
+       * is written or nothing is (and EMSGSIZE is raised). That is
+       * why we don't handle partial writes. Just pop the requests
+       * off the write queue and onto the completed queue, done.
+       */
+      for (i = 0; i < (size_t) npkts; ++i) {
+        q = QUEUE_HEAD(&handle->write_queue);
+        req = QUEUE_DATA(q, uv_udp_send_t, queue);
+        req->status = h[i].msg_len;
+        QUEUE_REMOVE(&req->queue);
+        QUEUE_INSERT_TAIL(&handle->write_completed_queue, &req->queue);
+      }
+    }
+
+    uv__io_feed(handle->loop, &handle->io_watcher);
+
+    /* The socket buffer is full, the rest can wait for POLLOUT. */
+    if ((size_t) npkts < pkts)
+      return;
+  }
+}
+#endif
+
+
 static void uv__udp_sendmsg(uv_udp_t* handle) {
   uv_udp_send_t* req;
   QUEUE* q;
   struct msghdr h;
   ssize_t size;
 
+#if HAVE_MMSG
+  uv_once(&once, uv__udp_mmsg_init);
+  if (uv__sendmmsg_avail) {
+    uv__udp_sendmmsg(handle);
+    return;
+  }
+#endif
+
   while (!QUEUE_EMPTY(&handle->write_queue)) {
     q = QUEUE_HEAD(&handle->write_queue);
     assert(q != NULL);
@@ -427,7 +616,9 @@ int uv__udp_send(uv_udp_send_t* req,
   QUEUE_INSERT_TAIL(&handle->write_queue, &req->queue);
   uv__handle_start(handle);
 
-  if (empty_queue && !(handle->flags & UV_HANDLE_UDP_PROCESSING)) {
+  if (handle->flags & UV_HANDLE_UDP_CORKED) {
+    /* Written by uv_udp_uncork(). */
+  } else if (empty_queue && !(handle->flags & UV_HANDLE_UDP_PROCESSING)) {
     uv__udp_sendmsg(handle);
 
     /* `uv__udp_sendmsg` may not be able to do non-blocking write straight
@@ -588,7 +779,7 @@ int uv_udp_init_ex(uv_loop_t* loop, uv_udp_t* handle, unsigned int flags) {
   if (domain != AF_INET && domain != AF_INET6 && domain != AF_UNSPEC)
     return UV_EINVAL;
 
-  if (flags & ~0xFF)
+  if (flags & ~(0xFF | UV_UDP_RECVMMSG))
     return UV_EINVAL;
 
   if (domain != AF_UNSPEC) {
@@ -608,6 +799,55 @@ int uv_udp_init_ex(uv_loop_t* loop, uv_udp_t* handle, unsigned int flags) {
   uv__io_init(&handle->io_watcher, uv__udp_io, fd);
   QUEUE_INIT(&handle->write_queue);
   QUEUE_INIT(&handle->write_completed_queue);
+
+  if (flags & UV_UDP_RECVMMSG)
+    handle->flags |= UV_HANDLE_UDP_RECVMMSG;
+
+  return 0;
+}
+
+
+int uv_udp_using_recvmmsg(const uv_udp_t* handle) {
+#if HAVE_MMSG
+  if (handle->flags & UV_HANDLE_UDP_RECVMMSG) {
+    uv_once(&once, uv__udp_mmsg_init);
+    return uv__recvmmsg_avail;
+  }
+#endif
+  return 0;
+}
+
+
+int uv_udp_cork(uv_udp_t* handle) {
+  if (handle->type != UV_UDP)
+    return UV_EINVAL;
+
+  handle->flags |= UV_HANDLE_UDP_CORKED;
+  return 0;
+}
+
+
+int uv_udp_uncork(uv_udp_t* handle) {
+  if (handle->type != UV_UDP)
+    return UV_EINVAL;
+
+  if (!(handle->flags & UV_HANDLE_UDP_CORKED))
+    return 0;
+
+  handle->flags &= ~UV_HANDLE_UDP_CORKED;
+
+  if (QUEUE_EMPTY(&handle->write_queue) ||
+      (handle->flags & UV_HANDLE_UDP_PROCESSING) ||
+      handle->io_watcher.fd == -1) {
+    return 0;
+  }
+
+  uv__udp_sendmsg(handle);
+
+  /* Whatever could not be written straight away waits for POLLOUT. */
+  if (!QUEUE_EMPTY(&handle->write_queue))
+    uv__io_start(handle->loop, &handle->io_watcher, POLLOUT);
+
   return 0;
 }
 
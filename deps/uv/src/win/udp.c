@@ -128,7 +128,8 @@ int uv_udp_init_ex(uv_loop_t* loop, uv_udp_t* handle, unsigned int flags) {
   if (domain != AF_INET && domain != AF_INET6 && domain != AF_UNSPEC)
     return UV_EINVAL;
 
-  if (flags & ~0xFF)
+  /* UV_UDP_RECVMMSG is accepted but has no effect, there is no recvmmsg. */
+  if (flags & ~(0xFF | UV_UDP_RECVMMSG))
     return UV_EINVAL;
 
   uv__handle_init(loop, (uv_handle_t*) handle, UV_UDP);
@@ -403,6 +404,26 @@ int uv__udp_recv_stop(uv_udp_t* handle) {
 }
 
 
+int uv_udp_using_recvmmsg(const uv_udp_t* handle) {
+  return 0;
+}
+
+
+int uv_udp_cork(uv_udp_t* handle) {
+  /* Sends are queued to the OS straight away; there is nothing to batch. */
+  if (handle->type != UV_UDP)
+    return UV_EINVAL;
+  return 0;
+}
+
+
+int uv_udp_uncork(uv_udp_t* handle) {
+  if (handle->type != UV_UDP)
+    return UV_EINVAL;
+  return 0;
+}
+
+
 static int uv__send(uv_udp_send_t* req,
                     uv_udp_t* handle,
                     const uv_buf_t bufs[],
@@ -74,3 +74,103 @@ TEST_IMPL(threadpool_queue_work_einval) {
   MAKE_VALGRIND_HAPPY();
   return 0;
 }
+
+
+static uv_work_t blocking_reqs[2];
+static uv_sem_t blocking_sem;
+static int blocking_done_count;
+static int fs_cb_count;
+
+
+static void blocking_work_cb(uv_work_t* req) {
+  uv_sem_wait(&blocking_sem);
+}
+
+
+static void blocking_after_work_cb(uv_work_t* req, int status) {
+  ASSERT(status == 0);
+  blocking_done_count++;
+}
+
+
+static void stat_cb(uv_fs_t* req) {
+  uv_threadpool_stats_t stats;
+  unsigned int i;
+
+  ASSERT(req->result == 0);
+  uv_fs_req_cleanup(req);
+  fs_cb_count++;
+
+  /* The file system queue ran the request while the CPU queue is full. */
+  ASSERT(blocking_done_count == 0);
+  ASSERT(0 == uv_threadpool_get_stats(UV_THREADPOOL_CPU, &stats));
+  ASSERT(stats.threads == ARRAY_SIZE(blocking_reqs));
+  ASSERT(stats.running + stats.pending == ARRAY_SIZE(blocking_reqs));
+
+  for (i = 0; i < ARRAY_SIZE(blocking_reqs); i++)
+    uv_sem_post(&blocking_sem);
+}
+
+
+TEST_IMPL(threadpool_separate_queues) {
+  uv_threadpool_stats_t stats;
+  uv_loop_t* loop;
+  uv_fs_t fs_req;
+  unsigned int i;
+
+  putenv("UV_THREADPOOL_SIZE=2");
+  putenv("UV_THREADPOOL_FS_SIZE=1");
+  putenv("UV_USE_IO_URING=0");
+  loop = uv_default_loop();
+
+  ASSERT(0 == uv_sem_init(&blocking_sem, 0));
+  for (i = 0; i < ARRAY_SIZE(blocking_reqs); i++) {
+    ASSERT(0 == uv_queue_work(loop,
+                              blocking_reqs + i,
+                              blocking_work_cb,
+                              blocking_after_work_cb));
+  }
+
+  ASSERT(0 == uv_fs_stat(loop, &fs_req, ".", stat_cb));
+  ASSERT(0 == uv_run(loop, UV_RUN_DEFAULT));
+  ASSERT(fs_cb_count == 1);
+  ASSERT(blocking_done_count == ARRAY_SIZE(blocking_reqs));
+
+  ASSERT(0 == uv_threadpool_get_stats(UV_THREADPOOL_CPU, &stats));
+  ASSERT(stats.size == 2);
+  ASSERT(stats.completed == ARRAY_SIZE(blocking_reqs));
+  ASSERT(stats.pending == 0);
+  ASSERT(0 == uv_threadpool_get_stats(UV_THREADPOOL_FS, &stats));
+  ASSERT(stats.threads == 1);
+  ASSERT(stats.completed == 1);
+  ASSERT(stats.max_wait_time <= stats.wait_time);
+  ASSERT(stats.max_run_time <= stats.run_time);
+  /* The DNS queue has no size of its own and shares the CPU queue. */
+  ASSERT(0 == uv_threadpool_get_stats(UV_THREADPOOL_DNS, &stats));
+  ASSERT(stats.size == 2);
+  ASSERT(stats.completed == ARRAY_SIZE(blocking_reqs));
+  ASSERT(UV_EINVAL == uv_threadpool_get_stats(UV_THREADPOOL_FS, NULL));
+
+  uv_sem_destroy(&blocking_sem);
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+TEST_IMPL(threadpool_shared_queue_by_default) {
+  uv_threadpool_stats_t stats;
+
+  /* Without sizes of their own, file system and DNS requests run on the
+   * threads of the uv_queue_work() queue, as they always have.
+   */
+  ASSERT(0 == uv_threadpool_get_stats(UV_THREADPOOL_CPU, &stats));
+  ASSERT(stats.size == 4);
+  ASSERT(stats.threads == 0);
+  ASSERT(0 == uv_threadpool_get_stats(UV_THREADPOOL_FS, &stats));
+  ASSERT(stats.size == 4);
+  ASSERT(0 == uv_threadpool_get_stats(UV_THREADPOOL_DNS, &stats));
+  ASSERT(stats.size == 4);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
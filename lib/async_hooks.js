@@ -14,6 +14,8 @@ const { registerDestroyHook } = internal_async_hooks;
 const {
   executionAsyncId,
   triggerAsyncId,
+  getContextFrame,
+  setContextFrame,
   // Private API
   getHookArrays,
   enableHooks,
@@ -21,6 +23,7 @@ const {
   // Internal Embedder API
   newAsyncId,
   getDefaultTriggerAsyncId,
+  captureContextFrame,
   emitInit,
   emitBefore,
   emitAfter,
@@ -159,6 +162,7 @@ class AsyncResource {
     this[trigger_async_id_symbol] = triggerAsyncId;
     // this prop name (destroyed) has to be synchronized with C++
     this[destroyedSymbol] = { destroyed: false };
+    captureContextFrame(this);
 
     emitInit(
       this[async_id_symbol], type, this[trigger_async_id_symbol], this
@@ -171,7 +175,7 @@ class AsyncResource {
 
   emitBefore() {
     showEmitBeforeAfterWarning();
-    emitBefore(this[async_id_symbol], this[trigger_async_id_symbol]);
+    emitBefore(this[async_id_symbol], this[trigger_async_id_symbol], this);
     return this;
   }
 
@@ -182,7 +186,7 @@ class AsyncResource {
   }
 
   runInAsyncScope(fn, thisArg, ...args) {
-    emitBefore(this[async_id_symbol], this[trigger_async_id_symbol]);
+    emitBefore(this[async_id_symbol], this[trigger_async_id_symbol], this);
     let ret;
     try {
       ret = Reflect.apply(fn, thisArg, args);
@@ -215,6 +219,8 @@ module.exports = {
   createHook,
   executionAsyncId,
   triggerAsyncId,
+  getContextFrame,
+  setContextFrame,
   // Embedder API
   AsyncResource,
 };
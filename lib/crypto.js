@@ -45,7 +45,8 @@ const { getFipsCrypto, setFipsCrypto } = internalBinding('crypto');
 const {
   randomBytes,
   randomFill,
-  randomFillSync
+  randomFillSync,
+  randomUUID
 } = require('internal/crypto/random');
 const {
   pbkdf2,
@@ -66,6 +67,7 @@ const {
 } = require('internal/crypto/diffiehellman');
 const {
   Cipher,
+  CipherContext,
   Cipheriv,
   Decipher,
   Decipheriv,
@@ -76,11 +78,14 @@ const {
 } = require('internal/crypto/cipher');
 const {
   Sign,
-  Verify
+  Verify,
+  verifyBatch
 } = require('internal/crypto/sig');
 const {
   Hash,
-  Hmac
+  Hmac,
+  hash,
+  hmac
 } = require('internal/crypto/hash');
 const {
   getCiphers,
@@ -108,6 +113,10 @@ function createCipheriv(cipher, key, iv, options) {
   return new Cipheriv(cipher, key, iv, options);
 }
 
+function createCipherContext(cipher, key, options) {
+  return new CipherContext(cipher, key, options);
+}
+
 function createDecipher(cipher, password, options) {
   return new Decipher(cipher, password, options);
 }
@@ -142,6 +151,7 @@ function createVerify(algorithm, options) {
 
 module.exports = exports = {
   // Methods
+  createCipherContext,
   createCipheriv,
   createDecipheriv,
   createDiffieHellman,
@@ -155,6 +165,8 @@ module.exports = exports = {
   getCurves,
   getDiffieHellman: createDiffieHellmanGroup,
   getHashes,
+  hash,
+  hmac,
   pbkdf2,
   pbkdf2Sync,
   generateKeyPair,
@@ -166,10 +178,12 @@ module.exports = exports = {
   randomBytes,
   randomFill,
   randomFillSync,
+  randomUUID,
   scrypt,
   scryptSync,
   setEngine,
   timingSafeEqual,
+  verifyBatch,
   getFips: !fipsMode ? getFipsDisabled :
     fipsForced ? getFipsForced : getFipsCrypto,
   setFips: !fipsMode ? setFipsDisabled :
@@ -178,6 +192,7 @@ module.exports = exports = {
   // Classes
   Certificate,
   Cipher,
+  CipherContext,
   Cipheriv,
   Decipher,
   Decipheriv,
@@ -79,6 +79,7 @@ function Socket(type, listener) {
   var lookup;
   let recvBufferSize;
   let sendBufferSize;
+  let recvBatch;
 
   if (type !== null && typeof type === 'object') {
     var options = type;
@@ -86,9 +87,10 @@ function Socket(type, listener) {
     lookup = options.lookup;
     recvBufferSize = options.recvBufferSize;
     sendBufferSize = options.sendBufferSize;
+    recvBatch = options.recvBatch;
   }
 
-  var handle = newHandle(type, lookup);
+  var handle = newHandle(type, lookup, recvBatch);
   handle[owner_symbol] = this;
 
   this[async_id_symbol] = handle.getAsyncId();
@@ -120,6 +122,7 @@ function startListening(socket) {
   const state = socket[kStateSymbol];
 
   state.handle.onmessage = onMessage;
+  state.handle.onmessages = onMessages;
   // Todo: handle errors
   state.handle.recvStart();
   state.receiving = true;
@@ -142,6 +145,7 @@ function replaceHandle(self, newHandle) {
   newHandle.lookup = oldHandle.lookup;
   newHandle.bind = oldHandle.bind;
   newHandle.send = oldHandle.send;
+  newHandle.sendBatch = oldHandle.sendBatch;
   newHandle[owner_symbol] = self;
 
   // Replace the existing handle by the handle we got from master.
@@ -520,6 +524,156 @@ function doSend(ex, self, ip, list, address, port, callback) {
   }
 }
 
+// sendBatch(messages[, callback]), each message being { msg, port[, address] }
+Socket.prototype.sendBatch = function(messages, callback) {
+  if (!Array.isArray(messages))
+    throw new ERR_INVALID_ARG_TYPE('messages', 'Array', messages);
+
+  const count = messages.length;
+  const batch = {
+    list: new Array(count),
+    ports: new Array(count),
+    addresses: new Array(count)
+  };
+
+  for (var i = 0; i < count; i++) {
+    const message = messages[i];
+    if (message === null || typeof message !== 'object') {
+      throw new ERR_INVALID_ARG_TYPE(`messages[${i}]`, 'Object', message);
+    }
+
+    let msg = message.msg;
+    if (typeof msg === 'string') {
+      msg = Buffer.from(msg);
+    } else if (!isUint8Array(msg)) {
+      throw new ERR_INVALID_ARG_TYPE(`messages[${i}].msg`,
+                                     ['Buffer', 'Uint8Array', 'string'],
+                                     msg);
+    }
+
+    const port = message.port >>> 0;
+    if (port === 0 || port > 65535)
+      throw new ERR_SOCKET_BAD_PORT(port);
+
+    const address = message.address;
+    if (address && typeof address !== 'string') {
+      throw new ERR_INVALID_ARG_TYPE(`messages[${i}].address`,
+                                     ['string', 'falsy'], address);
+    }
+
+    batch.list[i] = msg;
+    batch.ports[i] = port;
+    batch.addresses[i] = address || undefined;
+  }
+
+  if (typeof callback !== 'function')
+    callback = undefined;
+
+  healthCheck(this);
+
+  const state = this[kStateSymbol];
+
+  if (state.bindState === BIND_STATE_UNBOUND)
+    this.bind({ port: 0, exclusive: true }, null);
+
+  if (count === 0) {
+    if (callback)
+      process.nextTick(callback, null, 0);
+    return;
+  }
+
+  // If the socket hasn't been bound yet, push the batch onto the send queue
+  // and send after binding is complete.
+  if (state.bindState !== BIND_STATE_BOUND) {
+    enqueue(this, lookupBatch.bind(null, this, batch, callback));
+    return;
+  }
+
+  lookupBatch(this, batch, callback);
+};
+
+function lookupBatch(self, batch, callback) {
+  const state = self[kStateSymbol];
+  if (!state.handle)
+    return;
+
+  // Resolve each distinct address once, however many messages go to it.
+  const waiting = new Map();
+  for (var i = 0; i < batch.addresses.length; i++) {
+    const address = batch.addresses[i];
+    const indexes = waiting.get(address);
+    if (indexes === undefined)
+      waiting.set(address, [i]);
+    else
+      indexes.push(i);
+  }
+
+  const ips = new Array(batch.addresses.length);
+  let remaining = waiting.size;
+  let failed = false;
+
+  waiting.forEach((indexes, address) => {
+    state.handle.lookup(address, (ex, ip) => {
+      if (failed)
+        return;
+
+      if (ex) {
+        failed = true;
+      } else {
+        for (var j = 0; j < indexes.length; j++)
+          ips[indexes[j]] = ip;
+        if (--remaining !== 0)
+          return;
+      }
+
+      defaultTriggerAsyncIdScope(
+        self[async_id_symbol],
+        doSendBatch,
+        ex, self, batch, ips, callback
+      );
+    });
+  });
+}
+
+function doSendBatch(ex, self, batch, ips, callback) {
+  const state = self[kStateSymbol];
+
+  if (ex) {
+    if (typeof callback === 'function') {
+      process.nextTick(callback, ex);
+      return;
+    }
+
+    process.nextTick(() => self.emit('error', ex));
+    return;
+  } else if (!state.handle) {
+    return;
+  }
+
+  var req = new SendWrap();
+  req.list = batch.list;  // Keep reference alive.
+  if (callback) {
+    req.callback = callback;
+    req.oncomplete = afterSendBatch;
+  }
+
+  var err = state.handle.sendBatch(req,
+                                   batch.list,
+                                   batch.list.length,
+                                   batch.ports,
+                                   ips,
+                                   !!callback);
+
+  if (err && callback) {
+    // Nothing was queued, so the callback will not be called from C++.
+    process.nextTick(callback, errnoException(err, 'send'));
+  }
+}
+
+function afterSendBatch(err, sent) {
+  this.callback(err ? errnoException(err, 'send') : null, sent);
+}
+
 function afterSend(err, sent) {
   if (err) {
     err = exceptionWithHostPort(err, 'send', this.address, this.port);
@@ -686,6 +840,28 @@ function onMessage(nread, handle, buf, rinfo) {
 }
 
 
+function onMessages(count, handle, bufs, rinfos) {
+  var self = handle[owner_symbol];
+  var i;
+
+  if (self.listenerCount('messages') === 0) {
+    // A listener may close the socket part way through the batch.
+    for (i = 0; i < count && self[kStateSymbol].handle; i++) {
+      rinfos[i].size = bufs[i].length; // compatibility
+      self.emit('message', bufs[i], rinfos[i]);
+    }
+    return;
+  }
+
+  const messages = new Array(count);
+  for (i = 0; i < count; i++) {
+    rinfos[i].size = bufs[i].length;
+    messages[i] = { msg: bufs[i], rinfo: rinfos[i] };
+  }
+  self.emit('messages', messages);
+}
+
+
 Socket.prototype.ref = function() {
   const handle = this[kStateSymbol].handle;
 
@@ -32,6 +32,8 @@ const {
   Resolver,
   validateHints,
   emitInvalidHostnameWarning,
+  lookupAddresses,
+  setLookupCache,
 } = require('internal/dns/utils');
 const {
   ERR_INVALID_ARG_TYPE,
@@ -140,7 +142,7 @@ function lookup(hostname, options, callback) {
   req.hostname = hostname;
   req.oncomplete = all ? onlookupall : onlookup;
 
-  var err = cares.getaddrinfo(req, hostname, family, hints, verbatim);
+  var err = lookupAddresses(req, hostname, family, hints, verbatim);
   if (err) {
     process.nextTick(callback, dnsException(err, 'getaddrinfo', hostname));
     return {};
@@ -279,6 +281,7 @@ module.exports = {
 
   Resolver,
   setServers: defaultResolverSetServers,
+  setLookupCache,
 
   // uv_getaddrinfo flags
   ADDRCONFIG: cares.AI_ADDRCONFIG,
@@ -29,7 +29,6 @@ const {
   S_IFIFO,
   S_IFLNK,
   S_IFMT,
-  S_IFREG,
   S_IFSOCK,
   F_OK,
   R_OK,
@@ -43,10 +42,9 @@ const { _extend } = require('util');
 const pathModule = require('path');
 const { isArrayBufferView } = require('internal/util/types');
 const binding = internalBinding('fs');
-const { Buffer, kMaxLength } = require('buffer');
+const { Buffer } = require('buffer');
 const errors = require('internal/errors');
 const {
-  ERR_FS_FILE_TOO_LARGE,
   ERR_INVALID_ARG_VALUE,
   ERR_INVALID_ARG_TYPE,
   ERR_INVALID_CALLBACK
@@ -93,7 +91,6 @@ let fs;
 // Lazy loaded
 let promises;
 let watchers;
-let ReadFileContext;
 let ReadStream;
 let WriteStream;
 
@@ -238,158 +235,62 @@ function existsSync(path) {
   return ctx.errno === undefined;
 }
 
-function readFileAfterOpen(err, fd) {
-  const context = this.context;
-
-  if (err) {
-    context.callback(err);
-    return;
-  }
-
-  context.fd = fd;
-
-  const req = new FSReqCallback();
-  req.oncomplete = readFileAfterStat;
-  req.context = context;
-  binding.fstat(fd, false, req);
-}
-
-function readFileAfterStat(err, stats) {
-  const context = this.context;
-
-  if (err)
-    return context.close(err);
-
-  const size = context.size = isFileType(stats, S_IFREG) ? stats[8] : 0;
-
-  if (size === 0) {
-    context.buffers = [];
-    context.read();
-    return;
-  }
-
-  if (size > kMaxLength) {
-    err = new ERR_FS_FILE_TOO_LARGE(size);
-    return context.close(err);
-  }
-
-  try {
-    context.buffer = Buffer.allocUnsafeSlow(size);
-  } catch (err) {
-    return context.close(err);
-  }
-  context.read();
+function getReadFileMmap(options) {
+  const { mmap = false } = options;
+  if (typeof mmap !== 'boolean')
+    throw new ERR_INVALID_ARG_TYPE('options.mmap', 'boolean', mmap);
+  return mmap;
 }
 
 function readFile(path, options, callback) {
   callback = maybeCallback(callback || options);
   options = getOptions(options, { flag: 'r' });
-  if (!ReadFileContext)
-    ReadFileContext = require('internal/fs/read_file_context');
-  const context = new ReadFileContext(callback, options.encoding);
-  context.isUserFd = isFd(path); // file descriptor ownership
+  const mmap = getReadFileMmap(options);
+  const encoding = options.encoding;
 
   const req = new FSReqCallback();
-  req.context = context;
-  req.oncomplete = readFileAfterOpen;
+  req.oncomplete = (err, buffer) => {
+    if (err)
+      return callback(err);
+    let data;
+    try {
+      data = encoding ? buffer.toString(encoding) : buffer;
+    } catch (err) {
+      return callback(err);
+    }
+    callback(null, data);
+  };
 
-  if (context.isUserFd) {
-    process.nextTick(function tick() {
-      req.oncomplete(null, path);
-    });
+  if (isFd(path)) {
+    binding.readFile(path, 0, mmap, req);
     return;
   }
 
   path = toPathIfFileURL(path);
   validatePath(path);
-  binding.open(pathModule.toNamespacedPath(path),
-               stringToFlags(options.flag || 'r'),
-               0o666,
-               req);
-}
-
-function tryStatSync(fd, isUserFd) {
-  const ctx = {};
-  const stats = binding.fstat(fd, false, undefined, ctx);
-  if (ctx.errno !== undefined && !isUserFd) {
-    fs.closeSync(fd);
-    throw errors.uvException(ctx);
-  }
-  return stats;
-}
-
-function tryCreateBuffer(size, fd, isUserFd) {
-  let threw = true;
-  let buffer;
-  try {
-    if (size > kMaxLength) {
-      throw new ERR_FS_FILE_TOO_LARGE(size);
-    }
-    buffer = Buffer.allocUnsafe(size);
-    threw = false;
-  } finally {
-    if (threw && !isUserFd) fs.closeSync(fd);
-  }
-  return buffer;
-}
-
-function tryReadSync(fd, isUserFd, buffer, pos, len) {
-  let threw = true;
-  let bytesRead;
-  try {
-    bytesRead = fs.readSync(fd, buffer, pos, len);
-    threw = false;
-  } finally {
-    if (threw && !isUserFd) fs.closeSync(fd);
-  }
-  return bytesRead;
+  binding.readFile(pathModule.toNamespacedPath(path),
+                   stringToFlags(options.flag || 'r'),
+                   mmap,
+                   req);
 }
 
 function readFileSync(path, options) {
   options = getOptions(options, { flag: 'r' });
-  const isUserFd = isFd(path); // file descriptor ownership
-  const fd = isUserFd ? path : fs.openSync(path, options.flag, 0o666);
-
-  const stats = tryStatSync(fd, isUserFd);
-  const size = isFileType(stats, S_IFREG) ? stats[8] : 0;
-  let pos = 0;
-  let buffer; // single buffer with file data
-  let buffers; // list for when size is unknown
+  const mmap = getReadFileMmap(options);
 
-  if (size === 0) {
-    buffers = [];
-  } else {
-    buffer = tryCreateBuffer(size, fd, isUserFd);
-  }
-
-  let bytesRead;
-
-  if (size !== 0) {
-    do {
-      bytesRead = tryReadSync(fd, isUserFd, buffer, pos, size - pos);
-      pos += bytesRead;
-    } while (bytesRead !== 0 && pos < size);
+  let buffer;
+  if (isFd(path)) {
+    const ctx = {};
+    buffer = binding.readFile(path, 0, mmap, undefined, ctx);
+    handleErrorFromBinding(ctx);
   } else {
-    do {
-      // the kernel lies about many files.
-      // Go ahead and try to read some bytes.
-      buffer = Buffer.allocUnsafe(8192);
-      bytesRead = tryReadSync(fd, isUserFd, buffer, 0, 8192);
-      if (bytesRead !== 0) {
-        buffers.push(buffer.slice(0, bytesRead));
-      }
-      pos += bytesRead;
-    } while (bytesRead !== 0);
-  }
-
-  if (!isUserFd)
-    fs.closeSync(fd);
-
-  if (size === 0) {
-    // data was collected into the buffers list.
-    buffer = Buffer.concat(buffers, pos);
-  } else if (pos < size) {
-    buffer = buffer.slice(0, pos);
+    path = toPathIfFileURL(path);
+    validatePath(path);
+    const ctx = { path };
+    buffer = binding.readFile(pathModule.toNamespacedPath(path),
+                              stringToFlags(options.flag || 'r'),
+                              mmap, undefined, ctx);
+    handleErrorFromBinding(ctx);
   }
 
   if (options.encoding) buffer = buffer.toString(options.encoding);
@@ -1795,6 +1696,10 @@ function createWriteStream(path, options) {
   return new WriteStream(path, options);
 }
 
+function walk(path, options) {
+  return require('internal/fs/walk').walk(path, options);
+}
+
 
 module.exports = fs = {
   appendFile,
@@ -1866,6 +1771,7 @@ module.exports = fs = {
   unlinkSync,
   utimes,
   utimesSync,
+  walk,
   watch,
   watchFile,
   writeFile,
@@ -67,12 +67,27 @@ const active_hooks = {
 
 const { registerDestroyHook } = async_wrap;
 
+// Context frames are opaque values that callbacks are run in, taken from the
+// resource that schedules them. The current frame is kept in
+// Environment::AsyncHooks so that resources created in C++ can capture it as
+// well. Nothing is tracked until setContextFrame() is first called, which sets
+// async_hook_fields[kContextFrames] and installs a promise hook that only
+// propagates the frame.
+const {
+  getContextFrame: getContextFrame_,
+  setContextFrame: setContextFrame_,
+  enterContextFrame: enterContextFrame_,
+  exitContextFrame: exitContextFrame_,
+  clearContextFrames: clearContextFrames_
+} = async_wrap;
+
 // Each constant tracks how many callbacks there are for any given step of
 // async execution. These are tracked so if the user didn't include callbacks
 // for a given step, that step can bail out early.
 const { kInit, kBefore, kAfter, kDestroy, kTotals, kPromiseResolve,
-        kCheck, kExecutionAsyncId, kAsyncIdCounter, kTriggerAsyncId,
-        kDefaultTriggerAsyncId, kStackLength } = async_wrap.constants;
+        kCheck, kContextFrames, kExecutionAsyncId, kAsyncIdCounter,
+        kTriggerAsyncId, kDefaultTriggerAsyncId,
+        kStackLength } = async_wrap.constants;
 
 // Used in AsyncHook and AsyncResource.
 const async_id_symbol = Symbol('asyncId');
@@ -82,6 +97,7 @@ const before_symbol = Symbol('before');
 const after_symbol = Symbol('after');
 const destroy_symbol = Symbol('destroy');
 const promise_resolve_symbol = Symbol('promiseResolve');
+const context_frame_symbol = Symbol('contextFrame');
 const emitBeforeNative = emitHookFactory(before_symbol, 'emitBeforeNative');
 const emitAfterNative = emitHookFactory(after_symbol, 'emitAfterNative');
 const emitDestroyNative = emitHookFactory(destroy_symbol, 'emitDestroyNative');
@@ -337,7 +353,24 @@ function emitInitScript(asyncId, type, triggerAsyncId, resource) {
 }
 
 
-function emitBeforeScript(asyncId, triggerAsyncId) {
+function getContextFrame() {
+  if (async_hook_fields[kContextFrames] === 0)
+    return undefined;
+  return getContextFrame_();
+}
+
+function setContextFrame(frame) {
+  setContextFrame_(frame);
+}
+
+// Called when a JS resource is created, emitBefore() enters the frame again.
+function captureContextFrame(resource) {
+  if (async_hook_fields[kContextFrames] > 0)
+    resource[context_frame_symbol] = getContextFrame_();
+}
+
+
+function emitBeforeScript(asyncId, triggerAsyncId, resource) {
   // Validate the ids. An id of -1 means it was never set and is visible on the
   // call graph. An id < -1 should never happen in any circumstance. Throw
   // on user calls because async state should still be recoverable.
@@ -346,6 +379,13 @@ function emitBeforeScript(asyncId, triggerAsyncId) {
 
   pushAsyncIds(asyncId, triggerAsyncId);
 
+  if (async_hook_fields[kContextFrames] > 0) {
+    if (resource === undefined)
+      enterContextFrame_();
+    else
+      enterContextFrame_(resource[context_frame_symbol]);
+  }
+
   if (async_hook_fields[kBefore] > 0)
     emitBeforeNative(asyncId);
 }
@@ -357,6 +397,9 @@ function emitAfterScript(asyncId) {
   if (async_hook_fields[kAfter] > 0)
     emitAfterNative(asyncId);
 
+  if (async_hook_fields[kContextFrames] > 0)
+    exitContextFrame_();
+
   popAsyncIds(asyncId);
 }
 
@@ -377,6 +420,8 @@ function clearAsyncIdStack() {
   async_id_fields[kExecutionAsyncId] = 0;
   async_id_fields[kTriggerAsyncId] = 0;
   async_hook_fields[kStackLength] = 0;
+  if (async_hook_fields[kContextFrames] > 0)
+    clearContextFrames_();
 }
 
 
@@ -429,12 +474,14 @@ function triggerAsyncId() {
 module.exports = {
   executionAsyncId,
   triggerAsyncId,
+  getContextFrame,
+  setContextFrame,
   // Private API
   getHookArrays,
   symbols: {
     async_id_symbol, trigger_async_id_symbol,
     init_symbol, before_symbol, after_symbol, destroy_symbol,
-    promise_resolve_symbol, owner_symbol
+    promise_resolve_symbol, owner_symbol, context_frame_symbol
   },
   constants: {
     kInit, kBefore, kAfter, kDestroy, kTotals, kPromiseResolve
@@ -449,6 +496,7 @@ module.exports = {
   getOrSetAsyncId,
   getDefaultTriggerAsyncId,
   defaultTriggerAsyncIdScope,
+  captureContextFrame,
   initHooksExist,
   afterHooksExist,
   destroyHooksExist,
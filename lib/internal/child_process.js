@@ -54,7 +54,7 @@ const {
 const { SocketListSend, SocketListReceive } = SocketList;
 
 // Lazy loaded for startup performance.
-let StringDecoder;
+let channelSerialization;
 // Lazy loaded for startup performance and to allow monkey patching of
 // internalBinding('http_parser').HTTPParser.
 let freeParser;
@@ -311,6 +311,11 @@ ChildProcess.prototype.spawn = function(options) {
     throw new ERR_INVALID_ARG_TYPE('options', 'Object', options);
   }
 
+  const serialization = options.serialization || 'json';
+  if (serialization !== 'json' && serialization !== 'advanced') {
+    throw new ERR_INVALID_OPT_VALUE('options.serialization', serialization);
+  }
+
   // If no `stdio` option was given - use default
   var stdio = options.stdio || 'pipe';
 
@@ -331,6 +336,7 @@ ChildProcess.prototype.spawn = function(options) {
     }
 
     options.envPairs.push('NODE_CHANNEL_FD=' + ipcFd);
+    options.envPairs.push('NODE_CHANNEL_SERIALIZATION_MODE=' + serialization);
   }
 
   validateString(options.file, 'options.file');
@@ -411,7 +417,7 @@ ChildProcess.prototype.spawn = function(options) {
     this.stdio.push(stdio[i].socket === undefined ? null : stdio[i].socket);
 
   // Add .send() method and start listening for IPC data
-  if (ipc !== undefined) setupChannel(this, ipc);
+  if (ipc !== undefined) setupChannel(this, ipc, serialization);
 
   return err;
 };
@@ -478,7 +484,7 @@ class Control extends EventEmitter {
   }
 }
 
-function setupChannel(target, channel) {
+function setupChannel(target, channel, serializationMode) {
   target.channel = channel;
 
   // _channel can be deprecated in version 8
@@ -493,12 +499,16 @@ function setupChannel(target, channel) {
 
   const control = new Control(channel);
 
-  if (StringDecoder === undefined)
-    StringDecoder = require('string_decoder').StringDecoder;
-  var decoder = new StringDecoder('utf8');
-  var jsonBuffer = '';
+  if (channelSerialization === undefined)
+    channelSerialization = require('internal/child_process/serialization');
+  const {
+    initMessageChannel,
+    parseChannelMessages,
+    writeChannelMessage
+  } = channelSerialization[serializationMode || 'json'];
+
   var pendingHandle = null;
-  channel.buffering = false;
+  initMessageChannel(channel);
   channel.pendingHandle = null;
   channel.onread = function(arrayBuffer) {
     const recvHandle = channel.pendingHandle;
@@ -506,25 +516,11 @@ function setupChannel(target, channel) {
     if (arrayBuffer) {
       const nread = streamBaseState[kReadBytesOrError];
       const offset = streamBaseState[kArrayBufferOffset];
-      const pool = new Uint8Array(arrayBuffer, offset, nread);
+      const pool = Buffer.from(arrayBuffer, offset, nread);
       if (recvHandle)
         pendingHandle = recvHandle;
 
-      // Linebreak is used as a message end sign
-      var chunks = decoder.write(pool).split('\n');
-      var numCompleteChunks = chunks.length - 1;
-      // Last line does not have trailing linebreak
-      var incompleteChunk = chunks[numCompleteChunks];
-      if (numCompleteChunks === 0) {
-        jsonBuffer += incompleteChunk;
-        this.buffering = jsonBuffer.length !== 0;
-        return;
-      }
-      chunks[0] = jsonBuffer + chunks[0];
-
-      for (var i = 0; i < numCompleteChunks; i++) {
-        var message = JSON.parse(chunks[i]);
-
+      for (const message of parseChannelMessages(channel, pool)) {
         // There will be at most one NODE_HANDLE message in every chunk we
         // read because SCM_RIGHTS messages don't get coalesced. Make sure
         // that we deliver the handle with the right message however.
@@ -539,9 +535,6 @@ function setupChannel(target, channel) {
           handleMessage(message, undefined, false);
         }
       }
-      jsonBuffer = incompleteChunk;
-      this.buffering = jsonBuffer.length !== 0;
-
     } else {
       this.buffering = false;
       target.disconnect();
@@ -726,8 +719,7 @@ function setupChannel(target, channel) {
 
     var req = new WriteWrap();
 
-    var string = JSON.stringify(message) + '\n';
-    var err = channel.writeUtf8String(req, string, handle);
+    var err = writeChannelMessage(channel, req, message, handle);
     var wasAsyncWrite = streamBaseState[kLastWriteWasAsync];
 
     if (err === 0) {
@@ -0,0 +1,151 @@
+'use strict';
+
+// The ways messages can be framed on an IPC channel:
+//
+// - 'json': newline-delimited JSON. This is the default.
+// - 'advanced': the V8 serialization format, prefixed with its length as a
+//   big-endian uint32. It supports everything the HTML structured clone
+//   algorithm does, and skips the round trip through JSON strings.
+//
+// Both of them parse all of the messages that are complete after a read in
+// one go.
+
+const { Buffer } = require('buffer');
+const { isArrayBufferView } = require('internal/util/types');
+const assert = require('assert');
+
+// Lazy loaded for startup performance.
+let StringDecoder;
+let ChildProcessSerializer;
+let ChildProcessDeserializer;
+
+const kHeaderSize = 4;
+const kMessageBuffer = Symbol('kMessageBuffer');
+const kJSONBuffer = Symbol('kJSONBuffer');
+const kStringDecoder = Symbol('kStringDecoder');
+
+// Host objects other than ArrayBufferViews, i.e. those of native classes, are
+// sent as plain objects, like JSON.stringify() would, instead of throwing.
+const kArrayBufferViewTag = 0;
+const kNotArrayBufferViewTag = 1;
+
+function lazySerializers() {
+  if (ChildProcessSerializer !== undefined)
+    return;
+
+  const { DefaultSerializer, DefaultDeserializer } = require('v8');
+
+  ChildProcessSerializer = class ChildProcessSerializer
+    extends DefaultSerializer {
+    _writeHostObject(object) {
+      if (isArrayBufferView(object)) {
+        this.writeUint32(kArrayBufferViewTag);
+        return super._writeHostObject(object);
+      }
+      this.writeUint32(kNotArrayBufferViewTag);
+      this.writeValue(Object.assign({}, object));
+    }
+  };
+
+  ChildProcessDeserializer = class ChildProcessDeserializer
+    extends DefaultDeserializer {
+    _readHostObject() {
+      const tag = this.readUint32();
+      if (tag === kArrayBufferViewTag)
+        return super._readHostObject();
+
+      assert.strictEqual(tag, kNotArrayBufferViewTag);
+      return this.readValue();
+    }
+  };
+}
+
+const advanced = {
+  initMessageChannel(channel) {
+    lazySerializers();
+    channel[kMessageBuffer] = null;
+    channel.buffering = false;
+  },
+
+  * parseChannelMessages(channel, readData) {
+    if (readData.length === 0)
+      return;
+
+    // Only the tail of the previous read that didn't make up a whole message
+    // has to be joined with this one; messages are deserialized straight from
+    // the read buffer otherwise.
+    let buffer = channel[kMessageBuffer] === null ?
+      readData : Buffer.concat([channel[kMessageBuffer], readData]);
+    let offset = 0;
+    while (buffer.length - offset >= kHeaderSize) {
+      const size = buffer.readUInt32BE(offset);
+      const end = offset + kHeaderSize + size;
+      if (end > buffer.length)
+        break;
+
+      const deserializer = new ChildProcessDeserializer(
+        buffer.subarray(offset + kHeaderSize, end));
+      offset = end;
+      deserializer.readHeader();
+      yield deserializer.readValue();
+    }
+
+    // Every read gets a fresh buffer, so the tail can simply be kept around.
+    channel[kMessageBuffer] =
+      offset === buffer.length ? null : buffer.subarray(offset);
+    channel.buffering = channel[kMessageBuffer] !== null;
+  },
+
+  writeChannelMessage(channel, req, message, handle) {
+    const ser = new ChildProcessSerializer();
+    // Leave room for the length, so that the message goes out in one buffer.
+    ser.writeRawBytes(Buffer.alloc(kHeaderSize));
+    ser.writeHeader();
+    ser.writeValue(message);
+    const buffer = ser.releaseBuffer();
+    buffer.writeUInt32BE(buffer.length - kHeaderSize, 0);
+    req.buffer = buffer;
+    return channel.writeBuffer(req, buffer, handle);
+  }
+};
+
+const json = {
+  initMessageChannel(channel) {
+    channel[kJSONBuffer] = '';
+    channel[kStringDecoder] = undefined;
+    channel.buffering = false;
+  },
+
+  * parseChannelMessages(channel, readData) {
+    if (readData.length === 0)
+      return;
+
+    if (channel[kStringDecoder] === undefined) {
+      if (StringDecoder === undefined)
+        StringDecoder = require('string_decoder').StringDecoder;
+      channel[kStringDecoder] = new StringDecoder('utf8');
+    }
+
+    // Linebreak is used as a message end sign
+    const chunks = channel[kStringDecoder].write(readData).split('\n');
+    const numCompleteChunks = chunks.length - 1;
+    // Last line does not have trailing linebreak
+    const incompleteChunk = chunks[numCompleteChunks];
+    if (numCompleteChunks === 0) {
+      channel[kJSONBuffer] += incompleteChunk;
+    } else {
+      chunks[0] = channel[kJSONBuffer] + chunks[0];
+      for (var i = 0; i < numCompleteChunks; i++)
+        yield JSON.parse(chunks[i]);
+      channel[kJSONBuffer] = incompleteChunk;
+    }
+    channel.buffering = channel[kJSONBuffer].length !== 0;
+  },
+
+  writeChannelMessage(channel, req, message, handle) {
+    const string = JSON.stringify(message) + '\n';
+    return channel.writeUtf8String(req, string, handle);
+  }
+};
+
+module.exports = { advanced, json };
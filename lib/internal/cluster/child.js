@@ -93,14 +93,24 @@ cluster._getServer = function(obj, options, cb) {
       rr(reply, indexesKey, cb);              // Round-robin.
   });
 
+  reportListening(obj, message);
+};
+
+// Servers that bind a socket of their own, see the `reusePort` option of
+// `net.Server#listen()`, only tell the master once they are listening.
+cluster._reportListening = function(obj, options) {
+  reportListening(obj, util._extend({}, options));
+};
+
+function reportListening(obj, message) {
   obj.once('listening', () => {
     cluster.worker.state = 'listening';
     const address = obj.address();
     message.act = 'listening';
-    message.port = address && address.port || options.port;
+    message.port = address && address.port || message.port;
     send(message);
   });
-};
+}
 
 // Shared listen socket.
 function shared(message, handle, indexesKey, cb) {
@@ -140,7 +140,8 @@ function createWorkerProcess(id, env) {
     execArgv: execArgv,
     stdio: cluster.settings.stdio,
     gid: cluster.settings.gid,
-    uid: cluster.settings.uid
+    uid: cluster.settings.uid,
+    serialization: cluster.settings.serialization
   });
 }
 
@@ -3,9 +3,7 @@
 // The Console constructor is not actually used to construct the global
 // console. It's exported for backwards compatibility.
 
-const { trace } = 'chakracore' in process.versions ?
-  { trace: () => {} } :
-  internalBinding('trace_events');
+const { trace } = internalBinding('trace_events');
 const {
   isStackOverflowError,
   codes: {
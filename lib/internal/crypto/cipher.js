@@ -8,21 +8,27 @@ const {
 const {
   ERR_CRYPTO_INVALID_STATE,
   ERR_INVALID_ARG_TYPE,
-  ERR_INVALID_OPT_VALUE
+  ERR_INVALID_ARG_VALUE,
+  ERR_INVALID_CALLBACK,
+  ERR_INVALID_OPT_VALUE,
+  ERR_OUT_OF_RANGE
 } = require('internal/errors').codes;
 const { validateString } = require('internal/validators');
+const { AsyncWrap, Providers } = internalBinding('async_wrap');
 
 const {
   getDefaultEncoding,
   kHandle,
   legacyNativeHandle,
-  toBuf
+  toBuf,
+  validateArrayBufferView
 } = require('internal/crypto/util');
 
 const { isArrayBufferView } = require('internal/util/types');
 
 const {
   CipherBase,
+  CipherContext: _CipherContext,
   privateDecrypt: _privateDecrypt,
   privateEncrypt: _privateEncrypt,
   publicDecrypt: _publicDecrypt,
@@ -281,8 +287,126 @@ inherits(Decipheriv, LazyTransform);
 addCipherPrototypeFunctions(Decipheriv);
 legacyNativeHandle(Decipheriv);
 
+const kAuthTagLength = Symbol('kAuthTagLength');
+const kEmptyBuffer = new Uint8Array(0);
+const kMaxInt32 = 2 ** 31 - 1;
+
+// Batches are split like in crypto.verifyBatch(): into at most this many
+// jobs, the default size of libuv's threadpool...
+const kCipherBatchJobs = 4;
+// ...with at least this many messages per job.
+const kMinCipherBatchSlice = 64;
+
+function validateOutputView(buffer, name) {
+  if (!isArrayBufferView(buffer)) {
+    throw new ERR_INVALID_ARG_TYPE(name, ['Buffer', 'TypedArray', 'DataView'],
+                                   buffer);
+  }
+  return buffer;
+}
+
+// Returns the message as the [iv, input, output, authTag, aad] views that
+// the native side expects, for both directions.
+function validateMessage(context, encrypt, message, prefix) {
+  const iv = validateArrayBufferView(message.iv, `${prefix}iv`);
+  const input = validateArrayBufferView(message.input, `${prefix}input`);
+  const output = validateOutputView(message.output, `${prefix}output`);
+  const authTag = encrypt ?
+    validateOutputView(message.authTag, `${prefix}authTag`) :
+    validateArrayBufferView(message.authTag, `${prefix}authTag`);
+  const aad = message.aad === undefined ?
+    kEmptyBuffer : validateArrayBufferView(message.aad, `${prefix}aad`);
+
+  if (input.byteLength > kMaxInt32) {
+    throw new ERR_OUT_OF_RANGE(`${prefix}input.byteLength`, `<= ${kMaxInt32}`,
+                               input.byteLength);
+  }
+  if (output.byteLength < input.byteLength) {
+    throw new ERR_INVALID_ARG_VALUE(`${prefix}output`, output,
+                                    'must be at least as long as the input');
+  }
+  if (authTag.byteLength !== context[kAuthTagLength]) {
+    throw new ERR_INVALID_ARG_VALUE(
+      `${prefix}authTag`, authTag,
+      `must be ${context[kAuthTagLength]} bytes long`);
+  }
+  return [iv, input, output, authTag, aad];
+}
+
+class CipherContext {
+  constructor(cipher, key, options) {
+    validateString(cipher, 'cipher');
+    key = validateArrayBufferView(key, 'key');
+    const authTagLength = getUIntOption(options, 'authTagLength');
+    this[kHandle] = new _CipherContext(cipher, key, authTagLength);
+    this[kAuthTagLength] = this[kHandle].getAuthTagLength();
+  }
+
+  get authTagLength() {
+    return this[kAuthTagLength];
+  }
+
+  encryptInto(iv, input, output, authTag, aad) {
+    const args = validateMessage(this, true,
+                                 { iv, input, output, authTag, aad }, '');
+    this[kHandle].encryptInto(...args);
+    return args[1].byteLength;
+  }
+
+  decryptInto(iv, input, authTag, output, aad) {
+    const args = validateMessage(this, false,
+                                 { iv, input, output, authTag, aad }, '');
+    this[kHandle].decryptInto(...args);
+    return args[1].byteLength;
+  }
+
+  encryptBatch(messages, callback) {
+    runBatch(this, true, messages, callback);
+  }
+
+  decryptBatch(messages, callback) {
+    runBatch(this, false, messages, callback);
+  }
+}
+
+function runBatch(context, encrypt, messages, callback) {
+  if (typeof callback !== 'function')
+    throw new ERR_INVALID_CALLBACK();
+  if (!Array.isArray(messages))
+    throw new ERR_INVALID_ARG_TYPE('messages', 'Array', messages);
+
+  const views = messages.map((message, i) => {
+    return validateMessage(context, encrypt, message, `messages[${i}].`);
+  });
+
+  const results = new Array(views.length);
+  if (views.length === 0) {
+    process.nextTick(callback, null, results);
+    return;
+  }
+
+  const sliceLength = Math.max(kMinCipherBatchSlice,
+                               Math.ceil(views.length / kCipherBatchJobs));
+  let pending = Math.ceil(views.length / sliceLength);
+  for (let start = 0; start < views.length; start += sliceLength) {
+    const slice = views.slice(start, start + sliceLength);
+    const out = new Uint8Array(slice.length);
+    const wrap = new AsyncWrap(Providers.CIPHERBATCHREQUEST);
+    // Retains the buffers while the request is in flight.
+    wrap.buffers = [0, 1, 2, 3, 4].map((i) => slice.map((view) => view[i]));
+    wrap.ondone = () => {
+      for (var i = 0; i < out.length; i++)
+        results[start + i] = out[i] === 1;
+      if (--pending === 0)
+        callback.call(wrap, null, results);
+    };
+    context[kHandle].runBatch(encrypt, ...wrap.buffers, out, wrap);
+  }
+}
+
 module.exports = {
   Cipher,
+  CipherContext,
   Cipheriv,
   Decipher,
   Decipheriv,
@@ -2,14 +2,17 @@
 
 const {
   Hash: _Hash,
-  Hmac: _Hmac
+  Hmac: _Hmac,
+  hashBatch: _hashBatch
 } = process.binding('crypto');
+const { AsyncWrap, Providers } = internalBinding('async_wrap');
 
 const {
   getDefaultEncoding,
   kHandle,
   legacyNativeHandle,
-  toBuf
+  toBuf,
+  validateArrayBufferView
 } = require('internal/crypto/util');
 
 const { Buffer } = require('buffer');
@@ -18,7 +21,10 @@ const {
   ERR_CRYPTO_HASH_DIGEST_NO_UTF16,
   ERR_CRYPTO_HASH_FINALIZED,
   ERR_CRYPTO_HASH_UPDATE_FAILED,
-  ERR_INVALID_ARG_TYPE
+  ERR_CRYPTO_INVALID_DIGEST,
+  ERR_INVALID_ARG_TYPE,
+  ERR_INVALID_ARG_VALUE,
+  ERR_INVALID_CALLBACK
 } = require('internal/errors').codes;
 const { validateString } = require('internal/validators');
 const { inherits } = require('util');
@@ -126,7 +132,58 @@ Hmac.prototype._transform = Hash.prototype._transform;
 
 legacyNativeHandle(Hmac);
 
+
+function hash(algorithm, data, callback) {
+  validateString(algorithm, 'algorithm');
+  hashBatch(algorithm, undefined, data, callback);
+}
+
+function hmac(algorithm, key, data, callback) {
+  validateString(algorithm, 'algorithm');
+  let keys;
+  if (Array.isArray(key)) {
+    if (!Array.isArray(data) || key.length !== data.length) {
+      throw new ERR_INVALID_ARG_VALUE('key', key,
+                                      'must have the same length as data');
+    }
+    keys = key.map((k, i) => validateArrayBufferView(k, `key[${i}]`));
+  } else {
+    keys = [validateArrayBufferView(key, 'key')];
+  }
+  hashBatch(algorithm, keys, data, callback);
+}
+
+// Digests `data`, or every element of it if it is an array, in the thread
+// pool so that large inputs don't block the event loop, and many small ones
+// only cost a single trip.
+function hashBatch(algorithm, keys, data, callback) {
+  if (typeof callback !== 'function')
+    throw new ERR_INVALID_CALLBACK();
+
+  const batch = Array.isArray(data);
+  const inputs = batch ?
+    data.map((d, i) => validateArrayBufferView(d, `data[${i}]`)) :
+    [validateArrayBufferView(data, 'data')];
+  const encoding = getDefaultEncoding();
+
+  const wrap = new AsyncWrap(Providers.HASHREQUEST);
+  // Retains the keys and inputs while the request is in flight.
+  wrap.keys = keys;
+  wrap.inputs = inputs;
+  wrap.ondone = (err, digests) => {
+    if (err) return callback.call(wrap, err);
+    if (encoding !== 'buffer')
+      digests = digests.map((digest) => digest.toString(encoding));
+    callback.call(wrap, null, batch ? digests : digests[0]);
+  };
+
+  if (_hashBatch(algorithm, keys, inputs, wrap) === -1)
+    throw new ERR_CRYPTO_INVALID_DIGEST(algorithm);
+}
+
 module.exports = {
   Hash,
-  Hmac
+  Hmac,
+  hash,
+  hmac
 };
@@ -2,7 +2,10 @@
 
 const { AsyncWrap, Providers } = internalBinding('async_wrap');
 const { Buffer, kMaxLength } = require('buffer');
-const { randomBytes: _randomBytes } = internalBinding('crypto');
+const {
+  randomBytes: _randomBytes,
+  RandomPool
+} = internalBinding('crypto');
 const {
   ERR_INVALID_ARG_TYPE,
   ERR_INVALID_CALLBACK,
@@ -14,6 +17,18 @@ const { isArrayBufferView } = require('internal/util/types');
 const kMaxUint32 = 2 ** 32 - 1;
 const kMaxPossibleLength = Math.min(kMaxLength, kMaxUint32);
 
+// Synchronous requests up to this size are served from bytes generated ahead
+// of time, which saves a call into OpenSSL for each of them.
+// Keep in sync with RandomPool::kMaxRequestSize.
+const kMaxPooledSize = 256;
+let randomPool;
+
+function getRandomPool() {
+  if (randomPool === undefined)
+    randomPool = new RandomPool();
+  return randomPool;
+}
+
 function assertOffset(offset, elementSize, length) {
   validateNumber(offset, 'offset');
   offset *= elementSize;
@@ -113,7 +128,15 @@ function randomFill(buf, offset, size, cb) {
   _randomBytes(buf, offset, size, wrap);
 }
 
+function randomUUID() {
+  return getRandomPool().randomUUID();
+}
+
 function handleError(buf, offset, size) {
+  if (size <= kMaxPooledSize) {
+    getRandomPool().fill(buf, offset, size);
+    return buf;
+  }
   const ex = _randomBytes(buf, offset, size);
   if (ex) throw ex;
   return buf;
@@ -122,5 +145,6 @@ function handleError(buf, offset, size) {
 module.exports = {
   randomBytes,
   randomFill,
-  randomFillSync
+  randomFillSync,
+  randomUUID
 };
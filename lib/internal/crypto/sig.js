@@ -1,11 +1,20 @@
 'use strict';
 
 const {
+  ERR_CRYPTO_INVALID_DIGEST,
   ERR_CRYPTO_SIGN_KEY_REQUIRED,
+  ERR_INVALID_ARG_TYPE,
+  ERR_INVALID_ARG_VALUE,
+  ERR_INVALID_CALLBACK,
   ERR_INVALID_OPT_VALUE
 } = require('internal/errors').codes;
 const { validateString } = require('internal/validators');
-const { Sign: _Sign, Verify: _Verify } = internalBinding('crypto');
+const { AsyncWrap, Providers } = internalBinding('async_wrap');
+const {
+  Sign: _Sign,
+  Verify: _Verify,
+  verifyBatch: _verifyBatch
+} = internalBinding('crypto');
 const {
   RSA_PSS_SALTLEN_AUTO,
   RSA_PKCS1_PADDING
@@ -125,7 +134,66 @@ Verify.prototype.verify = function verify(options, signature, sigEncoding) {
 
 legacyNativeHandle(Verify);
 
+// Batches are split into at most this many jobs, the default size of
+// libuv's threadpool, so that they are verified in parallel...
+const kVerifyBatchJobs = 4;
+// ...unless they are so small that the extra jobs would cost more than they
+// save.
+const kMinVerifyBatchSlice = 64;
+
+function verifyBatch(algorithm, options, data, signatures, callback) {
+  validateString(algorithm, 'algorithm');
+  if (typeof callback !== 'function')
+    throw new ERR_INVALID_CALLBACK();
+  if (!Array.isArray(data))
+    throw new ERR_INVALID_ARG_TYPE('data', 'Array', data);
+  if (!Array.isArray(signatures) || signatures.length !== data.length) {
+    throw new ERR_INVALID_ARG_VALUE('signatures', signatures,
+                                    'must have the same length as data');
+  }
+
+  const key = validateArrayBufferView(options.key || options, 'key');
+  const rsaPadding = getPadding(options);
+  const pssSaltLength = getSaltLength(options);
+  const sigEncoding = getDefaultEncoding();
+  const inputs = data.map((d, i) => validateArrayBufferView(d, `data[${i}]`));
+  const sigs = signatures.map((signature, i) => {
+    return validateArrayBufferView(toBuf(signature, sigEncoding),
+                                   `signatures[${i}]`);
+  });
+
+  const results = new Array(inputs.length);
+  if (inputs.length === 0) {
+    process.nextTick(callback, null, results);
+    return;
+  }
+
+  const sliceLength = Math.max(kMinVerifyBatchSlice,
+                               Math.ceil(inputs.length / kVerifyBatchJobs));
+  let pending = Math.ceil(inputs.length / sliceLength);
+  for (let start = 0; start < inputs.length; start += sliceLength) {
+    const end = Math.min(start + sliceLength, inputs.length);
+    const out = new Uint8Array(end - start);
+    const wrap = new AsyncWrap(Providers.VERIFYREQUEST);
+    // Retains the inputs and signatures while the request is in flight.
+    wrap.inputs = inputs.slice(start, end);
+    wrap.signatures = sigs.slice(start, end);
+    wrap.ondone = () => {
+      for (var i = 0; i < out.length; i++)
+        results[start + i] = out[i] === 1;
+      if (--pending === 0)
+        callback.call(wrap, null, results);
+    };
+
+    const rc = _verifyBatch(algorithm, key, rsaPadding, pssSaltLength,
+                            wrap.inputs, wrap.signatures, out, wrap);
+    if (rc === -1)
+      throw new ERR_CRYPTO_INVALID_DIGEST(algorithm);
+  }
+}
+
 module.exports = {
   Sign,
-  Verify
+  Verify,
+  verifyBatch
 };
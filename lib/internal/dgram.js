@@ -22,7 +22,7 @@ function lookup6(lookup, address, callback) {
 const guessHandleType = TTYWrap.guessHandleType;
 
 
-function newHandle(type, lookup) {
+function newHandle(type, lookup, recvBatch) {
   if (lookup === undefined) {
     if (dns === undefined) {
       dns = require('dns');
@@ -34,18 +34,19 @@ function newHandle(type, lookup) {
   }
 
   if (type === 'udp4') {
-    const handle = new UDP();
+    const handle = new UDP(recvBatch === true);
 
     handle.lookup = lookup4.bind(handle, lookup);
     return handle;
   }
 
   if (type === 'udp6') {
-    const handle = new UDP();
+    const handle = new UDP(recvBatch === true);
 
     handle.lookup = lookup6.bind(handle, lookup);
     handle.bind = handle.bind6;
     handle.send = handle.send6;
+    handle.sendBatch = handle.sendBatch6;
     return handle;
   }
 
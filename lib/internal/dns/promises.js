@@ -4,11 +4,11 @@ const {
   Resolver: CallbackResolver,
   validateHints,
   emitInvalidHostnameWarning,
+  lookupAddresses,
 } = require('internal/dns/utils');
 const { codes, dnsException } = require('internal/errors');
 const { isIP, isIPv4, isLegalPort } = require('internal/net');
 const {
-  getaddrinfo,
   getnameinfo,
   ChannelWrap,
   GetAddrInfoReqWrap,
@@ -85,7 +85,7 @@ function createLookupPromise(family, hostname, all, hints, verbatim) {
     req.resolve = resolve;
     req.reject = reject;
 
-    const err = getaddrinfo(req, hostname, family, hints, verbatim);
+    const err = lookupAddresses(req, hostname, family, hints, verbatim);
 
     if (err) {
       reject(dnsException(err, 'getaddrinfo', hostname));
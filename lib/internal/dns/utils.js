@@ -3,6 +3,8 @@ const errors = require('internal/errors');
 const { isIP } = require('internal/net');
 const {
   ChannelWrap,
+  LookupCache,
+  getaddrinfo,
   strerror,
   AI_ADDRCONFIG,
   AI_V4MAPPED
@@ -16,6 +18,7 @@ const {
   ERR_INVALID_IP_ADDRESS,
   ERR_INVALID_OPT_VALUE
 } = errors.codes;
+const { validateUint32 } = require('internal/validators');
 
 // Resolver instances correspond 1:1 to c-ares channels.
 class Resolver {
@@ -140,6 +143,54 @@ function validateHints(hints) {
   }
 }
 
+let lookupCache = null;
+let lookupThroughResolver = false;
+
+function setLookupCache(options) {
+  if (options === false || options === null) {
+    lookupCache = null;
+    lookupThroughResolver = false;
+    return;
+  }
+  if (typeof options !== 'object')
+    throw new ERR_INVALID_ARG_TYPE('options', ['Object', 'false'], options);
+
+  const {
+    maxTtl = 30000,
+    negativeTtl = 1000,
+    maxEntries = 1000,
+    resolver = false
+  } = options;
+  validateUint32(maxTtl, 'options.maxTtl');
+  validateUint32(negativeTtl, 'options.negativeTtl');
+  validateUint32(maxEntries, 'options.maxEntries', true);
+  if (typeof resolver !== 'boolean')
+    throw new ERR_INVALID_ARG_TYPE('options.resolver', 'boolean', resolver);
+
+  lookupCache = new LookupCache(maxTtl, negativeTtl, maxEntries);
+  lookupThroughResolver = resolver;
+}
+
+function onCachedLookup(req, addresses) {
+  req.oncomplete(0, addresses);
+}
+
+// Starts looking up `hostname` for dns.lookup() and dns.promises.lookup(),
+// through the lookup cache when there is one. Returns an error code, or 0 if
+// req.oncomplete() is going to be called.
+function lookupAddresses(req, hostname, family, hints, verbatim) {
+  if (lookupCache === null)
+    return getaddrinfo(req, hostname, family, hints, verbatim);
+
+  const channel = lookupThroughResolver ? defaultResolver._handle : undefined;
+  const result =
+    lookupCache.lookup(req, hostname, family, hints, verbatim, channel);
+  if (typeof result === 'number')
+    return result;
+  process.nextTick(onCachedLookup, req, result);
+  return 0;
+}
+
 let invalidHostnameWarningEmitted = false;
 
 function emitInvalidHostnameWarning(hostname) {
@@ -162,4 +213,6 @@ module.exports = {
   validateHints,
   Resolver,
   emitInvalidHostnameWarning,
+  lookupAddresses,
+  setLookupCache,
 };
@@ -399,7 +399,7 @@ function makeTextDecoderICU() {
         err.errno = ret;
         throw err;
       }
-      return ret.toString('ucs2');
+      return ret;
     }
   }
 
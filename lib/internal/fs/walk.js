@@ -0,0 +1,130 @@
+'use strict';
+
+const {
+  DirectoryWalker,
+  kFsStatsFieldsNumber
+} = internalBinding('fs');
+const {
+  ERR_INVALID_ARG_TYPE,
+  ERR_INVALID_CALLBACK
+} = require('internal/errors').codes;
+const {
+  Dirent,
+  getOptions,
+  getStatsFromBinding,
+  validatePath
+} = require('internal/fs/utils');
+const { validateUint32 } = require('internal/validators');
+const { toPathIfFileURL } = require('internal/url');
+const pathModule = require('path');
+const { owner_symbol } = require('internal/async_hooks').symbols;
+
+const kHandle = Symbol('kHandle');
+const kReading = Symbol('kReading');
+const kClosed = Symbol('kClosed');
+const kQueue = Symbol('kQueue');
+
+// An entry of the tree. `name` is the last component of `path`, which is
+// relative to the root of the walk.
+class WalkEntry extends Dirent {
+  constructor(path, type, stats) {
+    super(pathModule.basename(path), type);
+    this.path = path;
+    if (stats !== undefined)
+      this.stats = stats;
+  }
+}
+
+class Walker {
+  constructor(path, options) {
+    options = getOptions(options, {});
+    path = toPathIfFileURL(path);
+    validatePath(path);
+
+    const withStats = options.stats === undefined ? false : options.stats;
+    if (typeof withStats !== 'boolean')
+      throw new ERR_INVALID_ARG_TYPE('options.stats', 'boolean', withStats);
+    const chunkSize =
+      options.chunkSize === undefined ? 1024 : options.chunkSize;
+    validateUint32(chunkSize, 'options.chunkSize', true);
+
+    this[kHandle] = new DirectoryWalker(pathModule.toNamespacedPath(path),
+                                        withStats, chunkSize);
+    this[kHandle][owner_symbol] = this;
+    this[kReading] = false;
+    this[kClosed] = false;
+    this[kQueue] = [];
+  }
+
+  // Calls back with the next chunk of entries, or null once the whole tree
+  // has been walked. Returns a promise when no callback is given.
+  read(callback) {
+    if (callback === undefined) {
+      return new Promise((resolve, reject) => {
+        this.read((err, entries) => {
+          if (err)
+            reject(err);
+          else
+            resolve(entries);
+        });
+      });
+    }
+    if (typeof callback !== 'function')
+      throw new ERR_INVALID_CALLBACK();
+
+    if (this[kReading]) {
+      this[kQueue].push(callback);
+      return;
+    }
+    if (this[kHandle] === null) {
+      process.nextTick(callback, null, null);
+      return;
+    }
+
+    this[kReading] = true;
+    this[kHandle].oncomplete = (err, names, types, stats) => {
+      this[kReading] = false;
+      let entries = null;
+      if (err || names === null || this[kClosed])
+        this[kHandle] = null;
+      if (!err && names !== null) {
+        entries = new Array(names.length);
+        for (let i = 0; i < names.length; i++) {
+          const entryStats = stats === undefined ? undefined :
+            getStatsFromBinding(stats, i * kFsStatsFieldsNumber);
+          entries[i] = new WalkEntry(names[i], types[i], entryStats);
+        }
+      }
+      if (this[kQueue].length > 0)
+        this.read(this[kQueue].shift());
+      callback(err, entries);
+    };
+    this[kHandle].read();
+  }
+
+  // Stops the walk. A read in progress still delivers its entries, and reads
+  // after it report the end of the tree.
+  close() {
+    this[kClosed] = true;
+    if (!this[kReading])
+      this[kHandle] = null;
+  }
+
+  async* [Symbol.asyncIterator]() {
+    let entries;
+    while ((entries = await this.read()) !== null) {
+      for (const entry of entries)
+        yield entry;
+    }
+  }
+}
+
+function walk(path, options) {
+  return new Walker(path, options);
+}
+
+module.exports = {
+  walk,
+  Walker,
+  WalkEntry
+};
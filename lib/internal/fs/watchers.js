@@ -131,6 +131,13 @@ function FSWatcher() {
       this.emit('change', eventType, filename);
     }
   };
+
+  // Recursive watches on Linux report the changes of each turn of the event
+  // loop at once. Stop if a listener closes the watcher.
+  this._handle.onchanges = (eventTypes, filenames) => {
+    for (var i = 0; i < eventTypes.length && this._handle !== null; i++)
+      this.emit('change', eventTypes[i], filenames[i]);
+  };
 }
 util.inherits(FSWatcher, EventEmitter);
 
@@ -213,10 +213,14 @@ function setupChildProcessIpcChannel() {
     const fd = parseInt(process.env.NODE_CHANNEL_FD, 10);
     assert(fd >= 0);
 
+    const serializationMode =
+      process.env.NODE_CHANNEL_SERIALIZATION_MODE || 'json';
+
     // Make sure it's not accidentally inherited by child processes.
     delete process.env.NODE_CHANNEL_FD;
+    delete process.env.NODE_CHANNEL_SERIALIZATION_MODE;
 
-    require('child_process')._forkChild(fd);
+    require('child_process')._forkChild(fd, serializationMode);
     assert(process.send);
   }
 }
@@ -6,6 +6,7 @@ function setupNextTick(_setupNextTick, _setupPromises) {
   const {
     getDefaultTriggerAsyncId,
     newAsyncId,
+    captureContextFrame,
     initHooksExist,
     destroyHooksExist,
     emitInit,
@@ -52,7 +53,7 @@ function setupNextTick(_setupNextTick, _setupPromises) {
     do {
       while (tock = queue.shift()) {
         const asyncId = tock[async_id_symbol];
-        emitBefore(asyncId, tock[trigger_async_id_symbol]);
+        emitBefore(asyncId, tock[trigger_async_id_symbol], tock);
         // emitDestroy() places the async_id_symbol into an asynchronous queue
         // that calls the destroy callback in the future. It's called before
         // calling tock.callback so destroy will be called even if the callback
@@ -90,6 +91,7 @@ function setupNextTick(_setupNextTick, _setupPromises) {
       const asyncId = newAsyncId();
       this[async_id_symbol] = asyncId;
       this[trigger_async_id_symbol] = triggerAsyncId;
+      captureContextFrame(this);
 
       if (initHooksExist()) {
         emitInit(asyncId,
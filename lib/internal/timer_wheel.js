@@ -0,0 +1,185 @@
+'use strict';
+
+// A hierarchical timing wheel for timers that do not need to be precise and
+// rarely share their duration with many others, like the idle timeouts of
+// sockets. Arming, re-arming and cancelling such a timer is a constant-time
+// linked list operation, regardless of how many different durations are in
+// use, instead of a TimersList in the PriorityQueue for every one of them. In
+// exchange, the timers only fire on kTick millisecond boundaries, so they can
+// be up to kTick - 1 milliseconds late. They never fire early.
+//
+// There are kLevels levels of kSlots slots each. A slot of level 0 holds the
+// timers of a single tick, a slot of level n those of kSlots ** n ticks. A
+// timer is linked into the lowest level that reaches its tick, and moves down
+// once the wheel reaches the first tick of its slot.
+//
+// Each level keeps a bitmap of its slots that may hold timers, so that the
+// wheel can jump straight to the next tick that has any work instead of
+// stepping through every tick in between. Timers are unlinked outside of the
+// wheel, by unenroll(), so a bit can be stale; it is cleared when the search
+// finds its slot empty.
+
+const L = require('internal/linkedlist');
+
+const kTick = 32;
+const kSlots = 64;
+const kSlotMask = kSlots - 1;
+// kTick * kSlots ** kLevels is larger than TIMEOUT_MAX.
+const kLevels = 5;
+
+function WheelSlot() {
+  L.init(this);
+}
+
+function expiryTick(timer) {
+  return Math.ceil((timer._idleStart + timer._idleTimeout) / kTick);
+}
+
+function lowestBit(word) {
+  return 31 - Math.clz32(word & -word);
+}
+
+class TimerWheel {
+  constructor() {
+    // The last tick that has been processed.
+    this.tick = 0;
+    this.slots = new Array(kLevels * kSlots);
+    for (var i = 0; i < this.slots.length; i++)
+      this.slots[i] = new WheelSlot();
+    // Two 32 bit words of the slot bitmap per level.
+    this.occupied = new Uint32Array(kLevels * 2);
+    // Timers that are due, oldest first.
+    this.due = new WheelSlot();
+
+    // lib/timers.js queues the wheel along with its TimersLists.
+    this.expiry = Infinity;
+    this.id = 0;
+    this.priorityQueuePosition = null;
+  }
+
+  // Only valid while the wheel is empty.
+  reset(now) {
+    this.tick = Math.floor(now / kTick);
+  }
+
+  // Links `timer` into the wheel according to its _idleStart and
+  // _idleTimeout, or moves it if it is in there already. Returns the time at
+  // which the wheel needs to be advanced for it.
+  insert(timer) {
+    const tick = Math.max(expiryTick(timer), this.tick + 1);
+    return this.link(timer, tick) * kTick;
+  }
+
+  // Moves the timers that are due at `now` to this.due.
+  advance(now) {
+    const target = Math.floor(now / kTick);
+    while (this.tick < target) {
+      const tick = this.nextTick();
+      if (tick > target) {
+        // Nothing to do up to target, and no slot is passed over.
+        this.tick = target;
+        break;
+      }
+
+      this.tick = tick;
+      let span = kSlots;
+      for (var level = 1; level < kLevels && tick % span === 0; level++) {
+        this.cascade(level, (tick / span) & kSlotMask);
+        span *= kSlots;
+      }
+
+      const index = tick & kSlotMask;
+      const slot = this.slots[index];
+      var timer;
+      while ((timer = L.peek(slot)) !== null)
+        L.append(this.due, timer);
+      this.clearOccupied(0, index);
+    }
+  }
+
+  // Returns the time at which the wheel needs to be advanced next, or
+  // Infinity if it is empty.
+  nextExpiry() {
+    if (!L.isEmpty(this.due))
+      return this.tick * kTick;
+    return this.nextTick() * kTick;
+  }
+
+  // Returns the first tick after this.tick at which a slot is due, or
+  // Infinity if the wheel is empty. Timers on higher levels need to move down
+  // before they are due, which can be earlier than the first non-empty slot
+  // of a lower level.
+  nextTick() {
+    let next = Infinity;
+    let span = 1;
+    for (var level = 0; level < kLevels; level++) {
+      const base = Math.floor(this.tick / span) + 1;
+      const start = base & kSlotMask;
+      const index = this.nextOccupied(level, start);
+      if (index !== -1)
+        next = Math.min(next, (base + ((index - start) & kSlotMask)) * span);
+      span *= kSlots;
+    }
+    return next;
+  }
+
+  // Returns the index of the first non-empty slot of `level` at or after
+  // `start`, wrapping around, or -1 if all of them are empty.
+  nextOccupied(level, start) {
+    for (;;) {
+      const index = this.scanOccupied(level, start);
+      if (index === -1 || !L.isEmpty(this.slots[level * kSlots + index]))
+        return index;
+      this.clearOccupied(level, index);
+    }
+  }
+
+  scanOccupied(level, start) {
+    const word = start >>> 5;
+    const other = word ^ 1;
+    const mask = -1 << (start & 31);
+    let bits = this.occupied[level * 2 + word] & mask;
+    if (bits !== 0)
+      return (word << 5) + lowestBit(bits);
+    bits = this.occupied[level * 2 + other];
+    if (bits !== 0)
+      return (other << 5) + lowestBit(bits);
+    bits = this.occupied[level * 2 + word] & ~mask;
+    if (bits !== 0)
+      return (word << 5) + lowestBit(bits);
+    return -1;
+  }
+
+  clearOccupied(level, index) {
+    this.occupied[level * 2 + (index >>> 5)] &= ~(1 << (index & 31));
+  }
+
+  link(timer, tick) {
+    const delta = tick - this.tick;
+    let level = 0;
+    let span = 1;
+    while (delta >= span * kSlots) {
+      level++;
+      span *= kSlots;
+    }
+    const index = (tick / span) & kSlotMask;
+    L.append(this.slots[level * kSlots + index], timer);
+    this.occupied[level * 2 + (index >>> 5)] |= 1 << (index & 31);
+    return level === 0 ? tick : Math.floor(tick / span) * span;
+  }
+
+  cascade(level, index) {
+    const slot = this.slots[level * kSlots + index];
+    this.clearOccupied(level, index);
+    var timer;
+    while ((timer = L.peek(slot)) !== null) {
+      const tick = expiryTick(timer);
+      if (tick <= this.tick)
+        L.append(this.due, timer);
+      else
+        this.link(timer, tick);
+    }
+  }
+}
+
+module.exports = TimerWheel;
@@ -3,6 +3,7 @@
 const {
   getDefaultTriggerAsyncId,
   newAsyncId,
+  captureContextFrame,
   initHooksExist,
   emitInit
 } = require('internal/async_hooks');
@@ -47,6 +48,7 @@ function initAsyncResource(resource, type) {
   const asyncId = resource[async_id_symbol] = newAsyncId();
   const triggerAsyncId =
     resource[trigger_async_id_symbol] = getDefaultTriggerAsyncId();
+  captureContextFrame(resource);
   if (initHooksExist())
     emitInit(asyncId, type, triggerAsyncId, resource);
 }
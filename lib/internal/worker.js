@@ -8,9 +8,11 @@ const { Readable, Writable } = require('stream');
 const {
   ERR_INVALID_ARG_TYPE,
   ERR_WORKER_PATH,
+  ERR_WORKER_POOL_CLOSED,
   ERR_WORKER_UNSERIALIZABLE_ERROR,
   ERR_WORKER_UNSUPPORTED_EXTENSION,
 } = require('internal/errors').codes;
+const { validateUint32 } = require('internal/validators');
 
 const { MessagePort, MessageChannel } = internalBinding('messaging');
 const {
@@ -45,6 +47,12 @@ const kStdioWantsMoreDataCallback = Symbol('kStdioWantsMoreDataCallback');
 const kStartedReading = Symbol('kStartedReading');
 const kWaitingStreams = Symbol('kWaitingStreams');
 const kIncrementsPortRef = Symbol('kIncrementsPortRef');
+const kSpare = Symbol('kSpare');
+const kSpares = Symbol('kSpares');
+const kSize = Symbol('kSize');
+const kFill = Symbol('kFill');
+const kFillImmediate = Symbol('kFillImmediate');
+const kClosed = Symbol('kClosed');
 
 const debug = util.debuglog('worker');
 
@@ -271,9 +279,11 @@ class Worker extends EventEmitter {
       }
     }
 
+    // A thread from a WorkerPool that is already running and bootstrapped.
+    const spare = options[kSpare];
     const url = options.eval ? null : pathToFileURL(filename);
     // Set up the C++ handle for the worker, as well as some internal wiring.
-    this[kHandle] = new WorkerImpl(url);
+    this[kHandle] = spare !== undefined ? spare : new WorkerImpl(url);
     this[kHandle].onexit = (code) => this[kOnExit](code);
     this[kPort] = this[kHandle].messagePort;
     this[kPort].on('message', (data) => this[kOnMessage](data));
@@ -311,7 +321,10 @@ class Worker extends EventEmitter {
       hasStdin: !!options.stdin
     }, [port2]);
     // Actually start the new thread now that everything is in place.
-    this[kHandle].startThread();
+    if (spare === undefined)
+      this[kHandle].startThread();
+    else
+      this[kHandle].ref();
   }
 
   [kOnExit](code) {
@@ -422,6 +435,93 @@ class Worker extends EventEmitter {
   }
 }
 
+// Keeps `size` worker threads started ahead of time. Their isolate and
+// Environment exist and the bootstrap code has run, so they only wait for the
+// LOAD_SCRIPT message that the Worker constructor sends. Threads that are
+// handed out are replaced from a later event loop turn.
+class WorkerPool {
+  constructor(options = {}) {
+    if (options === null || typeof options !== 'object')
+      throw new ERR_INVALID_ARG_TYPE('options', 'Object', options);
+    const { size = 1 } = options;
+    validateUint32(size, 'options.size');
+
+    this[kSize] = size;
+    this[kSpares] = [];
+    this[kFillImmediate] = null;
+    this[kClosed] = false;
+    this[kFill]();
+  }
+
+  get size() {
+    return this[kSize];
+  }
+
+  get idle() {
+    return this[kSpares].length;
+  }
+
+  run(filename, options = {}) {
+    if (this[kClosed])
+      throw new ERR_WORKER_POOL_CLOSED();
+    if (options === null || typeof options !== 'object')
+      throw new ERR_INVALID_ARG_TYPE('options', 'Object', options);
+
+    const spare = this[kSpares].shift();
+    if (this[kFillImmediate] === null) {
+      this[kFillImmediate] = setImmediate(() => this[kFill]());
+      this[kFillImmediate].unref();
+    }
+    if (spare === undefined)
+      return new Worker(filename, options);
+
+    try {
+      return new Worker(filename, Object.assign({}, options, {
+        [kSpare]: spare
+      }));
+    } catch (err) {
+      // The thread may already have been wired up to the failed Worker.
+      spare.onexit = null;
+      spare.stopThread();
+      throw err;
+    }
+  }
+
+  close() {
+    this[kClosed] = true;
+    if (this[kFillImmediate] !== null) {
+      clearImmediate(this[kFillImmediate]);
+      this[kFillImmediate] = null;
+    }
+    const spares = this[kSpares];
+    this[kSpares] = [];
+    for (const spare of spares) {
+      spare.onexit = null;
+      spare.stopThread();
+    }
+  }
+
+  [kFill]() {
+    this[kFillImmediate] = null;
+    const spares = this[kSpares];
+    while (!this[kClosed] && spares.length < this[kSize]) {
+      const spare = new WorkerImpl(null);
+      spare.onexit = (code) => {
+        debug(`[${threadId}] spare worker ${spare.threadId} exited ` +
+              `with code ${code}`);
+        const index = spares.indexOf(spare);
+        if (index !== -1)
+          spares.splice(index, 1);
+      };
+      spare.startThread();
+      // Parked threads do not keep the event loop alive.
+      spare.unref();
+      spare.messagePort.unref();
+      spares.push(spare);
+    }
+  }
+}
+
 const workerStdio = {};
 if (!isMainThread) {
   const port = getEnvMessagePort();
@@ -527,6 +627,7 @@ module.exports = {
   MessageChannel,
   threadId,
   Worker,
+  WorkerPool,
   setupChild,
   isMainThread,
   workerStdio
@@ -97,8 +97,13 @@ const {
 
 function noop() {}
 
-function getFlags(ipv6Only) {
-  return ipv6Only === true ? TCPConstants.UV_TCP_IPV6ONLY : 0;
+function getFlags(options) {
+  var flags = 0;
+  if (options.ipv6Only === true)
+    flags |= TCPConstants.UV_TCP_IPV6ONLY;
+  if (options.reusePort === true)
+    flags |= TCPConstants.UV_TCP_REUSEPORT;
+  return flags;
 }
 
 function createHandle(fd, is_server) {
@@ -1194,12 +1199,13 @@ function createServerHandle(address, port, addressType, fd, flags) {
       if (err) {
         handle.close();
         // Fallback to ipv4
-        return createServerHandle('0.0.0.0', port);
+        return createServerHandle('0.0.0.0', port, 4, undefined, flags);
       }
     } else if (addressType === 6) {
       err = handle.bind6(address, port, flags);
     } else {
-      err = handle.bind(address, port);
+      err = handle.bind(address, port,
+                        flags & TCPConstants.UV_TCP_REUSEPORT);
     }
   }
 
@@ -1310,6 +1316,14 @@ function listenInCluster(server, address, port, addressType,
     return;
   }
 
+  // With SO_REUSEPORT every worker binds a socket of its own and the kernel
+  // balances connections across them, so the master only hears about it.
+  if (flags & TCPConstants.UV_TCP_REUSEPORT) {
+    cluster._reportListening(server, { address, port, addressType, fd });
+    server._listen2(address, port, addressType, backlog, fd, flags);
+    return;
+  }
+
   const serverQuery = {
     address: address,
     port: port,
@@ -1356,7 +1370,7 @@ Server.prototype.listen = function(...args) {
     toNumber(args.length > 2 && args[2]);  // (port, host, backlog)
 
   options = options._handle || options.handle || options;
-  const flags = getFlags(options.ipv6Only);
+  const flags = getFlags(options);
   // (handle[, backlog][, cb]) where handle is an object with a handle
   if (options instanceof TCP) {
     this._handle = options;
@@ -1395,7 +1409,7 @@ Server.prototype.listen = function(...args) {
     } else { // Undefined host, listens on unspecified address
       // Default addressType 4 will be used to search for master server
       listenInCluster(this, null, options.port | 0, 4,
-                      backlog, undefined, options.exclusive);
+                      backlog, undefined, options.exclusive, flags);
     }
     return this;
   }
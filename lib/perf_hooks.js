@@ -11,6 +11,8 @@ const {
   timeOrigin,
   timeOriginTimestamp,
   timerify,
+  getThreadpoolStats,
+  EventLoopMonitor: EventLoopMonitorHandle,
   constants
 } = internalBinding('performance');
 
@@ -27,7 +29,15 @@ const {
   NODE_PERFORMANCE_MILESTONE_LOOP_START,
   NODE_PERFORMANCE_MILESTONE_LOOP_EXIT,
   NODE_PERFORMANCE_MILESTONE_BOOTSTRAP_COMPLETE,
-  NODE_PERFORMANCE_MILESTONE_ENVIRONMENT
+  NODE_PERFORMANCE_MILESTONE_ENVIRONMENT,
+
+  NODE_PERFORMANCE_THREADPOOL_FIELDS,
+
+  NODE_PERFORMANCE_HISTOGRAM_FIELDS,
+  NODE_PERFORMANCE_LOOP_ITERATION,
+  NODE_PERFORMANCE_LOOP_POLL,
+  NODE_PERFORMANCE_LOOP_IDLE,
+  NODE_PERFORMANCE_LOOP_OUTSIDE_POLL
 } = constants;
 
 const { AsyncResource } = require('async_hooks');
@@ -47,6 +57,8 @@ const kGetEntries = Symbol('get-entries');
 const kIndex = Symbol('index');
 const kMarks = Symbol('marks');
 const kCount = Symbol('count');
+const kHandle = Symbol('handle');
+const kPhase = Symbol('phase');
 
 const observers = {};
 const observerableTypes = [
@@ -432,6 +444,28 @@ class Performance {
     return ret;
   }
 
+  threadpoolStats() {
+    const fields = new Float64Array(3 * NODE_PERFORMANCE_THREADPOOL_FIELDS);
+    getThreadpoolStats(fields);
+    const queue = (offset) => ({
+      threads: fields[offset],
+      idleThreads: fields[offset + 1],
+      size: fields[offset + 2],
+      running: fields[offset + 3],
+      pending: fields[offset + 4],
+      completed: fields[offset + 5],
+      waitTime: fields[offset + 6],
+      maxWaitTime: fields[offset + 7],
+      runTime: fields[offset + 8],
+      maxRunTime: fields[offset + 9]
+    });
+    return {
+      cpu: queue(0),
+      fs: queue(NODE_PERFORMANCE_THREADPOOL_FIELDS),
+      dns: queue(2 * NODE_PERFORMANCE_THREADPOOL_FIELDS)
+    };
+  }
+
   [kInspect]() {
     return {
       nodeTiming: this.nodeTiming,
@@ -442,6 +476,104 @@ class Performance {
 
 const performance = new Performance();
 
+const histogramFields = new Float64Array(NODE_PERFORMANCE_HISTOGRAM_FIELDS);
+
+// The durations of one event loop phase, in nanoseconds.
+class EventLoopHistogram {
+  constructor(handle, phase) {
+    this[kHandle] = handle;
+    this[kPhase] = phase;
+  }
+
+  get count() {
+    this[kHandle].stats(this[kPhase], histogramFields);
+    return histogramFields[0];
+  }
+
+  get min() {
+    this[kHandle].stats(this[kPhase], histogramFields);
+    return histogramFields[1];
+  }
+
+  get max() {
+    this[kHandle].stats(this[kPhase], histogramFields);
+    return histogramFields[2];
+  }
+
+  get mean() {
+    this[kHandle].stats(this[kPhase], histogramFields);
+    return histogramFields[3];
+  }
+
+  get stddev() {
+    this[kHandle].stats(this[kPhase], histogramFields);
+    return histogramFields[4];
+  }
+
+  percentile(percentile) {
+    if (typeof percentile !== 'number') {
+      const errors = lazyErrors();
+      throw new errors.ERR_INVALID_ARG_TYPE('percentile', 'number',
+                                            percentile);
+    }
+    if (!(percentile > 0 && percentile <= 100)) {
+      const errors = lazyErrors();
+      throw new errors.ERR_OUT_OF_RANGE('percentile', '> 0 && <= 100',
+                                        percentile);
+    }
+    return this[kHandle].percentile(this[kPhase], percentile);
+  }
+
+  get percentiles() {
+    const list = this[kHandle].percentiles(this[kPhase]);
+    const map = new Map();
+    for (var i = 0; i < list.length; i += 2)
+      map.set(list[i], list[i + 1]);
+    return map;
+  }
+
+  [kInspect]() {
+    this[kHandle].stats(this[kPhase], histogramFields);
+    return {
+      count: histogramFields[0],
+      min: histogramFields[1],
+      max: histogramFields[2],
+      mean: histogramFields[3],
+      stddev: histogramFields[4],
+      percentiles: this.percentiles
+    };
+  }
+}
+
+class EventLoopMonitor {
+  constructor() {
+    const handle = new EventLoopMonitorHandle();
+    this[kHandle] = handle;
+    this.iteration =
+      new EventLoopHistogram(handle, NODE_PERFORMANCE_LOOP_ITERATION);
+    this.poll = new EventLoopHistogram(handle, NODE_PERFORMANCE_LOOP_POLL);
+    this.idle = new EventLoopHistogram(handle, NODE_PERFORMANCE_LOOP_IDLE);
+    this.outsidePoll =
+      new EventLoopHistogram(handle, NODE_PERFORMANCE_LOOP_OUTSIDE_POLL);
+  }
+
+  enable() {
+    this[kHandle].enable();
+  }
+
+  disable() {
+    this[kHandle].disable();
+  }
+
+  reset() {
+    this[kHandle].reset();
+  }
+}
+
+function monitorEventLoop() {
+  return new EventLoopMonitor();
+}
+
 function getObserversList(type) {
   let list = observers[type];
   if (list === undefined) {
@@ -543,7 +675,8 @@ function sortedInsert(list, entry) {
 
 module.exports = {
   performance,
-  PerformanceObserver
+  PerformanceObserver,
+  monitorEventLoop
 };
 
 Object.defineProperty(module.exports, 'constants', {
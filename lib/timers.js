@@ -31,6 +31,7 @@ const {
 } = internalBinding('timers');
 const L = require('internal/linkedlist');
 const PriorityQueue = require('internal/priority_queue');
+const TimerWheel = require('internal/timer_wheel');
 const {
   async_id_symbol,
   trigger_async_id_symbol,
@@ -131,6 +132,12 @@ setupTimers(processImmediate, processTimers);
 // Timeout lists and the object map lookup of a specific list by the duration of
 // timers within (or creation of a new list). However, these operations combined
 // have shown to be trivial in comparison to other timers architectures.
+//
+// That is not true of unrefed timers with many different durations, most
+// notably socket timeouts. Unrefed timers of at least kWheelMinimum
+// milliseconds go into the TimerWheel from lib/internal/timer_wheel.js
+// instead, which is queued like one more list. They fire less precisely, but
+// never need a list of their own.
 
 
 // Object map containing linked lists of timers, keyed and sorted by their
@@ -145,6 +152,9 @@ const lists = Object.create(null);
 // individual IDs to determine which list was created first.
 const queue = new PriorityQueue(compareTimersLists, setPosition);
 
+const kWheelMinimum = 1000;
+const wheel = new TimerWheel();
+
 function compareTimersLists(a, b) {
   const expiryDiff = a.expiry - b.expiry;
   if (expiryDiff === 0) {
@@ -199,17 +209,21 @@ function insert(item, refed, start) {
 
   item._idleStart = start;
 
-  // Use an existing list if there is one, otherwise we need to make a new one.
-  var list = lists[msecs];
-  if (list === undefined) {
-    debug('no %d list was found in insert, creating a new one', msecs);
-    const expiry = start + msecs;
-    lists[msecs] = list = new TimersList(expiry, msecs);
-    queue.insert(list);
-
-    if (nextExpiry > expiry) {
-      scheduleTimer(msecs);
-      nextExpiry = expiry;
+  var list = null;
+  if (refed || msecs < kWheelMinimum) {
+    // Use an existing list if there is one, otherwise we need to make a new
+    // one.
+    list = lists[msecs];
+    if (list === undefined) {
+      debug('no %d list was found in insert, creating a new one', msecs);
+      const expiry = start + msecs;
+      lists[msecs] = list = new TimersList(expiry, msecs);
+      queue.insert(list);
+
+      if (nextExpiry > expiry) {
+        scheduleTimer(msecs);
+        nextExpiry = expiry;
+      }
     }
   }
 
@@ -226,7 +240,33 @@ function insert(item, refed, start) {
   }
   item[kRefed] = refed;
 
-  L.append(list, item);
+  if (list === null)
+    insertIntoWheel(item, start);
+  else
+    L.append(list, item);
+}
+
+function insertIntoWheel(item, start) {
+  const queued = wheel.priorityQueuePosition !== null;
+  if (!queued)
+    wheel.reset(start);
+
+  const expiry = wheel.insert(item);
+  if (expiry >= wheel.expiry && queued)
+    return;
+
+  wheel.expiry = expiry;
+  if (queued) {
+    queue.percolateUp(wheel.priorityQueuePosition);
+  } else {
+    wheel.id = timerListId++;
+    queue.insert(wheel);
+  }
+
+  if (nextExpiry > expiry) {
+    scheduleTimer(Math.max(expiry - start, 1));
+    nextExpiry = expiry;
+  }
 }
 
 function TimersList(expiry, msecs) {
@@ -266,7 +306,10 @@ function processTimers(now) {
       runNextTicks();
     else
       ranAtLeastOneList = true;
-    listOnTimeout(list, now);
+    if (list === wheel)
+      wheelOnTimeout(now);
+    else
+      listOnTimeout(list, now);
   }
   return 0;
 }
@@ -298,65 +341,98 @@ function listOnTimeout(list, now) {
 
     // The actual logic for when a timeout happens.
     L.remove(timer);
+    runTimer(timer);
+  }
 
-    const asyncId = timer[async_id_symbol];
+  // If `L.peek(list)` returned nothing, the list was either empty or we have
+  // called all of the timer timeouts.
+  // As such, we can remove the list from the object map and the PriorityQueue.
+  debug('%d list empty', msecs);
+
+  // The current list may have been removed and recreated since the reference
+  // to `list` was created. Make sure they're the same instance of the list
+  // before destroying.
+  if (list === lists[msecs]) {
+    delete lists[msecs];
+    queue.shift();
+  }
+}
+
+function runTimer(timer) {
+  const asyncId = timer[async_id_symbol];
+
+  if (!timer._onTimeout) {
+    if (timer[kRefed])
+      refCount--;
+    timer[kRefed] = null;
+
+    if (destroyHooksExist() && !timer._destroyed) {
+      emitDestroy(asyncId);
+      timer._destroyed = true;
+    }
+    return;
+  }
 
-    if (!timer._onTimeout) {
+  emitBefore(asyncId, timer[trigger_async_id_symbol], timer);
+
+  let start;
+  if (timer._repeat)
+    start = getLibuvNow();
+
+  try {
+    const args = timer._timerArgs;
+    if (!args)
+      timer._onTimeout();
+    else
+      Reflect.apply(timer._onTimeout, timer, args);
+  } finally {
+    if (timer._repeat && timer._idleTimeout !== -1) {
+      timer._idleTimeout = timer._repeat;
+      if (start === undefined)
+        start = getLibuvNow();
+      insert(timer, timer[kRefed], start);
+    } else {
       if (timer[kRefed])
         refCount--;
       timer[kRefed] = null;
 
       if (destroyHooksExist() && !timer._destroyed) {
-        emitDestroy(asyncId);
+        emitDestroy(timer[async_id_symbol]);
         timer._destroyed = true;
       }
-      continue;
     }
+  }
 
-    emitBefore(asyncId, timer[trigger_async_id_symbol]);
+  emitAfter(asyncId);
+}
 
-    let start;
-    if (timer._repeat)
-      start = getLibuvNow();
+function wheelOnTimeout(now) {
+  debug('timer wheel %d', now);
 
-    try {
-      const args = timer._timerArgs;
-      if (!args)
-        timer._onTimeout();
-      else
-        Reflect.apply(timer._onTimeout, timer, args);
-    } finally {
-      if (timer._repeat && timer._idleTimeout !== -1) {
-        timer._idleTimeout = timer._repeat;
-        if (start === undefined)
-          start = getLibuvNow();
-        insert(timer, timer[kRefed], start);
-      } else {
-        if (timer[kRefed])
-          refCount--;
-        timer[kRefed] = null;
-
-        if (destroyHooksExist() && !timer._destroyed) {
-          emitDestroy(timer[async_id_symbol]);
-          timer._destroyed = true;
-        }
-      }
-    }
+  wheel.advance(now);
 
-    emitAfter(asyncId);
-  }
+  var timer;
+  let ranAtLeastOneTimer = false;
+  while (timer = L.peek(wheel.due)) {
+    if (ranAtLeastOneTimer)
+      runNextTicks();
+    else
+      ranAtLeastOneTimer = true;
 
-  // If `L.peek(list)` returned nothing, the list was either empty or we have
-  // called all of the timer timeouts.
-  // As such, we can remove the list from the object map and the PriorityQueue.
-  debug('%d list empty', msecs);
+    L.remove(timer);
+    runTimer(timer);
+  }
 
-  // The current list may have been removed and recreated since the reference
-  // to `list` was created. Make sure they're the same instance of the list
-  // before destroying.
-  if (list === lists[msecs]) {
-    delete lists[msecs];
-    queue.shift();
+  const expiry = wheel.nextExpiry();
+  if (expiry === Infinity) {
+    debug('timer wheel empty');
+    queue.removeAt(wheel.priorityQueuePosition);
+    wheel.priorityQueuePosition = null;
+    wheel.expiry = Infinity;
+  } else {
+    wheel.expiry = expiry;
+    wheel.id = timerListId++;
+    queue.percolateDown(wheel.priorityQueuePosition);
   }
 }
 
@@ -625,7 +701,7 @@ function processImmediate() {
     prevImmediate = immediate;
 
     const asyncId = immediate[async_id_symbol];
-    emitBefore(asyncId, immediate[trigger_async_id_symbol]);
+    emitBefore(asyncId, immediate[trigger_async_id_symbol], immediate);
 
     try {
       const argv = immediate._argv;
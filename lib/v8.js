@@ -14,10 +14,6 @@
 
 'use strict';
 
-if ('chakracore' in process.versions) {
-  return;
-}
-
 const { Buffer } = require('buffer');
 const { ERR_INVALID_ARG_TYPE } = require('internal/errors').codes;
 const {
@@ -58,7 +54,13 @@ const {
   kSpaceSizeIndex,
   kSpaceUsedSizeIndex,
   kSpaceAvailableSizeIndex,
-  kPhysicalSpaceSizeIndex
+  kPhysicalSpaceSizeIndex,
+
+  // Only present on ChakraCore builds.
+  setJitStatisticsEnabled: _setJitStatisticsEnabled,
+  getJitStatistics: _getJitStatistics,
+  getDeoptLog: _getDeoptLog,
+  redeferInactiveFunctions: _redeferInactiveFunctions
 } = internalBinding('v8');
 
 const kNumberOfHeapSpaces = kHeapSpaces.length;
@@ -112,6 +114,35 @@ function getHeapSpaceStatistics() {
   return heapSpaceStatistics;
 }
 
+function setJitStatisticsEnabled(enabled) {
+  if (typeof enabled !== 'boolean')
+    throw new ERR_INVALID_ARG_TYPE('enabled', 'boolean', enabled);
+  if (_setJitStatisticsEnabled !== undefined)
+    _setJitStatisticsEnabled(enabled);
+}
+
+function getJitStatistics(reset = false) {
+  if (typeof reset !== 'boolean')
+    throw new ERR_INVALID_ARG_TYPE('reset', 'boolean', reset);
+  if (_getJitStatistics === undefined)
+    return undefined;
+  return _getJitStatistics(reset);
+}
+
+function getDeoptLog(reset = false) {
+  if (typeof reset !== 'boolean')
+    throw new ERR_INVALID_ARG_TYPE('reset', 'boolean', reset);
+  if (_getDeoptLog === undefined)
+    return undefined;
+  return _getDeoptLog(reset);
+}
+
+function redeferInactiveFunctions() {
+  if (_redeferInactiveFunctions === undefined)
+    return undefined;
+  return _redeferInactiveFunctions();
+}
+
 /* V8 serialization API */
 
 /* JS methods for the base objects */
@@ -219,9 +250,13 @@ function deserialize(buffer) {
 
 module.exports = {
   cachedDataVersionTag,
+  getDeoptLog,
   getHeapStatistics,
   getHeapSpaceStatistics,
+  getJitStatistics,
+  redeferInactiveFunctions,
   setFlagsFromString,
+  setJitStatisticsEnabled,
   Serializer,
   Deserializer,
   DefaultSerializer,
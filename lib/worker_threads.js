@@ -5,7 +5,8 @@ const {
   MessagePort,
   MessageChannel,
   threadId,
-  Worker
+  Worker,
+  WorkerPool
 } = require('internal/worker');
 
 module.exports = {
@@ -14,5 +15,6 @@ module.exports = {
   MessageChannel,
   threadId,
   Worker,
+  WorkerPool,
   parentPort: null
 };
@@ -22,8 +22,10 @@
 'use strict';
 
 const {
+  ERR_BROTLI_INVALID_PARAM,
   ERR_BUFFER_TOO_LARGE,
   ERR_INVALID_ARG_TYPE,
+  ERR_NO_BROTLI,
   ERR_OUT_OF_RANGE,
   ERR_ZLIB_INITIALIZATION_FAILED
 } = require('internal/errors').codes;
@@ -51,7 +53,9 @@ const {
   Z_MIN_CHUNK, Z_MIN_WINDOWBITS, Z_MAX_WINDOWBITS, Z_MIN_LEVEL, Z_MAX_LEVEL,
   Z_MIN_MEMLEVEL, Z_MAX_MEMLEVEL, Z_DEFAULT_CHUNK, Z_DEFAULT_COMPRESSION,
   Z_DEFAULT_STRATEGY, Z_DEFAULT_WINDOWBITS, Z_DEFAULT_MEMLEVEL, Z_FIXED,
-  DEFLATE, DEFLATERAW, INFLATE, INFLATERAW, GZIP, GUNZIP, UNZIP
+  DEFLATE, DEFLATERAW, INFLATE, INFLATERAW, GZIP, GUNZIP, UNZIP,
+  BROTLI_DECODE, BROTLI_ENCODE,
+  BROTLI_OPERATION_PROCESS, BROTLI_OPERATION_FLUSH, BROTLI_OPERATION_FINISH
 } = constants;
 
 // translation table for return codes.
@@ -144,6 +148,145 @@ function zlibBufferSync(engine, buffer) {
   return buffer;
 }
 
+// Default, minimum and maximum size of the blocks that gzip() compresses on
+// separate threadpool workers when the `parallel` option is set. Blocks have
+// to be at least as large as the dictionary primed from the previous one.
+const kParallelDefaultBlockSize = 128 * 1024;
+const kParallelMinBlockSize = 1 << Z_MAX_WINDOWBITS;
+const kParallelMaxBlockSize = 1024 * 1024 * 1024;
+
+function parallelGzipBuffer(buffer, opts, callback) {
+  if (typeof buffer === 'string') {
+    buffer = Buffer.from(buffer);
+  } else if (!isArrayBufferView(buffer)) {
+    if (isAnyArrayBuffer(buffer)) {
+      buffer = Buffer.from(buffer);
+    } else {
+      throw new ERR_INVALID_ARG_TYPE(
+        'buffer',
+        ['string', 'Buffer', 'TypedArray', 'DataView', 'ArrayBuffer'],
+        buffer
+      );
+    }
+  } else if (Object.getPrototypeOf(buffer) !== Buffer.prototype) {
+    buffer = Buffer.from(buffer.buffer, buffer.byteOffset, buffer.byteLength);
+  }
+
+  const level = checkRangesOrGetDefault(
+    opts.level, 'options.level',
+    Z_MIN_LEVEL, Z_MAX_LEVEL, Z_DEFAULT_COMPRESSION);
+  const memLevel = checkRangesOrGetDefault(
+    opts.memLevel, 'options.memLevel',
+    Z_MIN_MEMLEVEL, Z_MAX_MEMLEVEL, Z_DEFAULT_MEMLEVEL);
+  const strategy = checkRangesOrGetDefault(
+    opts.strategy, 'options.strategy',
+    Z_DEFAULT_STRATEGY, Z_FIXED, Z_DEFAULT_STRATEGY);
+  const windowBits = checkRangesOrGetDefault(
+    opts.windowBits, 'options.windowBits',
+    Z_MIN_WINDOWBITS, Z_MAX_WINDOWBITS, Z_DEFAULT_WINDOWBITS);
+  const blockSize = checkRangesOrGetDefault(
+    opts.blockSize, 'options.blockSize',
+    kParallelMinBlockSize, kParallelMaxBlockSize, kParallelDefaultBlockSize);
+
+  const handle = new binding.ParallelGzip();
+  // Keep the input alive while the blocks are compressed off-thread.
+  handle.buffer = buffer;
+  handle.callback = callback;
+  handle.oncomplete = parallelGzipOnComplete;
+  handle.onerror = parallelGzipOnError;
+  handle.compress(buffer, level, memLevel, strategy, windowBits, blockSize);
+}
+
+function parallelGzipOnComplete(result) {
+  const callback = this.callback;
+  this.buffer = null;
+  this.callback = null;
+  callback(null, result);
+}
+
+function parallelGzipOnError(message, errno, code) {
+  const callback = this.callback;
+  this.buffer = null;
+  this.callback = null;
+
+  // eslint-disable-next-line no-restricted-syntax
+  const error = new Error(message);
+  error.errno = errno;
+  error.code = code;
+  callback(error);
+}
+
+// Inputs up to this size are compressed by deflateSync(), gzipSync() and
+// deflateRawSync() with a single native call into a scratch buffer, without
+// setting up a stream. Anything the one-shot path does not handle, such as
+// stream-only options or a failed call, falls back to the regular path.
+const kOneShotMaxLength = 64 * 1024;
+const kOneShotOptions = new Set(['level', 'windowBits', 'memLevel',
+                                 'strategy']);
+let oneShot;
+let oneShotScratch;
+
+function oneShotBound(length) {
+  // Generous for any parameters, including the gzip header and trailer.
+  return length + (length >> 3) + (length >> 6) + 64;
+}
+
+function oneShotCompressSync(mode, buffer, opts) {
+  if (typeof buffer === 'string') {
+    if (buffer.length > kOneShotMaxLength)
+      return;
+    buffer = Buffer.from(buffer);
+  } else if (!isArrayBufferView(buffer)) {
+    return;
+  }
+  if (buffer.byteLength > kOneShotMaxLength)
+    return;
+
+  var windowBits = Z_DEFAULT_WINDOWBITS;
+  var level = Z_DEFAULT_COMPRESSION;
+  var memLevel = Z_DEFAULT_MEMLEVEL;
+  var strategy = Z_DEFAULT_STRATEGY;
+  if (opts) {
+    for (const key of Object.keys(opts)) {
+      if (!kOneShotOptions.has(key))
+        return;
+    }
+
+    if (mode === DEFLATERAW && opts.windowBits === 8) {
+      windowBits = 9;
+    } else {
+      windowBits = checkRangesOrGetDefault(
+        opts.windowBits, 'options.windowBits',
+        Z_MIN_WINDOWBITS, Z_MAX_WINDOWBITS, Z_DEFAULT_WINDOWBITS);
+    }
+
+    level = checkRangesOrGetDefault(
+      opts.level, 'options.level',
+      Z_MIN_LEVEL, Z_MAX_LEVEL, Z_DEFAULT_COMPRESSION);
+
+    memLevel = checkRangesOrGetDefault(
+      opts.memLevel, 'options.memLevel',
+      Z_MIN_MEMLEVEL, Z_MAX_MEMLEVEL, Z_DEFAULT_MEMLEVEL);
+
+    strategy = checkRangesOrGetDefault(
+      opts.strategy, 'options.strategy',
+      Z_DEFAULT_STRATEGY, Z_FIXED, Z_DEFAULT_STRATEGY);
+  }
+
+  if (oneShot === undefined) {
+    oneShot = new binding.ZlibOneShot();
+    oneShotScratch = Buffer.allocUnsafeSlow(oneShotBound(kOneShotMaxLength));
+  }
+  const length = oneShot.compressInto(mode, buffer, oneShotScratch,
+                                      level, windowBits, memLevel, strategy);
+  if (length < 0)
+    return;
+
+  const result = Buffer.allocUnsafe(length);
+  oneShotScratch.copy(result, 0, 0, length);
+  return result;
+}
+
 function zlibOnError(message, errno, code) {
   var self = this[owner_symbol];
   // there is no way to cleanly recover.
@@ -206,24 +349,15 @@ function checkRangesOrGetDefault(number, name, lower, upper, def) {
   return number;
 }
 
-// the Zlib class they all inherit from
-// This thing manages the queue of requests, and returns
-// true or false if there is anything in the queue when
-// you call the .write() method.
-function Zlib(opts, mode) {
+// The base class for all compression streams. This manages the queue of
+// requests to the native handle, and returns true or false if there is
+// anything in the queue when you call the .write() method.
+function ZlibBase(opts, mode, handle, { flush, finishFlush, fullFlush }) {
   var chunkSize = Z_DEFAULT_CHUNK;
-  var flush = Z_NO_FLUSH;
-  var finishFlush = Z_FINISH;
-  var windowBits = Z_DEFAULT_WINDOWBITS;
-  var level = Z_DEFAULT_COMPRESSION;
-  var memLevel = Z_DEFAULT_MEMLEVEL;
-  var strategy = Z_DEFAULT_STRATEGY;
-  var dictionary;
 
-  // The Zlib class is not exported to user land, the mode should only be
+  // The ZlibBase class is not exported to user land, the mode should only be
   // passed in by us.
   assert(typeof mode === 'number');
-  assert(mode >= DEFLATE && mode <= UNZIP);
 
   if (opts) {
     chunkSize = opts.chunkSize;
@@ -236,12 +370,56 @@ function Zlib(opts, mode) {
 
     flush = checkRangesOrGetDefault(
       opts.flush, 'options.flush',
-      Z_NO_FLUSH, Z_BLOCK, Z_NO_FLUSH);
+      Z_NO_FLUSH, Z_BLOCK, flush);
 
     finishFlush = checkRangesOrGetDefault(
       opts.finishFlush, 'options.finishFlush',
-      Z_NO_FLUSH, Z_BLOCK, Z_FINISH);
+      Z_NO_FLUSH, Z_BLOCK, finishFlush);
 
+    if (opts.encoding || opts.objectMode || opts.writableObjectMode) {
+      opts = _extend({}, opts);
+      opts.encoding = null;
+      opts.objectMode = false;
+      opts.writableObjectMode = false;
+    }
+  }
+  Transform.call(this, opts);
+  this.bytesWritten = 0;
+  this._handle = handle;
+  // Used by processCallback() and zlibOnError()
+  handle[owner_symbol] = this;
+  handle.onerror = zlibOnError;
+  this._hadError = false;
+  this._writeState = new Uint32Array(2);
+
+  this._outBuffer = Buffer.allocUnsafe(chunkSize);
+  this._outOffset = 0;
+  this._chunkSize = chunkSize;
+  this._defaultFlushFlag = flush;
+  this._finishFlushFlag = finishFlush;
+  this._defaultFullFlushFlag = fullFlush;
+  this._nextFlush = -1;
+  this._info = opts && opts.info;
+  this.once('end', this.close);
+}
+inherits(ZlibBase, Transform);
+
+const zlibDefaultOpts = {
+  flush: Z_NO_FLUSH,
+  finishFlush: Z_FINISH,
+  fullFlush: Z_FULL_FLUSH
+};
+// The class all zlib streams inherit from.
+function Zlib(opts, mode) {
+  var windowBits = Z_DEFAULT_WINDOWBITS;
+  var level = Z_DEFAULT_COMPRESSION;
+  var memLevel = Z_DEFAULT_MEMLEVEL;
+  var strategy = Z_DEFAULT_STRATEGY;
+  var dictionary;
+
+  assert(mode >= DEFLATE && mode <= UNZIP);
+
+  if (opts) {
     // windowBits is special. On the compression side, 0 is an invalid value.
     // But on the decompression side, a value of 0 for windowBits tells zlib
     // to use the window size in the zlib header of the compressed stream.
@@ -280,22 +458,9 @@ function Zlib(opts, mode) {
         );
       }
     }
-
-    if (opts.encoding || opts.objectMode || opts.writableObjectMode) {
-      opts = _extend({}, opts);
-      opts.encoding = null;
-      opts.objectMode = false;
-      opts.writableObjectMode = false;
-    }
   }
-  Transform.call(this, opts);
-  this.bytesWritten = 0;
-  this._handle = new binding.Zlib(mode);
-  // Used by processCallback() and zlibOnError()
-  this._handle[owner_symbol] = this;
-  this._handle.onerror = zlibOnError;
-  this._hadError = false;
-  this._writeState = new Uint32Array(2);
+
+  ZlibBase.call(this, opts, mode, new binding.Zlib(mode), zlibDefaultOpts);
 
   if (!this._handle.init(windowBits,
                          level,
@@ -307,20 +472,12 @@ function Zlib(opts, mode) {
     throw new ERR_ZLIB_INITIALIZATION_FAILED();
   }
 
-  this._outBuffer = Buffer.allocUnsafe(chunkSize);
-  this._outOffset = 0;
   this._level = level;
   this._strategy = strategy;
-  this._chunkSize = chunkSize;
-  this._defaultFlushFlag = flush;
-  this._finishFlushFlag = finishFlush;
-  this._nextFlush = -1;
-  this._info = opts && opts.info;
-  this.once('end', this.close);
 }
-inherits(Zlib, Transform);
+inherits(Zlib, ZlibBase);
 
-Object.defineProperty(Zlib.prototype, '_closed', {
+Object.defineProperty(ZlibBase.prototype, '_closed', {
   configurable: true,
   enumerable: true,
   get() {
@@ -332,7 +489,7 @@ Object.defineProperty(Zlib.prototype, '_closed', {
 // perspective, but it is inconsistent with all other streams exposed by Node.js
 // that have this concept, where it stands for the number of bytes read
 // *from* the stream (that is, net.Socket/tls.Socket & file system streams).
-Object.defineProperty(Zlib.prototype, 'bytesRead', {
+Object.defineProperty(ZlibBase.prototype, 'bytesRead', {
   configurable: true,
   enumerable: true,
   get: deprecate(function() {
@@ -371,7 +528,7 @@ Zlib.prototype.params = function params(level, strategy, callback) {
   }
 };
 
-Zlib.prototype.reset = function reset() {
+ZlibBase.prototype.reset = function reset() {
   if (!this._handle)
     assert(false, 'zlib binding closed');
   return this._handle.reset();
@@ -379,7 +536,7 @@ Zlib.prototype.reset = function reset() {
 
 // This is the _flush function called by the transform class,
 // internally, when the last chunk has been written.
-Zlib.prototype._flush = function _flush(callback) {
+ZlibBase.prototype._flush = function _flush(callback) {
   this._transform(Buffer.alloc(0), '', callback);
 };
 
@@ -400,12 +557,12 @@ function maxFlush(a, b) {
 }
 
 const flushBuffer = Buffer.alloc(0);
-Zlib.prototype.flush = function flush(kind, callback) {
+ZlibBase.prototype.flush = function flush(kind, callback) {
   var ws = this._writableState;
 
   if (typeof kind === 'function' || (kind === undefined && !callback)) {
     callback = kind;
-    kind = Z_FULL_FLUSH;
+    kind = this._defaultFullFlushFlag;
   }
 
   if (ws.ended) {
@@ -424,17 +581,17 @@ Zlib.prototype.flush = function flush(kind, callback) {
   }
 };
 
-Zlib.prototype.close = function close(callback) {
+ZlibBase.prototype.close = function close(callback) {
   _close(this, callback);
   this.destroy();
 };
 
-Zlib.prototype._destroy = function _destroy(err, callback) {
+ZlibBase.prototype._destroy = function _destroy(err, callback) {
   _close(this);
   callback(err);
 };
 
-Zlib.prototype._transform = function _transform(chunk, encoding, cb) {
+ZlibBase.prototype._transform = function _transform(chunk, encoding, cb) {
   var flushFlag = this._defaultFlushFlag;
   // We use a 'fake' zero-length chunk to carry information about flushes from
   // the public API to the actual stream implementation.
@@ -451,7 +608,7 @@ Zlib.prototype._transform = function _transform(chunk, encoding, cb) {
   processChunk(this, chunk, flushFlag, cb);
 };
 
-Zlib.prototype._processChunk = function _processChunk(chunk, flushFlag, cb) {
+ZlibBase.prototype._processChunk = function(chunk, flushFlag, cb) {
   // _processChunk() is left for backwards compatibility
   if (typeof cb === 'function')
     processChunk(this, chunk, flushFlag, cb);
@@ -567,7 +724,7 @@ function processCallback() {
   // important to null out the values once they are no longer needed since
   // `_handle` can stay in memory long after the buffer is needed.
   var handle = this;
-  var self = this.jsref;
+  var self = this[owner_symbol];
   var state = self._writeState;
 
   if (self._hadError) {
@@ -693,9 +850,79 @@ function Unzip(opts) {
 }
 inherits(Unzip, Zlib);
 
+// Brotli parameters are passed to the native side as an array indexed by
+// BROTLI_PARAM_* (or BROTLI_DECODER_PARAM_*) value, with -1 meaning "unset".
+const kMaxBrotliParam = Math.max(...Object.keys(constants).map((key) => {
+  return key.startsWith('BROTLI_PARAM_') ? constants[key] : 0;
+}));
+
+const brotliInitParamsArray = new Uint32Array(kMaxBrotliParam + 1);
+
+const brotliDefaultOpts = {
+  flush: BROTLI_OPERATION_PROCESS,
+  finishFlush: BROTLI_OPERATION_FINISH,
+  fullFlush: BROTLI_OPERATION_FLUSH
+};
+function Brotli(opts, mode) {
+  if (binding.BrotliEncoder === undefined)
+    throw new ERR_NO_BROTLI();
+  assert(mode === BROTLI_DECODE || mode === BROTLI_ENCODE);
+
+  brotliInitParamsArray.fill(-1);
+  if (opts && opts.params) {
+    for (const origKey of Object.keys(opts.params)) {
+      const key = +origKey;
+      if (Number.isNaN(key) || key < 0 || key > kMaxBrotliParam ||
+          (brotliInitParamsArray[key] | 0) !== -1) {
+        throw new ERR_BROTLI_INVALID_PARAM(origKey);
+      }
+
+      const value = opts.params[origKey];
+      if (typeof value !== 'number' && typeof value !== 'boolean') {
+        throw new ERR_INVALID_ARG_TYPE('options.params[key]',
+                                       'number', opts.params[origKey]);
+      }
+      brotliInitParamsArray[key] = value;
+    }
+  }
+
+  const handle = mode === BROTLI_DECODE ?
+    new binding.BrotliDecoder(mode) : new binding.BrotliEncoder(mode);
+  ZlibBase.call(this, opts, mode, handle, brotliDefaultOpts);
+
+  if (!this._handle.init(brotliInitParamsArray,
+                         this._writeState,
+                         processCallback)) {
+    throw new ERR_ZLIB_INITIALIZATION_FAILED();
+  }
+}
+inherits(Brotli, ZlibBase);
+
+function BrotliCompress(opts) {
+  if (!(this instanceof BrotliCompress))
+    return new BrotliCompress(opts);
+  Brotli.call(this, opts, BROTLI_ENCODE);
+}
+inherits(BrotliCompress, Brotli);
+
+function BrotliDecompress(opts) {
+  if (!(this instanceof BrotliDecompress))
+    return new BrotliDecompress(opts);
+  Brotli.call(this, opts, BROTLI_DECODE);
+}
+inherits(BrotliDecompress, Brotli);
+
 function createConvenienceMethod(ctor, sync) {
   if (sync) {
+    const oneShotMode = ctor === Deflate ? DEFLATE :
+      ctor === Gzip ? GZIP :
+        ctor === DeflateRaw ? DEFLATERAW : -1;
     return function syncBufferWrapper(buffer, opts) {
+      if (oneShotMode !== -1) {
+        const result = oneShotCompressSync(oneShotMode, buffer, opts);
+        if (result !== undefined)
+          return result;
+      }
       return zlibBufferSync(new ctor(opts), buffer);
     };
   } else {
@@ -704,6 +931,8 @@ function createConvenienceMethod(ctor, sync) {
         callback = opts;
         opts = {};
       }
+      if (ctor === Gzip && opts && opts.parallel)
+        return parallelGzipBuffer(buffer, opts, callback);
       return zlibBuffer(new ctor(opts), buffer, callback);
     };
   }
@@ -734,6 +963,8 @@ module.exports = {
   DeflateRaw,
   InflateRaw,
   Unzip,
+  BrotliCompress,
+  BrotliDecompress,
 
   // Convenience methods.
   // compress/decompress a string or buffer in one step.
@@ -750,7 +981,11 @@ module.exports = {
   gunzip: createConvenienceMethod(Gunzip, false),
   gunzipSync: createConvenienceMethod(Gunzip, true),
   inflateRaw: createConvenienceMethod(InflateRaw, false),
-  inflateRawSync: createConvenienceMethod(InflateRaw, true)
+  inflateRawSync: createConvenienceMethod(InflateRaw, true),
+  brotliCompress: createConvenienceMethod(BrotliCompress, false),
+  brotliCompressSync: createConvenienceMethod(BrotliCompress, true),
+  brotliDecompress: createConvenienceMethod(BrotliDecompress, false),
+  brotliDecompressSync: createConvenienceMethod(BrotliDecompress, true)
 };
 
 Object.defineProperties(module.exports, {
@@ -761,6 +996,8 @@ Object.defineProperties(module.exports, {
   createGzip: createProperty(Gzip),
   createGunzip: createProperty(Gunzip),
   createUnzip: createProperty(Unzip),
+  createBrotliCompress: createProperty(BrotliCompress),
+  createBrotliDecompress: createProperty(BrotliDecompress),
   constants: {
     configurable: false,
     enumerable: true,
@@ -778,6 +1015,7 @@ Object.defineProperties(module.exports, {
 const bkeys = Object.keys(constants);
 for (var bk = 0; bk < bkeys.length; bk++) {
   var bkey = bkeys[bk];
+  if (bkey.startsWith('BROTLI')) continue;
   Object.defineProperty(module.exports, bkey, {
     enumerable: true, value: constants[bkey], writable: false
   });
@@ -12,7 +12,8 @@
     'force_dynamic_crt%': 0,
     'node_module_version%': '',
     'node_shared_zlib%': 'false',
-    'node_experimental_http_parser%': 'false',
+    'node_shared_brotli%': 'false',
+    'node_experimental_http_parser%': 'true',
     'node_shared_http_parser%': 'false',
     'node_shared_cares%': 'false',
     'node_shared_libuv%': 'false',
@@ -91,6 +92,7 @@
       'lib/internal/buffer.js',
       'lib/internal/cli_table.js',
       'lib/internal/child_process.js',
+      'lib/internal/child_process/serialization.js',
       'lib/internal/cluster/child.js',
       'lib/internal/cluster/master.js',
       'lib/internal/cluster/round_robin_handle.js',
@@ -121,10 +123,10 @@
       'lib/internal/fixed_queue.js',
       'lib/internal/freelist.js',
       'lib/internal/fs/promises.js',
-      'lib/internal/fs/read_file_context.js',
       'lib/internal/fs/streams.js',
       'lib/internal/fs/sync_write_stream.js',
       'lib/internal/fs/utils.js',
+      'lib/internal/fs/walk.js',
       'lib/internal/fs/watchers.js',
       'lib/internal/http.js',
       'lib/internal/inspector_async_hook.js',
@@ -162,6 +164,7 @@
       'lib/internal/test/binding.js',
       'lib/internal/test/heap.js',
       'lib/internal/test/unicode.js',
+      'lib/internal/timer_wheel.js',
       'lib/internal/timers.js',
       'lib/internal/tls.js',
       'lib/internal/trace_events_async_hooks.js',
@@ -399,6 +402,7 @@
         'src/stream_pipe.cc',
         'src/stream_wrap.cc',
         'src/string_bytes.cc',
+        'src/string_bytes_simd.cc',
         'src/string_decoder.cc',
         'src/tcp_wrap.cc',
         'src/timers.cc',
@@ -424,6 +428,8 @@
         'src/env.h',
         'src/env-inl.h',
         'src/handle_wrap.h',
+        'src/histogram.h',
+        'src/histogram-inl.h',
         'src/http_parser_adaptor.h',
         'src/js_stream.h',
         'src/memory_tracker.h',
@@ -472,6 +478,7 @@
         'src/stream_pipe.h',
         'src/stream_wrap.h',
         'src/string_bytes.h',
+        'src/string_bytes_simd.h',
         'src/string_decoder.h',
         'src/string_decoder-inl.h',
         'src/string_search.h',
@@ -951,6 +958,7 @@
         'test/cctest/test_base64.cc',
         'test/cctest/test_node_postmortem_metadata.cc',
         'test/cctest/test_environment.cc',
+        'test/cctest/test_histogram.cc',
         'test/cctest/test_platform.cc',
         'test/cctest/test_traced_value.cc',
         'test/cctest/test_util.cc',
@@ -45,6 +45,18 @@ inline double AsyncWrap::get_trigger_async_id() const {
 }
 
 
+inline v8::Local<v8::Value> AsyncWrap::context_frame() const {
+  Environment* env = this->env();
+  if (env->async_hooks()->fields()[Environment::AsyncHooks::kContextFrames] ==
+      0) {
+    return v8::Local<v8::Value>();
+  }
+  if (context_frame_.IsEmpty())
+    return v8::Undefined(env->isolate());
+  return context_frame_.Get(env->isolate());
+}
+
+
 inline AsyncWrap::AsyncScope::AsyncScope(AsyncWrap* wrap)
     : wrap_(wrap) {
   Environment* env = wrap->env();
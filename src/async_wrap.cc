@@ -342,6 +342,77 @@ static void DisablePromiseHook(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Unlike PromiseHook, this does not create a PromiseWrap per promise and does
+// not call into JS. The promise only remembers the frame it was created in,
+// and its reactions run in that frame.
+static void ContextFramePromiseHook(PromiseHookType type,
+                                    Local<Promise> promise,
+                                    Local<Value> parent,
+                                    void* arg) {
+  Environment* env = static_cast<Environment*>(arg);
+  AsyncHooks* async_hooks = env->async_hooks();
+  if (type == PromiseHookType::kInit) {
+    Local<Value> frame = async_hooks->context_frame();
+    if (frame->IsUndefined())
+      return;
+    USE(promise->SetPrivate(env->context(),
+                            env->context_frame_private_symbol(),
+                            frame));
+  } else if (type == PromiseHookType::kBefore) {
+    Local<Value> frame;
+    if (!promise->GetPrivate(env->context(),
+                             env->context_frame_private_symbol())
+             .ToLocal(&frame)) {
+      frame = Undefined(env->isolate());
+    }
+    async_hooks->push_context_frame(frame);
+  } else if (type == PromiseHookType::kAfter) {
+    async_hooks->pop_context_frame();
+  }
+}
+
+
+static void GetContextFrame(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  args.GetReturnValue().Set(env->async_hooks()->context_frame());
+}
+
+
+static void SetContextFrame(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  AsyncHooks* async_hooks = env->async_hooks();
+  // Frames are only tracked from the first time one is set on, so that
+  // applications that do not use them pay nothing.
+  if (async_hooks->fields()[AsyncHooks::kContextFrames] == 0) {
+    async_hooks->fields()[AsyncHooks::kContextFrames] = 1;
+    env->AddPromiseHook(ContextFramePromiseHook, static_cast<void*>(env));
+  }
+  async_hooks->set_context_frame(args[0]);
+}
+
+
+// Used by resources that are implemented in JS, around their callbacks.
+static void EnterContextFrame(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  AsyncHooks* async_hooks = env->async_hooks();
+  // Without an argument, the current frame is kept.
+  async_hooks->push_context_frame(
+      args.Length() > 0 ? args[0] : async_hooks->context_frame());
+}
+
+
+static void ExitContextFrame(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  env->async_hooks()->pop_context_frame();
+}
+
+
+static void ClearContextFrames(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  env->async_hooks()->clear_context_frames();
+}
+
+
 class DestroyParam {
  public:
   double asyncId;
@@ -455,6 +526,11 @@ void AsyncWrap::Initialize(Local<Object> target,
   env->SetMethod(target, "enablePromiseHook", EnablePromiseHook);
   env->SetMethod(target, "disablePromiseHook", DisablePromiseHook);
   env->SetMethod(target, "registerDestroyHook", RegisterDestroyHook);
+  env->SetMethod(target, "getContextFrame", GetContextFrame);
+  env->SetMethod(target, "setContextFrame", SetContextFrame);
+  env->SetMethod(target, "enterContextFrame", EnterContextFrame);
+  env->SetMethod(target, "exitContextFrame", ExitContextFrame);
+  env->SetMethod(target, "clearContextFrames", ClearContextFrames);
 
   PropertyAttribute ReadOnlyDontDelete =
       static_cast<PropertyAttribute>(ReadOnly | DontDelete);
@@ -507,6 +583,7 @@ void AsyncWrap::Initialize(Local<Object> target,
   SET_HOOKS_CONSTANT(kPromiseResolve);
   SET_HOOKS_CONSTANT(kTotals);
   SET_HOOKS_CONSTANT(kCheck);
+  SET_HOOKS_CONSTANT(kContextFrames);
   SET_HOOKS_CONSTANT(kExecutionAsyncId);
   SET_HOOKS_CONSTANT(kTriggerAsyncId);
   SET_HOOKS_CONSTANT(kAsyncIdCounter);
@@ -621,6 +698,16 @@ void AsyncWrap::AsyncReset(double execution_async_id, bool silent) {
     execution_async_id == -1 ? env()->new_async_id() : execution_async_id;
   trigger_async_id_ = env()->get_default_trigger_async_id();
 
+  AsyncHooks* async_hooks = env()->async_hooks();
+  if (async_hooks->fields()[AsyncHooks::kContextFrames] != 0) {
+    HandleScope handle_scope(env()->isolate());
+    Local<Value> frame = async_hooks->context_frame();
+    if (frame->IsUndefined())
+      context_frame_.Reset();
+    else
+      context_frame_.Reset(env()->isolate(), frame);
+  }
+
   switch (provider_type()) {
 #define V(PROVIDER)                                                           \
     case PROVIDER_ ## PROVIDER:                                               \
@@ -688,7 +775,7 @@ MaybeLocal<Value> AsyncWrap::MakeCallback(const Local<Function> cb,
   ProviderType provider = provider_type();
   async_context context { get_async_id(), get_trigger_async_id() };
   MaybeLocal<Value> ret = InternalMakeCallback(
-      env(), object(), cb, argc, argv, context);
+      env(), object(), cb, argc, argv, context, context_frame());
 
   // This is a static call with cached values because the `this` object may
   // no longer be alive at this point.
@@ -34,6 +34,7 @@ namespace node {
 
 #define NODE_ASYNC_NON_CRYPTO_PROVIDER_TYPES(V)                               \
   V(NONE)                                                                     \
+  V(DIRECTORYWALKER)                                                          \
   V(DNSCHANNEL)                                                               \
   V(FILEHANDLE)                                                               \
   V(FILEHANDLECLOSEREQ)                                                       \
@@ -71,10 +72,13 @@ namespace node {
 
 #if HAVE_OPENSSL
 #define NODE_ASYNC_CRYPTO_PROVIDER_TYPES(V)                                   \
+  V(CIPHERBATCHREQUEST)                                                       \
+  V(HASHREQUEST)                                                              \
   V(PBKDF2REQUEST)                                                            \
   V(KEYPAIRGENREQUEST)                                                        \
   V(RANDOMBYTESREQUEST)                                                       \
   V(SCRYPTREQUEST)                                                            \
+  V(VERIFYREQUEST)                                                            \
   V(TLSWRAP)
 #else
 #define NODE_ASYNC_CRYPTO_PROVIDER_TYPES(V)
@@ -151,6 +155,10 @@ class AsyncWrap : public BaseObject {
 
   void AsyncReset(double execution_async_id = -1, bool silent = false);
 
+  // The context frame captured by AsyncReset(), or an empty handle when
+  // context frames are not tracked.
+  inline v8::Local<v8::Value> context_frame() const;
+
   // Only call these within a valid HandleScope.
   v8::MaybeLocal<v8::Value> MakeCallback(const v8::Local<v8::Function> cb,
                                          int argc,
@@ -204,6 +212,7 @@ class AsyncWrap : public BaseObject {
   // Because the values may be Reset(), cannot be made const.
   double async_id_ = -1;
   double trigger_async_id_;
+  v8::Global<v8::Value> context_frame_;
 };
 
 }  // namespace node
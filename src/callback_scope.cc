@@ -9,6 +9,7 @@ using v8::HandleScope;
 using v8::Isolate;
 using v8::Local;
 using v8::Object;
+using v8::Value;
 
 using AsyncHooks = Environment::AsyncHooks;
 
@@ -32,12 +33,15 @@ InternalCallbackScope::InternalCallbackScope(AsyncWrap* async_wrap)
     : InternalCallbackScope(async_wrap->env(),
                             async_wrap->object(),
                             { async_wrap->get_async_id(),
-                              async_wrap->get_trigger_async_id() }) {}
+                              async_wrap->get_trigger_async_id() },
+                            kRequireResource,
+                            async_wrap->context_frame()) {}
 
 InternalCallbackScope::InternalCallbackScope(Environment* env,
                                              Local<Object> object,
                                              const async_context& asyncContext,
-                                             ResourceExpectation expect)
+                                             ResourceExpectation expect,
+                                             Local<Value> context_frame)
   : env_(env),
     async_context_(asyncContext),
     object_(object),
@@ -50,6 +54,8 @@ InternalCallbackScope::InternalCallbackScope(Environment* env,
     return;
   }
 
+  env->MarkPollWakeup();
+
   HandleScope handle_scope(env->isolate());
   // If you hit this assertion, you forgot to enter the v8::Context first.
   CHECK_EQ(Environment::GetCurrent(env->isolate()), env);
@@ -63,6 +69,11 @@ InternalCallbackScope::InternalCallbackScope(Environment* env,
   env->async_hooks()->push_async_ids(async_context_.async_id,
                                async_context_.trigger_async_id);
   pushed_ids_ = true;
+
+  if (!context_frame.IsEmpty()) {
+    env->async_hooks()->push_context_frame(context_frame);
+    pushed_context_frame_ = true;
+  }
 }
 
 InternalCallbackScope::~InternalCallbackScope() {
@@ -82,6 +93,9 @@ void InternalCallbackScope::Close() {
   if (pushed_ids_)
     env_->async_hooks()->pop_async_id(async_context_.async_id);
 
+  if (pushed_context_frame_)
+    env_->async_hooks()->pop_context_frame();
+
   if (failed_) return;
 
   if (async_context_.async_id != 0) {
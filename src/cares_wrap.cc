@@ -30,9 +30,14 @@
 #include "uv.h"
 
 #include <errno.h>
+#include <limits.h>
 #include <string.h>
-#include <vector>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #ifdef __POSIX__
 # include <netdb.h>
@@ -67,6 +72,7 @@ using v8::Local;
 using v8::Null;
 using v8::Object;
 using v8::String;
+using v8::Uint32;
 using v8::Value;
 
 namespace {
@@ -215,6 +221,8 @@ void ChannelWrap::New(const FunctionCallbackInfo<Value>& args) {
   new ChannelWrap(env, args.This());
 }
 
+class LookupCache;
+
 class GetAddrInfoReqWrap : public ReqWrap<uv_getaddrinfo_t> {
  public:
   GetAddrInfoReqWrap(Environment* env,
@@ -227,8 +235,19 @@ class GetAddrInfoReqWrap : public ReqWrap<uv_getaddrinfo_t> {
 
   bool verbatim() const { return verbatim_; }
 
+  // Set when the request looks up an entry of a LookupCache, which then
+  // hands the result to every request waiting on that entry.
+  LookupCache* cache() const { return cache_; }
+  const std::string& cache_key() const { return cache_key_; }
+  void set_cache(LookupCache* cache, const std::string& key) {
+    cache_ = cache;
+    cache_key_ = key;
+  }
+
  private:
   const bool verbatim_;
+  LookupCache* cache_ = nullptr;
+  std::string cache_key_;
 };
 
 GetAddrInfoReqWrap::GetAddrInfoReqWrap(Environment* env,
@@ -1812,68 +1831,142 @@ static void Query(const FunctionCallbackInfo<Value>& args) {
 }
 
 
-void AfterGetAddrInfo(uv_getaddrinfo_t* req, int status, struct addrinfo* res) {
-  std::unique_ptr<GetAddrInfoReqWrap> req_wrap {
-      static_cast<GetAddrInfoReqWrap*>(req->data)};
-  Environment* env = req_wrap->env();
+// Caches the results of dns.lookup() and shares one request between
+// concurrent lookups of the same name. getaddrinfo() doesn't report TTLs,
+// so its results are kept for max_ttl milliseconds; lookups made through a
+// c-ares channel keep answers for their TTL, up to max_ttl. Names that don't
+// exist are remembered for negative_ttl milliseconds, other failures not at
+// all.
+class LookupCache : public BaseObject {
+ public:
+  LookupCache(Environment* env,
+              Local<Object> object,
+              uint64_t max_ttl,
+              uint64_t negative_ttl,
+              size_t max_entries);
+  ~LookupCache() override;
 
-  HandleScope handle_scope(env->isolate());
-  Context::Scope context_scope(env->context());
+  static void New(const FunctionCallbackInfo<Value>& args);
+  static void Lookup(const FunctionCallbackInfo<Value>& args);
 
-  Local<Value> argv[] = {
-    Integer::New(env->isolate(), status),
-    Null(env->isolate())
+  // Stores the result of looking up `key` for `ttl` milliseconds and calls
+  // back every request waiting on it.
+  void Complete(const std::string& key,
+                int status,
+                std::vector<std::string>&& addresses,
+                uint64_t ttl);
+
+  uint64_t max_ttl() const { return max_ttl_; }
+
+  SET_NO_MEMORY_INFO()
+  SET_MEMORY_INFO_NAME(LookupCache)
+  SET_SELF_SIZE(LookupCache)
+
+ private:
+  struct Entry {
+    int status = 0;
+    std::vector<std::string> addresses;
+    uint64_t expiry = 0;
+    // Requests waiting for the lookup in flight, owned by the entry.
+    std::vector<GetAddrInfoReqWrap*> waiters;
   };
 
-  uint64_t n = 0;
-  const bool verbatim = req_wrap->verbatim();
+  void MakeRoom();
 
-  if (status == 0) {
-    Local<Array> results = Array::New(env->isolate());
-
-    auto add = [&] (bool want_ipv4, bool want_ipv6) {
-      for (auto p = res; p != nullptr; p = p->ai_next) {
-        CHECK_EQ(p->ai_socktype, SOCK_STREAM);
-
-        const char* addr;
-        if (want_ipv4 && p->ai_family == AF_INET) {
-          addr = reinterpret_cast<char*>(
-              &(reinterpret_cast<struct sockaddr_in*>(p->ai_addr)->sin_addr));
-        } else if (want_ipv6 && p->ai_family == AF_INET6) {
-          addr = reinterpret_cast<char*>(
-              &(reinterpret_cast<struct sockaddr_in6*>(p->ai_addr)->sin6_addr));
-        } else {
-          continue;
-        }
+  const uint64_t max_ttl_;
+  const uint64_t negative_ttl_;
+  const size_t max_entries_;
+  size_t lookups_in_flight_ = 0;
+  std::unordered_map<std::string, Entry> entries_;
+};
 
-        char ip[INET6_ADDRSTRLEN];
-        if (uv_inet_ntop(p->ai_family, addr, ip, sizeof(ip)))
-          continue;
 
-        Local<String> s = OneByteString(env->isolate(), ip);
-        results->Set(env->context(), n, s).FromJust();
-        n++;
+// Collects the addresses of a getaddrinfo() result, IPv4 addresses first
+// unless `verbatim` is set.
+int AddrInfoToAddresses(struct addrinfo* res,
+                        bool verbatim,
+                        std::vector<std::string>* addresses) {
+  auto add = [&] (bool want_ipv4, bool want_ipv6) {
+    for (auto p = res; p != nullptr; p = p->ai_next) {
+      CHECK_EQ(p->ai_socktype, SOCK_STREAM);
+
+      const char* addr;
+      if (want_ipv4 && p->ai_family == AF_INET) {
+        addr = reinterpret_cast<char*>(
+            &(reinterpret_cast<struct sockaddr_in*>(p->ai_addr)->sin_addr));
+      } else if (want_ipv6 && p->ai_family == AF_INET6) {
+        addr = reinterpret_cast<char*>(
+            &(reinterpret_cast<struct sockaddr_in6*>(p->ai_addr)->sin6_addr));
+      } else {
+        continue;
       }
-    };
 
-    add(true, verbatim);
-    if (verbatim == false)
-      add(false, true);
+      char ip[INET6_ADDRSTRLEN];
+      if (uv_inet_ntop(p->ai_family, addr, ip, sizeof(ip)))
+        continue;
 
-    // No responses were found to return
-    if (n == 0) {
-      argv[0] = Integer::New(env->isolate(), UV_EAI_NODATA);
+      addresses->emplace_back(ip);
     }
+  };
+
+  add(true, verbatim);
+  if (verbatim == false)
+    add(false, true);
+
+  // No responses were found to return
+  return addresses->empty() ? UV_EAI_NODATA : 0;
+}
 
-    argv[1] = results;
+
+Local<Array> AddressesToArray(Environment* env,
+                              const std::vector<std::string>& addresses) {
+  EscapableHandleScope escapable_handle_scope(env->isolate());
+  Local<Array> results = Array::New(env->isolate(), addresses.size());
+  for (size_t i = 0; i < addresses.size(); i++) {
+    Local<String> s = OneByteString(env->isolate(),
+                                    addresses[i].data(),
+                                    addresses[i].size());
+    results->Set(env->context(), i, s).FromJust();
   }
+  return escapable_handle_scope.Escape(results);
+}
+
+
+void AfterGetAddrInfo(uv_getaddrinfo_t* req, int status, struct addrinfo* res) {
+  std::unique_ptr<GetAddrInfoReqWrap> req_wrap {
+      static_cast<GetAddrInfoReqWrap*>(req->data)};
+  Environment* env = req_wrap->env();
+
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+  const bool verbatim = req_wrap->verbatim();
+  std::vector<std::string> addresses;
+  if (status == 0)
+    status = AddrInfoToAddresses(res, verbatim, &addresses);
 
   uv_freeaddrinfo(res);
 
+  uint64_t n = addresses.size();
   TRACE_EVENT_NESTABLE_ASYNC_END2(
       TRACING_CATEGORY_NODE2(dns, native), "lookup", req_wrap.get(),
       "count", n, "verbatim", verbatim);
 
+  LookupCache* cache = req_wrap->cache();
+  if (cache != nullptr) {
+    // The cache owns the requests waiting on the entry, this one included.
+    const std::string key = req_wrap.release()->cache_key();
+    cache->Complete(key, status, std::move(addresses), cache->max_ttl());
+    return;
+  }
+
+  Local<Value> argv[] = {
+    Integer::New(env->isolate(), status),
+    Null(env->isolate())
+  };
+  if (status == 0)
+    argv[1] = AddressesToArray(env, addresses);
+
   // Make the callback into JavaScript
   req_wrap->MakeCallback(env->oncomplete_string(), arraysize(argv), argv);
 }
@@ -1939,6 +2032,43 @@ void CanonicalizeIP(const FunctionCallbackInfo<Value>& args) {
   args.GetReturnValue().Set(val);
 }
 
+int ToAddressFamily(int32_t family) {
+  switch (family) {
+    case 0:
+      return AF_UNSPEC;
+    case 4:
+      return AF_INET;
+    case 6:
+      return AF_INET6;
+    default:
+      CHECK(0 && "bad address family");
+  }
+  return AF_UNSPEC;
+}
+
+int DispatchGetAddrInfo(GetAddrInfoReqWrap* req_wrap,
+                        const char* hostname,
+                        int family,
+                        int32_t flags) {
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(struct addrinfo));
+  hints.ai_family = family;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_flags = flags;
+
+  TRACE_EVENT_NESTABLE_ASYNC_BEGIN2(
+      TRACING_CATEGORY_NODE2(dns, native), "lookup", req_wrap,
+      "hostname", TRACE_STR_COPY(hostname),
+      "family",
+      family == AF_INET ? "ipv4" : family == AF_INET6 ? "ipv6" : "unspec");
+
+  return req_wrap->Dispatch(uv_getaddrinfo,
+                            AfterGetAddrInfo,
+                            hostname,
+                            nullptr,
+                            &hints);
+}
+
 void GetAddrInfo(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
 
@@ -1954,43 +2084,13 @@ void GetAddrInfo(const FunctionCallbackInfo<Value>& args) {
     flags = args[3].As<Int32>()->Value();
   }
 
-  int family;
-
-  switch (args[2].As<Int32>()->Value()) {
-    case 0:
-      family = AF_UNSPEC;
-      break;
-    case 4:
-      family = AF_INET;
-      break;
-    case 6:
-      family = AF_INET6;
-      break;
-    default:
-      CHECK(0 && "bad address family");
-  }
+  const int family = ToAddressFamily(args[2].As<Int32>()->Value());
 
   auto req_wrap = std::make_unique<GetAddrInfoReqWrap>(env,
                                                        req_wrap_obj,
                                                        args[4]->IsTrue());
 
-  struct addrinfo hints;
-  memset(&hints, 0, sizeof(struct addrinfo));
-  hints.ai_family = family;
-  hints.ai_socktype = SOCK_STREAM;
-  hints.ai_flags = flags;
-
-  TRACE_EVENT_NESTABLE_ASYNC_BEGIN2(
-      TRACING_CATEGORY_NODE2(dns, native), "lookup", req_wrap.get(),
-      "hostname", TRACE_STR_COPY(*hostname),
-      "family",
-      family == AF_INET ? "ipv4" : family == AF_INET6 ? "ipv6" : "unspec");
-
-  int err = req_wrap->Dispatch(uv_getaddrinfo,
-                               AfterGetAddrInfo,
-                               *hostname,
-                               nullptr,
-                               &hints);
+  int err = DispatchGetAddrInfo(req_wrap.get(), *hostname, family, flags);
   if (err == 0)
     // Release ownership of the pointer allowing the ownership to be transferred
     USE(req_wrap.release());
@@ -1999,6 +2099,369 @@ void GetAddrInfo(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+int AresToLookupError(int status) {
+  switch (status) {
+    case ARES_ENOTFOUND:
+      return UV_EAI_NONAME;
+    case ARES_ENODATA:
+      return UV_EAI_NODATA;
+    case ARES_ECONNREFUSED:
+    case ARES_ESERVFAIL:
+    case ARES_ETIMEOUT:
+      return UV_EAI_AGAIN;
+    case ARES_ENOMEM:
+      return UV_EAI_MEMORY;
+    case ARES_ECANCELLED:
+    case ARES_EDESTRUCTION:
+      return UV_EAI_CANCELED;
+    default:
+      return UV_EAI_FAIL;
+  }
+}
+
+// Resolves a name for a LookupCache through a c-ares channel instead of
+// getaddrinfo() on the threadpool. Like getaddrinfo(), it looks in the hosts
+// file first; otherwise it makes A and AAAA queries, and the lowest TTL of
+// the answers becomes the TTL of the result.
+class ResolverLookup {
+ public:
+  ResolverLookup(LookupCache* cache,
+                 ChannelWrap* channel,
+                 const std::string& key,
+                 const char* name,
+                 int family,
+                 int32_t flags)
+      : cache_(cache),
+        channel_(channel),
+        key_(key),
+        name_(name),
+        family_(family),
+        flags_(flags) {}
+
+  void Start() {
+    if (LookupHostsFile()) {
+      from_hosts_file_ = true;
+      cache_->env()->SetImmediate(Done, this);
+      return;
+    }
+
+    channel_->EnsureServers();
+    pending_queries_ = WantsIPv4() + WantsIPv6();
+    if (WantsIPv4())
+      Query(ns_t_a, AfterQuery<ns_t_a>);
+    if (WantsIPv6())
+      Query(ns_t_aaaa, AfterQuery<ns_t_aaaa>);
+  }
+
+ private:
+  bool WantsIPv4() const {
+    return family_ != AF_INET6 || (flags_ & AI_V4MAPPED);
+  }
+  bool WantsIPv6() const { return family_ != AF_INET; }
+
+  bool LookupHostsFile() {
+    auto add = [&] (int family, std::vector<std::string>* addresses) {
+      hostent* host;
+      if (ares_gethostbyname_file(channel_->cares_channel(), name_.c_str(),
+                                  family, &host) != ARES_SUCCESS) {
+        return;
+      }
+      for (char** addr = host->h_addr_list; *addr != nullptr; addr++) {
+        char ip[INET6_ADDRSTRLEN];
+        if (uv_inet_ntop(host->h_addrtype, *addr, ip, sizeof(ip)) == 0)
+          addresses->emplace_back(ip);
+      }
+      ares_free_hostent(host);
+    };
+
+    if (WantsIPv4())
+      add(AF_INET, &ipv4_);
+    if (WantsIPv6())
+      add(AF_INET6, &ipv6_);
+    return !ipv4_.empty() || !ipv6_.empty();
+  }
+
+  void Query(int type, ares_callback callback) {
+    channel_->ModifyActivityQueryCount(1);
+    ares_query(channel_->cares_channel(), name_.c_str(), ns_c_in, type,
+               callback, static_cast<void*>(this));
+  }
+
+  template <int type>
+  static void AfterQuery(void* arg, int status, int timeouts,
+                         unsigned char* answer_buf, int answer_len) {
+    ResolverLookup* lookup = static_cast<ResolverLookup*>(arg);
+    lookup->channel_->set_query_last_ok(status != ARES_ECONNREFUSED);
+    lookup->channel_->ModifyActivityQueryCount(-1);
+
+    if (status == ARES_SUCCESS)
+      status = lookup->ParseAnswer(type, answer_buf, answer_len);
+
+    // An empty answer still means that the name exists.
+    if (status == ARES_SUCCESS || status == ARES_ENODATA)
+      lookup->name_exists_ = true;
+    else if (lookup->error_ == ARES_SUCCESS)
+      lookup->error_ = status;
+
+    // c-ares may be in the middle of processing its sockets, so JavaScript
+    // is called from a fresh stack.
+    if (--lookup->pending_queries_ == 0)
+      lookup->cache_->env()->SetImmediate(Done, lookup);
+  }
+
+  int ParseAnswer(int type, unsigned char* buf, int len) {
+    char ip[INET6_ADDRSTRLEN];
+    int naddrttls = 256;
+    if (type == ns_t_a) {
+      ares_addrttl addrttls[256];
+      int status = ares_parse_a_reply(buf, len, nullptr, addrttls, &naddrttls);
+      if (status != ARES_SUCCESS)
+        return status;
+      for (int i = 0; i < naddrttls; i++) {
+        if (uv_inet_ntop(AF_INET, &addrttls[i].ipaddr, ip, sizeof(ip)) == 0)
+          ipv4_.emplace_back(ip);
+        ttl_ = std::min(ttl_, addrttls[i].ttl);
+      }
+    } else {
+      ares_addr6ttl addrttls[256];
+      int status =
+          ares_parse_aaaa_reply(buf, len, nullptr, addrttls, &naddrttls);
+      if (status != ARES_SUCCESS)
+        return status;
+      for (int i = 0; i < naddrttls; i++) {
+        if (uv_inet_ntop(AF_INET6, &addrttls[i].ip6addr, ip, sizeof(ip)) == 0)
+          ipv6_.emplace_back(ip);
+        ttl_ = std::min(ttl_, addrttls[i].ttl);
+      }
+    }
+    return ARES_SUCCESS;
+  }
+
+  static void Done(Environment* env, void* data) {
+    std::unique_ptr<ResolverLookup> lookup(static_cast<ResolverLookup*>(data));
+    lookup->Finish();
+  }
+
+  void Finish() {
+    std::vector<std::string> addresses;
+    if (family_ == AF_INET) {
+      addresses = std::move(ipv4_);
+    } else if (family_ == AF_INET6) {
+      addresses = std::move(ipv6_);
+      if (addresses.empty()) {
+        // Only asked for with AI_V4MAPPED
+        for (const std::string& ipv4 : ipv4_)
+          addresses.push_back("::ffff:" + ipv4);
+      }
+    } else {
+      addresses = std::move(ipv4_);
+      addresses.insert(addresses.end(), ipv6_.begin(), ipv6_.end());
+    }
+
+    int status = 0;
+    if (addresses.empty()) {
+      if (from_hosts_file_ || name_exists_)
+        status = UV_EAI_NODATA;
+      else
+        status = AresToLookupError(error_);
+    }
+
+    uint64_t ttl = cache_->max_ttl();
+    if (!from_hosts_file_)
+      ttl = std::min<uint64_t>(ttl, static_cast<uint64_t>(ttl_) * 1000);
+    cache_->Complete(key_, status, std::move(addresses), ttl);
+  }
+
+  LookupCache* const cache_;
+  ChannelWrap* const channel_;
+  const std::string key_;
+  const std::string name_;
+  const int family_;
+  const int32_t flags_;
+  int pending_queries_ = 0;
+  bool from_hosts_file_ = false;
+  bool name_exists_ = false;
+  int error_ = ARES_SUCCESS;
+  int ttl_ = INT_MAX;
+  std::vector<std::string> ipv4_;
+  std::vector<std::string> ipv6_;
+
+  DISALLOW_COPY_AND_ASSIGN(ResolverLookup);
+};
+
+
+LookupCache::LookupCache(Environment* env,
+                         Local<Object> object,
+                         uint64_t max_ttl,
+                         uint64_t negative_ttl,
+                         size_t max_entries)
+    : BaseObject(env, object),
+      max_ttl_(max_ttl),
+      negative_ttl_(negative_ttl),
+      max_entries_(max_entries) {
+  MakeWeak();
+}
+
+LookupCache::~LookupCache() {
+  for (auto& item : entries_) {
+    for (GetAddrInfoReqWrap* waiter : item.second.waiters)
+      delete waiter;
+  }
+}
+
+void LookupCache::New(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args.IsConstructCall());
+  CHECK(args[0]->IsUint32());  // maxTtl
+  CHECK(args[1]->IsUint32());  // negativeTtl
+  CHECK(args[2]->IsUint32());  // maxEntries
+  Environment* env = Environment::GetCurrent(args);
+  new LookupCache(env,
+                  args.This(),
+                  args[0].As<Uint32>()->Value(),
+                  args[1].As<Uint32>()->Value(),
+                  args[2].As<Uint32>()->Value());
+}
+
+// lookup(req, hostname, family, hints, verbatim, channel) returns the
+// addresses of a cached result, the error code of a cached failure, or 0 once
+// req.oncomplete() is going to be called. With a ChannelWrap for `channel`
+// the name is resolved through it rather than with getaddrinfo().
+void LookupCache::Lookup(const FunctionCallbackInfo<Value>& args) {
+  LookupCache* cache;
+  ASSIGN_OR_RETURN_UNWRAP(&cache, args.Holder());
+  Environment* env = cache->env();
+
+  CHECK(args[0]->IsObject());
+  CHECK(args[1]->IsString());
+  CHECK(args[2]->IsInt32());
+  CHECK(args[3]->IsInt32());
+  CHECK(args[4]->IsBoolean());
+  Local<Object> req_wrap_obj = args[0].As<Object>();
+  node::Utf8Value hostname(env->isolate(), args[1]);
+  const int family = ToAddressFamily(args[2].As<Int32>()->Value());
+  const int32_t flags = args[3].As<Int32>()->Value();
+  const bool verbatim = args[4]->IsTrue();
+
+  ChannelWrap* channel = nullptr;
+  if (args[5]->IsObject())
+    ASSIGN_OR_RETURN_UNWRAP(&channel, args[5].As<Object>());
+
+  std::string key(*hostname, hostname.length());
+  key += '\0';
+  key += std::to_string(family) + ";" + std::to_string(flags) +
+         (verbatim ? ";verbatim" : "");
+
+  auto it = cache->entries_.find(key);
+  if (it != cache->entries_.end()) {
+    Entry& entry = it->second;
+    if (!entry.waiters.empty()) {
+      entry.waiters.push_back(
+          new GetAddrInfoReqWrap(env, req_wrap_obj, verbatim));
+      args.GetReturnValue().Set(0);
+      return;
+    }
+    if (entry.expiry > uv_now(env->event_loop())) {
+      if (entry.status != 0)
+        args.GetReturnValue().Set(entry.status);
+      else
+        args.GetReturnValue().Set(AddressesToArray(env, entry.addresses));
+      return;
+    }
+  } else {
+    cache->MakeRoom();
+  }
+
+  auto req_wrap = std::make_unique<GetAddrInfoReqWrap>(env,
+                                                       req_wrap_obj,
+                                                       verbatim);
+  int err = 0;
+  if (channel != nullptr) {
+    // Make sure the channel object stays alive during the lookup.
+    req_wrap_obj->Set(env->context(),
+                      env->channel_string(),
+                      channel->object()).FromJust();
+    (new ResolverLookup(cache, channel, key, *hostname, family, flags))
+        ->Start();
+  } else {
+    req_wrap->set_cache(cache, key);
+    err = DispatchGetAddrInfo(req_wrap.get(), *hostname, family, flags);
+  }
+  if (err != 0) {
+    cache->entries_.erase(key);
+    args.GetReturnValue().Set(err);
+    return;
+  }
+
+  cache->entries_[key].waiters.push_back(req_wrap.release());
+  if (cache->lookups_in_flight_++ == 0)
+    cache->ClearWeak();
+  args.GetReturnValue().Set(0);
+}
+
+void LookupCache::Complete(const std::string& key,
+                           int status,
+                           std::vector<std::string>&& addresses,
+                           uint64_t ttl) {
+  auto it = entries_.find(key);
+  CHECK(it != entries_.end());
+  std::vector<GetAddrInfoReqWrap*> waiters = std::move(it->second.waiters);
+  it->second.waiters.clear();
+  lookups_in_flight_--;
+
+  if (status != 0)
+    ttl = status == UV_EAI_NONAME || status == UV_EAI_NODATA ?
+        negative_ttl_ : 0;
+  if (ttl > 0) {
+    Entry& entry = it->second;
+    entry.status = status;
+    entry.addresses = addresses;
+    entry.expiry = uv_now(env()->event_loop()) + ttl;
+  } else {
+    entries_.erase(it);
+  }
+
+  // Callbacks may look names up again, so the entry is settled by now.
+  HandleScope handle_scope(env()->isolate());
+  Context::Scope context_scope(env()->context());
+  for (GetAddrInfoReqWrap* waiter : waiters) {
+    std::unique_ptr<GetAddrInfoReqWrap> req_wrap(waiter);
+    HandleScope scope(env()->isolate());
+    Local<Value> argv[] = {
+      Integer::New(env()->isolate(), status),
+      Null(env()->isolate())
+    };
+    if (status == 0)
+      argv[1] = AddressesToArray(env(), addresses);
+    req_wrap->MakeCallback(env()->oncomplete_string(), arraysize(argv), argv);
+  }
+
+  if (lookups_in_flight_ == 0)
+    MakeWeak();
+}
+
+// Drops expired entries once the cache is full, and then the first entries
+// that aren't being looked up if that wasn't enough.
+void LookupCache::MakeRoom() {
+  if (entries_.size() < max_entries_)
+    return;
+
+  const uint64_t now = uv_now(env()->event_loop());
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->second.waiters.empty() && it->second.expiry <= now)
+      it = entries_.erase(it);
+    else
+      ++it;
+  }
+  for (auto it = entries_.begin();
+       it != entries_.end() && entries_.size() >= max_entries_;) {
+    if (it->second.waiters.empty())
+      it = entries_.erase(it);
+    else
+      ++it;
+  }
+}
+
+
 void GetNameInfo(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
 
@@ -2206,6 +2669,17 @@ void Initialize(Local<Object> target,
               addrInfoWrapString,
               aiw->GetFunction(context).ToLocalChecked()).FromJust();
 
+  Local<FunctionTemplate> lookup_cache =
+      env->NewFunctionTemplate(LookupCache::New);
+  lookup_cache->InstanceTemplate()->SetInternalFieldCount(1);
+  env->SetProtoMethod(lookup_cache, "lookup", LookupCache::Lookup);
+  Local<String> lookupCacheString =
+      FIXED_ONE_BYTE_STRING(env->isolate(), "LookupCache");
+  lookup_cache->SetClassName(lookupCacheString);
+  target->Set(env->context(),
+              lookupCacheString,
+              lookup_cache->GetFunction(context).ToLocalChecked()).FromJust();
+
   Local<FunctionTemplate> niw =
       BaseObject::MakeLazilyInitializedJSTemplate(env);
   niw->Inherit(AsyncWrap::GetConstructorTemplate(env));
@@ -178,6 +178,43 @@ inline void Environment::AsyncHooks::clear_async_id_stack() {
   async_id_fields_[kExecutionAsyncId] = 0;
   async_id_fields_[kTriggerAsyncId] = 0;
   fields_[kStackLength] = 0;
+  clear_context_frames();
+}
+
+inline v8::Local<v8::Value> Environment::AsyncHooks::context_frame() {
+  if (context_frame_.IsEmpty())
+    return v8::Undefined(env()->isolate());
+  return context_frame_.Get(env()->isolate());
+}
+
+inline void Environment::AsyncHooks::set_context_frame(
+    v8::Local<v8::Value> frame) {
+  if (frame.IsEmpty() || frame->IsUndefined())
+    context_frame_.Reset();
+  else
+    context_frame_.Reset(env()->isolate(), frame);
+}
+
+inline void Environment::AsyncHooks::push_context_frame(
+    v8::Local<v8::Value> frame) {
+  context_frame_stack_.emplace_back(std::move(context_frame_));
+  set_context_frame(frame);
+}
+
+inline void Environment::AsyncHooks::pop_context_frame() {
+  // The stack can be shorter than expected if tracking started inside of a
+  // callback. Whatever was running then was in the root frame.
+  if (context_frame_stack_.empty()) {
+    context_frame_.Reset();
+    return;
+  }
+  context_frame_ = std::move(context_frame_stack_.back());
+  context_frame_stack_.pop_back();
+}
+
+inline void Environment::AsyncHooks::clear_context_frames() {
+  context_frame_.Reset();
+  context_frame_stack_.clear();
 }
 
 // The DefaultTriggerAsyncIdScope(AsyncWrap*) constructor is defined in
@@ -330,6 +367,13 @@ inline bool Environment::profiler_idle_notifier_started() const {
   return profiler_idle_notifier_started_;
 }
 
+inline void Environment::MarkPollWakeup() {
+  if (UNLIKELY(loop_poll_waiting_)) {
+    loop_poll_waiting_ = false;
+    loop_poll_wakeup_ = uv_hrtime();
+  }
+}
+
 inline v8::Isolate* Environment::isolate() const {
   return isolate_;
 }
@@ -538,6 +582,22 @@ inline void Environment::set_http_parser_buffer_in_use(bool in_use) {
   http_parser_buffer_in_use_ = in_use;
 }
 
+inline char* Environment::stream_read_buffer() const {
+  return stream_read_buffer_;
+}
+
+inline void Environment::set_stream_read_buffer(char* buffer) {
+  stream_read_buffer_ = buffer;
+}
+
+inline bool Environment::stream_read_buffer_in_use() const {
+  return stream_read_buffer_in_use_;
+}
+
+inline void Environment::set_stream_read_buffer_in_use(bool in_use) {
+  stream_read_buffer_in_use_ = in_use;
+}
+
 inline http2::Http2State* Environment::http2_state() const {
   return http2_state_.get();
 }
@@ -581,6 +641,10 @@ Environment::file_handle_read_wrap_freelist() {
   return file_handle_read_wrap_freelist_;
 }
 
+inline RequestMemoryPool* Environment::request_memory_pool() {
+  return request_memory_pool_;
+}
+
 inline std::shared_ptr<EnvironmentOptions> Environment::options() {
   return options_;
 }
@@ -5,6 +5,7 @@
 #include "node_file.h"
 #include "node_internals.h"
 #include "node_native_module.h"
+#include "node_perf.h"
 #include "node_platform.h"
 #include "node_worker.h"
 #include "tracing/agent.h"
@@ -210,6 +211,7 @@ Environment::Environment(IsolateData* isolate_data,
   }
 
   destroy_async_id_list_.reserve(512);
+  request_memory_pool_ = new RequestMemoryPool();
   performance_state_.reset(new performance::performance_state(isolate()));
   performance_state_->Mark(
       performance::NODE_PERFORMANCE_MILESTONE_ENVIRONMENT);
@@ -264,6 +266,8 @@ Environment::~Environment() {
   delete[] heap_statistics_buffer_;
   delete[] heap_space_statistics_buffer_;
   delete[] http_parser_buffer_;
+  free(stream_read_buffer_);
+  request_memory_pool_->Orphan();
 
   TRACE_EVENT_NESTABLE_ASYNC_END0(
     TRACING_CATEGORY_NODE1(environment), "Environment", this);
@@ -316,6 +320,27 @@ void Environment::Start(const std::vector<std::string>& args,
   uv_unref(reinterpret_cast<uv_handle_t*>(&idle_prepare_handle_));
   uv_unref(reinterpret_cast<uv_handle_t*>(&idle_check_handle_));
 
+  uv_prepare_init(event_loop(), &idle_gc_prepare_handle_);
+  uv_timer_init(event_loop(), &idle_gc_timer_handle_);
+  uv_unref(reinterpret_cast<uv_handle_t*>(&idle_gc_prepare_handle_));
+  uv_unref(reinterpret_cast<uv_handle_t*>(&idle_gc_timer_handle_));
+
+  // Samples the threadpool for the node.threadpool trace category, see
+  // performance::TraceThreadpoolStats().
+  uv_check_init(event_loop(), &threadpool_check_handle_);
+  uv_unref(reinterpret_cast<uv_handle_t*>(&threadpool_check_handle_));
+  uv_check_start(&threadpool_check_handle_, [](uv_check_t* handle) {
+    Environment* env =
+        ContainerOf(&Environment::threadpool_check_handle_, handle);
+    performance::TraceThreadpoolStats(env);
+  });
+
+  // Started by AddEventLoopMonitor().
+  uv_prepare_init(event_loop(), &loop_monitor_prepare_handle_);
+  uv_check_init(event_loop(), &loop_monitor_check_handle_);
+  uv_unref(reinterpret_cast<uv_handle_t*>(&loop_monitor_prepare_handle_));
+  uv_unref(reinterpret_cast<uv_handle_t*>(&loop_monitor_check_handle_));
+
   // Register clean-up cb to be called to clean up the handles
   // when the environment is freed, note that they are not cleaned in
   // the one environment per process setup, but will be called in
@@ -370,6 +395,26 @@ void Environment::RegisterHandleCleanups() {
       reinterpret_cast<uv_handle_t*>(&idle_check_handle_),
       close_and_finish,
       nullptr);
+  RegisterHandleCleanup(
+      reinterpret_cast<uv_handle_t*>(&idle_gc_prepare_handle_),
+      close_and_finish,
+      nullptr);
+  RegisterHandleCleanup(
+      reinterpret_cast<uv_handle_t*>(&idle_gc_timer_handle_),
+      close_and_finish,
+      nullptr);
+  RegisterHandleCleanup(
+      reinterpret_cast<uv_handle_t*>(&threadpool_check_handle_),
+      close_and_finish,
+      nullptr);
+  RegisterHandleCleanup(
+      reinterpret_cast<uv_handle_t*>(&loop_monitor_prepare_handle_),
+      close_and_finish,
+      nullptr);
+  RegisterHandleCleanup(
+      reinterpret_cast<uv_handle_t*>(&loop_monitor_check_handle_),
+      close_and_finish,
+      nullptr);
 }
 
 void Environment::CleanupHandles() {
@@ -415,6 +460,97 @@ void Environment::StopProfilerIdleNotifier() {
   uv_check_stop(&idle_check_handle_);
 }
 
+void Environment::AddEventLoopMonitor(performance::EventLoopMonitor* monitor) {
+  loop_monitors_.push_back(monitor);
+  if (loop_monitors_.size() > 1)
+    return;
+
+  // The handles are started after the ones of the Environment, so libuv runs
+  // them first (see StartProfilerIdleNotifier()): the measured poll phase
+  // includes the idle GC work and ends before setImmediate() callbacks run.
+  uv_prepare_start(&loop_monitor_prepare_handle_, [](uv_prepare_t* handle) {
+    Environment* env =
+        ContainerOf(&Environment::loop_monitor_prepare_handle_, handle);
+    uint64_t now = uv_hrtime();
+    for (performance::EventLoopMonitor* monitor : env->loop_monitors_)
+      monitor->OnPrepare(now);
+    env->loop_poll_start_ = now;
+    env->loop_poll_waiting_ = true;
+  });
+
+  uv_check_start(&loop_monitor_check_handle_, [](uv_check_t* handle) {
+    Environment* env =
+        ContainerOf(&Environment::loop_monitor_check_handle_, handle);
+    uint64_t now = uv_hrtime();
+    // Nothing called into JS, so the whole poll phase was spent waiting.
+    if (env->loop_poll_waiting_) {
+      env->loop_poll_waiting_ = false;
+      env->loop_poll_wakeup_ = now;
+    }
+    for (performance::EventLoopMonitor* monitor : env->loop_monitors_)
+      monitor->OnCheck(env->loop_poll_start_, env->loop_poll_wakeup_, now);
+  });
+}
+
+void Environment::RemoveEventLoopMonitor(
+    performance::EventLoopMonitor* monitor) {
+  auto it = std::find(loop_monitors_.begin(), loop_monitors_.end(), monitor);
+  CHECK(it != loop_monitors_.end());
+  loop_monitors_.erase(it);
+  if (!loop_monitors_.empty())
+    return;
+
+  uv_prepare_stop(&loop_monitor_prepare_handle_);
+  uv_check_stop(&loop_monitor_check_handle_);
+  loop_poll_start_ = 0;
+  loop_poll_waiting_ = false;
+}
+
+void Environment::StartIdleGcNotifier() {
+  uv_prepare_start(&idle_gc_prepare_handle_, IdleGcNotification);
+}
+
+// Runs right before the loop blocks in poll. The engine gets the time until
+// the next timer is due, capped so a loop with nothing scheduled still wakes
+// up regularly. When it reports more work left, a timer wakes the loop up at
+// the time the engine asked for, and the work continues in that iteration;
+// when it reports none, nothing is armed until the next time the loop idles.
+void Environment::IdleGcNotification(uv_prepare_t* handle) {
+  static const int kMaxIdleGcTimeMs = 10;
+  Environment* env = ContainerOf(&Environment::idle_gc_prepare_handle_, handle);
+
+  // Woken up for something else while backing off
+  if (uv_is_active(reinterpret_cast<uv_handle_t*>(&env->idle_gc_timer_handle_)))
+    return;
+
+  int timeout = uv_backend_timeout(env->event_loop());
+  if (timeout == 0) {
+    // Not idle, there are callbacks to run right away
+    return;
+  }
+
+  int idle_time_ms = timeout < 0 ? kMaxIdleGcTimeMs :
+                                   std::min(timeout, kMaxIdleGcTimeMs);
+  // Same clock as NodePlatform::MonotonicallyIncreasingTime()
+  double deadline_in_seconds = uv_hrtime() / 1e9 + idle_time_ms / 1e3;
+#ifdef NODE_ENGINE_CHAKRACORE
+  int next_idle_ms =
+      v8::chakrashim::IdleCollectGarbage(env->isolate(), deadline_in_seconds);
+#else
+  int next_idle_ms =
+      env->isolate()->IdleNotificationDeadline(deadline_in_seconds) ?
+          -1 : kMaxIdleGcTimeMs;
+#endif
+  if (next_idle_ms < 0)
+    return;
+
+  // At least a millisecond, so the loop still gets to poll in between
+  uv_timer_start(&env->idle_gc_timer_handle_,
+                 [](uv_timer_t*) {},
+                 std::max(next_idle_ms, 1),
+                 0);
+}
+
 void Environment::PrintSyncTrace() const {
   if (!options_->trace_sync_io)
     return;
@@ -56,6 +56,7 @@ class FileHandleReadWrap;
 }
 
 namespace performance {
+class EventLoopMonitor;
 class performance_state;
 }
 
@@ -104,6 +105,7 @@ constexpr size_t kFsStatsBufferLength = kFsStatsFieldsNumber * 2;
 #define PER_ISOLATE_PRIVATE_SYMBOL_PROPERTIES(V)                              \
   V(alpn_buffer_private_symbol, "node:alpnBuffer")                            \
   V(arrow_message_private_symbol, "node:arrowMessage")                        \
+  V(context_frame_private_symbol, "node:contextFrame")                        \
   V(contextify_context_private_symbol, "node:contextify:context")             \
   V(contextify_global_private_symbol, "node:contextify:global")               \
   V(decorated_private_symbol, "node:decorated")                               \
@@ -214,6 +216,7 @@ constexpr size_t kFsStatsBufferLength = kFsStatsFieldsNumber * 2;
   V(ocsp_request_string, "OCSPRequest")                                        \
   V(oncertcb_string, "oncertcb")                                               \
   V(onchange_string, "onchange")                                               \
+  V(onchanges_string, "onchanges")                                             \
   V(onclienthello_string, "onclienthello")                                     \
   V(oncomplete_string, "oncomplete")                                           \
   V(onconnection_string, "onconnection")                                       \
@@ -223,6 +226,7 @@ constexpr size_t kFsStatsBufferLength = kFsStatsFieldsNumber * 2;
   V(onhandshakedone_string, "onhandshakedone")                                 \
   V(onhandshakestart_string, "onhandshakestart")                               \
   V(onmessage_string, "onmessage")                                             \
+  V(onmessages_string, "onmessages")                                           \
   V(onnewsession_string, "onnewsession")                                       \
   V(onocspresponse_string, "onocspresponse")                                   \
   V(onread_string, "onread")                                                   \
@@ -373,6 +377,7 @@ constexpr size_t kFsStatsBufferLength = kFsStatsFieldsNumber * 2;
   V(write_wrap_template, v8::ObjectTemplate)                                   \
 
 class Environment;
+class RequestMemoryPool;
 
 class IsolateData {
  public:
@@ -398,6 +403,8 @@ class IsolateData {
 #undef VP
 
   std::unordered_map<nghttp2_rcbuf*, v8::Eternal<v8::String>> http2_static_strs;
+  std::unique_ptr<v8::Eternal<v8::String>[]> http1_known_header_names;
+  std::unordered_map<std::string, v8::Eternal<v8::String>> http1_header_names;
   inline v8::Isolate* isolate() const;
 
  private:
@@ -456,6 +463,7 @@ class Environment {
       kPromiseResolve,
       kTotals,
       kCheck,
+      kContextFrames,
       kStackLength,
       kFieldsCount,
     };
@@ -481,6 +489,16 @@ class Environment {
     inline bool pop_async_id(double async_id);
     inline void clear_async_id_stack();  // Used in fatal exceptions.
 
+    // The context frame is an opaque value that callbacks run in the frame of
+    // whoever created their resource. It is only tracked once kContextFrames
+    // is set, and undefined is the root frame.
+    inline v8::Local<v8::Value> context_frame();
+    inline void set_context_frame(v8::Local<v8::Value> frame);
+    // Enter `frame` and go back to the current one on the matching pop.
+    inline void push_context_frame(v8::Local<v8::Value> frame);
+    inline void pop_context_frame();
+    inline void clear_context_frames();
+
     // Used to set the kDefaultTriggerAsyncId in a scope. This is instead of
     // passing the trigger_async_id along with other constructor arguments.
     class DefaultTriggerAsyncIdScope {
@@ -513,6 +531,10 @@ class Environment {
     AliasedBuffer<uint32_t, v8::Uint32Array> fields_;
     // Attached to a Float64Array that tracks the state of async resources.
     AliasedBuffer<double, v8::Float64Array> async_id_fields_;
+    // The current context frame, empty for the root frame, and the ones to
+    // go back to.
+    v8::Global<v8::Value> context_frame_;
+    std::vector<v8::Global<v8::Value>> context_frame_stack_;
 
     void grow_async_ids_stack();
 
@@ -633,6 +655,18 @@ class Environment {
   void StopProfilerIdleNotifier();
   inline bool profiler_idle_notifier_started() const;
 
+  // Hands the time the event loop would spend blocked in poll to the engine
+  // for garbage collection work, see IdleGcNotification().
+  void StartIdleGcNotifier();
+
+  // Reports each event loop iteration to the monitor until it is removed,
+  // see performance::EventLoopMonitor.
+  void AddEventLoopMonitor(performance::EventLoopMonitor* monitor);
+  void RemoveEventLoopMonitor(performance::EventLoopMonitor* monitor);
+  // Ends the wait in poll that is being measured, on the first callback
+  // into JS after it.
+  inline void MarkPollWakeup();
+
   inline v8::Isolate* isolate() const;
   inline uv_loop_t* event_loop() const;
   inline uint32_t watched_providers() const;
@@ -707,6 +741,11 @@ class Environment {
   inline bool http_parser_buffer_in_use() const;
   inline void set_http_parser_buffer_in_use(bool in_use);
 
+  inline char* stream_read_buffer() const;
+  inline void set_stream_read_buffer(char* buffer);
+  inline bool stream_read_buffer_in_use() const;
+  inline void set_stream_read_buffer_in_use(bool in_use);
+
   inline http2::Http2State* http2_state() const;
   inline void set_http2_state(std::unique_ptr<http2::Http2State> state);
 
@@ -837,6 +876,7 @@ class Environment {
 
   inline HandleWrapQueue* handle_wrap_queue() { return &handle_wrap_queue_; }
   inline ReqWrapQueue* req_wrap_queue() { return &req_wrap_queue_; }
+  inline RequestMemoryPool* request_memory_pool();
 
   void AddPromiseHook(promise_hook_func fn, void* arg);
   bool RemovePromiseHook(promise_hook_func fn, void* arg);
@@ -929,6 +969,15 @@ class Environment {
   uv_prepare_t idle_prepare_handle_;
   uv_check_t idle_check_handle_;
   bool profiler_idle_notifier_started_ = false;
+  uv_prepare_t idle_gc_prepare_handle_;
+  uv_timer_t idle_gc_timer_handle_;
+  uv_check_t threadpool_check_handle_;
+  uv_prepare_t loop_monitor_prepare_handle_;
+  uv_check_t loop_monitor_check_handle_;
+  std::vector<performance::EventLoopMonitor*> loop_monitors_;
+  uint64_t loop_poll_start_ = 0;
+  uint64_t loop_poll_wakeup_ = 0;
+  bool loop_poll_waiting_ = false;
 
   AsyncHooks async_hooks_;
   ImmediateInfo immediate_info_;
@@ -981,12 +1030,15 @@ class Environment {
   std::list<HandleCleanup> handle_cleanup_queue_;
   int handle_cleanup_waiting_ = 0;
   int request_waiting_ = 0;
+  RequestMemoryPool* request_memory_pool_;
 
   double* heap_statistics_buffer_ = nullptr;
   double* heap_space_statistics_buffer_ = nullptr;
 
   char* http_parser_buffer_;
   bool http_parser_buffer_in_use_ = false;
+  char* stream_read_buffer_ = nullptr;
+  bool stream_read_buffer_in_use_ = false;
   std::unique_ptr<http2::Http2State> http2_state_;
 
   bool debug_enabled_[static_cast<int>(DebugCategory::CATEGORY_COUNT)] = {0};
@@ -1025,6 +1077,7 @@ class Environment {
   std::vector<NativeImmediateCallback> native_immediate_callbacks_;
   void RunAndClearNativeImmediates();
   static void CheckImmediate(uv_check_t* handle);
+  static void IdleGcNotification(uv_prepare_t* handle);
 
   struct CleanupHookCallback {
     void (*fn_)(void*);
@@ -25,11 +25,27 @@
 #include "node.h"
 #include "node_internals.h"
 #include "handle_wrap.h"
+#include "node_file.h"
 #include "string_bytes.h"
 
+#ifdef __linux__
+#include "node_mutex.h"
+
+#include <errno.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#endif
 
 namespace node {
 
+using v8::Array;
 using v8::Context;
 using v8::DontDelete;
 using v8::DontEnum;
@@ -37,6 +53,7 @@ using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::HandleScope;
 using v8::Integer;
+using v8::Isolate;
 using v8::Local;
 using v8::MaybeLocal;
 using v8::Object;
@@ -48,6 +65,156 @@ using v8::Value;
 
 namespace {
 
+#ifdef __linux__
+class FSEventWrap;
+
+// inotify only watches single directories, so a recursive watch of a
+// directory on Linux keeps one inotify instance with a watch for each
+// directory in the tree. The paths of the watched directories are relative
+// to the root and shared with the thread pool, which adds the watches for
+// directories created after the watch started.
+class InotifyTree {
+ public:
+  static const uint32_t kEvents = IN_ATTRIB | IN_CREATE | IN_MODIFY |
+                                  IN_DELETE | IN_DELETE_SELF | IN_MOVE_SELF |
+                                  IN_MOVED_FROM | IN_MOVED_TO;
+
+  // Watches the root, and returns UV_ENOTDIR if it is not a directory.
+  static int New(const char* root, std::shared_ptr<InotifyTree>* tree) {
+    int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd == -1)
+      return -errno;
+    int wd = inotify_add_watch(fd, root, kEvents | IN_ONLYDIR);
+    if (wd == -1) {
+      int err = -errno;
+      close(fd);
+      return err;
+    }
+    tree->reset(new InotifyTree(fd, root));
+    (*tree)->directories_.emplace(wd, std::string());
+    return 0;
+  }
+
+  ~InotifyTree() {
+    close(fd_);
+  }
+
+  int fd() const { return fd_; }
+  const std::string& root() const { return root_; }
+
+  FSEventWrap* owner() const { return owner_; }
+  void set_owner(FSEventWrap* owner) { owner_ = owner; }
+
+  // Events for the directory can be read as soon as the watch exists, so it
+  // is recorded before they can be looked up.
+  int AddWatch(const std::string& directory) {
+    Mutex::ScopedLock lock(mutex_);
+    int wd = inotify_add_watch(fd_, FullPath(directory).c_str(),
+                               kEvents | IN_ONLYDIR | IN_DONT_FOLLOW);
+    if (wd == -1)
+      return -errno;
+    directories_[wd] = directory;
+    return 0;
+  }
+
+  bool Lookup(int wd, std::string* directory) {
+    Mutex::ScopedLock lock(mutex_);
+    auto it = directories_.find(wd);
+    if (it == directories_.end())
+      return false;
+    *directory = it->second;
+    return true;
+  }
+
+  void Forget(int wd) {
+    Mutex::ScopedLock lock(mutex_);
+    directories_.erase(wd);
+  }
+
+  // Stops watching a directory that was moved away, and everything below it.
+  void RemoveSubtree(const std::string& directory) {
+    Mutex::ScopedLock lock(mutex_);
+    for (auto it = directories_.begin(); it != directories_.end();) {
+      const std::string& path = it->second;
+      if (path.compare(0, directory.size(), directory) == 0 &&
+          (path.size() == directory.size() ||
+           path[directory.size()] == '/')) {
+        inotify_rm_watch(fd_, it->first);
+        it = directories_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  // Watches a directory and everything below it. The names of the entries
+  // found are added to |entries| unless it is null. An empty directory is
+  // the root, which is watched already.
+  int Walk(std::string&& root_directory, std::vector<std::string>* entries) {
+    std::vector<std::string> pending;
+    pending.push_back(std::move(root_directory));
+    while (!pending.empty()) {
+      const std::string directory = std::move(pending.back());
+      pending.pop_back();
+
+      if (!directory.empty()) {
+        int err = AddWatch(directory);
+        if (err == UV_ENOSPC || err == UV_ENOMEM)
+          return err;
+        if (err != 0)
+          continue;  // Removed or replaced since it was found.
+      }
+
+      uv_fs_t req;
+      // Synchronous libuv calls don't use the loop.
+      if (uv_fs_scandir(nullptr, &req, FullPath(directory).c_str(), 0,
+                        nullptr) >= 0) {
+        uv_dirent_t ent;
+        while (uv_fs_scandir_next(&req, &ent) != UV_EOF) {
+          std::string entry = directory.empty() ?
+              std::string(ent.name) : directory + '/' + ent.name;
+          if (entries != nullptr)
+            entries->push_back(entry);
+          if (ent.type == UV_DIRENT_DIR ||
+              (ent.type == UV_DIRENT_UNKNOWN && IsDirectory(entry))) {
+            pending.push_back(std::move(entry));
+          }
+        }
+      }
+      uv_fs_req_cleanup(&req);
+    }
+    return 0;
+  }
+
+  std::string FullPath(const std::string& relative) const {
+    if (relative.empty())
+      return root_;
+    if (!root_.empty() && root_.back() == '/')
+      return root_ + relative;
+    return root_ + '/' + relative;
+  }
+
+ private:
+  InotifyTree(int fd, const char* root) : fd_(fd), root_(root) {}
+
+  bool IsDirectory(const std::string& entry) const {
+    uv_fs_t req;
+    int err = uv_fs_lstat(nullptr, &req, FullPath(entry).c_str(), nullptr);
+    bool is_directory = err == 0 && S_ISDIR(req.statbuf.st_mode);
+    uv_fs_req_cleanup(&req);
+    return is_directory;
+  }
+
+  const int fd_;
+  const std::string root_;
+  FSEventWrap* owner_ = nullptr;
+  Mutex mutex_;
+  std::unordered_map<int, std::string> directories_;
+
+  DISALLOW_COPY_AND_ASSIGN(InotifyTree);
+};
+#endif  // __linux__
+
 class FSEventWrap: public HandleWrap {
  public:
   static void Initialize(Local<Object> target,
@@ -71,8 +238,33 @@ class FSEventWrap: public HandleWrap {
   static void OnEvent(uv_fs_event_t* handle, const char* filename, int events,
     int status);
 
-  uv_fs_event_t handle_;
+#ifdef __linux__
+  class TreeWalk;
+
+  int StartTree(std::shared_ptr<InotifyTree>&& tree);
+  static void OnTreeEvent(uv_poll_t* handle, int status, int events);
+  void ReadTreeEvents();
+  void OnTreeWalked(int status, const std::vector<std::string>& entries);
+  void QueueChange(const std::string& filename, int events);
+  void FlushChanges();
+  void EmitError(int status);
+#endif
+
+  union {
+    uv_fs_event_t handle_;
+#ifdef __linux__
+    uv_poll_t poll_handle_;  // For recursive watches of directories.
+#endif
+  };
   enum encoding encoding_ = kDefaultEncoding;
+
+#ifdef __linux__
+  std::shared_ptr<InotifyTree> tree_;
+  // Changes read since the last call into JS, merged by filename. An empty
+  // filename is reported as null.
+  std::vector<std::pair<std::string, int>> changes_;
+  std::unordered_map<std::string, size_t> change_index_;
+#endif
 };
 
 
@@ -86,6 +278,10 @@ FSEventWrap::FSEventWrap(Environment* env, Local<Object> object)
 
 
 FSEventWrap::~FSEventWrap() {
+#ifdef __linux__
+  if (tree_)
+    tree_->set_owner(nullptr);
+#endif
 }
 
 void FSEventWrap::GetInitialized(const FunctionCallbackInfo<Value>& args) {
@@ -153,12 +349,34 @@ void FSEventWrap::Start(const FunctionCallbackInfo<Value>& args) {
 
   wrap->encoding_ = ParseEncoding(env->isolate(), args[3], kDefaultEncoding);
 
-  int err = uv_fs_event_init(wrap->env()->event_loop(), &wrap->handle_);
-  if (err != 0) {
-    return args.GetReturnValue().Set(err);
+  // UV_ENOTDIR leaves the path to libuv.
+  int err = UV_ENOTDIR;
+#ifdef __linux__
+  // libuv doesn't watch subdirectories on Linux, so recursive watches of
+  // directories are handled here.
+  if (flags & UV_FS_EVENT_RECURSIVE) {
+    std::shared_ptr<InotifyTree> tree;
+    err = InotifyTree::New(*path, &tree);
+    if (err == 0) {
+      err = uv_poll_init(wrap->env()->event_loop(), &wrap->poll_handle_,
+                         tree->fd());
+      if (err != 0)
+        return args.GetReturnValue().Set(err);
+      err = wrap->StartTree(std::move(tree));
+    } else if (err != UV_ENOTDIR) {
+      return args.GetReturnValue().Set(err);
+    }
   }
+#endif
+
+  if (err == UV_ENOTDIR) {
+    err = uv_fs_event_init(wrap->env()->event_loop(), &wrap->handle_);
+    if (err != 0) {
+      return args.GetReturnValue().Set(err);
+    }
 
-  err = uv_fs_event_start(&wrap->handle_, OnEvent, *path, flags);
+    err = uv_fs_event_start(&wrap->handle_, OnEvent, *path, flags);
+  }
   wrap->MarkAsInitialized();
 
   if (err != 0) {
@@ -185,6 +403,9 @@ void FSEventWrap::OnEvent(uv_fs_event_t* handle, const char* filename,
 
   CHECK_EQ(wrap->persistent().IsEmpty(), false);
 
+  if (status == 0)
+    fs::ClearModuleResolutionCache();
+
   // We're in a bind here. libuv can set both UV_RENAME and UV_CHANGE but
   // the Node API only lets us pass a single event to JS land.
   //
@@ -234,6 +455,224 @@ void FSEventWrap::OnEvent(uv_fs_event_t* handle, const char* filename,
   wrap->MakeCallback(env->onchange_string(), arraysize(argv), argv);
 }
 
+#ifdef __linux__
+// Adds watches for a directory that appeared after the watch started, and
+// the directories below it, on the thread pool. Their entries are reported,
+// since they may have been created before the directory was watched.
+class FSEventWrap::TreeWalk : public ThreadPoolWork {
+ public:
+  TreeWalk(Environment* env,
+           const std::shared_ptr<InotifyTree>& tree,
+           std::string&& directory)
+      : ThreadPoolWork(env),
+        tree_(tree),
+        directory_(std::move(directory)) {}
+
+  void DoThreadPoolWork() override {
+    status_ = tree_->Walk(std::move(directory_), &entries_);
+  }
+
+  void AfterThreadPoolWork(int status) override {
+    std::unique_ptr<TreeWalk> self(this);
+    CHECK_EQ(status, 0);
+    FSEventWrap* wrap = tree_->owner();
+    if (wrap != nullptr)
+      wrap->OnTreeWalked(status_, entries_);
+  }
+
+ private:
+  std::shared_ptr<InotifyTree> tree_;
+  std::string directory_;
+  int status_ = 0;
+  std::vector<std::string> entries_;
+};
+
+
+int FSEventWrap::StartTree(std::shared_ptr<InotifyTree>&& tree) {
+  // The inotify instance is closed once the handle is and the walks are done.
+  tree_ = std::move(tree);
+  tree_->set_owner(this);
+
+  // The directories that already exist are watched before fs.watch()
+  // returns, so that changes made right after it are not missed.
+  int err = tree_->Walk(std::string(), nullptr);
+  if (err != 0)
+    return err;
+
+  return uv_poll_start(&poll_handle_, UV_READABLE, OnTreeEvent);
+}
+
+
+void FSEventWrap::OnTreeEvent(uv_poll_t* handle, int status, int events) {
+  FSEventWrap* wrap = static_cast<FSEventWrap*>(handle->data);
+  if (status != 0)
+    return wrap->EmitError(status);
+  wrap->ReadTreeEvents();
+}
+
+
+// Reads all the events that are queued, so that each turn of the loop calls
+// into JS at most once however many events there are.
+void FSEventWrap::ReadTreeEvents() {
+  alignas(inotify_event) char buf[4096];
+  std::vector<std::string> new_directories;
+  std::string directory;
+
+  for (;;) {
+    ssize_t size;
+    do
+      size = read(tree_->fd(), buf, sizeof(buf));
+    while (size == -1 && errno == EINTR);
+
+    if (size == -1) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+        break;
+      return EmitError(-errno);
+    }
+    CHECK_GT(size, 0);
+
+    for (const char* p = buf; p < buf + size;) {
+      const inotify_event* e = reinterpret_cast<const inotify_event*>(p);
+      p += sizeof(*e) + e->len;
+
+      if (e->mask & IN_Q_OVERFLOW) {
+        // Events were dropped, so all that can be said is that something in
+        // the tree changed.
+        QueueChange(std::string(), UV_RENAME);
+        continue;
+      }
+
+      if (!tree_->Lookup(e->wd, &directory))
+        continue;
+
+      if (e->mask & IN_IGNORED) {
+        tree_->Forget(e->wd);
+        continue;
+      }
+
+      int events = 0;
+      if (e->mask & (IN_ATTRIB | IN_MODIFY))
+        events |= UV_CHANGE;
+      if (e->mask & ~(IN_ATTRIB | IN_MODIFY | IN_ISDIR))
+        events |= UV_RENAME;
+
+      if (e->len == 0) {
+        // Subdirectories are reported by their parents, and the root by its
+        // name, as libuv does.
+        if (directory.empty()) {
+          const std::string& root = tree_->root();
+          QueueChange(root.substr(root.find_last_of('/') + 1), events);
+        }
+        continue;
+      }
+
+      std::string filename =
+          directory.empty() ? std::string(e->name) : directory + '/' + e->name;
+      if (e->mask & IN_ISDIR) {
+        if (e->mask & (IN_CREATE | IN_MOVED_TO))
+          new_directories.push_back(filename);
+        else if (e->mask & IN_MOVED_FROM)
+          tree_->RemoveSubtree(filename);
+      }
+      QueueChange(filename, events);
+    }
+  }
+
+  for (std::string& directory : new_directories)
+    (new TreeWalk(env(), tree_, std::move(directory)))->ScheduleWork();
+
+  FlushChanges();
+}
+
+
+void FSEventWrap::OnTreeWalked(int status,
+                               const std::vector<std::string>& entries) {
+  if (IsHandleClosing())
+    return;
+  if (status != 0)
+    return EmitError(status);
+
+  for (const std::string& entry : entries)
+    QueueChange(entry, UV_RENAME);
+  FlushChanges();
+}
+
+
+void FSEventWrap::QueueChange(const std::string& filename, int events) {
+  auto it = change_index_.find(filename);
+  if (it != change_index_.end()) {
+    changes_[it->second].second |= events;
+    return;
+  }
+  change_index_.emplace(filename, changes_.size());
+  changes_.emplace_back(filename, events);
+}
+
+
+// Calls onchanges(eventTypes, filenames) with the changes queued so far.
+void FSEventWrap::FlushChanges() {
+  if (changes_.empty())
+    return;
+
+  Environment* env = this->env();
+  Isolate* isolate = env->isolate();
+  HandleScope handle_scope(isolate);
+  Context::Scope context_scope(env->context());
+
+  fs::ClearModuleResolutionCache();
+
+  const size_t count = changes_.size();
+  std::vector<Local<Value>> event_types(count);
+  std::vector<Local<Value>> filenames(count);
+  for (size_t i = 0; i < count; i++) {
+    const std::string& filename = changes_[i].first;
+    // As in OnEvent(), a rename implies a change.
+    if (changes_[i].second & UV_RENAME)
+      event_types[i] = env->rename_string();
+    else
+      event_types[i] = env->change_string();
+
+    if (filename.empty()) {
+      filenames[i] = Null(isolate);
+      continue;
+    }
+    Local<Value> error;
+    MaybeLocal<Value> fn = StringBytes::Encode(isolate,
+                                               filename.data(),
+                                               filename.size(),
+                                               encoding_,
+                                               &error);
+    if (fn.IsEmpty()) {
+      fn = StringBytes::Encode(isolate, filename.data(), filename.size(),
+                               BUFFER, &error);
+    }
+    filenames[i] = fn.ToLocalChecked();
+  }
+  changes_.clear();
+  change_index_.clear();
+
+  Local<Value> argv[] = {
+    Array::New(isolate, event_types.data(), count),
+    Array::New(isolate, filenames.data(), count)
+  };
+  MakeCallback(env->onchanges_string(), arraysize(argv), argv);
+}
+
+
+void FSEventWrap::EmitError(int status) {
+  Isolate* isolate = env()->isolate();
+  HandleScope handle_scope(isolate);
+  Context::Scope context_scope(env()->context());
+
+  Local<Value> argv[] = {
+    Integer::New(isolate, status),
+    String::Empty(isolate),
+    Null(isolate)
+  };
+  MakeCallback(env()->onchange_string(), arraysize(argv), argv);
+}
+#endif  // __linux__
+
 }  // anonymous namespace
 }  // namespace node
 
@@ -0,0 +1,97 @@
+#ifndef SRC_HISTOGRAM_INL_H_
+#define SRC_HISTOGRAM_INL_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include "histogram.h"
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+namespace node {
+
+Histogram::Histogram() {
+  Reset();
+}
+
+void Histogram::Record(uint64_t value) {
+  counts_[BucketIndex(value)]++;
+  count_++;
+  min_ = std::min(min_, value);
+  max_ = std::max(max_, value);
+  double delta = value - mean_;
+  mean_ += delta / count_;
+  m2_ += delta * (value - mean_);
+}
+
+void Histogram::Reset() {
+  count_ = 0;
+  min_ = UINT64_MAX;
+  max_ = 0;
+  mean_ = 0;
+  m2_ = 0;
+  memset(counts_, 0, sizeof(counts_));
+}
+
+double Histogram::Stddev() const {
+  return count_ == 0 ? 0 : sqrt(m2_ / count_);
+}
+
+uint64_t Histogram::Percentile(double percentile) const {
+  if (count_ == 0)
+    return 0;
+  if (percentile <= 0)
+    return min_;
+
+  uint64_t target = static_cast<uint64_t>(
+      ceil(count_ * std::min(percentile, 100.0) / 100));
+  target = std::max<uint64_t>(target, 1);
+
+  uint64_t seen = 0;
+  for (size_t i = 0; i < kBuckets - 1; i++) {
+    seen += counts_[i];
+    if (seen >= target)
+      return std::min(BucketMax(i), max_);
+  }
+  return max_;
+}
+
+template <typename Fn>
+void Histogram::Percentiles(Fn&& fn) const {
+  fn(0.0, Min());
+  uint64_t seen = 0;
+  for (size_t i = 0; i < kBuckets && seen < count_; i++) {
+    if (counts_[i] == 0)
+      continue;
+    seen += counts_[i];
+    fn(100.0 * seen / count_,
+       i == kBuckets - 1 ? max_ : std::min(BucketMax(i), max_));
+  }
+}
+
+// Values below 2 * kSubBuckets have a bucket each. Above that, the value is
+// shifted right until it has kSubBucketBits + 1 bits, and each shift moves
+// on to the next kSubBuckets buckets.
+size_t Histogram::BucketIndex(uint64_t value) {
+  static const uint64_t kLimit = (static_cast<uint64_t>(1) << kValueBits) - 1;
+  value = std::min(value, kLimit);
+  size_t shift = 0;
+  while ((value >> shift) >= 2 * kSubBuckets)
+    shift++;
+  return shift * kSubBuckets + static_cast<size_t>(value >> shift);
+}
+
+uint64_t Histogram::BucketMax(size_t index) {
+  if (index < 2 * kSubBuckets)
+    return index;
+  size_t shift = index / kSubBuckets - 1;
+  uint64_t sub_bucket = index % kSubBuckets + kSubBuckets;
+  return ((sub_bucket + 1) << shift) - 1;
+}
+
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_HISTOGRAM_INL_H_
@@ -0,0 +1,61 @@
+#ifndef SRC_HISTOGRAM_H_
+#define SRC_HISTOGRAM_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace node {
+
+// A fixed size histogram of non-negative integers, such as durations in
+// nanoseconds. As in HdrHistogram, every power of two range is split into
+// kSubBuckets linear buckets, so a percentile is accurate to within
+// 1/kSubBuckets of its value. Count, min, max, mean and stddev are exact.
+// Values from 2^kValueBits on are counted in the last bucket.
+class Histogram {
+ public:
+  static const int kSubBucketBits = 6;
+  static const size_t kSubBuckets = 1 << kSubBucketBits;
+  static const int kValueBits = 36;
+  static const size_t kBuckets =
+      static_cast<size_t>(kValueBits - kSubBucketBits + 1) << kSubBucketBits;
+
+  inline Histogram();
+
+  inline void Record(uint64_t value);
+  inline void Reset();
+
+  uint64_t Count() const { return count_; }
+  uint64_t Min() const { return count_ == 0 ? 0 : min_; }
+  uint64_t Max() const { return max_; }
+  double Mean() const { return mean_; }
+  inline double Stddev() const;
+
+  // The highest value that the given percentage (0 to 100) of the recorded
+  // values is less than or equal to, 0 if nothing was recorded.
+  inline uint64_t Percentile(double percentile) const;
+
+  // Calls fn(percentile, value) for the minimum and then for each bucket
+  // that has values, with the percentage of values up to that bucket.
+  template <typename Fn>
+  inline void Percentiles(Fn&& fn) const;
+
+ private:
+  static inline size_t BucketIndex(uint64_t value);
+  static inline uint64_t BucketMax(size_t index);
+
+  uint64_t count_;
+  uint64_t min_;
+  uint64_t max_;
+  // Running mean and sum of squared differences, see Welford's method.
+  double mean_;
+  double m2_;
+  uint64_t counts_[kBuckets];
+};
+
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_HISTOGRAM_H_
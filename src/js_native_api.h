@@ -478,6 +478,40 @@ NAPI_EXTERN napi_status napi_add_finalizer(napi_env env,
                                            napi_finalize finalize_cb,
                                            void* finalize_hint,
                                            napi_ref* result);
+
+// Strings that use the caller's characters without copying them. The
+// characters must stay valid and unchanged until finalize_callback is called.
+// If the engine copies the string instead, *copied is set to true and
+// finalize_callback has already been called when these return.
+NAPI_EXTERN napi_status
+node_api_create_external_string_latin1(napi_env env,
+                                       char* str,
+                                       size_t length,
+                                       napi_finalize finalize_callback,
+                                       void* finalize_hint,
+                                       napi_value* result,
+                                       bool* copied);
+NAPI_EXTERN napi_status
+node_api_create_external_string_utf16(napi_env env,
+                                      char16_t* str,
+                                      size_t length,
+                                      napi_finalize finalize_callback,
+                                      void* finalize_hint,
+                                      napi_value* result,
+                                      bool* copied);
+
+// Same as calling napi_get_named_property or napi_set_named_property for each
+// name in order, with fewer transitions into the engine.
+NAPI_EXTERN napi_status napi_get_named_properties(napi_env env,
+                                                  napi_value object,
+                                                  size_t property_count,
+                                                  const char* const* utf8names,
+                                                  napi_value* results);
+NAPI_EXTERN napi_status napi_set_named_properties(napi_env env,
+                                                  napi_value object,
+                                                  size_t property_count,
+                                                  const char* const* utf8names,
+                                                  const napi_value* values);
 #endif  // NAPI_EXPERIMENTAL
 
 EXTERN_C_END
@@ -655,6 +655,41 @@ inline napi_status Wrap(napi_env env,
   return GET_RETURN_STATUS(env);
 }
 
+// Resource of a string created by node_api_create_external_string_*, which
+// calls the finalizer once V8 no longer needs the characters.
+template <typename ResourceType, typename CharType>
+class ExternalStringResource : public ResourceType, private Finalizer {
+ public:
+  ExternalStringResource(napi_env env,
+                         CharType* data,
+                         size_t length,
+                         napi_finalize finalize_callback,
+                         void* finalize_hint)
+    : Finalizer(env, finalize_callback, data, finalize_hint),
+      _data(data),
+      _length(length) {
+  }
+
+  const CharType* data() const override { return _data; }
+  size_t length() const override { return _length; }
+
+  void Dispose() override {
+    if (_finalize_callback != nullptr) {
+      _finalize_callback(_env, _finalize_data, _finalize_hint);
+    }
+    delete this;
+  }
+
+ private:
+  CharType* _data;
+  size_t _length;
+};
+
+typedef ExternalStringResource<v8::String::ExternalOneByteStringResource,
+                               char> ExternalOneByteStringResource;
+typedef ExternalStringResource<v8::String::ExternalStringResource,
+                               uint16_t> ExternalTwoByteStringResource;
+
 }  // end of anonymous namespace
 
 }  // end of namespace v8impl
@@ -1046,6 +1081,44 @@ napi_status napi_get_named_property(napi_env env,
   return GET_RETURN_STATUS(env);
 }
 
+napi_status napi_get_named_properties(napi_env env,
+                                      napi_value object,
+                                      size_t property_count,
+                                      const char* const* utf8names,
+                                      napi_value* results) {
+  CHECK_ENV(env);
+  if (property_count > 0) {
+    CHECK_ARG(env, utf8names);
+    CHECK_ARG(env, results);
+  }
+
+  for (size_t i = 0; i < property_count; i++) {
+    napi_status status =
+        napi_get_named_property(env, object, utf8names[i], &results[i]);
+    if (status != napi_ok) return status;
+  }
+  return napi_clear_last_error(env);
+}
+
+napi_status napi_set_named_properties(napi_env env,
+                                      napi_value object,
+                                      size_t property_count,
+                                      const char* const* utf8names,
+                                      const napi_value* values) {
+  CHECK_ENV(env);
+  if (property_count > 0) {
+    CHECK_ARG(env, utf8names);
+    CHECK_ARG(env, values);
+  }
+
+  for (size_t i = 0; i < property_count; i++) {
+    napi_status status =
+        napi_set_named_property(env, object, utf8names[i], values[i]);
+    if (status != napi_ok) return status;
+  }
+  return napi_clear_last_error(env);
+}
+
 napi_status napi_set_element(napi_env env,
                              napi_value object,
                              uint32_t index,
@@ -1349,6 +1422,71 @@ napi_status napi_create_string_utf16(napi_env env,
   return napi_clear_last_error(env);
 }
 
+napi_status node_api_create_external_string_latin1(
+    napi_env env,
+    char* str,
+    size_t length,
+    napi_finalize finalize_callback,
+    void* finalize_hint,
+    napi_value* result,
+    bool* copied) {
+  CHECK_ENV(env);
+  CHECK_ARG(env, result);
+
+  if (length == NAPI_AUTO_LENGTH) {
+    length = strlen(str);
+  }
+
+  auto resource = new v8impl::ExternalOneByteStringResource(
+      env, str, length, finalize_callback, finalize_hint);
+  auto str_maybe = v8::String::NewExternalOneByte(env->isolate, resource);
+  if (str_maybe.IsEmpty()) {
+    // The characters still belong to the caller
+    delete resource;
+    return napi_set_last_error(env, napi_generic_failure);
+  }
+
+  if (copied != nullptr) {
+    *copied = false;
+  }
+
+  *result = v8impl::JsValueFromV8LocalValue(str_maybe.ToLocalChecked());
+  return napi_clear_last_error(env);
+}
+
+napi_status node_api_create_external_string_utf16(
+    napi_env env,
+    char16_t* str,
+    size_t length,
+    napi_finalize finalize_callback,
+    void* finalize_hint,
+    napi_value* result,
+    bool* copied) {
+  CHECK_ENV(env);
+  CHECK_ARG(env, result);
+
+  if (length == NAPI_AUTO_LENGTH) {
+    length = std::char_traits<char16_t>::length(str);
+  }
+
+  auto resource = new v8impl::ExternalTwoByteStringResource(
+      env, reinterpret_cast<uint16_t*>(str), length, finalize_callback,
+      finalize_hint);
+  auto str_maybe = v8::String::NewExternalTwoByte(env->isolate, resource);
+  if (str_maybe.IsEmpty()) {
+    // The characters still belong to the caller
+    delete resource;
+    return napi_set_last_error(env, napi_generic_failure);
+  }
+
+  if (copied != nullptr) {
+    *copied = false;
+  }
+
+  *result = v8impl::JsValueFromV8LocalValue(str_maybe.ToLocalChecked());
+  return napi_clear_last_error(env);
+}
+
 napi_status napi_create_double(napi_env env,
                                double value,
                                napi_value* result) {
@@ -294,7 +294,10 @@ static struct {
           ParseCommaSeparatedSet(per_process_opts->trace_event_categories),
           std::unique_ptr<tracing::AsyncTraceWriter>(
               new tracing::NodeTraceWriter(
-                  per_process_opts->trace_event_file_pattern)),
+                  per_process_opts->trace_event_file_pattern,
+                  per_process_opts->trace_event_format == "binary" ?
+                      tracing::NodeTraceWriter::kBinary :
+                      tracing::NodeTraceWriter::kJSON)),
           tracing::Agent::kUseDefaultCategories);
     }
   }
@@ -538,11 +541,73 @@ fail:
 }
 
 
+ArrayBufferAllocator::~ArrayBufferAllocator() {
+  for (FreeBlock* block : free_blocks_) {
+    while (block != nullptr) {
+      FreeBlock* next = block->next;
+      free(block);
+      block = next;
+    }
+  }
+}
+
+// Returns kSizeClassCount for blocks too large to keep.
+size_t ArrayBufferAllocator::SizeClassOf(size_t size) {
+  size_t size_class = 0;
+  while (size_class < kSizeClassCount &&
+         size >= (size_t{2} << (kMinSizeClassShift + size_class)))
+    size_class++;
+  return size_class;
+}
+
+void* ArrayBufferAllocator::TakeFreeBlock(size_t size) {
+  if (size < (size_t{1} << kMinSizeClassShift))
+    return nullptr;
+  size_t size_class = SizeClassOf(size);
+  Mutex::ScopedLock lock(mutex_);
+  for (size_t i = size_class; i < size_class + 2 && i < kSizeClassCount; i++) {
+    FreeBlock* block = free_blocks_[i];
+    if (block != nullptr && block->size >= size) {
+      free_blocks_[i] = block->next;
+      free_bytes_ -= block->size;
+      return block;
+    }
+  }
+  return nullptr;
+}
+
 void* ArrayBufferAllocator::Allocate(size_t size) {
-  if (zero_fill_field_ || per_process_opts->zero_fill_all_buffers)
-    return UncheckedCalloc(size);
-  else
-    return UncheckedMalloc(size);
+  if (zero_fill_field_ || per_process_opts->zero_fill_all_buffers) {
+    void* data = TakeFreeBlock(size);
+    if (data == nullptr)
+      return UncheckedCalloc(size);
+    memset(data, 0, size);
+    return data;
+  }
+  return AllocateUninitialized(size);
+}
+
+void* ArrayBufferAllocator::AllocateUninitialized(size_t size) {
+  void* data = TakeFreeBlock(size);
+  return data != nullptr ? data : UncheckedMalloc(size);
+}
+
+void ArrayBufferAllocator::Free(void* data, size_t size) {
+  if (data == nullptr)
+    return;
+  if (size >= (size_t{1} << kMinSizeClassShift)) {
+    size_t size_class = SizeClassOf(size);
+    Mutex::ScopedLock lock(mutex_);
+    if (size_class < kSizeClassCount && free_bytes_ + size <= kMaxFreeBytes) {
+      FreeBlock* block = static_cast<FreeBlock*>(data);
+      block->next = free_blocks_[size_class];
+      block->size = size;
+      free_blocks_[size_class] = block;
+      free_bytes_ += size;
+      return;
+    }
+  }
+  free(data);
 }
 
 namespace {
@@ -586,9 +651,12 @@ MaybeLocal<Value> InternalMakeCallback(Environment* env,
                                        const Local<Function> callback,
                                        int argc,
                                        Local<Value> argv[],
-                                       async_context asyncContext) {
+                                       async_context asyncContext,
+                                       Local<Value> context_frame) {
   CHECK(!recv.IsEmpty());
-  InternalCallbackScope scope(env, recv, asyncContext);
+  InternalCallbackScope scope(env, recv, asyncContext,
+                              InternalCallbackScope::kRequireResource,
+                              context_frame);
   if (scope.Failed()) {
     return MaybeLocal<Value>();
   }
@@ -2075,6 +2143,9 @@ inline int Start(Isolate* isolate, void* isolate_context,
 
   Environment env(isolate_data, context);
   env.Start(args, exec_args, v8_is_profiling);
+#ifdef NODE_ENGINE_CHAKRACORE
+  env.StartIdleGcNotifier();
+#endif
 
   const char* path = args.size() > 1 ? args[1].c_str() : nullptr;
   StartInspector(&env, path, env.options()->debug_options);
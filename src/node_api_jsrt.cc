@@ -17,7 +17,9 @@
 #include <env.h>
 #include <algorithm>
 #include <array>
+#include <climits>
 #include <cmath>
+#include <string>
 #include <vector>
 #include "ChakraCore.h"
 
@@ -98,6 +100,23 @@ struct CallbackInfo {
   bool isConstructCall;
 };
 
+// Property ids of recently used UTF-8 names. Addons tend to use the same
+// handful of names over and over, and creating a property id means decoding
+// the name and looking it up in the engine's property map every time. The
+// cache is direct mapped on a hash of the name and compares the characters,
+// so names in reused or stack buffers are found too.
+struct PropertyIdCache {
+  static const size_t kSize = 256;
+  static const size_t kMaxNameLength = 64;
+
+  struct Entry {
+    std::string name;
+    JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+  };
+
+  std::array<Entry, kSize> entries;
+};
+
 struct napi_env__ {
   explicit napi_env__(v8::Isolate* _isolate, uv_loop_t* _loop)
       : isolate(_isolate),
@@ -105,6 +124,7 @@ struct napi_env__ {
   ~napi_env__() {}
   v8::Isolate* isolate;
   uv_loop_t* loop;
+  PropertyIdCache property_ids;
 };
 
 namespace {
@@ -308,6 +328,43 @@ inline napi_status JsPropertyIdFromKey(JsValueRef key,
   return napi_ok;
 }
 
+// Gets the property id of a UTF-8 name through the env's PropertyIdCache.
+// Cached property ids are kept alive with a reference until they are evicted.
+inline napi_status JsPropertyIdFromUtf8Name(napi_env env,
+                                            const char* utf8name,
+                                            JsPropertyIdRef* propertyId) {
+  CHECK_ARG(utf8name);
+
+  // FNV-1a, computed while finding the length
+  uint32_t hash = 2166136261u;
+  size_t length = 0;
+  for (; utf8name[length] != '\0'; length++) {
+    hash = (hash ^ static_cast<uint8_t>(utf8name[length])) * 16777619u;
+  }
+
+  if (length > PropertyIdCache::kMaxNameLength) {
+    CHECK_JSRT(JsCreatePropertyId(utf8name, length, propertyId));
+    return napi_ok;
+  }
+
+  PropertyIdCache::Entry& entry =
+    env->property_ids.entries[hash % PropertyIdCache::kSize];
+  if (entry.propertyId != JS_INVALID_REFERENCE &&
+      entry.name.compare(0, std::string::npos, utf8name, length) == 0) {
+    *propertyId = entry.propertyId;
+    return napi_ok;
+  }
+
+  CHECK_JSRT(JsCreatePropertyId(utf8name, length, propertyId));
+  CHECK_JSRT(JsAddRef(*propertyId, nullptr));
+  if (entry.propertyId != JS_INVALID_REFERENCE) {
+    CHECK_JSRT(JsRelease(entry.propertyId, nullptr));
+  }
+  entry.name.assign(utf8name, length);
+  entry.propertyId = *propertyId;
+  return napi_ok;
+}
+
 inline napi_status
 JsPropertyIdFromPropertyDescriptor(const napi_property_descriptor* p,
                                    JsPropertyIdRef* propertyId) {
@@ -334,62 +391,48 @@ JsNameValueFromPropertyDescriptor(const napi_property_descriptor* p,
   return napi_ok;
 }
 
-inline napi_status FindWrapper(JsValueRef obj, JsValueRef* wrapper,
-                               JsValueRef* parent = nullptr) {
-  // Search the object's prototype chain for the wrapper with external data.
-  // Usually the wrapper would be the first in the chain, but it is OK for
-  // other objects to be inserted in the prototype chain.
-  JsValueRef candidate = obj;
-  JsValueRef current = JS_INVALID_REFERENCE;
-  bool hasExternalData = false;
-
-  JsValueRef nullValue = JS_INVALID_REFERENCE;
-  CHECK_JSRT(JsGetNullValue(&nullValue));
-
-  do {
-    current = candidate;
-
-    CHECK_JSRT(JsGetPrototype(current, &candidate));
-    if (candidate == JS_INVALID_REFERENCE || candidate == nullValue) {
-      if (parent != nullptr) {
-        *parent = JS_INVALID_REFERENCE;
-      }
-
-      *wrapper = JS_INVALID_REFERENCE;
-      return napi_ok;
-    }
+// The wrapper is an external object holding the ExternalData. It is kept in a
+// hidden symbol property of the wrapped object itself, so wrapping doesn't
+// change the object's prototype chain, and objects of the same class that are
+// wrapped the same way keep sharing a type.
+inline JsPropertyIdRef GetWrapperPropertyIdRef(napi_env env) {
+  return jsrt::IsolateShim::FromIsolate(env->isolate)
+    ->GetCachedSymbolPropertyIdRef(
+      jsrt::CachedSymbolPropertyIdRef::__napiwrapper__);
+}
 
-    CHECK_JSRT(JsHasExternalData(candidate, &hasExternalData));
-  } while (!hasExternalData);
+inline napi_status FindWrapper(napi_env env, JsValueRef obj,
+                               JsValueRef* wrapper) {
+  JsPropertyIdRef wrapperIdRef = GetWrapperPropertyIdRef(env);
 
-  if (parent != nullptr) {
-    *parent = current;
+  bool hasWrapper = false;
+  CHECK_JSRT(JsHasOwnProperty(obj, wrapperIdRef, &hasWrapper));
+  if (!hasWrapper) {
+    *wrapper = JS_INVALID_REFERENCE;
+    return napi_ok;
   }
 
-  *wrapper = candidate;
-
+  CHECK_JSRT(JsGetProperty(obj, wrapperIdRef, wrapper));
   return napi_ok;
 }
 
-inline napi_status Unwrap(JsValueRef obj, jsrtimpl::ExternalData** externalData,
-                          JsValueRef* wrapper = nullptr,
-                          JsValueRef* parent = nullptr) {
+inline napi_status Unwrap(napi_env env, JsValueRef obj,
+                          jsrtimpl::ExternalData** externalData,
+                          JsValueRef* wrapper = nullptr) {
   JsValueRef candidate = JS_INVALID_REFERENCE;
-  JsValueRef candidateParent = JS_INVALID_REFERENCE;
-  CHECK_NAPI(jsrtimpl::FindWrapper(obj, &candidate, &candidateParent));
+  CHECK_NAPI(jsrtimpl::FindWrapper(env, obj, &candidate));
   RETURN_STATUS_IF_FALSE(candidate != JS_INVALID_REFERENCE, napi_invalid_arg);
 
   CHECK_JSRT(JsGetExternalData(candidate,
                                reinterpret_cast<void**>(externalData)));
 
+  // napi_remove_wrap leaves the wrapper behind without any external data
+  RETURN_STATUS_IF_FALSE(*externalData != nullptr, napi_invalid_arg);
+
   if (wrapper != nullptr) {
     *wrapper = candidate;
   }
 
-  if (parent != nullptr) {
-    *parent = candidateParent;
-  }
-
   return napi_ok;
 }
 
@@ -893,7 +936,7 @@ napi_status napi_set_named_property(napi_env env,
                                     napi_value value) {
   JsValueRef obj = reinterpret_cast<JsValueRef>(object);
   JsPropertyIdRef propertyId;
-  CHECK_JSRT(JsCreatePropertyId(utf8name, strlen(utf8name), &propertyId));
+  CHECK_NAPI(jsrtimpl::JsPropertyIdFromUtf8Name(env, utf8name, &propertyId));
   JsValueRef js_value = reinterpret_cast<JsValueRef>(value);
   CHECK_JSRT(JsSetProperty(obj, propertyId, js_value, true));
   return napi_ok;
@@ -1046,7 +1089,7 @@ napi_status napi_has_named_property(napi_env env,
                                     bool* result) {
   CHECK_ARG(result);
   JsPropertyIdRef propertyId;
-  CHECK_JSRT(JsCreatePropertyId(utf8name, strlen(utf8name), &propertyId));
+  CHECK_NAPI(jsrtimpl::JsPropertyIdFromUtf8Name(env, utf8name, &propertyId));
   JsValueRef obj = reinterpret_cast<JsValueRef>(object);
   CHECK_JSRT(JsHasProperty(obj, propertyId, result));
   return napi_ok;
@@ -1071,12 +1114,66 @@ napi_status napi_get_named_property(napi_env env,
   CHECK_ARG(result);
   JsValueRef obj = reinterpret_cast<JsValueRef>(object);
   JsPropertyIdRef propertyId;
-  CHECK_JSRT(JsCreatePropertyId(utf8name, strlen(utf8name), &propertyId));
+  CHECK_NAPI(jsrtimpl::JsPropertyIdFromUtf8Name(env, utf8name, &propertyId));
   CHECK_JSRT(
     JsGetProperty(obj, propertyId, reinterpret_cast<JsValueRef*>(result)));
   return napi_ok;
 }
 
+// The names are turned into property ids a chunk at a time, and each chunk is
+// read or written with a single call into the engine.
+static const size_t kPropertiesChunkSize = 32;
+
+napi_status napi_get_named_properties(napi_env env,
+                                      napi_value object,
+                                      size_t property_count,
+                                      const char* const* utf8names,
+                                      napi_value* results) {
+  if (property_count > 0) {
+    CHECK_ARG(utf8names);
+    CHECK_ARG(results);
+  }
+  JsValueRef obj = reinterpret_cast<JsValueRef>(object);
+  std::array<JsPropertyIdRef, kPropertiesChunkSize> propertyIds;
+
+  for (size_t start = 0; start < property_count;
+       start += kPropertiesChunkSize) {
+    size_t count = std::min(property_count - start, kPropertiesChunkSize);
+    for (size_t i = 0; i < count; i++) {
+      CHECK_NAPI(jsrtimpl::JsPropertyIdFromUtf8Name(
+        env, utf8names[start + i], &propertyIds[i]));
+    }
+    CHECK_JSRT(JsGetProperties(obj, propertyIds.data(), count,
+      reinterpret_cast<JsValueRef*>(results + start)));
+  }
+  return napi_ok;
+}
+
+napi_status napi_set_named_properties(napi_env env,
+                                      napi_value object,
+                                      size_t property_count,
+                                      const char* const* utf8names,
+                                      const napi_value* values) {
+  if (property_count > 0) {
+    CHECK_ARG(utf8names);
+    CHECK_ARG(values);
+  }
+  JsValueRef obj = reinterpret_cast<JsValueRef>(object);
+  std::array<JsPropertyIdRef, kPropertiesChunkSize> propertyIds;
+
+  for (size_t start = 0; start < property_count;
+       start += kPropertiesChunkSize) {
+    size_t count = std::min(property_count - start, kPropertiesChunkSize);
+    for (size_t i = 0; i < count; i++) {
+      CHECK_NAPI(jsrtimpl::JsPropertyIdFromUtf8Name(
+        env, utf8names[start + i], &propertyIds[i]));
+    }
+    CHECK_JSRT(JsSetProperties(obj, propertyIds.data(),
+      reinterpret_cast<const JsValueRef*>(values + start), count, true));
+  }
+  return napi_ok;
+}
+
 napi_status napi_get_property(napi_env env,
                               napi_value object,
                               napi_value key,
@@ -1196,10 +1293,30 @@ napi_status napi_create_string_latin1(napi_env env,
                                       const char* str,
                                       size_t length,
                                       napi_value* result) {
-  // TODO(boingoing): Convert from Latin1 to UTF-8 encoding.
   CHECK_ARG(result);
-  CHECK_JSRT(JsCreateString(
-    str,
+  if (length == NAPI_AUTO_LENGTH) {
+    length = strlen(str);
+  }
+
+  // ASCII is also valid UTF-8, and JsCreateString keeps long ASCII content
+  // one byte per character.
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(str);
+  size_t asciiLength = 0;
+  while (asciiLength < length && bytes[asciiLength] < 0x80) {
+    asciiLength++;
+  }
+  if (asciiLength == length) {
+    CHECK_JSRT(JsCreateString(
+      str,
+      length,
+      reinterpret_cast<JsValueRef*>(result)));
+    return napi_ok;
+  }
+
+  // Latin-1 characters are the first 256 UTF-16 code units.
+  std::vector<uint16_t> utf16(bytes, bytes + length);
+  CHECK_JSRT(JsCreateStringUtf16(
+    utf16.data(),
     length,
     reinterpret_cast<JsValueRef*>(result)));
   return napi_ok;
@@ -1229,6 +1346,99 @@ napi_status napi_create_string_utf16(napi_env env,
   return napi_ok;
 }
 
+// External strings shorter than this are copied instead. ChakraCore flattens
+// most short strings right away, which copies the characters anyway, and a
+// copy doesn't need a finalizer.
+static const size_t kMinExternalStringLength = 64;
+
+napi_status node_api_create_external_string_latin1(
+    napi_env env,
+    char* str,
+    size_t length,
+    napi_finalize finalize_callback,
+    void* finalize_hint,
+    napi_value* result,
+    bool* copied) {
+  CHECK_ARG(result);
+  if (length == NAPI_AUTO_LENGTH) {
+    length = strlen(str);
+  }
+
+  if (length < kMinExternalStringLength) {
+    CHECK_NAPI(napi_create_string_latin1(env, str, length, result));
+    if (finalize_callback != nullptr) {
+      finalize_callback(env, str, finalize_hint);
+    }
+    if (copied != nullptr) {
+      *copied = true;
+    }
+    return napi_ok;
+  }
+
+  jsrtimpl::ExternalData* externalData = new jsrtimpl::ExternalData(
+    env, str, finalize_callback, finalize_hint);
+  JsErrorCode err = JsCreateExternalStringLatin1(
+    str,
+    length,
+    jsrtimpl::ExternalData::Finalize,
+    externalData,
+    reinterpret_cast<JsValueRef*>(result));
+  if (err != JsNoError) {
+    // The characters still belong to the caller
+    delete externalData;
+    return napi_set_last_error(err);
+  }
+
+  if (copied != nullptr) {
+    *copied = false;
+  }
+  return napi_ok;
+}
+
+napi_status node_api_create_external_string_utf16(
+    napi_env env,
+    char16_t* str,
+    size_t length,
+    napi_finalize finalize_callback,
+    void* finalize_hint,
+    napi_value* result,
+    bool* copied) {
+  CHECK_ARG(result);
+  if (length == NAPI_AUTO_LENGTH) {
+    length = std::char_traits<char16_t>::length(str);
+  }
+
+  if (length < kMinExternalStringLength) {
+    CHECK_NAPI(napi_create_string_utf16(env, str, length, result));
+    if (finalize_callback != nullptr) {
+      finalize_callback(env, str, finalize_hint);
+    }
+    if (copied != nullptr) {
+      *copied = true;
+    }
+    return napi_ok;
+  }
+
+  jsrtimpl::ExternalData* externalData = new jsrtimpl::ExternalData(
+    env, str, finalize_callback, finalize_hint);
+  JsErrorCode err = JsCreateExternalStringUtf16(
+    reinterpret_cast<const uint16_t*>(str),
+    length,
+    jsrtimpl::ExternalData::Finalize,
+    externalData,
+    reinterpret_cast<JsValueRef*>(result));
+  if (err != JsNoError) {
+    // The characters still belong to the caller
+    delete externalData;
+    return napi_set_last_error(err);
+  }
+
+  if (copied != nullptr) {
+    *copied = false;
+  }
+  return napi_ok;
+}
+
 napi_status napi_create_double(napi_env env,
                                double value,
                                napi_value* result) {
@@ -1632,66 +1842,29 @@ napi_status napi_get_value_string_latin1(napi_env env,
   CHECK_ARG(value);
   JsValueRef js_value = reinterpret_cast<JsValueRef>(value);
 
-  // TODO(boingoing): Convert from UTF-8 to Latin1 encoding.
   if (!buf) {
     CHECK_ARG(result);
 
-    JsErrorCode err = JsCopyString(js_value, nullptr, 0, result);
-    if (err != JsErrorInvalidArgument) {
-      return napi_set_last_error(err);
+    int length = 0;
+    CHECK_JSRT_EXPECTED(JsGetStringLength(js_value, &length),
+                        napi_string_expected);
+    *result = static_cast<size_t>(length);
+  } else if (bufsize == 0) {
+    // No space for anything, not even the null terminator
+    if (result != nullptr) {
+      *result = 0;
     }
   } else {
+    // Every character is one byte, so truncating never splits a character.
+    // Characters outside of Latin-1 are truncated to their low byte.
     size_t count = 0;
+    int maxCount = static_cast<int>(std::min(bufsize - 1,
+      static_cast<size_t>(INT_MAX)));
     CHECK_JSRT_EXPECTED(
-      JsCopyString(js_value, nullptr, 0, &count),
+      JsCopyStringOneByte(js_value, 0, maxCount, buf, &count),
       napi_string_expected);
 
-    if (bufsize <= count) {
-      // if bufsize == count there is no space for null terminator
-      // Slow path: must implement truncation here.
-      char* fullBuffer = static_cast<char*>(malloc(count));
-      CHAKRA_VERIFY(fullBuffer != nullptr);
-
-      CHECK_JSRT_EXPECTED(
-        JsCopyString(js_value, fullBuffer, count, nullptr),
-        napi_string_expected);
-      memmove(buf, fullBuffer, sizeof(char) * bufsize);
-      free(fullBuffer);
-
-      // Truncate string to the start of the last codepoint
-      if (bufsize > 0 &&
-          (((buf[bufsize-1] & 0x80) == 0)
-            || UTF8_MULTIBYTE_START(buf[bufsize-1]))
-        ) {
-        // Last byte is a single byte codepoint or
-        // starts a multibyte codepoint
-        bufsize -= 1;
-      } else if (bufsize > 1 && UTF8_MULTIBYTE_START(buf[bufsize-2])) {
-        // Second last byte starts a multibyte codepoint,
-        bufsize -= 2;
-      } else if (bufsize > 2 && UTF8_MULTIBYTE_START(buf[bufsize-3])) {
-        // Third last byte starts a multibyte codepoint
-        bufsize -= 3;
-      } else if (bufsize > 3 && UTF8_MULTIBYTE_START(buf[bufsize-4])) {
-        // Fourth last byte starts a multibyte codepoint
-        bufsize -= 4;
-      }
-
-      buf[bufsize] = '\0';
-
-      if (result) {
-        *result = bufsize;
-      }
-
-      return napi_ok;
-    }
-
-    // Fastpath, result fits in the buffer
-    CHECK_JSRT_EXPECTED(
-      JsCopyString(js_value, buf, bufsize-1, &count),
-      napi_string_expected);
-
-    buf[count] = 0;
+    buf[count] = '\0';
 
     if (result != nullptr) {
       *result = count;
@@ -1882,8 +2055,13 @@ napi_status napi_wrap(napi_env env,
   JsValueRef value = reinterpret_cast<JsValueRef>(js_object);
 
   JsValueRef wrapper = JS_INVALID_REFERENCE;
-  CHECK_NAPI(jsrtimpl::FindWrapper(value, &wrapper));
-  RETURN_STATUS_IF_FALSE(wrapper == JS_INVALID_REFERENCE, napi_invalid_arg);
+  CHECK_NAPI(jsrtimpl::FindWrapper(env, value, &wrapper));
+  if (wrapper != JS_INVALID_REFERENCE) {
+    // Only a wrapper left behind by napi_remove_wrap can be replaced
+    void* wrapperData = nullptr;
+    CHECK_JSRT(JsGetExternalData(wrapper, &wrapperData));
+    RETURN_STATUS_IF_FALSE(wrapperData == nullptr, napi_invalid_arg);
+  }
 
   jsrtimpl::ExternalData* externalData = new jsrtimpl::ExternalData(
     env, native_object, finalize_cb, finalize_hint);
@@ -1894,11 +2072,16 @@ napi_status napi_wrap(napi_env env,
   CHECK_JSRT(JsCreateExternalObject(
     externalData, jsrtimpl::ExternalData::Finalize, &external));
 
-  // Insert the external object into the value's prototype chain.
-  JsValueRef valuePrototype = JS_INVALID_REFERENCE;
-  CHECK_JSRT(JsGetPrototype(value, &valuePrototype));
-  CHECK_JSRT(JsSetPrototype(external, valuePrototype));
-  CHECK_JSRT(JsSetPrototype(value, external));
+  // Keep the external object in the value's hidden wrapper property. It is
+  // configurable so that a later wrap can replace a removed one.
+  CHECK_JSRT(jsrt::DefineProperty(value,
+                                  jsrtimpl::GetWrapperPropertyIdRef(env),
+                                  jsrt::PropertyDescriptorOptionValues::False,
+                                  jsrt::PropertyDescriptorOptionValues::False,
+                                  jsrt::PropertyDescriptorOptionValues::True,
+                                  external,
+                                  JS_INVALID_REFERENCE,
+                                  JS_INVALID_REFERENCE));
 
   if (result != nullptr) {
     CHECK_NAPI(napi_create_reference(env, js_object, 0, result));
@@ -1911,9 +2094,9 @@ napi_status napi_unwrap(napi_env env, napi_value js_object, void** result) {
   JsValueRef value = reinterpret_cast<JsValueRef>(js_object);
 
   jsrtimpl::ExternalData* externalData = nullptr;
-  CHECK_NAPI(jsrtimpl::Unwrap(value, &externalData));
+  CHECK_NAPI(jsrtimpl::Unwrap(env, value, &externalData));
 
-  *result = (externalData != nullptr ? externalData->Data() : nullptr);
+  *result = externalData->Data();
 
   return napi_ok;
 }
@@ -1923,26 +2106,15 @@ napi_status napi_remove_wrap(napi_env env, napi_value js_object,
   JsValueRef value = reinterpret_cast<JsValueRef>(js_object);
 
   jsrtimpl::ExternalData* externalData = nullptr;
-  JsValueRef parent = JS_INVALID_REFERENCE;
   JsValueRef wrapper = JS_INVALID_REFERENCE;
-  CHECK_NAPI(jsrtimpl::Unwrap(value, &externalData, &wrapper, &parent));
-  RETURN_STATUS_IF_FALSE(parent != JS_INVALID_REFERENCE, napi_invalid_arg);
-  RETURN_STATUS_IF_FALSE(wrapper != JS_INVALID_REFERENCE, napi_invalid_arg);
-
-  // Remove the external from the prototype chain
-  JsValueRef wrapperProto = JS_INVALID_REFERENCE;
-  CHECK_JSRT(JsGetPrototype(wrapper, &wrapperProto));
-  CHECK_JSRT(JsSetPrototype(parent, wrapperProto));
+  CHECK_NAPI(jsrtimpl::Unwrap(env, value, &externalData, &wrapper));
 
-  // Clear the external data from the object
+  // Clear the external data from the wrapper. The wrapper property itself
+  // stays, since deleting it would leave the value in dictionary mode.
   CHECK_JSRT(JsSetExternalData(wrapper, nullptr));
 
-  if (externalData != nullptr) {
-    *result = externalData->Data();
-    delete externalData;
-  } else {
-    *result = nullptr;
-  }
+  *result = externalData->Data();
+  delete externalData;
 
   return napi_ok;
 }
@@ -4771,6 +4771,183 @@ void RandomBytes(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Generates a replacement for the pool in a buffer of its own, so the pool
+// keeps serving requests from what it has left in the meantime.
+struct RandomPoolRefillJob : public ThreadPoolWork {
+  RandomPool* pool;
+  std::unique_ptr<unsigned char[]> data;
+  bool ok;
+
+  inline RandomPoolRefillJob(Environment* env, RandomPool* pool)
+      : ThreadPoolWork(env),
+        pool(pool),
+        data(new unsigned char[RandomPool::kPoolSize]),
+        ok(false) {}
+
+  inline void DoThreadPoolWork() override {
+    CheckEntropy();  // Ensure that OpenSSL's PRNG is properly seeded.
+    ok = RAND_bytes(data.get(), RandomPool::kPoolSize) == 1;
+  }
+
+  inline void AfterThreadPoolWork(int status) override {
+    std::unique_ptr<RandomPoolRefillJob> job(this);
+    if (pool == nullptr) {
+      OPENSSL_cleanse(data.get(), RandomPool::kPoolSize);
+      return;
+    }
+    pool->FinishRefill(status == 0 && ok ? std::move(data) : nullptr);
+  }
+};
+
+
+void RandomPool::Initialize(Environment* env, Local<Object> target) {
+  Local<FunctionTemplate> t = env->NewFunctionTemplate(New);
+
+  t->InstanceTemplate()->SetInternalFieldCount(1);
+
+  env->SetProtoMethod(t, "fill", Fill);
+  env->SetProtoMethod(t, "randomUUID", RandomUUID);
+
+  target->Set(env->context(),
+              FIXED_ONE_BYTE_STRING(env->isolate(), "RandomPool"),
+              t->GetFunction(env->context()).ToLocalChecked()).FromJust();
+}
+
+
+RandomPool::RandomPool(Environment* env, Local<Object> wrap)
+    : BaseObject(env, wrap),
+      pool_(new unsigned char[kPoolSize]),
+      used_(kPoolSize),
+      refill_(nullptr) {
+  MakeWeak();
+  StartRefill();
+}
+
+
+RandomPool::~RandomPool() {
+  // A refill that is still running outlives the pool, and cleans up after
+  // itself.
+  if (refill_ != nullptr)
+    refill_->pool = nullptr;
+  OPENSSL_cleanse(pool_.get(), kPoolSize);
+  if (next_)
+    OPENSSL_cleanse(next_.get(), kPoolSize);
+}
+
+
+void RandomPool::MemoryInfo(MemoryTracker* tracker) const {
+  tracker->TrackFieldWithSize("pool", (next_ ? 2 : 1) * kPoolSize);
+}
+
+
+void RandomPool::New(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args.IsConstructCall());
+  Environment* env = Environment::GetCurrent(args);
+  new RandomPool(env, args.This());
+}
+
+
+bool RandomPool::Take(unsigned char* out, size_t size) {
+  CHECK_LE(size, kMaxRequestSize);
+
+  if (kPoolSize - used_ < size) {
+    // What is left over is wiped rather than handed out together with the
+    // start of the next pool, so no request straddles two of them.
+    OPENSSL_cleanse(pool_.get() + used_, kPoolSize - used_);
+    if (next_) {
+      pool_ = std::move(next_);
+    } else {
+      // The refill hasn't finished yet, or failed.
+      CheckEntropy();
+      if (RAND_bytes(pool_.get(), kPoolSize) != 1) {
+        used_ = kPoolSize;
+        return false;
+      }
+    }
+    used_ = 0;
+  }
+
+  memcpy(out, pool_.get() + used_, size);
+  OPENSSL_cleanse(pool_.get() + used_, size);
+  used_ += size;
+
+  if (used_ >= kPoolSize / 2 && !next_)
+    StartRefill();
+  return true;
+}
+
+
+void RandomPool::StartRefill() {
+  if (refill_ != nullptr)
+    return;
+  refill_ = new RandomPoolRefillJob(env(), this);
+  refill_->ScheduleWork();
+}
+
+
+void RandomPool::FinishRefill(std::unique_ptr<unsigned char[]> data) {
+  refill_ = nullptr;
+  // On failure the next request that doesn't fit generates the bytes itself,
+  // and reports the error if there is one.
+  next_ = std::move(data);
+}
+
+
+static void ThrowRandomPoolError(Environment* env) {
+  CryptoErrorVector errors;
+  errors.Capture();
+  env->isolate()->ThrowException(errors.ToException(env));
+}
+
+
+void RandomPool::Fill(const FunctionCallbackInfo<Value>& args) {
+  RandomPool* pool;
+  ASSIGN_OR_RETURN_UNWRAP(&pool, args.Holder());
+  CHECK(args[0]->IsArrayBufferView());  // buffer
+  CHECK(args[1]->IsUint32());  // offset
+  CHECK(args[2]->IsUint32());  // size
+  const uint32_t offset = args[1].As<Uint32>()->Value();
+  const uint32_t size = args[2].As<Uint32>()->Value();
+  CHECK_GE(offset + size, offset);  // Overflow check.
+  CHECK_LE(offset + size, Buffer::Length(args[0]));  // Bounds check.
+  Environment* env = pool->env();
+  env->PrintSyncTrace();
+  unsigned char* data =
+      reinterpret_cast<unsigned char*>(Buffer::Data(args[0])) + offset;
+  if (!pool->Take(data, size))
+    return ThrowRandomPoolError(env);
+}
+
+
+// A version 4 UUID, as described in RFC 4122, section 4.4.
+void RandomPool::RandomUUID(const FunctionCallbackInfo<Value>& args) {
+  static const char kHexDigits[] = "0123456789abcdef";
+
+  RandomPool* pool;
+  ASSIGN_OR_RETURN_UNWRAP(&pool, args.Holder());
+  Environment* env = pool->env();
+
+  unsigned char bytes[16];
+  if (!pool->Take(bytes, sizeof(bytes)))
+    return ThrowRandomPoolError(env);
+  bytes[6] = (bytes[6] & 0x0f) | 0x40;  // Version.
+  bytes[8] = (bytes[8] & 0x3f) | 0x80;  // Variant.
+
+  char uuid[36];
+  size_t length = 0;
+  for (size_t i = 0; i < sizeof(bytes); i++) {
+    if (i == 4 || i == 6 || i == 8 || i == 10)
+      uuid[length++] = '-';
+    uuid[length++] = kHexDigits[bytes[i] >> 4];
+    uuid[length++] = kHexDigits[bytes[i] & 0xf];
+  }
+  CHECK_EQ(length, sizeof(uuid));
+  OPENSSL_cleanse(bytes, sizeof(bytes));
+
+  args.GetReturnValue().Set(OneByteString(env->isolate(), uuid, length));
+}
+
+
 struct PBKDF2Job : public CryptoJob {
   unsigned char* keybuf_data;
   size_t keybuf_size;
@@ -4931,6 +5108,497 @@ void Scrypt(const FunctionCallbackInfo<Value>& args) {
 #endif  // OPENSSL_NO_SCRYPT
 
 
+// Computes the digests, or HMACs when keys are given, of a list of inputs.
+// The inputs and keys point into buffers that the wrap object keeps alive
+// until the job is done.
+struct HashJob : public CryptoJob {
+  const EVP_MD* md;
+  std::vector<std::pair<const char*, size_t>> keys;
+  std::vector<std::pair<const char*, size_t>> inputs;
+  std::vector<unsigned char> digests;
+  unsigned int md_size;
+  CryptoErrorVector errors;
+
+  inline explicit HashJob(Environment* env) : CryptoJob(env) {}
+
+  inline void DoThreadPoolWork() override {
+    md_size = EVP_MD_size(md);
+    digests.resize(inputs.size() * md_size);
+    for (size_t i = 0; i < inputs.size(); i++) {
+      const auto data = reinterpret_cast<const unsigned char*>(inputs[i].first);
+      unsigned char* out = digests.data() + i * md_size;
+      unsigned int out_len;
+      bool ok;
+      if (keys.empty()) {
+        ok = EVP_Digest(data, inputs[i].second, out, &out_len, md, nullptr);
+      } else {
+        // A single key is used for all inputs.
+        const auto& key = keys[keys.size() == 1 ? 0 : i];
+        ok = HMAC(md, key.first, key.second, data, inputs[i].second,
+                  out, &out_len) != nullptr;
+      }
+      if (!ok) {
+        errors.Capture();
+        if (errors.empty())
+          errors.push_back("Digest method not supported");
+        return;
+      }
+      CHECK_EQ(out_len, md_size);
+    }
+  }
+
+  inline void AfterThreadPoolWork() override {
+    Local<Value> argv[2];
+    if (errors.empty()) {
+      Local<Array> results = Array::New(env->isolate(), inputs.size());
+      for (size_t i = 0; i < inputs.size(); i++) {
+        Local<Object> digest =
+            Buffer::Copy(env,
+                         reinterpret_cast<char*>(digests.data()) + i * md_size,
+                         md_size).ToLocalChecked();
+        results->Set(env->context(), i, digest).FromJust();
+      }
+      argv[0] = Undefined(env->isolate());
+      argv[1] = results;
+    } else {
+      argv[0] = errors.ToException(env);
+      argv[1] = Undefined(env->isolate());
+    }
+    async_wrap->MakeCallback(env->ondone_string(), arraysize(argv), argv);
+  }
+};
+
+
+inline void AddBuffers(Local<Context> context,
+                       Local<Array> array,
+                       std::vector<std::pair<const char*, size_t>>* vec) {
+  vec->reserve(array->Length());
+  for (uint32_t i = 0; i < array->Length(); i++) {
+    Local<Value> buf = array->Get(context, i).ToLocalChecked();
+    CHECK(buf->IsArrayBufferView());
+    vec->emplace_back(Buffer::Data(buf), Buffer::Length(buf));
+  }
+}
+
+
+void HashBatch(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args[0]->IsString());  // digest_name
+  CHECK(args[1]->IsArray() || args[1]->IsUndefined());  // keys
+  CHECK(args[2]->IsArray());  // inputs; wrap object retains refs.
+  CHECK(args[3]->IsObject());  // wrap object
+  std::unique_ptr<HashJob> job(new HashJob(env));
+  Utf8Value digest_name(args.GetIsolate(), args[0]);
+  job->md = EVP_get_digestbyname(*digest_name);
+  if (job->md == nullptr) return args.GetReturnValue().Set(-1);
+  if (args[1]->IsArray())
+    AddBuffers(env->context(), args[1].As<Array>(), &job->keys);
+  AddBuffers(env->context(), args[2].As<Array>(), &job->inputs);
+  CHECK(job->keys.size() <= 1 || job->keys.size() == job->inputs.size());
+  HashJob::Run(std::move(job), args[3]);
+}
+
+
+// Verifies a list of (data, signature) pairs against a single public key.
+// The key is parsed once and one EVP_PKEY_CTX is shared by all pairs. Data
+// and signatures point into buffers that the wrap object keeps alive.
+struct VerifyJob : public CryptoJob {
+  EVPKeyPointer pkey;
+  const EVP_MD* md;
+  int padding;
+  int salt_len;
+  std::vector<std::pair<const char*, size_t>> inputs;
+  std::vector<std::pair<const char*, size_t>> signatures;
+  unsigned char* results;
+
+  inline explicit VerifyJob(Environment* env) : CryptoJob(env) {}
+
+  inline void DoThreadPoolWork() override {
+    ClearErrorOnReturn clear_error_on_return;
+    memset(results, 0, inputs.size());
+
+    EVPKeyCtxPointer pkctx(EVP_PKEY_CTX_new(pkey.get(), nullptr));
+    if (!pkctx ||
+        EVP_PKEY_verify_init(pkctx.get()) <= 0 ||
+        !ApplyRSAOptions(pkey, pkctx.get(), padding, salt_len) ||
+        EVP_PKEY_CTX_set_signature_md(pkctx.get(), md) <= 0) {
+      return;
+    }
+
+    for (size_t i = 0; i < inputs.size(); i++) {
+      unsigned char m[EVP_MAX_MD_SIZE];
+      unsigned int m_len;
+      if (!EVP_Digest(inputs[i].first, inputs[i].second, m, &m_len, md,
+                      nullptr)) {
+        continue;
+      }
+      const auto sig =
+          reinterpret_cast<const unsigned char*>(signatures[i].first);
+      const size_t sig_len = signatures[i].second;
+      results[i] = EVP_PKEY_verify(pkctx.get(), sig, sig_len, m, m_len) == 1;
+    }
+  }
+
+  inline void AfterThreadPoolWork() override {
+    async_wrap->MakeCallback(env->ondone_string(), 0, nullptr);
+  }
+};
+
+
+void VerifyBatch(const FunctionCallbackInfo<Value>& args) {
+  ClearErrorOnReturn clear_error_on_return;
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args[0]->IsString());  // digest_name
+  CHECK(args[1]->IsArrayBufferView());  // key_pem
+  CHECK(args[2]->IsInt32());  // padding
+  CHECK(args[3]->IsInt32());  // salt_len
+  CHECK(args[4]->IsArray());  // inputs; wrap object retains refs.
+  CHECK(args[5]->IsArray());  // signatures; wrap object retains refs.
+  CHECK(args[6]->IsUint8Array());  // results; wrap object retains ref.
+  CHECK(args[7]->IsObject());  // wrap object
+  std::unique_ptr<VerifyJob> job(new VerifyJob(env));
+  Utf8Value digest_name(args.GetIsolate(), args[0]);
+  job->md = EVP_get_digestbyname(*digest_name);
+  if (job->md == nullptr) return args.GetReturnValue().Set(-1);
+  if (ParsePublicKey(&job->pkey,
+                     Buffer::Data(args[1]),
+                     Buffer::Length(args[1])) != kParsePublicOk) {
+    unsigned long err = ERR_get_error();  // NOLINT(runtime/int)
+    if (err)
+      return ThrowCryptoError(env, err);
+    return env->ThrowError("PEM_read_bio_PUBKEY failed");
+  }
+  job->padding = args[2].As<Int32>()->Value();
+  job->salt_len = args[3].As<Int32>()->Value();
+  AddBuffers(env->context(), args[4].As<Array>(), &job->inputs);
+  AddBuffers(env->context(), args[5].As<Array>(), &job->signatures);
+  CHECK_EQ(job->inputs.size(), job->signatures.size());
+  CHECK_EQ(job->inputs.size(), Buffer::Length(args[6]));
+  job->results = reinterpret_cast<unsigned char*>(Buffer::Data(args[6]));
+  VerifyJob::Run(std::move(job), args[7]);
+}
+
+
+// A message for CipherContext. The buffers are owned by the caller; the tag
+// is written when encrypting and read when decrypting.
+struct AEADMessage {
+  const unsigned char* iv;
+  int iv_len;
+  const unsigned char* aad;
+  int aad_len;
+  const unsigned char* in;
+  int in_len;
+  unsigned char* out;
+  unsigned char* tag;
+};
+
+
+inline const unsigned char* BufferData(Local<Value> buf) {
+  return reinterpret_cast<const unsigned char*>(Buffer::Data(buf));
+}
+
+
+inline int BufferLength(Local<Value> buf) {
+  const size_t len = Buffer::Length(buf);
+  CHECK_LE(len, INT_MAX);
+  return static_cast<int>(len);
+}
+
+
+inline void ReadAEADMessage(Local<Value> iv,
+                            Local<Value> in,
+                            Local<Value> out,
+                            Local<Value> tag,
+                            Local<Value> aad,
+                            unsigned int auth_tag_len,
+                            AEADMessage* message) {
+  CHECK(iv->IsArrayBufferView());
+  CHECK(in->IsArrayBufferView());
+  CHECK(out->IsArrayBufferView());
+  CHECK(tag->IsArrayBufferView());
+  CHECK(aad->IsArrayBufferView());
+  message->iv = BufferData(iv);
+  message->iv_len = BufferLength(iv);
+  message->aad = BufferData(aad);
+  message->aad_len = BufferLength(aad);
+  message->in = BufferData(in);
+  message->in_len = BufferLength(in);
+  message->out = reinterpret_cast<unsigned char*>(Buffer::Data(out));
+  CHECK_GE(Buffer::Length(out), Buffer::Length(in));
+  message->tag = reinterpret_cast<unsigned char*>(Buffer::Data(tag));
+  CHECK_EQ(Buffer::Length(tag), auth_tag_len);
+}
+
+
+// Encrypts or decrypts a single message with a context keyed by
+// CipherContext::Init(). Only the IV is set again, which resets the AEAD
+// state but keeps the expanded key.
+static bool RunAEAD(EVP_CIPHER_CTX* ctx,
+                    bool encrypt,
+                    unsigned int auth_tag_len,
+                    const AEADMessage& message) {
+  if (!EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_SET_IVLEN, message.iv_len,
+                           nullptr) ||
+      1 != EVP_CipherInit_ex(ctx, nullptr, nullptr, nullptr, message.iv,
+                             encrypt)) {
+    return false;
+  }
+
+  int len;
+  if (message.aad_len > 0 &&
+      1 != EVP_CipherUpdate(ctx, nullptr, &len, message.aad,
+                            message.aad_len)) {
+    return false;
+  }
+
+  // OCB holds back partial blocks until EVP_CipherFinal_ex(), the other
+  // modes write all of the output here.
+  int out_len = 0;
+  if (message.in_len > 0 &&
+      1 != EVP_CipherUpdate(ctx, message.out, &out_len, message.in,
+                            message.in_len)) {
+    return false;
+  }
+
+  if (!encrypt &&
+      !EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_SET_TAG, auth_tag_len,
+                           message.tag)) {
+    return false;
+  }
+
+  if (1 != EVP_CipherFinal_ex(ctx, message.out + out_len, &len))
+    return false;
+  CHECK_EQ(out_len + len, message.in_len);
+
+  return !encrypt ||
+         EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_GET_TAG, auth_tag_len,
+                             message.tag) == 1;
+}
+
+
+void CipherContext::Initialize(Environment* env, Local<Object> target) {
+  Local<FunctionTemplate> t = env->NewFunctionTemplate(New);
+
+  t->InstanceTemplate()->SetInternalFieldCount(1);
+
+  env->SetProtoMethodNoSideEffect(t, "getAuthTagLength", GetAuthTagLength);
+  env->SetProtoMethod(t, "encryptInto", EncryptInto);
+  env->SetProtoMethod(t, "decryptInto", DecryptInto);
+  env->SetProtoMethod(t, "runBatch", RunBatch);
+
+  target->Set(env->context(),
+              FIXED_ONE_BYTE_STRING(env->isolate(), "CipherContext"),
+              t->GetFunction(env->context()).ToLocalChecked()).FromJust();
+}
+
+
+bool CipherContext::Init(const char* cipher_type,
+                         const unsigned char* key,
+                         int key_len,
+                         unsigned int auth_tag_len) {
+  MarkPopErrorOnReturn mark_pop_error_on_return;
+
+  const EVP_CIPHER* const cipher = EVP_get_cipherbyname(cipher_type);
+  if (cipher == nullptr) {
+    env()->ThrowError("Unknown cipher");
+    return false;
+  }
+
+  // CCM needs the message length before the AAD and allows a single update
+  // per message, so it is left to createCipheriv().
+  const int mode = EVP_CIPHER_mode(cipher);
+  if (!IsSupportedAuthenticatedMode(cipher) || mode == EVP_CIPH_CCM_MODE) {
+    char msg[128];
+    snprintf(msg, sizeof(msg), "Unsupported cipher for cipher context: %s",
+             cipher_type);
+    env()->ThrowError(msg);
+    return false;
+  }
+
+  if (auth_tag_len == kNoAuthTagLength) {
+    if (mode != EVP_CIPH_GCM_MODE) {
+      char msg[128];
+      snprintf(msg, sizeof(msg), "authTagLength required for %s", cipher_type);
+      env()->ThrowError(msg);
+      return false;
+    }
+    auth_tag_len = EVP_GCM_TLS_TAG_LEN;
+  } else if (mode == EVP_CIPH_GCM_MODE && !IsValidGCMTagLength(auth_tag_len)) {
+    char msg[50];
+    snprintf(msg, sizeof(msg),
+        "Invalid authentication tag length: %u", auth_tag_len);
+    env()->ThrowError(msg);
+    return false;
+  }
+
+  for (const bool encrypt : { true, false }) {
+    auto& ctx = encrypt ? encrypt_ctx_ : decrypt_ctx_;
+    ctx.reset(EVP_CIPHER_CTX_new());
+    if (1 != EVP_CipherInit_ex(ctx.get(), cipher, nullptr, nullptr, nullptr,
+                               encrypt)) {
+      ThrowCryptoError(env(), ERR_get_error(), "Failed to initialize cipher");
+      return false;
+    }
+
+    if (!EVP_CIPHER_CTX_set_key_length(ctx.get(), key_len)) {
+      env()->ThrowError("Invalid key length");
+      return false;
+    }
+
+    // GCM takes the tag length with the tag, the other modes need it up front.
+    if (mode != EVP_CIPH_GCM_MODE &&
+        !EVP_CIPHER_CTX_ctrl(ctx.get(), EVP_CTRL_AEAD_SET_TAG, auth_tag_len,
+                             nullptr)) {
+      env()->ThrowError("Invalid authentication tag length");
+      return false;
+    }
+
+    if (1 != EVP_CipherInit_ex(ctx.get(), nullptr, nullptr, key, nullptr,
+                               encrypt)) {
+      ThrowCryptoError(env(), ERR_get_error(), "Failed to initialize cipher");
+      return false;
+    }
+  }
+
+  auth_tag_len_ = auth_tag_len;
+  return true;
+}
+
+
+void CipherContext::New(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args.IsConstructCall());
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args[0]->IsString());  // cipher_type
+  CHECK(args[1]->IsArrayBufferView());  // key
+
+  // Don't assign to auth_tag_len_ directly; the value might not represent a
+  // valid length at this point.
+  unsigned int auth_tag_len;
+  if (args[2]->IsUint32()) {
+    auth_tag_len = args[2].As<Uint32>()->Value();
+  } else {
+    CHECK(args[2]->IsInt32() && args[2].As<Int32>()->Value() == -1);
+    auth_tag_len = kNoAuthTagLength;
+  }
+
+  const node::Utf8Value cipher_type(env->isolate(), args[0]);
+  CipherContext* context = new CipherContext(env, args.This());
+  context->Init(*cipher_type, BufferData(args[1]), BufferLength(args[1]),
+                auth_tag_len);
+}
+
+
+void CipherContext::GetAuthTagLength(const FunctionCallbackInfo<Value>& args) {
+  CipherContext* context;
+  ASSIGN_OR_RETURN_UNWRAP(&context, args.Holder());
+  args.GetReturnValue().Set(context->auth_tag_len_);
+}
+
+
+void CipherContext::Crypt(const FunctionCallbackInfo<Value>& args,
+                          bool encrypt) {
+  Environment* env = Environment::GetCurrent(args);
+  CipherContext* context;
+  ASSIGN_OR_RETURN_UNWRAP(&context, args.Holder());
+  CHECK(context->encrypt_ctx_ && context->decrypt_ctx_);
+  MarkPopErrorOnReturn mark_pop_error_on_return;
+
+  AEADMessage message;
+  ReadAEADMessage(args[0], args[1], args[2], args[3], args[4],
+                  context->auth_tag_len_, &message);
+  EVP_CIPHER_CTX* ctx =
+      encrypt ? context->encrypt_ctx_.get() : context->decrypt_ctx_.get();
+  if (!RunAEAD(ctx, encrypt, context->auth_tag_len_, message)) {
+    const char* msg = encrypt ?
+        "Unsupported state" :
+        "Unsupported state or unable to authenticate data";
+    return ThrowCryptoError(env, ERR_get_error(), msg);
+  }
+}
+
+
+void CipherContext::EncryptInto(const FunctionCallbackInfo<Value>& args) {
+  Crypt(args, true);
+}
+
+
+void CipherContext::DecryptInto(const FunctionCallbackInfo<Value>& args) {
+  Crypt(args, false);
+}
+
+
+// Encrypts or decrypts a list of messages with a copy of a CipherContext's
+// keyed EVP_CIPHER_CTX, so that the context stays usable on the main thread
+// and can even be collected while the job runs. The buffers are kept alive
+// by the wrap object.
+struct CipherBatchJob : public CryptoJob {
+  DeleteFnPtr<EVP_CIPHER_CTX, EVP_CIPHER_CTX_free> ctx;
+  bool encrypt;
+  unsigned int auth_tag_len;
+  std::vector<AEADMessage> messages;
+  unsigned char* results;
+
+  inline explicit CipherBatchJob(Environment* env) : CryptoJob(env) {}
+
+  inline void DoThreadPoolWork() override {
+    ClearErrorOnReturn clear_error_on_return;
+    for (size_t i = 0; i < messages.size(); i++)
+      results[i] = RunAEAD(ctx.get(), encrypt, auth_tag_len, messages[i]);
+  }
+
+  inline void AfterThreadPoolWork() override {
+    async_wrap->MakeCallback(env->ondone_string(), 0, nullptr);
+  }
+};
+
+
+void CipherContext::RunBatch(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CipherContext* context;
+  ASSIGN_OR_RETURN_UNWRAP(&context, args.Holder());
+  CHECK(context->encrypt_ctx_ && context->decrypt_ctx_);
+  CHECK(args[0]->IsBoolean());  // encrypt
+  CHECK(args[1]->IsArray());  // ivs; wrap object retains refs.
+  CHECK(args[2]->IsArray());  // inputs; wrap object retains refs.
+  CHECK(args[3]->IsArray());  // outputs; wrap object retains refs.
+  CHECK(args[4]->IsArray());  // tags; wrap object retains refs.
+  CHECK(args[5]->IsArray());  // aads; wrap object retains refs.
+  CHECK(args[6]->IsUint8Array());  // results; wrap object retains ref.
+  CHECK(args[7]->IsObject());  // wrap object
+
+  std::unique_ptr<CipherBatchJob> job(new CipherBatchJob(env));
+  job->encrypt = args[0]->IsTrue();
+  job->auth_tag_len = context->auth_tag_len_;
+  job->ctx.reset(EVP_CIPHER_CTX_new());
+  CHECK(job->ctx);
+  CHECK_EQ(1, EVP_CIPHER_CTX_copy(job->ctx.get(), job->encrypt ?
+                                  context->encrypt_ctx_.get() :
+                                  context->decrypt_ctx_.get()));
+
+  Local<Context> ctx = env->context();
+  Local<Array> arrays[5];
+  for (int i = 0; i < 5; i++)
+    arrays[i] = args[i + 1].As<Array>();
+  const uint32_t count = arrays[0]->Length();
+  for (const auto& array : arrays)
+    CHECK_EQ(array->Length(), count);
+  CHECK_EQ(Buffer::Length(args[6]), count);
+
+  job->messages.resize(count);
+  for (uint32_t i = 0; i < count; i++) {
+    ReadAEADMessage(arrays[0]->Get(ctx, i).ToLocalChecked(),
+                    arrays[1]->Get(ctx, i).ToLocalChecked(),
+                    arrays[2]->Get(ctx, i).ToLocalChecked(),
+                    arrays[3]->Get(ctx, i).ToLocalChecked(),
+                    arrays[4]->Get(ctx, i).ToLocalChecked(),
+                    job->auth_tag_len,
+                    &job->messages[i]);
+  }
+  job->results = reinterpret_cast<unsigned char*>(Buffer::Data(args[6]));
+  CipherBatchJob::Run(std::move(job), args[7]);
+}
+
+
 class KeyPairGenerationConfig {
  public:
   virtual EVPKeyCtxPointer Setup() = 0;
@@ -5775,10 +6443,12 @@ void Initialize(Local<Object> target,
   Environment* env = Environment::GetCurrent(context);
   SecureContext::Initialize(env, target);
   CipherBase::Initialize(env, target);
+  CipherContext::Initialize(env, target);
   DiffieHellman::Initialize(env, target);
   ECDH::Initialize(env, target);
   Hmac::Initialize(env, target);
   Hash::Initialize(env, target);
+  RandomPool::Initialize(env, target);
   Sign::Initialize(env, target);
   Verify::Initialize(env, target);
 
@@ -5800,6 +6470,8 @@ void Initialize(Local<Object> target,
 #endif
 
   env->SetMethod(target, "pbkdf2", PBKDF2);
+  env->SetMethod(target, "hashBatch", HashBatch);
+  env->SetMethod(target, "verifyBatch", VerifyBatch);
   env->SetMethod(target, "generateKeyPairRSA", GenerateKeyPairRSA);
   env->SetMethod(target, "generateKeyPairDSA", GenerateKeyPairDSA);
   env->SetMethod(target, "generateKeyPairEC", GenerateKeyPairEC);
@@ -429,6 +429,47 @@ class CipherBase : public BaseObject {
   int max_message_size_;
 };
 
+// An AEAD key that encrypts and decrypts any number of messages. Unlike
+// CipherBase, the EVP_CIPHER_CTXs are keyed once and then only get a new IV
+// for every message, so the key schedule is not recomputed each time.
+class CipherContext : public BaseObject {
+ public:
+  static void Initialize(Environment* env, v8::Local<v8::Object> target);
+
+  // TODO(joyeecheung): track the memory used by OpenSSL types
+  SET_NO_MEMORY_INFO()
+  SET_MEMORY_INFO_NAME(CipherContext)
+  SET_SELF_SIZE(CipherContext)
+
+ protected:
+  static const unsigned kNoAuthTagLength = static_cast<unsigned>(-1);
+
+  bool Init(const char* cipher_type,
+            const unsigned char* key,
+            int key_len,
+            unsigned int auth_tag_len);
+
+  static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void GetAuthTagLength(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void EncryptInto(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void DecryptInto(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void RunBatch(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  CipherContext(Environment* env, v8::Local<v8::Object> wrap)
+      : BaseObject(env, wrap),
+        auth_tag_len_(kNoAuthTagLength) {
+    MakeWeak();
+  }
+
+ private:
+  static void Crypt(const v8::FunctionCallbackInfo<v8::Value>& args,
+                    bool encrypt);
+
+  DeleteFnPtr<EVP_CIPHER_CTX, EVP_CIPHER_CTX_free> encrypt_ctx_;
+  DeleteFnPtr<EVP_CIPHER_CTX, EVP_CIPHER_CTX_free> decrypt_ctx_;
+  unsigned int auth_tag_len_;
+};
+
 class Hmac : public BaseObject {
  public:
   static void Initialize(Environment* env, v8::Local<v8::Object> target);
@@ -688,6 +729,45 @@ class ECDH : public BaseObject {
   const EC_GROUP* group_;
 };
 
+struct RandomPoolRefillJob;
+
+// Random bytes generated ahead of time for small synchronous requests, like
+// crypto.randomBytes(16) and crypto.randomUUID(), which only have to copy them
+// out. Once half of the pool is used up, a fresh one is generated on the
+// threadpool to take its place.
+class RandomPool : public BaseObject {
+ public:
+  static const size_t kPoolSize = 4096;
+  static const size_t kMaxRequestSize = 256;
+
+  ~RandomPool() override;
+
+  static void Initialize(Environment* env, v8::Local<v8::Object> target);
+
+  void MemoryInfo(MemoryTracker* tracker) const override;
+  SET_MEMORY_INFO_NAME(RandomPool)
+  SET_SELF_SIZE(RandomPool)
+
+ protected:
+  friend struct RandomPoolRefillJob;
+
+  static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Fill(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void RandomUUID(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  RandomPool(Environment* env, v8::Local<v8::Object> wrap);
+
+  bool Take(unsigned char* out, size_t size);
+  void StartRefill();
+  void FinishRefill(std::unique_ptr<unsigned char[]> data);
+
+ private:
+  std::unique_ptr<unsigned char[]> pool_;
+  size_t used_;
+  std::unique_ptr<unsigned char[]> next_;
+  RandomPoolRefillJob* refill_;
+};
+
 bool EntropySource(unsigned char* buffer, size_t length);
 #ifndef OPENSSL_NO_ENGINE
 void SetEngine(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -20,10 +20,12 @@
 // USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "node_crypto_bio.h"
+#include "node_mutex.h"
 #include "openssl/bio.h"
 #include "util-inl.h"
 #include <limits.h>
 #include <string.h>
+#include <vector>
 
 namespace node {
 namespace crypto {
@@ -37,6 +39,9 @@ namespace crypto {
 #define BIO_get_init(bio) bio->init
 #endif
 
+static Mutex chunk_pool_mutex;
+static std::vector<char*> chunk_pool;
+
 
 BIOPointer NodeBIO::New(Environment* env) {
   // The const_cast doesn't violate const correctness.  OpenSSL's usage of
@@ -103,6 +108,11 @@ int NodeBIO::Read(BIO* bio, char* out, int len) {
 
 
 char* NodeBIO::Peek(size_t* size) {
+  if (read_head_ == nullptr) {
+    *size = 0;
+    return nullptr;
+  }
+
   *size = read_head_->write_pos_ - read_head_->read_pos_;
   return read_head_->data_ + read_head_->read_pos_;
 }
@@ -113,6 +123,11 @@ size_t NodeBIO::PeekMultiple(char** out, size_t* size, size_t* count) {
   size_t max = *count;
   size_t total = 0;
 
+  if (pos == nullptr) {
+    *count = 0;
+    return 0;
+  }
+
   size_t i;
   for (i = 0; i < max; i++) {
     size[i] = pos->write_pos_ - pos->read_pos_;
@@ -316,6 +331,12 @@ size_t NodeBIO::Read(char* out, size_t size) {
   // Free all empty buffers, but write_head's child
   FreeEmpty();
 
+  // Nothing is buffered any more, give the memory back until the next write.
+  // Pointers handed out by Peek() and PeekMultiple() are only valid until the
+  // data they point to is read, so none of them can be outstanding here.
+  if (length_ == 0)
+    FreeAll();
+
   return bytes_read;
 }
 
@@ -343,6 +364,22 @@ void NodeBIO::FreeEmpty() {
 }
 
 
+void NodeBIO::FreeAll() {
+  if (read_head_ == nullptr)
+    return;
+
+  Buffer* current = read_head_;
+  do {
+    Buffer* next = current->next_;
+    delete current;
+    current = next;
+  } while (current != read_head_);
+
+  read_head_ = nullptr;
+  write_head_ = nullptr;
+}
+
+
 size_t NodeBIO::IndexOf(char delim, size_t limit) {
   size_t bytes_read = 0;
   size_t max = Length() > limit ? limit : Length();
@@ -426,7 +463,10 @@ void NodeBIO::Write(const char* data, size_t size) {
 
 
 char* NodeBIO::PeekWritable(size_t* size) {
-  TryAllocateForWrite(*size);
+  // Callers only get one contiguous chunk and have to cope with less than
+  // they asked for anyway, so keep the chunk at a size the pool can recycle.
+  TryAllocateForWrite(*size < kThroughputBufferLength ?
+                          *size : kThroughputBufferLength);
 
   size_t available = write_head_->len_ - write_head_->write_pos_;
   if (*size != 0 && available > *size)
@@ -499,19 +539,37 @@ void NodeBIO::Reset() {
 }
 
 
-NodeBIO::~NodeBIO() {
-  if (read_head_ == nullptr)
-    return;
+char* NodeBIO::AllocateChunk(size_t* len) {
+  if (*len > kThroughputBufferLength)
+    return new char[*len];
 
-  Buffer* current = read_head_;
-  do {
-    Buffer* next = current->next_;
-    delete current;
-    current = next;
-  } while (current != read_head_);
+  *len = kThroughputBufferLength;
+  {
+    Mutex::ScopedLock lock(chunk_pool_mutex);
+    if (!chunk_pool.empty()) {
+      char* data = chunk_pool.back();
+      chunk_pool.pop_back();
+      return data;
+    }
+  }
+  return new char[kThroughputBufferLength];
+}
 
-  read_head_ = nullptr;
-  write_head_ = nullptr;
+
+void NodeBIO::ReleaseChunk(char* data, size_t len) {
+  if (len == kThroughputBufferLength) {
+    Mutex::ScopedLock lock(chunk_pool_mutex);
+    if (chunk_pool.size() < kMaxPooledChunks) {
+      chunk_pool.push_back(data);
+      return;
+    }
+  }
+  delete[] data;
+}
+
+
+NodeBIO::~NodeBIO() {
+  FreeAll();
 }
 
 
@@ -62,6 +62,10 @@ class NodeBIO : public MemoryRetainer {
   // Deallocate children of write head's child if they're empty
   void FreeEmpty();
 
+  // Deallocate every buffer once all data has been read, so that idle
+  // connections don't keep their buffers around
+  void FreeAll();
+
   // Return pointer to internal data and amount of
   // contiguous data available to read
   char* Peek(size_t* size);
@@ -137,13 +141,13 @@ class NodeBIO : public MemoryRetainer {
                                            write_pos_(0),
                                            len_(len),
                                            next_(nullptr) {
-      data_ = new char[len];
+      data_ = AllocateChunk(&len_);
       if (env_ != nullptr)
-        env_->isolate()->AdjustAmountOfExternalAllocatedMemory(len);
+        env_->isolate()->AdjustAmountOfExternalAllocatedMemory(len_);
     }
 
     ~Buffer() {
-      delete[] data_;
+      ReleaseChunk(data_, len_);
       if (env_ != nullptr) {
         const int64_t len = static_cast<int64_t>(len_);
         env_->isolate()->AdjustAmountOfExternalAllocatedMemory(-len);
@@ -158,6 +162,14 @@ class NodeBIO : public MemoryRetainer {
     char* data_;
   };
 
+  // Chunks of kThroughputBufferLength bytes are recycled through a small
+  // process-wide pool instead of going back to the allocator, since busy
+  // connections keep freeing and reallocating them. Smaller requests are
+  // rounded up to that size; `len` is updated accordingly.
+  static char* AllocateChunk(size_t* len);
+  static void ReleaseChunk(char* data, size_t len);
+  static const size_t kMaxPooledChunks = 256;
+
   Environment* env_ = nullptr;
   size_t initial_ = kInitialBufferLength;
   size_t length_ = 0;
@@ -21,6 +21,7 @@
 
 #include "aliased_buffer.h"
 #include "node_buffer.h"
+#include "node_errors.h"
 #include "node_internals.h"
 #include "node_stat_watcher.h"
 #include "node_file.h"
@@ -42,7 +43,15 @@
 # include <io.h>
 #endif
 
+#ifndef _WIN32
+# include <sys/mman.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 namespace node {
 
@@ -62,6 +71,7 @@ using v8::Integer;
 using v8::Isolate;
 using v8::Local;
 using v8::MaybeLocal;
+using v8::Null;
 using v8::Number;
 using v8::Object;
 using v8::ObjectTemplate;
@@ -446,7 +456,59 @@ void FSReqCallback::SetReturnValue(const FunctionCallbackInfo<Value>& args) {
 void NewFSReqCallback(const FunctionCallbackInfo<Value>& args) {
   CHECK(args.IsConstructCall());
   Environment* env = Environment::GetCurrent(args);
-  new FSReqCallback(env, args.This(), args[0]->IsTrue());
+  new (env) FSReqCallback(env, args.This(), args[0]->IsTrue());
+}
+
+// With --module-resolution-cache, the results of InternalModuleStat and
+// InternalModuleReadJSON are kept for the lifetime of the process, so that
+// every require() doesn't stat the same node_modules directories and read the
+// same package.json files again. The cache is shared by all Environments.
+// Calls through this binding that add, remove or rename directory entries or
+// truncate files, and events from fs.watch() and fs.watchFile() watchers,
+// clear it. Changes made by other processes are not seen until then.
+struct ModuleResolutionCache {
+  struct PackageJSON {
+    bool found;
+    std::string contents;
+  };
+
+  std::atomic<bool> enabled { false };
+  Mutex mutex;
+  // Incremented by every Clear(), so that a result read from the file system
+  // while the cache was being cleared isn't added afterwards.
+  uint64_t generation = 0;
+  std::unordered_map<std::string, int> stats;
+  std::unordered_map<std::string, PackageJSON> package_jsons;
+
+  void Clear() {
+    Mutex::ScopedLock lock(mutex);
+    generation++;
+    stats.clear();
+    package_jsons.clear();
+  }
+};
+
+static ModuleResolutionCache module_resolution_cache;
+
+void ClearModuleResolutionCache() {
+  if (module_resolution_cache.enabled)
+    module_resolution_cache.Clear();
+}
+
+// Whether a successful call of the syscall can change what
+// InternalModuleStat or InternalModuleReadJSON return.
+static bool InvalidatesModuleResolution(const char* syscall) {
+  if (syscall == nullptr)
+    return false;
+  static const char* const syscalls[] = {
+    "copyfile", "link", "mkdir", "mkdtemp", "rename", "rmdir", "symlink",
+    "unlink"
+  };
+  for (const char* name : syscalls) {
+    if (strcmp(syscall, name) == 0)
+      return true;
+  }
+  return false;
 }
 
 FSReqAfterScope::FSReqAfterScope(FSReqBase* wrap, uv_fs_t* req)
@@ -455,6 +517,8 @@ FSReqAfterScope::FSReqAfterScope(FSReqBase* wrap, uv_fs_t* req)
       handle_scope_(wrap->env()->isolate()),
       context_scope_(wrap->env()->context()) {
   CHECK_EQ(wrap_->req(), req);
+  if (req->result >= 0 && InvalidatesModuleResolution(wrap_->syscall()))
+    ClearModuleResolutionCache();
 }
 
 FSReqAfterScope::~FSReqAfterScope() {
@@ -719,6 +783,8 @@ inline int SyncCall(Environment* env, Local<Value> ctx, FSReqWrapSync* req_wrap,
     const char* syscall, Func fn, Args... args) {
   env->PrintSyncTrace();
   int err = fn(env->event_loop(), &(req_wrap->req), args..., nullptr);
+  if (err >= 0 && InvalidatesModuleResolution(syscall))
+    ClearModuleResolutionCache();
   if (err < 0) {
     Local<Context> context = env->context();
     Local<Object> ctx_obj = ctx.As<Object>();
@@ -739,9 +805,9 @@ inline FSReqBase* GetReqWrap(Environment* env, Local<Value> value,
     return Unwrap<FSReqBase>(value.As<Object>());
   } else if (value->StrictEquals(env->fs_use_promises_symbol())) {
     if (use_bigint) {
-      return new FSReqPromise<uint64_t, BigUint64Array>(env, use_bigint);
+      return new (env) FSReqPromise<uint64_t, BigUint64Array>(env, use_bigint);
     } else {
-      return new FSReqPromise<double, Float64Array>(env, use_bigint);
+      return new (env) FSReqPromise<double, Float64Array>(env, use_bigint);
     }
   }
   return nullptr;
@@ -798,26 +864,15 @@ void Close(const FunctionCallbackInfo<Value>& args) {
 }
 
 
-// Used to speed up module loading.  Returns the contents of the file as
-// a string or undefined when the file cannot be opened or "main" is not found
-// in the file.
-static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
-  Environment* env = Environment::GetCurrent(args);
-  Isolate* isolate = env->isolate();
-  uv_loop_t* loop = env->event_loop();
-
-  CHECK(args[0]->IsString());
-  node::Utf8Value path(isolate, args[0]);
-
-  if (strlen(*path) != path.length())
-    return;  // Contains a nul byte.
-
+static bool ReadPackageJSON(uv_loop_t* loop,
+                            const char* path,
+                            std::string* contents) {
   uv_fs_t open_req;
-  const int fd = uv_fs_open(loop, &open_req, *path, O_RDONLY, 0, nullptr);
+  const int fd = uv_fs_open(loop, &open_req, path, O_RDONLY, 0, nullptr);
   uv_fs_req_cleanup(&open_req);
 
   if (fd < 0) {
-    return;
+    return false;
   }
 
   std::shared_ptr<void> defer_close(nullptr, [fd, loop] (...) {
@@ -843,7 +898,7 @@ static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
     uv_fs_req_cleanup(&read_req);
 
     if (numchars < 0)
-      return;
+      return false;
 
     offset += numchars;
   } while (static_cast<size_t>(numchars) == kBlockSize);
@@ -855,13 +910,56 @@ static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
 
   const size_t size = offset - start;
   if (size == 0 || size == SearchString(&chars[start], size, "\"main\"")) {
-    return;
-  } else {
+    return false;
+  }
+  contents->assign(&chars[start], size);
+  return true;
+}
+
+// Used to speed up module loading.  Returns the contents of the file as
+// a string or undefined when the file cannot be opened or "main" is not found
+// in the file.
+static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+
+  CHECK(args[0]->IsString());
+  node::Utf8Value path(isolate, args[0]);
+
+  if (strlen(*path) != path.length())
+    return;  // Contains a nul byte.
+
+  ModuleResolutionCache* cache = &module_resolution_cache;
+  const bool use_cache = cache->enabled;
+  uint64_t generation = 0;
+  ModuleResolutionCache::PackageJSON package_json;
+  bool cached = false;
+  if (use_cache) {
+    Mutex::ScopedLock lock(cache->mutex);
+    auto it = cache->package_jsons.find(*path);
+    if (it != cache->package_jsons.end()) {
+      package_json = it->second;
+      cached = true;
+    }
+    generation = cache->generation;
+  }
+
+  if (!cached) {
+    package_json.found =
+        ReadPackageJSON(env->event_loop(), *path, &package_json.contents);
+    if (use_cache) {
+      Mutex::ScopedLock lock(cache->mutex);
+      if (cache->generation == generation)
+        cache->package_jsons.emplace(*path, package_json);
+    }
+  }
+
+  if (package_json.found) {
     Local<String> chars_string =
         String::NewFromUtf8(isolate,
-                            &chars[start],
+                            package_json.contents.data(),
                             v8::NewStringType::kNormal,
-                            size).ToLocalChecked();
+                            package_json.contents.size()).ToLocalChecked();
     args.GetReturnValue().Set(chars_string);
   }
 }
@@ -875,6 +973,17 @@ static void InternalModuleStat(const FunctionCallbackInfo<Value>& args) {
   CHECK(args[0]->IsString());
   node::Utf8Value path(env->isolate(), args[0]);
 
+  ModuleResolutionCache* cache = &module_resolution_cache;
+  const bool use_cache = cache->enabled;
+  uint64_t generation = 0;
+  if (use_cache) {
+    Mutex::ScopedLock lock(cache->mutex);
+    auto it = cache->stats.find(*path);
+    if (it != cache->stats.end())
+      return args.GetReturnValue().Set(it->second);
+    generation = cache->generation;
+  }
+
   uv_fs_t req;
   int rc = uv_fs_stat(env->event_loop(), &req, *path, nullptr);
   if (rc == 0) {
@@ -883,6 +992,12 @@ static void InternalModuleStat(const FunctionCallbackInfo<Value>& args) {
   }
   uv_fs_req_cleanup(&req);
 
+  if (use_cache) {
+    Mutex::ScopedLock lock(cache->mutex);
+    if (cache->generation == generation)
+      cache->stats.emplace(*path, rc);
+  }
+
   args.GetReturnValue().Set(rc);
 }
 
@@ -1526,6 +1641,11 @@ static void Open(const FunctionCallbackInfo<Value>& args) {
   CHECK(args[2]->IsInt32());
   const int mode = args[2].As<Int32>()->Value();
 
+  // Creating a file adds a directory entry, and a truncated package.json
+  // is about to be rewritten.
+  if (flags & (O_CREAT | O_TRUNC))
+    ClearModuleResolutionCache();
+
   FSReqBase* req_wrap_async = GetReqWrap(env, args[3]);
   if (req_wrap_async != nullptr) {  // open(path, flags, mode, req)
     AsyncCall(env, req_wrap_async, args, "open", UTF8, AfterInteger,
@@ -1557,6 +1677,11 @@ static void OpenFileHandle(const FunctionCallbackInfo<Value>& args) {
   CHECK(args[2]->IsInt32());
   const int mode = args[2].As<Int32>()->Value();
 
+  // Creating a file adds a directory entry, and a truncated package.json
+  // is about to be rewritten.
+  if (flags & (O_CREAT | O_TRUNC))
+    ClearModuleResolutionCache();
+
   FSReqBase* req_wrap_async = GetReqWrap(env, args[3]);
   if (req_wrap_async != nullptr) {  // openFileHandle(path, flags, mode, req)
     AsyncCall(env, req_wrap_async, args, "open", UTF8, AfterOpenFileHandle,
@@ -1872,6 +1997,312 @@ static void Read(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Reads a whole file for fs.readFile() and fs.readFileSync(). The file is
+// fstat()ed once so that a regular file can be read into a buffer of exactly
+// its size, or mapped copy-on-write, and that memory becomes the Buffer
+// without being copied. Files whose size is unknown are read until EOF.
+// Without a loop every uv_fs_* call is synchronous, so this runs the same
+// way on the thread pool and on the main thread.
+class FileReader {
+ public:
+  FileReader(std::string&& path, uv_file fd, int flags, bool map)
+      : path_(std::move(path)), fd_(fd), flags_(flags), map_(map) {}
+
+  ~FileReader() {
+    if (data_ == nullptr)
+      return;
+    if (mapped_)
+      Unmap(data_, reinterpret_cast<void*>(length_));
+    else
+      free(data_);
+  }
+
+  // Opens the file unless it was given as a file descriptor, reads it and
+  // closes it again. The steps of a synchronous read are traced like the
+  // separate calls readFileSync() used to make.
+  void Run(bool sync) {
+    uv_fs_t req;
+    uv_file fd = fd_;
+    if (fd_ < 0) {
+      if (sync) { FS_SYNC_TRACE_BEGIN(open); }
+      fd = Call(&req, "open", uv_fs_open, path_.c_str(), flags_, 0666);
+      uv_fs_req_cleanup(&req);
+      if (sync) { FS_SYNC_TRACE_END(open); }
+      if (fd < 0)
+        return;
+    }
+
+    if (sync) { FS_SYNC_TRACE_BEGIN(fstat); }
+    int err = Call(&req, "fstat", uv_fs_fstat, fd);
+    const bool regular = (req.statbuf.st_mode & S_IFMT) == S_IFREG;
+    const uint64_t size = regular ? req.statbuf.st_size : 0;
+    uv_fs_req_cleanup(&req);
+    if (sync) { FS_SYNC_TRACE_END(fstat); }
+
+    if (err == 0) {
+      if (size > Buffer::kMaxLength) {
+        too_large_size_ = size;
+      } else if (size == 0) {
+        ReadAll(fd, 0, sync);
+      } else if (!map_ || fd_ >= 0 || !Map(fd, size)) {
+        // Mapping a file descriptor would ignore its current position, and
+        // files that can't be mapped are still read.
+        ReadAll(fd, size, sync);
+      }
+    }
+
+    if (fd_ < 0) {
+      if (sync) { FS_SYNC_TRACE_BEGIN(close); }
+      Call(&req, "close", uv_fs_close, fd);
+      uv_fs_req_cleanup(&req);
+      if (sync) { FS_SYNC_TRACE_END(close); }
+    }
+  }
+
+  bool too_large() const { return too_large_size_ != 0; }
+  int error() const { return error_; }
+  const char* syscall() const { return syscall_; }
+
+  Local<Value> Error(Environment* env) const {
+    Isolate* isolate = env->isolate();
+    if (too_large())
+      return ERR_FS_FILE_TOO_LARGE(isolate, TooLargeMessage().c_str());
+    return UVException(isolate, error_, syscall_, nullptr,
+                       fd_ < 0 ? path_.c_str() : nullptr);
+  }
+
+  std::string TooLargeMessage() const {
+    return "File size (" + std::to_string(too_large_size_) +
+           ") is greater than possible Buffer: " +
+           std::to_string(Buffer::kMaxLength) + " bytes";
+  }
+
+  // Hands the contents over to a Buffer.
+  MaybeLocal<Object> ToBuffer(Environment* env) {
+    char* data = data_;
+    data_ = nullptr;
+    if (mapped_)
+      return Buffer::New(env, data, length_, Unmap,
+                         reinterpret_cast<void*>(length_));
+    if (data == nullptr)
+      return Buffer::New(env, static_cast<size_t>(0));
+    return Buffer::New(env, data, length_);
+  }
+
+ private:
+  static const size_t kUnknownSizeChunk = 8 * 1024;
+
+  template <typename Func, typename... Args>
+  int Call(uv_fs_t* req, const char* syscall, Func fn, Args... args) {
+    int err = fn(nullptr, req, args..., nullptr);
+    if (err < 0 && error_ == 0) {
+      error_ = err;
+      syscall_ = syscall;
+    }
+    return err;
+  }
+
+  // Reads from the current position until `size` bytes have been read, or,
+  // when the size is unknown, until EOF.
+  void ReadAll(uv_file fd, size_t size, bool sync) {
+    size_t capacity = size;
+    if (capacity == 0)
+      capacity = kUnknownSizeChunk;
+    data_ = UncheckedMalloc(capacity);
+    if (data_ == nullptr) {
+      error_ = UV_ENOMEM;
+      syscall_ = "read";
+      return;
+    }
+
+    uv_fs_t req;
+    while (true) {
+      if (length_ == capacity) {
+        if (size > 0)
+          break;
+        if (capacity >= Buffer::kMaxLength) {
+          too_large_size_ = capacity + 1;
+          return;
+        }
+        capacity = std::min<size_t>(capacity * 2, Buffer::kMaxLength);
+        char* grown = UncheckedRealloc(data_, capacity);
+        if (grown == nullptr) {
+          error_ = UV_ENOMEM;
+          syscall_ = "read";
+          return;
+        }
+        data_ = grown;
+      }
+
+      uv_buf_t buf = uv_buf_init(data_ + length_, capacity - length_);
+      if (sync) { FS_SYNC_TRACE_BEGIN(read); }
+      int bytes_read = Call(&req, "read", uv_fs_read, fd, &buf, 1, -1);
+      uv_fs_req_cleanup(&req);
+      if (sync) { FS_SYNC_TRACE_END(read, "bytesRead", bytes_read); }
+      if (bytes_read <= 0)
+        break;
+      length_ += bytes_read;
+    }
+
+    // Files that shrank, and files of unknown size, leave room to spare.
+    if (length_ == 0) {
+      free(data_);
+      data_ = nullptr;
+    } else if (length_ < capacity) {
+      char* shrunk = UncheckedRealloc(data_, length_);
+      if (shrunk != nullptr)
+        data_ = shrunk;
+    }
+  }
+
+  // Writes to the mapping are private to the process and never reach the
+  // file, so the Buffer can be used like any other.
+  bool Map(uv_file fd, size_t size) {
+#ifdef _WIN32
+    HANDLE file = uv_get_osfhandle(fd);
+    HANDLE mapping =
+        CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (mapping == nullptr)
+      return false;
+    void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, size);
+    CloseHandle(mapping);
+    if (data == nullptr)
+      return false;
+#else
+    void* data =
+        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED)
+      return false;
+#endif
+    data_ = static_cast<char*>(data);
+    length_ = size;
+    mapped_ = true;
+    return true;
+  }
+
+  static void Unmap(char* data, void* hint) {
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap(data, reinterpret_cast<size_t>(hint));
+#endif
+  }
+
+  std::string path_;
+  const uv_file fd_;
+  const int flags_;
+  const bool map_;
+  char* data_ = nullptr;
+  size_t length_ = 0;
+  bool mapped_ = false;
+  uint64_t too_large_size_ = 0;
+  int error_ = 0;
+  const char* syscall_ = nullptr;
+
+  DISALLOW_COPY_AND_ASSIGN(FileReader);
+};
+
+class ReadFileWork : public ThreadPoolWork {
+ public:
+  ReadFileWork(FSReqBase* req_wrap, std::string&& path, uv_file fd,
+               int flags, bool map)
+      : ThreadPoolWork(req_wrap->env()),
+        req_wrap_(req_wrap),
+        reader_(std::move(path), fd, flags, map) {}
+
+  void DoThreadPoolWork() override {
+    reader_.Run(false);
+  }
+
+  void AfterThreadPoolWork(int status) override {
+    std::unique_ptr<ReadFileWork> self(this);
+    std::unique_ptr<FSReqBase> req_wrap(req_wrap_);
+    if (status == UV_ECANCELED)
+      return;
+    CHECK_EQ(status, 0);
+
+    Environment* env = req_wrap->env();
+    HandleScope handle_scope(env->isolate());
+    Context::Scope context_scope(env->context());
+
+    if (reader_.too_large() || reader_.error() < 0) {
+      req_wrap->Reject(reader_.Error(env));
+      return;
+    }
+    Local<Object> buffer;
+    if (reader_.ToBuffer(env).ToLocal(&buffer))
+      req_wrap->Resolve(buffer);
+  }
+
+ private:
+  FSReqBase* const req_wrap_;
+  FileReader reader_;
+};
+
+/* Wrapper for the whole of fs.readFile() and fs.readFileSync()
+ *
+ * 0 path      string or int32 fd, which is read from its current position
+ *             and left open
+ * 1 flags     int32. flags to open the path with
+ * 2 mmap      boolean. map a regular file instead of reading it
+ */
+static void ReadFile(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  const int argc = args.Length();
+  CHECK_GE(argc, 4);
+
+  std::string path;
+  uv_file fd = -1;
+  if (args[0]->IsInt32()) {
+    fd = args[0].As<Int32>()->Value();
+    CHECK_GE(fd, 0);
+  } else {
+    BufferValue path_value(env->isolate(), args[0]);
+    CHECK_NOT_NULL(*path_value);
+    path.assign(*path_value, path_value.length());
+  }
+
+  CHECK(args[1]->IsInt32());
+  const int flags = args[1].As<Int32>()->Value();
+
+  CHECK(args[2]->IsBoolean());
+  const bool map = args[2]->IsTrue();
+
+  if (fd < 0 && (flags & (O_CREAT | O_TRUNC)))
+    ClearModuleResolutionCache();
+
+  FSReqBase* req_wrap_async = GetReqWrap(env, args[3]);
+  if (req_wrap_async != nullptr) {  // readFile(path, flags, mmap, req)
+    ReadFileWork* work =
+        new ReadFileWork(req_wrap_async, std::move(path), fd, flags, map);
+    work->ScheduleWork();
+    req_wrap_async->SetReturnValue(args);
+  } else {  // readFile(path, flags, mmap, undefined, ctx)
+    CHECK_EQ(argc, 5);
+    env->PrintSyncTrace();
+    FileReader reader(std::move(path), fd, flags, map);
+    reader.Run(true);
+    if (reader.too_large()) {
+      THROW_ERR_FS_FILE_TOO_LARGE(env, reader.TooLargeMessage().c_str());
+      return;
+    }
+    if (reader.error() < 0) {
+      Local<Context> context = env->context();
+      Local<Object> ctx_obj = args[4].As<Object>();
+      ctx_obj->Set(context, env->errno_string(),
+                   Integer::New(env->isolate(), reader.error())).FromJust();
+      ctx_obj->Set(context, env->syscall_string(),
+                   OneByteString(env->isolate(), reader.syscall())).FromJust();
+      return;
+    }
+    Local<Object> buffer;
+    if (reader.ToBuffer(env).ToLocal(&buffer))
+      args.GetReturnValue().Set(buffer);
+  }
+}
+
+
 /* fs.chmod(path, mode);
  * Wrapper for chmod(1) / EIO_CHMOD
  */
@@ -2123,6 +2554,254 @@ static void Mkdtemp(const FunctionCallbackInfo<Value>& args) {
   }
 }
 
+// Walks a directory tree on the thread pool. Each read() lists directories
+// and lstat()s entries until it has collected a chunk of them, so a whole
+// tree costs a few thread pool round trips and calls into JS instead of one
+// or two per entry. Symbolic links are reported but not followed. Entries are
+// paths relative to the root, and a directory always comes before its
+// contents.
+class DirectoryWalker : public AsyncWrap, public ThreadPoolWork {
+ public:
+  DirectoryWalker(Environment* env,
+                  Local<Object> object,
+                  std::string&& root,
+                  bool with_stats,
+                  size_t chunk_size)
+      : AsyncWrap(env, object, AsyncWrap::PROVIDER_DIRECTORYWALKER),
+        ThreadPoolWork(env),
+        root_(std::move(root)),
+        with_stats_(with_stats),
+        chunk_size_(chunk_size) {
+    MakeWeak();
+    // The root itself is not reported, only its contents.
+    pending_directories_.emplace_back();
+  }
+
+  ~DirectoryWalker() override {
+    CHECK(!reading_);
+  }
+
+  // new DirectoryWalker(path, withStats, chunkSize)
+  static void New(const FunctionCallbackInfo<Value>& args) {
+    CHECK(args.IsConstructCall());
+    Environment* env = Environment::GetCurrent(args);
+
+    BufferValue path(env->isolate(), args[0]);
+    CHECK_NOT_NULL(*path);
+    CHECK(args[1]->IsBoolean());
+    CHECK(args[2]->IsUint32());
+    const uint32_t chunk_size = args[2].As<Uint32>()->Value();
+    CHECK_GT(chunk_size, 0);
+
+    new DirectoryWalker(env, args.This(), std::string(*path, path.length()),
+                        args[1]->IsTrue(), chunk_size);
+  }
+
+  // read() calls oncomplete(err, names, types, stats) with the next chunk of
+  // entries, or with null names once the whole tree has been walked.
+  static void Read(const FunctionCallbackInfo<Value>& args) {
+    DirectoryWalker* walker;
+    ASSIGN_OR_RETURN_UNWRAP(&walker, args.Holder());
+    CHECK(!walker->reading_);
+
+    walker->reading_ = true;
+    walker->ClearWeak();
+    walker->ScheduleWork();
+  }
+
+  void DoThreadPoolWork() override {
+    entries_.clear();
+    while (entries_.size() < chunk_size_ && error_ == 0) {
+      if (next_entry_ == directory_entries_.size()) {
+        if (pending_directories_.empty())
+          break;
+        ReadNextDirectory();
+        continue;
+      }
+
+      std::pair<std::string, int>& dirent = directory_entries_[next_entry_++];
+      Entry entry;
+      if (current_directory_.empty()) {
+        entry.path = std::move(dirent.first);
+      } else {
+        entry.path = current_directory_ + kSeparator + dirent.first;
+      }
+      entry.type = dirent.second;
+
+      if (with_stats_ || entry.type == UV_DIRENT_UNKNOWN) {
+        const std::string path = FullPath(entry.path);
+        uv_fs_t req;
+        // Synchronous libuv calls don't use the loop.
+        int err = uv_fs_lstat(nullptr, &req, path.c_str(), nullptr);
+        if (err == 0)
+          entry.stat = req.statbuf;
+        uv_fs_req_cleanup(&req);
+        if (err == UV_ENOENT)
+          continue;  // Removed since the directory was read.
+        if (err != 0) {
+          SetError(err, "lstat", path);
+          break;
+        }
+        if (entry.type == UV_DIRENT_UNKNOWN)
+          entry.type = DirentTypeFromMode(entry.stat.st_mode);
+      }
+
+      if (entry.type == UV_DIRENT_DIR)
+        pending_directories_.push_back(entry.path);
+      entries_.push_back(std::move(entry));
+    }
+  }
+
+  void AfterThreadPoolWork(int status) override {
+    reading_ = false;
+    MakeWeak();
+
+    Isolate* isolate = env()->isolate();
+    HandleScope handle_scope(isolate);
+    Context::Scope context_scope(env()->context());
+
+    if (status == UV_ECANCELED)
+      return;
+    CHECK_EQ(status, 0);
+
+    if (error_ != 0) {
+      Local<Value> argv[] = {
+        UVException(isolate, error_, error_syscall_, nullptr,
+                    error_path_.c_str())
+      };
+      MakeCallback(env()->oncomplete_string(), arraysize(argv), argv);
+      return;
+    }
+
+    if (entries_.empty()) {
+      Local<Value> argv[] = { Null(isolate), Null(isolate) };
+      MakeCallback(env()->oncomplete_string(), arraysize(argv), argv);
+      return;
+    }
+
+    const size_t count = entries_.size();
+    std::vector<Local<Value>> names(count);
+    std::vector<Local<Value>> types(count);
+    for (size_t i = 0; i < count; i++) {
+      const std::string& path = entries_[i].path;
+      names[i] = String::NewFromUtf8(isolate, path.data(),
+                                     v8::NewStringType::kNormal,
+                                     path.size()).ToLocalChecked();
+      types[i] = Integer::New(isolate, entries_[i].type);
+    }
+
+    Local<Value> argv[] = {
+      Null(isolate),
+      Array::New(isolate, names.data(), count),
+      Array::New(isolate, types.data(), count),
+      Undefined(isolate)
+    };
+    if (with_stats_) {
+      AliasedBuffer<double, Float64Array> stats(isolate,
+                                                count * kFsStatsFieldsNumber);
+      for (size_t i = 0; i < count; i++)
+        FillStatsArray(&stats, &entries_[i].stat, i * kFsStatsFieldsNumber);
+      argv[3] = stats.GetJSArray();
+    }
+    entries_.clear();
+    MakeCallback(env()->oncomplete_string(), arraysize(argv), argv);
+  }
+
+  SET_NO_MEMORY_INFO()
+  SET_MEMORY_INFO_NAME(DirectoryWalker)
+  SET_SELF_SIZE(DirectoryWalker)
+
+ private:
+  struct Entry {
+    std::string path;
+    int type;
+    uv_stat_t stat;
+  };
+
+#ifdef _WIN32
+  static const char kSeparator = '\\';
+#else
+  static const char kSeparator = '/';
+#endif
+
+  static int DirentTypeFromMode(uint64_t mode) {
+    switch (mode & S_IFMT) {
+      case S_IFREG: return UV_DIRENT_FILE;
+      case S_IFDIR: return UV_DIRENT_DIR;
+      case S_IFLNK: return UV_DIRENT_LINK;
+      case S_IFCHR: return UV_DIRENT_CHAR;
+#ifdef S_IFBLK
+      case S_IFBLK: return UV_DIRENT_BLOCK;
+#endif
+#ifdef S_IFIFO
+      case S_IFIFO: return UV_DIRENT_FIFO;
+#endif
+#ifdef S_IFSOCK
+      case S_IFSOCK: return UV_DIRENT_SOCKET;
+#endif
+      default: return UV_DIRENT_UNKNOWN;
+    }
+  }
+
+  std::string FullPath(const std::string& relative) const {
+    if (relative.empty())
+      return root_;
+    if (!root_.empty() && (root_.back() == '/' || root_.back() == kSeparator))
+      return root_ + relative;
+    return root_ + kSeparator + relative;
+  }
+
+  void ReadNextDirectory() {
+    current_directory_ = std::move(pending_directories_.back());
+    pending_directories_.pop_back();
+    directory_entries_.clear();
+    next_entry_ = 0;
+
+    const std::string path = FullPath(current_directory_);
+    uv_fs_t req;
+    int err = uv_fs_scandir(nullptr, &req, path.c_str(), 0, nullptr);
+    if (err >= 0) {
+      uv_dirent_t ent;
+      while ((err = uv_fs_scandir_next(&req, &ent)) != UV_EOF) {
+        if (err != 0)
+          break;
+        directory_entries_.emplace_back(ent.name, ent.type);
+      }
+      if (err == UV_EOF)
+        err = 0;
+    }
+    uv_fs_req_cleanup(&req);
+
+    // Directories that were removed since they were found are skipped, but
+    // the root has to exist.
+    if (err != 0 && (current_directory_.empty() ||
+                     (err != UV_ENOENT && err != UV_ENOTDIR))) {
+      SetError(err, "scandir", path);
+    }
+  }
+
+  void SetError(int err, const char* syscall, const std::string& path) {
+    error_ = err;
+    error_syscall_ = syscall;
+    error_path_ = path;
+  }
+
+  const std::string root_;
+  const bool with_stats_;
+  const size_t chunk_size_;
+  bool reading_ = false;
+
+  // Only used on the thread pool while a read is in progress.
+  std::vector<std::string> pending_directories_;
+  std::string current_directory_;
+  std::vector<std::pair<std::string, int>> directory_entries_;
+  size_t next_entry_ = 0;
+  std::vector<Entry> entries_;
+  int error_ = 0;
+  const char* error_syscall_ = nullptr;
+  std::string error_path_;
+};
+
 void Initialize(Local<Object> target,
                 Local<Value> unused,
                 Local<Context> context,
@@ -2130,11 +2809,17 @@ void Initialize(Local<Object> target,
   Environment* env = Environment::GetCurrent(context);
   Isolate* isolate = env->isolate();
 
+  {
+    Mutex::ScopedLock lock(per_process_opts_mutex);
+    module_resolution_cache.enabled = per_process_opts->module_resolution_cache;
+  }
+
   env->SetMethod(target, "access", Access);
   env->SetMethod(target, "close", Close);
   env->SetMethod(target, "open", Open);
   env->SetMethod(target, "openFileHandle", OpenFileHandle);
   env->SetMethod(target, "read", Read);
+  env->SetMethod(target, "readFile", ReadFile);
   env->SetMethod(target, "fdatasync", Fdatasync);
   env->SetMethod(target, "fsync", Fsync);
   env->SetMethod(target, "rename", Rename);
@@ -2185,6 +2870,19 @@ void Initialize(Local<Object> target,
 
   StatWatcher::Initialize(env, target);
 
+  Local<FunctionTemplate> walker =
+      env->NewFunctionTemplate(DirectoryWalker::New);
+  walker->InstanceTemplate()->SetInternalFieldCount(1);
+  walker->Inherit(AsyncWrap::GetConstructorTemplate(env));
+  env->SetProtoMethod(walker, "read", DirectoryWalker::Read);
+  Local<String> walkerString =
+      FIXED_ONE_BYTE_STRING(isolate, "DirectoryWalker");
+  walker->SetClassName(walkerString);
+  target
+      ->Set(context, walkerString,
+            walker->GetFunction(env->context()).ToLocalChecked())
+      .FromJust();
+
   // Create FunctionTemplate for FSReqCallback
   Local<FunctionTemplate> fst = env->NewFunctionTemplate(NewFSReqCallback);
   fst->InstanceTemplate()->SetInternalFieldCount(1);
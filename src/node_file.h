@@ -468,6 +468,10 @@ class FileHandle : public AsyncWrap, public StreamBase {
   std::unique_ptr<FileHandleReadWrap> current_read_ = nullptr;
 };
 
+// Drops everything cached for --module-resolution-cache. Called when a file
+// system watcher reports a change.
+void ClearModuleResolutionCache();
+
 }  // namespace fs
 
 }  // namespace node
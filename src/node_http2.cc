@@ -40,6 +40,11 @@ namespace {
 
 const char zero_bytes_256[256] = {};
 
+// DATA payloads up to this size are copied next to their frame header instead
+// of being passed to the socket as separate buffers, so that many small
+// frames don't turn into a writev() with hundreds of tiny entries.
+const size_t kMaxCopiedDataLength = 256;
+
 inline Http2Stream* GetStream(Http2Session* session,
                               int32_t id,
                               nghttp2_data_source* source) {
@@ -602,6 +607,43 @@ void Http2Session::StopTrackingRcbuf(nghttp2_rcbuf* buf) {
   MemoryAllocatorInfo::StopTracking(this, buf);
 }
 
+MaybeLocal<String> Http2Session::GetCachedHeaderString(nghttp2_rcbuf* buf,
+                                                       bool internalize) {
+  auto it = header_strings_.find(buf);
+  if (it != header_strings_.end()) {
+    nghttp2_rcbuf_decref(buf);
+    return PersistentToLocal::Strong(it->second);
+  }
+
+  nghttp2_vec vec = nghttp2_rcbuf_get_buf(buf);
+  MaybeLocal<String> maybe_str =
+      String::NewFromOneByte(env()->isolate(),
+                             vec.base,
+                             internalize ? v8::NewStringType::kInternalized :
+                                           v8::NewStringType::kNormal,
+                             vec.len);
+  Local<String> str;
+  if (!maybe_str.ToLocal(&str)) {
+    nghttp2_rcbuf_decref(buf);
+    return maybe_str;
+  }
+
+  // Literal headers that are not added to the dynamic table get a fresh rcbuf
+  // every time, so the cache fills up eventually; start over when it does.
+  if (header_strings_.size() >= MAX_CACHED_HEADER_STRINGS)
+    ClearHeaderStringCache();
+  header_strings_[buf].Reset(env()->isolate(), str);
+  return str;
+}
+
+void Http2Session::ClearHeaderStringCache() {
+  for (auto& entry : header_strings_) {
+    entry.second.Reset();
+    nghttp2_rcbuf_decref(entry.first);
+  }
+  header_strings_.clear();
+}
+
 Http2Session::Http2Session(Environment* env,
                            Local<Object> wrap,
                            nghttp2_session_type type)
@@ -654,6 +696,7 @@ Http2Session::~Http2Session() {
   Debug(this, "freeing nghttp2 session");
   for (const auto& iter : streams_)
     iter.second->session_ = nullptr;
+  ClearHeaderStringCache();
   nghttp2_session_del(session_);
   CHECK_EQ(current_nghttp2_memory_, 0);
 }
@@ -1614,6 +1657,19 @@ void Http2Session::CopyDataIntoOutgoing(const uint8_t* src, size_t src_length) {
   outgoing_storage_.resize(offset + src_length);
   memcpy(&outgoing_storage_[offset], src, src_length);
 
+  // Consecutive copies are adjacent in outgoing_storage_, so they can share
+  // a single buffer. Empty entries in between don't contribute any bytes and
+  // can be skipped over.
+  for (auto it = outgoing_buffers_.rbegin(); it != outgoing_buffers_.rend();
+       ++it) {
+    if (it->buf.base == nullptr && it->req_wrap == nullptr) {
+      it->buf.len += src_length;
+      return;
+    }
+    if (it->buf.len != 0)
+      break;
+  }
+
   // Store with a base of `nullptr` initially, since future resizes
   // of the outgoing_buffers_ vector may invalidate the pointer.
   // The correct base pointers will be set later, before writing to the
@@ -1678,7 +1734,8 @@ uint8_t Http2Session::SendPendingData() {
 
   // Set the buffer base pointers for copied data that ended up in the
   // sessions's own storage since it might have shifted around during gathering.
-  // (Those are marked by having .base == nullptr.)
+  // (Those are marked by having .base == nullptr.) Empty entries only carry
+  // the WriteWrap of data that was copied, and are skipped.
   size_t offset = 0;
   size_t i = 0;
   for (const nghttp2_stream_write& write : outgoing_buffers_) {
@@ -1688,10 +1745,11 @@ uint8_t Http2Session::SendPendingData() {
           reinterpret_cast<char*>(outgoing_storage_.data() + offset),
           write.buf.len);
       offset += write.buf.len;
-    } else {
+    } else if (write.buf.len > 0) {
       bufs[i++] = write.buf;
     }
   }
+  count = i;
 
   chunks_sent_since_last_write_++;
 
@@ -1738,7 +1796,19 @@ int Http2Session::OnSendData(
     if (write.buf.len <= length) {
       // This write does not suffice by itself, so we can consume it completely.
       length -= write.buf.len;
-      session->outgoing_buffers_.emplace_back(std::move(write));
+      if (write.buf.len <= kMaxCopiedDataLength) {
+        session->CopyDataIntoOutgoing(
+            reinterpret_cast<const uint8_t*>(write.buf.base), write.buf.len);
+        // Keep the WriteWrap around so that it is only completed once the
+        // data has actually been written.
+        if (write.req_wrap != nullptr) {
+          session->outgoing_buffers_.emplace_back(nghttp2_stream_write {
+            write.req_wrap, uv_buf_init(write.buf.base, 0)
+          });
+        }
+      } else {
+        session->outgoing_buffers_.emplace_back(std::move(write));
+      }
       stream->queue_.pop();
       continue;
     }
@@ -47,6 +47,12 @@ using performance::PerformanceEntry;
 #define MAX_MAX_HEADER_LIST_SIZE 16777215u
 #define DEFAULT_MAX_HEADER_LIST_PAIRS 128u
 
+// Header names and short values received on an Http2Session are cached as
+// JS strings keyed by their HPACK rcbuf, which nghttp2 shares between every
+// header block that references the same dynamic or static table entry.
+#define MAX_CACHED_HEADER_STRING_LENGTH 1024
+#define MAX_CACHED_HEADER_STRINGS 256
+
 #define MAX_BUFFER_COUNT 16
 
 enum nghttp2_session_type {
@@ -833,6 +839,14 @@ class Http2Session : public AsyncWrap, public StreamListener {
   // this session now, and may outlive it.
   void StopTrackingRcbuf(nghttp2_rcbuf* buf);
 
+  // Returns the JS string for a header name or value, reusing the string
+  // created the last time nghttp2 handed out the same rcbuf. This is what
+  // happens for headers that come from the HPACK dynamic table, so headers
+  // repeated across streams are only converted once. Takes over the caller's
+  // reference to `buf`.
+  MaybeLocal<String> GetCachedHeaderString(nghttp2_rcbuf* buf,
+                                           bool internalize);
+
   // Returns the current session memory including memory allocated by nghttp2,
   // the current outbound storage queue, and pending writes.
   uint64_t GetCurrentSessionMemory() {
@@ -997,6 +1011,12 @@ class Http2Session : public AsyncWrap, public StreamListener {
   std::vector<uint8_t> outgoing_storage_;
   std::vector<int32_t> pending_rst_streams_;
 
+  // Strings for header rcbufs seen on this session. The cache holds a
+  // reference to each rcbuf, so that its address is not reused for different
+  // contents while it is in here.
+  std::unordered_map<nghttp2_rcbuf*, Persistent<String>> header_strings_;
+  void ClearHeaderStringCache();
+
   void CopyDataIntoOutgoing(const uint8_t* src, size_t src_length);
   void ClearOutgoing(int status);
 
@@ -1195,12 +1215,8 @@ class ExternalHeader :
       return String::Empty(env->isolate());
     }
 
-    if (may_internalize && vec.len < 64) {
-      nghttp2_rcbuf_decref(buf);
-      // This is a short header name, so there is a good chance V8 already has
-      // it internalized.
-      return GetInternalizedString(env, vec);
-    }
+    if (vec.len <= MAX_CACHED_HEADER_STRING_LENGTH)
+      return session->GetCachedHeaderString(buf, may_internalize);
 
     session->StopTrackingRcbuf(buf);
     ExternalHeader* h_str = new ExternalHeader(buf);
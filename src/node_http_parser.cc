@@ -62,6 +62,7 @@ using v8::Int32;
 using v8::Integer;
 using v8::Local;
 using v8::MaybeLocal;
+using v8::NewStringType;
 using v8::Object;
 using v8::String;
 using v8::Uint32;
@@ -76,6 +77,78 @@ const uint32_t kOnExecute = 4;
 // Any more fields than this will be flushed into JS
 const size_t kMaxHeaderFieldsCount = 32;
 
+// Limits for the per-isolate cache of header field names. Names come from
+// the peer, so the cache stops growing at some point rather than keeping
+// arbitrary strings alive forever.
+const size_t kMaxCachedHeaderNames = 256;
+const size_t kMaxCachedHeaderNameLength = 64;
+
+// Header names that show up in most messages, in the spellings clients and
+// servers commonly use. They include every name that matchKnownFields() in
+// lib/_http_incoming.js has a fast path for.
+#define HTTP_KNOWN_HEADER_NAMES(V)                                            \
+  V("Accept") V("accept")                                                     \
+  V("Accept-Encoding") V("accept-encoding")                                   \
+  V("Accept-Language") V("accept-language")                                   \
+  V("Accept-Ranges") V("accept-ranges")                                       \
+  V("Age") V("age")                                                           \
+  V("Authorization") V("authorization")                                       \
+  V("Cache-Control") V("cache-control")                                       \
+  V("Connection") V("connection")                                             \
+  V("Content-Encoding") V("content-encoding")                                 \
+  V("Content-Length") V("content-length")                                     \
+  V("Content-Type") V("content-type")                                         \
+  V("Cookie") V("cookie")                                                     \
+  V("Date") V("date")                                                         \
+  V("ETag") V("etag")                                                         \
+  V("Expires") V("expires")                                                   \
+  V("From") V("from")                                                         \
+  V("Host") V("host")                                                         \
+  V("If-Modified-Since") V("if-modified-since")                               \
+  V("If-None-Match") V("if-none-match")                                       \
+  V("If-Unmodified-Since") V("if-unmodified-since")                           \
+  V("Keep-Alive") V("keep-alive")                                             \
+  V("Last-Modified") V("last-modified")                                       \
+  V("Location") V("location")                                                 \
+  V("Max-Forwards") V("max-forwards")                                         \
+  V("Origin") V("origin")                                                     \
+  V("Pragma") V("pragma")                                                     \
+  V("Proxy-Authorization") V("proxy-authorization")                           \
+  V("Range") V("range")                                                       \
+  V("Referer") V("referer")                                                   \
+  V("Retry-After") V("retry-after")                                           \
+  V("Server") V("server")                                                     \
+  V("Set-Cookie") V("set-cookie")                                             \
+  V("Transfer-Encoding") V("transfer-encoding")                               \
+  V("Upgrade") V("upgrade")                                                   \
+  V("User-Agent") V("user-agent")                                             \
+  V("Vary") V("vary")                                                         \
+  V("X-Forwarded-For") V("x-forwarded-for")                                   \
+  V("X-Forwarded-Proto") V("x-forwarded-proto")                               \
+  V("X-Requested-With") V("x-requested-with")
+
+struct KnownHeaderName {
+  const char* name;
+  size_t length;
+};
+
+const KnownHeaderName kKnownHeaderNames[] = {
+#define V(name) { name, sizeof(name) - 1 },
+  HTTP_KNOWN_HEADER_NAMES(V)
+#undef V
+};
+
+// Returns the index of `name` in kKnownHeaderNames, or -1.
+int FindKnownHeaderName(const char* name, size_t length) {
+  for (size_t i = 0; i < arraysize(kKnownHeaderNames); i++) {
+    if (kKnownHeaderNames[i].length == length &&
+        memcmp(kKnownHeaderNames[i].name, name, length) == 0) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
 // helper class for the Parser
 struct StringPtr {
   StringPtr() {
@@ -770,7 +843,7 @@ class Parser : public AsyncWrap, public StreamListener {
     Local<Value> headers_v[kMaxHeaderFieldsCount * 2];
 
     for (size_t i = 0; i < num_values_; ++i) {
-      headers_v[i * 2] = fields_[i].ToString(env());
+      headers_v[i * 2] = FieldName(fields_[i]);
       headers_v[i * 2 + 1] = values_[i].ToString(env());
     }
 
@@ -778,6 +851,48 @@ class Parser : public AsyncWrap, public StreamListener {
   }
 
 
+  // Most messages use the same few dozen header names, so they are created
+  // once as internalized strings and shared by all parsers of the isolate.
+  // Well-known names are found without allocating; others go through a
+  // bounded table keyed by the name.
+  Local<String> FieldName(const StringPtr& field) {
+    if (field.size_ == 0 || field.size_ > kMaxCachedHeaderNameLength)
+      return field.ToString(env());
+
+    const int known = FindKnownHeaderName(field.str_, field.size_);
+    if (known != -1) {
+      auto& known_names = env()->isolate_data()->http1_known_header_names;
+      if (!known_names) {
+        known_names.reset(
+            new v8::Eternal<String>[arraysize(kKnownHeaderNames)]);
+      }
+      v8::Eternal<String>& eternal = known_names[known];
+      if (eternal.IsEmpty())
+        eternal.Set(env()->isolate(), InternalizedString(field));
+      return eternal.Get(env()->isolate());
+    }
+
+    auto& names = env()->isolate_data()->http1_header_names;
+    std::string key(field.str_, field.size_);
+    auto it = names.find(key);
+    if (it != names.end())
+      return it->second.Get(env()->isolate());
+
+    Local<String> str = InternalizedString(field);
+    if (names.size() < kMaxCachedHeaderNames)
+      names[std::move(key)].Set(env()->isolate(), str);
+    return str;
+  }
+
+
+  Local<String> InternalizedString(const StringPtr& field) {
+    return String::NewFromOneByte(env()->isolate(),
+                                  reinterpret_cast<const uint8_t*>(field.str_),
+                                  NewStringType::kInternalized,
+                                  field.size_).ToLocalChecked();
+  }
+
+
   // spill headers and request path to JS land
   void Flush() {
     HandleScope scope(env()->isolate());
@@ -47,6 +47,7 @@
 #include "node.h"
 #include "node_buffer.h"
 #include "node_errors.h"
+#include "string_bytes_simd.h"
 #include "env-inl.h"
 #include "util-inl.h"
 #include "base_object-inl.h"
@@ -192,29 +193,28 @@ class ConverterObject : public BaseObject, Converter {
     Local<ObjectTemplate> t = ObjectTemplate::New(env->isolate());
     t->SetInternalFieldCount(1);
     Local<Object> obj = t->NewInstance(env->context()).ToLocalChecked();
-    new ConverterObject(env, obj, conv, ignoreBOM);
+    ConverterObject* converter =
+        new ConverterObject(env, obj, conv, ignoreBOM);
+    // The WHATWG latin1 labels name windows-1252, which only agrees with
+    // latin1 on ASCII.
+    if (strcmp(*label, "windows-1252") == 0)
+      converter->fast_path_ = kAscii;
     args.GetReturnValue().Set(obj);
   }
 
+  // Returns the decoded string, or the ICU error code.
   static void Decode(const FunctionCallbackInfo<Value>& args) {
     Environment* env = Environment::GetCurrent(args);
+    Isolate* isolate = env->isolate();
 
     CHECK_GE(args.Length(), 3);  // Converter, Buffer, Flags
 
-    Converter utf8("utf8");
     ConverterObject* converter;
     ASSIGN_OR_RETURN_UNWRAP(&converter, args[0].As<Object>());
     SPREAD_BUFFER_ARG(args[1], input_obj);
     int flags = args[2]->Uint32Value(env->context()).ToChecked();
 
     UErrorCode status = U_ZERO_ERROR;
-    MaybeStackBuffer<UChar> result;
-    MaybeLocal<Object> ret;
-    size_t limit = ucnv_getMinCharSize(converter->conv) *
-                   input_obj_length;
-    if (limit > 0)
-      result.AllocateSufficientStorage(limit);
-
     UBool flush = (flags & CONVERTER_FLAGS_FLUSH) == CONVERTER_FLAGS_FLUSH;
     OnScopeLeave cleanup([&]() {
       if (flush) {
@@ -235,21 +235,54 @@ class ConverterObject : public BaseObject, Converter {
       converter->bomSeen_ = true;
     }
 
+    // Well formed input is turned into a string directly, and ICU only
+    // decodes what follows it.
+    MaybeLocal<String> fast;
+    const size_t fast_length = converter->FastLength(source, source_length);
+    if (fast_length > 0) {
+      if (converter->fast_path_ == kUtf16le) {
+        fast = String::NewFromTwoByte(
+            isolate, reinterpret_cast<const uint16_t*>(source),
+            NewStringType::kNormal, fast_length / sizeof(uint16_t));
+      } else {
+        fast = String::NewFromUtf8(isolate, source, NewStringType::kNormal,
+                                   fast_length);
+      }
+      if (fast.IsEmpty()) {
+        isolate->ThrowException(ERR_STRING_TOO_LONG(isolate));
+        return;
+      }
+      source += fast_length;
+      source_length -= fast_length;
+      if (source_length == 0)
+        return args.GetReturnValue().Set(fast.ToLocalChecked());
+    }
+
+    MaybeStackBuffer<UChar> result;
+    size_t limit = ucnv_getMinCharSize(converter->conv) * source_length;
+    if (limit > 0)
+      result.AllocateSufficientStorage(limit);
+
     UChar* target = *result;
     ucnv_toUnicode(converter->conv,
                    &target, target + (limit * sizeof(UChar)),
                    &source, source + source_length,
                    nullptr, flush, &status);
 
-    if (U_SUCCESS(status)) {
-      if (limit > 0)
-        result.SetLength(target - &result[0]);
-      ret = ToBufferEndian(env, &result);
-      args.GetReturnValue().Set(ret.ToLocalChecked());
+    if (U_FAILURE(status))
+      return args.GetReturnValue().Set(status);
+
+    Local<String> ret;
+    if (!String::NewFromTwoByte(isolate,
+                                reinterpret_cast<const uint16_t*>(*result),
+                                NewStringType::kNormal,
+                                target - *result).ToLocal(&ret)) {
+      isolate->ThrowException(ERR_STRING_TOO_LONG(isolate));
       return;
     }
-
-    args.GetReturnValue().Set(status);
+    if (!fast.IsEmpty())
+      ret = String::Concat(fast.ToLocalChecked(), ret);
+    args.GetReturnValue().Set(ret);
   }
 
   SET_NO_MEMORY_INFO()
@@ -269,8 +302,16 @@ class ConverterObject : public BaseObject, Converter {
 
     switch (ucnv_getType(converter)) {
       case UCNV_UTF8:
-      case UCNV_UTF16_BigEndian:
+        fast_path_ = kUtf8;
+        unicode_ = true;
+        break;
       case UCNV_UTF16_LittleEndian:
+        // Strings are made of UTF-16 in host byte order.
+        if (!IsBigEndian())
+          fast_path_ = kUtf16le;
+        unicode_ = true;
+        break;
+      case UCNV_UTF16_BigEndian:
         unicode_ = true;
         break;
       default:
@@ -279,9 +320,45 @@ class ConverterObject : public BaseObject, Converter {
   }
 
  private:
+  enum FastPath {
+    kNone,
+    kUtf8,     // Well formed UTF-8
+    kUtf16le,  // UTF-16LE without unpaired surrogates
+    kAscii     // ASCII, for encodings that extend it one byte per character
+  };
+
+  // Returns the length of the prefix of `source` that can be made into a
+  // string without ICU: none if ICU still holds part of a character from
+  // the previous call.
+  size_t FastLength(const char* source, size_t length) const {
+    if (fast_path_ == kNone || length == 0 ||
+        length > static_cast<size_t>(String::kMaxLength)) {
+      return 0;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    if (ucnv_toUCountPending(conv, &status) != 0 || U_FAILURE(status))
+      return 0;
+
+    switch (fast_path_) {
+      case kUtf8:
+        return simd::Utf8ValidPrefix(source, length);
+      case kUtf16le:
+        if (reinterpret_cast<uintptr_t>(source) % sizeof(uint16_t) != 0)
+          return 0;
+        return sizeof(uint16_t) * simd::Utf16ValidPrefix(
+            reinterpret_cast<const uint16_t*>(source),
+            length / sizeof(uint16_t));
+      case kAscii:
+        return simd::AsciiPrefix(source, length);
+      default:
+        return 0;
+    }
+  }
+
   bool unicode_ = false;     // True if this is a Unicode converter
   bool ignoreBOM_ = false;   // True if the BOM should be ignored on Unicode
   bool bomSeen_ = false;     // True if the BOM has been seen
+  FastPath fast_path_ = kNone;
 };
 
 // One-Shot Converters
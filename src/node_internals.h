@@ -213,17 +213,45 @@ inline bool IsBigEndian() {
   return GetEndianness() == kBigEndian;
 }
 
+// Keeps the backing stores of freed buffers below 128KB for the next ones
+// of a similar size. Free() also gets memory that Buffer::New() took over
+// from malloc(), which is only known to hold the number of bytes it is freed
+// with, so every free block records that size. A block is kept in the size
+// class of its size, and allocations look at the heads of their own class and
+// of the next larger one, whose blocks are always large enough.
 class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
  public:
+  ArrayBufferAllocator() = default;
+  ~ArrayBufferAllocator() override;  // Defined in src/node.cc
+
   inline uint32_t* zero_fill_field() { return &zero_fill_field_; }
 
-  virtual void* Allocate(size_t size);  // Defined in src/node.cc
-  virtual void* AllocateUninitialized(size_t size)
-    { return node::UncheckedMalloc(size); }
-  virtual void Free(void* data, size_t) { free(data); }
+  // Defined in src/node.cc
+  void* Allocate(size_t size) override;
+  void* AllocateUninitialized(size_t size) override;
+  void Free(void* data, size_t size) override;
 
  private:
+  // Size class i holds blocks of [64 << i, 128 << i) bytes.
+  static constexpr size_t kMinSizeClassShift = 6;
+  static constexpr size_t kSizeClassCount = 11;
+  static constexpr size_t kMaxFreeBytes = 1024 * 1024;
+
+  struct FreeBlock {
+    FreeBlock* next;
+    size_t size;
+  };
+
+  static inline size_t SizeClassOf(size_t size);
+  void* TakeFreeBlock(size_t size);
+
   uint32_t zero_fill_field_ = 1;  // Boolean but exposed as uint32 to JS land.
+
+  Mutex mutex_;
+  FreeBlock* free_blocks_[kSizeClassCount] = {};
+  size_t free_bytes_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(ArrayBufferAllocator);
 };
 
 namespace Buffer {
@@ -289,16 +317,20 @@ v8::MaybeLocal<v8::Value> InternalMakeCallback(
     const v8::Local<v8::Function> callback,
     int argc,
     v8::Local<v8::Value> argv[],
-    async_context asyncContext);
+    async_context asyncContext,
+    v8::Local<v8::Value> context_frame = v8::Local<v8::Value>());
 
 class InternalCallbackScope {
  public:
   // Tell the constructor whether its `object` parameter may be empty or not.
   enum ResourceExpectation { kRequireResource, kAllowEmptyResource };
+  // A non-empty `context_frame` is entered for the duration of the callback.
   InternalCallbackScope(Environment* env,
                         v8::Local<v8::Object> object,
                         const async_context& asyncContext,
-                        ResourceExpectation expect = kRequireResource);
+                        ResourceExpectation expect = kRequireResource,
+                        v8::Local<v8::Value> context_frame =
+                            v8::Local<v8::Value>());
   // Utility that can be used by AsyncWrap classes.
   explicit InternalCallbackScope(AsyncWrap* async_wrap);
   ~InternalCallbackScope();
@@ -314,6 +346,7 @@ class InternalCallbackScope {
   Environment::AsyncCallbackScope callback_scope_;
   bool failed_ = false;
   bool pushed_ids_ = false;
+  bool pushed_context_frame_ = false;
   bool closed_ = false;
 };
 
@@ -351,7 +351,10 @@ void MessagePortData::AddToIncomingQueue(Message&& message) {
 
   if (owner_ != nullptr) {
     Debug(owner_, "Adding message to incoming queue");
-    owner_->TriggerAsync();
+    if (!wakeup_pending_) {
+      wakeup_pending_ = true;
+      owner_->TriggerAsync();
+    }
   }
 }
 
@@ -527,8 +530,11 @@ void MessagePort::OnMessage() {
 
       if (!data_->receiving_messages_)
         break;
-      if (data_->incoming_messages_.empty())
+      if (data_->incoming_messages_.empty()) {
+        // The next message needs to wake us up again.
+        data_->wakeup_pending_ = false;
         break;
+      }
       received = std::move(data_->incoming_messages_.front());
       data_->incoming_messages_.pop_front();
     }
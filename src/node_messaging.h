@@ -6,7 +6,7 @@
 #include "env.h"
 #include "node_mutex.h"
 #include "sharedarraybuffer_metadata.h"
-#include <list>
+#include <deque>
 
 namespace node {
 namespace worker {
@@ -113,7 +113,11 @@ class MessagePortData : public MemoryRetainer {
   // sibling_.
   mutable Mutex mutex_;
   bool receiving_messages_ = false;
-  std::list<Message> incoming_messages_;
+  std::deque<Message> incoming_messages_;
+  // Set once the owner has been signaled, until its OnMessage() finds the
+  // queue empty. Messages that arrive in between are received by that same
+  // OnMessage() run, so a burst of messages costs a single wakeup.
+  bool wakeup_pending_ = false;
   MessagePort* owner_ = nullptr;
   // This mutex protects the sibling_ field and is shared between two entangled
   // MessagePorts. If both mutexes are acquired, this one needs to be
@@ -24,6 +24,10 @@ void PerProcessOptions::CheckOptions(std::vector<std::string>* errors) {
                       "used, not both");
   }
 #endif
+  if (trace_event_format != "json" && trace_event_format != "binary") {
+    errors->push_back("--trace-event-format must be \"json\" or "
+                      "\"binary\"");
+  }
   per_isolate->CheckOptions(errors);
 }
 
@@ -224,6 +228,11 @@ void PerIsolateOptionsParser::Initialize() {
 }
 
 void PerProcessOptionsParser::Initialize() {
+  AddOption("--module-resolution-cache",
+            "cache file system lookups made while resolving modules for the "
+            "lifetime of the process",
+            &PerProcessOptions::module_resolution_cache,
+            kAllowedInEnvironment);
   AddOption("--title",
             "the process title to use on startup",
             &PerProcessOptions::title,
@@ -237,6 +246,11 @@ void PerProcessOptionsParser::Initialize() {
             "data, it supports ${rotation} and ${pid}.",
             &PerProcessOptions::trace_event_file_pattern,
             kAllowedInEnvironment);
+  AddOption("--trace-event-format",
+            "format of the trace-events data files, \"json\" (default) "
+            "or \"binary\"",
+            &PerProcessOptions::trace_event_format,
+            kAllowedInEnvironment);
   AddAlias("--trace-events-enabled", {
     "--trace-event-categories", "v8,node,node.async_hooks" });
   AddOption("--v8-pool-size",
@@ -121,8 +121,10 @@ class PerProcessOptions : public Options {
   std::string title;
   std::string trace_event_categories;
   std::string trace_event_file_pattern = "node_trace.${rotation}.log";
+  std::string trace_event_format = "json";
   int64_t v8_thread_pool_size = 4;
   bool zero_fill_all_buffers = false;
+  bool module_resolution_cache = false;
 
   std::vector<std::string> security_reverts;
   bool print_bash_completion = false;
@@ -1,3 +1,4 @@
+#include "histogram-inl.h"
 #include "node_internals.h"
 #include "node_perf.h"
 
@@ -5,12 +6,16 @@
 #include <sys/time.h>  // gettimeofday
 #endif
 
+#include <vector>
+
 namespace node {
 namespace performance {
 
 using v8::Array;
+using v8::ArrayBuffer;
 using v8::Context;
 using v8::DontDelete;
+using v8::Float64Array;
 using v8::Function;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
@@ -27,6 +32,7 @@ using v8::Object;
 using v8::PropertyAttribute;
 using v8::ReadOnly;
 using v8::String;
+using v8::Uint32;
 using v8::Uint32Array;
 using v8::Value;
 
@@ -34,6 +40,8 @@ using v8::Value;
 #define MICROS_PER_SEC 1e6
 // Microseconds in a millisecond, as a float.
 #define MICROS_PER_MILLIS 1e3
+// Nanoseconds in a millisecond, as a float.
+#define NANOS_PER_MILLIS 1e6
 
 // https://w3c.github.io/hr-time/#dfn-time-origin
 const uint64_t timeOrigin = PERFORMANCE_NOW();
@@ -374,6 +382,192 @@ void Timerify(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+static const uv_threadpool_queue_t kThreadpoolQueues[] = {
+  UV_THREADPOOL_CPU, UV_THREADPOOL_FS, UV_THREADPOOL_DNS
+};
+
+// Fills a Float64Array with NODE_PERFORMANCE_THREADPOOL_FIELDS values for
+// each of the cpu, fs and dns threadpool queues. Times are in milliseconds.
+void GetThreadpoolStats(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args[0]->IsFloat64Array());
+  Local<Float64Array> array = args[0].As<Float64Array>();
+  CHECK_EQ(array->Length(), arraysize(kThreadpoolQueues) *
+                            NODE_PERFORMANCE_THREADPOOL_FIELDS);
+  Local<ArrayBuffer> ab = array->Buffer();
+  double* fields = static_cast<double*>(ab->GetContents().Data());
+
+  for (uv_threadpool_queue_t queue : kThreadpoolQueues) {
+    uv_threadpool_stats_t stats;
+    CHECK_EQ(0, uv_threadpool_get_stats(queue, &stats));
+    fields[0] = stats.threads;
+    fields[1] = stats.idle_threads;
+    fields[2] = stats.size;
+    fields[3] = stats.running;
+    fields[4] = stats.pending;
+    fields[5] = stats.completed;
+    fields[6] = stats.wait_time / NANOS_PER_MILLIS;
+    fields[7] = stats.max_wait_time / NANOS_PER_MILLIS;
+    fields[8] = stats.run_time / NANOS_PER_MILLIS;
+    fields[9] = stats.max_run_time / NANOS_PER_MILLIS;
+    fields += NODE_PERFORMANCE_THREADPOOL_FIELDS;
+  }
+}
+
+// Emits the threadpool queue depth and utilization as trace counters,
+// at most once every kThreadpoolTraceInterval milliseconds of loop time.
+// The threadpool is shared by the whole process, so only the main thread
+// reports it.
+void TraceThreadpoolStats(Environment* env) {
+  static const uint64_t kThreadpoolTraceInterval = 10;
+  static const char* const depth_names[] = { "cpu", "fs", "dns" };
+  static const char* const time_names[] = { "cpu.time", "fs.time", "dns.time" };
+  static uint64_t last_trace = 0;
+  bool enabled;
+
+  TRACE_EVENT_CATEGORY_GROUP_ENABLED(TRACING_CATEGORY_NODE1(threadpool),
+                                     &enabled);
+  if (!enabled || !env->is_main_thread())
+    return;
+
+  uint64_t now = uv_now(env->event_loop());
+  if (last_trace != 0 && now - last_trace < kThreadpoolTraceInterval)
+    return;
+  last_trace = now;
+
+  for (size_t i = 0; i < arraysize(kThreadpoolQueues); i++) {
+    uv_threadpool_stats_t stats;
+    CHECK_EQ(0, uv_threadpool_get_stats(kThreadpoolQueues[i], &stats));
+    TRACE_COUNTER2(TRACING_CATEGORY_NODE1(threadpool),
+                   depth_names[i],
+                   "pending", stats.pending,
+                   "running", stats.running);
+    // Milliseconds, the counters are truncated to int.
+    TRACE_COUNTER2(TRACING_CATEGORY_NODE1(threadpool),
+                   time_names[i],
+                   "wait", stats.wait_time / 1000000,
+                   "run", stats.run_time / 1000000);
+  }
+}
+
+
+EventLoopMonitor::EventLoopMonitor(Environment* env, Local<Object> wrap)
+    : BaseObject(env, wrap) {
+  MakeWeak();
+}
+
+EventLoopMonitor::~EventLoopMonitor() {
+  if (enabled_)
+    env()->RemoveEventLoopMonitor(this);
+}
+
+void EventLoopMonitor::OnPrepare(uint64_t now) {
+  if (check_time_ != 0)
+    histograms_[NODE_PERFORMANCE_LOOP_OUTSIDE_POLL].Record(now - check_time_);
+  if (prepare_time_ != 0)
+    histograms_[NODE_PERFORMANCE_LOOP_ITERATION].Record(now - prepare_time_);
+  prepare_time_ = now;
+}
+
+void EventLoopMonitor::OnCheck(uint64_t poll_start,
+                               uint64_t poll_wakeup,
+                               uint64_t now) {
+  // Enabled during this poll phase, its start wasn't seen.
+  if (prepare_time_ == 0 || prepare_time_ != poll_start)
+    return;
+  histograms_[NODE_PERFORMANCE_LOOP_IDLE].Record(poll_wakeup - poll_start);
+  histograms_[NODE_PERFORMANCE_LOOP_POLL].Record(now - poll_start);
+  check_time_ = now;
+}
+
+void EventLoopMonitor::New(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args.IsConstructCall());
+  Environment* env = Environment::GetCurrent(args);
+  new EventLoopMonitor(env, args.This());
+}
+
+void EventLoopMonitor::Enable(const FunctionCallbackInfo<Value>& args) {
+  EventLoopMonitor* monitor;
+  ASSIGN_OR_RETURN_UNWRAP(&monitor, args.Holder());
+  if (monitor->enabled_)
+    return;
+  monitor->enabled_ = true;
+  monitor->prepare_time_ = 0;
+  monitor->check_time_ = 0;
+  monitor->env()->AddEventLoopMonitor(monitor);
+}
+
+void EventLoopMonitor::Disable(const FunctionCallbackInfo<Value>& args) {
+  EventLoopMonitor* monitor;
+  ASSIGN_OR_RETURN_UNWRAP(&monitor, args.Holder());
+  if (!monitor->enabled_)
+    return;
+  monitor->enabled_ = false;
+  monitor->env()->RemoveEventLoopMonitor(monitor);
+}
+
+void EventLoopMonitor::Reset(const FunctionCallbackInfo<Value>& args) {
+  EventLoopMonitor* monitor;
+  ASSIGN_OR_RETURN_UNWRAP(&monitor, args.Holder());
+  for (Histogram& histogram : monitor->histograms_)
+    histogram.Reset();
+}
+
+Histogram* EventLoopMonitor::GetHistogram(
+    const FunctionCallbackInfo<Value>& args) {
+  EventLoopMonitor* monitor;
+  ASSIGN_OR_RETURN_UNWRAP(&monitor, args.Holder(), nullptr);
+  CHECK(args[0]->IsUint32());
+  uint32_t phase = args[0].As<Uint32>()->Value();
+  CHECK_LT(phase, NODE_PERFORMANCE_LOOP_PHASES);
+  return &monitor->histograms_[phase];
+}
+
+// Fills a Float64Array with the count, min, max, mean and stddev of the
+// histogram of a loop phase.
+void EventLoopMonitor::GetStats(const FunctionCallbackInfo<Value>& args) {
+  Histogram* histogram = GetHistogram(args);
+  if (histogram == nullptr)
+    return;
+  CHECK(args[1]->IsFloat64Array());
+  Local<Float64Array> array = args[1].As<Float64Array>();
+  CHECK_EQ(array->Length(), NODE_PERFORMANCE_HISTOGRAM_FIELDS);
+  Local<ArrayBuffer> ab = array->Buffer();
+  double* fields = static_cast<double*>(ab->GetContents().Data());
+  fields[0] = static_cast<double>(histogram->Count());
+  fields[1] = static_cast<double>(histogram->Min());
+  fields[2] = static_cast<double>(histogram->Max());
+  fields[3] = histogram->Mean();
+  fields[4] = histogram->Stddev();
+}
+
+void EventLoopMonitor::GetPercentile(const FunctionCallbackInfo<Value>& args) {
+  Histogram* histogram = GetHistogram(args);
+  if (histogram == nullptr)
+    return;
+  CHECK(args[1]->IsNumber());
+  double percentile = args[1].As<Number>()->Value();
+  args.GetReturnValue().Set(
+      static_cast<double>(histogram->Percentile(percentile)));
+}
+
+// Returns the percentiles as a flat array of percentile, value pairs.
+void EventLoopMonitor::GetPercentiles(
+    const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Histogram* histogram = GetHistogram(args);
+  if (histogram == nullptr)
+    return;
+  std::vector<Local<Value>> values;
+  histogram->Percentiles([&](double percentile, uint64_t value) {
+    values.push_back(Number::New(env->isolate(), percentile));
+    values.push_back(Number::New(env->isolate(),
+                                 static_cast<double>(value)));
+  });
+  args.GetReturnValue().Set(
+      Array::New(env->isolate(), values.data(), values.size()));
+}
+
+
 void Initialize(Local<Object> target,
                 Local<Value> unused,
                 Local<Context> context,
@@ -404,6 +598,23 @@ void Initialize(Local<Object> target,
   env->SetMethod(target, "markMilestone", MarkMilestone);
   env->SetMethod(target, "setupObservers", SetupPerformanceObservers);
   env->SetMethod(target, "timerify", Timerify);
+  env->SetMethod(target, "getThreadpoolStats", GetThreadpoolStats);
+
+  Local<String> eventLoopMonitorString =
+      FIXED_ONE_BYTE_STRING(isolate, "EventLoopMonitor");
+  Local<FunctionTemplate> monitor =
+      env->NewFunctionTemplate(EventLoopMonitor::New);
+  monitor->SetClassName(eventLoopMonitorString);
+  monitor->InstanceTemplate()->SetInternalFieldCount(1);
+  env->SetProtoMethod(monitor, "enable", EventLoopMonitor::Enable);
+  env->SetProtoMethod(monitor, "disable", EventLoopMonitor::Disable);
+  env->SetProtoMethod(monitor, "reset", EventLoopMonitor::Reset);
+  env->SetProtoMethod(monitor, "stats", EventLoopMonitor::GetStats);
+  env->SetProtoMethod(monitor, "percentile", EventLoopMonitor::GetPercentile);
+  env->SetProtoMethod(monitor, "percentiles",
+                      EventLoopMonitor::GetPercentiles);
+  target->Set(context, eventLoopMonitorString,
+              monitor->GetFunction(context).ToLocalChecked()).FromJust();
 
   Local<Object> constants = Object::New(isolate);
 
@@ -411,6 +622,12 @@ void Initialize(Local<Object> target,
   NODE_DEFINE_CONSTANT(constants, NODE_PERFORMANCE_GC_MINOR);
   NODE_DEFINE_CONSTANT(constants, NODE_PERFORMANCE_GC_INCREMENTAL);
   NODE_DEFINE_CONSTANT(constants, NODE_PERFORMANCE_GC_WEAKCB);
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, NODE_PERFORMANCE_THREADPOOL_FIELDS);
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, NODE_PERFORMANCE_HISTOGRAM_FIELDS);
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, NODE_PERFORMANCE_LOOP_ITERATION);
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, NODE_PERFORMANCE_LOOP_POLL);
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, NODE_PERFORMANCE_LOOP_IDLE);
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, NODE_PERFORMANCE_LOOP_OUTSIDE_POLL);
 
 #define V(name, _)                                                            \
   NODE_DEFINE_HIDDEN_CONSTANT(constants, NODE_PERFORMANCE_ENTRY_TYPE_##name);
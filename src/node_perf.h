@@ -8,6 +8,7 @@
 #include "node_perf_common.h"
 #include "env.h"
 #include "base_object-inl.h"
+#include "histogram.h"
 
 #include "v8.h"
 #include "uv.h"
@@ -111,6 +112,61 @@ enum PerformanceGCKind {
   NODE_PERFORMANCE_GC_WEAKCB = GCType::kGCTypeProcessWeakCallbacks
 };
 
+// Number of values getThreadpoolStats() reports for each threadpool queue.
+#define NODE_PERFORMANCE_THREADPOOL_FIELDS 10
+
+// Emits the threadpool statistics as node.threadpool trace counters.
+void TraceThreadpoolStats(Environment* env);
+
+enum PerformanceLoopPhase {
+  // From one poll phase to the next.
+  NODE_PERFORMANCE_LOOP_ITERATION,
+  // The poll phase, waiting for I/O and running its callbacks.
+  NODE_PERFORMANCE_LOOP_POLL,
+  // Waiting in the poll phase until the first callback into JS.
+  NODE_PERFORMANCE_LOOP_IDLE,
+  // From the end of the poll phase to the next one: setImmediate() and close
+  // callbacks, timers and deferred I/O callbacks.
+  NODE_PERFORMANCE_LOOP_OUTSIDE_POLL,
+  NODE_PERFORMANCE_LOOP_PHASES
+};
+
+// Number of values EventLoopMonitor::GetStats() reports for a histogram.
+#define NODE_PERFORMANCE_HISTOGRAM_FIELDS 5
+
+// Histograms of the event loop phase durations in nanoseconds. While it is
+// enabled, the Environment reports every loop iteration to it from a prepare
+// and a check handle; the poll phase lies between the two.
+class EventLoopMonitor : public BaseObject {
+ public:
+  static void New(const FunctionCallbackInfo<Value>& args);
+  static void Enable(const FunctionCallbackInfo<Value>& args);
+  static void Disable(const FunctionCallbackInfo<Value>& args);
+  static void Reset(const FunctionCallbackInfo<Value>& args);
+  static void GetStats(const FunctionCallbackInfo<Value>& args);
+  static void GetPercentile(const FunctionCallbackInfo<Value>& args);
+  static void GetPercentiles(const FunctionCallbackInfo<Value>& args);
+
+  ~EventLoopMonitor() override;
+
+  void OnPrepare(uint64_t now);
+  void OnCheck(uint64_t poll_start, uint64_t poll_wakeup, uint64_t now);
+
+  SET_NO_MEMORY_INFO()
+  SET_MEMORY_INFO_NAME(EventLoopMonitor)
+  SET_SELF_SIZE(EventLoopMonitor)
+
+ private:
+  EventLoopMonitor(Environment* env, Local<Object> wrap);
+
+  static Histogram* GetHistogram(const FunctionCallbackInfo<Value>& args);
+
+  bool enabled_ = false;
+  uint64_t prepare_time_ = 0;
+  uint64_t check_time_ = 0;
+  Histogram histograms_[NODE_PERFORMANCE_LOOP_PHASES];
+};
+
 class GCPerformanceEntry : public PerformanceEntry {
  public:
   GCPerformanceEntry(Environment* env,
@@ -49,6 +49,32 @@ static void PlatformWorkerThread(void* data) {
 
 }  // namespace
 
+void DelayedTaskHeap::Push(uint64_t due, std::unique_ptr<Task> task) {
+  entries_.push_back(Entry { due, sequence_++, std::move(task) });
+  std::push_heap(entries_.begin(), entries_.end());
+}
+
+std::unique_ptr<Task> DelayedTaskHeap::PopDue(uint64_t now) {
+  if (entries_.empty() || entries_.front().due > now)
+    return nullptr;
+  std::pop_heap(entries_.begin(), entries_.end());
+  std::unique_ptr<Task> task = std::move(entries_.back().task);
+  entries_.pop_back();
+  return task;
+}
+
+uint64_t DelayedTaskHeap::TimeoutFrom(uint64_t now) const {
+  CHECK(!entries_.empty());
+  uint64_t due = entries_.front().due;
+  return due > now ? due - now : 0;
+}
+
+uint64_t DelayedTaskHeap::DelayInMillis(double delay_in_seconds) {
+  if (!(delay_in_seconds > 0))
+    return 0;
+  return static_cast<uint64_t>(delay_in_seconds * 1000 + 0.5);
+}
+
 class WorkerThreadsTaskRunner::DelayedTaskScheduler {
  public:
   explicit DelayedTaskScheduler(TaskQueue<Task>* tasks)
@@ -85,6 +111,7 @@ class WorkerThreadsTaskRunner::DelayedTaskScheduler {
     CHECK_EQ(0, uv_loop_init(&loop_));
     flush_tasks_.data = this;
     CHECK_EQ(0, uv_async_init(&loop_, &flush_tasks_, FlushTasks));
+    CHECK_EQ(0, uv_timer_init(&loop_, &timer_));
     uv_sem_post(&ready_);
 
     uv_run(&loop_, UV_RUN_DEFAULT);
@@ -94,8 +121,11 @@ class WorkerThreadsTaskRunner::DelayedTaskScheduler {
   static void FlushTasks(uv_async_t* flush_tasks) {
     DelayedTaskScheduler* scheduler =
         ContainerOf(&DelayedTaskScheduler::loop_, flush_tasks->loop);
-    while (std::unique_ptr<Task> task = scheduler->tasks_.Pop())
-      task->Run();
+    std::queue<std::unique_ptr<Task>> tasks = scheduler->tasks_.PopAll();
+    while (!tasks.empty()) {
+      tasks.front()->Run();
+      tasks.pop();
+    }
   }
 
   class StopTask : public Task {
@@ -103,11 +133,9 @@ class WorkerThreadsTaskRunner::DelayedTaskScheduler {
     explicit StopTask(DelayedTaskScheduler* scheduler): scheduler_(scheduler) {}
 
     void Run() override {
-      std::vector<uv_timer_t*> timers;
-      for (uv_timer_t* timer : scheduler_->timers_)
-        timers.push_back(timer);
-      for (uv_timer_t* timer : timers)
-        scheduler_->TakeTimerTask(timer);
+      scheduler_->scheduled_tasks_.Clear();
+      uv_close(reinterpret_cast<uv_handle_t*>(&scheduler_->timer_),
+               [](uv_handle_t* handle) {});
       uv_close(reinterpret_cast<uv_handle_t*>(&scheduler_->flush_tasks_),
                [](uv_handle_t* handle) {});
     }
@@ -126,13 +154,10 @@ class WorkerThreadsTaskRunner::DelayedTaskScheduler {
         delay_in_seconds_(delay_in_seconds) {}
 
     void Run() override {
-      uint64_t delay_millis =
-          static_cast<uint64_t>(delay_in_seconds_ + 0.5) * 1000;
-      std::unique_ptr<uv_timer_t> timer(new uv_timer_t());
-      CHECK_EQ(0, uv_timer_init(&scheduler_->loop_, timer.get()));
-      timer->data = task_.release();
-      CHECK_EQ(0, uv_timer_start(timer.get(), RunTask, delay_millis, 0));
-      scheduler_->timers_.insert(timer.release());
+      uint64_t due = uv_now(&scheduler_->loop_) +
+                     DelayedTaskHeap::DelayInMillis(delay_in_seconds_);
+      scheduler_->scheduled_tasks_.Push(due, std::move(task_));
+      scheduler_->StartTimer();
     }
 
    private:
@@ -141,20 +166,21 @@ class WorkerThreadsTaskRunner::DelayedTaskScheduler {
     double delay_in_seconds_;
   };
 
-  static void RunTask(uv_timer_t* timer) {
-    DelayedTaskScheduler* scheduler =
-        ContainerOf(&DelayedTaskScheduler::loop_, timer->loop);
-    scheduler->pending_worker_tasks_->Push(scheduler->TakeTimerTask(timer));
+  // (Re-)arms the one timer for the task that is due first.
+  void StartTimer() {
+    if (scheduled_tasks_.empty())
+      return;
+    uint64_t timeout = scheduled_tasks_.TimeoutFrom(uv_now(&loop_));
+    CHECK_EQ(0, uv_timer_start(&timer_, RunTasks, timeout, 0));
   }
 
-  std::unique_ptr<Task> TakeTimerTask(uv_timer_t* timer) {
-    std::unique_ptr<Task> task(static_cast<Task*>(timer->data));
-    uv_timer_stop(timer);
-    uv_close(reinterpret_cast<uv_handle_t*>(timer), [](uv_handle_t* handle) {
-      delete reinterpret_cast<uv_timer_t*>(handle);
-    });
-    timers_.erase(timer);
-    return task;
+  static void RunTasks(uv_timer_t* timer) {
+    DelayedTaskScheduler* scheduler =
+        ContainerOf(&DelayedTaskScheduler::timer_, timer);
+    uint64_t now = uv_now(&scheduler->loop_);
+    while (std::unique_ptr<Task> task = scheduler->scheduled_tasks_.PopDue(now))
+      scheduler->pending_worker_tasks_->Push(std::move(task));
+    scheduler->StartTimer();
   }
 
   uv_sem_t ready_;
@@ -163,7 +189,8 @@ class WorkerThreadsTaskRunner::DelayedTaskScheduler {
   TaskQueue<v8::Task> tasks_;
   uv_loop_t loop_;
   uv_async_t flush_tasks_;
-  std::unordered_set<uv_timer_t*> timers_;
+  uv_timer_t timer_;
+  DelayedTaskHeap scheduled_tasks_;
 };
 
 WorkerThreadsTaskRunner::WorkerThreadsTaskRunner(int thread_pool_size) {
@@ -197,8 +224,9 @@ WorkerThreadsTaskRunner::WorkerThreadsTaskRunner(int thread_pool_size) {
   }
 }
 
-void WorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
-  pending_worker_tasks_.Push(std::move(task));
+void WorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task,
+                                       TaskPriority priority) {
+  pending_worker_tasks_.Push(std::move(task), priority);
 }
 
 void WorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<v8::Task> task,
@@ -229,6 +257,10 @@ PerIsolatePlatformData::PerIsolatePlatformData(
   CHECK_EQ(0, uv_async_init(loop, flush_tasks_, FlushTasks));
   flush_tasks_->data = static_cast<void*>(this);
   uv_unref(reinterpret_cast<uv_handle_t*>(flush_tasks_));
+  delayed_tasks_timer_ = new uv_timer_t();
+  CHECK_EQ(0, uv_timer_init(loop, delayed_tasks_timer_));
+  delayed_tasks_timer_->data = static_cast<void*>(this);
+  uv_unref(reinterpret_cast<uv_handle_t*>(delayed_tasks_timer_));
 }
 
 void PerIsolatePlatformData::FlushTasks(uv_async_t* handle) {
@@ -251,7 +283,6 @@ void PerIsolatePlatformData::PostDelayedTask(
   CHECK_NE(flush_tasks_, nullptr);
   std::unique_ptr<DelayedTask> delayed(new DelayedTask());
   delayed->task = std::move(task);
-  delayed->platform_data = shared_from_this();
   delayed->timeout = delay_in_seconds;
   foreground_delayed_tasks_.Push(std::move(delayed));
   uv_async_send(flush_tasks_);
@@ -273,6 +304,11 @@ void PerIsolatePlatformData::Shutdown() {
     delete reinterpret_cast<uv_async_t*>(handle);
   });
   flush_tasks_ = nullptr;
+  uv_close(reinterpret_cast<uv_handle_t*>(delayed_tasks_timer_),
+           [](uv_handle_t* handle) {
+    delete reinterpret_cast<uv_timer_t*>(handle);
+  });
+  delayed_tasks_timer_ = nullptr;
 }
 
 void PerIsolatePlatformData::ref() {
@@ -338,24 +374,45 @@ void PerIsolatePlatformData::RunForegroundTask(std::unique_ptr<Task> task) {
   task->Run();
 }
 
-void PerIsolatePlatformData::DeleteFromScheduledTasks(DelayedTask* task) {
-  auto it = std::find_if(scheduled_delayed_tasks_.begin(),
-                         scheduled_delayed_tasks_.end(),
-                         [task](const DelayedTaskPointer& delayed) -> bool {
-          return delayed.get() == task;
-      });
-  CHECK_NE(it, scheduled_delayed_tasks_.end());
-  scheduled_delayed_tasks_.erase(it);
+void PerIsolatePlatformData::StartDelayedTaskTimer() {
+  if (scheduled_delayed_tasks_.empty()) {
+    uv_timer_stop(delayed_tasks_timer_);
+    return;
+  }
+  uint64_t timeout = scheduled_delayed_tasks_.TimeoutFrom(uv_now(loop_));
+  CHECK_EQ(0, uv_timer_start(delayed_tasks_timer_, RunDelayedTasks,
+                             timeout, 0));
 }
 
-void PerIsolatePlatformData::RunForegroundTask(uv_timer_t* handle) {
-  DelayedTask* delayed = static_cast<DelayedTask*>(handle->data);
-  RunForegroundTask(std::move(delayed->task));
-  delayed->platform_data->DeleteFromScheduledTasks(delayed);
+void PerIsolatePlatformData::RunDelayedTasks(uv_timer_t* handle) {
+  auto platform_data = static_cast<PerIsolatePlatformData*>(handle->data);
+  // A task may unregister the isolate, keep this alive until we are done.
+  std::shared_ptr<PerIsolatePlatformData> self =
+      platform_data->shared_from_this();
+
+  // Take the due tasks first so that tasks scheduled while running them wait
+  // for the next turn of the timer.
+  uint64_t now = uv_now(platform_data->loop_);
+  std::vector<std::unique_ptr<Task>> tasks;
+  while (std::unique_ptr<Task> task =
+      platform_data->scheduled_delayed_tasks_.PopDue(now)) {
+    tasks.push_back(std::move(task));
+  }
+  for (std::unique_ptr<Task>& task : tasks) {
+    // Pending delayed tasks are dropped once the isolate is shut down.
+    if (platform_data->delayed_tasks_timer_ == nullptr)
+      return;
+    RunForegroundTask(std::move(task));
+  }
+
+  if (platform_data->delayed_tasks_timer_ != nullptr)
+    platform_data->StartDelayedTaskTimer();
 }
 
 void PerIsolatePlatformData::CancelPendingDelayedTasks() {
-  scheduled_delayed_tasks_.clear();
+  scheduled_delayed_tasks_.Clear();
+  if (delayed_tasks_timer_ != nullptr)
+    uv_timer_stop(delayed_tasks_timer_);
 }
 
 void NodePlatform::DrainTasks(Isolate* isolate) {
@@ -370,25 +427,20 @@ void NodePlatform::DrainTasks(Isolate* isolate) {
 bool PerIsolatePlatformData::FlushForegroundTasksInternal() {
   bool did_work = false;
 
-  while (std::unique_ptr<DelayedTask> delayed =
-      foreground_delayed_tasks_.Pop()) {
+  // All delayed tasks share one timer that is armed for the one due first.
+  std::queue<std::unique_ptr<DelayedTask>> delayed_tasks =
+      foreground_delayed_tasks_.PopAll();
+  if (!delayed_tasks.empty()) {
     did_work = true;
-    uint64_t delay_millis =
-        static_cast<uint64_t>(delayed->timeout + 0.5) * 1000;
-    delayed->timer.data = static_cast<void*>(delayed.get());
-    uv_timer_init(loop_, &delayed->timer);
-    // Timers may not guarantee queue ordering of events with the same delay if
-    // the delay is non-zero. This should not be a problem in practice.
-    uv_timer_start(&delayed->timer, RunForegroundTask, delay_millis, 0);
-    uv_unref(reinterpret_cast<uv_handle_t*>(&delayed->timer));
-
-    scheduled_delayed_tasks_.emplace_back(delayed.release(),
-                                          [](DelayedTask* delayed) {
-      uv_close(reinterpret_cast<uv_handle_t*>(&delayed->timer),
-               [](uv_handle_t* handle) {
-        delete static_cast<DelayedTask*>(handle->data);
-      });
-    });
+    uint64_t now = uv_now(loop_);
+    while (!delayed_tasks.empty()) {
+      std::unique_ptr<DelayedTask> delayed = std::move(delayed_tasks.front());
+      delayed_tasks.pop();
+      scheduled_delayed_tasks_.Push(
+          now + DelayedTaskHeap::DelayInMillis(delayed->timeout),
+          std::move(delayed->task));
+    }
+    StartDelayedTaskTimer();
   }
   // Move all foreground tasks into a separate queue and flush that queue.
   // This way tasks that are posted while flushing the queue will be run on the
@@ -407,6 +459,18 @@ void NodePlatform::CallOnWorkerThread(std::unique_ptr<v8::Task> task) {
   worker_thread_task_runner_->PostTask(std::move(task));
 }
 
+void NodePlatform::CallBlockingTaskOnWorkerThread(
+    std::unique_ptr<v8::Task> task) {
+  worker_thread_task_runner_->PostTask(std::move(task),
+                                       TaskPriority::kUserBlocking);
+}
+
+void NodePlatform::CallLowPriorityTaskOnWorkerThread(
+    std::unique_ptr<v8::Task> task) {
+  worker_thread_task_runner_->PostTask(std::move(task),
+                                       TaskPriority::kBestEffort);
+}
+
 void NodePlatform::CallDelayedOnWorkerThread(std::unique_ptr<v8::Task> task,
                                              double delay_in_seconds) {
   worker_thread_task_runner_->PostDelayedTask(std::move(task),
@@ -464,38 +528,44 @@ TracingController* NodePlatform::GetTracingController() {
 template <class T>
 TaskQueue<T>::TaskQueue()
     : lock_(), tasks_available_(), tasks_drained_(),
-      outstanding_tasks_(0), stopped_(false), task_queue_() { }
+      outstanding_tasks_(0), stopped_(false), task_queues_() { }
 
 template <class T>
-void TaskQueue<T>::Push(std::unique_ptr<T> task) {
+void TaskQueue<T>::Push(std::unique_ptr<T> task, TaskPriority priority) {
   Mutex::ScopedLock scoped_lock(lock_);
   outstanding_tasks_++;
-  task_queue_.push(std::move(task));
+  task_queues_[static_cast<size_t>(priority)].push(std::move(task));
   tasks_available_.Signal(scoped_lock);
 }
 
+template <class T>
+std::unique_ptr<T> TaskQueue<T>::PopLocked() {
+  for (std::queue<std::unique_ptr<T>>& queue : task_queues_) {
+    if (!queue.empty()) {
+      std::unique_ptr<T> result = std::move(queue.front());
+      queue.pop();
+      return result;
+    }
+  }
+  return std::unique_ptr<T>(nullptr);
+}
+
 template <class T>
 std::unique_ptr<T> TaskQueue<T>::Pop() {
   Mutex::ScopedLock scoped_lock(lock_);
-  if (task_queue_.empty()) {
-    return std::unique_ptr<T>(nullptr);
-  }
-  std::unique_ptr<T> result = std::move(task_queue_.front());
-  task_queue_.pop();
-  return result;
+  return PopLocked();
 }
 
 template <class T>
 std::unique_ptr<T> TaskQueue<T>::BlockingPop() {
   Mutex::ScopedLock scoped_lock(lock_);
-  while (task_queue_.empty() && !stopped_) {
+  std::unique_ptr<T> result;
+  while (!stopped_ && !(result = PopLocked())) {
     tasks_available_.Wait(scoped_lock);
   }
   if (stopped_) {
     return std::unique_ptr<T>(nullptr);
   }
-  std::unique_ptr<T> result = std::move(task_queue_.front());
-  task_queue_.pop();
   return result;
 }
 
@@ -526,7 +596,14 @@ template <class T>
 std::queue<std::unique_ptr<T>> TaskQueue<T>::PopAll() {
   Mutex::ScopedLock scoped_lock(lock_);
   std::queue<std::unique_ptr<T>> result;
-  result.swap(task_queue_);
+  for (std::queue<std::unique_ptr<T>>& queue : task_queues_) {
+    if (result.empty()) {
+      result.swap(queue);
+      continue;
+    }
+    for (; !queue.empty(); queue.pop())
+      result.push(std::move(queue.front()));
+  }
   return result;
 }
 
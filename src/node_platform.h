@@ -20,13 +20,23 @@ class NodePlatform;
 class IsolateData;
 class PerIsolatePlatformData;
 
+// Lanes of a TaskQueue. Tasks are taken from the first lane that has any, so
+// user blocking tasks don't wait behind best effort background work.
+enum class TaskPriority {
+  kUserBlocking,
+  kNormal,
+  kBestEffort
+};
+constexpr size_t kNumberOfTaskPriorities = 3;
+
 template <class T>
 class TaskQueue {
  public:
   TaskQueue();
   ~TaskQueue() {}
 
-  void Push(std::unique_ptr<T> task);
+  void Push(std::unique_ptr<T> task,
+            TaskPriority priority = TaskPriority::kNormal);
   std::unique_ptr<T> Pop();
   std::unique_ptr<T> BlockingPop();
   std::queue<std::unique_ptr<T>> PopAll();
@@ -35,19 +45,50 @@ class TaskQueue {
   void Stop();
 
  private:
+  std::unique_ptr<T> PopLocked();
+
   Mutex lock_;
   ConditionVariable tasks_available_;
   ConditionVariable tasks_drained_;
   int outstanding_tasks_;
   bool stopped_;
-  std::queue<std::unique_ptr<T>> task_queue_;
+  std::queue<std::unique_ptr<T>> task_queues_[kNumberOfTaskPriorities];
 };
 
 struct DelayedTask {
   std::unique_ptr<v8::Task> task;
-  uv_timer_t timer;
   double timeout;
-  std::shared_ptr<PerIsolatePlatformData> platform_data;
+};
+
+// Delayed tasks ordered by the loop time they are due at, so that a single
+// uv_timer_t can run all of them. Tasks that are due at the same time run in
+// the order they were added.
+class DelayedTaskHeap {
+ public:
+  void Push(uint64_t due, std::unique_ptr<v8::Task> task);
+  // Removes and returns the first task that is due at |now|, if any.
+  std::unique_ptr<v8::Task> PopDue(uint64_t now);
+  // Milliseconds from |now| until the first task is due.
+  uint64_t TimeoutFrom(uint64_t now) const;
+  void Clear() { entries_.clear(); }
+  bool empty() const { return entries_.empty(); }
+
+  static uint64_t DelayInMillis(double delay_in_seconds);
+
+ private:
+  struct Entry {
+    uint64_t due;
+    uint64_t sequence;
+    std::unique_ptr<v8::Task> task;
+
+    // Orders the heap so that its front is the entry that is due first
+    bool operator<(const Entry& other) const {
+      return due != other.due ? due > other.due : sequence > other.sequence;
+    }
+  };
+
+  std::vector<Entry> entries_;
+  uint64_t sequence_ = 0;
 };
 
 // This acts as the foreground task runner for a given Isolate.
@@ -78,22 +119,20 @@ class PerIsolatePlatformData :
   const uv_loop_t* event_loop() const { return loop_; }
 
  private:
-  void DeleteFromScheduledTasks(DelayedTask* task);
+
+  void StartDelayedTaskTimer();
 
   static void FlushTasks(uv_async_t* handle);
   static void RunForegroundTask(std::unique_ptr<v8::Task> task);
-  static void RunForegroundTask(uv_timer_t* timer);
+  static void RunDelayedTasks(uv_timer_t* timer);
 
   int ref_count_ = 1;
   uv_loop_t* const loop_;
   uv_async_t* flush_tasks_ = nullptr;
+  uv_timer_t* delayed_tasks_timer_ = nullptr;
   TaskQueue<v8::Task> foreground_tasks_;
   TaskQueue<DelayedTask> foreground_delayed_tasks_;
-
-  // Use a custom deleter because libuv needs to close the handle first.
-  typedef std::unique_ptr<DelayedTask, std::function<void(DelayedTask*)>>
-      DelayedTaskPointer;
-  std::vector<DelayedTaskPointer> scheduled_delayed_tasks_;
+  DelayedTaskHeap scheduled_delayed_tasks_;
 };
 
 // This acts as the single worker thread task runner for all Isolates.
@@ -101,7 +140,8 @@ class WorkerThreadsTaskRunner {
  public:
   explicit WorkerThreadsTaskRunner(int thread_pool_size);
 
-  void PostTask(std::unique_ptr<v8::Task> task);
+  void PostTask(std::unique_ptr<v8::Task> task,
+                TaskPriority priority = TaskPriority::kNormal);
   void PostDelayedTask(std::unique_ptr<v8::Task> task,
                        double delay_in_seconds);
 
@@ -132,6 +172,9 @@ class NodePlatform : public MultiIsolatePlatform {
   // v8::Platform implementation.
   int NumberOfWorkerThreads() override;
   void CallOnWorkerThread(std::unique_ptr<v8::Task> task) override;
+  void CallBlockingTaskOnWorkerThread(std::unique_ptr<v8::Task> task) override;
+  void CallLowPriorityTaskOnWorkerThread(
+      std::unique_ptr<v8::Task> task) override;
   void CallDelayedOnWorkerThread(std::unique_ptr<v8::Task> task,
                                  double delay_in_seconds) override;
   void CallOnForegroundThread(v8::Isolate* isolate, v8::Task* task) override;
@@ -80,6 +80,8 @@ void StatWatcher::Callback(uv_fs_poll_t* handle,
   HandleScope handle_scope(env->isolate());
   Context::Scope context_scope(env->context());
 
+  fs::ClearModuleResolutionCache();
+
   Local<Value> arr = fs::FillGlobalStatsArray(env, wrap->use_bigint_, curr);
   USE(fs::FillGlobalStatsArray(env, wrap->use_bigint_, prev, true));
 
@@ -3,6 +3,7 @@
 #include "tracing/agent.h"
 #include "env.h"
 #include "base_object-inl.h"
+#include "tracing/trace_event.h"
 
 #include <set>
 #include <string>
@@ -103,8 +104,88 @@ void GetEnabledCategories(const FunctionCallbackInfo<Value>& args) {
 }
 
 #ifdef NODE_ENGINE_CHAKRACORE
+// Chakra has no trace builtins, so these implement the ones v8 exposes on the
+// extras binding object against node's own tracing controller.
+namespace {
+
+class JSONTraceValue : public v8::ConvertableToTraceFormat {
+ public:
+  explicit JSONTraceValue(const char* json) : json_(json) {}
+
+  void AppendAsTraceFormat(std::string* out) const override { *out += json_; }
+
+ private:
+  std::string json_;
+};
+
+const uint8_t* GetCategoryGroupEnabled(Environment* env, Local<Value> value) {
+  Utf8Value category(env->isolate(), value);
+  return TRACE_EVENT_API_GET_CATEGORY_GROUP_ENABLED(*category);
+}
+
+}  // anonymous namespace
+
+// isTraceCategoryEnabled(category) : bool
 void IsTraceCategoryEnabledCC(const FunctionCallbackInfo<Value>& args) {
-  args.GetReturnValue().Set(false);
+  Environment* env = Environment::GetCurrent(args);
+  if (!args[0]->IsString())
+    return env->ThrowTypeError("Trace event category must be a string.");
+  args.GetReturnValue().Set(*GetCategoryGroupEnabled(env, args[0]) != 0);
+}
+
+// trace(phase, category, name, id, data) : bool
+void TraceCC(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  if (!args[1]->IsString())
+    return env->ThrowTypeError("Trace event category must be a string.");
+  const uint8_t* category_group_enabled =
+      GetCategoryGroupEnabled(env, args[1]);
+
+  // Exit early if the category group is not enabled.
+  if (!*category_group_enabled)
+    return args.GetReturnValue().Set(false);
+
+  if (!args[0]->IsNumber())
+    return env->ThrowTypeError("Trace event phase must be a number.");
+  if (!args[2]->IsString())
+    return env->ThrowTypeError("Trace event name must be a string.");
+  if (args[2].As<String>()->Length() == 0)
+    return env->ThrowTypeError("Trace event name must not be an empty string.");
+
+  uint32_t flags = TRACE_EVENT_FLAG_COPY;
+  int32_t id = 0;
+  if (!args[3]->IsNullOrUndefined()) {
+    if (!args[3]->IsNumber())
+      return env->ThrowTypeError("Trace event id must be a number.");
+    flags |= TRACE_EVENT_FLAG_HAS_ID;
+    id = args[3]->Int32Value(env->context()).FromJust();
+  }
+
+  char phase =
+      static_cast<char>(args[0]->Int32Value(env->context()).FromJust());
+  Utf8Value name(env->isolate(), args[2]);
+
+  // One additional argument named "data" holds any JSON serializable value.
+  static const char* arg_name = "data";
+  int32_t num_args = 0;
+  uint8_t arg_type;
+  uint64_t arg_value;
+  if (!args[4]->IsUndefined()) {
+    Local<String> json;
+    if (!v8::JSON::Stringify(env->context(), args[4]).ToLocal(&json))
+      return;
+    // Values JSON.stringify() cannot represent, like functions, are dropped.
+    if (json->IsString()) {
+      Utf8Value data(env->isolate(), json);
+      tracing::SetTraceValue(new JSONTraceValue(*data), &arg_type, &arg_value);
+      num_args++;
+    }
+  }
+
+  TRACE_EVENT_API_ADD_TRACE_EVENT(
+      phase, category_group_enabled, *name, tracing::kGlobalScope, id,
+      tracing::kNoId, num_args, &arg_name, &arg_type, &arg_value, flags);
+  args.GetReturnValue().Set(true);
 }
 #endif
 
@@ -131,8 +212,9 @@ void NodeCategorySet::Initialize(Local<Object> target,
       FIXED_ONE_BYTE_STRING(env->isolate(), "isTraceCategoryEnabled");
   Local<String> trace = FIXED_ONE_BYTE_STRING(env->isolate(), "trace");
 
-#ifdef NODE_ENGINE_CHAKRACORE  // CHAKRA-TODO: support bindings objects
+#ifdef NODE_ENGINE_CHAKRACORE
   env->SetMethod(target, "isTraceCategoryEnabled", IsTraceCategoryEnabledCC);
+  env->SetMethod(target, "trace", TraceCC);
 #else
   // Grab the trace and isTraceCategoryEnabled intrinsics from the binding
   // object and expose those to our binding layer.
@@ -682,6 +682,25 @@ inline void AppendOrEscape(std::string* str,
     *str += ch;
 }
 
+// Appends the characters from p up to the first one that is in encode_set or
+// matches is_delimiter, all at once, and returns a pointer to that character.
+// The caller handles the character it stops at like before.
+template <typename IsDelimiter>
+inline const char* AppendPlainRun(std::string* str,
+                                  const char* p,
+                                  const char* end,
+                                  const uint8_t encode_set[],
+                                  IsDelimiter is_delimiter) {
+  const char* run_end = p;
+  while (run_end < end &&
+         !BitAt(encode_set, static_cast<unsigned char>(*run_end)) &&
+         !is_delimiter(*run_end)) {
+    run_end++;
+  }
+  str->append(p, run_end - p);
+  return run_end;
+}
+
 template <typename T>
 inline unsigned hex2bin(const T ch) {
   if (ch >= '0' && ch <= '9')
@@ -2050,6 +2069,12 @@ void URL::Parse(const char* input,
           }
         } else {
           AppendOrEscape(&buffer, ch, PATH_ENCODE_SET);
+          p = AppendPlainRun(&buffer, p + 1, end, PATH_ENCODE_SET,
+                             [&](const char c) {
+            return c == '/' ||
+                   (special && c == '\\') ||
+                   (!has_state_override && (c == '?' || c == '#'));
+          }) - 1;
         }
         break;
       case kCannotBeBase:
@@ -2063,8 +2088,13 @@ void URL::Parse(const char* input,
           default:
             if (url->path.size() == 0)
               url->path.push_back("");
-            if (url->path.size() > 0 && ch != kEOL)
+            if (url->path.size() > 0 && ch != kEOL) {
               AppendOrEscape(&url->path[0], ch, C0_CONTROL_ENCODE_SET);
+              p = AppendPlainRun(&url->path[0], p + 1, end,
+                                 C0_CONTROL_ENCODE_SET, [](const char c) {
+                return c == '?' || c == '#';
+              }) - 1;
+            }
         }
         break;
       case kQuery:
@@ -2075,8 +2105,13 @@ void URL::Parse(const char* input,
           if (ch == '#')
             state = kFragment;
         } else {
-          AppendOrEscape(&buffer, ch, special ? QUERY_ENCODE_SET_SPECIAL :
-                                                QUERY_ENCODE_SET_NONSPECIAL);
+          const uint8_t* encode_set = special ? QUERY_ENCODE_SET_SPECIAL :
+                                                QUERY_ENCODE_SET_NONSPECIAL;
+          AppendOrEscape(&buffer, ch, encode_set);
+          p = AppendPlainRun(&buffer, p + 1, end, encode_set,
+                             [&](const char c) {
+            return !has_state_override && c == '#';
+          }) - 1;
         }
         break;
       case kFragment:
@@ -2089,6 +2124,8 @@ void URL::Parse(const char* input,
             break;
           default:
             AppendOrEscape(&buffer, ch, FRAGMENT_ENCODE_SET);
+            p = AppendPlainRun(&buffer, p + 1, end, FRAGMENT_ENCODE_SET,
+                               [](const char c) { return false; }) - 1;
         }
         break;
       default:
@@ -25,6 +25,10 @@
 #include "util-inl.h"
 #include "v8.h"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace node {
 
 using v8::Array;
@@ -37,6 +41,8 @@ using v8::Integer;
 using v8::Isolate;
 using v8::Local;
 using v8::NewStringType;
+using v8::Null;
+using v8::Number;
 using v8::Object;
 using v8::ScriptCompiler;
 using v8::String;
@@ -117,6 +123,209 @@ void SetFlagsFromString(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+#ifdef NODE_ENGINE_CHAKRACORE
+typedef std::vector<std::pair<std::string, unsigned int>> JitCounts;
+
+struct JitFunctionStatistics {
+  std::string name;
+  std::string url;
+  JsJitFunctionStatistics counters;
+  JitCounts bail_outs;
+  JitCounts rejits;
+};
+
+struct JitDeoptLogEntry {
+  JitFunctionStatistics function;
+  double time;
+  unsigned int loop_number;
+  bool from_loop_body;
+  std::string bail_out_kind;
+  std::string rejit_reason;
+};
+
+// ChakraCore must not be called back while it enumerates, so the statistics
+// are copied out first.
+void CopyJitFunction(const JsJitFunctionStatistics* stats,
+                     JitFunctionStatistics* function) {
+  function->name = stats->name != nullptr ? stats->name : "";
+  function->url = stats->url != nullptr ? stats->url : "";
+  function->counters = *stats;
+  for (unsigned int i = 0; i < stats->bailOutKindCount; i++) {
+    function->bail_outs.emplace_back(stats->bailOutKinds[i].kind,
+                                     stats->bailOutKinds[i].count);
+  }
+  for (unsigned int i = 0; i < stats->rejitReasonCount; i++) {
+    function->rejits.emplace_back(stats->rejitReasons[i].reason,
+                                  stats->rejitReasons[i].count);
+  }
+}
+
+
+void CHAKRA_CALLBACK CopyJitStatistics(const JsJitFunctionStatistics* stats,
+                                       void* data) {
+  auto* functions = static_cast<std::vector<JitFunctionStatistics>*>(data);
+  functions->emplace_back();
+  CopyJitFunction(stats, &functions->back());
+}
+
+
+void CHAKRA_CALLBACK CopyDeoptLogEntry(const JsJitDeoptLogEntry* entry,
+                                       void* data) {
+  auto* entries = static_cast<std::vector<JitDeoptLogEntry>*>(data);
+  entries->emplace_back();
+  JitDeoptLogEntry& copy = entries->back();
+  CopyJitFunction(entry->function, &copy.function);
+  copy.time = entry->time;
+  copy.loop_number = entry->loopNumber;
+  copy.from_loop_body = entry->fromLoopBody;
+  copy.bail_out_kind = entry->bailOutKind != nullptr ? entry->bailOutKind : "";
+  if (entry->rejitReason != nullptr)
+    copy.rejit_reason = entry->rejitReason;
+}
+
+
+class JitObjectBuilder {
+ public:
+  explicit JitObjectBuilder(Environment* env)
+      : isolate_(env->isolate()), context_(env->context()) {}
+
+  void Set(Local<Object> object, const char* key, Local<Value> value) {
+    object->Set(context_, OneByteString(isolate_, key), value).FromJust();
+  }
+
+  void Set(Local<Object> object, const char* key, double value) {
+    Set(object, key, Number::New(isolate_, value));
+  }
+
+  void Set(Local<Object> object, const char* key, const std::string& value) {
+    Set(object, key,
+        String::NewFromUtf8(isolate_, value.c_str(),
+                            NewStringType::kNormal).ToLocalChecked());
+  }
+
+  void Set(Local<Object> object, const char* key, const JitCounts& counts) {
+    Local<Object> counts_object = Object::New(isolate_);
+    for (const auto& count : counts)
+      Set(counts_object, count.first.c_str(), count.second);
+    Set(object, key, counts_object);
+  }
+
+  void SetFunction(Local<Object> object,
+                   const JitFunctionStatistics& function) {
+    Set(object, "functionName", function.name);
+    Set(object, "url", function.url);
+    Set(object, "lineNumber", function.counters.line + 1);
+    Set(object, "columnNumber", function.counters.column + 1);
+  }
+
+ private:
+  Isolate* isolate_;
+  Local<Context> context_;
+};
+
+
+void SetJitStatisticsEnabled(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args[0]->IsBoolean());
+  v8::chakrashim::SetJitStatisticsEnabled(args.GetIsolate(),
+                                          args[0]->IsTrue());
+}
+
+
+void GetJitStatistics(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args[0]->IsBoolean());
+
+  std::vector<JitFunctionStatistics> functions;
+  if (!v8::chakrashim::GetJitStatistics(env->isolate(), CopyJitStatistics,
+                                        &functions, args[0]->IsTrue())) {
+    return;
+  }
+
+  JitObjectBuilder builder(env);
+  Local<Array> result =
+      Array::New(env->isolate(), static_cast<int>(functions.size()));
+  for (size_t i = 0; i < functions.size(); i++) {
+    const JitFunctionStatistics& function = functions[i];
+    const JsJitFunctionStatistics& counters = function.counters;
+    Local<Object> entry = Object::New(env->isolate());
+    builder.SetFunction(entry, function);
+    builder.Set(entry, "loopBodyJitCount", counters.loopBodyJitCount);
+    builder.Set(entry, "loopBodyJitQueueTime", counters.loopBodyJitQueueTime);
+    builder.Set(entry, "maxLoopBodyJitQueueTime",
+                counters.maxLoopBodyJitQueueTime);
+    builder.Set(entry, "osrEntryCount", counters.osrEntryCount);
+    builder.Set(entry, "osrBailOutCount", counters.osrBailOutCount);
+    builder.Set(entry, "bailOutCount", counters.bailOutCount);
+    builder.Set(entry, "bailOuts", function.bail_outs);
+    builder.Set(entry, "rejitCount", counters.rejitCount);
+    builder.Set(entry, "rejits", function.rejits);
+    result->Set(env->context(), i, entry).FromJust();
+  }
+  args.GetReturnValue().Set(result);
+}
+
+
+void GetDeoptLog(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args[0]->IsBoolean());
+
+  std::vector<JitDeoptLogEntry> entries;
+  unsigned int deopt_count = 0;
+  if (!v8::chakrashim::GetDeoptLog(env->isolate(), CopyDeoptLogEntry,
+                                   &entries, args[0]->IsTrue(),
+                                   &deopt_count)) {
+    return;
+  }
+
+  JitObjectBuilder builder(env);
+  Local<Array> log_entries =
+      Array::New(env->isolate(), static_cast<int>(entries.size()));
+  for (size_t i = 0; i < entries.size(); i++) {
+    const JitDeoptLogEntry& entry = entries[i];
+    Local<Object> object = Object::New(env->isolate());
+    builder.Set(object, "time", entry.time);
+    builder.SetFunction(object, entry.function);
+    builder.Set(object, "loopNumber",
+                entry.from_loop_body ?
+                    Number::New(env->isolate(), entry.loop_number).As<Value>() :
+                    Null(env->isolate()).As<Value>());
+    builder.Set(object, "bailOutKind", entry.bail_out_kind);
+    builder.Set(object, "rejitReason",
+                entry.rejit_reason.empty() ?
+                    Null(env->isolate()).As<Value>() :
+                    OneByteString(env->isolate(),
+                                  entry.rejit_reason.c_str()).As<Value>());
+    builder.Set(object, "rejitCount", entry.function.counters.rejitCount);
+    log_entries->Set(env->context(), i, object).FromJust();
+  }
+
+  Local<Object> result = Object::New(env->isolate());
+  builder.Set(result, "deoptCount", deopt_count);
+  builder.Set(result, "entries", log_entries);
+  args.GetReturnValue().Set(result);
+}
+
+
+void RedeferInactiveFunctions(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  unsigned int function_count = 0;
+  size_t freed_bytes = 0;
+  if (!v8::chakrashim::RedeferInactiveFunctions(env->isolate(),
+                                                &function_count,
+                                                &freed_bytes)) {
+    return;
+  }
+
+  JitObjectBuilder builder(env);
+  Local<Object> result = Object::New(env->isolate());
+  builder.Set(result, "functionCount", function_count);
+  builder.Set(result, "freedBytes", static_cast<double>(freed_bytes));
+  args.GetReturnValue().Set(result);
+}
+#endif  // NODE_ENGINE_CHAKRACORE
+
+
 void Initialize(Local<Object> target,
                 Local<Value> unused,
                 Local<Context> context,
@@ -205,6 +414,13 @@ void Initialize(Local<Object> target,
 #undef V
 
   env->SetMethod(target, "setFlagsFromString", SetFlagsFromString);
+
+#ifdef NODE_ENGINE_CHAKRACORE
+  env->SetMethod(target, "setJitStatisticsEnabled", SetJitStatisticsEnabled);
+  env->SetMethod(target, "getJitStatistics", GetJitStatistics);
+  env->SetMethod(target, "getDeoptLog", GetDeoptLog);
+  env->SetMethod(target, "redeferInactiveFunctions", RedeferInactiveFunctions);
+#endif
 }
 
 }  // namespace node
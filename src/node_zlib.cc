@@ -30,6 +30,11 @@
 #include "v8.h"
 #include "zlib.h"
 
+#if NODE_HAVE_BROTLI
+#include "brotli/encode.h"
+#include "brotli/decode.h"
+#endif
+
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
@@ -82,7 +87,9 @@ enum node_zlib_mode {
   GUNZIP,
   DEFLATERAW,
   INFLATERAW,
-  UNZIP
+  UNZIP,
+  BROTLI_DECODE,
+  BROTLI_ENCODE
 };
 
 #define GZIP_HEADER_ID1 0x1f
@@ -147,6 +154,82 @@ class ZlibContext : public MemoryRetainer {
   DISALLOW_COPY_AND_ASSIGN(ZlibContext);
 };
 
+#if NODE_HAVE_BROTLI
+// Brotli has different data types for compression and decompression streams,
+// so some of the specifics are implemented in more specific subclasses
+class BrotliContext : public MemoryRetainer {
+ public:
+  BrotliContext() = default;
+
+  void SetBuffers(char* in, uint32_t in_len, char* out, uint32_t out_len);
+  void SetFlush(int flush);
+  void GetAfterWriteOffsets(uint32_t* avail_in, uint32_t* avail_out) const;
+  uint8_t* GetNextOut() const;
+  inline void SetMode(node_zlib_mode mode) { mode_ = mode; }
+
+ protected:
+  node_zlib_mode mode_ = NONE;
+  uint8_t* next_in_ = nullptr;
+  uint8_t* next_out_ = nullptr;
+  size_t avail_in_ = 0;
+  size_t avail_out_ = 0;
+  BrotliEncoderOperation flush_ = BROTLI_OPERATION_PROCESS;
+  // Kept around so that ResetStream() can create a fresh instance.
+  brotli_alloc_func alloc_ = nullptr;
+  brotli_free_func free_ = nullptr;
+  void* alloc_opaque_ = nullptr;
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(BrotliContext);
+};
+
+class BrotliEncoderContext final : public BrotliContext {
+ public:
+  BrotliEncoderContext() = default;
+
+  void Close();
+  void DoThreadPoolWork();
+  CompressionError Init(brotli_alloc_func alloc,
+                        brotli_free_func free,
+                        void* opaque);
+  CompressionError ResetStream();
+  CompressionError SetParams(int key, uint32_t value);
+  CompressionError GetErrorInfo() const;
+
+  SET_MEMORY_INFO_NAME(BrotliEncoderContext)
+  SET_SELF_SIZE(BrotliEncoderContext)
+  SET_NO_MEMORY_INFO()  // state_ is covered through allocation tracking.
+
+ private:
+  bool last_result_ = false;
+  DeleteFnPtr<BrotliEncoderState, BrotliEncoderDestroyInstance> state_;
+};
+
+class BrotliDecoderContext final : public BrotliContext {
+ public:
+  BrotliDecoderContext() = default;
+
+  void Close();
+  void DoThreadPoolWork();
+  CompressionError Init(brotli_alloc_func alloc,
+                        brotli_free_func free,
+                        void* opaque);
+  CompressionError ResetStream();
+  CompressionError SetParams(int key, uint32_t value);
+  CompressionError GetErrorInfo() const;
+
+  SET_MEMORY_INFO_NAME(BrotliDecoderContext)
+  SET_SELF_SIZE(BrotliDecoderContext)
+  SET_NO_MEMORY_INFO()  // state_ is covered through allocation tracking.
+
+ private:
+  BrotliDecoderResult last_result_ = BROTLI_DECODER_RESULT_SUCCESS;
+  BrotliDecoderErrorCode error_ = BROTLI_DECODER_NO_ERROR;
+  std::string error_string_;
+  DeleteFnPtr<BrotliDecoderState, BrotliDecoderDestroyInstance> state_;
+};
+#endif  // NODE_HAVE_BROTLI
+
 template <typename CompressionContext>
 class CompressionStream : public AsyncWrap, public ThreadPoolWork {
  public:
@@ -409,10 +492,16 @@ class CompressionStream : public AsyncWrap, public ThreadPoolWork {
   // to V8; rather, we first store it as "unreported" memory in a separate
   // field and later report it back from the main thread.
   static void* AllocForZlib(void* data, uInt items, uInt size) {
-    CompressionStream* ctx = static_cast<CompressionStream*>(data);
-    size_t real_size =
+    size_t size_total =
         MultiplyWithOverflowCheck(static_cast<size_t>(items),
-                                  static_cast<size_t>(size)) + sizeof(size_t);
+                                  static_cast<size_t>(size));
+    return AllocForBrotli(data, size_total);
+  }
+
+  // Brotli uses the same scheme, but passes the size as a single argument.
+  static void* AllocForBrotli(void* data, size_t size) {
+    CompressionStream* ctx = static_cast<CompressionStream*>(data);
+    size_t real_size = size + sizeof(size_t);
     char* memory = UncheckedMalloc(real_size);
     if (UNLIKELY(memory == nullptr)) return nullptr;
     *reinterpret_cast<size_t*>(memory) = real_size;
@@ -587,6 +676,464 @@ class ZlibStream : public CompressionStream<ZlibContext> {
   SET_SELF_SIZE(ZlibStream)
 };
 
+#if NODE_HAVE_BROTLI
+template <typename CompressionContext>
+class BrotliCompressionStream : public CompressionStream<CompressionContext> {
+ public:
+  BrotliCompressionStream(Environment* env,
+                          Local<Object> wrap,
+                          node_zlib_mode mode)
+    : CompressionStream<CompressionContext>(env, wrap) {
+    context()->SetMode(mode);
+  }
+
+  inline CompressionContext* context() {
+    return this->CompressionStream<CompressionContext>::context();
+  }
+  typedef typename CompressionStream<CompressionContext>::AllocScope
+      AllocScope;
+
+  static void New(const FunctionCallbackInfo<Value>& args) {
+    Environment* env = Environment::GetCurrent(args);
+    CHECK(args[0]->IsInt32());
+    node_zlib_mode mode =
+        static_cast<node_zlib_mode>(args[0].As<Int32>()->Value());
+    new BrotliCompressionStream(env, args.This(), mode);
+  }
+
+  static void Init(const FunctionCallbackInfo<Value>& args) {
+    BrotliCompressionStream* wrap;
+    ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
+    CHECK(args.Length() == 3 && "init(params, writeResult, writeCallback)");
+
+    CHECK(args[1]->IsUint32Array());
+    Local<Uint32Array> array = args[1].As<Uint32Array>();
+    Local<ArrayBuffer> ab = array->Buffer();
+    uint32_t* write_result = static_cast<uint32_t*>(ab->GetContents().Data());
+
+    CHECK(args[2]->IsFunction());
+    Local<Function> write_js_callback = args[2].As<Function>();
+    wrap->InitStream(write_result, *array, write_js_callback);
+
+    AllocScope alloc_scope(wrap);
+    CompressionError err =
+        wrap->context()->Init(
+          CompressionStream<CompressionContext>::AllocForBrotli,
+          CompressionStream<CompressionContext>::FreeForZlib,
+          static_cast<CompressionStream<CompressionContext>*>(wrap));
+    if (err.IsError()) {
+      wrap->EmitError(err);
+      args.GetReturnValue().Set(false);
+      return;
+    }
+
+    // The parameters are passed as an array indexed by the BROTLI_PARAM_* or
+    // BROTLI_DECODER_PARAM_* value; entries left at -1 keep their default.
+    CHECK(args[0]->IsUint32Array());
+    Local<Uint32Array> params = args[0].As<Uint32Array>();
+    const uint32_t* data = reinterpret_cast<const uint32_t*>(
+        static_cast<char*>(params->Buffer()->GetContents().Data()) +
+        params->ByteOffset());
+    size_t len = params->Length();
+
+    for (size_t i = 0; i < len; i++) {
+      if (data[i] == static_cast<uint32_t>(-1))
+        continue;
+      err = wrap->context()->SetParams(static_cast<int>(i), data[i]);
+      if (err.IsError()) {
+        wrap->EmitError(err);
+        args.GetReturnValue().Set(false);
+        return;
+      }
+    }
+
+    args.GetReturnValue().Set(true);
+  }
+
+  static void Params(const FunctionCallbackInfo<Value>& args) {
+    // Currently a no-op, and not accessed from JS land.
+    // At some point Brotli may support changing parameters on the fly,
+    // in which case we can implement this and a JS equivalent similar to
+    // the zlib Params() function.
+  }
+
+  static void Reset(const FunctionCallbackInfo<Value> &args) {
+    BrotliCompressionStream* wrap;
+    ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
+
+    AllocScope alloc_scope(wrap);
+    const CompressionError err = wrap->context()->ResetStream();
+    if (err.IsError())
+      wrap->EmitError(err);
+  }
+
+  SET_MEMORY_INFO_NAME(BrotliCompressionStream)
+  SET_SELF_SIZE(BrotliCompressionStream)
+};
+
+using BrotliEncoderStream = BrotliCompressionStream<BrotliEncoderContext>;
+using BrotliDecoderStream = BrotliCompressionStream<BrotliDecoderContext>;
+#endif  // NODE_HAVE_BROTLI
+
+// Compresses small inputs in one call, without the stream and AsyncWrap
+// machinery. There is one instance per Environment; its z_stream is kept
+// around and only reset between calls as long as the parameters stay the
+// same, which saves the allocation and setup of the deflate state.
+class ZlibOneShot : public BaseObject {
+ public:
+  ZlibOneShot(Environment* env, Local<Object> wrap) : BaseObject(env, wrap) {
+    MakeWeak();
+  }
+
+  ~ZlibOneShot() override {
+    if (initialized_)
+      deflateEnd(&strm_);
+  }
+
+  static void New(const FunctionCallbackInfo<Value>& args) {
+    Environment* env = Environment::GetCurrent(args);
+    new ZlibOneShot(env, args.This());
+  }
+
+  // compressInto(mode, src, dst, level, windowBits, memLevel, strategy)
+  // Returns the number of bytes written to dst, or -1 if the input could not
+  // be compressed in one go, in which case the caller should fall back to
+  // a regular stream.
+  static void CompressInto(const FunctionCallbackInfo<Value>& args) {
+    CHECK(args.Length() == 7 &&
+        "compressInto(mode, src, dst, level, windowBits, memLevel, strategy)");
+    ZlibOneShot* wrap;
+    ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
+
+    Local<Context> context = args.GetIsolate()->GetCurrentContext();
+    int mode, level, window_bits, mem_level, strategy;
+    if (!args[0]->Int32Value(context).To(&mode)) return;
+    CHECK(Buffer::HasInstance(args[1]));
+    CHECK(Buffer::HasInstance(args[2]));
+    if (!args[3]->Int32Value(context).To(&level)) return;
+    if (!args[4]->Int32Value(context).To(&window_bits)) return;
+    if (!args[5]->Int32Value(context).To(&mem_level)) return;
+    if (!args[6]->Int32Value(context).To(&strategy)) return;
+
+    CHECK(mode == DEFLATE || mode == GZIP || mode == DEFLATERAW);
+    CHECK(
+        (window_bits >= Z_MIN_WINDOWBITS && window_bits <= Z_MAX_WINDOWBITS) &&
+        "invalid windowBits");
+    if (mode == GZIP)
+      window_bits += 16;
+    else if (mode == DEFLATERAW)
+      window_bits *= -1;
+
+    size_t src_length = Buffer::Length(args[1]);
+    size_t dst_length = Buffer::Length(args[2]);
+    if (src_length > UINT_MAX || dst_length > UINT_MAX)
+      return args.GetReturnValue().Set(-1);
+
+    if (!wrap->Reset(level, window_bits, mem_level, strategy))
+      return args.GetReturnValue().Set(-1);
+
+    z_stream* strm = &wrap->strm_;
+    strm->next_in = reinterpret_cast<Bytef*>(Buffer::Data(args[1]));
+    strm->avail_in = src_length;
+    strm->next_out = reinterpret_cast<Bytef*>(Buffer::Data(args[2]));
+    strm->avail_out = dst_length;
+
+    TTD_NATIVE_BUFFER_ACCESS_NOTIFY("ZLib one-shot");
+
+    int err = deflate(strm, Z_FINISH);
+    if (err == Z_STREAM_END)
+      return args.GetReturnValue().Set(static_cast<double>(strm->total_out));
+
+    // Z_OK or Z_BUF_ERROR mean that dst was too small. The stream is going
+    // to be reset before its next use either way.
+    if (err != Z_OK && err != Z_BUF_ERROR) {
+      deflateEnd(strm);
+      wrap->initialized_ = false;
+    }
+    args.GetReturnValue().Set(-1);
+  }
+
+  SET_NO_MEMORY_INFO()
+  SET_MEMORY_INFO_NAME(ZlibOneShot)
+  SET_SELF_SIZE(ZlibOneShot)
+
+ private:
+  bool Reset(int level, int window_bits, int mem_level, int strategy) {
+    if (initialized_ &&
+        level == level_ &&
+        window_bits == window_bits_ &&
+        mem_level == mem_level_ &&
+        strategy == strategy_) {
+      return deflateReset(&strm_) == Z_OK;
+    }
+
+    if (initialized_)
+      deflateEnd(&strm_);
+    memset(&strm_, 0, sizeof(strm_));
+    initialized_ = deflateInit2(&strm_, level, Z_DEFLATED, window_bits,
+                                mem_level, strategy) == Z_OK;
+    level_ = level;
+    window_bits_ = window_bits;
+    mem_level_ = mem_level;
+    strategy_ = strategy;
+    return initialized_;
+  }
+
+  bool initialized_ = false;
+  int level_ = 0;
+  int window_bits_ = 0;
+  int mem_level_ = 0;
+  int strategy_ = 0;
+  z_stream strm_;
+};
+
+// Compresses a complete input into a single gzip member by splitting it into
+// blocks that are deflated independently on the threadpool, the way pigz
+// does it. Each block is primed with the window of input preceding it as its
+// dictionary, which keeps the ratio close to that of a single stream, and all
+// but the last one end with a sync flush so that their raw deflate output can
+// simply be concatenated.
+class ParallelGzip : public AsyncWrap {
+ public:
+  ParallelGzip(Environment* env, Local<Object> wrap)
+      : AsyncWrap(env, wrap, AsyncWrap::PROVIDER_ZLIB) {
+    MakeWeak();
+  }
+
+  ~ParallelGzip() override {
+    CHECK_EQ(pending_, 0);
+  }
+
+  static void New(const FunctionCallbackInfo<Value>& args) {
+    Environment* env = Environment::GetCurrent(args);
+    new ParallelGzip(env, args.This());
+  }
+
+  // compress(input, level, memLevel, strategy, windowBits, blockSize)
+  // Calls oncomplete(buffer) or onerror(message, errno, code) when done.
+  // The input must be kept alive by the caller until then.
+  static void Compress(const FunctionCallbackInfo<Value>& args) {
+    CHECK(args.Length() == 6 &&
+        "compress(input, level, memLevel, strategy, windowBits, blockSize)");
+    ParallelGzip* job;
+    ASSIGN_OR_RETURN_UNWRAP(&job, args.Holder());
+    CHECK(job->blocks_.empty() && "compress() can only be called once");
+
+    Local<Context> context = args.GetIsolate()->GetCurrentContext();
+    CHECK(Buffer::HasInstance(args[0]));
+    if (!args[1]->Int32Value(context).To(&job->level_)) return;
+    if (!args[2]->Int32Value(context).To(&job->mem_level_)) return;
+    if (!args[3]->Int32Value(context).To(&job->strategy_)) return;
+    if (!args[4]->Int32Value(context).To(&job->window_bits_)) return;
+    uint32_t block_size;
+    if (!args[5]->Uint32Value(context).To(&block_size)) return;
+
+    CHECK((job->level_ >= Z_MIN_LEVEL && job->level_ <= Z_MAX_LEVEL) &&
+          "invalid compression level");
+    CHECK((job->window_bits_ >= Z_MIN_WINDOWBITS &&
+           job->window_bits_ <= Z_MAX_WINDOWBITS) && "invalid windowBits");
+    CHECK_GE(block_size, 1u << Z_MAX_WINDOWBITS);
+    // The blocks are raw deflate streams, and zlib rejects a raw window of
+    // 8 bits, so use 9 as DeflateRaw does.
+    if (job->window_bits_ == 8)
+      job->window_bits_ = 9;
+
+    job->input_ = Buffer::Data(args[0]);
+    job->input_length_ = Buffer::Length(args[0]);
+
+    // An empty input still needs one (empty) final block.
+    size_t offset = 0;
+    do {
+      size_t length = std::min<size_t>(block_size,
+                                       job->input_length_ - offset);
+      job->blocks_.emplace_back(new Block(job, offset, length));
+      offset += length;
+    } while (offset < job->input_length_);
+
+    job->ClearWeak();
+    job->pending_ = job->blocks_.size();
+    for (const std::unique_ptr<Block>& block : job->blocks_)
+      block->ScheduleWork();
+  }
+
+  void MemoryInfo(MemoryTracker* tracker) const override {
+    tracker->TrackFieldWithSize("output", output_size_);
+  }
+
+  SET_MEMORY_INFO_NAME(ParallelGzip)
+  SET_SELF_SIZE(ParallelGzip)
+
+ private:
+  struct Block : public ThreadPoolWork {
+    Block(ParallelGzip* job, size_t offset, size_t length)
+        : ThreadPoolWork(job->env()),
+          job(job),
+          offset(offset),
+          length(length) {}
+
+    void DoThreadPoolWork() override { job->CompressBlock(this); }
+    void AfterThreadPoolWork(int status) override {
+      job->AfterBlock(this, status);
+    }
+
+    ParallelGzip* const job;
+    const size_t offset;
+    const size_t length;
+    std::vector<Bytef> out;
+    uLong crc = 0;
+    int err = Z_OK;
+  };
+
+  // thread pool!
+  void CompressBlock(Block* block) const {
+    const bool last = block->offset + block->length == input_length_;
+    const int flush = last ? Z_FINISH : Z_SYNC_FLUSH;
+    Bytef* in = reinterpret_cast<Bytef*>(input_) + block->offset;
+
+    z_stream strm;
+    memset(&strm, 0, sizeof(strm));
+    block->err = deflateInit2(&strm, level_, Z_DEFLATED, -window_bits_,
+                              mem_level_, strategy_);
+    if (block->err != Z_OK)
+      return;
+
+    const size_t dictionary_length =
+        std::min<size_t>(block->offset, 1u << window_bits_);
+    if (dictionary_length > 0) {
+      block->err = deflateSetDictionary(&strm, in - dictionary_length,
+                                        dictionary_length);
+    }
+
+    // deflateBound() does not account for the sync flush marker; grow the
+    // output on the off chance that it is too small.
+    block->out.resize(deflateBound(&strm, block->length) + 16);
+    strm.next_in = in;
+    strm.avail_in = block->length;
+    size_t have = 0;
+    while (block->err == Z_OK) {
+      strm.next_out = block->out.data() + have;
+      strm.avail_out = block->out.size() - have;
+      block->err = deflate(&strm, flush);
+      have = block->out.size() - strm.avail_out;
+      // Z_BUF_ERROR only means that the flush was already complete.
+      if (block->err == Z_BUF_ERROR)
+        block->err = Z_OK;
+      // Either way, output space left over means that we are done.
+      if (block->err != Z_OK || strm.avail_out != 0)
+        break;
+      block->out.resize(block->out.size() * 2);
+    }
+    if (block->err == Z_STREAM_END)
+      block->err = Z_OK;
+    block->out.resize(have);
+    block->crc = crc32(0, in, block->length);
+    deflateEnd(&strm);
+  }
+
+  // v8 land!
+  void AfterBlock(Block* block, int status) {
+    CHECK_GT(pending_, 0);
+    if (status == UV_ECANCELED)
+      cancelled_ = true;
+    else if (block->err != Z_OK && err_ == Z_OK)
+      err_ = block->err;
+    output_size_ += block->out.size();
+    if (--pending_ > 0)
+      return;
+
+    OnScopeLeave on_scope_leave([&]() {
+      blocks_.clear();
+      MakeWeak();
+    });
+    if (cancelled_)
+      return;
+
+    HandleScope handle_scope(env()->isolate());
+    Context::Scope context_scope(env()->context());
+
+    if (err_ != Z_OK) {
+      EmitError("Zlib error", err_, ZlibStrerror(err_));
+      return;
+    }
+
+    const size_t length = kGzipHeaderSize + output_size_ + kGzipTrailerSize;
+    if (length > Buffer::kMaxLength) {
+      EmitError("Cannot create a Buffer larger than the maximum size", 0,
+                "ERR_BUFFER_TOO_LARGE");
+      return;
+    }
+
+    Bytef* data = reinterpret_cast<Bytef*>(Malloc(length));
+    WriteHeader(data);
+    Bytef* out = data + kGzipHeaderSize;
+    uLong crc = crc32(0, nullptr, 0);
+    for (const std::unique_ptr<Block>& block : blocks_) {
+      if (!block->out.empty())
+        memcpy(out, block->out.data(), block->out.size());
+      out += block->out.size();
+      crc = crc32_combine(crc, block->crc, block->length);
+      block->out = std::vector<Bytef>();
+    }
+    WriteLE32(out, crc);
+    WriteLE32(out + 4, static_cast<uint32_t>(input_length_));
+
+    Local<Object> buffer;
+    if (!Buffer::New(env(), reinterpret_cast<char*>(data), length)
+            .ToLocal(&buffer)) {
+      return;
+    }
+    Local<Value> argv[] = { buffer };
+    MakeCallback(env()->oncomplete_string(), arraysize(argv), argv);
+  }
+
+  void EmitError(const char* message, int err, const char* code) {
+    Local<Value> args[3] = {
+      OneByteString(env()->isolate(), message),
+      Integer::New(env()->isolate(), err),
+      OneByteString(env()->isolate(), code)
+    };
+    MakeCallback(env()->onerror_string(), arraysize(args), args);
+  }
+
+  // The same header zlib writes itself when no gzip header is set.
+  void WriteHeader(Bytef* header) const {
+    const int level = level_ == Z_DEFAULT_COMPRESSION ? 6 : level_;
+    header[0] = GZIP_HEADER_ID1;
+    header[1] = GZIP_HEADER_ID2;
+    header[2] = Z_DEFLATED;
+    memset(header + 3, 0, 5);  // flags and mtime
+    header[8] = level == 9 ? 2 :
+        (strategy_ >= Z_HUFFMAN_ONLY || level < 2 ? 4 : 0);
+#ifdef _WIN32
+    header[9] = 10;  // TOPS-20, which is what zlib uses for Windows
+#else
+    header[9] = 3;  // Unix
+#endif
+  }
+
+  static void WriteLE32(Bytef* out, uint32_t value) {
+    out[0] = value & 0xff;
+    out[1] = (value >> 8) & 0xff;
+    out[2] = (value >> 16) & 0xff;
+    out[3] = (value >> 24) & 0xff;
+  }
+
+  static const size_t kGzipHeaderSize = 10;
+  static const size_t kGzipTrailerSize = 8;
+
+  char* input_ = nullptr;
+  size_t input_length_ = 0;
+  int level_ = Z_DEFAULT_COMPRESSION;
+  int mem_level_ = Z_DEFAULT_MEMLEVEL;
+  int strategy_ = Z_DEFAULT_STRATEGY;
+  int window_bits_ = Z_DEFAULT_WINDOWBITS;
+  std::vector<std::unique_ptr<Block>> blocks_;
+  size_t pending_ = 0;
+  size_t output_size_ = 0;
+  int err_ = Z_OK;
+  bool cancelled_ = false;
+};
+
 
 void ZlibContext::Close() {
   CHECK_LE(mode_, UNZIP);
@@ -929,6 +1476,205 @@ CompressionError ZlibContext::SetParams(int level, int strategy) {
 }
 
 
+#if NODE_HAVE_BROTLI
+void BrotliContext::SetBuffers(char* in, uint32_t in_len,
+                               char* out, uint32_t out_len) {
+  next_in_ = reinterpret_cast<uint8_t*>(in);
+  next_out_ = reinterpret_cast<uint8_t*>(out);
+  avail_in_ = in_len;
+  avail_out_ = out_len;
+}
+
+
+void BrotliContext::SetFlush(int flush) {
+  flush_ = static_cast<BrotliEncoderOperation>(flush);
+}
+
+
+void BrotliContext::GetAfterWriteOffsets(uint32_t* avail_in,
+                                         uint32_t* avail_out) const {
+  *avail_in = avail_in_;
+  *avail_out = avail_out_;
+}
+
+
+uint8_t* BrotliContext::GetNextOut() const {
+  return next_out_;
+}
+
+
+void BrotliEncoderContext::DoThreadPoolWork() {
+  CHECK_EQ(mode_, BROTLI_ENCODE);
+  CHECK(state_);
+  const uint8_t* next_in = next_in_;
+  last_result_ = BrotliEncoderCompressStream(state_.get(),
+                                             flush_,
+                                             &avail_in_,
+                                             &next_in,
+                                             &avail_out_,
+                                             &next_out_,
+                                             nullptr);
+  next_in_ += next_in - next_in_;
+}
+
+
+void BrotliEncoderContext::Close() {
+  state_.reset();
+  mode_ = NONE;
+}
+
+
+CompressionError BrotliEncoderContext::Init(brotli_alloc_func alloc,
+                                            brotli_free_func free,
+                                            void* opaque) {
+  alloc_ = alloc;
+  free_ = free;
+  alloc_opaque_ = opaque;
+  state_.reset(BrotliEncoderCreateInstance(alloc, free, opaque));
+  if (!state_) {
+    return CompressionError("Initialization failed",
+                            "ERR_ZLIB_INITIALIZATION_FAILED",
+                            -1);
+  }
+
+  return CompressionError {};
+}
+
+
+CompressionError BrotliEncoderContext::ResetStream() {
+  return Init(alloc_, free_, alloc_opaque_);
+}
+
+
+CompressionError BrotliEncoderContext::SetParams(int key, uint32_t value) {
+  if (!BrotliEncoderSetParameter(state_.get(),
+                                 static_cast<BrotliEncoderParameter>(key),
+                                 value)) {
+    return CompressionError("Setting parameter failed",
+                            "ERR_BROTLI_PARAM_SET_FAILED",
+                            -1);
+  }
+
+  return CompressionError {};
+}
+
+
+CompressionError BrotliEncoderContext::GetErrorInfo() const {
+  if (!last_result_) {
+    return CompressionError("Compression failed",
+                            "ERR_BROTLI_COMPRESSION_FAILED",
+                            -1);
+  }
+
+  return CompressionError {};
+}
+
+
+void BrotliDecoderContext::Close() {
+  state_.reset();
+  mode_ = NONE;
+}
+
+
+void BrotliDecoderContext::DoThreadPoolWork() {
+  CHECK_EQ(mode_, BROTLI_DECODE);
+  CHECK(state_);
+  const uint8_t* next_in = next_in_;
+  last_result_ = BrotliDecoderDecompressStream(state_.get(),
+                                               &avail_in_,
+                                               &next_in,
+                                               &avail_out_,
+                                               &next_out_,
+                                               nullptr);
+  next_in_ += next_in - next_in_;
+  if (last_result_ == BROTLI_DECODER_RESULT_ERROR) {
+    error_ = BrotliDecoderGetErrorCode(state_.get());
+    error_string_ = std::string("ERR_") + BrotliDecoderErrorString(error_);
+  }
+}
+
+
+CompressionError BrotliDecoderContext::Init(brotli_alloc_func alloc,
+                                            brotli_free_func free,
+                                            void* opaque) {
+  alloc_ = alloc;
+  free_ = free;
+  alloc_opaque_ = opaque;
+  last_result_ = BROTLI_DECODER_RESULT_SUCCESS;
+  error_ = BROTLI_DECODER_NO_ERROR;
+  error_string_.clear();
+  state_.reset(BrotliDecoderCreateInstance(alloc, free, opaque));
+  if (!state_) {
+    return CompressionError("Initialization failed",
+                            "ERR_ZLIB_INITIALIZATION_FAILED",
+                            -1);
+  }
+
+  return CompressionError {};
+}
+
+
+CompressionError BrotliDecoderContext::ResetStream() {
+  return Init(alloc_, free_, alloc_opaque_);
+}
+
+
+CompressionError BrotliDecoderContext::SetParams(int key, uint32_t value) {
+  if (!BrotliDecoderSetParameter(state_.get(),
+                                 static_cast<BrotliDecoderParameter>(key),
+                                 value)) {
+    return CompressionError("Setting parameter failed",
+                            "ERR_BROTLI_PARAM_SET_FAILED",
+                            -1);
+  }
+
+  return CompressionError {};
+}
+
+
+CompressionError BrotliDecoderContext::GetErrorInfo() const {
+  if (error_ != BROTLI_DECODER_NO_ERROR) {
+    return CompressionError("Decompression failed",
+                            error_string_.c_str(),
+                            static_cast<int>(error_));
+  } else if (flush_ == BROTLI_OPERATION_FINISH &&
+             last_result_ == BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT) {
+    // Brotli does not report truncated input as an error itself, so use the
+    // same error as zlib does for it.
+    return CompressionError("unexpected end of file", "Z_BUF_ERROR",
+                            Z_BUF_ERROR);
+  }
+
+  return CompressionError {};
+}
+
+
+template <typename Stream>
+void AddBrotliClass(Environment* env,
+                    Local<Object> target,
+                    const char* name) {
+  Local<FunctionTemplate> z = env->NewFunctionTemplate(Stream::New);
+
+  z->InstanceTemplate()->SetInternalFieldCount(1);
+  z->Inherit(AsyncWrap::GetConstructorTemplate(env));
+
+  env->SetProtoMethod(z, "write", Stream::template Write<true>);
+  env->SetProtoMethod(z, "writeSync", Stream::template Write<false>);
+  env->SetProtoMethod(z, "close", Stream::Close);
+
+  env->SetProtoMethod(z, "init", Stream::Init);
+  env->SetProtoMethod(z, "params", Stream::Params);
+  env->SetProtoMethod(z, "reset", Stream::Reset);
+
+  Local<String> string = OneByteString(env->isolate(), name);
+  z->SetClassName(string);
+  target->Set(env->context(),
+              string,
+              z->GetFunction(env->context()).ToLocalChecked()).FromJust();
+}
+#endif  // NODE_HAVE_BROTLI
+
+
 void Initialize(Local<Object> target,
                 Local<Value> unused,
                 Local<Context> context,
@@ -953,6 +1699,33 @@ void Initialize(Local<Object> target,
               zlibString,
               z->GetFunction(env->context()).ToLocalChecked()).FromJust();
 
+  Local<FunctionTemplate> oneshot =
+      env->NewFunctionTemplate(ZlibOneShot::New);
+  oneshot->InstanceTemplate()->SetInternalFieldCount(1);
+  env->SetProtoMethod(oneshot, "compressInto", ZlibOneShot::CompressInto);
+  Local<String> oneshotString =
+      FIXED_ONE_BYTE_STRING(env->isolate(), "ZlibOneShot");
+  oneshot->SetClassName(oneshotString);
+  target->Set(env->context(),
+              oneshotString,
+              oneshot->GetFunction(env->context()).ToLocalChecked()).FromJust();
+
+  Local<FunctionTemplate> pgz = env->NewFunctionTemplate(ParallelGzip::New);
+  pgz->InstanceTemplate()->SetInternalFieldCount(1);
+  pgz->Inherit(AsyncWrap::GetConstructorTemplate(env));
+  env->SetProtoMethod(pgz, "compress", ParallelGzip::Compress);
+  Local<String> parallelGzipString =
+      FIXED_ONE_BYTE_STRING(env->isolate(), "ParallelGzip");
+  pgz->SetClassName(parallelGzipString);
+  target->Set(env->context(),
+              parallelGzipString,
+              pgz->GetFunction(env->context()).ToLocalChecked()).FromJust();
+
+#if NODE_HAVE_BROTLI
+  AddBrotliClass<BrotliEncoderStream>(env, target, "BrotliEncoder");
+  AddBrotliClass<BrotliDecoderStream>(env, target, "BrotliDecoder");
+#endif  // NODE_HAVE_BROTLI
+
   target->Set(env->context(),
               FIXED_ONE_BYTE_STRING(env->isolate(), "ZLIB_VERSION"),
               FIXED_ONE_BYTE_STRING(env->isolate(), ZLIB_VERSION)).FromJust();
@@ -1010,6 +1783,50 @@ void DefineZlibConstants(Local<Object> target) {
   NODE_DEFINE_CONSTANT(target, Z_MIN_LEVEL);
   NODE_DEFINE_CONSTANT(target, Z_MAX_LEVEL);
   NODE_DEFINE_CONSTANT(target, Z_DEFAULT_LEVEL);
+
+#if NODE_HAVE_BROTLI
+  NODE_DEFINE_CONSTANT(target, BROTLI_DECODE);
+  NODE_DEFINE_CONSTANT(target, BROTLI_ENCODE);
+
+  // Brotli streaming operations, passed where zlib takes a flush value
+  NODE_DEFINE_CONSTANT(target, BROTLI_OPERATION_PROCESS);
+  NODE_DEFINE_CONSTANT(target, BROTLI_OPERATION_FLUSH);
+  NODE_DEFINE_CONSTANT(target, BROTLI_OPERATION_FINISH);
+  NODE_DEFINE_CONSTANT(target, BROTLI_OPERATION_EMIT_METADATA);
+
+  // Brotli encoder parameters
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_MODE);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MODE_GENERIC);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MODE_TEXT);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MODE_FONT);
+  NODE_DEFINE_CONSTANT(target, BROTLI_DEFAULT_MODE);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_QUALITY);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MIN_QUALITY);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MAX_QUALITY);
+  NODE_DEFINE_CONSTANT(target, BROTLI_DEFAULT_QUALITY);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_LGWIN);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MIN_WINDOW_BITS);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MAX_WINDOW_BITS);
+  NODE_DEFINE_CONSTANT(target, BROTLI_LARGE_MAX_WINDOW_BITS);
+  NODE_DEFINE_CONSTANT(target, BROTLI_DEFAULT_WINDOW);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_LGBLOCK);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MIN_INPUT_BLOCK_BITS);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MAX_INPUT_BLOCK_BITS);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_DISABLE_LITERAL_CONTEXT_MODELING);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_SIZE_HINT);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_LARGE_WINDOW);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_NPOSTFIX);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_NDIRECT);
+
+  // Brotli decoder parameters and results
+  NODE_DEFINE_CONSTANT(target,
+                       BROTLI_DECODER_PARAM_DISABLE_RING_BUFFER_REALLOCATION);
+  NODE_DEFINE_CONSTANT(target, BROTLI_DECODER_PARAM_LARGE_WINDOW);
+  NODE_DEFINE_CONSTANT(target, BROTLI_DECODER_RESULT_ERROR);
+  NODE_DEFINE_CONSTANT(target, BROTLI_DECODER_RESULT_SUCCESS);
+  NODE_DEFINE_CONSTANT(target, BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT);
+  NODE_DEFINE_CONSTANT(target, BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT);
+#endif  // NODE_HAVE_BROTLI
 }
 
 }  // namespace node
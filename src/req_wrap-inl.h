@@ -11,6 +11,77 @@
 
 namespace node {
 
+void* RequestMemoryPool::Allocate(size_t size) {
+  size_t size_class = (sizeof(Header) + size - 1) / kSizeClass;
+  if (size_class >= kSizeClassCount)
+    return AllocateUnpooled(size);
+
+  Header* header = free_blocks_[size_class];
+  if (header != nullptr) {
+    free_blocks_[size_class] = header->next_free;
+    free_block_count_[size_class]--;
+  } else {
+    header = static_cast<Header*>(
+        static_cast<void*>(Malloc((size_class + 1) * kSizeClass)));
+  }
+
+  header->info.pool = this;
+  header->info.size_class = size_class;
+  blocks_in_use_++;
+  return header + 1;
+}
+
+void* RequestMemoryPool::AllocateUnpooled(size_t size) {
+  Header* header =
+      static_cast<Header*>(static_cast<void*>(Malloc(sizeof(Header) + size)));
+  header->info.pool = nullptr;
+  return header + 1;
+}
+
+void RequestMemoryPool::Free(void* ptr) {
+  if (ptr == nullptr)
+    return;
+
+  Header* header = static_cast<Header*>(ptr) - 1;
+  RequestMemoryPool* pool = header->info.pool;
+  if (pool == nullptr) {
+    free(header);
+    return;
+  }
+
+  size_t size_class = header->info.size_class;
+  CHECK_GT(pool->blocks_in_use_, 0);
+  pool->blocks_in_use_--;
+  if (pool->orphaned_ ||
+      pool->free_block_count_[size_class] >= kMaxFreeBlocks) {
+    free(header);
+    if (pool->orphaned_ && pool->blocks_in_use_ == 0)
+      delete pool;
+    return;
+  }
+
+  header->next_free = pool->free_blocks_[size_class];
+  pool->free_blocks_[size_class] = header;
+  pool->free_block_count_[size_class]++;
+}
+
+void RequestMemoryPool::Orphan() {
+  CHECK(!orphaned_);
+  orphaned_ = true;
+  if (blocks_in_use_ == 0)
+    delete this;
+}
+
+RequestMemoryPool::~RequestMemoryPool() {
+  for (Header* header : free_blocks_) {
+    while (header != nullptr) {
+      Header* next = header->next_free;
+      free(header);
+      header = next;
+    }
+  }
+}
+
 template <typename T>
 ReqWrap<T>::ReqWrap(Environment* env,
                     v8::Local<v8::Object> object,
@@ -29,6 +100,26 @@ ReqWrap<T>::~ReqWrap() {
   CHECK_EQ(false, persistent().IsEmpty());
 }
 
+template <typename T>
+void* ReqWrap<T>::operator new(size_t size, Environment* env) {
+  return env->request_memory_pool()->Allocate(size);
+}
+
+template <typename T>
+void* ReqWrap<T>::operator new(size_t size) {
+  return RequestMemoryPool::AllocateUnpooled(size);
+}
+
+template <typename T>
+void ReqWrap<T>::operator delete(void* ptr, Environment*) {
+  RequestMemoryPool::Free(ptr);
+}
+
+template <typename T>
+void ReqWrap<T>::operator delete(void* ptr) {
+  RequestMemoryPool::Free(ptr);
+}
+
 template <typename T>
 void ReqWrap<T>::Dispatched() {
   req_.data = this;
@@ -8,8 +8,53 @@
 #include "util.h"
 #include "v8.h"
 
+#include <stddef.h>
+
 namespace node {
 
+// Keeps the memory of finished requests around for the next ones of a similar
+// size, so that steady-state I/O does not malloc() and free() an
+// FSReqCallback, WriteWrap etc. every time. Each block records the pool it
+// came from, which lets ReqWrap::operator delete give it back without knowing
+// the Environment. The Environment owns its pool, but a pool only goes away
+// once none of its blocks are in use anymore.
+class RequestMemoryPool {
+ public:
+  RequestMemoryPool() = default;
+
+  inline void* Allocate(size_t size);
+  static inline void* AllocateUnpooled(size_t size);
+  static inline void Free(void* ptr);
+
+  // Called instead of deleting the pool when its Environment goes away.
+  inline void Orphan();
+
+ private:
+  // Blocks are rounded up to the size class, larger ones are not pooled.
+  static constexpr size_t kSizeClass = 64;
+  static constexpr size_t kSizeClassCount = 32;
+  static constexpr size_t kMaxFreeBlocks = 128;
+
+  // Precedes every block, padded so that the request stays aligned.
+  union Header {
+    struct {
+      RequestMemoryPool* pool;
+      size_t size_class;
+    } info;
+    Header* next_free;
+    max_align_t alignment;
+  };
+
+  inline ~RequestMemoryPool();
+
+  Header* free_blocks_[kSizeClassCount] = {};
+  size_t free_block_count_[kSizeClassCount] = {};
+  size_t blocks_in_use_ = 0;
+  bool orphaned_ = false;
+
+  DISALLOW_COPY_AND_ASSIGN(RequestMemoryPool);
+};
+
 template <typename T>
 class ReqWrap : public AsyncWrap {
  public:
@@ -17,6 +62,14 @@ class ReqWrap : public AsyncWrap {
                  v8::Local<v8::Object> object,
                  AsyncWrap::ProviderType provider);
   inline ~ReqWrap() override;
+
+  // `new (env) SomeReqWrap(env, ...)` takes the memory from env's
+  // RequestMemoryPool, plain `new` from malloc().
+  inline void* operator new(size_t size, Environment* env);
+  inline void* operator new(size_t size);
+  inline void operator delete(void* ptr, Environment* env);
+  inline void operator delete(void* ptr);
+
   // Call this after the req has been dispatched, if that did not already
   // happen by using Dispatch().
   inline void Dispatched();
@@ -115,7 +115,13 @@ SharedArrayBufferMetadata::SharedArrayBufferMetadata(void* data, size_t size)
   : data(data), size(size) { }
 
 SharedArrayBufferMetadata::~SharedArrayBufferMetadata() {
+#ifdef NODE_ENGINE_CHAKRACORE
+  // The memory stays owned by the engine, give back the reference that
+  // Externalize() took on it.
+  SharedArrayBuffer::ReleaseExternalized(data);
+#else
   free(data);
+#endif
 }
 
 MaybeLocal<SharedArrayBuffer> SharedArrayBufferMetadata::GetSharedArrayBuffer(
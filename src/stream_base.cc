@@ -76,6 +76,9 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
     count = chunks->Length() >> 1;
 
   MaybeStackBuffer<uv_buf_t, 16> bufs(count);
+  // String chunks whose external content is written in place. The chunks
+  // array is kept alive by the request until the write is done.
+  MaybeStackBuffer<bool, 16> in_place(all_buffers ? 0 : count);
 
   size_t storage_size = 0;
   size_t offset;
@@ -83,6 +86,7 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
   if (!all_buffers) {
     // Determine storage size first
     for (size_t i = 0; i < count; i++) {
+      in_place[i] = false;
       Local<Value> chunk = chunks->Get(env->context(), i * 2).ToLocalChecked();
 
       if (Buffer::HasInstance(chunk))
@@ -93,7 +97,15 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
       Local<String> string = chunk->ToString(env->context()).ToLocalChecked();
       enum encoding encoding = ParseEncoding(env->isolate(),
           chunks->Get(env->context(), i * 2 + 1).ToLocalChecked());
+      const char* data;
       size_t chunk_size;
+      if (StringBytes::GetExternalBytes(string, encoding, &data, &chunk_size)) {
+        // No storage required either
+        bufs[i] = uv_buf_init(const_cast<char*>(data), chunk_size);
+        in_place[i] = true;
+        continue;
+      }
+
       if (encoding == UTF8 && string->Length() > 65535 &&
           !StringBytes::Size(env->isolate(), string, encoding).To(&chunk_size))
         return 0;
@@ -129,6 +141,10 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
         continue;
       }
 
+      // Already set up to write the string's own content
+      if (in_place[i])
+        continue;
+
       // Write string
       CHECK_LE(offset, storage_size);
       char* str_storage = storage.data + offset;
@@ -173,7 +189,22 @@ int StreamBase::WriteBuffer(const FunctionCallbackInfo<Value>& args) {
   buf.base = Buffer::Data(args[1]);
   buf.len = Buffer::Length(args[1]);
 
-  StreamWriteResult res = Write(&buf, 1, nullptr, req_wrap_obj);
+  uv_stream_t* send_handle = nullptr;
+
+  if (args[2]->IsObject() && IsIPCPipe()) {
+    Local<Object> send_handle_obj = args[2].As<Object>();
+
+    HandleWrap* wrap;
+    ASSIGN_OR_RETURN_UNWRAP(&wrap, send_handle_obj, UV_EINVAL);
+    send_handle = reinterpret_cast<uv_stream_t*>(wrap->GetHandle());
+    // Reference LibuvStreamWrap instance to prevent it from being garbage
+    // collected before `AfterWrite` is called.
+    req_wrap_obj->Set(env->context(),
+                      env->handle_string(),
+                      send_handle_obj).FromJust();
+  }
+
+  StreamWriteResult res = Write(&buf, 1, send_handle, req_wrap_obj);
   SetWriteResult(res);
 
   return res.err;
@@ -206,6 +237,39 @@ int StreamBase::WriteString(const FunctionCallbackInfo<Value>& args) {
   if (storage_size > INT_MAX)
     return UV_ENOBUFS;
 
+  uv_stream_t* send_handle = nullptr;
+
+  if (IsIPCPipe() && !send_handle_obj.IsEmpty()) {
+    HandleWrap* wrap;
+    ASSIGN_OR_RETURN_UNWRAP(&wrap, send_handle_obj, UV_EINVAL);
+    send_handle = reinterpret_cast<uv_stream_t*>(wrap->GetHandle());
+    // Reference LibuvStreamWrap instance to prevent it from being garbage
+    // collected before `AfterWrite` is called.
+    req_wrap_obj->Set(env->context(),
+                      env->handle_string(),
+                      send_handle_obj).FromJust();
+  }
+
+  // Write externalized content in place, however long it is, rather than
+  // copying it to the stack or heap first.
+  const char* external_data;
+  size_t external_size;
+  if (send_handle == nullptr &&
+      StringBytes::GetExternalBytes(string, enc, &external_data,
+                                    &external_size)) {
+    uv_buf_t buf = uv_buf_init(const_cast<char*>(external_data),
+                               external_size);
+    StreamWriteResult res = Write(&buf, 1, nullptr, req_wrap_obj);
+    SetWriteResult(res);
+    // Keep the string, and with it the content, alive until the write is done.
+    if (res.async) {
+      req_wrap_obj->Set(env->context(),
+                        env->buffer_string(),
+                        string).FromJust();
+    }
+    return res.err;
+  }
+
   // Try writing immediately if write size isn't too big
   char stack_storage[16384];  // 16kb
   size_t data_size;
@@ -262,19 +326,6 @@ int StreamBase::WriteString(const FunctionCallbackInfo<Value>& args) {
 
   buf = uv_buf_init(data.data, data_size);
 
-  uv_stream_t* send_handle = nullptr;
-
-  if (IsIPCPipe() && !send_handle_obj.IsEmpty()) {
-    HandleWrap* wrap;
-    ASSIGN_OR_RETURN_UNWRAP(&wrap, send_handle_obj, UV_EINVAL);
-    send_handle = reinterpret_cast<uv_stream_t*>(wrap->GetHandle());
-    // Reference LibuvStreamWrap instance to prevent it from being garbage
-    // collected before `AfterWrite` is called.
-    req_wrap_obj->Set(env->context(),
-                      env->handle_string(),
-                      send_handle_obj).FromJust();
-  }
-
   StreamWriteResult res = Write(&buf, 1, send_handle, req_wrap_obj);
   res.bytes += synchronously_written;
 
@@ -352,6 +403,89 @@ uv_buf_t StreamListener::OnStreamAlloc(size_t suggested_size) {
 }
 
 
+// Size of the read buffer shared by libuv streams; libuv suggests 64 KB.
+static const size_t kStreamReadBufferSize = 64 * 1024;
+// Reads up to this size are copied into the stream's current slab.
+static const size_t kStreamReadSlabMaxChunk = 4 * 1024;
+static const size_t kStreamReadSlabSize = 16 * 1024;
+// Slices are rounded up to this size, so that each starts aligned.
+static const size_t kStreamReadSlabAlignment = 16;
+
+
+static bool IsLibuvStream(StreamBase* stream) {
+  // libuv streams call the alloc and read callbacks back to back, so the
+  // shared read buffer is returned before anything else can ask for it.
+  switch (stream->GetAsyncWrap()->provider_type()) {
+    case AsyncWrap::PROVIDER_PIPEWRAP:
+    case AsyncWrap::PROVIDER_TCPWRAP:
+    case AsyncWrap::PROVIDER_TTYWRAP:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// Copies `nread` bytes into this stream's current read slab, starting a new
+// one if they do not fit, and returns the slab and the slice's offset. Only
+// chunks of the same stream share a slab, so a Buffer's `.buffer` never
+// exposes another stream's data.
+Local<ArrayBuffer> EmitToJSStreamListener::CopyToReadSlab(Environment* env,
+                                                          const char* data,
+                                                          size_t nread,
+                                                          size_t* offset) {
+  Local<ArrayBuffer> slab = read_slab_.Get(env->isolate());
+
+  // A slab that was detached or transferred from JS land has a length of
+  // zero, so the chunks after it are copied into a new one.
+  if (slab.IsEmpty() || slab->ByteLength() < read_slab_offset_ + nread) {
+    slab = ArrayBuffer::New(env->isolate(),
+                            Malloc(kStreamReadSlabSize),
+                            kStreamReadSlabSize,
+                            v8::ArrayBufferCreationMode::kInternalized);
+    read_slab_.Reset(env->isolate(), slab);
+    read_slab_.SetWeak(this, OnReadSlabCollected,
+                       v8::WeakCallbackType::kParameter);
+    read_slab_offset_ = 0;
+  }
+
+  memcpy(static_cast<char*>(slab->GetContents().Data()) + read_slab_offset_,
+         data,
+         nread);
+  *offset = read_slab_offset_;
+
+  read_slab_offset_ += (nread + kStreamReadSlabAlignment - 1) &
+                       ~(kStreamReadSlabAlignment - 1);
+  return slab;
+}
+
+
+void EmitToJSStreamListener::OnReadSlabCollected(
+    const v8::WeakCallbackInfo<EmitToJSStreamListener>& data) {
+  EmitToJSStreamListener* listener = data.GetParameter();
+  listener->read_slab_.Reset();
+  listener->read_slab_offset_ = 0;
+}
+
+
+uv_buf_t EmitToJSStreamListener::OnStreamAlloc(size_t suggested_size) {
+  CHECK_NOT_NULL(stream_);
+  StreamBase* stream = static_cast<StreamBase*>(stream_);
+  Environment* env = stream->stream_env();
+
+  if (suggested_size > kStreamReadBufferSize ||
+      env->stream_read_buffer_in_use() ||
+      !IsLibuvStream(stream)) {
+    return StreamListener::OnStreamAlloc(suggested_size);
+  }
+
+  if (env->stream_read_buffer() == nullptr)
+    env->set_stream_read_buffer(Malloc(kStreamReadBufferSize));
+  env->set_stream_read_buffer_in_use(true);
+  return uv_buf_init(env->stream_read_buffer(), kStreamReadBufferSize);
+}
+
+
 void EmitToJSStreamListener::OnStreamRead(ssize_t nread, const uv_buf_t& buf) {
   CHECK_NOT_NULL(stream_);
   StreamBase* stream = static_cast<StreamBase*>(stream_);
@@ -359,14 +493,33 @@ void EmitToJSStreamListener::OnStreamRead(ssize_t nread, const uv_buf_t& buf) {
   HandleScope handle_scope(env->isolate());
   Context::Scope context_scope(env->context());
 
+  bool is_shared_buffer = env->stream_read_buffer_in_use() &&
+                          buf.base == env->stream_read_buffer();
+  if (is_shared_buffer)
+    env->set_stream_read_buffer_in_use(false);
+
   if (nread <= 0)  {
-    free(buf.base);
+    if (!is_shared_buffer)
+      free(buf.base);
     if (nread < 0)
       stream->CallJSOnreadMethod(nread, Local<ArrayBuffer>());
     return;
   }
 
   CHECK_LE(static_cast<size_t>(nread), buf.len);
+
+  if (static_cast<size_t>(nread) <= kStreamReadSlabMaxChunk) {
+    size_t offset;
+    Local<ArrayBuffer> slab = CopyToReadSlab(env, buf.base, nread, &offset);
+    if (!is_shared_buffer)
+      free(buf.base);
+    stream->CallJSOnreadMethod(nread, slab, offset);
+    return;
+  }
+
+  // Long reads keep their buffer; the next read allocates a new shared one.
+  if (is_shared_buffer)
+    env->set_stream_read_buffer(nullptr);
   char* base = Realloc(buf.base, nread);
 
   Local<ArrayBuffer> obj = ArrayBuffer::New(
@@ -179,9 +179,26 @@ class ReportWritesToJSStreamListener : public StreamListener {
 
 // A default emitter that just pushes data chunks as Buffer instances to
 // JS land via the handle’s .ondata method.
+// libuv streams read into a single buffer shared by the Environment, and
+// short reads are copied into slices of a small slab `ArrayBuffer` of the
+// stream's own, so that many mostly idle connections do not each allocate
+// and shrink a fresh 64 KB buffer per read. The listener only holds the slab
+// weakly; it is freed once all Buffers slicing it are garbage collected.
 class EmitToJSStreamListener : public ReportWritesToJSStreamListener {
  public:
+  uv_buf_t OnStreamAlloc(size_t suggested_size) override;
   void OnStreamRead(ssize_t nread, const uv_buf_t& buf) override;
+
+ private:
+  v8::Local<v8::ArrayBuffer> CopyToReadSlab(Environment* env,
+                                            const char* data,
+                                            size_t nread,
+                                            size_t* offset);
+  static void OnReadSlabCollected(
+      const v8::WeakCallbackInfo<EmitToJSStreamListener>& data);
+
+  v8::Global<v8::ArrayBuffer> read_slab_;
+  size_t read_slab_offset_ = 0;
 };
 
 
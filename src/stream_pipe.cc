@@ -4,6 +4,7 @@
 #include "node_internals.h"
 
 using v8::Context;
+using v8::HandleScope;
 using v8::External;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
@@ -43,6 +44,10 @@ StreamPipe::StreamPipe(StreamBase* source,
 
 StreamPipe::~StreamPipe() {
   CHECK(is_closed_);
+  CHECK_NULL(current_write_);
+  free(read_ahead_.base);
+  for (const uv_buf_t& buf : free_buffers_)
+    free(buf.base);
 }
 
 StreamBase* StreamPipe::source() {
@@ -63,6 +68,14 @@ void StreamPipe::Unpipe() {
   if (!source_destroyed_)
     source()->ReadStop();
 
+  // The write in progress will not be reported to us anymore, so let the
+  // request free its buffer.
+  if (current_write_ != nullptr) {
+    current_write_->SetAllocatedStorage(current_write_buf_.base,
+                                        current_write_buf_.len);
+    current_write_ = nullptr;
+  }
+
   is_closed_ = true;
   is_reading_ = false;
   source()->RemoveStreamListener(&readable_listener_);
@@ -109,6 +122,13 @@ uv_buf_t StreamPipe::ReadableListener::OnStreamAlloc(size_t suggested_size) {
   StreamPipe* pipe = ContainerOf(&StreamPipe::readable_listener_, this);
   size_t size = std::min(suggested_size, pipe->wanted_data_);
   CHECK_GT(size, 0);
+  while (!pipe->free_buffers_.empty()) {
+    uv_buf_t buf = pipe->free_buffers_.back();
+    pipe->free_buffers_.pop_back();
+    if (buf.len >= size)
+      return uv_buf_init(buf.base, size);
+    free(buf.base);
+  }
   return uv_buf_init(Malloc(size), size);
 }
 
@@ -137,20 +157,37 @@ void StreamPipe::ReadableListener::OnStreamRead(ssize_t nread,
 }
 
 void StreamPipe::ProcessData(size_t nread, const uv_buf_t& buf) {
+  if (is_writing_) {
+    // Hold on to this chunk until the sink is done with the previous one,
+    // and do not read any further ahead than that.
+    CHECK_NULL(read_ahead_.base);
+    read_ahead_ = buf;
+    read_ahead_nread_ = nread;
+    is_reading_ = false;
+    source()->ReadStop();
+    return;
+  }
+
   uv_buf_t buffer = uv_buf_init(buf.base, nread);
   StreamWriteResult res = sink()->Write(&buffer, 1);
   if (!res.async) {
-    free(buf.base);
+    RecycleBuffer(buf);
     writable_listener_.OnStreamAfterWrite(nullptr, res.err);
   } else {
+    // Keep reading, so that the next chunk is ready once this one is written.
     is_writing_ = true;
-    is_reading_ = false;
-    res.wrap->SetAllocatedStorage(buf.base, buf.len);
-    if (source() != nullptr)
-      source()->ReadStop();
+    current_write_ = res.wrap;
+    current_write_buf_ = buf;
   }
 }
 
+void StreamPipe::RecycleBuffer(const uv_buf_t& buf) {
+  if (free_buffers_.size() < kMaxFreeBuffers)
+    free_buffers_.push_back(buf);
+  else
+    free(buf.base);
+}
+
 void StreamPipe::ShutdownWritable() {
   sink()->Shutdown();
 }
@@ -159,6 +196,21 @@ void StreamPipe::WritableListener::OnStreamAfterWrite(WriteWrap* w,
                                                       int status) {
   StreamPipe* pipe = ContainerOf(&StreamPipe::writable_listener_, this);
   pipe->is_writing_ = false;
+  if (pipe->current_write_ != nullptr) {
+    CHECK_EQ(pipe->current_write_, w);
+    pipe->current_write_ = nullptr;
+    pipe->RecycleBuffer(pipe->current_write_buf_);
+  }
+
+  if (status == 0 && pipe->read_ahead_.base != nullptr) {
+    AsyncScope async_scope(pipe);
+    uv_buf_t buf = pipe->read_ahead_;
+    pipe->read_ahead_ = uv_buf_init(nullptr, 0);
+    pipe->ProcessData(pipe->read_ahead_nread_, buf);
+    if (pipe->is_closed_ || pipe->is_writing_)
+      return;
+  }
+
   if (pipe->is_eof_) {
     AsyncScope async_scope(pipe);
     pipe->ShutdownWritable();
@@ -173,6 +225,12 @@ void StreamPipe::WritableListener::OnStreamAfterWrite(WriteWrap* w,
     prev->OnStreamAfterWrite(w, status);
     return;
   }
+
+  if (!pipe->is_reading_ && !pipe->is_closed_) {
+    AsyncScope async_scope(pipe);
+    pipe->is_reading_ = true;
+    pipe->source()->ReadStart();
+  }
 }
 
 void StreamPipe::WritableListener::OnStreamAfterShutdown(ShutdownWrap* w,
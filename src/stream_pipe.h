@@ -44,6 +44,17 @@ class StreamPipe : public AsyncWrap {
 
   void ProcessData(size_t nread, const uv_buf_t& buf);
 
+  // The next chunk is read while the previous one is being written. At most
+  // one chunk is kept in read_ahead_ until the write is done; the buffers are
+  // then reused for the following reads.
+  static const size_t kMaxFreeBuffers = 2;
+  uv_buf_t read_ahead_ = uv_buf_init(nullptr, 0);
+  size_t read_ahead_nread_ = 0;
+  uv_buf_t current_write_buf_ = uv_buf_init(nullptr, 0);
+  WriteWrap* current_write_ = nullptr;
+  std::vector<uv_buf_t> free_buffers_;
+  void RecycleBuffer(const uv_buf_t& buf);
+
   class ReadableListener : public StreamListener {
    public:
     uv_buf_t OnStreamAlloc(size_t suggested_size) override;
@@ -291,11 +291,11 @@ typedef SimpleShutdownWrap<ReqWrap<uv_shutdown_t>> LibuvShutdownWrap;
 typedef SimpleWriteWrap<ReqWrap<uv_write_t>> LibuvWriteWrap;
 
 ShutdownWrap* LibuvStreamWrap::CreateShutdownWrap(Local<Object> object) {
-  return new LibuvShutdownWrap(this, object);
+  return new (env()) LibuvShutdownWrap(this, object);
 }
 
 WriteWrap* LibuvStreamWrap::CreateWriteWrap(Local<Object> object) {
-  return new LibuvWriteWrap(this, object);
+  return new (env()) LibuvWriteWrap(this, object);
 }
 
 
@@ -25,6 +25,7 @@
 #include "node_internals.h"
 #include "node_errors.h"
 #include "node_buffer.h"
+#include "string_bytes_simd.h"
 
 #include <limits.h>
 #include <string.h>  // memcpy
@@ -111,12 +112,8 @@ class ExternString: public ResourceType {
     ExternString* h_str = new ExternString<ResourceType, TypeName>(isolate,
                                                                    data,
                                                                    length);
-    // CHAKRA-TODO: Revert this change. Currently chakrashim
-    // String::NewExternal deletes h_str immediately. Avoid accessing h_str
-    // after passing it to String::NewExternal.
-    size_t byte_length = h_str->byte_length();
     MaybeLocal<Value> str = NewExternal(isolate, h_str);
-    isolate->AdjustAmountOfExternalAllocatedMemory(byte_length);
+    isolate->AdjustAmountOfExternalAllocatedMemory(h_str->byte_length());
 
     if (str.IsEmpty()) {
       delete h_str;
@@ -253,7 +250,9 @@ static size_t hex_decode(char* buf,
                          const TypeName* src,
                          const size_t srcLen) {
   size_t i;
-  for (i = 0; i < len && i * 2 + 1 < srcLen; ++i) {
+  for (i = simd::HexDecode(buf, len, src, srcLen);
+       i < len && i * 2 + 1 < srcLen;
+       ++i) {
     unsigned a = unhex(src[i * 2 + 0]);
     unsigned b = unhex(src[i * 2 + 1]);
     if (!~a || !~b)
@@ -264,6 +263,23 @@ static size_t hex_decode(char* buf,
   return i;
 }
 
+
+// The vectorized decoder takes the clean prefix of the input, and
+// base64_decode_fast() whatever follows the first whitespace or padding.
+template <typename TypeName>
+static size_t base64_decode_simd(char* buf,
+                                 size_t buflen,
+                                 const TypeName* src,
+                                 size_t srclen) {
+  const size_t decoded_size = base64_decoded_size(src, srclen);
+  const size_t available = std::min(buflen, decoded_size) / 3 * 3;
+  const size_t k = simd::Base64Decode(buf, available, src, srclen);
+  const size_t i = k / 3 * 4;
+  return k + base64_decode_fast(buf + k, buflen - k,
+                                src + i, srclen - i,
+                                decoded_size - k);
+}
+
 size_t StringBytes::WriteUCS2(Isolate* isolate,
                               char* buf,
                               size_t buflen,
@@ -366,10 +382,10 @@ size_t StringBytes::Write(Isolate* isolate,
     case BASE64:
       if (str->IsExternalOneByte()) {
         auto ext = str->GetExternalOneByteStringResource();
-        nbytes = base64_decode(buf, buflen, ext->data(), ext->length());
+        nbytes = base64_decode_simd(buf, buflen, ext->data(), ext->length());
       } else {
         String::Value value(isolate, str);
-        nbytes = base64_decode(buf, buflen, *value, value.length());
+        nbytes = base64_decode_simd(buf, buflen, *value, value.length());
       }
       *chars_written = nbytes;
       break;
@@ -546,6 +562,40 @@ static bool contains_non_ascii(const char* src, size_t len) {
 }
 
 
+bool StringBytes::GetExternalBytes(Local<String> string,
+                                   enum encoding enc,
+                                   const char** data,
+                                   size_t* nbytes) {
+  switch (enc) {
+    case ASCII:
+    case LATIN1:
+    case UTF8:
+      if (string->IsExternalOneByte()) {
+        auto ext = string->GetExternalOneByteStringResource();
+        // Only ASCII is encoded the same in Latin-1 and UTF-8.
+        if (enc == UTF8 && contains_non_ascii(ext->data(), ext->length()))
+          return false;
+        *data = ext->data();
+        *nbytes = ext->length();
+        return true;
+      }
+      return false;
+
+    case UCS2:
+      if (IsLittleEndian() && string->IsExternal()) {
+        auto ext = string->GetExternalStringResource();
+        *data = reinterpret_cast<const char*>(ext->data());
+        *nbytes = ext->length() * sizeof(*ext->data());
+        return true;
+      }
+      return false;
+
+    default:
+      return false;
+  }
+}
+
+
 static void force_ascii_slow(const char* src, char* dst, size_t len) {
   for (size_t i = 0; i < len; ++i) {
     dst[i] = src[i] & 0x7f;
@@ -604,7 +654,8 @@ static size_t hex_encode(const char* src, size_t slen, char* dst, size_t dlen) {
       "not enough space provided for hex encode");
 
   dlen = slen * 2;
-  for (uint32_t i = 0, k = 0; k < dlen; i += 1, k += 2) {
+  size_t i = simd::HexEncode(src, slen, dst);
+  for (size_t k = i * 2; k < dlen; i += 1, k += 2) {
     static const char hex[] = "0123456789abcdef";
     uint8_t val = static_cast<uint8_t>(src[i]);
     dst[k + 0] = hex[val >> 4];
@@ -687,7 +738,10 @@ MaybeLocal<Value> StringBytes::Encode(Isolate* isolate,
         return MaybeLocal<Value>();
       }
 
-      size_t written = base64_encode(buf, buflen, dst, dlen);
+      const size_t done = simd::Base64Encode(buf, buflen, dst);
+      const size_t offset = done / 3 * 4;
+      size_t written = offset + base64_encode(buf + done, buflen - done,
+                                              dst + offset, dlen - offset);
       CHECK_EQ(written, dlen);
 
       return ExternOneByteString::New(isolate, dst, dlen, error);
@@ -66,6 +66,14 @@ class StringBytes {
   static bool IsValidString(v8::Local<v8::String> string,
                             enum encoding enc);
 
+  // If the string is externalized and its content is already what Write()
+  // would produce for the encoding, points *data at it and returns true.
+  // The content stays valid for as long as the string is alive.
+  static bool GetExternalBytes(v8::Local<v8::String> string,
+                               enum encoding enc,
+                               const char** data,
+                               size_t* nbytes);
+
   // Fast, but can be 2 bytes oversized for Base64, and
   // as much as triple UTF-8 strings <= 65536 chars in length
   static v8::Maybe<size_t> StorageSize(v8::Isolate* isolate,
@@ -0,0 +1,600 @@
+#include "string_bytes_simd.h"
+
+#include <string.h>  // memcmp, memcpy
+
+#if (defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__GNUC__) || defined(__clang__))
+#define NODE_HAVE_AVX2_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace node {
+namespace simd {
+
+#ifdef NODE_HAVE_AVX2_KERNELS
+
+// The kernels are compiled for AVX2 whatever the baseline of the build is,
+// and only called after checking the CPU at runtime.
+#define AVX2_TARGET __attribute__((target("avx2")))
+
+static bool HasAVX2() {
+  static const bool has_avx2 = __builtin_cpu_supports("avx2");
+  return has_avx2;
+}
+
+
+AVX2_TARGET static inline __m256i Load32(const char* src) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+}
+
+
+// Narrows 32 two-byte characters to bytes. Characters outside of latin1
+// saturate to 0x00 or 0xFF, and neither is accepted by the decoders.
+AVX2_TARGET static inline __m256i Load32(const uint16_t* src) {
+  const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+  const __m256i hi =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 16));
+  // packus works per 128 bit lane, put the quadwords back in order.
+  return _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xD8);
+}
+
+
+AVX2_TARGET static inline void Store32(char* dst, __m256i v) {
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
+}
+
+
+AVX2_TARGET static size_t HexEncodeAVX2(const char* src,
+                                        size_t slen,
+                                        char* dst) {
+  const __m256i table = _mm256_setr_epi8(
+      '0', '1', '2', '3', '4', '5', '6', '7',
+      '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+      '0', '1', '2', '3', '4', '5', '6', '7',
+      '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  size_t i = 0;
+
+  for (; i + 32 <= slen; i += 32) {
+    const __m256i in = Load32(src + i);
+    const __m256i hi = _mm256_shuffle_epi8(
+        table, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble));
+    const __m256i lo = _mm256_shuffle_epi8(table, _mm256_and_si256(in, nibble));
+    // The unpacks interleave within each 128 bit lane: a holds the digits
+    // of bytes 0-7 and 16-23, b those of bytes 8-15 and 24-31.
+    const __m256i a = _mm256_unpacklo_epi8(hi, lo);
+    const __m256i b = _mm256_unpackhi_epi8(hi, lo);
+    Store32(dst + i * 2, _mm256_permute2x128_si256(a, b, 0x20));
+    Store32(dst + i * 2 + 32, _mm256_permute2x128_si256(a, b, 0x31));
+  }
+
+  return i;
+}
+
+
+// Converts 32 hex digits to their values. Returns false if any of them is
+// not a hex digit.
+AVX2_TARGET static inline bool HexValues(__m256i c, __m256i* values) {
+  const __m256i digit = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+  const __m256i alpha = _mm256_sub_epi8(
+      _mm256_or_si256(c, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+  const __m256i is_digit =
+      _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+  const __m256i is_alpha =
+      _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, _mm256_set1_epi8(5)), alpha);
+  if (_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_alpha)) != -1)
+    return false;
+  *values = _mm256_blendv_epi8(
+      _mm256_add_epi8(alpha, _mm256_set1_epi8(10)), digit, is_digit);
+  return true;
+}
+
+
+template <typename TypeName>
+AVX2_TARGET static size_t HexDecodeAVX2(char* dst,
+                                        size_t dlen,
+                                        const TypeName* src,
+                                        size_t slen) {
+  // maddubs computes even * 16 + odd for each pair of digits.
+  const __m256i weights = _mm256_set1_epi16(0x0110);
+  size_t k = 0;
+
+  for (; k + 32 <= dlen && k * 2 + 64 <= slen; k += 32) {
+    __m256i a;
+    __m256i b;
+    if (!HexValues(Load32(src + k * 2), &a) ||
+        !HexValues(Load32(src + k * 2 + 32), &b)) {
+      break;
+    }
+    const __m256i out = _mm256_packus_epi16(_mm256_maddubs_epi16(a, weights),
+                                            _mm256_maddubs_epi16(b, weights));
+    Store32(dst + k, _mm256_permute4x64_epi64(out, 0xD8));
+  }
+
+  return k;
+}
+
+
+// Encodes 24 bytes into 32 characters per iteration, see Wojciech Muła,
+// "Base64 encoding with SIMD instructions".
+AVX2_TARGET static size_t Base64EncodeAVX2(const char* src,
+                                           size_t slen,
+                                           char* dst) {
+  // Duplicate the bytes so each 32 bit lane holds one 3 byte group as
+  // b1 b0 b2 b1, which puts every 6 bit index inside a 16 bit word.
+  const __m256i spread = _mm256_setr_epi8(
+      1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+      1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+  // Offset to add to an index, selected by which range the index is in:
+  // 0 for 'a'-'z', 1-10 for '0'-'9', 11 for '+', 12 for '/', 13 for 'A'-'Z'.
+  const __m256i offsets = _mm256_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+      '/' - 63, 'A', 0, 0,
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+      '/' - 63, 'A', 0, 0);
+  size_t i = 0;
+  size_t k = 0;
+
+  // Each lane takes its 12 bytes from a 16 byte load, so the second load
+  // reads 4 bytes past the 24 that are encoded.
+  for (; i + 28 <= slen; i += 24, k += 32) {
+    const __m128i lo =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i hi =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 12));
+    const __m256i in = _mm256_shuffle_epi8(
+        _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1), spread);
+
+    const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const __m256i indices = _mm256_or_si256(t1, t3);
+
+    __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    const __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    range = _mm256_or_si256(range,
+                            _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+    Store32(dst + k,
+            _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, range)));
+  }
+
+  return i;
+}
+
+
+// Decodes 32 characters into 24 bytes per iteration. Characters are
+// validated with two lookups, on their low and high nibble, whose results
+// have a bit in common only for '+', '-', '/', '_', '0'-'9', 'A'-'Z' and
+// 'a'-'z'. Anything else, padding included, ends the vectorized part.
+template <typename TypeName>
+AVX2_TARGET static size_t Base64DecodeAVX2(char* dst,
+                                           size_t dlen,
+                                           const TypeName* src,
+                                           size_t slen) {
+  const __m256i lo_classes = _mm256_setr_epi8(
+      0x2A, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+      0x3E, 0x3E, 0x3C, 0x15, 0x14, 0x15, 0x14, 0x1D,
+      0x2A, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+      0x3E, 0x3E, 0x3C, 0x15, 0x14, 0x15, 0x14, 0x1D);
+  const __m256i hi_classes = _mm256_setr_epi8(
+      0, 0, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0, 0, 0, 0, 0, 0, 0, 0);
+  // Added to a character to get its value, by high nibble. The symbols in
+  // 0x2_ and 0x5_ are set separately.
+  const __m256i deltas = _mm256_setr_epi8(
+      0, 0, 0, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  // Gathers the three bytes of each 32 bit lane, most significant first.
+  const __m256i gather = _mm256_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  size_t i = 0;
+  size_t k = 0;
+
+  for (; i + 32 <= slen && k + 24 <= dlen; i += 32, k += 24) {
+    const __m256i c = Load32(src + i);
+    const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(c, 4), nibble);
+    const __m256i lo = _mm256_and_si256(c, nibble);
+    const __m256i classes = _mm256_and_si256(
+        _mm256_shuffle_epi8(lo_classes, lo),
+        _mm256_shuffle_epi8(hi_classes, hi));
+    if (_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(classes, _mm256_setzero_si256())) != 0) {
+      break;
+    }
+
+    __m256i values = _mm256_add_epi8(c, _mm256_shuffle_epi8(deltas, hi));
+    const __m256i is62 =
+        _mm256_or_si256(_mm256_cmpeq_epi8(c, _mm256_set1_epi8('+')),
+                        _mm256_cmpeq_epi8(c, _mm256_set1_epi8('-')));
+    const __m256i is63 =
+        _mm256_or_si256(_mm256_cmpeq_epi8(c, _mm256_set1_epi8('/')),
+                        _mm256_cmpeq_epi8(c, _mm256_set1_epi8('_')));
+    values = _mm256_blendv_epi8(values, _mm256_set1_epi8(62), is62);
+    values = _mm256_blendv_epi8(values, _mm256_set1_epi8(63), is63);
+
+    // Merge the four 6 bit values of each 32 bit lane into 24 bits.
+    const __m256i merged = _mm256_madd_epi16(
+        _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140)),
+        _mm256_set1_epi32(0x00011000));
+    const __m256i out = _mm256_permutevar8x32_epi32(
+        _mm256_shuffle_epi8(merged, gather),
+        _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + k),
+                     _mm256_castsi256_si128(out));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + k + 16),
+                     _mm256_extracti128_si256(out, 1));
+  }
+
+  return k;
+}
+
+AVX2_TARGET static size_t FindSubstringAVX2(const uint8_t* haystack,
+                                            size_t hlen,
+                                            const uint8_t* needle,
+                                            size_t nlen,
+                                            size_t index) {
+  const __m256i first = _mm256_set1_epi8(needle[0]);
+  const __m256i last = _mm256_set1_epi8(needle[nlen - 1]);
+  size_t i = index;
+
+  for (; i + nlen - 1 + 32 <= hlen; i += 32) {
+    const __m256i block_first =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i));
+    const __m256i block_last = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(haystack + i + nlen - 1));
+    uint32_t mask = _mm256_movemask_epi8(
+        _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first),
+                         _mm256_cmpeq_epi8(last, block_last)));
+    while (mask != 0) {
+      const size_t pos = i + __builtin_ctz(mask);
+      if (memcmp(haystack + pos + 1, needle + 1, nlen - 2) == 0)
+        return pos;
+      mask &= mask - 1;
+    }
+  }
+
+  for (; i + nlen <= hlen; i++) {
+    if (haystack[i] == needle[0] &&
+        memcmp(haystack + i + 1, needle + 1, nlen - 1) == 0) {
+      return i;
+    }
+  }
+
+  return hlen;
+}
+
+
+// Validates 32 bytes of UTF-8 per iteration with three nibble lookups on each
+// byte and the one before it, see John Keiser and Daniel Lemire, "Validating
+// UTF-8 In Less Than One Instruction Per Byte". Each bit of the lookups
+// stands for one kind of error, and a pair of bytes is invalid if the three
+// results have a bit in common. Stops before the first block with an error,
+// which may be one cut off at its end by the end of the block.
+AVX2_TARGET static size_t Utf8ValidPrefixAVX2(const uint8_t* src,
+                                              size_t len) {
+  const int8_t kTooShort = 1 << 0;   // Lead byte not followed by enough
+                                     // continuation bytes.
+  const int8_t kTooLong = 1 << 1;    // Continuation byte after ASCII.
+  const int8_t kOverlong3 = 1 << 2;  // E0 80..9F
+  const int8_t kTooLarge = 1 << 3;   // F4 90..BF, F5..FF
+  const int8_t kSurrogate = 1 << 4;  // ED A0..BF
+  const int8_t kOverlong2 = 1 << 5;  // C0..C1
+  const int8_t kTooLarge1000 = 1 << 6;  // F5..FF 80..8F
+  const int8_t kOverlong4 = 1 << 6;  // F0 80..8F
+  const int8_t kTwoConts = static_cast<int8_t>(1 << 7);
+  const int8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+  // By the high nibble of the first byte.
+  const __m256i byte1_high = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+      kTooLong, kTooLong, kTooLong, kTooLong,
+      kTooLong, kTooLong, kTooLong, kTooLong,
+      kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+      kTooShort | kOverlong2,
+      kTooShort,
+      kTooShort | kOverlong3 | kSurrogate,
+      kTooShort | kTooLarge | kTooLarge1000 | kOverlong4));
+  // By the low nibble of the first byte.
+  const __m256i byte1_low = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+      kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+      kCarry | kOverlong2,
+      kCarry,
+      kCarry,
+      kCarry | kTooLarge,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+      kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000));
+  // By the high nibble of the second byte.
+  const __m256i byte2_high = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+      kTooShort, kTooShort, kTooShort, kTooShort,
+      kTooShort, kTooShort, kTooShort, kTooShort,
+      kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 |
+          kOverlong4,
+      kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+      kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+      kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+      kTooShort, kTooShort, kTooShort, kTooShort));
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  __m256i prev_input = _mm256_setzero_si256();
+  size_t i = 0;
+
+  for (; i + 32 <= len; i += 32) {
+    const __m256i input =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    // The previous block's upper half followed by this block's lower half.
+    const __m256i shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+    const __m256i prev1 = _mm256_alignr_epi8(input, shifted, 15);
+    const __m256i prev2 = _mm256_alignr_epi8(input, shifted, 14);
+    const __m256i prev3 = _mm256_alignr_epi8(input, shifted, 13);
+
+    const __m256i special = _mm256_and_si256(
+        _mm256_and_si256(
+            _mm256_shuffle_epi8(
+                byte1_high,
+                _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+            _mm256_shuffle_epi8(byte1_low, _mm256_and_si256(prev1, nibble))),
+        _mm256_shuffle_epi8(
+            byte2_high,
+            _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble)));
+    // The third and fourth bytes of three and four byte sequences must be
+    // continuation bytes, which the lookups above count as kTwoConts.
+    const __m256i must_be_continuation = _mm256_or_si256(
+        _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0 - 0x80)),
+        _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0 - 0x80)));
+    const __m256i error = _mm256_xor_si256(
+        _mm256_and_si256(must_be_continuation,
+                         _mm256_set1_epi8(static_cast<int8_t>(0x80))),
+        special);
+    if (!_mm256_testz_si256(error, error))
+      break;
+    prev_input = input;
+  }
+
+  // The last sequence checked may continue past the blocks, leave it to the
+  // scalar code.
+  size_t k = 0;
+  while (k < 3 && i > 0 && (src[i - 1] & 0xC0) == 0x80) {
+    i--;
+    k++;
+  }
+  if (i > 0 && src[i - 1] >= 0xC0)
+    i--;
+  return i;
+}
+
+
+AVX2_TARGET static size_t NoSurrogatesPrefixAVX2(const uint16_t* src,
+                                                 size_t len) {
+  const __m256i mask = _mm256_set1_epi16(static_cast<int16_t>(0xF800));
+  const __m256i surrogate = _mm256_set1_epi16(static_cast<int16_t>(0xD800));
+  size_t i = 0;
+
+  for (; i + 16 <= len; i += 16) {
+    const __m256i units =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    const uint32_t found = _mm256_movemask_epi8(
+        _mm256_cmpeq_epi16(_mm256_and_si256(units, mask), surrogate));
+    if (found != 0)
+      return i + __builtin_ctz(found) / 2;
+  }
+
+  return i;
+}
+
+
+AVX2_TARGET static size_t AsciiPrefixAVX2(const uint8_t* src, size_t len) {
+  size_t i = 0;
+
+  for (; i + 32 <= len; i += 32) {
+    const uint32_t high = _mm256_movemask_epi8(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+    if (high != 0)
+      return i + __builtin_ctz(high);
+  }
+
+  return i;
+}
+
+#endif  // NODE_HAVE_AVX2_KERNELS
+
+
+size_t HexEncode(const char* src, size_t slen, char* dst) {
+#ifdef NODE_HAVE_AVX2_KERNELS
+  if (HasAVX2())
+    return HexEncodeAVX2(src, slen, dst);
+#endif
+  return 0;
+}
+
+
+size_t HexDecode(char* dst, size_t dlen, const char* src, size_t slen) {
+#ifdef NODE_HAVE_AVX2_KERNELS
+  if (HasAVX2())
+    return HexDecodeAVX2(dst, dlen, src, slen);
+#endif
+  return 0;
+}
+
+
+size_t HexDecode(char* dst, size_t dlen, const uint16_t* src, size_t slen) {
+#ifdef NODE_HAVE_AVX2_KERNELS
+  if (HasAVX2())
+    return HexDecodeAVX2(dst, dlen, src, slen);
+#endif
+  return 0;
+}
+
+
+size_t Base64Encode(const char* src, size_t slen, char* dst) {
+#ifdef NODE_HAVE_AVX2_KERNELS
+  if (HasAVX2())
+    return Base64EncodeAVX2(src, slen, dst);
+#endif
+  return 0;
+}
+
+
+size_t Base64Decode(char* dst, size_t dlen, const char* src, size_t slen) {
+#ifdef NODE_HAVE_AVX2_KERNELS
+  if (HasAVX2())
+    return Base64DecodeAVX2(dst, dlen, src, slen);
+#endif
+  return 0;
+}
+
+
+size_t Base64Decode(char* dst,
+                    size_t dlen,
+                    const uint16_t* src,
+                    size_t slen) {
+#ifdef NODE_HAVE_AVX2_KERNELS
+  if (HasAVX2())
+    return Base64DecodeAVX2(dst, dlen, src, slen);
+#endif
+  return 0;
+}
+
+
+bool HasFindSubstring() {
+#ifdef NODE_HAVE_AVX2_KERNELS
+  return HasAVX2();
+#else
+  return false;
+#endif
+}
+
+
+size_t FindSubstring(const uint8_t* haystack, size_t hlen,
+                     const uint8_t* needle, size_t nlen,
+                     size_t index) {
+#ifdef NODE_HAVE_AVX2_KERNELS
+  if (HasAVX2())
+    return FindSubstringAVX2(haystack, hlen, needle, nlen, index);
+#endif
+  for (size_t i = index; i + nlen <= hlen; i++) {
+    if (memcmp(haystack + i, needle, nlen) == 0)
+      return i;
+  }
+  return hlen;
+}
+
+
+// The scalar versions finish what the vectorized ones leave, and do all of
+// the work on other CPUs.
+
+static size_t AsciiPrefixScalar(const uint8_t* src, size_t len, size_t i) {
+  for (; i + 8 <= len; i += 8) {
+    uint64_t word;
+    memcpy(&word, src + i, sizeof(word));
+    if (word & 0x8080808080808080ull)
+      break;
+  }
+  while (i < len && src[i] < 0x80)
+    i++;
+  return i;
+}
+
+
+static size_t Utf8ValidPrefixScalar(const uint8_t* src, size_t len, size_t i) {
+  while (i < len) {
+    const uint8_t c = src[i];
+    if (c < 0x80) {
+      i = AsciiPrefixScalar(src, len, i + 1);
+      continue;
+    }
+
+    // The ranges of the second byte are those of the Unicode Standard's
+    // table of well-formed byte sequences.
+    size_t n;
+    uint8_t min = 0x80;
+    uint8_t max = 0xBF;
+    if (c >= 0xC2 && c <= 0xDF) {
+      n = 2;
+    } else if (c >= 0xE0 && c <= 0xEF) {
+      n = 3;
+      if (c == 0xE0)
+        min = 0xA0;
+      else if (c == 0xED)
+        max = 0x9F;
+    } else if (c >= 0xF0 && c <= 0xF4) {
+      n = 4;
+      if (c == 0xF0)
+        min = 0x90;
+      else if (c == 0xF4)
+        max = 0x8F;
+    } else {
+      break;
+    }
+
+    if (n > len - i || src[i + 1] < min || src[i + 1] > max)
+      break;
+    if (n > 2 && (src[i + 2] & 0xC0) != 0x80)
+      break;
+    if (n > 3 && (src[i + 3] & 0xC0) != 0x80)
+      break;
+    i += n;
+  }
+  return i;
+}
+
+
+size_t Utf8ValidPrefix(const char* src, size_t len) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(src);
+  size_t i = 0;
+#ifdef NODE_HAVE_AVX2_KERNELS
+  if (HasAVX2())
+    i = Utf8ValidPrefixAVX2(bytes, len);
+#endif
+  return Utf8ValidPrefixScalar(bytes, len, i);
+}
+
+
+size_t Utf16ValidPrefix(const uint16_t* src, size_t len) {
+  size_t i = 0;
+  while (i < len) {
+#ifdef NODE_HAVE_AVX2_KERNELS
+    if (HasAVX2()) {
+      i += NoSurrogatesPrefixAVX2(src + i, len - i);
+      if (i == len)
+        break;
+    }
+#endif
+    const uint16_t c = src[i];
+    if (c < 0xD800 || c > 0xDFFF) {
+      i++;
+      continue;
+    }
+    if (c > 0xDBFF || i + 1 == len || src[i + 1] < 0xDC00 ||
+        src[i + 1] > 0xDFFF) {
+      break;
+    }
+    i += 2;
+  }
+  return i;
+}
+
+
+size_t AsciiPrefix(const char* src, size_t len) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(src);
+  size_t i = 0;
+#ifdef NODE_HAVE_AVX2_KERNELS
+  if (HasAVX2())
+    i = AsciiPrefixAVX2(bytes, len);
+#endif
+  return AsciiPrefixScalar(bytes, len, i);
+}
+
+}  // namespace simd
+}  // namespace node
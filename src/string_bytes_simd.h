@@ -0,0 +1,71 @@
+#ifndef SRC_STRING_BYTES_SIMD_H_
+#define SRC_STRING_BYTES_SIMD_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace node {
+namespace simd {
+
+// Vectorized hex, base64, substring search and text validation kernels,
+// picked at runtime from the CPU's features.
+//
+// The codecs only handle whole blocks of plain input and return how far
+// they got; the caller finishes the rest with the scalar code, which also
+// deals with whitespace, padding and invalid characters. When the CPU has no
+// usable vector unit they return 0.
+
+// Encodes a prefix of `src` into `dst`, which must have room for slen * 2
+// bytes. Returns the number of source bytes consumed.
+size_t HexEncode(const char* src, size_t slen, char* dst);
+
+// Decodes at most `dlen` bytes. Returns the number of bytes written, the
+// number of source characters consumed is twice that.
+size_t HexDecode(char* dst, size_t dlen, const char* src, size_t slen);
+size_t HexDecode(char* dst, size_t dlen, const uint16_t* src, size_t slen);
+
+// Encodes a prefix of `src` into `dst`, which must have room for
+// base64_encoded_size(slen) bytes. Returns the number of source bytes
+// consumed, always a multiple of 3.
+size_t Base64Encode(const char* src, size_t slen, char* dst);
+
+// Decodes at most `dlen` bytes of standard or URL-safe base64. Returns the
+// number of bytes written, always a multiple of 3; the number of source
+// characters consumed is that divided by 3 times 4.
+size_t Base64Decode(char* dst, size_t dlen, const char* src, size_t slen);
+size_t Base64Decode(char* dst, size_t dlen, const uint16_t* src, size_t slen);
+
+// Returns true if FindSubstring() is vectorized on this CPU.
+bool HasFindSubstring();
+
+// Finds the first occurrence of `needle`, which is at least two bytes long,
+// in `haystack` at or after `index`. Candidates are found by comparing the
+// first and last byte of the needle against 32 positions at a time. Returns
+// `hlen` if there is none.
+size_t FindSubstring(const uint8_t* haystack, size_t hlen,
+                     const uint8_t* needle, size_t nlen,
+                     size_t index);
+
+// The validators below have a scalar fallback and always return the whole
+// answer.
+
+// Returns the length of the longest prefix of `src` made of complete, well
+// formed UTF-8 sequences: no overlong forms, surrogates or code points past
+// U+10FFFF. A sequence cut off by the end of `src` is not part of it.
+size_t Utf8ValidPrefix(const char* src, size_t len);
+
+// Returns the length of the longest prefix of `src` without unpaired
+// surrogates. A high surrogate at the end of `src` is not part of it.
+size_t Utf16ValidPrefix(const uint16_t* src, size_t len);
+
+// Returns the length of the longest prefix of `src` made of ASCII bytes.
+size_t AsciiPrefix(const char* src, size_t len);
+
+}  // namespace simd
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_STRING_BYTES_SIMD_H_
@@ -8,6 +8,7 @@
 #if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
 
 #include "node_internals.h"
+#include "string_bytes_simd.h"
 #include <string.h>
 #include <algorithm>
 
@@ -79,6 +80,11 @@ class StringSearchBase {
   // to compensate for the algorithmic overhead compared to simple brute force.
   static const int kBMMinPatternLength = 8;
 
+  // One-byte patterns up to this length are searched for with the vectorized
+  // first and last byte filter, when the CPU supports it. Longer patterns
+  // skip far enough with Boyer-Moore-Horspool to make up for its overhead.
+  static const int kVectorMaxPatternLength = 32;
+
   // Store for the BoyerMoore(Horspool) bad char shift table.
   int bad_char_shift_table_[kUC16AlphabetSize];
   // Store for the BoyerMoore good suffix shift table.
@@ -101,6 +107,13 @@ class StringSearch : private StringSearchBase {
 
     size_t pattern_length = pattern_.length();
     CHECK_GT(pattern_length, 0);
+    if (sizeof(Char) == 1 &&
+        pattern_length >= 2 &&
+        pattern_length <= kVectorMaxPatternLength &&
+        simd::HasFindSubstring()) {
+      strategy_ = &StringSearch::VectorSearch;
+      return;
+    }
     if (pattern_length < kBMMinPatternLength) {
       if (pattern_length == 1) {
         strategy_ = &StringSearch::SingleCharSearch;
@@ -134,6 +147,7 @@ class StringSearch : private StringSearchBase {
   typedef size_t (StringSearch::*SearchFunction)(Vector, size_t);
   size_t SingleCharSearch(Vector subject, size_t start_index);
   size_t LinearSearch(Vector subject, size_t start_index);
+  size_t VectorSearch(Vector subject, size_t start_index);
   size_t InitialSearch(Vector subject, size_t start_index);
   size_t BoyerMooreHorspoolSearch(Vector subject, size_t start_index);
   size_t BoyerMooreSearch(Vector subject, size_t start_index);
@@ -312,6 +326,29 @@ size_t StringSearch<Char>::LinearSearch(
   return subject.length();
 }
 
+//---------------------------------------------------------------------
+// Vectorized Search Strategy
+//---------------------------------------------------------------------
+
+// Only chosen for one-byte patterns. The kernel scans front to back, so
+// reverse searches use the scalar strategies.
+template <typename Char>
+size_t StringSearch<Char>::VectorSearch(
+    Vector subject,
+    size_t index) {
+  if (!subject.forward()) {
+    if (pattern_.length() < kBMMinPatternLength)
+      return LinearSearch(subject, index);
+    return InitialSearch(subject, index);
+  }
+  return simd::FindSubstring(
+      reinterpret_cast<const uint8_t*>(subject.start()),
+      subject.length(),
+      reinterpret_cast<const uint8_t*>(pattern_.start()),
+      pattern_.length(),
+      index);
+}
+
 //---------------------------------------------------------------------
 // Boyer-Moore string search
 //---------------------------------------------------------------------
@@ -129,6 +129,7 @@ void TCPWrap::Initialize(Local<Object> target,
   NODE_DEFINE_CONSTANT(constants, SOCKET);
   NODE_DEFINE_CONSTANT(constants, SERVER);
   NODE_DEFINE_CONSTANT(constants, UV_TCP_IPV6ONLY);
+  NODE_DEFINE_CONSTANT(constants, UV_TCP_REUSEPORT);
   target->Set(context,
               env->constants_string(),
               constants).FromJust();
@@ -234,13 +235,18 @@ void TCPWrap::Bind(const FunctionCallbackInfo<Value>& args) {
   Environment* env = wrap->env();
   node::Utf8Value ip_address(env->isolate(), args[0]);
   int port;
+  unsigned int flags = 0;
   if (!args[1]->Int32Value(env->context()).To(&port)) return;
+  if (!args[2]->IsUndefined() &&
+      !args[2]->Uint32Value(env->context()).To(&flags)) {
+    return;
+  }
   sockaddr_in addr;
   int err = uv_ip4_addr(*ip_address, port, &addr);
   if (err == 0) {
     err = uv_tcp_bind(&wrap->handle_,
                       reinterpret_cast<const sockaddr*>(&addr),
-                      0);
+                      flags);
   }
   args.GetReturnValue().Set(err);
 }
@@ -325,8 +331,8 @@ void TCPWrap::Connect(const FunctionCallbackInfo<Value>& args,
 
   if (err == 0) {
     AsyncHooks::DefaultTriggerAsyncIdScope trigger_scope(wrap);
-    ConnectWrap* req_wrap =
-        new ConnectWrap(env, req_wrap_obj, AsyncWrap::PROVIDER_TCPCONNECTWRAP);
+    ConnectWrap* req_wrap = new (env) ConnectWrap(
+        env, req_wrap_obj, AsyncWrap::PROVIDER_TCPCONNECTWRAP);
     err = req_wrap->Dispatch(uv_tcp_connect,
                              &wrap->handle_,
                              reinterpret_cast<const sockaddr*>(&addr),
@@ -469,6 +469,7 @@ bool TLSWrap::ClearIn() {
   // All written
   if (i == buffers.size()) {
     CHECK_GE(written, 0);
+    pending_cleartext_data_.clear();
     return true;
   }
 
@@ -480,6 +481,8 @@ bool TLSWrap::ClearIn() {
   std::string error_str;
   Local<Value> arg = GetSSLError(written, &err, &error_str);
   if (!arg.IsEmpty()) {
+    // The pending buffers are dropped, and the copies backing them with them.
+    pending_cleartext_data_.clear();
     write_callback_scheduled_ = true;
     InvokeQueued(UV_EPROTO, error_str.c_str());
   } else {
@@ -599,15 +602,29 @@ int TLSWrap::DoWrite(WriteWrap* w,
 
   crypto::MarkPopErrorOnReturn mark_pop_error_on_return;
 
-  int written = 0;
-  for (i = 0; i < count; i++) {
-    written = SSL_write(ssl_.get(), bufs[i].base, bufs[i].len);
-    CHECK(written == -1 || written == static_cast<int>(bufs[i].len));
-    if (written == -1)
-      break;
+  // Hand all buffers to OpenSSL in a single SSL_write() call, so that
+  // writev() of many small chunks fills full-sized TLS records instead of
+  // producing one record per chunk.
+  MallocedBuffer<char> data;
+  uv_buf_t buf = bufs[0];
+  if (count > 1) {
+    size_t length = 0;
+    for (i = 0; i < count; i++)
+      length += bufs[i].len;
+
+    data = MallocedBuffer<char>(length);
+    size_t offset = 0;
+    for (i = 0; i < count; i++) {
+      memcpy(data.data + offset, bufs[i].base, bufs[i].len);
+      offset += bufs[i].len;
+    }
+    buf = uv_buf_init(data.data, length);
   }
 
-  if (i != count) {
+  int written = SSL_write(ssl_.get(), buf.base, buf.len);
+  CHECK(written == -1 || written == static_cast<int>(buf.len));
+
+  if (written == -1) {
     int err;
     Local<Value> arg = GetSSLError(written, &err, &error_);
     if (!arg.IsEmpty()) {
@@ -615,9 +632,11 @@ int TLSWrap::DoWrite(WriteWrap* w,
       return UV_EPROTO;
     }
 
-    pending_cleartext_input_.insert(pending_cleartext_input_.end(),
-                                    &bufs[i],
-                                    &bufs[count]);
+    // OpenSSL wants the retry to use the same buffer, keep the copy around
+    // until ClearIn() gets it written.
+    pending_cleartext_input_.push_back(buf);
+    if (!data.is_empty())
+      pending_cleartext_data_.emplace_back(std::move(data));
   }
 
   // Try writing data immediately
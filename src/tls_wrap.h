@@ -150,6 +150,9 @@ class TLSWrap : public AsyncWrap,
   BIO* enc_in_ = nullptr;
   BIO* enc_out_ = nullptr;
   std::vector<uv_buf_t> pending_cleartext_input_;
+  // Backing store for pending_cleartext_input_ when DoWrite() coalesced
+  // several buffers into one.
+  std::vector<MallocedBuffer<char>> pending_cleartext_data_;
   size_t write_size_ = 0;
   WriteWrap* current_write_ = nullptr;
   WriteWrap* current_empty_write_ = nullptr;
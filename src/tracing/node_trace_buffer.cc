@@ -3,44 +3,100 @@
 namespace node {
 namespace tracing {
 
+namespace {
+
+uv_once_t shard_key_once = UV_ONCE_INIT;
+uv_key_t shard_key;
+std::atomic<uintptr_t> shard_count{0};
+
+}  // namespace
+
 InternalTraceBuffer::InternalTraceBuffer(size_t max_chunks, uint32_t id,
                                          Agent* agent)
     : flushing_(false), max_chunks_(max_chunks),
-      agent_(agent), id_(id) {
+      agent_(agent), chunk_owners_(new std::atomic<uint8_t>[max_chunks]),
+      id_(id) {
   chunks_.resize(max_chunks);
+  for (size_t i = 0; i < max_chunks; ++i)
+    chunk_owners_[i].store(kNoShard);
+  for (Shard& shard : shards_)
+    shard.chunk_index = kNoChunk;
+}
+
+// Threads are assigned to shards round-robin the first time they add an
+// event.
+size_t InternalTraceBuffer::CurrentShard() {
+  uv_once(&shard_key_once, []() {
+    CHECK_EQ(0, uv_key_create(&shard_key));
+  });
+  uintptr_t shard = reinterpret_cast<uintptr_t>(uv_key_get(&shard_key));
+  if (shard == 0) {
+    shard = ++shard_count;
+    uv_key_set(&shard_key, reinterpret_cast<void*>(shard));
+  }
+  return (shard - 1) % kShards;
+}
+
+bool InternalTraceBuffer::ClaimChunk(size_t* chunk_index) {
+  size_t index = total_chunks_.load();
+  do {
+    if (index == max_chunks_)
+      return false;
+  } while (!total_chunks_.compare_exchange_weak(index, index + 1));
+  *chunk_index = index;
+  return true;
 }
 
 TraceObject* InternalTraceBuffer::AddTraceEvent(uint64_t* handle) {
-  Mutex::ScopedLock scoped_lock(mutex_);
-  // Create new chunk if last chunk is full or there is no chunk.
-  if (total_chunks_ == 0 || chunks_[total_chunks_ - 1]->IsFull()) {
-    auto& chunk = chunks_[total_chunks_++];
+  size_t shard_index = CurrentShard();
+  Shard& shard = shards_[shard_index];
+  Mutex::ScopedLock scoped_lock(shard.mutex);
+  // Claim a new chunk if this shard's chunk is full or there is no chunk.
+  if (shard.chunk_index == kNoChunk ||
+      chunks_[shard.chunk_index]->IsFull()) {
+    size_t chunk_index;
+    if (!ClaimChunk(&chunk_index)) {
+      // Every chunk is in use; as in NodeTraceBuffer::AddTraceEvent(), a zero
+      // handle never has a trace event associated with it.
+      *handle = 0;
+      return nullptr;
+    }
+    auto& chunk = chunks_[chunk_index];
     if (chunk) {
       chunk->Reset(current_chunk_seq_++);
     } else {
       chunk.reset(new TraceBufferChunk(current_chunk_seq_++));
     }
+    chunk_owners_[chunk_index].store(static_cast<uint8_t>(shard_index));
+    shard.chunk_index = chunk_index;
   }
-  auto& chunk = chunks_[total_chunks_ - 1];
+  auto& chunk = chunks_[shard.chunk_index];
   size_t event_index;
   TraceObject* trace_object = chunk->AddTraceEvent(&event_index);
-  *handle = MakeHandle(total_chunks_ - 1, chunk->seq(), event_index);
+  *handle = MakeHandle(shard_index, shard.chunk_index, chunk->seq(),
+                       event_index);
   return trace_object;
 }
 
 TraceObject* InternalTraceBuffer::GetEventByHandle(uint64_t handle) {
-  Mutex::ScopedLock scoped_lock(mutex_);
   if (handle == 0) {
     // A handle value of zero never has a trace event associated with it.
     return nullptr;
   }
-  size_t chunk_index, event_index;
+  size_t shard, chunk_index, event_index;
   uint32_t buffer_id, chunk_seq;
-  ExtractHandle(handle, &buffer_id, &chunk_index, &chunk_seq, &event_index);
-  if (buffer_id != id_ || chunk_index >= total_chunks_) {
-    // Either the chunk belongs to the other buffer, or is outside the current
-    // range of chunks loaded in memory (the latter being true suggests that
-    // the chunk has already been flushed and is no longer in memory.)
+  ExtractHandle(handle, &buffer_id, &shard, &chunk_index, &chunk_seq,
+                &event_index);
+  if (buffer_id != id_ || chunk_index >= max_chunks_) {
+    // The chunk belongs to the other buffer, or the handle is invalid.
+    return nullptr;
+  }
+  Mutex::ScopedLock scoped_lock(shards_[shard].mutex);
+  if (chunk_index >= total_chunks_.load() ||
+      chunk_owners_[chunk_index].load() != shard) {
+    // The chunk is outside the current range of chunks loaded in memory, or
+    // has been claimed by another shard since; either way it has already
+    // been flushed and is no longer in memory.
     return nullptr;
   }
   auto& chunk = chunks_[chunk_index];
@@ -52,40 +108,49 @@ TraceObject* InternalTraceBuffer::GetEventByHandle(uint64_t handle) {
 }
 
 void InternalTraceBuffer::Flush(bool blocking) {
-  {
-    Mutex::ScopedLock scoped_lock(mutex_);
-    if (total_chunks_ > 0) {
-      flushing_ = true;
-      for (size_t i = 0; i < total_chunks_; ++i) {
-        auto& chunk = chunks_[i];
-        for (size_t j = 0; j < chunk->size(); ++j) {
-          TraceObject* trace_event = chunk->GetEventAt(j);
-          // Another thread may have added a trace that is yet to be
-          // initialized. Skip such traces.
-          // https://github.com/nodejs/node/issues/21038.
-          if (trace_event->name()) {
-            agent_->AppendTraceEvent(trace_event);
-          }
+  for (Shard& shard : shards_)
+    shard.mutex.Lock();
+  size_t total_chunks = total_chunks_.load();
+  if (total_chunks > 0) {
+    flushing_ = true;
+    for (size_t i = 0; i < total_chunks; ++i) {
+      auto& chunk = chunks_[i];
+      for (size_t j = 0; j < chunk->size(); ++j) {
+        TraceObject* trace_event = chunk->GetEventAt(j);
+        // Another thread may have added a trace that is yet to be
+        // initialized. Skip such traces.
+        // https://github.com/nodejs/node/issues/21038.
+        if (trace_event->name()) {
+          agent_->AppendTraceEvent(trace_event);
         }
       }
-      total_chunks_ = 0;
-      flushing_ = false;
+      chunk_owners_[i].store(kNoShard);
     }
+    for (Shard& shard : shards_)
+      shard.chunk_index = kNoChunk;
+    total_chunks_.store(0);
+    flushing_ = false;
   }
+  for (Shard& shard : shards_)
+    shard.mutex.Unlock();
   agent_->Flush(blocking);
 }
 
 uint64_t InternalTraceBuffer::MakeHandle(
-    size_t chunk_index, uint32_t chunk_seq, size_t event_index) const {
-  return ((static_cast<uint64_t>(chunk_seq) * Capacity() +
-          chunk_index * TraceBufferChunk::kChunkSize + event_index) << 1) + id_;
+    size_t shard, size_t chunk_index, uint32_t chunk_seq,
+    size_t event_index) const {
+  return (((static_cast<uint64_t>(chunk_seq) * Capacity() +
+           chunk_index * TraceBufferChunk::kChunkSize + event_index) *
+          kShards + shard) << 1) + id_;
 }
 
 void InternalTraceBuffer::ExtractHandle(
-    uint64_t handle, uint32_t* buffer_id, size_t* chunk_index,
+    uint64_t handle, uint32_t* buffer_id, size_t* shard, size_t* chunk_index,
     uint32_t* chunk_seq, size_t* event_index) const {
   *buffer_id = static_cast<uint32_t>(handle & 0x1);
   handle >>= 1;
+  *shard = handle % kShards;
+  handle /= kShards;
   *chunk_seq = static_cast<uint32_t>(handle / Capacity());
   size_t indices = handle % Capacity();
   *chunk_index = indices / TraceBufferChunk::kChunkSize;
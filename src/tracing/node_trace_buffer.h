@@ -17,6 +17,10 @@ using v8::platform::tracing::TraceObject;
 // forward declaration
 class NodeTraceBuffer;
 
+// Events are added to per-thread shards, each with its own lock and its own
+// current chunk, so that threads do not contend with each other; only the
+// flush takes all of the locks. Chunks are claimed from a pool shared by all
+// shards.
 class InternalTraceBuffer {
  public:
   InternalTraceBuffer(size_t max_chunks, uint32_t id, Agent* agent);
@@ -25,26 +29,43 @@ class InternalTraceBuffer {
   TraceObject* GetEventByHandle(uint64_t handle);
   void Flush(bool blocking);
   bool IsFull() const {
-    return total_chunks_ == max_chunks_ && chunks_[total_chunks_ - 1]->IsFull();
+    return total_chunks_.load() == max_chunks_;
   }
   bool IsFlushing() const {
     return flushing_;
   }
 
+  static const size_t kShards = 8;
+
  private:
-  uint64_t MakeHandle(size_t chunk_index, uint32_t chunk_seq,
+  struct Shard {
+    Mutex mutex;
+    // Index of the chunk that this shard is filling, or kNoChunk.
+    size_t chunk_index;
+  };
+  static const size_t kNoChunk = static_cast<size_t>(-1);
+  static const uint8_t kNoShard = 0xff;
+
+  static size_t CurrentShard();
+  bool ClaimChunk(size_t* chunk_index);
+
+  uint64_t MakeHandle(size_t shard, size_t chunk_index, uint32_t chunk_seq,
                       size_t event_index) const;
-  void ExtractHandle(uint64_t handle, uint32_t* buffer_id, size_t* chunk_index,
-                     uint32_t* chunk_seq, size_t* event_index) const;
+  void ExtractHandle(uint64_t handle, uint32_t* buffer_id, size_t* shard,
+                     size_t* chunk_index, uint32_t* chunk_seq,
+                     size_t* event_index) const;
   size_t Capacity() const { return max_chunks_ * TraceBufferChunk::kChunkSize; }
 
-  Mutex mutex_;
+  Shard shards_[kShards];
   bool flushing_;
   size_t max_chunks_;
   Agent* agent_;
   std::vector<std::unique_ptr<TraceBufferChunk>> chunks_;
-  size_t total_chunks_ = 0;
-  uint32_t current_chunk_seq_ = 1;
+  // The shard that claimed each chunk. A chunk is only modified while its
+  // owner's lock is held, or while all of the locks are held.
+  std::unique_ptr<std::atomic<uint8_t>[]> chunk_owners_;
+  std::atomic<size_t> total_chunks_{0};
+  std::atomic<uint32_t> current_chunk_seq_{1};
   uint32_t id_;
 };
 
@@ -3,13 +3,200 @@
 #include <string.h>
 #include <fcntl.h>
 
+#include <unordered_map>
+
+#include "tracing/trace_event_common.h"
 #include "util-inl.h"
 
 namespace node {
 namespace tracing {
 
-NodeTraceWriter::NodeTraceWriter(const std::string& log_file_pattern)
-    : log_file_pattern_(log_file_pattern) {}
+namespace {
+
+// Writes trace events as the length-prefixed binary records described in
+// doc/api/tracing.md. Category, event, scope and argument names are written
+// once per file and referred to by id afterwards.
+class BinaryTraceWriter : public TraceWriter {
+ public:
+  explicit BinaryTraceWriter(std::ostream& stream) : stream_(stream) {
+    stream_.write(kMagic, sizeof(kMagic));
+  }
+
+  void AppendTraceEvent(TraceObject* trace_event) override;
+  void Flush() override {}
+
+ private:
+  static constexpr char kMagic[8] = { 'N', 'O', 'D', 'E', 'T', 'R', 'C', 1 };
+  // Past this many distinct strings in one file, the rest are written inline.
+  static const size_t kMaxInternedStrings = 1 << 16;
+
+  enum RecordType : uint8_t {
+    kStringRecord = 1,
+    kEventRecord = 2
+  };
+
+  uint64_t InternString(const char* str);
+  void WriteStringRef(uint64_t id, const char* str);
+  void WriteString(const char* str, size_t length);
+  void WriteVarint(uint64_t value);
+  void WriteSignedVarint(int64_t value);
+  void WriteByte(uint8_t value) { record_.push_back(value); }
+
+  std::ostream& stream_;
+  // The record being assembled, so that each one takes a single write().
+  std::string record_;
+  std::unordered_map<std::string, uint64_t> strings_;
+  int64_t last_ts_ = 0;
+  int64_t last_tts_ = 0;
+};
+
+constexpr char BinaryTraceWriter::kMagic[8];
+
+void BinaryTraceWriter::AppendTraceEvent(TraceObject* trace_event) {
+  const char* category =
+      v8::platform::tracing::TracingController::GetCategoryGroupName(
+          trace_event->category_enabled_flag());
+  const char* scope = nullptr;
+  if (trace_event->flags() & TRACE_EVENT_FLAG_HAS_ID)
+    scope = trace_event->scope();
+  const int num_args = trace_event->num_args();
+  const char** arg_names = trace_event->arg_names();
+
+  // Any new strings get their own records ahead of the event.
+  uint64_t category_id = InternString(category);
+  uint64_t name_id = InternString(trace_event->name());
+  uint64_t scope_id = scope != nullptr ? InternString(scope) : 0;
+  uint64_t arg_name_ids[v8::platform::tracing::kTraceMaxNumArgs];
+  for (int i = 0; i < num_args; ++i)
+    arg_name_ids[i] = InternString(arg_names[i]);
+
+  WriteByte(kEventRecord);
+  WriteByte(trace_event->phase());
+  WriteStringRef(category_id, category);
+  WriteStringRef(name_id, trace_event->name());
+  WriteVarint(trace_event->pid());
+  WriteVarint(trace_event->tid());
+  // Timestamps are mostly increasing, so store the difference to the
+  // previous event's.
+  WriteSignedVarint(trace_event->ts() - last_ts_);
+  WriteSignedVarint(trace_event->tts() - last_tts_);
+  last_ts_ = trace_event->ts();
+  last_tts_ = trace_event->tts();
+  WriteVarint(trace_event->duration());
+  WriteVarint(trace_event->cpu_duration());
+
+  uint8_t flags = 0;
+  if (trace_event->flags() & TRACE_EVENT_FLAG_HAS_ID)
+    flags |= 1;
+  if (scope != nullptr)
+    flags |= 2;
+  WriteByte(flags);
+  if (scope != nullptr)
+    WriteStringRef(scope_id, scope);
+  if (flags & 1)
+    WriteVarint(trace_event->id());
+
+  const uint8_t* arg_types = trace_event->arg_types();
+  TraceObject::ArgValue* arg_values = trace_event->arg_values();
+  WriteByte(num_args);
+  for (int i = 0; i < num_args; ++i) {
+    WriteStringRef(arg_name_ids[i], arg_names[i]);
+    WriteByte(arg_types[i]);
+    const TraceObject::ArgValue& value = arg_values[i];
+    switch (arg_types[i]) {
+      case TRACE_VALUE_TYPE_BOOL:
+        WriteByte(value.as_bool ? 1 : 0);
+        break;
+      case TRACE_VALUE_TYPE_UINT:
+        WriteVarint(value.as_uint);
+        break;
+      case TRACE_VALUE_TYPE_INT:
+        WriteSignedVarint(value.as_int);
+        break;
+      case TRACE_VALUE_TYPE_DOUBLE: {
+        uint64_t bits;
+        memcpy(&bits, &value.as_double, sizeof(bits));
+        for (int j = 0; j < 8; ++j)
+          WriteByte(static_cast<uint8_t>(bits >> (j * 8)));
+        break;
+      }
+      case TRACE_VALUE_TYPE_POINTER:
+        WriteVarint(reinterpret_cast<uintptr_t>(value.as_pointer));
+        break;
+      case TRACE_VALUE_TYPE_STRING:
+      case TRACE_VALUE_TYPE_COPY_STRING:
+        if (value.as_string == nullptr)
+          WriteString("", 0);
+        else
+          WriteString(value.as_string, strlen(value.as_string));
+        break;
+      case TRACE_VALUE_TYPE_CONVERTABLE: {
+#ifdef NODE_ENGINE_CHAKRACORE
+        // ChakraCore's TraceObject converts these to JSON up front.
+        WriteString(value.as_string, strlen(value.as_string));
+#else
+        std::string json;
+        trace_event->arg_convertables()[i]->AppendAsTraceFormat(&json);
+        WriteString(json.data(), json.size());
+#endif
+        break;
+      }
+      default:
+        UNREACHABLE();
+    }
+  }
+
+  stream_.write(record_.data(), record_.size());
+  record_.clear();
+}
+
+uint64_t BinaryTraceWriter::InternString(const char* str) {
+  auto it = strings_.find(str);
+  if (it != strings_.end())
+    return it->second;
+  if (strings_.size() == kMaxInternedStrings)
+    return 0;
+
+  uint64_t id = strings_.size() + 1;
+  strings_.emplace(str, id);
+  WriteByte(kStringRecord);
+  WriteVarint(id);
+  WriteString(str, strlen(str));
+  stream_.write(record_.data(), record_.size());
+  record_.clear();
+  return id;
+}
+
+void BinaryTraceWriter::WriteStringRef(uint64_t id, const char* str) {
+  WriteVarint(id);
+  if (id == 0)
+    WriteString(str, strlen(str));
+}
+
+void BinaryTraceWriter::WriteString(const char* str, size_t length) {
+  WriteVarint(length);
+  record_.append(str, length);
+}
+
+void BinaryTraceWriter::WriteVarint(uint64_t value) {
+  while (value >= 0x80) {
+    WriteByte(static_cast<uint8_t>(value) | 0x80);
+    value >>= 7;
+  }
+  WriteByte(static_cast<uint8_t>(value));
+}
+
+void BinaryTraceWriter::WriteSignedVarint(int64_t value) {
+  // ZigZag encoding, so that small negative numbers stay short.
+  WriteVarint((static_cast<uint64_t>(value) << 1) ^
+              static_cast<uint64_t>(value >> 63));
+}
+
+}  // namespace
+
+NodeTraceWriter::NodeTraceWriter(const std::string& log_file_pattern,
+                                 Format format)
+    : log_file_pattern_(log_file_pattern), format_(format) {}
 
 void NodeTraceWriter::InitializeOnThread(uv_loop_t* loop) {
   CHECK_NULL(tracing_loop_);
@@ -102,15 +289,18 @@ void NodeTraceWriter::AppendTraceEvent(TraceObject* trace_event) {
   if (total_traces_ == 0) {
     OpenNewFileForStreaming();
     // Constructing a new JSONTraceWriter object appends "{\"traceEvents\":["
-    // to stream_.
+    // to stream_, and a BinaryTraceWriter writes the file's magic number.
     // In other words, the constructor initializes the serialization stream
     // to a state where we can start writing trace events to it.
-    // Repeatedly constructing and destroying json_trace_writer_ allows
+    // Repeatedly constructing and destroying trace_writer_ allows
     // us to use V8's JSON writer instead of implementing our own.
-    json_trace_writer_.reset(TraceWriter::CreateJSONTraceWriter(stream_));
+    if (format_ == kBinary)
+      trace_writer_.reset(new BinaryTraceWriter(stream_));
+    else
+      trace_writer_.reset(TraceWriter::CreateJSONTraceWriter(stream_));
   }
   ++total_traces_;
-  json_trace_writer_->AppendTraceEvent(trace_event);
+  trace_writer_->AppendTraceEvent(trace_event);
 }
 
 void NodeTraceWriter::FlushPrivate() {
@@ -122,7 +312,7 @@ void NodeTraceWriter::FlushPrivate() {
       total_traces_ = 0;
       // Destroying the member JSONTraceWriter object appends "]}" to
       // stream_ - in other words, ending a JSON file.
-      json_trace_writer_.reset();
+      trace_writer_.reset();
     }
     // str() makes a copy of the contents of the stream.
     str = stream_.str();
@@ -138,7 +328,7 @@ void NodeTraceWriter::FlushPrivate() {
 
 void NodeTraceWriter::Flush(bool blocking) {
   Mutex::ScopedLock scoped_lock(request_mutex_);
-  if (!json_trace_writer_) {
+  if (!trace_writer_) {
     return;
   }
   int request_id = ++num_write_requests_;
@@ -16,7 +16,12 @@ using v8::platform::tracing::TraceWriter;
 
 class NodeTraceWriter : public AsyncTraceWriter {
  public:
-  explicit NodeTraceWriter(const std::string& log_file_pattern);
+  // The format of the trace files. kBinary is the compact format described
+  // in doc/api/tracing.md.
+  enum Format { kJSON, kBinary };
+
+  explicit NodeTraceWriter(const std::string& log_file_pattern,
+                           Format format = kJSON);
   ~NodeTraceWriter();
 
   void InitializeOnThread(uv_loop_t* loop) override;
@@ -62,8 +67,9 @@ class NodeTraceWriter : public AsyncTraceWriter {
   int total_traces_ = 0;
   int file_num_ = 0;
   std::string log_file_pattern_;
+  Format format_;
   std::ostringstream stream_;
-  std::unique_ptr<TraceWriter> json_trace_writer_;
+  std::unique_ptr<TraceWriter> trace_writer_;
   bool exited_ = false;
 };
 
@@ -76,16 +76,72 @@ inline bool SendWrap::have_callback() const {
 }
 
 
-UDPWrap::UDPWrap(Environment* env, Local<Object> object)
+// One request for a whole sendBatch() call. The first datagram uses the
+// embedded req_, the others use extra_reqs_; all of them point back here
+// through their data field and the JS callback runs when the last completes.
+class BatchSendWrap : public ReqWrap<uv_udp_send_t> {
+ public:
+  BatchSendWrap(Environment* env,
+                Local<Object> req_wrap_obj,
+                size_t count,
+                bool have_callback);
+  inline bool have_callback() const;
+  inline uv_udp_send_t* req_at(size_t index);
+  size_t msg_size = 0;
+  size_t pending = 0;
+  int status = 0;
+
+  SET_NO_MEMORY_INFO()
+  SET_MEMORY_INFO_NAME(BatchSendWrap)
+  SET_SELF_SIZE(BatchSendWrap)
+
+ private:
+  const bool have_callback_;
+  std::unique_ptr<uv_udp_send_t[]> extra_reqs_;
+};
+
+
+BatchSendWrap::BatchSendWrap(Environment* env,
+                             Local<Object> req_wrap_obj,
+                             size_t count,
+                             bool have_callback)
+    : ReqWrap(env, req_wrap_obj, AsyncWrap::PROVIDER_UDPSENDWRAP),
+      have_callback_(have_callback),
+      extra_reqs_(count > 1 ? new uv_udp_send_t[count - 1] : nullptr) {
+}
+
+
+inline bool BatchSendWrap::have_callback() const {
+  return have_callback_;
+}
+
+
+inline uv_udp_send_t* BatchSendWrap::req_at(size_t index) {
+  return index == 0 ? req() : &extra_reqs_[index - 1];
+}
+
+
+UDPWrap::UDPWrap(Environment* env, Local<Object> object, bool recv_batch)
     : HandleWrap(env,
                  object,
                  reinterpret_cast<uv_handle_t*>(&handle_),
                  AsyncWrap::PROVIDER_UDPWRAP) {
-  int r = uv_udp_init(env->event_loop(), &handle_);
+  unsigned int flags = AF_UNSPEC;
+  if (recv_batch)
+    flags |= UV_UDP_RECVMMSG;
+  int r = uv_udp_init_ex(env->event_loop(), &handle_, flags);
   CHECK_EQ(r, 0);  // can't fail anyway
 }
 
 
+UDPWrap::~UDPWrap() {
+  // Datagrams left over if the handle was closed in the middle of a batch.
+  for (const PendingMessage& message : pending_messages_)
+    free(message.data);
+  free(batch_buf_);
+}
+
+
 void UDPWrap::Initialize(Local<Object> target,
                          Local<Value> unused,
                          Local<Context> context,
@@ -119,6 +175,8 @@ void UDPWrap::Initialize(Local<Object> target,
   env->SetProtoMethod(t, "send", Send);
   env->SetProtoMethod(t, "bind6", Bind6);
   env->SetProtoMethod(t, "send6", Send6);
+  env->SetProtoMethod(t, "sendBatch", SendBatch);
+  env->SetProtoMethod(t, "sendBatch6", SendBatch6);
   env->SetProtoMethod(t, "recvStart", RecvStart);
   env->SetProtoMethod(t, "recvStop", RecvStop);
   env->SetProtoMethod(t, "getsockname",
@@ -162,7 +220,7 @@ void UDPWrap::Initialize(Local<Object> target,
 void UDPWrap::New(const FunctionCallbackInfo<Value>& args) {
   CHECK(args.IsConstructCall());
   Environment* env = Environment::GetCurrent(args);
-  new UDPWrap(env, args.This());
+  new UDPWrap(env, args.This(), args[0]->IsTrue());
 }
 
 
@@ -434,6 +492,113 @@ void UDPWrap::Send6(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+void UDPWrap::DoSendBatch(const FunctionCallbackInfo<Value>& args,
+                          int family) {
+  Environment* env = Environment::GetCurrent(args);
+
+  UDPWrap* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap,
+                          args.Holder(),
+                          args.GetReturnValue().Set(UV_EBADF));
+
+  // sendBatch(req, msgs, msgs.length, ports, addresses, hasCallback)
+  CHECK(args[0]->IsObject());
+  CHECK(args[1]->IsArray());
+  CHECK(args[2]->IsUint32());
+  CHECK(args[3]->IsArray());
+  CHECK(args[4]->IsArray());
+  CHECK(args[5]->IsBoolean());
+
+  Local<Context> context = env->context();
+  Local<Object> req_wrap_obj = args[0].As<Object>();
+  Local<Array> msgs = args[1].As<Array>();
+  size_t count = args[2].As<Uint32>()->Value();
+  Local<Array> ports = args[3].As<Array>();
+  Local<Array> addresses = args[4].As<Array>();
+  const bool have_callback = args[5]->IsTrue();
+  CHECK_GT(count, 0);
+
+  BatchSendWrap* req_wrap;
+  {
+    AsyncHooks::DefaultTriggerAsyncIdScope trigger_scope(wrap);
+    req_wrap = new BatchSendWrap(env, req_wrap_obj, count, have_callback);
+  }
+  req_wrap->Dispatched();
+
+  // Queue everything before writing anything, so that libuv can hand the
+  // datagrams to the kernel with as few system calls as possible.
+  uv_udp_cork(&wrap->handle_);
+
+  for (size_t i = 0; i < count; i++) {
+    Local<Value> msg = msgs->Get(context, i).ToLocalChecked();
+    Local<Value> port_value = ports->Get(context, i).ToLocalChecked();
+    Local<Value> address_value = addresses->Get(context, i).ToLocalChecked();
+    CHECK(port_value->IsUint32());
+    CHECK(address_value->IsString());
+
+    const unsigned short port = port_value.As<Uint32>()->Value();
+    node::Utf8Value address(env->isolate(), address_value);
+    uv_buf_t buf = uv_buf_init(Buffer::Data(msg), Buffer::Length(msg));
+
+    char addr[sizeof(sockaddr_in6)];
+    int err;
+
+    switch (family) {
+    case AF_INET:
+      err = uv_ip4_addr(*address, port, reinterpret_cast<sockaddr_in*>(&addr));
+      break;
+    case AF_INET6:
+      err = uv_ip6_addr(*address,
+                        port,
+                        reinterpret_cast<sockaddr_in6*>(&addr));
+      break;
+    default:
+      CHECK(0 && "unexpected address family");
+      ABORT();
+    }
+
+    if (err == 0) {
+      uv_udp_send_t* req = req_wrap->req_at(i);
+      req->data = req_wrap;
+      err = uv_udp_send(req,
+                        &wrap->handle_,
+                        &buf,
+                        1,
+                        reinterpret_cast<const sockaddr*>(&addr),
+                        OnBatchSend);
+    }
+
+    if (err == 0) {
+      env->IncreaseWaitingRequestCounter();
+      req_wrap->pending++;
+      req_wrap->msg_size += buf.len;
+    } else if (req_wrap->status == 0) {
+      req_wrap->status = err;
+    }
+  }
+
+  uv_udp_uncork(&wrap->handle_);
+
+  int err = 0;
+  if (req_wrap->pending == 0) {
+    err = req_wrap->status;
+    delete req_wrap;
+  }
+
+  args.GetReturnValue().Set(err);
+}
+
+
+void UDPWrap::SendBatch(const FunctionCallbackInfo<Value>& args) {
+  DoSendBatch(args, AF_INET);
+}
+
+
+void UDPWrap::SendBatch6(const FunctionCallbackInfo<Value>& args) {
+  DoSendBatch(args, AF_INET6);
+}
+
+
 void UDPWrap::RecvStart(const FunctionCallbackInfo<Value>& args) {
   UDPWrap* wrap;
   ASSIGN_OR_RETURN_UNWRAP(&wrap,
@@ -473,26 +638,120 @@ void UDPWrap::OnSend(uv_udp_send_t* req, int status) {
 }
 
 
+void UDPWrap::OnBatchSend(uv_udp_send_t* req, int status) {
+  BatchSendWrap* req_wrap = static_cast<BatchSendWrap*>(req->data);
+  Environment* env = req_wrap->env();
+  env->DecreaseWaitingRequestCounter();
+
+  if (status != 0 && req_wrap->status == 0)
+    req_wrap->status = status;
+
+  CHECK_GT(req_wrap->pending, 0);
+  if (--req_wrap->pending > 0)
+    return;
+
+  if (req_wrap->have_callback()) {
+    HandleScope handle_scope(env->isolate());
+    Context::Scope context_scope(env->context());
+    Local<Value> arg[] = {
+      Integer::New(env->isolate(), req_wrap->status),
+      Integer::New(env->isolate(), req_wrap->msg_size),
+    };
+    req_wrap->MakeCallback(env->oncomplete_string(), 2, arg);
+  }
+  delete req_wrap;
+}
+
+
 void UDPWrap::OnAlloc(uv_handle_t* handle,
                       size_t suggested_size,
                       uv_buf_t* buf) {
+  UDPWrap* wrap = static_cast<UDPWrap*>(handle->data);
+  if (uv_udp_using_recvmmsg(&wrap->handle_)) {
+    // The datagrams are copied out of the batch buffer before the next
+    // recvmmsg call, so one buffer per handle is enough.
+    if (wrap->batch_buf_ == nullptr) {
+      wrap->batch_buf_ = node::Malloc(suggested_size);
+      wrap->batch_buf_len_ = suggested_size;
+    }
+    buf->base = wrap->batch_buf_;
+    buf->len = wrap->batch_buf_len_;
+    return;
+  }
+
   buf->base = node::Malloc(suggested_size);
   buf->len = suggested_size;
 }
 
 
+void UDPWrap::FlushPendingMessages() {
+  if (pending_messages_.empty())
+    return;
+
+  // The callback may close the handle or start another batch.
+  std::vector<PendingMessage> messages;
+  messages.swap(pending_messages_);
+
+  Environment* env = this->env();
+  HandleScope handle_scope(env->isolate());
+  Local<Context> context = env->context();
+  Context::Scope context_scope(context);
+
+  Local<Array> buffers = Array::New(env->isolate(), messages.size());
+  Local<Array> rinfos = Array::New(env->isolate(), messages.size());
+  for (size_t i = 0; i < messages.size(); i++) {
+    const PendingMessage& message = messages[i];
+    Local<Value> buffer =
+        Buffer::New(env, message.data, message.length).ToLocalChecked();
+    Local<Value> rinfo =
+        AddressToJS(env, reinterpret_cast<const sockaddr*>(&message.addr));
+    buffers->Set(context, i, buffer).FromJust();
+    rinfos->Set(context, i, rinfo).FromJust();
+  }
+
+  Local<Value> argv[] = {
+    Integer::New(env->isolate(), messages.size()),
+    object(),
+    buffers,
+    rinfos
+  };
+  MakeCallback(env->onmessages_string(), arraysize(argv), argv);
+}
+
+
 void UDPWrap::OnRecv(uv_udp_t* handle,
                      ssize_t nread,
                      const uv_buf_t* buf,
                      const struct sockaddr* addr,
                      unsigned int flags) {
+  UDPWrap* wrap = static_cast<UDPWrap*>(handle->data);
+
+  if (flags & UV_UDP_MMSG_CHUNK) {
+    // buf points into batch_buf_, which the next recvmmsg call overwrites.
+    PendingMessage message;
+    message.data = node::Malloc(nread);
+    message.length = nread;
+    memcpy(message.data, buf->base, nread);
+    memset(&message.addr, 0, sizeof(message.addr));
+    memcpy(&message.addr, addr, sizeof(sockaddr_in6));
+    wrap->pending_messages_.push_back(message);
+    return;
+  }
+
+  wrap->FlushPendingMessages();
+
+  // The batch buffer is kept for the next recvmmsg call.
+  if (flags & UV_UDP_MMSG_FREE)
+    return;
+  const bool owns_buf =
+      buf->base != nullptr && buf->base != wrap->batch_buf_;
+
   if (nread == 0 && addr == nullptr) {
-    if (buf->base != nullptr)
+    if (owns_buf)
       free(buf->base);
     return;
   }
 
-  UDPWrap* wrap = static_cast<UDPWrap*>(handle->data);
   Environment* env = wrap->env();
 
   HandleScope handle_scope(env->isolate());
@@ -507,13 +766,19 @@ void UDPWrap::OnRecv(uv_udp_t* handle,
   };
 
   if (nread < 0) {
-    if (buf->base != nullptr)
+    if (owns_buf)
       free(buf->base);
     wrap->MakeCallback(env->onmessage_string(), arraysize(argv), argv);
     return;
   }
 
-  char* base = node::UncheckedRealloc(buf->base, nread);
+  char* base;
+  if (owns_buf) {
+    base = node::UncheckedRealloc(buf->base, nread);
+  } else {
+    base = node::Malloc(nread);
+    memcpy(base, buf->base, nread);
+  }
   argv[2] = Buffer::New(env, base, nread).ToLocalChecked();
   argv[3] = AddressToJS(env, addr);
   wrap->MakeCallback(env->onmessage_string(), arraysize(argv), argv);
@@ -57,3 +57,35 @@ assert.strictEqual(test_object.hasNamedProperty(test_object, 'hiddenValue'),
                    true);
 assert.strictEqual(test_object.hasNamedProperty(test_object, 'doesnotexist'),
                    false);
+
+// Getting and setting several named properties at once
+const row = { id: 1, name: 'a', get upper() { return this.name.toUpperCase(); } };
+assert.deepStrictEqual(
+  test_object.getNamedProperties(row, ['id', 'name', 'upper', 'missing']),
+  [1, 'a', 'A', undefined]);
+assert.deepStrictEqual(test_object.getNamedProperties(row, []), []);
+
+test_object.setNamedProperties(row, ['name', 'extra'], ['b', true]);
+assert.strictEqual(row.name, 'b');
+assert.strictEqual(row.extra, true);
+assert.strictEqual(row.upper, 'B');
+
+// More names than are converted at once, some of them repeated
+const manyNames = [];
+const manyValues = [];
+for (let i = 0; i < 40; i++) {
+  manyNames.push(`field${i % 35}`);
+  manyValues.push(i);
+}
+const many = {};
+test_object.setNamedProperties(many, manyNames, manyValues);
+assert.strictEqual(Object.keys(many).length, 35);
+assert.strictEqual(many.field0, 35);
+assert.strictEqual(many.field34, 34);
+assert.deepStrictEqual(test_object.getNamedProperties(many, manyNames),
+                       manyNames.map((name) => many[name]));
+
+// Sets follow strict mode rules
+assert.throws(() => {
+  test_object.setNamedProperties(test_object, ['readonlyValue'], [3]);
+}, readonlyErrorRE);
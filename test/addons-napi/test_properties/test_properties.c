@@ -1,3 +1,4 @@
+#define NAPI_EXPERIMENTAL
 #include <node_api.h>
 #include "../common.h"
 
@@ -59,6 +60,79 @@ static napi_value HasNamedProperty(napi_env env, napi_callback_info info) {
   return result;
 }
 
+#define MAX_NAMES 40
+
+// Reads an array of up to MAX_NAMES property names into buffers
+static bool GetNames(napi_env env,
+                     napi_value array,
+                     char buffers[MAX_NAMES][64],
+                     const char* names[MAX_NAMES],
+                     uint32_t* count) {
+  NAPI_CALL_BASE(env, napi_get_array_length(env, array, count), false);
+  NAPI_ASSERT_BASE(env, *count <= MAX_NAMES, "Too many names", false);
+
+  for (uint32_t i = 0; i < *count; i++) {
+    napi_value name;
+    size_t copied;
+    NAPI_CALL_BASE(env, napi_get_element(env, array, i, &name), false);
+    NAPI_CALL_BASE(env, napi_get_value_string_utf8(
+        env, name, buffers[i], sizeof(buffers[i]), &copied), false);
+    names[i] = buffers[i];
+  }
+  return true;
+}
+
+static napi_value GetNamedProperties(napi_env env, napi_callback_info info) {
+  size_t argc = 2;
+  napi_value args[2];
+  NAPI_CALL(env, napi_get_cb_info(env, info, &argc, args, NULL, NULL));
+
+  NAPI_ASSERT(env, argc == 2, "Wrong number of arguments");
+
+  char buffers[MAX_NAMES][64];
+  const char* names[MAX_NAMES];
+  uint32_t count;
+  if (!GetNames(env, args[1], buffers, names, &count)) {
+    return NULL;
+  }
+
+  napi_value values[MAX_NAMES];
+  NAPI_CALL(env,
+      napi_get_named_properties(env, args[0], count, names, values));
+
+  napi_value result;
+  NAPI_CALL(env, napi_create_array_with_length(env, count, &result));
+  for (uint32_t i = 0; i < count; i++) {
+    NAPI_CALL(env, napi_set_element(env, result, i, values[i]));
+  }
+
+  return result;
+}
+
+static napi_value SetNamedProperties(napi_env env, napi_callback_info info) {
+  size_t argc = 3;
+  napi_value args[3];
+  NAPI_CALL(env, napi_get_cb_info(env, info, &argc, args, NULL, NULL));
+
+  NAPI_ASSERT(env, argc == 3, "Wrong number of arguments");
+
+  char buffers[MAX_NAMES][64];
+  const char* names[MAX_NAMES];
+  uint32_t count;
+  if (!GetNames(env, args[1], buffers, names, &count)) {
+    return NULL;
+  }
+
+  napi_value values[MAX_NAMES];
+  for (uint32_t i = 0; i < count; i++) {
+    NAPI_CALL(env, napi_get_element(env, args[2], i, &values[i]));
+  }
+  NAPI_CALL(env,
+      napi_set_named_properties(env, args[0], count, names, values));
+
+  return NULL;
+}
+
 static napi_value Init(napi_env env, napi_value exports) {
   napi_value number;
   NAPI_CALL(env, napi_create_double(env, value_, &number));
@@ -91,6 +165,8 @@ static napi_value Init(napi_env env, napi_value exports) {
     { "readonlyAccessor1", 0, 0, GetValue, NULL, 0, napi_default, 0},
     { "readonlyAccessor2", 0, 0, GetValue, NULL, 0, napi_writable, 0},
     { "hasNamedProperty", 0, HasNamedProperty, 0, 0, 0, napi_default, 0 },
+    { "getNamedProperties", 0, GetNamedProperties, 0, 0, 0, napi_default, 0 },
+    { "setNamedProperties", 0, SetNamedProperties, 0, 0, 0, napi_default, 0 },
   };
 
   NAPI_CALL(env, napi_define_properties(
@@ -46,9 +46,7 @@ const str4 = '¡¢£¤¥¦§¨©ª«¬­®¯°±²³´µ¶·¸¹º»¼½¾¿';
 assert.strictEqual(test_string.TestLatin1(str4), str4);
 assert.strictEqual(test_string.TestUtf8(str4), str4);
 assert.strictEqual(test_string.TestUtf16(str4), str4);
-// TODO: https://github.com/nodejs/abi-stable-node/issues/235
-// assert.strictEqual(
-//   test_string.TestLatin1Insufficient(str4), str4.slice(0, 3));
+assert.strictEqual(test_string.TestLatin1Insufficient(str4), str4.slice(0, 3));
 assert.strictEqual(test_string.TestUtf8Insufficient(str4), str4.slice(0, 1));
 assert.strictEqual(test_string.TestUtf16Insufficient(str4), str4.slice(0, 3));
 assert.strictEqual(test_string.Utf16Length(str4), 31);
@@ -58,9 +56,7 @@ const str5 = 'ÀÁÂÃÄÅÆÇÈÉÊËÌÍÎÏÐÑÒÓÔÕÖ×ØÙÚÛÜÝÞßà
 assert.strictEqual(test_string.TestLatin1(str5), str5);
 assert.strictEqual(test_string.TestUtf8(str5), str5);
 assert.strictEqual(test_string.TestUtf16(str5), str5);
-// TODO: https://github.com/nodejs/abi-stable-node/issues/235
-// assert.strictEqual(
-//   test_string.TestLatin1Insufficient(str5), str5.slice(0, 3));
+assert.strictEqual(test_string.TestLatin1Insufficient(str5), str5.slice(0, 3));
 assert.strictEqual(test_string.TestUtf8Insufficient(str5), str5.slice(0, 1));
 assert.strictEqual(test_string.TestUtf16Insufficient(str5), str5.slice(0, 3));
 assert.strictEqual(test_string.Utf16Length(str5), 63);
@@ -74,6 +70,15 @@ assert.strictEqual(test_string.TestUtf16Insufficient(str6), str6.slice(0, 3));
 assert.strictEqual(test_string.Utf16Length(str6), 5);
 assert.strictEqual(test_string.Utf8Length(str6), 14);
 
+// External strings, both short ones and ones long enough to stay external
+for (const str of [empty, str1, str4, str5, str5.repeat(4)]) {
+  assert.strictEqual(test_string.TestExternalLatin1(str), str);
+  assert.strictEqual(test_string.TestExternalUtf16(str), str);
+}
+for (const str of [str6, str6.repeat(20)]) {
+  assert.strictEqual(test_string.TestExternalUtf16(str), str);
+}
+
 // JSRT's JsCreateString happily takes in size_t lengths, while V8's doesn't
 // The TestLargeUtf8 function expects a fail fast here that Chakra doesn't need
 if (!common.isChakraEngine) {
@@ -1,4 +1,7 @@
+#define NAPI_EXPERIMENTAL
 #include <limits.h>  // INT_MAX
+#include <stdlib.h>
+#include <string.h>
 #include <node_api.h>
 #include "../common.h"
 
@@ -216,6 +219,67 @@ static napi_value TestLargeUtf8(napi_env env, napi_callback_info info) {
   return output;
 }
 
+static int finalize_count = 0;
+
+static void FinalizeExternalString(napi_env env, void* data, void* hint) {
+  free(data);
+  finalize_count++;
+}
+
+static napi_value TestExternalLatin1(napi_env env, napi_callback_info info) {
+  size_t argc = 1;
+  napi_value args[1];
+  NAPI_CALL(env, napi_get_cb_info(env, info, &argc, args, NULL, NULL));
+
+  NAPI_ASSERT(env, argc >= 1, "Wrong number of arguments");
+
+  size_t length;
+  NAPI_CALL(env,
+      napi_get_value_string_latin1(env, args[0], NULL, 0, &length));
+
+  char* buffer = (char*)malloc(length + 1);
+  NAPI_ASSERT(env, buffer != NULL, "Out of memory");
+  NAPI_CALL(env,
+      napi_get_value_string_latin1(env, args[0], buffer, length + 1, NULL));
+
+  napi_value output;
+  bool copied;
+  NAPI_CALL(env, node_api_create_external_string_latin1(
+      env, buffer, length, FinalizeExternalString, NULL, &output, &copied));
+
+  return output;
+}
+
+static napi_value TestExternalUtf16(napi_env env, napi_callback_info info) {
+  size_t argc = 1;
+  napi_value args[1];
+  NAPI_CALL(env, napi_get_cb_info(env, info, &argc, args, NULL, NULL));
+
+  NAPI_ASSERT(env, argc >= 1, "Wrong number of arguments");
+
+  size_t length;
+  NAPI_CALL(env,
+      napi_get_value_string_utf16(env, args[0], NULL, 0, &length));
+
+  char16_t* buffer = (char16_t*)malloc((length + 1) * sizeof(char16_t));
+  NAPI_ASSERT(env, buffer != NULL, "Out of memory");
+  NAPI_CALL(env,
+      napi_get_value_string_utf16(env, args[0], buffer, length + 1, NULL));
+
+  napi_value output;
+  bool copied;
+  NAPI_CALL(env, node_api_create_external_string_utf16(
+      env, buffer, length, FinalizeExternalString, NULL, &output, &copied));
+
+  return output;
+}
+
+static napi_value FinalizeCount(napi_env env, napi_callback_info info) {
+  napi_value output;
+  NAPI_CALL(env, napi_create_int32(env, finalize_count, &output));
+  return output;
+}
+
 static napi_value Init(napi_env env, napi_value exports) {
   napi_property_descriptor properties[] = {
     DECLARE_NAPI_PROPERTY("TestLatin1", TestLatin1),
@@ -227,6 +291,9 @@ static napi_value Init(napi_env env, napi_value exports) {
     DECLARE_NAPI_PROPERTY("Utf16Length", Utf16Length),
     DECLARE_NAPI_PROPERTY("Utf8Length", Utf8Length),
     DECLARE_NAPI_PROPERTY("TestLargeUtf8", TestLargeUtf8),
+    DECLARE_NAPI_PROPERTY("TestExternalLatin1", TestExternalLatin1),
+    DECLARE_NAPI_PROPERTY("TestExternalUtf16", TestExternalUtf16),
+    DECLARE_NAPI_PROPERTY("FinalizeCount", FinalizeCount),
   };
 
   NAPI_CALL(env, napi_define_properties(
@@ -0,0 +1,52 @@
+#include <node.h>
+#include <v8.h>
+
+namespace {
+
+int payload = 42;
+
+// The interceptors make the instances proxies on ChakraCore.
+inline void NamedGetter(v8::Local<v8::Name> name,
+                        const v8::PropertyCallbackInfo<v8::Value>& info) {
+  auto isolate = info.GetIsolate();
+  if (name->StrictEquals(v8::String::NewFromUtf8(
+        isolate, "intercepted", v8::NewStringType::kNormal)
+            .ToLocalChecked())) {
+    info.GetReturnValue().Set(true);
+  }
+}
+
+inline void New(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  auto isolate = args.GetIsolate();
+  auto context = isolate->GetCurrentContext();
+  auto tmpl = v8::ObjectTemplate::New(isolate);
+  tmpl->SetInternalFieldCount(2);
+  tmpl->SetHandler(v8::NamedPropertyHandlerConfiguration(NamedGetter));
+
+  auto object = tmpl->NewInstance(context).ToLocalChecked();
+  object->SetAlignedPointerInInternalField(0, &payload);
+  object->SetInternalField(1, args[0]);
+  args.GetReturnValue().Set(object);
+}
+
+inline void GetFields(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  auto isolate = args.GetIsolate();
+  auto context = isolate->GetCurrentContext();
+  auto object = args[0].As<v8::Object>();
+  assert(object->InternalFieldCount() == 2);
+  assert(object->GetAlignedPointerFromInternalField(0) == &payload);
+
+  auto result = v8::Array::New(isolate, 2);
+  result->Set(context, 0, v8::Integer::New(isolate, payload)).FromJust();
+  result->Set(context, 1, object->GetInternalField(1)).FromJust();
+  args.GetReturnValue().Set(result);
+}
+
+inline void Initialize(v8::Local<v8::Object> exports) {
+  NODE_SET_METHOD(exports, "create", New);
+  NODE_SET_METHOD(exports, "getFields", GetFields);
+}
+
+NODE_MODULE(NODE_GYP_MODULE_NAME, Initialize)
+
+}  // anonymous namespace
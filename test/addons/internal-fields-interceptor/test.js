@@ -0,0 +1,15 @@
+'use strict';
+
+const common = require('../../common');
+const assert = require('assert');
+const binding = require(`./build/${common.buildType}/binding`);
+
+// The internal fields of objects from ObjectTemplates with interceptors are
+// reachable from native code.
+const value = { some: 'value' };
+const object = binding.create(value);
+assert.strictEqual(object.intercepted, true);
+
+const [payload, stored] = binding.getFields(object);
+assert.strictEqual(payload, 42);
+assert.strictEqual(stored, value);
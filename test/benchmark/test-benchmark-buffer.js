@@ -7,16 +7,19 @@ const runBenchmark = require('../common/benchmark');
 runBenchmark('buffers',
              [
                'aligned=true',
+               'alphabet=standard',
                'args=1',
                'buffer=fast',
                'byteLength=1',
                'charsPerLine=6',
+               'codec=hex',
                'encoding=utf8',
                'endian=BE',
                'len=2',
                'linesCount=1',
                'method=',
                'n=1',
+               'op=decode',
                'pieces=1',
                'pieceSize=1',
                'search=@',
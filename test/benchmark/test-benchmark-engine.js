@@ -0,0 +1,24 @@
+'use strict';
+
+require('../common');
+
+const runBenchmark = require('../common/benchmark');
+
+runBenchmark('engine',
+             [
+               'copies=1',
+               'keys=int',
+               'kind=call',
+               'live=10',
+               'method=',
+               'mode=',
+               'n=1',
+               'op=has',
+               'pattern=literal',
+               'shape=numbers',
+               'size=1',
+               'stat=throughput',
+               'type=Set',
+               'workload=request'
+             ],
+             { NODEJS_BENCHMARK_ZERO_ALLOWED: 1 });
@@ -17,8 +17,10 @@ const runBenchmark = require('../common/benchmark');
 
 runBenchmark('napi',
              [
-               'n=1',
+               'api=FunctionCallback',
                'engine=v8',
+               'len=16',
+               'n=1',
                'type=String'
              ],
              { NODEJS_BENCHMARK_ZERO_ALLOWED: 1 });
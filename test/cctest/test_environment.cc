@@ -93,6 +93,34 @@ TEST_F(EnvironmentTest, NonNodeJSContext) {
   EXPECT_EQ(node::Environment::GetCurrent(isolate_), nullptr);
 }
 
+TEST(ArrayBufferAllocatorTest, ReusesFreedBackingStores) {
+  node::ArrayBufferAllocator allocator;
+
+  void* data = allocator.AllocateUninitialized(1000);
+  ASSERT_NE(data, nullptr);
+  memset(data, 42, 1000);
+  allocator.Free(data, 1000);
+
+  // Smaller allocations of the same size class get the block, zero filled
+  // unless they are uninitialized
+  char* reused = static_cast<char*>(allocator.Allocate(900));
+  EXPECT_EQ(reused, data);
+  for (size_t i = 0; i < 900; i++)
+    ASSERT_EQ(reused[i], 0);
+  allocator.Free(reused, 900);
+
+  // A block is only known to hold the size it was freed with
+  void* larger = allocator.AllocateUninitialized(1000);
+  EXPECT_NE(larger, reused);
+  allocator.Free(larger, 1000);
+
+  // Large backing stores are not kept
+  void* large = allocator.AllocateUninitialized(1024 * 1024);
+  ASSERT_NE(large, nullptr);
+  allocator.Free(large, 1024 * 1024);
+  allocator.Free(nullptr, 0);
+}
+
 static void at_exit_callback1(void* arg) {
   called_cb_1 = true;
   if (arg) {
@@ -0,0 +1,81 @@
+#include "histogram-inl.h"
+
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using node::Histogram;
+
+TEST(HistogramTest, Empty) {
+  Histogram histogram;
+  EXPECT_EQ(0u, histogram.Count());
+  EXPECT_EQ(0u, histogram.Min());
+  EXPECT_EQ(0u, histogram.Max());
+  EXPECT_EQ(0, histogram.Mean());
+  EXPECT_EQ(0, histogram.Stddev());
+  EXPECT_EQ(0u, histogram.Percentile(50));
+}
+
+TEST(HistogramTest, SmallValuesAreExact) {
+  Histogram histogram;
+  for (uint64_t i = 1; i <= 100; i++)
+    histogram.Record(i);
+  EXPECT_EQ(100u, histogram.Count());
+  EXPECT_EQ(1u, histogram.Min());
+  EXPECT_EQ(100u, histogram.Max());
+  EXPECT_DOUBLE_EQ(50.5, histogram.Mean());
+  EXPECT_NEAR(28.866, histogram.Stddev(), 0.001);
+  EXPECT_EQ(1u, histogram.Percentile(0));
+  EXPECT_EQ(1u, histogram.Percentile(1));
+  EXPECT_EQ(50u, histogram.Percentile(50));
+  EXPECT_EQ(99u, histogram.Percentile(99));
+  EXPECT_EQ(100u, histogram.Percentile(100));
+}
+
+TEST(HistogramTest, LargeValuesArePrecise) {
+  Histogram histogram;
+  for (uint64_t value = 1000; value < 1000000000; value = value * 3 + 7) {
+    histogram.Reset();
+    histogram.Record(value);
+    histogram.Record(value * 2);
+    EXPECT_EQ(value, histogram.Min());
+    EXPECT_EQ(value * 2, histogram.Max());
+    uint64_t median = histogram.Percentile(50);
+    EXPECT_GE(median, value);
+    EXPECT_LE(median, value + value / Histogram::kSubBuckets);
+    EXPECT_EQ(value * 2, histogram.Percentile(100));
+  }
+}
+
+TEST(HistogramTest, ValuesAboveTheRange) {
+  Histogram histogram;
+  uint64_t huge = static_cast<uint64_t>(1) << 50;
+  histogram.Record(5);
+  histogram.Record(huge);
+  EXPECT_EQ(huge, histogram.Max());
+  EXPECT_EQ(5u, histogram.Percentile(50));
+  EXPECT_EQ(huge, histogram.Percentile(100));
+}
+
+TEST(HistogramTest, Percentiles) {
+  Histogram histogram;
+  histogram.Record(10);
+  histogram.Record(10);
+  histogram.Record(20);
+  histogram.Record(30000);
+  std::vector<std::pair<double, uint64_t>> percentiles;
+  histogram.Percentiles([&](double percentile, uint64_t value) {
+    percentiles.emplace_back(percentile, value);
+  });
+  ASSERT_EQ(4u, percentiles.size());
+  EXPECT_EQ(0, percentiles[0].first);
+  EXPECT_EQ(10u, percentiles[0].second);
+  EXPECT_EQ(50, percentiles[1].first);
+  EXPECT_EQ(10u, percentiles[1].second);
+  EXPECT_EQ(75, percentiles[2].first);
+  EXPECT_EQ(20u, percentiles[2].second);
+  EXPECT_EQ(100, percentiles[3].first);
+  EXPECT_EQ(30000u, percentiles[3].second);
+}
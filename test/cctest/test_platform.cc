@@ -2,6 +2,7 @@
 #include "libplatform/libplatform.h"
 
 #include <string>
+#include <vector>
 #include "gtest/gtest.h"
 #include "node_test_fixture.h"
 
@@ -35,6 +36,21 @@ class RepostingTask : public v8::Task {
   node::NodePlatform* platform_;
 };
 
+// This task appends its id to the given list of ids when it runs.
+class RecordingTask : public v8::Task {
+ public:
+  RecordingTask(int id, std::vector<int>* ids) : id_(id), ids_(ids) {}
+
+  // v8::Task implementation
+  void Run() final {
+    ids_->push_back(id_);
+  }
+
+ private:
+  int id_;
+  std::vector<int>* ids_;
+};
+
 class PlatformTest : public EnvironmentTestFixture {};
 
 TEST_F(PlatformTest, SkipNewTasksInFlushForegroundTasks) {
@@ -52,3 +68,54 @@ TEST_F(PlatformTest, SkipNewTasksInFlushForegroundTasks) {
   EXPECT_EQ(3, run_count);
   EXPECT_FALSE(platform->FlushForegroundTasks(isolate_));
 }
+
+TEST_F(PlatformTest, DelayedTasksRunInOrderOfTheirDelay) {
+  const v8::HandleScope handle_scope(isolate_);
+  const Argv argv;
+  Env env {handle_scope, argv};
+  std::vector<int> ids;
+  platform->CallDelayedOnForegroundThread(
+      isolate_, new RecordingTask(1, &ids), 0.02);
+  platform->CallDelayedOnForegroundThread(
+      isolate_, new RecordingTask(2, &ids), 0.01);
+  platform->CallDelayedOnForegroundThread(
+      isolate_, new RecordingTask(3, &ids), 0.01);
+  platform->CallDelayedOnForegroundThread(
+      isolate_, new RecordingTask(4, &ids), 0);
+  EXPECT_TRUE(platform->FlushForegroundTasks(isolate_));
+  EXPECT_TRUE(ids.empty());
+
+  // The delayed task timer doesn't keep the loop alive on its own.
+  uv_timer_t timer;
+  uv_timer_init(&current_loop, &timer);
+  uv_timer_start(&timer, [](uv_timer_t*) {}, 100, 0);
+  uv_run(&current_loop, UV_RUN_DEFAULT);
+  uv_close(reinterpret_cast<uv_handle_t*>(&timer), nullptr);
+  uv_run(&current_loop, UV_RUN_DEFAULT);
+
+  EXPECT_EQ(std::vector<int>({ 4, 2, 3, 1 }), ids);
+}
+
+TEST(TaskQueueTest, HigherPriorityTasksArePoppedFirst) {
+  std::vector<int> ids;
+  node::TaskQueue<v8::Task> queue;
+  queue.Push(std::unique_ptr<v8::Task>(new RecordingTask(1, &ids)),
+             node::TaskPriority::kBestEffort);
+  queue.Push(std::unique_ptr<v8::Task>(new RecordingTask(2, &ids)));
+  queue.Push(std::unique_ptr<v8::Task>(new RecordingTask(3, &ids)),
+             node::TaskPriority::kUserBlocking);
+  queue.Push(std::unique_ptr<v8::Task>(new RecordingTask(4, &ids)));
+  while (std::unique_ptr<v8::Task> task = queue.Pop())
+    task->Run();
+  EXPECT_EQ(std::vector<int>({ 3, 2, 4, 1 }), ids);
+
+  ids.clear();
+  queue.Push(std::unique_ptr<v8::Task>(new RecordingTask(1, &ids)),
+             node::TaskPriority::kBestEffort);
+  queue.Push(std::unique_ptr<v8::Task>(new RecordingTask(2, &ids)),
+             node::TaskPriority::kUserBlocking);
+  std::queue<std::unique_ptr<v8::Task>> tasks = queue.PopAll();
+  for (; !tasks.empty(); tasks.pop())
+    tasks.front()->Run();
+  EXPECT_EQ(std::vector<int>({ 2, 1 }), ids);
+}
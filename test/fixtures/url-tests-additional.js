@@ -32,5 +32,27 @@ module.exports = [
     'url': 'https://github.com/nodejs/\uDE00node',
     'protocol': 'https:',
     'pathname': '/nodejs/%EF%BF%BDnode'
+  },
+  {
+    // long runs of characters mixed with ones that are percent-encoded
+    'url': 'http://example.com/long segment\\with"quotes"/and<more>' +
+           '?a query\'s value#frag ment`s end',
+    'pathname': '/long%20segment/with%22quotes%22/and%3Cmore%3E',
+    'search': '?a%20query%27s%20value',
+    'hash': '#frag%20ment%60s%20end'
+  },
+  {
+    // cannot-be-base URL
+    'url': 'mailto:some one@example.com?subject=a b#c d',
+    'pathname': 'some one@example.com',
+    'search': '?subject=a%20b',
+    'hash': '#c%20d'
+  },
+  {
+    // backslashes and quotes are kept for non-special schemes
+    'url': 'foo://host/a\\b c?d\'e f',
+    'href': 'foo://host/a\\b%20c?d\'e%20f',
+    'pathname': '/a\\b%20c',
+    'search': '?d\'e%20f'
   }
 ];
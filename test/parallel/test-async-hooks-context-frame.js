@@ -0,0 +1,58 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const async_hooks = require('async_hooks');
+const fs = require('fs');
+const { getContextFrame, setContextFrame, AsyncResource } = async_hooks;
+
+// Nothing is tracked until the first frame is set.
+assert.strictEqual(getContextFrame(), undefined);
+const before = new AsyncResource('BEFORE');
+
+const outer = { name: 'outer' };
+setContextFrame(outer);
+assert.strictEqual(getContextFrame(), outer);
+before.runInAsyncScope(common.mustCall(() => {
+  assert.strictEqual(getContextFrame(), undefined);
+}));
+assert.strictEqual(getContextFrame(), outer);
+
+// Resources implemented in JS.
+setTimeout(common.mustCall(() => {
+  assert.strictEqual(getContextFrame(), outer);
+}), 1);
+setImmediate(common.mustCall(() => {
+  assert.strictEqual(getContextFrame(), outer);
+}));
+process.nextTick(common.mustCall(() => {
+  assert.strictEqual(getContextFrame(), outer);
+}));
+
+// Resources implemented in C++.
+fs.stat(__filename, common.mustCall(() => {
+  assert.strictEqual(getContextFrame(), outer);
+
+  // A frame set inside of a callback only lasts until it returns.
+  const inner = { name: 'inner' };
+  setContextFrame(inner);
+  fs.stat(__filename, common.mustCall(() => {
+    assert.strictEqual(getContextFrame(), inner);
+  }));
+}));
+
+const resource = new AsyncResource('TEST');
+setContextFrame(undefined);
+resource.runInAsyncScope(common.mustCall(() => {
+  assert.strictEqual(getContextFrame(), outer);
+}));
+assert.strictEqual(getContextFrame(), undefined);
+
+// Promise reactions run in the frame then() was called in. ChakraCore does
+// not provide promise hooks.
+if (!common.isChakraEngine) {
+  setContextFrame(outer);
+  Promise.resolve().then(common.mustCall(() => {
+    assert.strictEqual(getContextFrame(), outer);
+  }));
+  setContextFrame(undefined);
+}
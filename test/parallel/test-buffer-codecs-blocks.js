@@ -0,0 +1,44 @@
+'use strict';
+
+// The hex and base64 codecs handle whole blocks of input with vector
+// instructions and the rest with scalar code. Exercise every split between
+// the two.
+
+require('../common');
+const assert = require('assert');
+
+for (let len = 0; len < 200; len++) {
+  const buf = Buffer.alloc(len);
+  for (let i = 0; i < len; i++)
+    buf[i] = (i * 131 + len) & 0xff;
+
+  const hex = buf.toString('hex');
+  assert.strictEqual(hex, Array.from(buf, (b) => {
+    return b.toString(16).padStart(2, '0');
+  }).join(''));
+  assert.deepStrictEqual(Buffer.from(hex, 'hex'), buf);
+  assert.deepStrictEqual(Buffer.from(hex.toUpperCase(), 'hex'), buf);
+  // Decoding stops at the first byte that is not hex.
+  if (len > 0) {
+    const at = (len * 7) % hex.length;
+    const bad = `${hex.slice(0, at)}g${hex.slice(at + 1)}`;
+    assert.deepStrictEqual(Buffer.from(bad, 'hex'),
+                           buf.slice(0, Math.floor(at / 2)));
+  }
+
+  const base64 = buf.toString('base64');
+  assert.deepStrictEqual(Buffer.from(base64, 'base64'), buf);
+  const url = base64.replace(/\+/g, '-').replace(/\//g, '_');
+  assert.deepStrictEqual(Buffer.from(url, 'base64'), buf);
+  assert.deepStrictEqual(Buffer.from(url.replace(/=+$/, ''), 'base64'), buf);
+  const wrapped = base64.replace(/.{1,19}/g, '$&\n');
+  assert.deepStrictEqual(Buffer.from(wrapped, 'base64'), buf);
+  // Invalid characters are skipped, and end the vectorized part.
+  if (len > 0) {
+    const at = (len * 5) % base64.length;
+    const bad = `${base64.slice(0, at)}*${base64.slice(at)}`;
+    assert.deepStrictEqual(Buffer.from(bad, 'base64'), buf);
+  }
+  // Strings that are not latin1 use the two-byte code path.
+  assert.deepStrictEqual(Buffer.from(`${base64}\u2028`, 'base64'), buf);
+}
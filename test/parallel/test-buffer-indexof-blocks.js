@@ -0,0 +1,31 @@
+'use strict';
+
+// Short needles are searched for 32 positions at a time, with the rest of
+// the haystack handled one byte at a time. Put matches and near misses on
+// both sides of every block boundary.
+
+require('../common');
+const assert = require('assert');
+
+const haystack = Buffer.alloc(130, 'a');
+
+for (let len = 2; len <= 34; len++) {
+  const needle = Buffer.alloc(len, 'a');
+  needle[0] = 0x62;  // 'b'
+  needle[len - 1] = 0x62;
+  // Differs only in the middle, so the first and last byte match.
+  const nearMiss = Buffer.from(needle);
+  nearMiss[len >> 1] = 0x63;  // 'c'
+
+  for (let pos = 0; pos + len <= haystack.length; pos++) {
+    const buf = Buffer.from(haystack);
+    if (len > 2 && pos >= len)
+      nearMiss.copy(buf, pos - len);
+    needle.copy(buf, pos);
+    assert.strictEqual(buf.indexOf(needle), pos);
+    assert.strictEqual(buf.indexOf(needle.toString('latin1'), 'latin1'), pos);
+    assert.strictEqual(buf.lastIndexOf(needle), pos);
+    assert.strictEqual(buf.indexOf(needle, pos + 1), -1);
+    assert.strictEqual(buf.includes(needle, pos), true);
+  }
+}
@@ -0,0 +1,76 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const child_process = require('child_process');
+
+if (process.argv[2] !== 'child') {
+  for (const value of [42, Infinity, 'foo']) {
+    common.expectsError(() => {
+      child_process.spawn(process.execPath, [], { serialization: value });
+    }, {
+      code: 'ERR_INVALID_OPT_VALUE',
+      message: `The value "${value}" is invalid ` +
+               'for option "options.serialization"'
+    });
+  }
+
+  const cp = child_process.spawn(process.execPath, [__filename, 'child'], {
+    stdio: ['ipc', 'inherit', 'inherit'],
+    serialization: 'advanced'
+  });
+
+  const circular = {};
+  circular.circular = circular;
+  // The large payload is split across several reads, while the short messages
+  // that follow it usually arrive together in one read.
+  const large = Buffer.alloc(1024 * 1024, 'x');
+
+  cp.once('message', common.mustCall((message) => {
+    assert.deepStrictEqual(message, { cmd: 'ready' });
+
+    cp.send([
+      new Uint32Array([1, 2, 3, 4]),
+      { v8: new Map([[1, 2]]) },
+      circular,
+      new Set([large]),
+      /foo/g,
+      new Date(0)
+    ]);
+    for (var i = 0; i < 100; i++)
+      cp.send(i);
+
+    cp.once('message', common.mustCall((message) => {
+      assert.strictEqual(message.length, 6);
+      assert.deepStrictEqual(message[0], new Uint32Array([1, 2, 3, 4]));
+      assert.deepStrictEqual(message[1], { v8: new Map([[1, 2]]) });
+      assert.strictEqual(message[2].circular, message[2]);
+      assert.deepStrictEqual([...message[3]][0], large);
+      assert.deepStrictEqual(message[4], /foo/g);
+      assert.deepStrictEqual(message[5], new Date(0));
+
+      cp.once('message', common.mustCall(({ sum }) => {
+        assert.strictEqual(sum, 99 * 100 / 2);
+      }));
+    }));
+  }));
+
+  cp.on('exit', common.mustCall((code) => {
+    assert.strictEqual(code, 0);
+  }));
+} else {
+  assert.strictEqual(process.env.NODE_CHANNEL_SERIALIZATION_MODE, undefined);
+  process.send({ cmd: 'ready' });
+  var sum = 0;
+  var count = 0;
+  process.on('message', common.mustCall((message) => {
+    if (typeof message !== 'number') {
+      process.send(message);
+      return;
+    }
+    sum += message;
+    if (++count === 100) {
+      process.send({ sum });
+      process.disconnect();
+    }
+  }, 101));
+}
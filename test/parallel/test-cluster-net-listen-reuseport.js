@@ -0,0 +1,47 @@
+'use strict';
+
+const common = require('../common');
+if (!common.isLinux)
+  common.skip('SO_REUSEPORT balancing is only tested on Linux');
+
+const assert = require('assert');
+const cluster = require('cluster');
+const net = require('net');
+const Countdown = require('../common/countdown');
+
+// This test ensures that with the `reusePort` option every worker binds a
+// listen socket of its own instead of asking the master for a handle.
+const WORKER_ACCOUNT = 3;
+
+if (cluster.isMaster) {
+  const workers = [];
+
+  // Pick a free port. The master keeps listening on it as well.
+  const server = net.createServer(common.mustNotCall());
+  server.listen({ port: 0, reusePort: true }, common.mustCall(() => {
+    const { port } = server.address();
+
+    const countdown = new Countdown(WORKER_ACCOUNT, () => {
+      server.close();
+      workers.forEach((worker) => worker.disconnect());
+    });
+
+    for (let i = 0; i < WORKER_ACCOUNT; i += 1) {
+      const worker = cluster.fork({ PORT: port });
+      worker.on('exit', common.mustCall((statusCode) => {
+        assert.strictEqual(statusCode, 0);
+      }));
+      worker.on('listening', common.mustCall((address) => {
+        assert.strictEqual(address.port, port);
+        countdown.dec();
+      }));
+      workers.push(worker);
+    }
+  }));
+} else {
+  cluster._getServer = common.mustNotCall();
+  net.createServer().listen({
+    port: +process.env.PORT,
+    reusePort: true,
+  }, common.mustCall());
+}
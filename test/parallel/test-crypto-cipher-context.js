@@ -0,0 +1,184 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+
+const key = crypto.randomBytes(32);
+
+function encrypt(algorithm, iv, plaintext, aad, authTagLength) {
+  const cipher = crypto.createCipheriv(algorithm, key, iv, { authTagLength });
+  if (aad !== undefined)
+    cipher.setAAD(aad);
+  const ciphertext = Buffer.concat([cipher.update(plaintext), cipher.final()]);
+  return { ciphertext, authTag: cipher.getAuthTag() };
+}
+
+const ciphers = [
+  { algorithm: 'aes-256-gcm', ivLength: 12 },
+  { algorithm: 'aes-256-gcm', ivLength: 16, authTagLength: 8 },
+  { algorithm: 'chacha20-poly1305', ivLength: 12, authTagLength: 16 }
+];
+if (crypto.getCiphers().includes('aes-256-ocb'))
+  ciphers.push({ algorithm: 'aes-256-ocb', ivLength: 12, authTagLength: 16 });
+
+// The output matches createCipheriv() for every message, including empty
+// messages and messages that are not a multiple of the block size, so the
+// context is re-initialized correctly between messages.
+for (const { algorithm, ivLength, authTagLength } of ciphers) {
+  const context = crypto.createCipherContext(algorithm, key, { authTagLength });
+  assert.strictEqual(context.authTagLength, authTagLength || 16);
+
+  for (const size of [0, 1, 15, 16, 17, 100, 1000]) {
+    const iv = crypto.randomBytes(ivLength);
+    const plaintext = crypto.randomBytes(size);
+    const aad = size % 2 ? crypto.randomBytes(size) : undefined;
+    const expected = encrypt(algorithm, iv, plaintext, aad, authTagLength);
+
+    const ciphertext = Buffer.alloc(size);
+    const authTag = Buffer.alloc(context.authTagLength);
+    assert.strictEqual(
+      context.encryptInto(iv, plaintext, ciphertext, authTag, aad), size);
+    assert.deepStrictEqual(ciphertext, expected.ciphertext);
+    assert.deepStrictEqual(authTag, expected.authTag);
+
+    // The output may be larger than the input.
+    const decrypted = Buffer.alloc(size + 4, 0xff);
+    assert.strictEqual(
+      context.decryptInto(iv, ciphertext, authTag, decrypted, aad), size);
+    assert.deepStrictEqual(decrypted.slice(0, size), plaintext);
+    assert.deepStrictEqual(decrypted.slice(size), Buffer.alloc(4, 0xff));
+
+    // Failed authentication throws and does not break the context.
+    authTag[0] ^= 1;
+    assert.throws(() => {
+      context.decryptInto(iv, ciphertext, authTag, decrypted, aad);
+    }, /^Error: Unsupported state or unable to authenticate data$/);
+    authTag[0] ^= 1;
+    context.decryptInto(iv, ciphertext, authTag, decrypted, aad);
+    assert.deepStrictEqual(decrypted.slice(0, size), plaintext);
+  }
+}
+
+// Large enough to be split across several jobs.
+{
+  const context = crypto.createCipherContext('aes-128-gcm', key.slice(0, 16));
+  const plaintexts = [];
+  const messages = [];
+  for (let i = 0; i < 300; i++) {
+    plaintexts.push(Buffer.from(`message ${i}`));
+    messages.push({
+      iv: crypto.randomBytes(12),
+      input: plaintexts[i],
+      output: Buffer.alloc(plaintexts[i].length),
+      authTag: Buffer.alloc(16),
+      aad: Buffer.from(`aad ${i}`)
+    });
+  }
+
+  context.encryptBatch(messages, common.mustCall((err, results) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(results, messages.map(() => true));
+
+    const decrypted = messages.map(({ iv, output, authTag, aad }) => {
+      return { iv, input: output, authTag, aad, output: Buffer.alloc(16) };
+    });
+    decrypted[7].authTag = Buffer.from(decrypted[7].authTag);
+    decrypted[7].authTag[3] ^= 1;
+    decrypted[200].aad = Buffer.from('not the aad');
+    context.decryptBatch(decrypted, common.mustCall((err, results) => {
+      assert.ifError(err);
+      assert.deepStrictEqual(results, messages.map((m, i) => {
+        return i !== 7 && i !== 200;
+      }));
+      for (let i = 0; i < plaintexts.length; i++) {
+        if (results[i]) {
+          const { output } = decrypted[i];
+          assert.deepStrictEqual(output.slice(0, plaintexts[i].length),
+                                 plaintexts[i]);
+        }
+      }
+    }));
+  }));
+
+  context.encryptBatch([], common.mustCall((err, results) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(results, []);
+  }));
+}
+
+// Unsupported ciphers and invalid options.
+{
+  assert.throws(() => crypto.createCipherContext('aes-128-cbc', key), {
+    message: 'Unsupported cipher for cipher context: aes-128-cbc'
+  });
+  assert.throws(() => crypto.createCipherContext('aes-256-ccm', key, {
+    authTagLength: 16
+  }), {
+    message: 'Unsupported cipher for cipher context: aes-256-ccm'
+  });
+  assert.throws(() => crypto.createCipherContext('nope', key), {
+    message: 'Unknown cipher'
+  });
+  assert.throws(() => crypto.createCipherContext('chacha20-poly1305', key), {
+    message: 'authTagLength required for chacha20-poly1305'
+  });
+  assert.throws(() => crypto.createCipherContext('aes-256-gcm', key, {
+    authTagLength: 7
+  }), {
+    message: 'Invalid authentication tag length: 7'
+  });
+  assert.throws(() => crypto.createCipherContext('aes-256-gcm', key.slice(1)), {
+    message: 'Invalid key length'
+  });
+}
+
+// Invalid arguments.
+{
+  const context = crypto.createCipherContext('aes-256-gcm', key);
+  const iv = Buffer.alloc(12);
+  const input = Buffer.alloc(8);
+  const authTag = Buffer.alloc(16);
+
+  assert.throws(() => {
+    context.encryptInto(iv, input, Buffer.alloc(7), authTag);
+  }, {
+    code: 'ERR_INVALID_ARG_VALUE',
+    name: 'TypeError [ERR_INVALID_ARG_VALUE]'
+  });
+  assert.throws(() => {
+    context.encryptInto(iv, input, Buffer.alloc(8), Buffer.alloc(12));
+  }, {
+    code: 'ERR_INVALID_ARG_VALUE',
+    name: 'TypeError [ERR_INVALID_ARG_VALUE]'
+  });
+  assert.throws(() => {
+    context.encryptInto(iv, input, 'output', authTag);
+  }, {
+    code: 'ERR_INVALID_ARG_TYPE',
+    name: 'TypeError [ERR_INVALID_ARG_TYPE]'
+  });
+  assert.throws(() => {
+    context.encryptInto(iv, input, Buffer.alloc(8), authTag, 1);
+  }, {
+    code: 'ERR_INVALID_ARG_TYPE',
+    name: 'TypeError [ERR_INVALID_ARG_TYPE]'
+  });
+  assert.throws(() => context.encryptBatch([], 'callback'), {
+    code: 'ERR_INVALID_CALLBACK',
+    name: 'TypeError [ERR_INVALID_CALLBACK]'
+  });
+  assert.throws(() => context.decryptBatch({}, common.mustNotCall()), {
+    code: 'ERR_INVALID_ARG_TYPE',
+    name: 'TypeError [ERR_INVALID_ARG_TYPE]'
+  });
+  assert.throws(() => {
+    context.decryptBatch([{ iv, input, authTag, output: Buffer.alloc(1) }],
+                         common.mustNotCall());
+  }, {
+    code: 'ERR_INVALID_ARG_VALUE',
+    message: /^The argument 'messages\[0\]\.output' must be at least as long/
+  });
+}
@@ -0,0 +1,96 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+
+const large = Buffer.alloc(4 * 1024 * 1024, 'abc');
+
+function hashSync(algorithm, data) {
+  return crypto.createHash(algorithm).update(data).digest();
+}
+
+function hmacSync(algorithm, key, data) {
+  return crypto.createHmac(algorithm, key).update(data).digest();
+}
+
+// Single inputs yield the same digests as the synchronous API.
+for (const data of ['', 'Test123', large, new Uint16Array([1, 2, 3])]) {
+  crypto.hash('sha256', data, common.mustCall((err, digest) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(digest, hashSync('sha256', data));
+  }));
+
+  crypto.hmac('sha1', 'Node', data, common.mustCall((err, digest) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(digest, hmacSync('sha1', 'Node', data));
+  }));
+}
+
+// Arrays are digested element-wise in one request.
+{
+  const inputs = [];
+  const keys = [];
+  for (let i = 0; i < 1000; i++) {
+    inputs.push(`message ${i}`);
+    keys.push(Buffer.from(`key ${i}`));
+  }
+
+  crypto.hash('md5', inputs, common.mustCall((err, digests) => {
+    assert.ifError(err);
+    assert.strictEqual(digests.length, inputs.length);
+    digests.forEach((digest, i) => {
+      assert.deepStrictEqual(digest, hashSync('md5', inputs[i]));
+    });
+  }));
+
+  crypto.hmac('sha512', 'shared', inputs, common.mustCall((err, digests) => {
+    assert.ifError(err);
+    digests.forEach((digest, i) => {
+      assert.deepStrictEqual(digest, hmacSync('sha512', 'shared', inputs[i]));
+    });
+  }));
+
+  crypto.hmac('sha256', keys, inputs, common.mustCall((err, digests) => {
+    assert.ifError(err);
+    digests.forEach((digest, i) => {
+      assert.deepStrictEqual(digest, hmacSync('sha256', keys[i], inputs[i]));
+    });
+  }));
+
+  crypto.hash('sha256', [], common.mustCall((err, digests) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(digests, []);
+  }));
+}
+
+common.expectsError(
+  () => crypto.hash('sha257', 'data', common.mustNotCall()),
+  {
+    code: 'ERR_CRYPTO_INVALID_DIGEST',
+    type: TypeError,
+    message: 'Invalid digest: sha257'
+  });
+
+common.expectsError(
+  () => crypto.hash('sha256', 'data'),
+  {
+    code: 'ERR_INVALID_CALLBACK',
+    type: TypeError
+  });
+
+common.expectsError(
+  () => crypto.hash('sha256', ['data', 42], common.mustNotCall()),
+  {
+    code: 'ERR_INVALID_ARG_TYPE',
+    type: TypeError
+  });
+
+common.expectsError(
+  () => crypto.hmac('sha256', ['a', 'b'], ['data'], common.mustNotCall()),
+  {
+    code: 'ERR_INVALID_ARG_VALUE',
+    type: TypeError
+  });
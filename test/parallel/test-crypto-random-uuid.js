@@ -0,0 +1,55 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+
+const uuidPattern =
+  /^[0-9a-f]{8}-[0-9a-f]{4}-4[0-9a-f]{3}-[89ab][0-9a-f]{3}-[0-9a-f]{12}$/;
+
+// Enough of them to go through several pools of pre-generated bytes.
+const uuids = new Set();
+for (let i = 0; i < 1000; i++) {
+  const uuid = crypto.randomUUID();
+  assert.strictEqual(typeof uuid, 'string');
+  assert(uuidPattern.test(uuid), uuid);
+  uuids.add(uuid);
+}
+assert.strictEqual(uuids.size, 1000);
+
+// Small synchronous requests are served from the same pool, including ones
+// that don't fit in what is left of it.
+{
+  const seen = new Set();
+  for (let i = 0; i < 500; i++) {
+    for (const size of [1, 16, 100, 255, 256, 257]) {
+      const buf = crypto.randomBytes(size);
+      assert.strictEqual(buf.length, size);
+      if (size >= 16) {
+        const hex = buf.toString('hex');
+        assert(!seen.has(hex));
+        seen.add(hex);
+      }
+    }
+  }
+}
+
+{
+  const buf = Buffer.alloc(32, 0xff);
+  crypto.randomFillSync(buf, 8, 16);
+  assert.deepStrictEqual(buf.slice(0, 8), Buffer.alloc(8, 0xff));
+  assert.deepStrictEqual(buf.slice(24), Buffer.alloc(8, 0xff));
+  assert.notDeepStrictEqual(buf.slice(8, 24), Buffer.alloc(16, 0xff));
+
+  const a = new Uint32Array(8);
+  crypto.randomFillSync(a, 2, 4);
+  assert.strictEqual(a[0], 0);
+  assert.strictEqual(a[1], 0);
+  assert.strictEqual(a[6], 0);
+  assert.strictEqual(a[7], 0);
+}
+
+// Zero-length requests still work.
+assert.strictEqual(crypto.randomBytes(0).length, 0);
@@ -0,0 +1,94 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+const fixtures = require('../common/fixtures');
+
+const certPem = fixtures.readSync('test_cert.pem', 'ascii');
+const keyPem = fixtures.readSync('test_key.pem', 'ascii');
+
+function sign(algorithm, data, options) {
+  return crypto.createSign(algorithm).update(data).sign(options);
+}
+
+// Large enough to be split across several jobs.
+const data = [];
+const signatures = [];
+for (let i = 0; i < 500; i++) {
+  data.push(Buffer.from(`message ${i}`));
+  signatures.push(sign('sha256', data[i], keyPem));
+}
+// Corrupt a few signatures and messages.
+signatures[3] = Buffer.from(signatures[3]);
+signatures[3][0] ^= 1;
+data[251] = Buffer.from('not the signed message');
+signatures[499] = Buffer.alloc(0);
+const expected = data.map((d, i) => i !== 3 && i !== 251 && i !== 499);
+
+crypto.verifyBatch('sha256', certPem, data, signatures,
+                   common.mustCall((err, results) => {
+                     assert.ifError(err);
+                     assert.deepStrictEqual(results, expected);
+                   }));
+
+// The results match Verify#verify(), including for RSA-PSS options.
+{
+  const options = {
+    key: certPem,
+    padding: crypto.constants.RSA_PKCS1_PSS_PADDING,
+    saltLength: crypto.constants.RSA_PSS_SALTLEN_DIGEST
+  };
+  const messages = ['a', 'b', 'c'];
+  const sigs = messages.map((m) => sign('sha1', m, Object.assign({}, options, {
+    key: keyPem
+  })));
+  sigs[1] = sign('sha1', 'b', keyPem);
+
+  crypto.verifyBatch('sha1', options, messages, sigs,
+                     common.mustCall((err, results) => {
+                       assert.ifError(err);
+                       assert.deepStrictEqual(results, messages.map((m, i) => {
+                         return crypto.createVerify('sha1').update(m)
+                           .verify(options, sigs[i]);
+                       }));
+                       assert.deepStrictEqual(results, [true, false, true]);
+                     }));
+}
+
+crypto.verifyBatch('sha256', certPem, [], [],
+                   common.mustCall((err, results) => {
+                     assert.ifError(err);
+                     assert.deepStrictEqual(results, []);
+                   }));
+
+common.expectsError(
+  () => crypto.verifyBatch('sha257', certPem, data, signatures,
+                           common.mustNotCall()),
+  {
+    code: 'ERR_CRYPTO_INVALID_DIGEST',
+    type: TypeError,
+    message: 'Invalid digest: sha257'
+  });
+
+common.expectsError(
+  () => crypto.verifyBatch('sha256', certPem, data, signatures.slice(1),
+                           common.mustNotCall()),
+  {
+    code: 'ERR_INVALID_ARG_VALUE',
+    type: TypeError
+  });
+
+common.expectsError(
+  () => crypto.verifyBatch('sha256', certPem, data, signatures),
+  {
+    code: 'ERR_INVALID_CALLBACK',
+    type: TypeError
+  });
+
+assert.throws(
+  () => crypto.verifyBatch('sha256', 'not a key', data, signatures,
+                           common.mustNotCall()),
+  Error);
@@ -0,0 +1,49 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const dgram = require('dgram');
+
+const count = 50;
+const client = dgram.createSocket({ type: 'udp4', recvBatch: true });
+
+const messages = [];
+for (let i = 0; i < count; i++)
+  messages.push({ msg: Buffer.from(`message ${i}`) });
+
+const messagesSent = common.mustCall((err, bytes) => {
+  assert.ifError(err);
+  assert.strictEqual(bytes,
+                     messages.reduce((sum, m) => sum + m.msg.length, 0));
+});
+
+client.on('listening', () => {
+  const port = client.address().port;
+  for (const m of messages) {
+    m.port = port;
+    m.address = common.localhostIPv4;
+  }
+  client.sendBatch(messages, messagesSent);
+});
+
+let received = 0;
+client.on('messages', common.mustCallAtLeast((batch) => {
+  assert.ok(batch.length > 0);
+  for (const { msg, rinfo } of batch) {
+    assert.ok(msg.equals(messages[received].msg));
+    assert.strictEqual(rinfo.size, msg.length);
+    assert.strictEqual(rinfo.port, client.address().port);
+    received++;
+  }
+  if (received === count)
+    client.close();
+}));
+
+assert.throws(() => client.sendBatch('not an array'), {
+  code: 'ERR_INVALID_ARG_TYPE'
+});
+assert.throws(() => client.sendBatch([{ msg: 'x', port: 0 }]), {
+  code: 'ERR_SOCKET_BAD_PORT'
+});
+
+client.bind(0);
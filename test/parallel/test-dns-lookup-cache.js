@@ -0,0 +1,110 @@
+'use strict';
+const common = require('../common');
+const dnstools = require('../common/dns');
+const dns = require('dns');
+const assert = require('assert');
+const dgram = require('dgram');
+
+// Test that dns.setLookupCache() makes dns.lookup() share requests in flight,
+// keep answers for their TTL and remember names that don't exist.
+
+const records = {
+  'cached.test': { type: 'A', address: '1.2.3.4', ttl: 3600 },
+  'short.test': { type: 'A', address: '5.6.7.8', ttl: 0 },
+  'missing.test': null
+};
+const queries = {};
+
+const server = dgram.createSocket('udp4');
+
+server.on('message', (msg, { address, port }) => {
+  const parsed = dnstools.parseDNSPacket(msg);
+  const { domain, type } = parsed.questions[0];
+  assert.strictEqual(type, 'A');
+  assert(domain in records, `unexpected query for ${domain}`);
+  queries[domain] = (queries[domain] || 0) + 1;
+
+  const record = records[domain];
+  server.send(dnstools.writeDNSPacket({
+    id: parsed.id,
+    questions: parsed.questions,
+    answers: record === null ? [] : [Object.assign({ domain }, record)]
+  }), port, address);
+});
+
+function lookup(hostname) {
+  return new Promise((resolve, reject) => {
+    dns.lookup(hostname, 4, (err, address) => {
+      if (err)
+        reject(err);
+      else
+        resolve(address);
+    });
+  });
+}
+
+server.bind(0, common.mustCall(async () => {
+  dns.setServers([`127.0.0.1:${server.address().port}`]);
+  dns.setLookupCache({ resolver: true });
+
+  // Concurrent lookups share one query, and later ones use the answer
+  const addresses = await Promise.all([
+    lookup('cached.test'),
+    lookup('cached.test'),
+    lookup('cached.test')
+  ]);
+  assert.deepStrictEqual(addresses, ['1.2.3.4', '1.2.3.4', '1.2.3.4']);
+  assert.strictEqual(await lookup('cached.test'), '1.2.3.4');
+  assert.strictEqual(queries['cached.test'], 1);
+
+  // Answers with a TTL of zero aren't kept
+  assert.strictEqual(await lookup('short.test'), '5.6.7.8');
+  assert.strictEqual(await lookup('short.test'), '5.6.7.8');
+  assert.strictEqual(queries['short.test'], 2);
+
+  // Names without addresses are remembered for a while
+  for (let i = 0; i < 2; i++) {
+    await assert.rejects(lookup('missing.test'), {
+      code: 'ENOTFOUND',
+      hostname: 'missing.test'
+    });
+  }
+  assert.strictEqual(queries['missing.test'], 1);
+
+  // A new cache starts out empty
+  dns.setLookupCache({ resolver: true, negativeTtl: 0 });
+  assert.strictEqual(await lookup('cached.test'), '1.2.3.4');
+  assert.strictEqual(queries['cached.test'], 2);
+  await assert.rejects(lookup('missing.test'), { code: 'ENOTFOUND' });
+  await assert.rejects(lookup('missing.test'), { code: 'ENOTFOUND' });
+  assert.strictEqual(queries['missing.test'], 3);
+
+  // Lookups through getaddrinfo() are cached as well
+  dns.setLookupCache({});
+  const first = await lookup('localhost');
+  assert.strictEqual(await lookup('localhost'), first);
+
+  dns.setLookupCache(false);
+  assert.strictEqual(await lookup('localhost'), first);
+
+  server.close();
+}));
+
+[1, 'cache', undefined].forEach((options) => {
+  common.expectsError(() => dns.setLookupCache(options), {
+    code: 'ERR_INVALID_ARG_TYPE',
+    type: TypeError
+  });
+});
+common.expectsError(() => dns.setLookupCache({ resolver: 1 }), {
+  code: 'ERR_INVALID_ARG_TYPE',
+  type: TypeError
+});
+common.expectsError(() => dns.setLookupCache({ maxEntries: 0 }), {
+  code: 'ERR_OUT_OF_RANGE',
+  type: RangeError
+});
+common.expectsError(() => dns.setLookupCache({ maxTtl: -1 }), {
+  code: 'ERR_OUT_OF_RANGE',
+  type: RangeError
+});
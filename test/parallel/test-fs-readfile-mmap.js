@@ -0,0 +1,76 @@
+'use strict';
+const common = require('../common');
+
+// Test reading files with the mmap option of fs.readFile() and
+// fs.readFileSync().
+
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+const contents = Buffer.alloc(256 * 1024);
+for (let i = 0; i < contents.length; i++)
+  contents[i] = i * 7 % 251;
+const filename = path.join(tmpdir.path, 'mmap.bin');
+fs.writeFileSync(filename, contents);
+
+const empty = path.join(tmpdir.path, 'empty.bin');
+fs.writeFileSync(empty, '');
+
+// The mapped contents match the file, and writing to them doesn't change it
+{
+  const data = fs.readFileSync(filename, { mmap: true });
+  assert.deepStrictEqual(data, contents);
+  data.fill(0);
+  assert.deepStrictEqual(fs.readFileSync(filename), contents);
+}
+
+fs.readFile(filename, { mmap: true }, common.mustCall((err, data) => {
+  assert.ifError(err);
+  assert.deepStrictEqual(data, contents);
+}));
+
+fs.readFile(filename, { mmap: true, encoding: 'latin1' },
+            common.mustCall((err, data) => {
+              assert.ifError(err);
+              assert.strictEqual(data, contents.toString('latin1'));
+            }));
+
+// Empty files can't be mapped and are read as usual
+assert.strictEqual(fs.readFileSync(empty, { mmap: true }).length, 0);
+fs.readFile(empty, { mmap: true }, common.mustCall((err, data) => {
+  assert.ifError(err);
+  assert.strictEqual(data.length, 0);
+}));
+
+// File descriptors are read from their current position instead of mapped
+{
+  const fd = fs.openSync(filename, 'r');
+  fs.readSync(fd, Buffer.alloc(100), 0, 100, null);
+  const data = fs.readFileSync(fd, { mmap: true });
+  assert.deepStrictEqual(data, contents.slice(100));
+  fs.closeSync(fd);
+}
+
+// Errors are reported as for other reads
+common.expectsError(
+  () => fs.readFileSync(path.join(tmpdir.path, 'missing'), { mmap: true }),
+  { code: 'ENOENT', syscall: 'open' });
+fs.readFile(path.join(tmpdir.path, 'missing'), { mmap: true },
+            common.mustCall((err) => {
+              assert.strictEqual(err.code, 'ENOENT');
+              assert.strictEqual(err.syscall, 'open');
+            }));
+
+[1, 'true', null].forEach((mmap) => {
+  common.expectsError(() => fs.readFileSync(filename, { mmap }), {
+    code: 'ERR_INVALID_ARG_TYPE',
+    type: TypeError
+  });
+  common.expectsError(
+    () => fs.readFile(filename, { mmap }, common.mustNotCall()),
+    { code: 'ERR_INVALID_ARG_TYPE', type: TypeError });
+});
@@ -0,0 +1,141 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+// Build a tree with a few levels and more entries than fit in one chunk
+const root = path.join(tmpdir.path, 'tree');
+const expected = new Map();
+function add(relative, isDirectory) {
+  const full = path.join(root, relative);
+  if (isDirectory)
+    fs.mkdirSync(full);
+  else
+    fs.writeFileSync(full, relative);
+  expected.set(relative, isDirectory);
+}
+fs.mkdirSync(root);
+for (let i = 0; i < 3; i++) {
+  const dir = `dir${i}`;
+  add(dir, true);
+  add(path.join(dir, 'nested'), true);
+  add(path.join(dir, 'nested', 'deep.txt'), false);
+  for (let j = 0; j < 20; j++)
+    add(path.join(dir, `file${j}.txt`), false);
+}
+add('empty', true);
+add('top.txt', false);
+
+if (!common.isWindows) {
+  // Links are reported but not followed
+  fs.symlinkSync('dir0', path.join(root, 'link'));
+  expected.set('link', false);
+}
+
+function checkEntries(entries, withStats) {
+  const seen = new Set();
+  for (const entry of entries) {
+    assert(expected.has(entry.path), `unexpected entry ${entry.path}`);
+    assert(!seen.has(entry.path), `${entry.path} reported twice`);
+    seen.add(entry.path);
+    assert(entry instanceof fs.Dirent);
+    assert.strictEqual(entry.name, path.basename(entry.path));
+    assert.strictEqual(entry.isDirectory(), expected.get(entry.path));
+    assert.strictEqual(entry.isSymbolicLink(), entry.path === 'link');
+
+    // A directory comes before its contents
+    const parent = path.dirname(entry.path);
+    if (parent !== '.')
+      assert(seen.has(parent), `${entry.path} reported before ${parent}`);
+
+    if (withStats) {
+      assert(entry.stats instanceof fs.Stats);
+      assert.strictEqual(entry.stats.isDirectory(), entry.isDirectory());
+      if (entry.isFile())
+        assert.strictEqual(entry.stats.size, Buffer.byteLength(entry.path));
+    } else {
+      assert.strictEqual(entry.stats, undefined);
+    }
+  }
+  assert.strictEqual(seen.size, expected.size);
+}
+
+// Async iteration, with and without stats
+(async function() {
+  for (const withStats of [false, true]) {
+    const entries = [];
+    for await (const entry of fs.walk(root, { stats: withStats, chunkSize: 7 }))
+      entries.push(entry);
+    checkEntries(entries, withStats);
+  }
+})().then(common.mustCall());
+
+// Reading chunks with callbacks, including reads made before the previous
+// one completed
+{
+  const walker = fs.walk(root, { chunkSize: 10 });
+  const entries = [];
+  const chunkSizes = [];
+  function onChunk(err, chunk) {
+    assert.ifError(err);
+    if (chunk === null) {
+      checkEntries(entries, false);
+      assert(chunkSizes.every((size) => size > 0 && size <= 10));
+      walker.read(common.mustCall((err, chunk) => {
+        assert.ifError(err);
+        assert.strictEqual(chunk, null);
+      }));
+      return;
+    }
+    chunkSizes.push(chunk.length);
+    entries.push(...chunk);
+    walker.read(onChunk);
+  }
+  walker.read(onChunk);
+  walker.read(onChunk);
+}
+
+// Closing stops the walk
+{
+  const walker = fs.walk(root, { chunkSize: 1 });
+  walker.read(common.mustCall((err, chunk) => {
+    assert.ifError(err);
+    assert.strictEqual(chunk.length, 1);
+    walker.close();
+    walker.read().then(common.mustCall((chunk) => {
+      assert.strictEqual(chunk, null);
+    }));
+  }));
+}
+
+// An empty directory has no entries
+fs.walk(path.join(root, 'empty')).read().then(common.mustCall((chunk) => {
+  assert.strictEqual(chunk, null);
+}));
+
+// A root that can't be read is an error
+fs.walk(path.join(root, 'missing')).read().catch(common.mustCall((err) => {
+  assert.strictEqual(err.code, 'ENOENT');
+  assert.strictEqual(err.syscall, 'scandir');
+}));
+assert.rejects(fs.walk(path.join(root, 'top.txt')).read(),
+               { code: 'ENOTDIR' }).then(common.mustCall());
+
+// Invalid arguments
+common.expectsError(() => fs.walk(root, { stats: 1 }), {
+  code: 'ERR_INVALID_ARG_TYPE',
+  type: TypeError
+});
+common.expectsError(() => fs.walk(root, { chunkSize: 0 }), {
+  code: 'ERR_OUT_OF_RANGE',
+  type: RangeError
+});
+common.expectsError(() => fs.walk(root).read('not a function'), {
+  code: 'ERR_INVALID_CALLBACK',
+  type: TypeError
+});
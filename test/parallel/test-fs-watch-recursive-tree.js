@@ -0,0 +1,83 @@
+'use strict';
+
+const common = require('../common');
+
+if (!common.isLinux)
+  common.skip('tests the inotify based recursive watch');
+
+// Directories that exist when the watch starts, directories created later
+// and directories moved within the tree are all watched, and changes made in
+// one turn of the event loop are merged.
+
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+const root = path.join(tmpdir.path, 'tree');
+fs.mkdirSync(path.join(root, 'existing', 'nested'), { recursive: true });
+
+const watcher = fs.watch(root, { recursive: true });
+const seen = [];
+let onEvent = null;
+watcher.on('change', (eventType, filename) => {
+  assert(eventType === 'rename' || eventType === 'change');
+  seen.push({ eventType, filename });
+  if (onEvent !== null)
+    onEvent(eventType, filename);
+});
+
+// The watches for directories created after the watch started are added
+// asynchronously, so keep changing the file until an event for it arrives.
+function waitFor(filename, change, next) {
+  const interval = setInterval(change, 20);
+  change();
+  onEvent = (eventType, eventFilename) => {
+    if (eventFilename !== filename)
+      return;
+    clearInterval(interval);
+    onEvent = null;
+    next();
+  };
+}
+
+function write(relative) {
+  fs.writeFileSync(path.join(root, relative), 'x');
+}
+
+const existing = path.join('existing', 'nested', 'a.txt');
+const created = path.join('created', 'deeper', 'b.txt');
+const moved = path.join('moved', 'deeper', 'b.txt');
+
+// Directories that exist when the watch starts are watched synchronously, so
+// a single write right away is seen.
+onEvent = common.mustCallAtLeast((eventType, filename) => {
+  if (filename !== existing)
+    return;
+  onEvent = null;
+  waitFor(created, () => {
+    fs.mkdirSync(path.join(root, 'created', 'deeper'), { recursive: true });
+    write(created);
+  }, common.mustCall(() => {
+    // Let events from the writes above arrive, then change the same file
+    // many times at once.
+    setTimeout(common.mustCall(() => {
+      seen.length = 0;
+      for (let i = 0; i < 20; i++)
+        write(created);
+      setTimeout(common.mustCall(() => {
+        const changes = seen.filter(({ filename }) => filename === created);
+        assert.deepStrictEqual(changes,
+                               [{ eventType: 'change', filename: created }]);
+
+        fs.renameSync(path.join(root, 'created'), path.join(root, 'moved'));
+        waitFor(moved, () => write(moved), common.mustCall(() => {
+          watcher.close();
+        }));
+      }), 200);
+    }), 100);
+  }));
+}, 1);
+write(existing);
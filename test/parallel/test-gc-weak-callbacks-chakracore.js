@@ -0,0 +1,38 @@
+'use strict';
+// Flags: --expose_gc
+
+// Test that the weak callbacks of many objects dying in the same collection
+// all run, while the objects that are still alive keep theirs.
+
+const common = require('../common');
+const assert = require('assert');
+const async_hooks = require('async_hooks');
+
+const kCount = 1000;
+const destroyedIds = new Set();
+async_hooks.createHook({
+  destroy: common.mustCallAtLeast((asyncId) => {
+    destroyedIds.add(asyncId);
+  }, kCount)
+}).enable();
+
+const deadIds = [];
+const alive = [];
+function createResources() {
+  for (let i = 0; i < kCount; i++) {
+    const res = new async_hooks.AsyncResource('foobar');
+    deadIds.push(res.asyncId());
+    alive.push(new async_hooks.AsyncResource('foobar'));
+  }
+}
+createResources();
+
+setImmediate(() => {
+  global.gc();
+  setImmediate(() => {
+    for (const asyncId of deadIds)
+      assert.ok(destroyedIds.has(asyncId), `${asyncId} wasn't destroyed`);
+    for (const res of alive)
+      assert.ok(!destroyedIds.has(res.asyncId()));
+  });
+});
@@ -0,0 +1,38 @@
+// Flags: --expose-internals
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+
+if (!common.isChakraEngine)
+  common.skip('checks the ChakraCore heap snapshot');
+
+common.expectWarning(
+  'Warning',
+  'These APIs are exposed only for testing and are not ' +
+  'tracked by any versioning system or deprecation process.'
+);
+const { createJSHeapDump } = require('internal/test/heap');
+
+class HeapSnapshotMarker {}
+const retained = [];
+for (let i = 0; i < 100; i++)
+  retained.push({ marker: new HeapSnapshotMarker(), name: 'heapSnapshotName' });
+
+// createJSHeapDump checks that the edge counts of the nodes add up
+const nodes = createJSHeapDump();
+assert.strictEqual(nodes[0].type, 'synthetic');
+assert.strictEqual(nodes[0].name, '(GC roots)');
+assert(nodes[0].outgoingEdges.length > 0);
+
+const strings = nodes.filter((node) => node.name === 'heapSnapshotName');
+assert(strings.length > 0);
+assert.strictEqual(strings[0].type, 'string');
+assert(strings[0].incomingEdges.length > 0);
+
+const closures = nodes.filter((node) => node.type === 'closure' &&
+                                        node.name === 'HeapSnapshotMarker');
+assert(closures.length > 0);
+
+const ids = new Set(nodes.map((node) => node.id));
+assert.strictEqual(ids.size, nodes.length);
+assert(retained.length > 0);
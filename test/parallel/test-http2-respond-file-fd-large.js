@@ -0,0 +1,53 @@
+'use strict';
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+const http2 = require('http2');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const tmpdir = require('../common/tmpdir');
+
+// A file that spans many DATA frames and many reads from the file, so that
+// chunks which were read ahead are written out in order.
+
+tmpdir.refresh();
+const fname = path.join(tmpdir.path, 'large.bin');
+const data = Buffer.alloc(3 * 1024 * 1024 + 123);
+for (let i = 0; i < data.length; i++)
+  data[i] = (i * 31 + (i >> 16)) & 0xff;
+fs.writeFileSync(fname, data);
+
+const offset = 4567;
+const length = data.length - 2 * offset;
+
+const server = http2.createServer();
+server.on('stream', (stream, headers) => {
+  const fd = fs.openSync(fname, 'r');
+  const options = headers[':path'] === '/range' ? { offset, length } : {};
+  stream.respondWithFD(fd, {}, options);
+  stream.on('close', common.mustCall(() => fs.closeSync(fd)));
+});
+
+server.listen(0, common.mustCall(() => {
+  const client = http2.connect(`http://localhost:${server.address().port}`);
+  let pending = 2;
+
+  for (const [reqPath, expected] of [
+    ['/', data],
+    ['/range', data.slice(offset, offset + length)]
+  ]) {
+    const req = client.request({ ':path': reqPath });
+    const chunks = [];
+    req.on('data', (chunk) => chunks.push(chunk));
+    req.on('end', common.mustCall(() => {
+      assert(Buffer.concat(chunks).equals(expected));
+      if (--pending === 0) {
+        client.close();
+        server.close();
+      }
+    }));
+    req.end();
+  }
+}));
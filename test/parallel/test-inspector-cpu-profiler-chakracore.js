@@ -0,0 +1,62 @@
+'use strict';
+const common = require('../common');
+common.skipIfInspectorDisabled();
+const assert = require('assert');
+const inspector = require('inspector');
+
+if (!common.isChakraEngine)
+  common.skip('checks the Profiler domain backed by the ChakraCore sampler');
+
+function busyLoop() {
+  const end = Date.now() + 200;
+  let sum = 0;
+  while (Date.now() < end) {
+    for (let i = 0; i < 1000; i++)
+      sum += Math.sqrt(i);
+  }
+  return sum;
+}
+
+const session = new inspector.Session();
+session.connect();
+
+session.post('Profiler.start', common.mustCall((err) => {
+  assert(err, 'the profiler has to be enabled first');
+}));
+
+session.post('Profiler.setSamplingInterval', { interval: 100 },
+             common.mustCall((err) => assert.ifError(err)));
+session.post('Profiler.enable', common.mustCall((err) => {
+  assert.ifError(err);
+  session.post('Profiler.start', common.mustCall((err) => {
+    assert.ifError(err);
+    busyLoop();
+    session.post('Profiler.stop', common.mustCall(checkProfile));
+  }));
+}));
+
+function checkProfile(err, { profile }) {
+  assert.ifError(err);
+  const { nodes, samples, timeDeltas } = profile;
+  assert.strictEqual(nodes[0].callFrame.functionName, '(root)');
+  assert(profile.endTime >= profile.startTime);
+  assert.strictEqual(samples.length, timeDeltas.length);
+
+  const ids = new Set(nodes.map((node) => node.id));
+  for (const node of nodes) {
+    for (const child of node.children || [])
+      assert(ids.has(child), `missing child node ${child}`);
+  }
+  for (const sample of samples)
+    assert(ids.has(sample), `missing sampled node ${sample}`);
+  assert(nodes.some((node) => node.callFrame.functionName === 'busyLoop'),
+         'the busy function is missing from the profile');
+
+  session.post('Profiler.stop', common.mustCall((err) => {
+    assert(err, 'the profile was already stopped');
+    session.post('Profiler.disable', common.mustCall((err) => {
+      assert.ifError(err);
+      session.disconnect();
+    }));
+  }));
+}
@@ -0,0 +1,36 @@
+'use strict';
+const common = require('../common');
+common.skipIfInspectorDisabled();
+const assert = require('assert');
+const inspector = require('inspector');
+
+if (!common.isChakraEngine)
+  common.skip('checks heap snapshots of the ChakraCore recycler');
+
+const session = new inspector.Session();
+session.connect();
+
+const chunks = [];
+const progress = [];
+session.on('HeapProfiler.addHeapSnapshotChunk', ({ params }) => {
+  chunks.push(params.chunk);
+});
+session.on('HeapProfiler.reportHeapSnapshotProgress', ({ params }) => {
+  progress.push(params);
+});
+
+session.post('HeapProfiler.takeHeapSnapshot', { reportProgress: true },
+             common.mustCall((err) => {
+               assert.ifError(err);
+               assert(chunks.length > 0);
+               const snapshot = JSON.parse(chunks.join(''));
+               assert(snapshot.snapshot.node_count > 0);
+               assert(Array.isArray(snapshot.nodes));
+               assert(Array.isArray(snapshot.strings));
+
+               assert(progress.length > 0);
+               const last = progress[progress.length - 1];
+               assert.strictEqual(last.finished, true);
+               assert.strictEqual(last.done, last.total);
+               session.disconnect();
+             }));
@@ -0,0 +1,54 @@
+'use strict';
+const common = require('../common');
+common.skipIfInspectorDisabled();
+const assert = require('assert');
+const inspector = require('inspector');
+
+if (!common.isChakraEngine)
+  common.skip('checks the ChakraCore sampling heap profiler');
+
+function findNode(node, name) {
+  if (node.callFrame.functionName === name)
+    return node;
+  for (const child of node.children) {
+    const found = findNode(child, name);
+    if (found)
+      return found;
+  }
+  return null;
+}
+
+const retained = [];
+function allocateSampledObjects() {
+  for (let i = 0; i < 10000; i++)
+    retained.push({ index: i, name: `sampled${i}` });
+}
+
+const session = new inspector.Session();
+session.connect();
+
+session.post('HeapProfiler.enable', common.mustCall((err) => {
+  assert.ifError(err);
+  session.post('HeapProfiler.startSampling', { samplingInterval: 1024 },
+               common.mustCall((err) => {
+                 assert.ifError(err);
+                 allocateSampledObjects();
+                 session.post('HeapProfiler.getSamplingProfile',
+                              common.mustCall(checkProfile));
+               }));
+}));
+
+function checkProfile(err, { profile }) {
+  assert.ifError(err);
+  assert.strictEqual(profile.head.callFrame.functionName, '(root)');
+  const node = findNode(profile.head, 'allocateSampledObjects');
+  assert(node, 'allocating function is missing from the profile');
+  assert(node.selfSize > 0);
+  assert(retained.length > 0);
+
+  session.post('HeapProfiler.stopSampling', common.mustCall((err, result) => {
+    assert.ifError(err);
+    assert(result.profile.head);
+    session.disconnect();
+  }));
+}
@@ -0,0 +1,36 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const { spawnSync } = require('child_process');
+
+if (!common.isChakraEngine)
+  common.skip('checks the ChakraCore runtime memory limit');
+
+// --max-old-space-size is applied as the runtime memory limit
+{
+  const child = spawnSync(process.execPath, [
+    '--max-old-space-size=128',
+    '-p', 'require("v8").getHeapStatistics().heap_size_limit'
+  ]);
+  assert.strictEqual(child.status, 0, child.stderr.toString());
+  assert.strictEqual(child.stdout.toString().trim(), `${128 * 1024 * 1024}`);
+  assert(!child.stderr.toString().includes('Ignored engine flag'));
+}
+
+// Running into the limit is an out of memory error script can handle instead
+// of the process being killed
+{
+  const child = spawnSync(process.execPath, [
+    '--max-old-space-size=64',
+    '-e',
+    `let a = [];
+     try {
+       for (;;) a.push(new Array(1e5).fill(a.length));
+     } catch (e) {
+       a = null;
+       console.log('caught');
+     }`
+  ]);
+  assert.strictEqual(child.status, 0, child.stderr.toString());
+  assert.strictEqual(child.stdout.toString().trim(), 'caught');
+}
@@ -0,0 +1,25 @@
+'use strict';
+// Flags: --expose-gc
+require('../common');
+const assert = require('assert');
+
+// Test that the memory node allocates for buffers counts as external memory
+// until the buffers are collected.
+
+const kSize = 1024 * 1024;
+const kCount = 16;
+
+const before = process.memoryUsage().external;
+let buffers = [];
+for (let i = 0; i < kCount; i++)
+  buffers.push(Buffer.from('x'.repeat(kSize)));
+const afterCreation = process.memoryUsage().external;
+assert(afterCreation - before >= kCount * kSize,
+       `Expected external memory to grow by ${kCount * kSize} bytes, ` +
+       `it grew by ${afterCreation - before}`);
+
+buffers = null;
+global.gc();
+const afterGC = process.memoryUsage().external;
+assert(afterGC < afterCreation,
+       `Expected external memory ${afterGC} to shrink from ${afterCreation}`);
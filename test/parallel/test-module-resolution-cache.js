@@ -0,0 +1,64 @@
+// Flags: --module-resolution-cache
+'use strict';
+
+// With --module-resolution-cache, stats made while resolving modules are
+// cached, but changes made through fs and changes seen by watchers still
+// reach require().
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const { execFileSync } = require('child_process');
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+function assertNotFound(request) {
+  common.expectsError(() => require(request), { code: 'MODULE_NOT_FOUND' });
+}
+
+// Creating a file
+const created = path.join(tmpdir.path, 'created');
+assertNotFound(created);
+fs.writeFileSync(`${created}.js`, 'module.exports = "created";');
+assert.strictEqual(require(created), 'created');
+
+// Creating a directory, then its index file
+const dir = path.join(tmpdir.path, 'dir');
+assertNotFound(dir);
+fs.mkdirSync(dir);
+assertNotFound(dir);
+fs.writeFileSync(path.join(dir, 'index.js'), 'module.exports = "dir";');
+assert.strictEqual(require(dir), 'dir');
+
+// Renaming a file into place
+const renamed = path.join(tmpdir.path, 'renamed');
+fs.writeFileSync(path.join(tmpdir.path, 'other.js'),
+                 'module.exports = "renamed";');
+assertNotFound(renamed);
+fs.renameSync(path.join(tmpdir.path, 'other.js'), `${renamed}.js`);
+assert.strictEqual(require(renamed), 'renamed');
+
+// A file created by another process is found once a watcher reports it
+const watched = path.join(tmpdir.path, 'watched');
+fs.mkdirSync(watched);
+const external = path.join(watched, 'external');
+assertNotFound(external);
+
+const watcher = fs.watch(watched, common.mustCall(() => {
+  watcher.close();
+  assert.strictEqual(require(external), 'external');
+}));
+
+// The other process writes the file elsewhere and moves it into place, so that
+// the watcher doesn't see it half written.
+const staged = path.join(tmpdir.path, 'external.tmp');
+const script = `
+  const fs = require('fs');
+  fs.writeFileSync(${JSON.stringify(staged)}, 'module.exports = "external";');
+  fs.renameSync(${JSON.stringify(staged)}, ${JSON.stringify(external)} + '.js');
+`;
+execFileSync(process.execPath, ['-e', script]);
+// Until the watcher's event arrives, the cached lookups are used
+assertNotFound(external);
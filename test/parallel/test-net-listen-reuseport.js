@@ -0,0 +1,30 @@
+'use strict';
+
+const common = require('../common');
+if (!common.isLinux)
+  common.skip('SO_REUSEPORT balancing is only tested on Linux');
+
+// This test ensures that servers listening with the `reusePort` option can
+// share a port, while a server without it cannot join them.
+const assert = require('assert');
+const net = require('net');
+
+const first = net.createServer();
+first.listen({ host: common.localhostIPv4, port: 0, reusePort: true },
+             common.mustCall(() => {
+               const { port } = first.address();
+               const second = net.createServer();
+               second.listen({ host: common.localhostIPv4, port,
+                               reusePort: true }, common.mustCall(() => {
+                 assert.strictEqual(second.address().port, port);
+
+                 const third = net.createServer();
+                 third.on('error', common.mustCall((err) => {
+                   assert.strictEqual(err.code, 'EADDRINUSE');
+                   second.close();
+                   first.close();
+                 }));
+                 third.listen({ host: common.localhostIPv4, port },
+                              common.mustNotCall());
+               }));
+             }));
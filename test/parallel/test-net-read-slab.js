@@ -0,0 +1,57 @@
+'use strict';
+
+// Short reads are copied into slices of a slab of the socket's own; long
+// reads keep a buffer of their own. Either way the bytes must arrive
+// unchanged, and no socket's chunks share memory with another's.
+
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+
+const small = [];
+for (let i = 0; i < 20; i++)
+  small.push(Buffer.from(`chunk ${i}`));
+const large = Buffer.alloc(64 * 1024, 'abcdefgh');
+const kClients = 2;
+
+const server = net.createServer(common.mustCall((socket) => {
+  let i = 0;
+  socket.on('data', common.mustCall(() => {
+    if (i < small.length)
+      socket.write(small[i++]);
+    else
+      socket.end(large);
+  }, small.length + 1));
+  socket.write(small[i++]);
+}, kClients));
+
+server.listen(0, common.mustCall(() => {
+  const slabs = [];
+  for (let c = 0; c < kClients; c++) {
+    const client = net.connect(server.address().port);
+    const chunks = [];
+    client.on('data', (chunk) => {
+      chunks.push(chunk);
+      client.write('ack');
+    });
+    client.on('end', common.mustCall(() => {
+      assert(Buffer.concat(chunks).equals(Buffer.concat([...small, large])));
+
+      // Every small write was answered before the next one was sent, so each
+      // arrived as its own read and they were all carved out of one slab.
+      const slabbed = chunks.slice(0, small.length);
+      for (const [i, chunk] of slabbed.entries()) {
+        assert(chunk.equals(small[i]));
+        assert.strictEqual(chunk.buffer, slabbed[0].buffer);
+        assert.strictEqual(chunk.byteOffset % 16, 0);
+      }
+
+      // The other client's chunks were carved out of a different slab.
+      for (const slab of slabs)
+        assert.notStrictEqual(slabbed[0].buffer, slab);
+      slabs.push(slabbed[0].buffer);
+      if (slabs.length === kClients)
+        server.close();
+    }));
+  }
+}));
@@ -0,0 +1,45 @@
+'use strict';
+
+// Strings long enough to be externalized by Buffer#toString() are written
+// from their own memory; the bytes on the wire must not change.
+
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+
+const size = 2 * 1024 * 1024;
+const ascii = Buffer.alloc(size, 'abcdefgh').toString('latin1');
+const latin1 = Buffer.alloc(size, 'café', 'latin1').toString('latin1');
+
+const expected = Buffer.concat([
+  Buffer.from(ascii, 'utf8'),
+  Buffer.from(latin1, 'latin1'),
+  Buffer.from(latin1, 'utf8'),  // Not ASCII, so it has to be encoded.
+  Buffer.from('end', 'utf8'),
+  Buffer.from(ascii, 'latin1'),
+  Buffer.from(latin1, 'utf8')
+]);
+
+const server = net.createServer(common.mustCall((socket) => {
+  socket.write(ascii, 'utf8');
+  socket.write(latin1, 'latin1');
+  socket.write(latin1, 'utf8');
+
+  socket.cork();
+  socket.write('end', 'utf8');
+  socket.write(ascii, 'latin1');
+  socket.write(latin1, 'utf8');
+  socket.uncork();
+
+  socket.end();
+}));
+
+server.listen(0, common.mustCall(() => {
+  const client = net.connect(server.address().port);
+  const chunks = [];
+  client.on('data', (chunk) => chunks.push(chunk));
+  client.on('end', common.mustCall(() => {
+    assert(Buffer.concat(chunks).equals(expected));
+    server.close();
+  }));
+}));
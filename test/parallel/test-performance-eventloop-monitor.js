@@ -0,0 +1,83 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const { monitorEventLoop } = require('perf_hooks');
+
+const phases = ['iteration', 'poll', 'idle', 'outsidePoll'];
+
+const monitor = monitorEventLoop();
+for (const phase of phases)
+  assert.strictEqual(monitor[phase].count, 0);
+
+[null, '50', undefined].forEach((percentile) => {
+  common.expectsError(() => monitor.idle.percentile(percentile), {
+    code: 'ERR_INVALID_ARG_TYPE',
+    type: TypeError
+  });
+});
+[0, -1, 101, NaN].forEach((percentile) => {
+  common.expectsError(() => monitor.idle.percentile(percentile), {
+    code: 'ERR_OUT_OF_RANGE',
+    type: RangeError
+  });
+});
+
+monitor.enable();
+monitor.enable();
+
+let ticks = 0;
+function tick() {
+  // Keep the loop busy outside the poll phase for a while.
+  const start = Date.now();
+  while (Date.now() - start < 5);
+  if (++ticks < 10) {
+    // Waits in poll, the timer fires outside of it.
+    setTimeout(tick, 20);
+    return;
+  }
+  setImmediate(common.mustCall(check));
+}
+setTimeout(tick, 20);
+
+function check() {
+  monitor.disable();
+
+  for (const phase of phases) {
+    const histogram = monitor[phase];
+    assert(histogram.count > 0, `${phase} has no values`);
+    assert(histogram.min <= histogram.mean, phase);
+    assert(histogram.mean <= histogram.max, phase);
+    assert(histogram.stddev >= 0, phase);
+    assert(histogram.percentile(50) >= histogram.min, phase);
+    assert(histogram.percentile(100) <= histogram.max, phase);
+
+    const percentiles = histogram.percentiles;
+    assert(percentiles instanceof Map);
+    assert.strictEqual(percentiles.get(0), histogram.min);
+    let last = -1;
+    for (const [percentile, value] of percentiles) {
+      assert(percentile > last || (percentile === 0 && last === -1));
+      assert(value <= histogram.max);
+      last = percentile;
+    }
+    assert.strictEqual(last, 100);
+  }
+
+  // The loop waited about 20 ms in poll each time and was busy for 5 ms
+  // running the timer.
+  assert(monitor.idle.max >= 10e6, `${monitor.idle.max}`);
+  assert(monitor.outsidePoll.max >= 4e6, `${monitor.outsidePoll.max}`);
+  assert(monitor.idle.mean <= monitor.poll.mean);
+
+  // Nothing is recorded while disabled.
+  const count = monitor.iteration.count;
+  setTimeout(common.mustCall(() => {
+    assert.strictEqual(monitor.iteration.count, count);
+    monitor.reset();
+    for (const phase of phases) {
+      assert.strictEqual(monitor[phase].count, 0);
+      assert.strictEqual(monitor[phase].max, 0);
+    }
+  }), 10);
+}
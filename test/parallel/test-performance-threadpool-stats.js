@@ -0,0 +1,34 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const { performance } = require('perf_hooks');
+
+const keys = [
+  'threads', 'idleThreads', 'size', 'running', 'pending', 'completed',
+  'waitTime', 'maxWaitTime', 'runTime', 'maxRunTime'
+];
+
+function check(stats) {
+  assert.deepStrictEqual(Object.keys(stats), ['cpu', 'fs', 'dns']);
+  for (const queue of Object.values(stats)) {
+    assert.deepStrictEqual(Object.keys(queue), keys);
+    for (const key of keys)
+      assert(queue[key] >= 0, `${key} is ${queue[key]}`);
+    assert(queue.maxWaitTime <= queue.waitTime);
+    assert(queue.maxRunTime <= queue.runTime);
+  }
+}
+
+const before = performance.threadpoolStats();
+check(before);
+
+fs.stat(__filename, common.mustCall((err) => {
+  assert.ifError(err);
+  const after = performance.threadpoolStats();
+  check(after);
+  // With io_uring the stat may not go through the threadpool at all.
+  assert(after.fs.completed >= before.fs.completed);
+  assert(after.fs.threads <= after.fs.size || after.fs.size === 0);
+}));
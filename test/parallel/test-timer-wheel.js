@@ -0,0 +1,95 @@
+// Flags: --expose-internals
+'use strict';
+
+require('../common');
+
+const assert = require('assert');
+const L = require('internal/linkedlist');
+const TimerWheel = require('internal/timer_wheel');
+
+function createTimer(start, timeout) {
+  return { _idleStart: start, _idleTimeout: timeout,
+           _idleNext: null, _idlePrev: null };
+}
+
+function drain(wheel, now) {
+  const due = [];
+  wheel.advance(now);
+  let timer;
+  while (timer = L.peek(wheel.due)) {
+    L.remove(timer);
+    due.push(timer);
+  }
+  return due;
+}
+
+{
+  // Timers fire in order, after their expiry but within the same tick.
+  const wheel = new TimerWheel();
+  wheel.reset(0);
+  assert.strictEqual(wheel.nextExpiry(), Infinity);
+
+  const timeouts = [1000, 1040, 5000, 70000, 3600000, 2 ** 31 - 1];
+  const timers = timeouts.map((timeout) => createTimer(0, timeout));
+  for (const timer of timers.slice().reverse())
+    assert(wheel.insert(timer) <= timer._idleTimeout + 32);
+
+  const fired = [];
+  let now = 0;
+  while (wheel.nextExpiry() !== Infinity) {
+    const next = wheel.nextExpiry();
+    assert(next > now);
+    now = next;
+    for (const timer of drain(wheel, now)) {
+      assert(timer._idleTimeout <= now);
+      assert(now - timer._idleTimeout < 32);
+      fired.push(timer._idleTimeout);
+    }
+  }
+  assert.deepStrictEqual(fired, timeouts);
+}
+
+{
+  // Cancelled and re-armed timers.
+  const wheel = new TimerWheel();
+  wheel.reset(100);
+  const cancelled = createTimer(100, 2000);
+  const moved = createTimer(100, 2000);
+  wheel.insert(cancelled);
+  wheel.insert(moved);
+  L.remove(cancelled);
+  moved._idleStart = 1000;
+  wheel.insert(moved);
+
+  assert.deepStrictEqual(drain(wheel, 2100), []);
+  assert.deepStrictEqual(drain(wheel, 3100), [moved]);
+  assert.strictEqual(wheel.nextExpiry(), Infinity);
+}
+
+{
+  // A timer armed for a tick that has passed already is due on the next one.
+  const wheel = new TimerWheel();
+  wheel.reset(0);
+  const timer = createTimer(0, 10);
+  wheel.insert(timer);
+  assert.deepStrictEqual(drain(wheel, 32), [timer]);
+}
+
+{
+  // Advancing far ahead in one call skips the empty ticks, but still moves
+  // every timer down and fires it, including past a cancelled one.
+  const wheel = new TimerWheel();
+  wheel.reset(0);
+  const cancelled = createTimer(0, 60000);
+  const timers = [5000, 300000, 90000000].map((timeout) => {
+    const timer = createTimer(0, timeout);
+    wheel.insert(timer);
+    return timer;
+  });
+  wheel.insert(cancelled);
+  L.remove(cancelled);
+
+  assert.deepStrictEqual(drain(wheel, 4999), []);
+  assert.deepStrictEqual(drain(wheel, 100000000), timers);
+  assert.strictEqual(wheel.nextExpiry(), Infinity);
+}
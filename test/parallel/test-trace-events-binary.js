@@ -0,0 +1,147 @@
+'use strict';
+const common = require('../common');
+const tmpdir = require('../common/tmpdir');
+const assert = require('assert');
+const cp = require('child_process');
+const fs = require('fs');
+const path = require('path');
+
+// Decodes a trace file written with --trace-event-format=binary, following
+// the description in doc/api/tracing.md.
+function decode(data) {
+  let pos = 0;
+  function byte() {
+    assert(pos < data.length, 'truncated trace file');
+    return data[pos++];
+  }
+  function varint() {
+    let value = 0;
+    let scale = 1;
+    let b;
+    do {
+      b = byte();
+      value += (b & 0x7f) * scale;
+      scale *= 128;
+    } while (b & 0x80);
+    return value;
+  }
+  function signed() {
+    const value = varint();
+    return value % 2 === 0 ? value / 2 : -(value + 1) / 2;
+  }
+  function string() {
+    const length = varint();
+    pos += length;
+    assert(pos <= data.length, 'truncated trace file');
+    return data.toString('utf8', pos - length, pos);
+  }
+  const strings = new Map();
+  function stringRef() {
+    const id = varint();
+    if (id === 0)
+      return string();
+    assert(strings.has(id), `undefined string id ${id}`);
+    return strings.get(id);
+  }
+
+  assert.strictEqual(data.toString('latin1', 0, 8), 'NODETRC\x01');
+  pos = 8;
+  const events = [];
+  let ts = 0;
+  let tts = 0;
+  while (pos < data.length) {
+    const type = byte();
+    if (type === 1) {
+      const id = varint();
+      assert.strictEqual(id, strings.size + 1);
+      strings.set(id, string());
+      continue;
+    }
+    assert.strictEqual(type, 2);
+    const ev = { ph: String.fromCharCode(byte()) };
+    ev.cat = stringRef();
+    ev.name = stringRef();
+    ev.pid = varint();
+    ev.tid = varint();
+    ev.ts = ts += signed();
+    ev.tts = tts += signed();
+    ev.dur = varint();
+    ev.tdur = varint();
+    const flags = byte();
+    if (flags & 2)
+      ev.scope = stringRef();
+    if (flags & 1)
+      ev.id = varint();
+    ev.args = {};
+    for (let i = byte(); i > 0; i--) {
+      const name = stringRef();
+      const argType = byte();
+      let value;
+      switch (argType) {
+        case 1: value = byte() !== 0; break;
+        case 2: value = varint(); break;
+        case 3: value = signed(); break;
+        case 4: value = data.readDoubleLE(pos); pos += 8; break;
+        case 5: value = varint(); break;
+        case 6:
+        case 7: value = string(); break;
+        case 8: value = JSON.parse(string() || 'null'); break;
+        default: assert.fail(`unknown argument type ${argType}`);
+      }
+      ev.args[name] = value;
+    }
+    events.push(ev);
+  }
+  return events;
+}
+
+tmpdir.refresh();
+
+const CODE =
+  'setTimeout(() => { for (var i = 0; i < 100000; i++) { "test" + i } }, 1)';
+
+function trace(format, file, callback) {
+  const proc = cp.spawn(process.execPath, [
+    '--trace-events-enabled',
+    '--trace-event-format', format,
+    '--trace-event-file-pattern', file,
+    '-e', CODE
+  ], { cwd: tmpdir.path });
+  proc.once('exit', common.mustCall((code) => {
+    assert.strictEqual(code, 0);
+    callback(fs.readFileSync(path.join(tmpdir.path, file)));
+  }));
+}
+
+trace('binary', 'binary.log', (binary) => {
+  trace('json', 'json.log', (json) => {
+    const events = decode(binary);
+    assert(events.length > 0);
+    assert(binary.length < json.length);
+
+    for (const ev of events)
+      assert(/^[A-Za-z]$/.test(ev.ph), ev.ph);
+
+    // JavaScript async_hooks trace events, with their ids.
+    const init = events.find((ev) => {
+      return ev.cat === 'node,node.async_hooks' && ev.name === 'Timeout' &&
+             ev.ph === 'b';
+    });
+    assert(init, 'no Timeout init event');
+    assert.strictEqual(typeof init.id, 'number');
+
+    // Timestamps are stored as differences but decode to absolute values.
+    const jsonEvents = JSON.parse(json.toString()).traceEvents;
+    const minTs = (list) => Math.min(...list.map((ev) => ev.ts));
+    assert(Math.abs(minTs(events) - minTs(jsonEvents)) < 60 * 1e6);
+  });
+});
+
+{
+  const child = cp.spawnSync(process.execPath, [
+    '--trace-event-format', 'xml', '-e', ''
+  ]);
+  assert.notStrictEqual(child.status, 0);
+  assert(/--trace-event-format must be "json" or "binary"/.test(
+    child.stderr.toString()));
+}
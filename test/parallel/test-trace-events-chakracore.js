@@ -0,0 +1,46 @@
+'use strict';
+const common = require('../common');
+if (!common.isChakraEngine)
+  common.skip('ChakraCore specific engine trace events');
+const assert = require('assert');
+const cp = require('child_process');
+const fs = require('fs');
+const path = require('path');
+
+const CODE = `
+  new Function('return 1')();
+  require('vm').runInThisContext('global.x = []');
+  for (let i = 0; i < 1000; i++) global.x.push({ i });
+  global.gc();
+`;
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+const FILE_NAME = path.join(tmpdir.path, 'node_trace.1.log');
+
+const proc = cp.spawn(process.execPath,
+                      [ '--trace-event-categories', 'v8',
+                        '--expose-gc',
+                        '-e', CODE ],
+                      { cwd: tmpdir.path });
+
+proc.once('exit', common.mustCall((code) => {
+  assert.strictEqual(code, 0);
+  const traces = JSON.parse(fs.readFileSync(FILE_NAME)).traceEvents
+    .filter((trace) => trace.pid === proc.pid && trace.cat === 'v8');
+
+  // Compiles are complete events with a duration.
+  const compiles = traces.filter((trace) => {
+    return trace.name === 'ChakraCore.Compile';
+  });
+  assert(compiles.length > 0);
+  for (const trace of compiles) {
+    assert.strictEqual(trace.ph, 'X');
+    assert(trace.dur >= 0);
+  }
+
+  // Collections are begin/end pairs.
+  const gcs = traces.filter((trace) => /^ChakraCore\.GC/.test(trace.name));
+  assert(gcs.some((trace) => trace.ph === 'B'));
+  assert(gcs.some((trace) => trace.ph === 'E'));
+}));
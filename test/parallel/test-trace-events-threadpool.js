@@ -0,0 +1,42 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const cp = require('child_process');
+const fs = require('fs');
+const path = require('path');
+const tmpdir = require('../common/tmpdir');
+
+const names = ['cpu', 'fs', 'dns', 'cpu.time', 'fs.time', 'dns.time'];
+
+if (process.argv[2] === 'child') {
+  const crypto = require('crypto');
+  crypto.pbkdf2('password', 'salt', 1000, 64, 'sha512', common.mustCall());
+} else {
+  tmpdir.refresh();
+
+  const proc = cp.fork(__filename,
+                       [ 'child' ], {
+                         cwd: tmpdir.path,
+                         execArgv: [
+                           '--trace-event-categories',
+                           'node.threadpool'
+                         ]
+                       });
+
+  proc.once('exit', common.mustCall(() => {
+    const file = path.join(tmpdir.path, 'node_trace.1.log');
+
+    assert(fs.existsSync(file));
+    fs.readFile(file, common.mustCall((err, data) => {
+      const traces = JSON.parse(data.toString()).traceEvents
+        .filter((trace) => trace.cat !== '__metadata');
+      assert(traces.length > 0);
+      traces.forEach((trace) => {
+        assert.strictEqual(trace.pid, proc.pid);
+        assert.strictEqual(trace.cat, 'node,node.threadpool');
+        assert.strictEqual(trace.ph, 'C');
+        assert(names.includes(trace.name));
+      });
+    }));
+  }));
+}
@@ -0,0 +1,93 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const v8 = require('v8');
+
+[1, 'true', null, {}].forEach((value) => {
+  common.expectsError(() => v8.setJitStatisticsEnabled(value), {
+    code: 'ERR_INVALID_ARG_TYPE',
+    type: TypeError
+  });
+  common.expectsError(() => v8.getJitStatistics(value), {
+    code: 'ERR_INVALID_ARG_TYPE',
+    type: TypeError
+  });
+  common.expectsError(() => v8.getDeoptLog(value), {
+    code: 'ERR_INVALID_ARG_TYPE',
+    type: TypeError
+  });
+});
+
+if (!common.isChakraEngine) {
+  v8.setJitStatisticsEnabled(true);
+  assert.strictEqual(v8.getJitStatistics(), undefined);
+  assert.strictEqual(v8.getDeoptLog(), undefined);
+  return;
+}
+
+assert.strictEqual(v8.getJitStatistics(), undefined);
+assert.strictEqual(v8.getDeoptLog(), undefined);
+
+v8.setJitStatisticsEnabled(true);
+assert.deepStrictEqual(v8.getJitStatistics(), []);
+
+function loop() {
+  let sum = 0;
+  for (let i = 0; i < 1e6; i++)
+    sum += i;
+  return sum;
+}
+for (let i = 0; i < 10; i++)
+  loop();
+
+// Compiled for numbers, then called with strings.
+function add(a, b) {
+  return a + b;
+}
+for (let i = 0; i < 1e4; i++)
+  add(i, 1);
+add('a', 'b');
+
+const log = v8.getDeoptLog();
+assert(log.entries.length <= log.deoptCount);
+let lastTime = 0;
+for (const entry of log.entries) {
+  assert(entry.time >= lastTime);
+  lastTime = entry.time;
+  assert.strictEqual(typeof entry.functionName, 'string');
+  assert.strictEqual(typeof entry.bailOutKind, 'string');
+  assert(entry.rejitReason === null || typeof entry.rejitReason === 'string');
+  assert(entry.loopNumber === null || Number.isInteger(entry.loopNumber));
+}
+
+const statistics = v8.getJitStatistics(true);
+assert(Array.isArray(statistics));
+for (const entry of statistics) {
+  assert.strictEqual(typeof entry.functionName, 'string');
+  assert.strictEqual(typeof entry.url, 'string');
+  assert(entry.lineNumber >= 1);
+  assert(entry.columnNumber >= 1);
+  assert(entry.loopBodyJitQueueTime >= entry.maxLoopBodyJitQueueTime);
+  assert(entry.osrEntryCount >= entry.loopBodyJitCount);
+  assert(entry.bailOutCount >= entry.osrBailOutCount);
+  const bailOuts = Object.values(entry.bailOuts).reduce((a, b) => a + b, 0);
+  assert.strictEqual(bailOuts, entry.bailOutCount);
+  const rejits = Object.values(entry.rejits).reduce((a, b) => a + b, 0);
+  assert.strictEqual(rejits, entry.rejitCount);
+}
+// The statistics are read after the log, so they can have more bailouts.
+assert(statistics.reduce((count, entry) => count + entry.bailOutCount, 0) >=
+       log.deoptCount);
+
+// JIT compilation can be turned off, so there may be no entry for `loop`.
+const entry = statistics.find((entry) => entry.functionName === 'loop');
+if (entry !== undefined) {
+  assert.strictEqual(entry.url, __filename);
+  assert(entry.osrEntryCount > 0);
+}
+
+assert.deepStrictEqual(v8.getJitStatistics(), []);
+assert.deepStrictEqual(v8.getDeoptLog(), { deoptCount: 0, entries: [] });
+
+v8.setJitStatisticsEnabled(false);
+assert.strictEqual(v8.getJitStatistics(), undefined);
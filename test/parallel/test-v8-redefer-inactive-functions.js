@@ -0,0 +1,29 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const v8 = require('v8');
+
+if (!common.isChakraEngine) {
+  assert.strictEqual(v8.redeferInactiveFunctions(), undefined);
+  return;
+}
+
+function startup() {
+  return 42;
+}
+assert.strictEqual(startup(), 42);
+
+// The first call collects the call counts, startup() has not been called
+// again by the second one.
+for (let i = 0; i < 2; i++) {
+  const result = v8.redeferInactiveFunctions();
+  assert.strictEqual(typeof result.functionCount, 'number');
+  assert.strictEqual(typeof result.freedBytes, 'number');
+  assert.ok(Number.isInteger(result.functionCount));
+  assert.ok(result.functionCount >= 0);
+  assert.ok(result.freedBytes >= 0);
+  assert.strictEqual(result.functionCount === 0, result.freedBytes === 0);
+}
+
+// Redeferred functions still run.
+assert.strictEqual(startup(), 42);
@@ -0,0 +1,22 @@
+'use strict';
+require('../common');
+
+// Test that every new context gets a working engine shim, whether it is set
+// up from source or from the byte code kept for later contexts.
+
+const assert = require('assert');
+const vm = require('vm');
+
+for (let i = 0; i < 4; i++) {
+  const context = vm.createContext({ i });
+  const results = vm.runInContext(`
+    const obj = {};
+    Error.captureStackTrace(obj);
+    const captured = obj.stack;
+    Error.prepareStackTrace = (err, frames) => frames.length;
+    [captured, new Error().stack, i];
+  `, context);
+  assert.strictEqual(typeof results[0], 'string');
+  assert.strictEqual(typeof results[1], 'number');
+  assert.strictEqual(results[2], i);
+}
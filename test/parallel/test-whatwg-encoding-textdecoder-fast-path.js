@@ -0,0 +1,82 @@
+'use strict';
+
+// TextDecoder turns well formed UTF-8, UTF-16LE and ASCII into strings
+// without ICU, and leaves whatever follows to ICU. Test inputs that switch
+// between the two, including across the blocks the validators work on.
+
+const common = require('../common');
+
+if (!common.hasIntl)
+  common.skip('missing Intl');
+
+const assert = require('assert');
+const { TextDecoder } = require('util');
+
+const text = 'ASCII, Grüße, Ελληνικά, 日本語, \u{1F600}\u{10FFFF} and more. ';
+const long = text.repeat(20);
+
+function decodeInChunks(encoding, bytes, size) {
+  const decoder = new TextDecoder(encoding);
+  let result = '';
+  for (let i = 0; i < bytes.length; i += size)
+    result += decoder.decode(bytes.slice(i, i + size), { stream: true });
+  return result + decoder.decode();
+}
+
+// Well formed input, whole and split anywhere
+for (const encoding of ['utf-8', 'utf-16le']) {
+  const bytes = Buffer.from(long, encoding === 'utf-8' ? 'utf8' : 'utf16le');
+  assert.strictEqual(new TextDecoder(encoding).decode(bytes), long);
+  for (const size of [1, 2, 3, 5, 31, 32, 33, 64, 100])
+    assert.strictEqual(decodeInChunks(encoding, bytes, size), long);
+}
+
+// Malformed UTF-8 at every position around the end of a 32 byte block
+const invalid = [
+  [[0xFF], '�'],
+  [[0xC0, 0x80], '��'],
+  [[0xE2, 0x82], '�'],
+  [[0xED, 0xA0, 0x80], '���'],
+  [[0xF4, 0x90, 0x80, 0x80], '����'],
+  [[0x80], '�']
+];
+for (const [sequence, replacement] of invalid) {
+  for (let offset = 24; offset < 40; offset++) {
+    const bytes = Buffer.concat([
+      Buffer.alloc(offset, 'a'), Buffer.from(sequence), Buffer.from('bé')
+    ]);
+    const expected = `${'a'.repeat(offset)}${replacement}bé`;
+    assert.strictEqual(new TextDecoder().decode(bytes), expected);
+    assert.strictEqual(decodeInChunks('utf-8', bytes, 7), expected);
+    assert.throws(() => new TextDecoder('utf-8', { fatal: true }).decode(bytes),
+                  { code: 'ERR_ENCODING_INVALID_ENCODED_DATA' });
+  }
+}
+
+// UTF-16LE that doesn't start on an even address, and unpaired surrogates
+{
+  const bytes = Buffer.from(long, 'utf16le');
+  const unaligned = new Uint8Array(new ArrayBuffer(bytes.length + 1), 1);
+  unaligned.set(bytes);
+  assert.strictEqual(new TextDecoder('utf-16le').decode(unaligned), long);
+
+  const lone = Buffer.from(`${'x'.repeat(20)}\uD800y\uDC00z`, 'utf16le');
+  assert.strictEqual(new TextDecoder('utf-16le').decode(lone),
+                     `${'x'.repeat(20)}�y�z`);
+}
+
+// windows-1252 only agrees with latin1 on ASCII
+{
+  const bytes = Buffer.concat([Buffer.alloc(40, 'a'),
+                               Buffer.from([0x80, 0x9F, 0xE9])]);
+  assert.strictEqual(new TextDecoder('latin1').decode(bytes),
+                     `${'a'.repeat(40)}€Ÿé`);
+}
+
+// A byte order mark is still removed before the rest is decoded
+assert.strictEqual(
+  new TextDecoder().decode(Buffer.from(`﻿${long}`)), long);
+assert.strictEqual(
+  new TextDecoder('utf-8', { ignoreBOM: true })
+    .decode(Buffer.from(`﻿${long}`)),
+  `﻿${long}`);
@@ -0,0 +1,55 @@
+// Flags: --experimental-worker
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const { MessageChannel, Worker } = require('worker_threads');
+
+// A burst of messages from another thread arrives complete and in order.
+{
+  const count = 10000;
+  const w = new Worker(`
+    const { parentPort } = require('worker_threads');
+    for (let i = 0; i < ${count}; i++)
+      parentPort.postMessage(i);
+  `, { eval: true });
+  let expected = 0;
+  w.on('message', (i) => {
+    assert.strictEqual(i, expected++);
+  });
+  w.on('exit', common.mustCall(() => {
+    assert.strictEqual(expected, count);
+  }));
+}
+
+// Messages posted while the receiver is already draining its queue are
+// received without another wakeup.
+{
+  const { port1, port2 } = new MessageChannel();
+  let received = 0;
+  port1.on('message', common.mustCall((i) => {
+    assert.strictEqual(i, received++);
+    if (i < 99)
+      port2.postMessage(i + 1);
+    else
+      port1.close();
+  }, 100));
+  port2.postMessage(0);
+}
+
+// Messages queued before the port starts receiving are delivered once it
+// does, followed by later ones.
+{
+  const { port1, port2 } = new MessageChannel();
+  for (let i = 0; i < 10; i++)
+    port2.postMessage(i);
+  setImmediate(common.mustCall(() => {
+    let received = 0;
+    port1.on('message', common.mustCall((i) => {
+      assert.strictEqual(i, received++);
+      if (i === 9)
+        port2.postMessage(10);
+      if (i === 10)
+        port1.close();
+    }, 11));
+  }));
+}
@@ -0,0 +1,66 @@
+// Flags: --experimental-worker
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const { WorkerPool } = require('worker_threads');
+
+[null, 'a', 1].forEach((options) => {
+  common.expectsError(() => new WorkerPool(options), {
+    code: 'ERR_INVALID_ARG_TYPE',
+    type: TypeError
+  });
+});
+[-1, 1.5].forEach((size) => {
+  common.expectsError(() => new WorkerPool({ size }), {
+    code: 'ERR_OUT_OF_RANGE',
+    type: RangeError
+  });
+});
+
+// The pool is never closed; its waiting threads must not keep the process
+// running.
+const pool = new WorkerPool({ size: 2 });
+assert.strictEqual(pool.size, 2);
+assert.strictEqual(pool.idle, 2);
+
+const worker = pool.run(`
+  const { parentPort, workerData } = require('worker_threads');
+  parentPort.postMessage(workerData);
+`, { eval: true, workerData: { answer: 42 } });
+assert.strictEqual(pool.idle, 1);
+assert(worker.threadId > 0);
+
+worker.on('online', common.mustCall());
+worker.on('message', common.mustCall((message) => {
+  assert.deepStrictEqual(message, { answer: 42 });
+}));
+worker.on('exit', common.mustCall((code) => {
+  assert.strictEqual(code, 0);
+  // Replaced in the meantime.
+  assert.strictEqual(pool.idle, 2);
+
+  // A failed run() does not leave the pool short.
+  common.expectsError(() => pool.run('relative.js'), {
+    code: 'ERR_WORKER_PATH',
+    type: TypeError
+  });
+  assert.strictEqual(pool.idle, 1);
+  setImmediate(common.mustCall(() => assert.strictEqual(pool.idle, 2)));
+}));
+
+{
+  const closed = new WorkerPool({ size: 1 });
+  closed.close();
+  assert.strictEqual(closed.idle, 0);
+  common.expectsError(() => closed.run('./a.js'), {
+    code: 'ERR_WORKER_POOL_CLOSED',
+    type: Error
+  });
+}
+
+{
+  // With no waiting thread, run() starts a new one.
+  const empty = new WorkerPool({ size: 0 });
+  empty.run('process.exit(3)', { eval: true })
+    .on('exit', common.mustCall((code) => assert.strictEqual(code, 3)));
+}
@@ -0,0 +1,135 @@
+'use strict';
+const common = require('../common');
+const fixtures = require('../common/fixtures');
+const assert = require('assert');
+const zlib = require('zlib');
+
+if (zlib.constants.BROTLI_ENCODE === undefined) {
+  common.expectsError(() => zlib.createBrotliCompress(), {
+    code: 'ERR_NO_BROTLI',
+    type: Error
+  });
+  common.skip('missing Brotli support');
+}
+
+// Test some brotli-specific properties of the brotli streams that can not
+// be easily covered through expanding zlib-only tests.
+
+const sampleBuffer = fixtures.readSync('/pss-vectors.json');
+
+{
+  // Test setting the quality parameter at stream creation:
+  const sizes = [];
+  for (let quality = zlib.constants.BROTLI_MIN_QUALITY;
+    quality <= zlib.constants.BROTLI_MAX_QUALITY;
+    quality++) {
+    const encoded = zlib.brotliCompressSync(sampleBuffer, {
+      params: {
+        [zlib.constants.BROTLI_PARAM_QUALITY]: quality
+      }
+    });
+    assert.deepStrictEqual(zlib.brotliDecompressSync(encoded), sampleBuffer);
+    sizes.push(encoded.length);
+  }
+
+  // Increasing quality should roughly correspond to decreasing compressed size:
+  for (let i = 0; i < sizes.length - 1; i++) {
+    assert(sizes[i + 1] <= sizes[i] * 1.05, sizes);  // 5 % margin of error.
+  }
+  assert(sizes[0] > sizes[sizes.length - 1], sizes);
+}
+
+{
+  // Test that setting out-of-bounds option values or keys fails.
+  common.expectsError(() => {
+    zlib.createBrotliCompress({
+      params: {
+        10000: 0
+      }
+    });
+  }, {
+    code: 'ERR_BROTLI_INVALID_PARAM',
+    type: RangeError,
+    message: '10000 is not a valid Brotli parameter'
+  });
+
+  // Test that accidentally using duplicate keys fails.
+  common.expectsError(() => {
+    zlib.createBrotliCompress({
+      params: {
+        '0': 0,
+        '00': 0
+      }
+    });
+  }, {
+    code: 'ERR_BROTLI_INVALID_PARAM',
+    type: RangeError,
+    message: '00 is not a valid Brotli parameter'
+  });
+
+  common.expectsError(() => {
+    zlib.createBrotliCompress({
+      params: {
+        // This is a boolean flag
+        [zlib.constants.BROTLI_PARAM_DISABLE_LITERAL_CONTEXT_MODELING]: 42
+      }
+    });
+  }, {
+    code: 'ERR_BROTLI_PARAM_SET_FAILED',
+    type: Error,
+    message: 'Setting parameter failed'
+  });
+}
+
+{
+  // Test the streaming and convenience methods round-trip.
+  const decoder = zlib.createBrotliDecompress();
+  const chunks = [];
+  decoder.on('data', (chunk) => chunks.push(chunk));
+  decoder.on('end', common.mustCall(() => {
+    assert.deepStrictEqual(Buffer.concat(chunks), sampleBuffer);
+  }));
+  const encoder = zlib.createBrotliCompress({ chunkSize: 1024 });
+  encoder.on('error', common.mustNotCall());
+  decoder.on('error', common.mustNotCall());
+  encoder.pipe(decoder);
+  encoder.end(sampleBuffer);
+
+  zlib.brotliCompress(sampleBuffer, common.mustCall((err, encoded) => {
+    assert.ifError(err);
+    zlib.brotliDecompress(encoded, common.mustCall((err, decoded) => {
+      assert.ifError(err);
+      assert.deepStrictEqual(decoded, sampleBuffer);
+    }));
+  }));
+}
+
+{
+  // Test that flush() emits everything written so far.
+  const encoder = zlib.createBrotliCompress();
+  encoder.write('abcdef');
+  encoder.flush(common.mustCall(() => {
+    const flushed = encoder.read();
+    assert.strictEqual(zlib.brotliDecompressSync(flushed, {
+      finishFlush: zlib.constants.BROTLI_OPERATION_FLUSH
+    }).toString(), 'abcdef');
+    encoder.end();
+  }));
+}
+
+{
+  // Test that truncated and corrupted input is reported.
+  const encoded = zlib.brotliCompressSync(sampleBuffer);
+  common.expectsError(() => {
+    zlib.brotliDecompressSync(encoded.slice(0, encoded.length >> 1));
+  }, {
+    code: 'Z_BUF_ERROR',
+    message: 'unexpected end of file'
+  });
+
+  zlib.brotliDecompress(Buffer.from('not brotli'), common.mustCall((err) => {
+    assert(err instanceof Error);
+    assert(/^ERR_/.test(err.code), err.code);
+    assert.strictEqual(err.message, 'Decompression failed');
+  }));
+}
@@ -0,0 +1,60 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const zlib = require('zlib');
+
+// zlib.gzip() with the `parallel` option compresses blocks of the input on
+// several threadpool workers; the result must still be one valid gzip member.
+
+const text = Buffer.from('Lorem ipsum dolor sit amet, consectetur adipiscing ');
+const input = Buffer.alloc(1024 * 1024 + 123);
+for (let i = 0; i < input.length; i += text.length)
+  text.copy(input, i);
+// Sprinkle in some noise so that the blocks do not all look the same.
+for (let i = 0; i < input.length; i += 997)
+  input[i] = (i * 31) & 0xff;
+
+for (const blockSize of [32 * 1024, 100 * 1000, undefined, 4 * 1024 * 1024]) {
+  zlib.gzip(input, { parallel: true, blockSize },
+            common.mustCall((err, result) => {
+              assert.ifError(err);
+              assert.strictEqual(result[0], 0x1f);
+              assert.strictEqual(result[1], 0x8b);
+              assert.ok(result.length < input.length / 10);
+              assert.deepStrictEqual(zlib.gunzipSync(result), input);
+            }));
+}
+
+for (const windowBits of [8, 9]) {
+  zlib.gzip(input, { parallel: true, level: 1, windowBits },
+            common.mustCall((err, result) => {
+              assert.ifError(err);
+              assert.deepStrictEqual(zlib.gunzipSync(result), input);
+            }));
+}
+
+zlib.gzip('', { parallel: true }, common.mustCall((err, result) => {
+  assert.ifError(err);
+  assert.strictEqual(zlib.gunzipSync(result).length, 0);
+}));
+
+zlib.gzip(new Uint16Array([1, 2, 3]).subarray(1), { parallel: true },
+          common.mustCall((err, result) => {
+            assert.ifError(err);
+            assert.deepStrictEqual(zlib.gunzipSync(result),
+                                   Buffer.from([2, 0, 3, 0]));
+          }));
+
+common.expectsError(() => {
+  zlib.gzip(input, { parallel: true, blockSize: 1024 }, common.mustNotCall());
+}, {
+  code: 'ERR_OUT_OF_RANGE',
+  type: RangeError
+});
+
+common.expectsError(() => {
+  zlib.gzip(42, { parallel: true }, common.mustNotCall());
+}, {
+  code: 'ERR_INVALID_ARG_TYPE',
+  type: TypeError
+});
@@ -0,0 +1,62 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const zlib = require('zlib');
+
+// Small inputs to deflateSync(), gzipSync() and deflateRawSync() are
+// compressed with a single native call that reuses its z_stream. The output
+// must be the same as that of the stream-based path, which is taken when a
+// stream-only option such as `chunkSize` is present.
+
+const json = Buffer.from(JSON.stringify({
+  id: 12345,
+  tags: ['alpha', 'beta', 'gamma'],
+  text: 'The quick brown fox jumps over the lazy dog. '.repeat(100)
+}));
+
+const inputs = [
+  Buffer.alloc(0),
+  Buffer.from('a'),
+  json,
+  json.toString('latin1'),
+  new Uint8Array(json.buffer, json.byteOffset, 1000),
+  Buffer.alloc(64 * 1024, 'abc'),
+  Buffer.alloc(64 * 1024 + 1, 'abc')
+];
+
+const optionSets = [
+  undefined,
+  { level: 9 },
+  { level: 1, strategy: zlib.constants.Z_RLE },
+  { windowBits: 9, memLevel: 1 },
+  {}
+];
+
+for (const method of ['deflateSync', 'gzipSync', 'deflateRawSync']) {
+  // Alternate between parameter sets so that the cached stream is both
+  // reset and re-created.
+  for (let i = 0; i < 2; i++) {
+    for (const input of inputs) {
+      for (const opts of optionSets) {
+        const oneShot = zlib[method](input, opts);
+        const stream = zlib[method](input, Object.assign({}, opts, { chunkSize: 64 }));
+        assert.deepStrictEqual(oneShot, stream,
+                               `${method} ${JSON.stringify(opts)}`);
+      }
+    }
+  }
+}
+
+// windowBits of 8 is bumped to 9 for raw deflate, like createDeflateRaw().
+assert.deepStrictEqual(
+  zlib.inflateRawSync(zlib.deflateRawSync(json, { windowBits: 8 })), json);
+
+// Invalid options are reported the same way as for the stream-based path.
+common.expectsError(() => zlib.deflateSync(json, { level: 10 }), {
+  code: 'ERR_OUT_OF_RANGE',
+  type: RangeError
+});
+common.expectsError(() => zlib.gzipSync(json, { windowBits: 0 }), {
+  code: 'ERR_OUT_OF_RANGE',
+  type: RangeError
+});
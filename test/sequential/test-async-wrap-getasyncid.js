@@ -94,6 +94,12 @@ function testInitialized(req, ctor_name) {
 }
 
 
+{
+  const DirectoryWalker = internalBinding('fs').DirectoryWalker;
+  testInitialized(new DirectoryWalker(__dirname, false, 1), 'DirectoryWalker');
+}
+
+
 {
   const JSStream = internalBinding('js_stream').JSStream;
   testInitialized(new JSStream(), 'JSStream');
@@ -111,8 +117,9 @@ function testInitialized(req, ctor_name) {
 if (common.hasCrypto) { // eslint-disable-line node-core/crypto-check
   const crypto = require('crypto');
 
-  // The handle for PBKDF2 and RandomBytes isn't returned by the function call,
-  // so need to check it from the callback.
+  // The handle for PBKDF2, RandomBytes, hash, verifyBatch and encryptBatch
+  // isn't returned by the function call, so need to check it from the
+  // callback.
 
   const mc = common.mustCall(function pb() {
     testInitialized(this, 'AsyncWrap');
@@ -123,6 +130,25 @@ if (common.hasCrypto) { // eslint-disable-line node-core/crypto-check
     testInitialized(this, 'AsyncWrap');
   }));
 
+  crypto.hash('sha256', 'data', common.mustCall(function() {
+    testInitialized(this, 'AsyncWrap');
+  }));
+
+  const certPem = fixtures.readSync('test_cert.pem', 'ascii');
+  crypto.verifyBatch('sha256', certPem, ['data'], ['sig'],
+                     common.mustCall(function() {
+                       testInitialized(this, 'AsyncWrap');
+                     }));
+
+  crypto.createCipherContext('aes-128-gcm', Buffer.alloc(16)).encryptBatch([{
+    iv: Buffer.alloc(12),
+    input: Buffer.alloc(1),
+    output: Buffer.alloc(1),
+    authTag: Buffer.alloc(16)
+  }], common.mustCall(function() {
+    testInitialized(this, 'AsyncWrap');
+  }));
+
   if (typeof internalBinding('crypto').scrypt === 'function') {
     crypto.scrypt('password', 'salt', 8, common.mustCall(function() {
       testInitialized(this, 'AsyncWrap');
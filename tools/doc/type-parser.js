@@ -96,6 +96,9 @@ const customTypesMap = {
 
   'os.constants.dlopen': 'os.html#os_dlopen_constants',
 
+  'EventLoopHistogram':
+    'perf_hooks.html#perf_hooks_class_eventloophistogram',
+  'EventLoopMonitor': 'perf_hooks.html#perf_hooks_class_eventloopmonitor',
   'PerformanceEntry': 'perf_hooks.html#perf_hooks_class_performanceentry',
   'PerformanceNodeTiming':
     'perf_hooks.html#perf_hooks_class_performancenodetiming_extends_performanceentry', // eslint-disable-line max-len
@@ -127,8 +130,10 @@ const customTypesMap = {
   'URLSearchParams': 'url.html#url_class_urlsearchparams',
 
   'MessagePort': 'worker_threads.html#worker_threads_class_messageport',
+  'Worker': 'worker_threads.html#worker_threads_class_worker',
 
   'zlib options': 'zlib.html#zlib_class_options',
+  'brotli options': 'zlib.html#zlib_class_brotlioptions',
 };
 
 const arrayPart = /(?:\[])+$/;